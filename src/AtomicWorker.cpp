@@ -0,0 +1,218 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Microsoft
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Author: Mark Gottscho <mgottscho@ucla.edu>
+ */
+
+/**
+ * @file
+ * 
+ * @brief Implementation file for the AtomicWorker class.
+ */
+
+//Headers
+#include <AtomicWorker.h>
+#include <benchmark_kernels.h>
+#include <common.h>
+
+//Libraries
+#include <iostream>
+
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+using namespace xmem;
+
+AtomicWorker::AtomicWorker(
+        void* lines,
+        size_t num_lines,
+        size_t first_line,
+        atomic_op_t atomic_op,
+        std::atomic<uint32_t>* arrived,
+        uint32_t num_workers,
+        int32_t cpu_affinity
+    ) :
+        MemoryWorker(
+            lines,
+            num_lines * CACHE_LINE_SIZE,
+            cpu_affinity
+        ),
+        num_lines_(num_lines),
+        first_line_(first_line),
+        atomic_op_(atomic_op),
+        arrived_(arrived),
+        num_workers_(num_workers),
+        cas_failures_(0)
+    {
+}
+
+AtomicWorker::~AtomicWorker() {
+}
+
+uint64_t AtomicWorker::getOps() {
+    uint64_t retval = 0;
+    if (acquireLock(-1)) {
+        retval = static_cast<uint64_t>(passes_) * ATOMIC_OPS_PER_KERNEL_CALL;
+        releaseLock();
+    }
+
+    return retval;
+}
+
+uint64_t AtomicWorker::getCompareExchangeFailures() {
+    uint64_t retval = 0;
+    if (acquireLock(-1)) {
+        retval = cas_failures_;
+        releaseLock();
+    }
+
+    return retval;
+}
+
+double AtomicWorker::getMeanOpLatency() {
+    double retval = 0;
+    if (acquireLock(-1)) {
+        if (completed_ && passes_ > 0)
+            retval = (adjusted_ticks_ * g_ns_per_tick) / (static_cast<double>(passes_) * ATOMIC_OPS_PER_KERNEL_CALL);
+        releaseLock();
+    }
+
+    return retval;
+}
+
+void AtomicWorker::run() {
+    //Set up relevant state -- localized to this thread's stack
+    int32_t cpu_affinity = 0;
+    void* lines = NULL;
+    size_t num_lines = 0;
+    size_t first_line = 0;
+    atomic_op_t atomic_op = ATOMIC_FETCH_ADD;
+    std::atomic<uint32_t>* arrived = NULL;
+    uint32_t num_workers = 0;
+    AtomicFunction kernel_fptr = NULL;
+    AtomicFunction kernel_dummy_fptr = NULL;
+    tick_t start_tick = 0;
+    tick_t stop_tick = 0;
+    tick_t elapsed_ticks = 0;
+    tick_t elapsed_dummy_ticks = 0;
+    tick_t adjusted_ticks = 0;
+    tick_t target_ticks = g_ticks_per_ms * ATOMIC_BENCHMARK_DURATION_MS; //Rough target run duration in ticks
+    uint32_t passes = 0;
+    uint32_t p = 0;
+    size_t next_line = 0;
+    uint64_t result = 0;
+    uint64_t cas_failures = 0;
+    bool warning = false;
+
+    //Grab relevant setup state thread-safely and keep it local
+    if (acquireLock(-1)) {
+        lines = mem_array_;
+        num_lines = num_lines_;
+        first_line = first_line_;
+        atomic_op = atomic_op_;
+        arrived = arrived_;
+        num_workers = num_workers_;
+        cpu_affinity = cpu_affinity_;
+        releaseLock();
+    }
+
+    if (!determine_atomic_kernel(atomic_op, &kernel_fptr, &kernel_dummy_fptr)) {
+        std::cerr << "ERROR: Failed to find an atomic operation kernel." << std::endl;
+        arrived->fetch_add(1); //Still arrive, so that the other workers do not wait for this one forever
+        return;
+    }
+    
+    //Set processor affinity
+    bool locked = lock_thread_to_cpu(cpu_affinity);
+    if (!locked)
+        std::cerr << "WARNING: Failed to lock thread to logical CPU " << cpu_affinity << "! Results may not be correct." << std::endl;
+
+    //Increase scheduling priority
+#ifdef _WIN32
+    DWORD original_priority_class;
+    DWORD original_priority;
+    if (!boost_scheduling_priority(original_priority_class, original_priority))
+#endif
+#ifdef __gnu_linux__
+    if (!boost_scheduling_priority())
+#endif
+        std::cerr << "WARNING: Failed to boost scheduling priority. Perhaps running in Administrator mode would help." << std::endl;
+
+    //Wait for the other workers so that all of them contend for the lines for the whole run
+    arrived->fetch_add(1);
+    while (arrived->load() < num_workers)
+        ;
+
+    //Run actual version of function and loop overhead
+    next_line = first_line;
+    while (elapsed_ticks < target_ticks) {
+        start_tick = start_timer();
+        UNROLL16((*kernel_fptr)(lines, num_lines, &next_line, &result);)
+        stop_tick = stop_timer();
+        passes += 16;
+        elapsed_ticks += (stop_tick - start_tick);
+    }
+    if (atomic_op == ATOMIC_COMPARE_EXCHANGE) //The kernel counts failed operations instead of summing returned values
+        cas_failures = result;
+
+    //Run dummy version of function and loop overhead
+    next_line = first_line;
+    while (p < passes) {
+        start_tick = start_timer();
+        UNROLL16((*kernel_dummy_fptr)(lines, num_lines, &next_line, &result);)
+        stop_tick = stop_timer();
+        p += 16;
+        elapsed_dummy_ticks += (stop_tick - start_tick);
+    }
+
+    adjusted_ticks = elapsed_ticks - elapsed_dummy_ticks;
+
+    //Warn if something looks fishy
+    if (elapsed_dummy_ticks >= elapsed_ticks || elapsed_ticks < MIN_ELAPSED_TICKS || adjusted_ticks < 0.5 * elapsed_ticks)
+        warning = true;
+
+    //Unset processor affinity
+    if (locked)
+        unlock_thread_to_cpu();
+
+    //Revert thread priority
+#ifdef _WIN32
+    if (!revert_scheduling_priority(original_priority_class, original_priority))
+#endif
+#ifdef __gnu_linux__
+    if (!revert_scheduling_priority())
+#endif
+        std::cerr << "WARNING: Failed to revert scheduling priority. Perhaps running in Administrator mode would help." << std::endl;
+
+    //Update the object state thread-safely
+    if (acquireLock(-1)) {
+        elapsed_ticks_ = elapsed_ticks;
+        elapsed_dummy_ticks_ = elapsed_dummy_ticks;
+        adjusted_ticks_ = adjusted_ticks;
+        passes_ = passes;
+        cas_failures_ = cas_failures;
+        warning_ = warning;
+        completed_ = true;
+        releaseLock();
+    }
+}
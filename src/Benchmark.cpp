@@ -196,6 +196,12 @@ void Benchmark::reportBenchmarkInfo() const {
             else
                 std::cout << "write";
             break;
+        case READ_WRITE_1_1:
+        case READ_WRITE_2_1:
+        case READ_WRITE_3_1:
+        case READ_MODIFY_WRITE:
+            std::cout << rw_mode_name(rw_mode_);
+            break;
         default:
             std::cout << "UNKNOWN";
             break;
@@ -33,6 +33,22 @@
 #include <BenchmarkManager.h>
 #include <common.h>
 #include <Configurator.h>
+#include <sweep_analysis.h>
+#include <benchmark_kernels.h>
+#include <LoadWorker.h>
+#include <PingPongWorker.h>
+#include <ProducerConsumerWorker.h>
+#include <AtomicWorker.h>
+#include <FalseSharingWorker.h>
+#include <FlushWorker.h>
+#include <CopyWorker.h>
+#include <GatherWorker.h>
+#include <MultiStreamWorker.h>
+#include <UnalignedWorker.h>
+#include <DataPatternWorker.h>
+#include <TiledWorker.h>
+#include <RooflineWorker.h>
+#include <Thread.h>
 
 #ifdef EXT_DELAY_INJECTED_LOADED_LATENCY_BENCHMARK
 #include <DelayInjectedLoadedLatencyBenchmark.h>
@@ -54,13 +70,21 @@
 #include <stdlib.h>
 #include <iostream>
 #include <sstream>
+#include <cstdio>
+#include <cstring>
 #include <assert.h>
+#include <atomic>
+#include <csignal>
+#include <new>
+#include <algorithm>
+#include <map>
 
 #ifdef _WIN32
 #include <windows.h>
 #endif
 
 #ifdef __gnu_linux__
+#include <time.h>
 #ifdef HAS_NUMA
 #include <numa.h>
 #endif
@@ -73,6 +97,160 @@ extern "C" {
 
 using namespace xmem;
 
+static volatile sig_atomic_t g_interference_stop_requested = 0; /**< Raised by a stop signal while the interference generator runs. */
+
+/**
+ * @brief Signal handler that asks the interference generator to stop.
+ */
+static void request_interference_stop(int) {
+    g_interference_stop_requested = 1;
+}
+
+/**
+ * @brief Writes the mean, min, 25th percentile, median, 75th percentile, 95th percentile, 99th percentile, max, and mode of a set of per-iteration metrics as CSV columns, in the same way as Benchmark computes them.
+ * @param out The stream to write to.
+ * @param metric_on_iter The metric of each iteration. If empty, every column is written as N/A.
+ */
+static void write_metric_statistics(std::fstream& out, const std::vector<double>& metric_on_iter) {
+    if (metric_on_iter.empty()) {
+        for (uint32_t j = 0; j < 9; j++)
+            out << "N/A" << ",";
+        return;
+    }
+
+    double mean = 0;
+    std::map<double,uint32_t> counts;
+    for (uint32_t i = 0; i < metric_on_iter.size(); i++) {
+        mean += metric_on_iter[i];
+        counts[metric_on_iter[i]]++;
+    }
+    mean /= metric_on_iter.size();
+
+    double mode = 0;
+    uint32_t greatest_count = 0;
+    for (auto it = counts.cbegin(); it != counts.cend(); it++) {
+        if (it->second > greatest_count) {
+            greatest_count = it->second;
+            mode = it->first;
+        }
+    }
+
+    std::vector<double> sorted = metric_on_iter;
+    std::sort(sorted.begin(), sorted.end());
+    out << mean << ",";
+    out << sorted.front() << ",";
+    out << sorted[sorted.size()/4] << ",";
+    out << sorted[sorted.size()/2] << ",";
+    out << sorted[sorted.size()*3/4] << ",";
+    out << sorted[sorted.size()*95/100] << ",";
+    out << sorted[sorted.size()*99/100] << ",";
+    out << sorted.back() << ",";
+    out << mode << ",";
+}
+
+/**
+ * @brief Gets the median of a set of per-iteration metrics, in the same way as the benchmark summaries do.
+ * @param metric_on_iter The metric of each iteration. Must not be empty.
+ * @returns The median.
+ */
+static double median_metric(std::vector<double> metric_on_iter) {
+    std::sort(metric_on_iter.begin(), metric_on_iter.end());
+    return metric_on_iter[metric_on_iter.size()/2];
+}
+
+/**
+ * @brief Joins a list of NUMA nodes for the CPU NUMA node column of the results file, e.g., "0+1". Each node is listed once.
+ * @param nodes The NUMA nodes, possibly with repeats.
+ * @returns The joined list.
+ */
+static std::string join_numa_nodes(std::vector<uint32_t> nodes) {
+    std::sort(nodes.begin(), nodes.end());
+    nodes.erase(std::unique(nodes.begin(), nodes.end()), nodes.end());
+    std::ostringstream joined;
+    for (uint32_t i = 0; i < nodes.size(); i++)
+        joined << (i > 0 ? "+" : "") << nodes[i];
+    return joined.str();
+}
+
+/**
+ * @brief Checks whether a load kernel exists for a combination of load settings. For example, read/write mixes only have forward sequential and random kernels, and read-modify-write only has sequential kernels.
+ * @param rw Read/write mode.
+ * @param chunk Chunk size.
+ * @param stride Stride size in chunks, where 0 means random access.
+ * @returns True if a kernel exists.
+ */
+static bool load_kernel_available(rw_mode_t rw, chunk_size_t chunk, int32_t stride) {
+    if (stride == 0) {
+        RandomFunction kernel = NULL;
+        RandomFunction dummy_kernel = NULL;
+        return determine_random_kernel(rw, chunk, &kernel, &dummy_kernel);
+    }
+    SequentialFunction kernel = NULL;
+    SequentialFunction dummy_kernel = NULL;
+    return determine_sequential_kernel(rw, chunk, stride, &kernel, &dummy_kernel);
+}
+
+/**
+ * @brief Gets the size of a chunk.
+ * @param chunk Chunk size.
+ * @returns The size in bytes, or 0 if the chunk size is unknown.
+ */
+static size_t chunk_size_bytes(chunk_size_t chunk) {
+    switch (chunk) {
+        case CHUNK_32b:
+            return 4;
+#ifdef HAS_WORD_64
+        case CHUNK_64b:
+            return 8;
+#endif
+#ifdef HAS_WORD_128
+        case CHUNK_128b:
+            return 16;
+#endif
+#ifdef HAS_WORD_256
+        case CHUNK_256b:
+            return 32;
+#endif
+#ifdef HAS_WORD_512
+        case CHUNK_512b:
+            return 64;
+#endif
+        default:
+            return 0;
+    }
+}
+
+/**
+ * @brief Warns that a combination of load settings is skipped because no load kernel exists for it.
+ * @param rw Read/write mode.
+ * @param chunk Chunk size.
+ * @param stride Stride size in chunks, where 0 means random access.
+ */
+static void warn_load_kernel_unavailable(rw_mode_t rw, chunk_size_t chunk, int32_t stride) {
+    std::cerr << "WARNING: No load kernel is available for " << rw_mode_name(rw) << " with " << chunk_size_bytes(chunk) * 8 << "-bit chunks and ";
+    if (stride == 0)
+        std::cerr << "random access";
+    else
+        std::cerr << "a stride of " << stride;
+    std::cerr << ". Skipping this combination." << std::endl;
+}
+
+/**
+ * @brief Puts the calling thread to sleep.
+ * @param ms Number of milliseconds to sleep.
+ */
+static void sleep_ms(uint32_t ms) {
+#ifdef _WIN32
+    Sleep(ms);
+#endif
+#ifdef __gnu_linux__
+    struct timespec duration, remainder;
+    duration.tv_sec = ms / 1000;
+    duration.tv_nsec = (ms % 1000) * 1000000;
+    nanosleep(&duration, &remainder);
+#endif
+}
+
 BenchmarkManager::BenchmarkManager(
         Configurator &config
     ) :
@@ -86,8 +264,10 @@ BenchmarkManager::BenchmarkManager(
         mem_array_lens_(),
         tp_benchmarks_(),
         lat_benchmarks_(),
+        conc_tp_benchmarks_(),
         dram_power_readers_(),
         results_file_(),
+        latency_trace_file_(),
         built_benchmarks_(false)
     {
     //Set up DRAM power measurement
@@ -112,8 +292,8 @@ BenchmarkManager::BenchmarkManager(
     cpu_numa_node_affinities_ = config_.getCpuNumaNodeAffinities();
     memory_numa_node_affinities_ = config_.getMemoryNumaNodeAffinities();
 
-    //Build working memory regions
-    setupWorkingSets(config_.getWorkingSetSizePerThread());
+    //Build working memory regions. In a working set size sweep, only the largest size is allocated, and smaller sizes use sub-ranges of it.
+    setupWorkingSets(config_.getMaxWorkingSetSizePerThread());
 
     //Open results file
     if (config_.useOutputFile()) {
@@ -122,8 +302,12 @@ BenchmarkManager::BenchmarkManager(
             config_.setUseOutputFile(false);
             std::cerr << "WARNING: Failed to open " << config_.getOutputFilename() << " for writing! No results file will be generated." << std::endl;
         }
+    }
 
-        //Generate file headers
+    //Generate file headers. The interference generator logs a bandwidth time series instead of benchmark results.
+    if (config_.useOutputFile() && config_.interferenceSelected())
+        results_file_ << "Time (s),Interval Throughput (MB/s),Mean Throughput (MB/s),Target Throughput (MB/s)," << std::endl;
+    else if (config_.useOutputFile()) {
         results_file_ << "Test Name,Iterations,Working Set Size Per Thread (KB),Total Number of Threads,Number of Load Generating Threads,NUMA Memory Node,NUMA CPU Node,Load Access Pattern,Load Read/Write Mix,Load Chunk Size (bits),Load Stride Size (chunks),Mean Load Throughput,Min Load Throughput,25th Percentile Load Throughput,Median Load Throughput,75th Percentile Load Throughput,95th Percentile Load Throughput,99th Percentile Load Throughput,Max Load Throughput,Mode Load Throughput,Throughput Units,Mean Latency,Min Latency,25th Percentile Latency,Median Latency,75th Percentile Latency,95th Percentile Latency,99th Percentile Latency,Max Latency,Mode Latency,Latency Units,";
         for (uint32_t i = 0; i < dram_power_readers_.size(); i++)  {
             if (dram_power_readers_[i] != NULL) {
@@ -138,6 +322,15 @@ BenchmarkManager::BenchmarkManager(
         results_file_ << "Notes,";
         results_file_ << std::endl;
     }
+
+    //Open latency trace file
+    if (config_.useLatencyTraceFile()) {
+        latency_trace_file_.open(config_.getLatencyTraceFilename().c_str(), std::fstream::out);
+        if (!latency_trace_file_.is_open())
+            std::cerr << "WARNING: Failed to open " << config_.getLatencyTraceFilename() << " for writing! No latency trace file will be generated." << std::endl;
+        else
+            latency_trace_file_ << "Test Name,Iteration,Time (ms),Requested Load (MB/s),Mean Latency (ns/access),Worst Pass Latency (ns/access),Latency Passes," << std::endl;
+    }
 }
 
 BenchmarkManager::~BenchmarkManager() {
@@ -147,6 +340,9 @@ BenchmarkManager::~BenchmarkManager() {
     //Free latency benchmarks
     for (uint32_t i = 0; i < lat_benchmarks_.size(); i++)
         delete lat_benchmarks_[i];
+    //Free concurrent throughput and interconnect benchmarks
+    for (uint32_t i = 0; i < conc_tp_benchmarks_.size(); i++)
+        delete conc_tp_benchmarks_[i];
     //Free memory arrays
     for (uint32_t i = 0; i < mem_arrays_.size(); i++)
         if (mem_arrays_[i] != nullptr) {
@@ -169,6 +365,9 @@ BenchmarkManager::~BenchmarkManager() {
     //Close results file
     if (results_file_.is_open())
         results_file_.close();
+    //Close latency trace file
+    if (latency_trace_file_.is_open())
+        latency_trace_file_.close();
 }
 
 bool BenchmarkManager::runAll() {
@@ -178,6 +377,10 @@ bool BenchmarkManager::runAll() {
         success = success && runThroughputBenchmarks();
     if (config_.latencyTestSelected())
         success = success && runLatencyBenchmarks();
+    if (config_.concurrentThroughputTestSelected())
+        success = success && runConcurrentThroughputBenchmarks();
+    if (config_.interconnectTestSelected())
+        success = success && runInterconnectBenchmarks();
 
     return success;
 }
@@ -224,6 +427,18 @@ bool BenchmarkManager::runThroughputBenchmarks() {
                 case WRITE:
                     results_file_ << "WRITE" << ",";
                     break;
+                case READ_WRITE_1_1:
+                    results_file_ << "READ_WRITE_1_1" << ",";
+                    break;
+                case READ_WRITE_2_1:
+                    results_file_ << "READ_WRITE_2_1" << ",";
+                    break;
+                case READ_WRITE_3_1:
+                    results_file_ << "READ_WRITE_3_1" << ",";
+                    break;
+                case READ_MODIFY_WRITE:
+                    results_file_ << "READ_MODIFY_WRITE" << ",";
+                    break;
                 default:
                     results_file_ << "UNKNOWN" << ",";
                     break;
@@ -290,6 +505,14 @@ bool BenchmarkManager::runThroughputBenchmarks() {
         }
     }
 
+    if (config_.useWorkingSetSizeSweep()) {
+        std::vector<Benchmark*> benchmarks(tp_benchmarks_.begin(), tp_benchmarks_.end());
+        reportWorkingSetSizeSweep(benchmarks, "Throughput");
+    }
+
+    if (config_.useNumWorkerThreadsSweep())
+        reportNumWorkerThreadsSweep(tp_benchmarks_);
+
     if (g_verbose)
         std::cout << std::endl << "Done running throughput benchmarks." << std::endl;
 
@@ -314,10 +537,10 @@ bool BenchmarkManager::runLatencyBenchmarks() {
             results_file_ << lat_benchmarks_[i]->getIterations() << ",";
             results_file_ << static_cast<size_t>(lat_benchmarks_[i]->getLen() / lat_benchmarks_[i]->getNumThreads() / KB) << ",";
             results_file_ << lat_benchmarks_[i]->getNumThreads() << ",";
-            results_file_ << lat_benchmarks_[i]->getNumThreads()-1 << ",";
+            results_file_ << (lat_benchmarks_[i]->measuresAllCores() ? 0 : lat_benchmarks_[i]->getNumThreads()-1) << ",";
             results_file_ << lat_benchmarks_[i]->getMemNode() << ",";
             results_file_ << lat_benchmarks_[i]->getCPUNode() << ",";
-            if (lat_benchmarks_[i]->getNumThreads() < 2) {
+            if (lat_benchmarks_[i]->getNumThreads() < 2 || lat_benchmarks_[i]->measuresAllCores()) {
                 results_file_ << "N/A" << ",";
                 results_file_ << "N/A" << ",";
                 results_file_ << "N/A" << ",";
@@ -344,6 +567,18 @@ bool BenchmarkManager::runLatencyBenchmarks() {
                     case WRITE:
                         results_file_ << "WRITE" << ",";
                         break;
+                    case READ_WRITE_1_1:
+                        results_file_ << "READ_WRITE_1_1" << ",";
+                        break;
+                    case READ_WRITE_2_1:
+                        results_file_ << "READ_WRITE_2_1" << ",";
+                        break;
+                    case READ_WRITE_3_1:
+                        results_file_ << "READ_WRITE_3_1" << ",";
+                        break;
+                    case READ_MODIFY_WRITE:
+                        results_file_ << "READ_MODIFY_WRITE" << ",";
+                        break;
                     default:
                         results_file_ << "UNKNOWN" << ",";
                         break;
@@ -407,9 +642,60 @@ bool BenchmarkManager::runLatencyBenchmarks() {
                 results_file_ << lat_benchmarks_[i]->getPeakDRAMPower(j) << ",";
             }
             results_file_ << "N/A" << ",";
-            results_file_ << "" << ",";
+            std::vector<std::string> notes; //Joined with semicolons into the notes column
+            if (lat_benchmarks_[i]->measuresAllCores()) {
+                std::ostringstream note;
+                note << "all-core latency (ns/access) per CPU:";
+                for (uint32_t t = 0; t < lat_benchmarks_[i]->getNumThreads(); t++)
+                    note << " " << lat_benchmarks_[i]->getThreadCPU(t) << "=" << lat_benchmarks_[i]->getMeanThreadLatency(t);
+                notes.push_back(note.str());
+            }
+            if (lat_benchmarks_[i]->getNumThreads() > 1 && lat_benchmarks_[i]->getNumLoadPlacements() > 0) {
+                std::ostringstream note;
+                note << "load threads on CPU->memory NUMA nodes";
+                for (uint32_t p = 0; p < lat_benchmarks_[i]->getNumLoadPlacements(); p++)
+                    note << " " << lat_benchmarks_[i]->getLoadCPUNode(p) << "->" << lat_benchmarks_[i]->getLoadMemNode(p);
+                notes.push_back(note.str());
+            }
+            if (lat_benchmarks_[i]->getNumThreads() > 1 && lat_benchmarks_[i]->getLoadTargetBandwidth() > 0)
+                notes.push_back(static_cast<std::ostringstream*>(&(std::ostringstream() << "requested load " << lat_benchmarks_[i]->getLoadTargetBandwidth() << " MB/s with " << lat_benchmarks_[i]->getMeanLoadControllerError() << "% mean controller error"))->str());
+            if (lat_benchmarks_[i]->getNumThreads() > 1 && lat_benchmarks_[i]->usesLoadProfile()) {
+                notes.push_back(static_cast<std::ostringstream*>(&(std::ostringstream() << "load profile " << lat_benchmarks_[i]->getLoadProfile().getDescription() << " with " << lat_benchmarks_[i]->getMeanLoadControllerError() << "% mean controller error"))->str());
+                notes.push_back(static_cast<std::ostringstream*>(&(std::ostringstream() << "latency " << lat_benchmarks_[i]->getLowLoadLatency() << " ns/access at low load and " << lat_benchmarks_[i]->getHighLoadLatency() << " ns/access at high load"))->str());
+                notes.push_back(static_cast<std::ostringstream*>(&(std::ostringstream() << "recovery " << lat_benchmarks_[i]->getMeanRecoveryTime() << " ms mean and " << lat_benchmarks_[i]->getMaxRecoveryTime() << " ms max with " << lat_benchmarks_[i]->getNumUnrecoveredDrops() << " unrecovered drops"))->str());
+            }
+            for (uint32_t n = 0; n < notes.size(); n++)
+                results_file_ << (n > 0 ? "; " : "") << notes[n];
+            results_file_ << ",";
             results_file_ << std::endl;
         }
+
+        //Write latency time series to trace file if necessary
+        if (latency_trace_file_.is_open() && lat_benchmarks_[i]->getNumThreads() > 1 && lat_benchmarks_[i]->usesLoadProfile()) {
+            for (uint32_t iter = 1; iter <= lat_benchmarks_[i]->getIterations(); iter++) {
+                std::vector<LatencySample> samples = lat_benchmarks_[i]->getTimeSeriesOnIter(iter);
+                for (size_t s = 0; s < samples.size(); s++) {
+                    latency_trace_file_ << lat_benchmarks_[i]->getName() << ",";
+                    latency_trace_file_ << iter << ",";
+                    latency_trace_file_ << samples[s].time_ms << ",";
+                    latency_trace_file_ << lat_benchmarks_[i]->getRequestedLoadAt(samples[s]) << ",";
+                    if (samples[s].passes > 0) {
+                        latency_trace_file_ << samples[s].mean_latency_ns << ",";
+                        latency_trace_file_ << samples[s].max_latency_ns << ",";
+                    } else {
+                        latency_trace_file_ << "N/A" << ",";
+                        latency_trace_file_ << "N/A" << ",";
+                    }
+                    latency_trace_file_ << samples[s].passes << ",";
+                    latency_trace_file_ << std::endl;
+                }
+            }
+        }
+    }
+
+    if (config_.useWorkingSetSizeSweep()) {
+        std::vector<Benchmark*> benchmarks(lat_benchmarks_.begin(), lat_benchmarks_.end());
+        reportWorkingSetSizeSweep(benchmarks, "Latency");
     }
 
     if (g_verbose)
@@ -418,106 +704,206 @@ bool BenchmarkManager::runLatencyBenchmarks() {
     return true;
 }
 
-void BenchmarkManager::setupWorkingSets(size_t working_set_size) {
-    //Allocate memory in each NUMA node to be tested
+bool BenchmarkManager::runConcurrentThroughputBenchmarks() {
+    if (g_verbose)  {
+        std::cout << std::endl;
+        std::cout << "Generating concurrent all-node throughput benchmarks." << std::endl;
+    }
 
-    //We reserve the space for these, but that doesn't mean they will all be used.
-    mem_arrays_.resize(g_num_numa_nodes); 
-    mem_array_lens_.resize(g_num_numa_nodes);
+    std::vector<rw_mode_t> rws;
+    std::vector<chunk_size_t> chunks;
+    std::vector<int32_t> strides;
+    getConcurrentLoadSettings(rws, chunks, strides);
+
+    std::list<std::pair<uint32_t, uint32_t> > placements = config_.getConcurrentPlacements();
+    std::vector<uint32_t> cpu_nodes;
+    std::vector<uint32_t> mem_nodes;
+    for (auto it = placements.cbegin(); it != placements.cend(); it++) {
+        cpu_nodes.push_back(it->first);
+        mem_nodes.push_back(it->second);
+    }
 
-    for (auto it = memory_numa_node_affinities_.cbegin(); it != memory_numa_node_affinities_.cend(); it++) {
-        size_t allocation_size = 0;
-        uint32_t numa_node = *it;
+    //Build benchmarks
+    std::vector<ConcurrentThroughputBenchmark*> benchmarks;
+    for (uint32_t rw_index = 0; rw_index < rws.size(); rw_index++) { //iterate read/write access types
+        rw_mode_t rw = rws[rw_index];
 
-#ifdef HAS_LARGE_PAGES
-        if (config_.useLargePages()) {
-            size_t remainder = 0;
-            //For large pages, working set size could be less than a single large page. So let's allocate the right amount of memory, which is the working set size rounded up to nearest large page, which could be more than we actually use.
-            if (config_.getNumWorkerThreads() * working_set_size < g_large_page_size)
-                allocation_size = g_large_page_size;
-            else { 
-                remainder = (config_.getNumWorkerThreads() * working_set_size) % g_large_page_size;
-                allocation_size = (config_.getNumWorkerThreads() * working_set_size) + remainder;
-            }
-            
-#ifdef _WIN32
-            //Make sure we have necessary privileges
-            HANDLE hToken;
-            if (!OpenProcessToken(GetCurrentProcess(), TOKEN_ADJUST_PRIVILEGES | TOKEN_QUERY, &hToken)) {
-                std::cerr << "ERROR: Failed to open process token to adjust privileges! Did you remember to run in Administrator mode?" << std::endl;
-                exit(-1);
-            }
-            if (!SetPrivilege(hToken,"SeLockMemoryPrivilege", true)) {
-                std::cerr << "ERROR: Failed to adjust privileges to allow locking memory pages! Did you remember to run in Administrator mode?" << std::endl;
-                exit(-1);
-            }
-            CloseHandle(hToken);
-            
-            mem_arrays_[numa_node] = VirtualAllocExNuma(GetCurrentProcess(), NULL, allocation_size, MEM_COMMIT | MEM_RESERVE | MEM_LARGE_PAGES, PAGE_READWRITE, numa_node); //Windows NUMA allocation. Make the allocation one page bigger than necessary so that we can do alignment.
-#endif
-#ifdef __gnu_linux__
-            mem_arrays_[numa_node] = get_huge_pages(allocation_size, GHP_DEFAULT); 
-#endif
-        } else { //Non-large pages (nominal case)
-#endif
-            //Under normal (not large-page) operation, working set size is a multiple of regular pages.
-            allocation_size = config_.getNumWorkerThreads() * working_set_size + g_page_size; 
-#ifdef _WIN32
-            mem_arrays_[numa_node] = VirtualAllocExNuma(GetCurrentProcess(), NULL, allocation_size, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE, numa_node); //Windows NUMA allocation. Make the allocation one page bigger than necessary so that we can do alignment.
-#endif
-#ifdef __gnu_linux__
-#ifdef HAS_NUMA
-            numa_set_strict(1); //Enforce NUMA memory allocation to land on specified node or fail otherwise. Alternative node fallback is forbidden.
-            mem_arrays_[numa_node] = numa_alloc_onnode(allocation_size, numa_node);
-#endif
-#ifndef HAS_NUMA //special case
-            mem_arrays_[numa_node] = malloc(allocation_size);
-            orig_malloc_addr_ = mem_arrays_[numa_node];
-#endif
-#endif
-#ifdef HAS_LARGE_PAGES
-        }
-#endif
-        
-        if (mem_arrays_[numa_node] != nullptr)
-            mem_array_lens_[numa_node] = config_.getNumWorkerThreads() * working_set_size;
-        else {
-            std::cerr << "ERROR: Failed to allocate " << allocation_size << " B on NUMA node " << numa_node << " for " << config_.getNumWorkerThreads() << " worker threads." << std::endl;
-            exit(-1);
-        }
+        for (uint32_t chunk_index = 0; chunk_index < chunks.size(); chunk_index++) { //iterate different chunk sizes
+            chunk_size_t chunk = chunks[chunk_index];
 
-        if (g_verbose) {
-            std::cout << std::endl;
-            std::cout << "Virtual address for memory on NUMA node " << numa_node << ":" << std::endl;
-            std::printf("0x%.16llX", reinterpret_cast<long long unsigned int>(mem_arrays_[numa_node]));
-        }
+            for (uint32_t stride_index = 0; stride_index < strides.size(); stride_index++) {  //iterate different stride lengths
+                int32_t stride = strides[stride_index];
 
-        //upwards alignment to page boundary
-        uintptr_t mask;
-        if (config_.useLargePages())
-            mask = static_cast<uintptr_t>(g_large_page_size)-1;
-        else
-            mask = static_cast<uintptr_t>(g_page_size)-1; //e.g. 4095 bytes
-        uintptr_t tmp_ptr = reinterpret_cast<uintptr_t>(mem_arrays_[numa_node]);
-        uintptr_t aligned_addr = (tmp_ptr + mask) & ~mask; //add one page to the address, then truncate least significant bits of address to be page aligned.
-        mem_arrays_[numa_node] = reinterpret_cast<void*>(aligned_addr); 
+                if (stride == 0 && chunk == CHUNK_32b) //Special case: random load workers cannot use 32-bit chunks, so skip this benchmark combination
+                    continue;
+                if (!load_kernel_available(rw, chunk, stride)) { //Special case: read/write mixes and read-modify-write do not have kernels for every access pattern
+                    warn_load_kernel_unavailable(rw, chunk, stride);
+                    continue;
+                }
 
-        if (g_verbose) {
-            std::cout << " --- ALIGNED --> ";
-            std::printf("0x%.16llX", reinterpret_cast<long long unsigned int>(mem_arrays_[numa_node]));
-            std::cout << std::endl;
+                ConcurrentThroughputBenchmark* bench = buildConcurrentThroughputBenchmark(cpu_nodes, mem_nodes, rw, chunk, stride, "A (Concurrent All-Node Throughput)");
+                if (bench == NULL)
+                    return false;
+                benchmarks.push_back(bench);
+            }
         }
     }
+
+    //Run benchmarks
+    for (uint32_t i = 0; i < benchmarks.size(); i++) {
+        benchmarks[i]->run(); 
+        benchmarks[i]->reportResults(); //to console
+        writeConcurrentThroughputResults(benchmarks[i]); //to results file if necessary
+    }
+
+    if (g_verbose)
+        std::cout << std::endl << "Done running concurrent all-node throughput benchmarks." << std::endl;
+
+    return true;
 }
 
-bool BenchmarkManager::buildBenchmarks() {
+bool BenchmarkManager::runInterconnectBenchmarks() {
     if (g_verbose)  {
         std::cout << std::endl;
-        std::cout << "Generating benchmarks." << std::endl;
+        std::cout << "Generating NUMA interconnect benchmarks." << std::endl;
     }
 
-    //Put the enumerations into vectors to make constructing benchmarks more loopable
+    std::vector<rw_mode_t> rws;
     std::vector<chunk_size_t> chunks;
+    std::vector<int32_t> strides;
+    getConcurrentLoadSettings(rws, chunks, strides);
+
+    std::vector<uint32_t> cpu_node_list(cpu_numa_node_affinities_.begin(), cpu_numa_node_affinities_.end());
+    std::vector<uint32_t> mem_node_list(memory_numa_node_affinities_.begin(), memory_numa_node_affinities_.end());
+
+    for (uint32_t rw_index = 0; rw_index < rws.size(); rw_index++) { //iterate read/write access types
+        rw_mode_t rw = rws[rw_index];
+
+        for (uint32_t chunk_index = 0; chunk_index < chunks.size(); chunk_index++) { //iterate different chunk sizes
+            chunk_size_t chunk = chunks[chunk_index];
+
+            for (uint32_t stride_index = 0; stride_index < strides.size(); stride_index++) {  //iterate different stride lengths
+                int32_t stride = strides[stride_index];
+
+                if (stride == 0 && chunk == CHUNK_32b) //Special case: random load workers cannot use 32-bit chunks, so skip this benchmark combination
+                    continue;
+                if (!load_kernel_available(rw, chunk, stride)) { //Special case: read/write mixes and read-modify-write do not have kernels for every access pattern
+                    warn_load_kernel_unavailable(rw, chunk, stride);
+                    continue;
+                }
+
+                //Matrices are indexed by position in the CPU and memory node affinity lists. Negative entries were not measured.
+                std::vector<std::vector<double> > idle_matrix(cpu_node_list.size(), std::vector<double>(mem_node_list.size(), -1));
+                std::vector<std::vector<double> > bidirectional_matrix(cpu_node_list.size(), std::vector<double>(mem_node_list.size(), -1));
+                std::vector<std::vector<double> > all_to_all_matrix(cpu_node_list.size(), std::vector<double>(mem_node_list.size(), -1));
+                ConcurrentThroughputBenchmark* bench = NULL;
+
+                //Idle matrix: every CPU/memory node pair on its own
+                for (uint32_t c = 0; c < cpu_node_list.size(); c++) {
+                    for (uint32_t m = 0; m < mem_node_list.size(); m++) {
+                        std::vector<uint32_t> cpu_nodes(1, cpu_node_list[c]);
+                        std::vector<uint32_t> mem_nodes(1, mem_node_list[m]);
+                        bench = buildConcurrentThroughputBenchmark(cpu_nodes, mem_nodes, rw, chunk, stride, "X (NUMA Interconnect: Idle Pair)");
+                        if (bench == NULL)
+                            return false;
+                        bench->run();
+                        bench->reportResults();
+                        writeConcurrentThroughputResults(bench);
+                        idle_matrix[c][m] = bench->getMeanPlacementMetric(0);
+                    }
+                }
+
+                //Bidirectional matrix: each pair of nodes reads the other's memory at the same time
+                for (uint32_t c = 0; c < cpu_node_list.size(); c++) {
+                    for (uint32_t m = 0; m < mem_node_list.size(); m++) {
+                        uint32_t a = cpu_node_list[c];
+                        uint32_t b = mem_node_list[m];
+                        if (a >= b) //Each unordered pair is run once, and only if both directions are selected
+                            continue;
+                        int32_t c_rev = -1;
+                        int32_t m_rev = -1;
+                        for (uint32_t k = 0; k < cpu_node_list.size(); k++)
+                            if (cpu_node_list[k] == b)
+                                c_rev = static_cast<int32_t>(k);
+                        for (uint32_t k = 0; k < mem_node_list.size(); k++)
+                            if (mem_node_list[k] == a)
+                                m_rev = static_cast<int32_t>(k);
+                        if (c_rev < 0 || m_rev < 0)
+                            continue;
+
+                        std::vector<uint32_t> cpu_nodes;
+                        std::vector<uint32_t> mem_nodes;
+                        cpu_nodes.push_back(a);
+                        mem_nodes.push_back(b);
+                        cpu_nodes.push_back(b);
+                        mem_nodes.push_back(a);
+                        bench = buildConcurrentThroughputBenchmark(cpu_nodes, mem_nodes, rw, chunk, stride, "X (NUMA Interconnect: Bidirectional Pair)");
+                        if (bench == NULL)
+                            return false;
+                        bench->run();
+                        bench->reportResults();
+                        writeConcurrentThroughputResults(bench);
+                        bidirectional_matrix[c][m] = bench->getMeanPlacementMetric(0);
+                        bidirectional_matrix[c_rev][m_rev] = bench->getMeanPlacementMetric(1);
+                    }
+                }
+
+                //All-to-all matrix: every CPU node reads every remote memory node at the same time
+                std::vector<uint32_t> cpu_nodes;
+                std::vector<uint32_t> mem_nodes;
+                std::vector<uint32_t> cpu_indices;
+                std::vector<uint32_t> mem_indices;
+                for (uint32_t c = 0; c < cpu_node_list.size(); c++) {
+                    for (uint32_t m = 0; m < mem_node_list.size(); m++) {
+                        if (cpu_node_list[c] == mem_node_list[m])
+                            continue;
+                        cpu_nodes.push_back(cpu_node_list[c]);
+                        mem_nodes.push_back(mem_node_list[m]);
+                        cpu_indices.push_back(c);
+                        mem_indices.push_back(m);
+                    }
+                }
+                if (cpu_nodes.size() > 0) {
+                    bench = buildConcurrentThroughputBenchmark(cpu_nodes, mem_nodes, rw, chunk, stride, "X (NUMA Interconnect: All-to-All)");
+                    if (bench == NULL)
+                        return false;
+                    bench->run();
+                    bench->reportResults();
+                    writeConcurrentThroughputResults(bench);
+                    for (uint32_t p = 0; p < bench->getNumPlacements(); p++)
+                        all_to_all_matrix[cpu_indices[p]][mem_indices[p]] = bench->getMeanPlacementMetric(p);
+                }
+
+                //Report the matrices side by side for this load setting
+                std::cout << std::endl;
+                std::cout << "*** NUMA INTERCONNECT MATRIX: ";
+                reportLoadSettings(bench);
+                std::cout << ", " << config_.getNumWorkerThreads() << " worker threads per pair ***" << std::endl;
+                reportNUMAMatrix("Idle (each pair alone)", cpu_node_list, mem_node_list, idle_matrix, bench->getMetricUnits());
+                reportNUMAMatrix("Loaded (bidirectional pairs)", cpu_node_list, mem_node_list, bidirectional_matrix, bench->getMetricUnits());
+                reportNUMAMatrix("Loaded (all-to-all remote)", cpu_node_list, mem_node_list, all_to_all_matrix, bench->getMetricUnits());
+                std::cout << std::endl;
+            }
+        }
+    }
+
+    if (g_verbose)
+        std::cout << std::endl << "Done running NUMA interconnect benchmarks." << std::endl;
+
+    return true;
+}
+
+void BenchmarkManager::getConcurrentLoadSettings(std::vector<rw_mode_t>& rws, std::vector<chunk_size_t>& chunks, std::vector<int32_t>& strides) const {
+    //Put the enumerations into vectors to make constructing benchmarks more loopable
+    if (config_.useReads())
+        rws.push_back(READ);
+    if (config_.useWrites())
+        rws.push_back(WRITE);
+    if (config_.useReadModifyWrite())
+        rws.push_back(READ_MODIFY_WRITE);
+    std::list<rw_mode_t> rw_mixes = config_.getReadWriteMixes();
+    rws.insert(rws.end(), rw_mixes.begin(), rw_mixes.end());
+
     if (config_.useChunk32b())
         chunks.push_back(CHUNK_32b); 
 #ifdef HAS_WORD_64
@@ -537,236 +923,2699 @@ bool BenchmarkManager::buildBenchmarks() {
         chunks.push_back(CHUNK_512b); 
 #endif
 
-    std::vector<rw_mode_t> rws;
-    if (config_.useReads())
-        rws.push_back(READ);
-    if (config_.useWrites())
-        rws.push_back(WRITE);
-    
-    std::vector<int32_t> strides;
-    if (config_.useStrideP1())
-        strides.push_back(1);
-    if (config_.useStrideN1())
-        strides.push_back(-1);
-    if (config_.useStrideP2())
-        strides.push_back(2);
-    if (config_.useStrideN2())
-        strides.push_back(-2);
-    if (config_.useStrideP4())
-        strides.push_back(4);
-    if (config_.useStrideN4())
-        strides.push_back(-4);
-    if (config_.useStrideP8())
-        strides.push_back(8);
-    if (config_.useStrideN8())
-        strides.push_back(-8);
-    if (config_.useStrideP16())
-        strides.push_back(16);
-    if (config_.useStrideN16())
-        strides.push_back(-16);
+    if (config_.useSequentialAccessPattern()) {
+        if (config_.useStrideP1())
+            strides.push_back(1);
+        if (config_.useStrideN1())
+            strides.push_back(-1);
+        if (config_.useStrideP2())
+            strides.push_back(2);
+        if (config_.useStrideN2())
+            strides.push_back(-2);
+        if (config_.useStrideP4())
+            strides.push_back(4);
+        if (config_.useStrideN4())
+            strides.push_back(-4);
+        if (config_.useStrideP8())
+            strides.push_back(8);
+        if (config_.useStrideN8())
+            strides.push_back(-8);
+        if (config_.useStrideP16())
+            strides.push_back(16);
+        if (config_.useStrideN16())
+            strides.push_back(-16);
+    }
+    if (config_.useRandomAccessPattern())
+        strides.push_back(0); //Stride of 0 stands for the random access pattern here
+}
 
-    if (g_verbose)
-        std::cout << std::endl;
+ConcurrentThroughputBenchmark* BenchmarkManager::buildConcurrentThroughputBenchmark(const std::vector<uint32_t>& cpu_nodes, const std::vector<uint32_t>& mem_nodes, rw_mode_t rw, chunk_size_t chunk, int32_t stride, std::string label) {
+    //Give each placement its own memory region. Placements that share a memory node get disjoint sub-ranges of that node's allocation.
+    size_t len = config_.getNumWorkerThreads() * config_.getWorkingSetSizePerThread();
+    std::vector<void*> mem_arrays;
+    for (uint32_t p = 0; p < mem_nodes.size(); p++) {
+        uint32_t region = 0;
+        for (uint32_t q = 0; q < p; q++) {
+            if (mem_nodes[q] == mem_nodes[p])
+                region++;
+        }
+        mem_arrays.push_back(reinterpret_cast<void*>(reinterpret_cast<uint8_t*>(mem_arrays_[mem_nodes[p]]) + region * len));
+    }
 
-    std::string benchmark_name;
+    std::string benchmark_name = static_cast<std::ostringstream*>(&(std::ostringstream() << "Test #" << g_test_index++ << label))->str();
+    ConcurrentThroughputBenchmark* bench = new ConcurrentThroughputBenchmark(mem_arrays,
+                                                                             len,
+                                                                             config_.getIterationsPerTest(),
+                                                                             config_.getNumWorkerThreads(),
+                                                                             cpu_nodes,
+                                                                             mem_nodes,
+                                                                             (stride == 0) ? RANDOM : SEQUENTIAL,
+                                                                             rw,
+                                                                             chunk,
+                                                                             stride,
+                                                                             dram_power_readers_,
+                                                                             benchmark_name);
+    if (bench == NULL) {
+        std::cerr << "ERROR: Failed to build a ConcurrentThroughputBenchmark!" << std::endl;
+        return NULL;
+    }
+
+    conc_tp_benchmarks_.push_back(bench); //Freed by the destructor
+    return bench;
+}
+
+void BenchmarkManager::writeConcurrentThroughputResults(const ConcurrentThroughputBenchmark* bench) {
+    if (!config_.useOutputFile())
+        return;
+
+    //The first row is the system-wide aggregate, followed by one row per placement with its mean throughput during the same run.
+    for (int32_t p = -1; p < static_cast<int32_t>(bench->getNumPlacements()); p++) {
+        bool system_row = (p < 0);
+        results_file_ << bench->getName() << ",";
+        results_file_ << bench->getIterations() << ",";
+        results_file_ << static_cast<size_t>(bench->getLen() / bench->getNumThreads() / KB) << ",";
+        if (system_row) {
+            results_file_ << bench->getTotalNumThreads() << ",";
+            results_file_ << bench->getTotalNumThreads() << ",";
+            for (uint32_t q = 0; q < bench->getNumPlacements(); q++)
+                results_file_ << (q > 0 ? "+" : "") << bench->getPlacementMemNode(q);
+            results_file_ << ",";
+            for (uint32_t q = 0; q < bench->getNumPlacements(); q++)
+                results_file_ << (q > 0 ? "+" : "") << bench->getPlacementCPUNode(q);
+            results_file_ << ",";
+        } else {
+            results_file_ << bench->getNumThreads() << ",";
+            results_file_ << bench->getNumThreads() << ",";
+            results_file_ << bench->getPlacementMemNode(p) << ",";
+            results_file_ << bench->getPlacementCPUNode(p) << ",";
+        }
+
+        pattern_mode_t pattern = bench->getPatternMode();
+        switch (pattern) {
+            case SEQUENTIAL:
+                results_file_ << "SEQUENTIAL" << ",";
+                break;
+            case RANDOM:
+                results_file_ << "RANDOM" << ",";
+                break;
+            default:
+                results_file_ << "UNKNOWN" << ",";
+                break;
+        }
+
+        rw_mode_t rw_mode = bench->getRWMode();
+        switch (rw_mode) {
+            case READ:
+                results_file_ << "READ" << ",";
+                break;
+            case WRITE:
+                results_file_ << "WRITE" << ",";
+                break;
+            case READ_WRITE_1_1:
+                results_file_ << "READ_WRITE_1_1" << ",";
+                break;
+            case READ_WRITE_2_1:
+                results_file_ << "READ_WRITE_2_1" << ",";
+                break;
+            case READ_WRITE_3_1:
+                results_file_ << "READ_WRITE_3_1" << ",";
+                break;
+            case READ_MODIFY_WRITE:
+                results_file_ << "READ_MODIFY_WRITE" << ",";
+                break;
+            default:
+                results_file_ << "UNKNOWN" << ",";
+                break;
+        }
+
+        chunk_size_t chunk_size = bench->getChunkSize();
+        switch (chunk_size) {
+            case CHUNK_32b:
+                results_file_ << "32" << ",";
+                break;
+#ifdef HAS_WORD_64
+            case CHUNK_64b:
+                results_file_ << "64" << ",";
+                break;
+#endif
+#ifdef HAS_WORD_128
+            case CHUNK_128b:
+                results_file_ << "128" << ",";
+                break;
+#endif
+#ifdef HAS_WORD_256
+            case CHUNK_256b:
+                results_file_ << "256" << ",";
+                break;
+#endif
+#ifdef HAS_WORD_512
+            case CHUNK_512b:
+                results_file_ << "512" << ",";
+                break;
+#endif
+            default:
+                results_file_ << "UNKNOWN" << ",";
+                break;
+        }
+
+        results_file_ << bench->getStrideSize() << ",";
+        if (system_row) {
+            results_file_ << bench->getMeanMetric() << ",";
+            results_file_ << bench->getMinMetric() << ",";
+            results_file_ << bench->get25PercentileMetric() << ",";
+            results_file_ << bench->getMedianMetric() << ",";
+            results_file_ << bench->get75PercentileMetric() << ",";
+            results_file_ << bench->get95PercentileMetric() << ",";
+            results_file_ << bench->get99PercentileMetric() << ",";
+            results_file_ << bench->getMaxMetric() << ",";
+            results_file_ << bench->getModeMetric() << ",";
+        } else {
+            results_file_ << bench->getMeanPlacementMetric(p) << ",";
+            for (uint32_t j = 0; j < 8; j++)
+                results_file_ << "N/A" << ",";
+        }
+        results_file_ << bench->getMetricUnits() << ",";
+        for (uint32_t j = 0; j < 10; j++)
+            results_file_ << "N/A" << ",";
+        for (uint32_t j = 0; j < g_num_physical_packages; j++) {
+            results_file_ << bench->getMeanDRAMPower(j) << ",";
+            results_file_ << bench->getPeakDRAMPower(j) << ",";
+        }
+        results_file_ << "N/A" << ",";
+        if (system_row)
+            results_file_ << "system-wide aggregate of " << bench->getNumPlacements() << " concurrent placements" << ",";
+        else
+            results_file_ << "placement " << p+1 << " of " << bench->getNumPlacements() << " in the same concurrent run" << ",";
+        results_file_ << std::endl;
+    }
+}
+
+void BenchmarkManager::reportNUMAMatrix(std::string label, const std::vector<uint32_t>& cpu_nodes, const std::vector<uint32_t>& mem_nodes, const std::vector<std::vector<double> >& matrix, std::string metric_units) const {
+    std::cout << std::endl;
+    std::cout << label << ", " << metric_units << " (rows: CPU NUMA node, columns: memory NUMA node):" << std::endl;
+    std::printf("%10s", "");
+    for (uint32_t m = 0; m < mem_nodes.size(); m++) {
+        char column_name[16];
+        std::snprintf(column_name, sizeof(column_name), "Mem %u", mem_nodes[m]);
+        std::printf("    %10s", column_name);
+    }
+    std::printf("\n");
+    for (uint32_t c = 0; c < cpu_nodes.size(); c++) {
+        std::printf("    CPU %-2u", cpu_nodes[c]);
+        for (uint32_t m = 0; m < mem_nodes.size(); m++) {
+            if (matrix[c][m] < 0) //not measured
+                std::printf("    %10s", "-");
+            else
+                std::printf("    %10.1f", matrix[c][m]);
+        }
+        std::printf("\n");
+    }
+}
+
+void BenchmarkManager::reportCPUMatrix(std::string label, const std::vector<uint32_t>& cpus, const std::vector<std::vector<double> >& matrix, std::string metric_units) const {
+    std::cout << std::endl;
+    std::cout << label << ", " << metric_units << " (rows and columns: logical CPU):" << std::endl;
+    std::printf("%8s", "");
+    for (uint32_t j = 0; j < cpus.size(); j++)
+        std::printf(" %7u", cpus[j]);
+    std::printf("\n");
+    for (uint32_t i = 0; i < cpus.size(); i++) {
+        std::printf("    %-4u", cpus[i]);
+        for (uint32_t j = 0; j < cpus.size(); j++) {
+            if (matrix[i][j] < 0) //not measured
+                std::printf(" %7s", "-");
+            else
+                std::printf(" %7.1f", matrix[i][j]);
+        }
+        std::printf("\n");
+    }
+}
+
+void BenchmarkManager::reportCPURelationSummary(const std::vector<std::vector<double> >& pair_metrics, std::string metric_units) const {
+    std::cout << std::endl;
+    std::cout << "By CPU topology, " << metric_units << ":" << std::endl;
+    std::printf("    %-26s %7s %10s %10s %10s\n", "Relation", "Pairs", "Min", "Mean", "Max");
+    for (uint32_t r = 0; r < pair_metrics.size(); r++) {
+        if (pair_metrics[r].empty())
+            continue;
+        double min = pair_metrics[r][0];
+        double max = pair_metrics[r][0];
+        double mean = 0;
+        for (uint32_t k = 0; k < pair_metrics[r].size(); k++) {
+            if (pair_metrics[r][k] < min)
+                min = pair_metrics[r][k];
+            if (pair_metrics[r][k] > max)
+                max = pair_metrics[r][k];
+            mean += pair_metrics[r][k];
+        }
+        mean /= pair_metrics[r].size();
+        std::printf("    %-26s %7u %10.1f %10.1f %10.1f\n", cpu_relation_name(static_cast<cpu_relation_t>(r)).c_str(), static_cast<uint32_t>(pair_metrics[r].size()), min, mean, max);
+    }
+}
+
+void BenchmarkManager::getCoreToCoreCPUs(std::vector<uint32_t>& cpus, std::vector<uint32_t>& cpu_nodes) const {
+    cpus.clear();
+    cpu_nodes.clear();
+    uint32_t step = config_.getCoreToCoreCPUStep();
+    for (auto it = cpu_numa_node_affinities_.cbegin(); it != cpu_numa_node_affinities_.cend(); it++) {
+        for (uint32_t c = 0; c < g_num_logical_cpus; c += step) {
+            int32_t cpu = cpu_id_in_numa_node(*it, c);
+            if (cpu < 0) //no more CPUs in this node
+                break;
+            cpus.push_back(static_cast<uint32_t>(cpu));
+            cpu_nodes.push_back(*it);
+        }
+    }
+}
+
+void BenchmarkManager::getCoreToCoreCPUsByDistance(std::vector<uint32_t>& cpus, std::vector<uint32_t>& cpu_nodes, std::vector<int32_t>& relations) const {
+    std::vector<uint32_t> all_cpus;
+    std::vector<uint32_t> all_cpu_nodes;
+    getCoreToCoreCPUs(all_cpus, all_cpu_nodes);
+    cpus.clear();
+    cpu_nodes.clear();
+    relations.clear();
+    if (all_cpus.empty())
+        return;
+
+    std::vector<std::pair<uint32_t, uint32_t> > ranked_cpus; //(relation to the first CPU, position in the CPU list)
+    for (uint32_t i = 1; i < all_cpus.size(); i++)
+        ranked_cpus.push_back(std::pair<uint32_t, uint32_t>(get_cpu_relation(all_cpus[0], all_cpus[i]), i));
+    std::stable_sort(ranked_cpus.begin(), ranked_cpus.end());
+    cpus.push_back(all_cpus[0]);
+    cpu_nodes.push_back(all_cpu_nodes[0]);
+    relations.push_back(-1);
+    for (uint32_t i = 0; i < ranked_cpus.size(); i++) {
+        cpus.push_back(all_cpus[ranked_cpus[i].second]);
+        cpu_nodes.push_back(all_cpu_nodes[ranked_cpus[i].second]);
+        relations.push_back(static_cast<int32_t>(ranked_cpus[i].first));
+    }
+}
+
+void BenchmarkManager::getCoreToCoreCPUPairs(std::vector<std::pair<uint32_t, uint32_t> >& pairs) const {
+    pairs.clear();
+    std::list<std::pair<uint32_t, uint32_t> > given_pairs = config_.getCoreToCorePairs();
+    if (!given_pairs.empty()) {
+        pairs.assign(given_pairs.begin(), given_pairs.end());
+        return;
+    }
+
+    std::vector<uint32_t> cpus;
+    std::vector<uint32_t> cpu_nodes;
+    getCoreToCoreCPUs(cpus, cpu_nodes);
+    std::vector<bool> relation_found(NUM_CPU_RELATIONS, false);
+    for (uint32_t j = 1; j < cpus.size(); j++) {
+        cpu_relation_t relation = get_cpu_relation(cpus[0], cpus[j]);
+        if (!relation_found[relation]) {
+            relation_found[relation] = true;
+            pairs.push_back(std::pair<uint32_t, uint32_t>(cpus[0], cpus[j]));
+        }
+    }
+}
+
+uint32_t BenchmarkManager::getCPUNumaNode(uint32_t cpu) const {
+    for (uint32_t node = 0; node < g_num_numa_nodes; node++) {
+        for (uint32_t c = 0; c < g_num_logical_cpus; c++) {
+            int32_t cpu_id = cpu_id_in_numa_node(node, c);
+            if (cpu_id < 0) //no more CPUs in this node
+                break;
+            if (static_cast<uint32_t>(cpu_id) == cpu)
+                return node;
+        }
+    }
+    return 0;
+}
+
+void BenchmarkManager::writeWorkerResults(std::string name, size_t working_set_size, uint32_t num_threads, uint32_t mem_node, std::string cpu_nodes, const std::vector<double>& throughput_on_iter, std::string throughput_units, const std::vector<double>& latency_on_iter, std::string latency_units, std::string notes) {
+    writeWorkerResults(name, working_set_size, num_threads, mem_node, cpu_nodes, throughput_on_iter, throughput_units, latency_on_iter, latency_units, std::vector<double>(), std::vector<double>(), notes);
+}
+
+void BenchmarkManager::writeWorkerResults(std::string name, size_t working_set_size, uint32_t num_threads, uint32_t mem_node, std::string cpu_nodes, const std::vector<double>& throughput_on_iter, std::string throughput_units, const std::vector<double>& latency_on_iter, std::string latency_units, const std::vector<double>& mean_power, const std::vector<double>& peak_power, std::string notes) {
+    if (!config_.useOutputFile())
+        return;
+
+    results_file_ << name << ",";
+    results_file_ << std::max(throughput_on_iter.size(), latency_on_iter.size()) << ",";
+    if (working_set_size > 0)
+        results_file_ << working_set_size / KB << ",";
+    else
+        results_file_ << "N/A" << ",";
+    results_file_ << num_threads << ",";
+    results_file_ << 0 << ",";
+    results_file_ << mem_node << ",";
+    results_file_ << cpu_nodes << ",";
+    for (uint32_t j = 0; j < 4; j++) //No load access pattern, read/write mix, chunk size, or stride
+        results_file_ << "N/A" << ",";
+    write_metric_statistics(results_file_, throughput_on_iter);
+    results_file_ << (throughput_on_iter.empty() ? "N/A" : throughput_units) << ",";
+    write_metric_statistics(results_file_, latency_on_iter);
+    results_file_ << (latency_on_iter.empty() ? "N/A" : latency_units) << ",";
+    for (uint32_t j = 0; j < g_num_physical_packages; j++) {
+        if (j < mean_power.size() && mean_power[j] >= 0)
+            results_file_ << mean_power[j] << ",";
+        else
+            results_file_ << "N/A" << ",";
+        if (j < peak_power.size() && peak_power[j] >= 0)
+            results_file_ << peak_power[j] << ",";
+        else
+            results_file_ << "N/A" << ",";
+    }
+    results_file_ << "N/A" << ",";
+    results_file_ << notes << ",";
+    results_file_ << std::endl;
+}
+
+bool BenchmarkManager::startDRAMPowerThreads(std::vector<Thread*>& power_threads) {
+    bool success = true;
+
+    for (uint32_t i = 0; i < dram_power_readers_.size(); i++) {
+        Thread* power_thread = NULL;
+        if (dram_power_readers_[i] != NULL) {
+            dram_power_readers_[i]->clearAndReset(); //clear the state of the reader
+            power_thread = new Thread(dram_power_readers_[i]);
+            if (!power_thread->create_and_start()) {
+                std::cerr << "WARNING: Failed to create and start a DRAM power measurement thread." << std::endl;
+                success = false;
+            }
+        }
+        power_threads.push_back(power_thread);
+    }
+
+    return success;
+}
+
+bool BenchmarkManager::stopDRAMPowerThreads(std::vector<Thread*>& power_threads, std::vector<double>& mean_power, std::vector<double>& peak_power) {
+    bool success = true;
+
+    //Indicate end to the power threads politely
+    for (uint32_t i = 0; i < power_threads.size(); i++) {
+        if (power_threads[i] != NULL && power_threads[i]->started() && !dram_power_readers_[i]->stop()) {
+            std::cerr << "WARNING: Failed to indicate end of power measurement to a power measurement object. The corresponding worker thread might not terminate." << std::endl;
+            success = false;
+        }
+    }
+
+    //Wait for them and collect power data
+    mean_power.clear();
+    peak_power.clear();
+    for (uint32_t i = 0; i < power_threads.size(); i++) {
+        if (power_threads[i] == NULL) {
+            mean_power.push_back(-1);
+            peak_power.push_back(-1);
+            continue;
+        }
+        if (!power_threads[i]->join()) {
+            std::cerr << "WARNING: A power measurement thread failed to join! Forcing the thread to stop." << std::endl;
+            if (!power_threads[i]->cancel())
+                std::cerr << "WARNING: Failed to force stop a power measurement thread. Its behavior may be unpredictable." << std::endl;
+            success = false;
+        }
+        mean_power.push_back(dram_power_readers_[i]->getMeanPower() * dram_power_readers_[i]->getPowerUnits());
+        peak_power.push_back(dram_power_readers_[i]->getPeakPower() * dram_power_readers_[i]->getPowerUnits());
+        delete power_threads[i];
+    }
+    power_threads.clear();
+
+    return success;
+}
+
+bool BenchmarkManager::runWorkerPlacements(std::string mode_name, std::function<bool(uint32_t mem_node, uint8_t* mem_array, uint32_t cpu_node, const std::vector<int32_t>& cpus, size_t working_set_size)> run_placement) {
+    //Working set sizes per thread and numbers of worker threads, including their sweeps
+    std::vector<size_t> working_set_sizes;
+    if (config_.useWorkingSetSizeSweep()) {
+        std::list<size_t> sweep = config_.getWorkingSetSizeSweep();
+        working_set_sizes.assign(sweep.begin(), sweep.end());
+    } else
+        working_set_sizes.push_back(config_.getWorkingSetSizePerThread());
+
+    std::vector<uint32_t> num_threads_list;
+    if (config_.useNumWorkerThreadsSweep()) {
+        std::list<uint32_t> sweep = config_.getNumWorkerThreadsSweep();
+        num_threads_list.assign(sweep.begin(), sweep.end());
+    } else
+        num_threads_list.push_back(config_.getNumWorkerThreads());
 
-    //Build throughput benchmarks. This is a humongous nest of for loops, but rest assured, the range of each loop should be small enough. The problem is we have many combinations to test.
+    for (auto mem_node_it = memory_numa_node_affinities_.cbegin(); mem_node_it != memory_numa_node_affinities_.cend(); mem_node_it++) { //iterate each memory NUMA node
+        uint32_t mem_node = *mem_node_it;
+        uint8_t* mem_array = reinterpret_cast<uint8_t*>(mem_arrays_[mem_node]);
+
+        for (auto cpu_node_it = cpu_numa_node_affinities_.cbegin(); cpu_node_it != cpu_numa_node_affinities_.cend(); cpu_node_it++) { //iterate each CPU NUMA node
+            uint32_t cpu_node = *cpu_node_it;
+
+            for (uint32_t threads_index = 0; threads_index < num_threads_list.size(); threads_index++) { //iterate different numbers of worker threads
+                uint32_t num_threads = num_threads_list[threads_index];
+                std::vector<int32_t> cpus;
+                for (uint32_t t = 0; t < num_threads; t++) {
+                    int32_t cpu = cpu_id_in_numa_node(cpu_node, t);
+                    if (cpu < 0) {
+                        std::cerr << "ERROR: The " << mode_name << " benchmark was asked for " << num_threads << " threads, but CPU NUMA node " << cpu_node << " does not have that many logical CPUs." << std::endl;
+                        return false;
+                    }
+                    cpus.push_back(cpu);
+                }
+
+                for (uint32_t ws_index = 0; ws_index < working_set_sizes.size(); ws_index++) { //iterate different working set sizes
+                    if (!run_placement(mem_node, mem_array, cpu_node, cpus, working_set_sizes[ws_index]))
+                        return false;
+                }
+            }
+        }
+    }
+
+    return true;
+}
+
+bool BenchmarkManager::runWorkers(std::string mode_name, const std::vector<int32_t>& cpus, std::function<MemoryWorker*(uint32_t thread, std::atomic<uint32_t>* arrived)> create_worker, std::function<std::vector<double>(MemoryWorker* worker)> get_metrics, uint32_t num_rates, std::vector<std::vector<double> >& metrics_on_iter, bool& warning, std::vector<double>* mean_power, std::vector<double>* peak_power) {
+    uint32_t num_threads = static_cast<uint32_t>(cpus.size());
+    uint32_t iterations = config_.getIterationsPerTest();
+    metrics_on_iter.clear();
+    bool success = true;
+
+    std::vector<Thread*> power_threads;
+    if (mean_power != NULL)
+        startDRAMPowerThreads(power_threads);
+
+    for (uint32_t iter = 0; iter < iterations && success; iter++) {
+        std::atomic<uint32_t> arrived(0);
+        std::vector<MemoryWorker*> workers;
+        std::vector<Thread*> worker_threads;
+        for (uint32_t t = 0; t < num_threads; t++) {
+            workers.push_back(create_worker(t, &arrived));
+            worker_threads.push_back(new Thread(workers[t]));
+        }
+
+        for (uint32_t t = 0; t < num_threads; t++) {
+            if (!worker_threads[t]->create_and_start()) {
+                std::cerr << "ERROR: Failed to start the " << mode_name << " worker threads." << std::endl;
+                arrived.fetch_add(1); //Stand in for the worker that did not start, so that the others do not wait for it forever
+                success = false;
+            }
+        }
+        for (uint32_t t = 0; t < num_threads; t++) {
+            if (!worker_threads[t]->join())
+                std::cerr << "WARNING: A worker thread failed to complete correctly!" << std::endl;
+        }
+
+        //Each thread ran for about the same time, so their rates add up. Other metrics are averaged.
+        std::vector<double> metrics;
+        for (uint32_t t = 0; t < num_threads; t++) {
+            std::vector<double> thread_metrics = get_metrics(workers[t]);
+            metrics.resize(thread_metrics.size(), 0);
+            for (uint32_t m = 0; m < thread_metrics.size(); m++)
+                metrics[m] += (m < num_rates) ? thread_metrics[m] : thread_metrics[m] / num_threads;
+            if (workers[t]->hadWarning())
+                warning = true;
+            delete worker_threads[t];
+            delete workers[t];
+        }
+        metrics_on_iter.resize(metrics.size());
+        for (uint32_t m = 0; m < metrics.size(); m++)
+            metrics_on_iter[m].push_back(metrics[m]);
+    }
+
+    if (mean_power != NULL)
+        stopDRAMPowerThreads(power_threads, *mean_power, *peak_power);
+
+    return success;
+}
+
+void BenchmarkManager::reportWorkingSetSizeSweep(const std::vector<Benchmark*>& benchmarks, std::string label) const {
+    std::cout << std::endl;
+    std::cout << "*** WORKING SET SIZE SWEEP: " << label << " ***" << std::endl;
+
+    std::vector<size_t> curve_working_set_sizes;
+    std::vector<double> curve_metrics;
+
+    //Benchmarks in a sweep are built with the working set size as the innermost loop, so each curve is a contiguous run of benchmarks that differ only in length.
+    for (uint32_t i = 0; i < benchmarks.size(); i++) {
+        Benchmark* curr = benchmarks[i];
+        Benchmark* prev = (i > 0) ? benchmarks[i-1] : NULL;
+        bool new_curve = (prev == NULL
+                          || prev->getMemNode() != curr->getMemNode()
+                          || prev->getCPUNode() != curr->getCPUNode()
+                          || prev->getPatternMode() != curr->getPatternMode()
+                          || prev->getRWMode() != curr->getRWMode()
+                          || prev->getChunkSize() != curr->getChunkSize()
+                          || prev->getStrideSize() != curr->getStrideSize()
+                          || prev->getNumThreads() != curr->getNumThreads()
+                          || prev->getLen() >= curr->getLen());
+
+        if (new_curve) {
+            if (prev != NULL)
+                reportMemoryLevels(curve_working_set_sizes, curve_metrics, prev->getMetricUnits());
+            curve_working_set_sizes.clear();
+            curve_metrics.clear();
+
+            std::cout << std::endl;
+            reportSweepCurveHeader(curr, label != "Latency" || curr->getNumThreads() > 1); //Unloaded latency has no load traffic settings
+            if (config_.useNumWorkerThreadsSweep())
+                std::cout << ", " << curr->getNumThreads() << " worker threads";
+            std::cout << ":" << std::endl;
+            std::cout << "    Working Set Per Thread (KB)    Mean (" << curr->getMetricUnits() << ")" << std::endl;
+        }
+
+        std::printf("    %27lu    %0.3f\n", static_cast<unsigned long>(curr->getLen() / curr->getNumThreads() / KB), curr->getMeanMetric());
+        curve_working_set_sizes.push_back(curr->getLen() / curr->getNumThreads());
+        curve_metrics.push_back(curr->getMedianMetric());
+    }
+
+    if (!benchmarks.empty())
+        reportMemoryLevels(curve_working_set_sizes, curve_metrics, benchmarks.back()->getMetricUnits());
+    std::cout << std::endl;
+}
+
+void BenchmarkManager::reportNumWorkerThreadsSweep(const std::vector<ThroughputBenchmark*>& benchmarks) const {
+    std::cout << std::endl;
+    std::cout << "*** WORKER THREAD COUNT SWEEP: Throughput Scaling ***" << std::endl;
+
+    uint32_t baseline_threads = config_.getNumWorkerThreadsSweep().front();
+
+    //Each benchmark run with the smallest thread count anchors one scaling curve. Every other benchmark with identical settings and per-thread working set size belongs to that curve.
+    for (uint32_t i = 0; i < benchmarks.size(); i++) {
+        ThroughputBenchmark* baseline = benchmarks[i];
+        if (baseline->getNumThreads() != baseline_threads)
+            continue;
+
+        size_t working_set_size = baseline->getLen() / baseline->getNumThreads();
+        double baseline_per_thread = baseline->getMeanMetric() / baseline->getNumThreads();
+
+        std::cout << std::endl;
+        reportSweepCurveHeader(baseline, true);
+        std::cout << ", " << working_set_size / KB << " KB per thread:" << std::endl;
+        std::cout << "    Threads    Aggregate (" << baseline->getMetricUnits() << ")    Per Thread (" << baseline->getMetricUnits() << ")    Parallel Efficiency (%)" << std::endl;
+
+        for (uint32_t j = 0; j < benchmarks.size(); j++) {
+            ThroughputBenchmark* curr = benchmarks[j];
+            if (curr->getMemNode() != baseline->getMemNode()
+                || curr->getCPUNode() != baseline->getCPUNode()
+                || curr->getPatternMode() != baseline->getPatternMode()
+                || curr->getRWMode() != baseline->getRWMode()
+                || curr->getChunkSize() != baseline->getChunkSize()
+                || curr->getStrideSize() != baseline->getStrideSize()
+                || curr->getLen() / curr->getNumThreads() != working_set_size)
+                continue;
+
+            double per_thread = curr->getMeanMetric() / curr->getNumThreads();
+            double efficiency = (baseline_per_thread > 0) ? 100 * per_thread / baseline_per_thread : 0;
+            std::printf("    %7u    %16.3f    %15.3f    %23.1f\n", curr->getNumThreads(), curr->getMeanMetric(), per_thread, efficiency);
+        }
+    }
+    std::cout << std::endl;
+}
+
+void BenchmarkManager::reportSweepCurveHeader(const Benchmark* benchmark, bool include_load_settings) const {
+    std::cout << "CPU NUMA Node " << benchmark->getCPUNode() << " -> Memory NUMA Node " << benchmark->getMemNode();
+    if (include_load_settings) {
+        std::cout << ", ";
+        reportLoadSettings(benchmark);
+    }
+}
+
+void BenchmarkManager::reportLoadSettings(const Benchmark* benchmark) const {
+    std::cout << (benchmark->getPatternMode() == SEQUENTIAL ? "sequential" : "random");
+    std::cout << " " << rw_mode_name(benchmark->getRWMode());
+    switch (benchmark->getChunkSize()) {
+        case CHUNK_32b:
+            std::cout << ", 32-bit chunks";
+            break;
+#ifdef HAS_WORD_64
+        case CHUNK_64b:
+            std::cout << ", 64-bit chunks";
+            break;
+#endif
+#ifdef HAS_WORD_128
+        case CHUNK_128b:
+            std::cout << ", 128-bit chunks";
+            break;
+#endif
+#ifdef HAS_WORD_256
+        case CHUNK_256b:
+            std::cout << ", 256-bit chunks";
+            break;
+#endif
+#ifdef HAS_WORD_512
+        case CHUNK_512b:
+            std::cout << ", 512-bit chunks";
+            break;
+#endif
+        default:
+            std::cout << ", UNKNOWN chunks";
+            break;
+    }
+    if (benchmark->getPatternMode() == SEQUENTIAL)
+        std::cout << ", stride " << benchmark->getStrideSize();
+}
+
+void BenchmarkManager::reportMemoryLevels(const std::vector<size_t>& working_set_sizes, const std::vector<double>& metrics, std::string metric_units) const {
+    std::vector<memory_level_t> levels;
+    bool metric_is_rate = (metric_units == "MB/s");
+    if (!detect_memory_levels(working_set_sizes, metrics, metric_is_rate, levels) || levels.empty()) {
+        std::cout << "    (Not enough distinct sweep points to locate memory hierarchy levels.)" << std::endl;
+        return;
+    }
+
+    std::cout << "    Detected memory hierarchy levels:" << std::endl;
+    for (uint32_t l = 0; l < levels.size(); l++) {
+        std::cout << "    ---> Level " << l+1 << ": plateau of " << levels[l].plateau_metric << " " << metric_units;
+        std::cout << " for " << levels[l].first_working_set_size / KB << " KB to " << levels[l].last_working_set_size / KB << " KB per thread";
+        if (levels[l].effective_capacity > 0)
+            std::cout << ", effective capacity ~" << levels[l].effective_capacity / KB << " KB per thread";
+        else if (levels.size() > 1)
+            std::cout << ", no capacity limit observed (likely main memory)";
+        std::cout << std::endl;
+    }
+}
+
+void BenchmarkManager::setupWorkingSets(size_t working_set_size) {
+    //Allocate memory in each NUMA node to be tested
+
+    //We reserve the space for these, but that doesn't mean they will all be used.
+    mem_arrays_.resize(g_num_numa_nodes); 
+    mem_array_lens_.resize(g_num_numa_nodes);
+
+    //Each worker thread needs its own region. In the concurrent all-node throughput mode, several placements may share one memory node, and each needs its own set of regions.
+    size_t num_thread_regions = config_.getMaxNumWorkerThreads() * config_.getMaxPlacementsPerMemoryNode();
+
+    for (auto it = memory_numa_node_affinities_.cbegin(); it != memory_numa_node_affinities_.cend(); it++) {
+        size_t allocation_size = 0;
+        uint32_t numa_node = *it;
+
+#ifdef HAS_LARGE_PAGES
+        if (config_.useLargePages()) {
+            size_t remainder = 0;
+            //For large pages, working set size could be less than a single large page. So let's allocate the right amount of memory, which is the working set size rounded up to nearest large page, which could be more than we actually use.
+            if (num_thread_regions * working_set_size < g_large_page_size)
+                allocation_size = g_large_page_size;
+            else { 
+                remainder = (num_thread_regions * working_set_size) % g_large_page_size;
+                allocation_size = (num_thread_regions * working_set_size) + remainder;
+            }
+            
+#ifdef _WIN32
+            //Make sure we have necessary privileges
+            HANDLE hToken;
+            if (!OpenProcessToken(GetCurrentProcess(), TOKEN_ADJUST_PRIVILEGES | TOKEN_QUERY, &hToken)) {
+                std::cerr << "ERROR: Failed to open process token to adjust privileges! Did you remember to run in Administrator mode?" << std::endl;
+                exit(-1);
+            }
+            if (!SetPrivilege(hToken,"SeLockMemoryPrivilege", true)) {
+                std::cerr << "ERROR: Failed to adjust privileges to allow locking memory pages! Did you remember to run in Administrator mode?" << std::endl;
+                exit(-1);
+            }
+            CloseHandle(hToken);
+            
+            mem_arrays_[numa_node] = VirtualAllocExNuma(GetCurrentProcess(), NULL, allocation_size, MEM_COMMIT | MEM_RESERVE | MEM_LARGE_PAGES, PAGE_READWRITE, numa_node); //Windows NUMA allocation. Make the allocation one page bigger than necessary so that we can do alignment.
+#endif
+#ifdef __gnu_linux__
+            mem_arrays_[numa_node] = get_huge_pages(allocation_size, GHP_DEFAULT); 
+#endif
+        } else { //Non-large pages (nominal case)
+#endif
+            //Under normal (not large-page) operation, working set size is a multiple of regular pages.
+            allocation_size = num_thread_regions * working_set_size + g_page_size; 
+#ifdef _WIN32
+            mem_arrays_[numa_node] = VirtualAllocExNuma(GetCurrentProcess(), NULL, allocation_size, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE, numa_node); //Windows NUMA allocation. Make the allocation one page bigger than necessary so that we can do alignment.
+#endif
+#ifdef __gnu_linux__
+#ifdef HAS_NUMA
+            numa_set_strict(1); //Enforce NUMA memory allocation to land on specified node or fail otherwise. Alternative node fallback is forbidden.
+            mem_arrays_[numa_node] = numa_alloc_onnode(allocation_size, numa_node);
+#endif
+#ifndef HAS_NUMA //special case
+            mem_arrays_[numa_node] = malloc(allocation_size);
+            orig_malloc_addr_ = mem_arrays_[numa_node];
+#endif
+#endif
+#ifdef HAS_LARGE_PAGES
+        }
+#endif
+        
+        if (mem_arrays_[numa_node] != nullptr)
+            mem_array_lens_[numa_node] = num_thread_regions * working_set_size;
+        else {
+            std::cerr << "ERROR: Failed to allocate " << allocation_size << " B on NUMA node " << numa_node << " for " << num_thread_regions << " worker thread regions." << std::endl;
+            exit(-1);
+        }
+
+        if (g_verbose) {
+            std::cout << std::endl;
+            std::cout << "Virtual address for memory on NUMA node " << numa_node << ":" << std::endl;
+            std::printf("0x%.16llX", reinterpret_cast<long long unsigned int>(mem_arrays_[numa_node]));
+        }
+
+        //upwards alignment to page boundary
+        uintptr_t mask;
+        if (config_.useLargePages())
+            mask = static_cast<uintptr_t>(g_large_page_size)-1;
+        else
+            mask = static_cast<uintptr_t>(g_page_size)-1; //e.g. 4095 bytes
+        uintptr_t tmp_ptr = reinterpret_cast<uintptr_t>(mem_arrays_[numa_node]);
+        uintptr_t aligned_addr = (tmp_ptr + mask) & ~mask; //add one page to the address, then truncate least significant bits of address to be page aligned.
+        mem_arrays_[numa_node] = reinterpret_cast<void*>(aligned_addr); 
+
+        if (g_verbose) {
+            std::cout << " --- ALIGNED --> ";
+            std::printf("0x%.16llX", reinterpret_cast<long long unsigned int>(mem_arrays_[numa_node]));
+            std::cout << std::endl;
+        }
+
+        //Give memory known contents, so that benchmarks do not read freshly allocated pages that the OS may back with a shared zero page
+        if (config_.useDataPatternInitialization()) {
+            if (g_verbose)
+                std::cout << "Initializing memory on NUMA node " << numa_node << " with the " << data_pattern_name(config_.getDataPatternInitialization()) << " data pattern." << std::endl;
+            uint8_t* mem_array = static_cast<uint8_t*>(mem_arrays_[numa_node]);
+            if (!fill_data_pattern(mem_array, mem_array + mem_array_lens_[numa_node], config_.getDataPatternInitialization(), config_.getDataPatternFileData()))
+                std::cerr << "WARNING: Failed to initialize memory on NUMA node " << numa_node << " with a data pattern." << std::endl;
+        }
+    }
+}
+
+bool BenchmarkManager::buildBenchmarks() {
+    if (g_verbose)  {
+        std::cout << std::endl;
+        std::cout << "Generating benchmarks." << std::endl;
+    }
+
+    //Put the enumerations into vectors to make constructing benchmarks more loopable
+    std::vector<chunk_size_t> chunks;
+    if (config_.useChunk32b())
+        chunks.push_back(CHUNK_32b); 
+#ifdef HAS_WORD_64
+    if (config_.useChunk64b())
+        chunks.push_back(CHUNK_64b); 
+#endif
+#ifdef HAS_WORD_128
+    if (config_.useChunk128b())
+        chunks.push_back(CHUNK_128b); 
+#endif
+#ifdef HAS_WORD_256
+    if (config_.useChunk256b())
+        chunks.push_back(CHUNK_256b); 
+#endif
+#ifdef HAS_WORD_512
+    if (config_.useChunk512b())
+        chunks.push_back(CHUNK_512b); 
+#endif
+
+    std::vector<rw_mode_t> rws;
+    if (config_.useReads())
+        rws.push_back(READ);
+    if (config_.useWrites())
+        rws.push_back(WRITE);
+    if (config_.useReadModifyWrite())
+        rws.push_back(READ_MODIFY_WRITE);
+    std::list<rw_mode_t> rw_mixes = config_.getReadWriteMixes();
+    rws.insert(rws.end(), rw_mixes.begin(), rw_mixes.end());
+    
+    std::vector<int32_t> strides;
+    if (config_.useStrideP1())
+        strides.push_back(1);
+    if (config_.useStrideN1())
+        strides.push_back(-1);
+    if (config_.useStrideP2())
+        strides.push_back(2);
+    if (config_.useStrideN2())
+        strides.push_back(-2);
+    if (config_.useStrideP4())
+        strides.push_back(4);
+    if (config_.useStrideN4())
+        strides.push_back(-4);
+    if (config_.useStrideP8())
+        strides.push_back(8);
+    if (config_.useStrideN8())
+        strides.push_back(-8);
+    if (config_.useStrideP16())
+        strides.push_back(16);
+    if (config_.useStrideN16())
+        strides.push_back(-16);
+
+    //Working set sizes per thread. In a sweep, every size runs on a sub-range of the same allocation.
+    std::vector<size_t> working_set_sizes;
+    if (config_.useWorkingSetSizeSweep()) {
+        std::list<size_t> sweep = config_.getWorkingSetSizeSweep();
+        working_set_sizes.assign(sweep.begin(), sweep.end());
+    } else
+        working_set_sizes.push_back(config_.getWorkingSetSizePerThread());
+
+    //Numbers of worker threads. In a sweep, every thread count runs on a sub-range of the same allocation.
+    std::vector<uint32_t> num_threads_list;
+    if (config_.useNumWorkerThreadsSweep()) {
+        std::list<uint32_t> sweep = config_.getNumWorkerThreadsSweep();
+        num_threads_list.assign(sweep.begin(), sweep.end());
+    } else
+        num_threads_list.push_back(config_.getNumWorkerThreads());
+
+    //Load thread placements for loaded latency benchmarks. Empty vectors mean load threads are co-located with the latency measurement thread.
+    std::list<std::pair<uint32_t, uint32_t> > load_placements = config_.getLatencyLoadPlacements();
+    std::vector<void*> load_mem_arrays;
+    std::vector<uint32_t> load_cpu_nodes;
+    std::vector<uint32_t> load_mem_nodes;
+    for (auto it = load_placements.cbegin(); it != load_placements.cend(); it++) {
+        load_cpu_nodes.push_back(it->first);
+        load_mem_nodes.push_back(it->second);
+        load_mem_arrays.push_back(mem_arrays_[it->second]);
+    }
+
+    if (g_verbose)
+        std::cout << std::endl;
+
+    std::string benchmark_name;
+
+    //Build throughput benchmarks. This is a humongous nest of for loops, but rest assured, the range of each loop should be small enough. The problem is we have many combinations to test.
     for (auto mem_node_it = memory_numa_node_affinities_.cbegin(); mem_node_it != memory_numa_node_affinities_.cend(); mem_node_it++) { //iterate each memory NUMA node
         uint32_t mem_node = *mem_node_it;
         void* mem_array = mem_arrays_[mem_node];           
-        size_t mem_array_len = mem_array_lens_[mem_node];
 
-        for (auto cpu_node_it = cpu_numa_node_affinities_.cbegin(); cpu_node_it != cpu_numa_node_affinities_.cend(); cpu_node_it++) { //iterate each cpu NUMA node
-            uint32_t cpu_node = *cpu_node_it;
-            bool buildLatBench = true; //Want to get at least one latency benchmark for all NUMA node combos
+        for (auto cpu_node_it = cpu_numa_node_affinities_.cbegin(); cpu_node_it != cpu_numa_node_affinities_.cend(); cpu_node_it++) { //iterate each cpu NUMA node
+            uint32_t cpu_node = *cpu_node_it;
+            std::vector<bool> buildLatBench(working_set_sizes.size(), true); //Want to get at least one latency benchmark for all NUMA node combos and working set sizes
+
+            //DO SEQUENTIAL/STRIDED TESTS
+            if (config_.useSequentialAccessPattern()) {
+                for (uint32_t rw_index = 0; rw_index < rws.size(); rw_index++) { //iterate read/write access types
+                    rw_mode_t rw = rws[rw_index];
+
+                    for (uint32_t chunk_index = 0; chunk_index < chunks.size(); chunk_index++) { //iterate different chunk sizes
+                        chunk_size_t chunk = chunks[chunk_index];
+
+                        for (uint32_t stride_index = 0; stride_index < strides.size(); stride_index++) {  //iterate different stride lengths
+                            int32_t stride = strides[stride_index];
+
+                            if (!load_kernel_available(rw, chunk, stride)) { //Special case: read/write mixes only have forward sequential kernels, so skip other strides
+                                if (mem_node_it == memory_numa_node_affinities_.cbegin() && cpu_node_it == cpu_numa_node_affinities_.cbegin()) //Warn once, not for every NUMA combo
+                                    warn_load_kernel_unavailable(rw, chunk, stride);
+                                continue;
+                            }
+
+                            for (uint32_t threads_index = 0; threads_index < num_threads_list.size(); threads_index++) { //iterate different numbers of worker threads
+                                uint32_t num_threads = num_threads_list[threads_index];
+
+                                for (uint32_t ws_index = 0; ws_index < working_set_sizes.size(); ws_index++) { //iterate different working set sizes. This is innermost so that each sweep forms a contiguous curve.
+                                    size_t mem_array_len = num_threads * working_set_sizes[ws_index];
+                            
+                                    //Add the throughput benchmark
+                                    benchmark_name = static_cast<std::ostringstream*>(&(std::ostringstream() << "Test #" << g_test_index << "T (Throughput)"))->str();
+                                    tp_benchmarks_.push_back(new ThroughputBenchmark(mem_array,
+                                                                                 mem_array_len,
+                                                                                 config_.getIterationsPerTest(),
+                                                                                 num_threads,
+                                                                                 mem_node,
+                                                                                 cpu_node,
+                                                                                 SEQUENTIAL,
+                                                                                 rw,
+                                                                                 chunk,
+                                                                                 stride,
+                                                                                 dram_power_readers_,
+                                                                                 benchmark_name));
+                                    if (tp_benchmarks_[tp_benchmarks_.size()-1] == NULL) {
+                                        std::cerr << "ERROR: Failed to build a ThroughputBenchmark!" << std::endl;
+                                        return false;
+                                    }
+            
+                                    //Add the latency benchmark
+
+                                    //Special case: number of worker threads is 1, only need 1 latency thread in general to do unloaded latency tests. The same goes for all-core latency, which has no load threads.
+                                    if ((num_threads > 1 && !config_.useAllCoreLatency()) || buildLatBench[ws_index]) {
+                                        benchmark_name = static_cast<std::ostringstream*>(&(std::ostringstream() << "Test #" << g_test_index << "L (Latency)"))->str();
+                                        lat_benchmarks_.push_back(new LatencyBenchmark(mem_array,
+                                                                                        mem_array_len,
+                                                                                        config_.getIterationsPerTest(),
+                                                                                        num_threads,
+                                                                                        mem_node,
+                                                                                        cpu_node,
+                                                                                        SEQUENTIAL,
+                                                                                        rw,
+                                                                                        chunk,
+                                                                                        stride,
+                                                                                        dram_power_readers_,
+                                                                                        benchmark_name,
+                                                                                        load_mem_arrays,
+                                                                                        load_cpu_nodes,
+                                                                                        load_mem_nodes,
+                                                                                        config_.getLoadTargetBandwidth()));
+                                        if (lat_benchmarks_[lat_benchmarks_.size()-1] == NULL) {
+                                            std::cerr << "ERROR: Failed to build a LatencyBenchmark!" << std::endl;
+                                            return false;
+                                        }
+                                        if (config_.useLoadProfile())
+                                            lat_benchmarks_[lat_benchmarks_.size()-1]->setLoadProfile(config_.getLoadProfile());
+                                        lat_benchmarks_[lat_benchmarks_.size()-1]->setAllCoreLatency(config_.useAllCoreLatency());
+                                        lat_benchmarks_[lat_benchmarks_.size()-1]->setColdCache(config_.useColdCacheLatency());
+                                        buildLatBench[ws_index] = false; //Wait for next NUMA combo
+                                    }
+
+                                    g_test_index++;
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+            
+            if (config_.useRandomAccessPattern()) {
+                //DO RANDOM TESTS
+                for (uint32_t rw_index = 0; rw_index < rws.size(); rw_index++) { //iterate read/write access types
+                    rw_mode_t rw = rws[rw_index];
+
+                    for (uint32_t chunk_index = 0; chunk_index < chunks.size(); chunk_index++) { //iterate different chunk sizes
+                        chunk_size_t chunk = chunks[chunk_index];
+
+                        if (chunk == CHUNK_32b) //Special case: random load workers cannot use 32-bit chunks, so skip this benchmark combination
+                            continue;
+                        if (!load_kernel_available(rw, chunk, 0)) { //Special case: read/write mixes do not have 512-bit kernels, and read-modify-write is sequential only
+                            if (mem_node_it == memory_numa_node_affinities_.cbegin() && cpu_node_it == cpu_numa_node_affinities_.cbegin()) //Warn once, not for every NUMA combo
+                                warn_load_kernel_unavailable(rw, chunk, 0);
+                            continue;
+                        }
+
+                        for (uint32_t threads_index = 0; threads_index < num_threads_list.size(); threads_index++) { //iterate different numbers of worker threads
+                            uint32_t num_threads = num_threads_list[threads_index];
+
+                            for (uint32_t ws_index = 0; ws_index < working_set_sizes.size(); ws_index++) { //iterate different working set sizes. This is innermost so that each sweep forms a contiguous curve.
+                                size_t mem_array_len = num_threads * working_set_sizes[ws_index];
+                        
+                                //Add the throughput benchmark
+                                benchmark_name = static_cast<std::ostringstream*>(&(std::ostringstream() << "Test #" << g_test_index << "T (Throughput)"))->str();
+                                tp_benchmarks_.push_back(new ThroughputBenchmark(mem_array,
+                                                                                  mem_array_len,
+                                                                                  config_.getIterationsPerTest(),
+                                                                                  num_threads,
+                                                                                  mem_node,
+                                                                                  cpu_node,
+                                                                                  RANDOM,
+                                                                                  rw,
+                                                                                  chunk,
+                                                                                  0,
+                                                                                  dram_power_readers_,
+                                                                                  benchmark_name));
+                                if (tp_benchmarks_[tp_benchmarks_.size()-1] == NULL) {
+                                    std::cerr << "ERROR: Failed to build a ThroughputBenchmark!" << std::endl;
+                                    return false;
+                                }
+                                
+                                //Add the latency benchmark
+                                //Special case: number of worker threads is 1, only need 1 latency thread in general to do unloaded latency tests. The same goes for all-core latency, which has no load threads.
+                                if ((num_threads > 1 && !config_.useAllCoreLatency()) || buildLatBench[ws_index]) {
+                                    benchmark_name = static_cast<std::ostringstream*>(&(std::ostringstream() << "Test #" << g_test_index << "L (Latency)"))->str();
+                                    lat_benchmarks_.push_back(new LatencyBenchmark(mem_array,
+                                                                                    mem_array_len,
+                                                                                    config_.getIterationsPerTest(),
+                                                                                    num_threads,
+                                                                                    mem_node,
+                                                                                    cpu_node,
+                                                                                    RANDOM,
+                                                                                    rw,
+                                                                                    chunk,
+                                                                                    0,
+                                                                                    dram_power_readers_,
+                                                                                    benchmark_name,
+                                                                                    load_mem_arrays,
+                                                                                    load_cpu_nodes,
+                                                                                    load_mem_nodes,
+                                                                                    config_.getLoadTargetBandwidth()));
+                                    if (lat_benchmarks_[lat_benchmarks_.size()-1] == NULL) {
+                                        std::cerr << "ERROR: Failed to build a LatencyBenchmark!" << std::endl;
+                                        return false;
+                                    }
+                                    if (config_.useLoadProfile())
+                                        lat_benchmarks_[lat_benchmarks_.size()-1]->setLoadProfile(config_.getLoadProfile());
+                                    lat_benchmarks_[lat_benchmarks_.size()-1]->setAllCoreLatency(config_.useAllCoreLatency());
+                                    lat_benchmarks_[lat_benchmarks_.size()-1]->setColdCache(config_.useColdCacheLatency());
+                                
+                                    buildLatBench[ws_index] = false; //Wait for next NUMA combo
+                                }
+
+                                g_test_index++;
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+    
+    built_benchmarks_ = true;
+    return true;
+}
+
+bool BenchmarkManager::runInterferenceGenerator() {
+    std::vector<rw_mode_t> rws;
+    std::vector<chunk_size_t> chunks;
+    std::vector<int32_t> strides;
+    getConcurrentLoadSettings(rws, chunks, strides);
+    if (rws.empty() || chunks.empty() || strides.empty()) {
+        std::cerr << "ERROR: The interference generator needs a read/write mode, chunk size, and access pattern." << std::endl;
+        return false;
+    }
+
+    //Only one load setting is run, so take the first of each
+    rw_mode_t rw = rws[0];
+    chunk_size_t chunk = chunks[0];
+    int32_t stride = strides[0];
+    if (rws.size() > 1 || chunks.size() > 1 || strides.size() > 1)
+        std::cout << "NOTE: The interference generator runs a single load setting, so only the first selected read/write mode, chunk size, and access pattern or stride are used." << std::endl;
+    if (stride == 0 && chunk == CHUNK_32b) {
+        std::cerr << "ERROR: Random-access load kernels do not support 32-bit chunk sizes on 64-bit machines." << std::endl;
+        return false;
+    }
+    if (!load_kernel_available(rw, chunk, stride)) {
+        std::cerr << "ERROR: Read/write mixes only support random access and a stride of 1, up to 256-bit chunks, and read-modify-write does not support random access." << std::endl;
+        return false;
+    }
+
+    uint32_t cpu_node = cpu_numa_node_affinities_.front();
+    uint32_t mem_node = memory_numa_node_affinities_.front();
+    uint32_t num_threads = config_.getNumWorkerThreads();
+    size_t len_per_thread = config_.getWorkingSetSizePerThread();
+    void* mem_array = mem_arrays_[mem_node];
+    double target_bandwidth = config_.getLoadTargetBandwidth();
+
+    //Set up load generation kernel function pointers
+    SequentialFunction kernel_fptr_seq = NULL;
+    SequentialFunction kernel_dummy_fptr_seq = NULL; 
+    RandomFunction kernel_fptr_ran = NULL;
+    RandomFunction kernel_dummy_fptr_ran = NULL; 
+    if (stride != 0) {
+        if (!determine_sequential_kernel(rw, chunk, stride, &kernel_fptr_seq, &kernel_dummy_fptr_seq)) {
+            std::cerr << "ERROR: Failed to find appropriate benchmark kernel." << std::endl;
+            return false;
+        }
+    } else if (!determine_random_kernel(rw, chunk, &kernel_fptr_ran, &kernel_dummy_fptr_ran)) {
+        std::cerr << "ERROR: Failed to find appropriate benchmark kernel." << std::endl;
+        return false;
+    }
+
+    //Initialize memory regions for all threads by writing to them, causing the memory to be physically resident.
+    forwSequentialWrite_Word32(mem_array,
+                               reinterpret_cast<void*>(reinterpret_cast<uint8_t*>(mem_array)+num_threads*len_per_thread)); //static casts to silence compiler warnings
+
+    //Create load workers, each with its own region of memory
+    std::atomic<bool> stop(false);
+    std::vector<LoadWorker*> workers;
+    std::vector<Thread*> worker_threads;
+    for (uint32_t t = 0; t < num_threads; t++) {
+        void* thread_mem_array = reinterpret_cast<void*>(reinterpret_cast<uint8_t*>(mem_array) + t*len_per_thread);
+        int32_t cpu_id = cpu_id_in_numa_node(cpu_node, t);
+        if (cpu_id < 0)
+            std::cerr << "WARNING: Failed to find logical CPU " << t << " in NUMA node " << cpu_node << std::endl;
+
+        LoadWorker* worker = NULL;
+        if (stride != 0)
+            worker = new LoadWorker(thread_mem_array, len_per_thread, kernel_fptr_seq, kernel_dummy_fptr_seq, cpu_id);
+        else {
+            if (!build_random_pointer_permutation(thread_mem_array,
+                                               reinterpret_cast<void*>(reinterpret_cast<uint8_t*>(thread_mem_array) + len_per_thread), //static casts to silence compiler warnings
+                                               chunk)) {
+                std::cerr << "ERROR: Failed to build a random pointer permutation for a load generation thread!" << std::endl;
+                for (uint32_t w = 0; w < workers.size(); w++) {
+                    delete worker_threads[w];
+                    delete workers[w];
+                }
+                return false;
+            }
+            worker = new LoadWorker(thread_mem_array, len_per_thread, kernel_fptr_ran, kernel_dummy_fptr_ran, cpu_id);
+        }
+        if (target_bandwidth > 0)
+            worker->setTargetBandwidth(target_bandwidth / num_threads); //Each thread holds an equal share of the aggregate target
+        worker->setStopFlag(&stop);
+        workers.push_back(worker);
+        worker_threads.push_back(new Thread(worker));
+    }
+
+    std::cout << std::endl;
+    std::cout << "Interference generator: " << num_threads << " load threads on CPU NUMA node " << cpu_node << " accessing memory NUMA node " << mem_node << ", " << len_per_thread / KB << " KB per thread, ";
+    std::cout << (stride == 0 ? "random" : "sequential") << " " << rw_mode_name(rw);
+    switch (chunk) {
+        case CHUNK_32b:
+            std::cout << ", 32-bit chunks";
+            break;
+#ifdef HAS_WORD_64
+        case CHUNK_64b:
+            std::cout << ", 64-bit chunks";
+            break;
+#endif
+#ifdef HAS_WORD_128
+        case CHUNK_128b:
+            std::cout << ", 128-bit chunks";
+            break;
+#endif
+#ifdef HAS_WORD_256
+        case CHUNK_256b:
+            std::cout << ", 256-bit chunks";
+            break;
+#endif
+#ifdef HAS_WORD_512
+        case CHUNK_512b:
+            std::cout << ", 512-bit chunks";
+            break;
+#endif
+        default:
+            std::cout << ", UNKNOWN chunks";
+            break;
+    }
+    if (stride != 0)
+        std::cout << ", stride " << stride;
+    if (target_bandwidth > 0)
+        std::cout << ", load held at " << target_bandwidth << " MB/s";
+    std::cout << std::endl;
+    if (config_.getInterferenceDuration() > 0)
+        std::cout << "Running for " << config_.getInterferenceDuration() << " s. Send SIGTERM or SIGINT to stop early." << std::endl;
+    else
+        std::cout << "Running until SIGTERM or SIGINT is received." << std::endl;
+
+    //Catch stop signals so that workers can be stopped and joined cleanly
+    g_interference_stop_requested = 0;
+    void (*original_sigint_handler)(int) = signal(SIGINT, request_interference_stop);
+    void (*original_sigterm_handler)(int) = signal(SIGTERM, request_interference_stop);
+
+    for (uint32_t t = 0; t < num_threads; t++)
+        worker_threads[t]->create_and_start();
+
+    //Report achieved bandwidth periodically until stopped or the deadline passes
+    tick_t start_tick = start_timer();
+    tick_t last_report_tick = start_tick;
+    uint64_t last_report_bytes = 0;
+    uint64_t deadline_ms = static_cast<uint64_t>(config_.getInterferenceDuration()) * 1000;
+    uint64_t next_report_ms = config_.getInterferenceReportInterval();
+    uint64_t elapsed_ms = 0;
+    while (!g_interference_stop_requested && (deadline_ms == 0 || elapsed_ms < deadline_ms)) {
+        sleep_ms(INTERFERENCE_STOP_POLL_MS);
+        tick_t now_tick = stop_timer();
+        elapsed_ms = (now_tick - start_tick) / g_ticks_per_ms;
+        if (elapsed_ms < next_report_ms)
+            continue;
+
+        uint64_t bytes = 0;
+        for (uint32_t t = 0; t < num_threads; t++)
+            bytes += workers[t]->getBytesDone();
+        double interval_bandwidth = (static_cast<double>(bytes - last_report_bytes) / MB) / ((now_tick - last_report_tick) * g_ns_per_tick / 1e9);
+        double mean_bandwidth = (static_cast<double>(bytes) / MB) / ((now_tick - start_tick) * g_ns_per_tick / 1e9);
+        std::printf("[%10.3f s]    %0.3f MB/s (mean %0.3f MB/s)\n", (now_tick - start_tick) * g_ns_per_tick / 1e9, interval_bandwidth, mean_bandwidth);
+        std::fflush(stdout);
+        if (config_.useOutputFile()) {
+            results_file_ << (now_tick - start_tick) * g_ns_per_tick / 1e9 << ",";
+            results_file_ << interval_bandwidth << ",";
+            results_file_ << mean_bandwidth << ",";
+            if (target_bandwidth > 0)
+                results_file_ << target_bandwidth << ",";
+            else
+                results_file_ << "N/A" << ",";
+            results_file_ << std::endl;
+        }
+
+        last_report_tick = now_tick;
+        last_report_bytes = bytes;
+        while (next_report_ms <= elapsed_ms)
+            next_report_ms += config_.getInterferenceReportInterval();
+    }
+
+    //Stop workers and wait for them to finish
+    stop.store(true);
+    for (uint32_t t = 0; t < num_threads; t++)
+        if (!worker_threads[t]->join())
+            std::cerr << "WARNING: A worker thread failed to complete correctly!" << std::endl;
+    tick_t stop_tick = stop_timer();
+
+    signal(SIGINT, original_sigint_handler);
+    signal(SIGTERM, original_sigterm_handler);
+
+    uint64_t total_bytes = 0;
+    for (uint32_t t = 0; t < num_threads; t++)
+        total_bytes += workers[t]->getBytesDone();
+    double total_sec = (stop_tick - start_tick) * g_ns_per_tick / 1e9;
+    std::cout << std::endl;
+    std::cout << "Interference generator stopped";
+    if (g_interference_stop_requested)
+        std::cout << " by signal";
+    std::cout << " after " << total_sec << " s: " << static_cast<double>(total_bytes) / MB << " MB accessed, " << (static_cast<double>(total_bytes) / MB) / total_sec << " MB/s mean";
+    if (target_bandwidth > 0)
+        std::cout << " (" << target_bandwidth << " MB/s requested)";
+    std::cout << std::endl;
+
+    for (uint32_t t = 0; t < num_threads; t++) {
+        delete worker_threads[t];
+        delete workers[t];
+    }
+
+    return true;
+}
+
+bool BenchmarkManager::runCoreToCoreLatencyBenchmark() {
+    std::vector<uint32_t> cpus;
+    std::vector<uint32_t> cpu_nodes;
+    std::list<std::pair<uint32_t, uint32_t> > pairs = config_.getCoreToCorePairs();
+    if (pairs.empty())
+        getCoreToCoreCPUs(cpus, cpu_nodes);
+    else { //Only the CPUs of the given pairs appear in the matrix
+        for (auto it = pairs.cbegin(); it != pairs.cend(); it++) {
+            if (std::find(cpus.begin(), cpus.end(), it->first) == cpus.end())
+                cpus.push_back(it->first);
+            if (std::find(cpus.begin(), cpus.end(), it->second) == cpus.end())
+                cpus.push_back(it->second);
+        }
+        std::sort(cpus.begin(), cpus.end());
+        for (uint32_t i = 0; i < cpus.size(); i++)
+            cpu_nodes.push_back(getCPUNumaNode(cpus[i]));
+    }
+    if (cpus.size() < 2) {
+        std::cerr << "ERROR: The core-to-core latency benchmark needs at least two logical CPUs in the selected CPU NUMA nodes." << std::endl;
+        return false;
+    }
+
+    //The shared line is the first cache line of the memory region of the first selected memory node
+    uint32_t mem_node = memory_numa_node_affinities_.front();
+    void* line = mem_arrays_[mem_node];
+    uint32_t iterations = config_.getIterationsPerTest();
+
+    std::cout << std::endl;
+    std::cout << "Core-to-core cache line transfer latency: " << cpus.size() << " logical CPUs, " << (pairs.empty() ? cpus.size() * (cpus.size()-1) / 2 : pairs.size()) << " pairs, " << C2C_LATENCY_ROUND_TRIPS << " round trips per pair and iteration, shared line on memory NUMA node " << mem_node << std::endl;
+
+    //The matrix is indexed by position in the CPU list. The diagonal is not measured.
+    std::vector<std::vector<double> > matrix(cpus.size(), std::vector<double>(cpus.size(), -1));
+    std::vector<std::vector<double> > relation_latencies(NUM_CPU_RELATIONS);
+    for (uint32_t i = 0; i < cpus.size(); i++) {
+        for (uint32_t j = i+1; j < cpus.size(); j++) {
+            if (!pairs.empty()) { //Skip pairs that were not given in either order
+                bool given = false;
+                for (auto it = pairs.cbegin(); it != pairs.cend(); it++)
+                    if ((it->first == cpus[i] && it->second == cpus[j]) || (it->first == cpus[j] && it->second == cpus[i]))
+                        given = true;
+                if (!given)
+                    continue;
+            }
+
+            std::string benchmark_name = static_cast<std::ostringstream*>(&(std::ostringstream() << "Test #" << g_test_index++ << "C (Core-to-Core Latency)"))->str();
+            cpu_relation_t relation = get_cpu_relation(cpus[i], cpus[j]);
+            std::vector<double> latency_on_iter;
+            bool warning = false;
+
+            for (uint32_t iter = 0; iter < iterations; iter++) {
+                new (line) std::atomic<uint64_t>(0); //Both workers must see a cleared line when they start
+                PingPongWorker initiator(line, sizeof(std::atomic<uint64_t>), true, C2C_LATENCY_ROUND_TRIPS, cpus[i]);
+                PingPongWorker responder(line, sizeof(std::atomic<uint64_t>), false, C2C_LATENCY_ROUND_TRIPS, cpus[j]);
+                Thread initiator_thread(&initiator);
+                Thread responder_thread(&responder);
+                if (!responder_thread.create_and_start()) {
+                    std::cerr << "ERROR: Failed to start the core-to-core latency worker threads." << std::endl;
+                    return false;
+                }
+                if (!initiator_thread.create_and_start()) {
+                    std::cerr << "ERROR: Failed to start the core-to-core latency worker threads." << std::endl;
+                    //Play the initiator's part untimed, so that the responder finishes its round trips instead of waiting for them forever
+                    std::atomic<uint64_t>* shared_line = static_cast<std::atomic<uint64_t>*>(line);
+                    uint64_t total_round_trips = static_cast<uint64_t>(C2C_LATENCY_ROUND_TRIPS) + C2C_LATENCY_WARMUP_ROUND_TRIPS;
+                    for (uint64_t r = 0; r < total_round_trips; r++) {
+                        shared_line->store(2*r+1, std::memory_order_release);
+                        while (shared_line->load(std::memory_order_acquire) != 2*r+2)
+                            ;
+                    }
+                    responder_thread.join();
+                    return false;
+                }
+                if (!initiator_thread.join() || !responder_thread.join())
+                    std::cerr << "WARNING: A worker thread failed to complete correctly!" << std::endl;
+
+                latency_on_iter.push_back(initiator.getMeanTransferLatency());
+                if (initiator.hadWarning())
+                    warning = true;
+            }
+
+            std::vector<double> sorted = latency_on_iter;
+            std::sort(sorted.begin(), sorted.end());
+            double median = sorted[sorted.size()/2];
+            matrix[i][j] = median;
+            matrix[j][i] = median;
+            relation_latencies[relation].push_back(median);
+
+            std::printf("%s    CPU %u <-> CPU %u (%s): %0.1f ns/transfer", benchmark_name.c_str(), cpus[i], cpus[j], cpu_relation_name(relation).c_str(), median);
+            if (warning)
+                std::printf(" (WARNING)");
+            std::printf("\n");
+            std::fflush(stdout);
+
+            std::string notes = static_cast<std::ostringstream*>(&(std::ostringstream() << "CPU " << cpus[i] << " <-> CPU " << cpus[j] << " (" << cpu_relation_name(relation) << ")"))->str();
+            writeWorkerResults(benchmark_name, 0, 2, mem_node, static_cast<std::ostringstream*>(&(std::ostringstream() << cpu_nodes[i] << "+" << cpu_nodes[j]))->str(), std::vector<double>(), "", latency_on_iter, "ns/transfer", notes);
+        }
+    }
+
+    std::cout << std::endl;
+    std::cout << "*** CORE-TO-CORE CACHE LINE TRANSFER LATENCY MATRIX ***" << std::endl;
+    reportCPUMatrix("Median one-way transfer latency", cpus, matrix, "ns/transfer");
+    reportCPURelationSummary(relation_latencies, "ns/transfer");
+    std::cout << std::endl;
+
+    return true;
+}
+
+bool BenchmarkManager::runCoreToCoreBandwidthBenchmark() {
+    std::vector<std::pair<uint32_t, uint32_t> > pairs;
+    getCoreToCoreCPUPairs(pairs);
+    if (pairs.empty()) {
+        std::cerr << "ERROR: The core-to-core bandwidth benchmark needs at least two logical CPUs in the selected CPU NUMA nodes." << std::endl;
+        return false;
+    }
+
+    //The ring buffer uses the start of the memory region of the first selected memory node, and its control counters follow it
+    uint32_t mem_node = memory_numa_node_affinities_.front();
+    size_t ring_len = config_.getWorkingSetSizePerThread();
+    void* ring = mem_arrays_[mem_node];
+    RingBufferControl* control = NULL;
+    bool control_allocated = false;
+    if (mem_array_lens_[mem_node] >= ring_len + sizeof(RingBufferControl))
+        control = reinterpret_cast<RingBufferControl*>(reinterpret_cast<uint8_t*>(ring) + ring_len);
+    else { //Only one thread's worth of memory was allocated, so keep the counters on the heap instead
+        control = new RingBufferControl;
+        control_allocated = true;
+    }
+    uint32_t iterations = config_.getIterationsPerTest();
+    std::list<size_t> block_sizes = config_.getCoreToCoreBlockSizes();
+
+    //Make the ring physically resident
+    forwSequentialWrite_Word32(ring, reinterpret_cast<void*>(reinterpret_cast<uint8_t*>(ring) + ring_len)); //static casts to silence compiler warnings
+
+    std::cout << std::endl;
+    std::cout << "Core-to-core producer/consumer bandwidth: " << pairs.size() << " CPU pairs, " << ring_len / KB << " KB ring buffer on memory NUMA node " << mem_node << ", " << static_cast<size_t>(C2C_BANDWIDTH_BYTES_PER_ITERATION) / MB << " MB streamed and " << C2C_BANDWIDTH_HANDOFF_BLOCKS << " blocks handed off one at a time per pair, block size, and iteration" << std::endl;
+
+    std::vector<std::vector<std::vector<double> > > relation_throughputs(block_sizes.size(), std::vector<std::vector<double> >(NUM_CPU_RELATIONS));
+    bool success = true;
+    for (uint32_t p = 0; p < pairs.size() && success; p++) {
+        uint32_t producer_cpu = pairs[p].first;
+        uint32_t consumer_cpu = pairs[p].second;
+        cpu_relation_t relation = get_cpu_relation(producer_cpu, consumer_cpu);
+
+        uint32_t b = 0;
+        for (auto block_it = block_sizes.cbegin(); block_it != block_sizes.cend() && success; block_it++, b++) {
+            size_t block_size = *block_it;
+            std::string benchmark_name = static_cast<std::ostringstream*>(&(std::ostringstream() << "Test #" << g_test_index++ << "P (Core-to-Core Bandwidth)"))->str();
+            std::vector<double> throughput_on_iter;
+            std::vector<double> handoff_on_iter;
+            bool warning = false;
+
+            for (uint32_t iter = 0; iter < iterations && success; iter++) {
+                //First stream with the ring kept full, then hand off one block at a time
+                for (uint32_t phase = 0; phase < 2; phase++) {
+                    bool lock_step = (phase == 1);
+                    uint64_t blocks = lock_step ? C2C_BANDWIDTH_HANDOFF_BLOCKS : static_cast<uint64_t>(C2C_BANDWIDTH_BYTES_PER_ITERATION) / block_size;
+                    new (control) RingBufferControl(); //Both workers must see cleared counters when they start
+                    control->produced.store(0);
+                    control->consumed.store(0);
+                    control->arrived.store(0);
+                    ProducerConsumerWorker producer(ring, ring_len, control, true, block_size, blocks, lock_step, producer_cpu);
+                    ProducerConsumerWorker consumer(ring, ring_len, control, false, block_size, blocks, lock_step, consumer_cpu);
+                    Thread producer_thread(&producer);
+                    Thread consumer_thread(&consumer);
+                    if (!consumer_thread.create_and_start()) {
+                        std::cerr << "ERROR: Failed to start the core-to-core bandwidth worker threads." << std::endl;
+                        success = false;
+                        break;
+                    }
+                    if (!producer_thread.create_and_start()) {
+                        std::cerr << "ERROR: Failed to start the core-to-core bandwidth worker threads." << std::endl;
+                        //Stand in for the producer, so that the consumer does not wait for it forever: arrive at the start barrier and publish every block at once
+                        control->arrived.fetch_add(1);
+                        control->produced.store(blocks, std::memory_order_release);
+                        consumer_thread.join();
+                        success = false;
+                        break;
+                    }
+                    if (!producer_thread.join() || !consumer_thread.join())
+                        std::cerr << "WARNING: A worker thread failed to complete correctly!" << std::endl;
+
+                    if (producer.hadWarning() || consumer.hadWarning())
+                        warning = true;
+                    if (lock_step) //The producer sees each block released before writing the next, so its time covers whole handoffs
+                        handoff_on_iter.push_back(producer.getElapsedTicks() * g_ns_per_tick / blocks);
+                    else //The consumer finishes last, once every block has been read
+                        throughput_on_iter.push_back((static_cast<double>(blocks * block_size) / MB) / (consumer.getElapsedTicks() * g_ns_per_tick / 1e9));
+                }
+            }
+            if (!success)
+                break;
+
+            std::vector<double> sorted_throughput = throughput_on_iter;
+            std::vector<double> sorted_handoff = handoff_on_iter;
+            std::sort(sorted_throughput.begin(), sorted_throughput.end());
+            std::sort(sorted_handoff.begin(), sorted_handoff.end());
+            double median_throughput = sorted_throughput[sorted_throughput.size()/2];
+            double median_handoff = sorted_handoff[sorted_handoff.size()/2];
+            relation_throughputs[b][relation].push_back(median_throughput);
+
+            std::printf("%s    CPU %u -> CPU %u (%s), %lu B blocks: %0.1f MB/s, handoff %0.1f ns/block", benchmark_name.c_str(), producer_cpu, consumer_cpu, cpu_relation_name(relation).c_str(), static_cast<unsigned long>(block_size), median_throughput, median_handoff);
+            if (warning)
+                std::printf(" (WARNING)");
+            std::printf("\n");
+            std::fflush(stdout);
+
+            std::string notes = static_cast<std::ostringstream*>(&(std::ostringstream() << "CPU " << producer_cpu << " -> CPU " << consumer_cpu << " (" << cpu_relation_name(relation) << "); " << block_size << " B blocks through a " << ring_len / KB << " KB ring; latency is the handoff time of one block in flight"))->str();
+            writeWorkerResults(benchmark_name, 0, 2, mem_node, static_cast<std::ostringstream*>(&(std::ostringstream() << getCPUNumaNode(producer_cpu) << "+" << getCPUNumaNode(consumer_cpu)))->str(), throughput_on_iter, "MB/s", handoff_on_iter, "ns/block", notes);
+        }
+    }
+
+    if (success) {
+        std::cout << std::endl;
+        std::cout << "*** CORE-TO-CORE PRODUCER/CONSUMER BANDWIDTH ***" << std::endl;
+        uint32_t b = 0;
+        for (auto block_it = block_sizes.cbegin(); block_it != block_sizes.cend(); block_it++, b++) {
+            std::cout << std::endl << *block_it << " B blocks:";
+            reportCPURelationSummary(relation_throughputs[b], "MB/s");
+        }
+        std::cout << std::endl;
+    }
+
+    if (control_allocated)
+        delete control;
+    return success;
+}
+
+bool BenchmarkManager::runAtomicBenchmark() {
+    //Add CPUs in order of topological distance from the first one, so that contention crosses cores, last-level caches, and sockets in turn as threads are added
+    std::vector<uint32_t> thread_cpus;
+    std::vector<uint32_t> thread_cpu_nodes;
+    std::vector<int32_t> thread_relations; //Farthest relation spanned by the first N threads. -1 means a single thread.
+    getCoreToCoreCPUsByDistance(thread_cpus, thread_cpu_nodes, thread_relations);
+    if (thread_cpus.empty()) {
+        std::cerr << "ERROR: The atomic operation benchmark needs at least one logical CPU in the selected CPU NUMA nodes." << std::endl;
+        return false;
+    }
+
+    //Use powers of two threads, the most threads that stay within each relation, and all of them
+    std::vector<uint32_t> thread_counts;
+    for (uint32_t n = 1; n < thread_cpus.size(); n *= 2)
+        thread_counts.push_back(n);
+    for (uint32_t n = 2; n < thread_cpus.size(); n++)
+        if (thread_relations[n] != thread_relations[n-1])
+            thread_counts.push_back(n);
+    thread_counts.push_back(static_cast<uint32_t>(thread_cpus.size()));
+    std::sort(thread_counts.begin(), thread_counts.end());
+    thread_counts.erase(std::unique(thread_counts.begin(), thread_counts.end()), thread_counts.end());
+
+    //The lines are at the start of the memory region of the first selected memory node. Private lines and spread lines both start at the first line.
+    uint32_t mem_node = memory_numa_node_affinities_.front();
+    uint8_t* lines = reinterpret_cast<uint8_t*>(mem_arrays_[mem_node]);
+    uint32_t spread_lines = config_.getAtomicSpreadAddresses();
+    size_t num_lines = std::max(static_cast<size_t>(thread_cpus.size()), static_cast<size_t>(spread_lines));
+    if (mem_array_lens_[mem_node] < num_lines * CACHE_LINE_SIZE) {
+        std::cerr << "ERROR: The atomic operation benchmark needs " << num_lines * CACHE_LINE_SIZE << " B of memory for its cache lines. Increase the working set size per thread." << std::endl;
+        return false;
+    }
+    uint32_t iterations = config_.getIterationsPerTest();
+    std::list<atomic_op_t> atomic_ops = config_.getAtomicOps();
+    std::list<atomic_sharing_t> sharing_modes = config_.getAtomicSharingModes();
+
+    std::cout << std::endl;
+    std::cout << "Atomic operation contention: up to " << thread_cpus.size() << " threads, lines on memory NUMA node " << mem_node << ", about " << ATOMIC_BENCHMARK_DURATION_MS << " ms per setting and iteration" << std::endl;
+    std::cout << "Logical CPUs in the order they are added:";
+    for (uint32_t i = 0; i < thread_cpus.size(); i++)
+        std::cout << " " << thread_cpus[i];
+    std::cout << std::endl;
+
+    //Rows of the summary tables are (operation, sharing mode) settings, and columns are thread counts
+    std::vector<std::string> row_names;
+    std::vector<std::vector<double> > throughput_table;
+    std::vector<std::vector<double> > latency_table;
+    for (auto op_it = atomic_ops.cbegin(); op_it != atomic_ops.cend(); op_it++) {
+        for (auto sharing_it = sharing_modes.cbegin(); sharing_it != sharing_modes.cend(); sharing_it++) {
+            atomic_op_t atomic_op = *op_it;
+            atomic_sharing_t sharing = *sharing_it;
+            row_names.push_back(atomic_op_name(atomic_op) + " " + atomic_sharing_name(sharing));
+            throughput_table.push_back(std::vector<double>());
+            latency_table.push_back(std::vector<double>());
+
+            for (uint32_t c = 0; c < thread_counts.size(); c++) {
+                uint32_t num_threads = thread_counts[c];
+                std::string benchmark_name = static_cast<std::ostringstream*>(&(std::ostringstream() << "Test #" << g_test_index++ << "A (Atomics)"))->str();
+                std::vector<double> throughput_on_iter;
+                std::vector<double> latency_on_iter;
+                std::vector<double> failure_rate_on_iter;
+                bool warning = false;
+
+                for (uint32_t iter = 0; iter < iterations; iter++) {
+                    for (size_t l = 0; l < num_lines; l++)
+                        new (lines + l * CACHE_LINE_SIZE) std::atomic<uint64_t>(0);
+                    std::atomic<uint32_t> arrived(0);
+                    std::vector<AtomicWorker*> workers;
+                    std::vector<Thread*> worker_threads;
+                    for (uint32_t t = 0; t < num_threads; t++) {
+                        switch (sharing) {
+                            case ATOMIC_PRIVATE:
+                                workers.push_back(new AtomicWorker(lines + t * CACHE_LINE_SIZE, 1, 0, atomic_op, &arrived, num_threads, thread_cpus[t]));
+                                break;
+                            case ATOMIC_SHARED:
+                                workers.push_back(new AtomicWorker(lines, 1, 0, atomic_op, &arrived, num_threads, thread_cpus[t]));
+                                break;
+                            default: //spread
+                                workers.push_back(new AtomicWorker(lines, spread_lines, t % spread_lines, atomic_op, &arrived, num_threads, thread_cpus[t]));
+                                break;
+                        }
+                        worker_threads.push_back(new Thread(workers[t]));
+                    }
+
+                    bool success = true;
+                    for (uint32_t t = 0; t < num_threads; t++) {
+                        if (!worker_threads[t]->create_and_start()) {
+                            std::cerr << "ERROR: Failed to start the atomic worker threads." << std::endl;
+                            arrived.fetch_add(1); //Stand in for the worker that did not start, so that the others do not wait for it forever
+                            success = false;
+                        }
+                    }
+                    for (uint32_t t = 0; t < num_threads; t++) {
+                        if (!worker_threads[t]->join())
+                            std::cerr << "WARNING: A worker thread failed to complete correctly!" << std::endl;
+                    }
+
+                    //Each thread ran for about the same time, so their rates add up
+                    double throughput = 0;
+                    double latency = 0;
+                    uint64_t ops = 0;
+                    uint64_t failures = 0;
+                    for (uint32_t t = 0; t < num_threads; t++) {
+                        double op_latency = workers[t]->getMeanOpLatency();
+                        if (op_latency > 0)
+                            throughput += 1e3 / op_latency; //Mops/s
+                        latency += op_latency;
+                        ops += workers[t]->getOps();
+                        failures += workers[t]->getCompareExchangeFailures();
+                        if (workers[t]->hadWarning())
+                            warning = true;
+                        delete worker_threads[t];
+                        delete workers[t];
+                    }
+                    if (!success)
+                        return false;
+                    throughput_on_iter.push_back(throughput);
+                    latency_on_iter.push_back(latency / num_threads);
+                    failure_rate_on_iter.push_back(ops > 0 ? 100.0 * failures / ops : 0);
+                }
+
+                std::vector<double> sorted_throughput = throughput_on_iter;
+                std::vector<double> sorted_latency = latency_on_iter;
+                std::vector<double> sorted_failure_rate = failure_rate_on_iter;
+                std::sort(sorted_throughput.begin(), sorted_throughput.end());
+                std::sort(sorted_latency.begin(), sorted_latency.end());
+                std::sort(sorted_failure_rate.begin(), sorted_failure_rate.end());
+                double median_throughput = sorted_throughput[sorted_throughput.size()/2];
+                double median_latency = sorted_latency[sorted_latency.size()/2];
+                double median_failure_rate = sorted_failure_rate[sorted_failure_rate.size()/2];
+                throughput_table.back().push_back(median_throughput);
+                latency_table.back().push_back(median_latency);
+
+                std::string span = (thread_relations[num_threads-1] < 0) ? "single thread" : "spans " + cpu_relation_name(static_cast<cpu_relation_t>(thread_relations[num_threads-1]));
+                std::printf("%s    %s, %s lines, %u threads (%s): %0.1f Mops/s, %0.1f ns/op", benchmark_name.c_str(), atomic_op_name(atomic_op).c_str(), atomic_sharing_name(sharing).c_str(), num_threads, span.c_str(), median_throughput, median_latency);
+                if (atomic_op == ATOMIC_COMPARE_EXCHANGE)
+                    std::printf(", %0.1f%% failed", median_failure_rate);
+                if (warning)
+                    std::printf(" (WARNING)");
+                std::printf("\n");
+                std::fflush(stdout);
+
+                std::ostringstream notes;
+                notes << atomic_op_name(atomic_op) << " on " << atomic_sharing_name(sharing) << " lines";
+                if (sharing == ATOMIC_SPREAD)
+                    notes << " (" << spread_lines << " lines)";
+                notes << "; " << span;
+                if (atomic_op == ATOMIC_COMPARE_EXCHANGE)
+                    notes << "; " << median_failure_rate << "% of operations failed";
+                writeWorkerResults(benchmark_name, 0, num_threads, mem_node, join_numa_nodes(std::vector<uint32_t>(thread_cpu_nodes.begin(), thread_cpu_nodes.begin() + num_threads)), throughput_on_iter, "Mops/s", latency_on_iter, "ns/op", notes.str());
+            }
+        }
+    }
+
+    std::cout << std::endl;
+    std::cout << "*** ATOMIC OPERATION CONTENTION ***" << std::endl;
+    for (uint32_t table = 0; table < 2; table++) {
+        const std::vector<std::vector<double> >& values = (table == 0) ? throughput_table : latency_table;
+        std::cout << std::endl;
+        std::cout << ((table == 0) ? "Aggregate throughput, Mops/s" : "Mean latency per operation, ns/op") << ":" << std::endl;
+        std::printf("    %-16s", "Threads");
+        for (uint32_t c = 0; c < thread_counts.size(); c++)
+            std::printf(" %9u", thread_counts[c]);
+        std::printf("\n");
+        for (uint32_t r = 0; r < row_names.size(); r++) {
+            std::printf("    %-16s", row_names[r].c_str());
+            for (uint32_t c = 0; c < values[r].size(); c++)
+                std::printf(" %9.1f", values[r][c]);
+            std::printf("\n");
+        }
+    }
+    std::cout << std::endl;
+    std::cout << "Farthest CPU relation spanned by each thread count:" << std::endl;
+    for (uint32_t c = 0; c < thread_counts.size(); c++) {
+        int32_t relation = thread_relations[thread_counts[c]-1];
+        std::printf("    %4u threads: %s\n", thread_counts[c], (relation < 0) ? "single thread" : cpu_relation_name(static_cast<cpu_relation_t>(relation)).c_str());
+    }
+    std::cout << std::endl;
+
+    return true;
+}
 
-            //DO SEQUENTIAL/STRIDED TESTS
-            if (config_.useSequentialAccessPattern()) {
-                for (uint32_t rw_index = 0; rw_index < rws.size(); rw_index++) { //iterate read/write access types
-                    rw_mode_t rw = rws[rw_index];
+bool BenchmarkManager::runFalseSharingBenchmark() {
+    //Each group of threads is a pair of logical CPUs at some topological distance, plus the configured number of threads placed by distance if there are more than two
+    std::vector<std::vector<uint32_t> > groups;
+    std::vector<std::string> group_names;
+    std::vector<std::pair<uint32_t, uint32_t> > pairs;
+    getCoreToCoreCPUPairs(pairs);
+    for (uint32_t p = 0; p < pairs.size(); p++) {
+        std::vector<uint32_t> group;
+        group.push_back(pairs[p].first);
+        group.push_back(pairs[p].second);
+        groups.push_back(group);
+        group_names.push_back(static_cast<std::ostringstream*>(&(std::ostringstream() << "CPU " << pairs[p].first << " + " << pairs[p].second << " (" << cpu_relation_name(get_cpu_relation(pairs[p].first, pairs[p].second)) << ")"))->str());
+    }
+    uint32_t num_threads = config_.getNumWorkerThreads();
+    if (num_threads > 2) {
+        std::vector<uint32_t> cpus;
+        std::vector<uint32_t> cpu_nodes;
+        std::vector<int32_t> relations;
+        getCoreToCoreCPUsByDistance(cpus, cpu_nodes, relations);
+        if (cpus.size() < num_threads) {
+            std::cerr << "ERROR: The false sharing benchmark was asked for " << num_threads << " threads, but there are only " << cpus.size() << " logical CPUs in the selected CPU NUMA nodes." << std::endl;
+            return false;
+        }
+        groups.push_back(std::vector<uint32_t>(cpus.begin(), cpus.begin() + num_threads));
+        group_names.push_back(static_cast<std::ostringstream*>(&(std::ostringstream() << num_threads << " threads (" << cpu_relation_name(static_cast<cpu_relation_t>(relations[num_threads-1])) << ")"))->str());
+    }
+    if (groups.empty()) {
+        std::cerr << "ERROR: The false sharing benchmark needs at least two logical CPUs in the selected CPU NUMA nodes." << std::endl;
+        return false;
+    }
 
-                    for (uint32_t chunk_index = 0; chunk_index < chunks.size(); chunk_index++) { //iterate different chunk sizes
-                        chunk_size_t chunk = chunks[chunk_index];
+    //The words are at the start of the memory region of the first selected memory node
+    uint32_t mem_node = memory_numa_node_affinities_.front();
+    uint8_t* words = reinterpret_cast<uint8_t*>(mem_arrays_[mem_node]);
+    std::list<uint32_t> paddings = config_.getFalseSharingPaddings();
+    uint32_t work_per_write = config_.getFalseSharingWork();
+    size_t max_threads = 0;
+    for (uint32_t g = 0; g < groups.size(); g++)
+        max_threads = std::max(max_threads, groups[g].size());
+    if (mem_array_lens_[mem_node] < max_threads * (sizeof(uint64_t) + paddings.back())) {
+        std::cerr << "ERROR: The false sharing benchmark needs " << max_threads * (sizeof(uint64_t) + paddings.back()) << " B of memory for its words. Increase the working set size per thread." << std::endl;
+        return false;
+    }
+    uint32_t iterations = config_.getIterationsPerTest();
 
-                        for (uint32_t stride_index = 0; stride_index < strides.size(); stride_index++) {  //iterate different stride lengths
-                            int32_t stride = strides[stride_index];
-                            
-                            //Add the throughput benchmark
-                            benchmark_name = static_cast<std::ostringstream*>(&(std::ostringstream() << "Test #" << g_test_index << "T (Throughput)"))->str();
-                            tp_benchmarks_.push_back(new ThroughputBenchmark(mem_array,
-                                                                         mem_array_len,
-                                                                         config_.getIterationsPerTest(),
-                                                                         config_.getNumWorkerThreads(),
-                                                                         mem_node,
-                                                                         cpu_node,
-                                                                         SEQUENTIAL,
-                                                                         rw,
-                                                                         chunk,
-                                                                         stride,
-                                                                         dram_power_readers_,
-                                                                         benchmark_name));
-                            if (tp_benchmarks_[tp_benchmarks_.size()-1] == NULL) {
-                                std::cerr << "ERROR: Failed to build a ThroughputBenchmark!" << std::endl;
-                                return false;
-                            }
-        
-                            //Add the latency benchmark
-
-                            //Special case: number of worker threads is 1, only need 1 latency thread in general to do unloaded latency tests.
-                            if (config_.getNumWorkerThreads() > 1 || buildLatBench) {
-                                benchmark_name = static_cast<std::ostringstream*>(&(std::ostringstream() << "Test #" << g_test_index << "L (Latency)"))->str();
-                                lat_benchmarks_.push_back(new LatencyBenchmark(mem_array,
-                                                                                mem_array_len,
-                                                                                config_.getIterationsPerTest(),
-                                                                                config_.getNumWorkerThreads(),
-                                                                                mem_node,
-                                                                                cpu_node,
-                                                                                SEQUENTIAL,
-                                                                                rw,
-                                                                                chunk,
-                                                                                stride,
-                                                                                dram_power_readers_,
-                                                                                benchmark_name));
-                                if (lat_benchmarks_[lat_benchmarks_.size()-1] == NULL) {
-                                    std::cerr << "ERROR: Failed to build a LatencyBenchmark!" << std::endl;
-                                    return false;
-                                }
-                                buildLatBench = false; //Wait for next NUMA combo
-                            }
+    std::cout << std::endl;
+    std::cout << "False sharing: " << groups.size() << " groups of threads, 64-bit words on memory NUMA node " << mem_node << ", " << work_per_write << " iterations of work between writes, about " << FALSE_SHARING_DURATION_MS << " ms per padding and iteration" << std::endl;
 
-                            g_test_index++;
-                        }
+    std::vector<std::vector<double> > throughput_table(groups.size());
+    bool success = true;
+    for (uint32_t g = 0; g < groups.size() && success; g++) {
+        const std::vector<uint32_t>& group = groups[g];
+        std::vector<uint32_t> group_nodes;
+        for (uint32_t t = 0; t < group.size(); t++)
+            group_nodes.push_back(getCPUNumaNode(group[t]));
+
+        for (auto pad_it = paddings.cbegin(); pad_it != paddings.cend() && success; pad_it++) {
+            uint32_t padding = *pad_it;
+            size_t spacing = sizeof(uint64_t) + padding;
+            std::string benchmark_name = static_cast<std::ostringstream*>(&(std::ostringstream() << "Test #" << g_test_index++ << "F (False Sharing)"))->str();
+            std::vector<double> throughput_on_iter;
+            std::vector<double> latency_on_iter;
+            bool warning = false;
+
+            for (uint32_t iter = 0; iter < iterations; iter++) {
+                std::atomic<uint32_t> arrived(0);
+                std::vector<FalseSharingWorker*> workers;
+                std::vector<Thread*> worker_threads;
+                for (uint32_t t = 0; t < group.size(); t++) {
+                    workers.push_back(new FalseSharingWorker(words + t * spacing, work_per_write, &arrived, static_cast<uint32_t>(group.size()), group[t]));
+                    worker_threads.push_back(new Thread(workers[t]));
+                }
+
+                for (uint32_t t = 0; t < group.size(); t++) {
+                    if (!worker_threads[t]->create_and_start()) {
+                        std::cerr << "ERROR: Failed to start the false sharing worker threads." << std::endl;
+                        arrived.fetch_add(1); //Stand in for the worker that did not start, so that the others do not wait for it forever
+                        success = false;
                     }
                 }
+                for (uint32_t t = 0; t < group.size(); t++) {
+                    if (!worker_threads[t]->join())
+                        std::cerr << "WARNING: A worker thread failed to complete correctly!" << std::endl;
+                }
+
+                //Each thread ran for about the same time, so their rates add up
+                double throughput = 0;
+                double latency = 0;
+                for (uint32_t t = 0; t < group.size(); t++) {
+                    double thread_throughput = workers[t]->getWriteThroughput();
+                    throughput += thread_throughput;
+                    if (thread_throughput > 0)
+                        latency += 1e3 / thread_throughput; //ns/write
+                    if (workers[t]->hadWarning())
+                        warning = true;
+                    delete worker_threads[t];
+                    delete workers[t];
+                }
+                if (!success)
+                    break;
+                throughput_on_iter.push_back(throughput);
+                latency_on_iter.push_back(latency / group.size());
             }
-            
-            if (config_.useRandomAccessPattern()) {
-                //DO RANDOM TESTS
-                for (uint32_t rw_index = 0; rw_index < rws.size(); rw_index++) { //iterate read/write access types
-                    rw_mode_t rw = rws[rw_index];
+            if (!success)
+                break;
+
+            std::vector<double> sorted_throughput = throughput_on_iter;
+            std::vector<double> sorted_latency = latency_on_iter;
+            std::sort(sorted_throughput.begin(), sorted_throughput.end());
+            std::sort(sorted_latency.begin(), sorted_latency.end());
+            double median_throughput = sorted_throughput[sorted_throughput.size()/2];
+            double median_latency = sorted_latency[sorted_latency.size()/2];
+            throughput_table[g].push_back(median_throughput);
+
+            std::printf("%s    %s, %u B padding (%lu per %u B line): %0.1f Mwrites/s, %0.1f ns/write", benchmark_name.c_str(), group_names[g].c_str(), padding, static_cast<unsigned long>(spacing >= CACHE_LINE_SIZE ? 1 : CACHE_LINE_SIZE / spacing), CACHE_LINE_SIZE, median_throughput, median_latency);
+            if (warning)
+                std::printf(" (WARNING)");
+            std::printf("\n");
+            std::fflush(stdout);
+
+            std::string notes = static_cast<std::ostringstream*>(&(std::ostringstream() << group_names[g] << "; " << padding << " B padding between 64-bit words; " << work_per_write << " iterations of work between writes"))->str();
+            writeWorkerResults(benchmark_name, 0, static_cast<uint32_t>(group.size()), mem_node, join_numa_nodes(group_nodes), throughput_on_iter, "Mwrites/s", latency_on_iter, "ns/write", notes);
+        }
+    }
+    if (!success)
+        return false;
 
-                    for (uint32_t chunk_index = 0; chunk_index < chunks.size(); chunk_index++) { //iterate different chunk sizes
-                        chunk_size_t chunk = chunks[chunk_index];
+    //The largest padding is the reference for how much throughput sharing lines costs
+    std::cout << std::endl;
+    std::cout << "*** FALSE SHARING ***" << std::endl;
+    for (uint32_t table = 0; table < 2; table++) {
+        std::cout << std::endl;
+        if (table == 0)
+            std::cout << "Aggregate write throughput by padding in B, Mwrites/s:" << std::endl;
+        else
+            std::cout << "Write throughput by padding in B, % of the " << paddings.back() << " B padding throughput:" << std::endl;
+        std::printf("    %-40s", "Threads");
+        for (auto pad_it = paddings.cbegin(); pad_it != paddings.cend(); pad_it++)
+            std::printf(" %9u", *pad_it);
+        std::printf("\n");
+        for (uint32_t g = 0; g < groups.size(); g++) {
+            std::printf("    %-40s", group_names[g].c_str());
+            for (uint32_t i = 0; i < throughput_table[g].size(); i++) {
+                if (table == 0)
+                    std::printf(" %9.1f", throughput_table[g][i]);
+                else
+                    std::printf(" %8.1f%%", throughput_table[g].back() > 0 ? 100 * throughput_table[g][i] / throughput_table[g].back() : 0);
+            }
+            std::printf("\n");
+        }
+    }
+    std::cout << std::endl;
 
-                        if (chunk == CHUNK_32b) //Special case: random load workers cannot use 32-bit chunks, so skip this benchmark combination
-                            continue;
-                        
-                        //Add the throughput benchmark
-                        benchmark_name = static_cast<std::ostringstream*>(&(std::ostringstream() << "Test #" << g_test_index << "T (Throughput)"))->str();
-                        tp_benchmarks_.push_back(new ThroughputBenchmark(mem_array,
-                                                                          mem_array_len,
-                                                                          config_.getIterationsPerTest(),
-                                                                          config_.getNumWorkerThreads(),
-                                                                          mem_node,
-                                                                          cpu_node,
-                                                                          RANDOM,
-                                                                          rw,
-                                                                          chunk,
-                                                                          0,
-                                                                          dram_power_readers_,
-                                                                          benchmark_name));
-                        if (tp_benchmarks_[tp_benchmarks_.size()-1] == NULL) {
-                            std::cerr << "ERROR: Failed to build a ThroughputBenchmark!" << std::endl;
+    return true;
+}
+
+bool BenchmarkManager::runFlushBenchmark() {
+    std::list<flush_op_t> flush_ops = config_.getFlushOps();
+
+    std::cout << std::endl;
+    std::cout << "Cache flush: clean and dirty lines, unfenced for throughput and fenced after every line for latency, about " << FLUSH_BENCHMARK_DURATION_MS << " ms per measurement and iteration" << std::endl;
+
+    return runWorkerPlacements("cache flush", [&](uint32_t mem_node, uint8_t* mem_array, uint32_t cpu_node, const std::vector<int32_t>& cpus, size_t working_set_size) -> bool {
+        uint32_t num_threads = static_cast<uint32_t>(cpus.size());
+        if (working_set_size % 4096 != 0) { //the flush kernels work on whole 4 KB blocks
+            std::cerr << "WARNING: The cache flush benchmark needs working set sizes that are multiples of 4 KB. Skipping " << working_set_size << " B." << std::endl;
+            return true;
+        }
+
+        for (auto op_it = flush_ops.cbegin(); op_it != flush_ops.cend(); op_it++) { //iterate flush instructions
+            flush_op_t flush_op = *op_it;
+
+            for (uint32_t dirty = 0; dirty < 2; dirty++) { //clean, then dirty lines
+                std::string benchmark_name = static_cast<std::ostringstream*>(&(std::ostringstream() << "Test #" << g_test_index++ << "X (Cache Flush)"))->str();
+                std::vector<std::vector<double> > throughput_metrics;
+                std::vector<std::vector<double> > latency_metrics;
+                bool warning = false;
+
+                //The unfenced run gives the aggregate throughput, and the fenced run gives the latency of a single flush
+                for (uint32_t fenced = 0; fenced < 2; fenced++) {
+                    auto create_worker = [&](uint32_t t, std::atomic<uint32_t>* arrived) -> MemoryWorker* {
+                        return new FlushWorker(mem_array + t * working_set_size, working_set_size, flush_op, dirty == 1, fenced == 1, arrived, num_threads, cpus[t]);
+                    };
+                    auto get_metrics = [&](MemoryWorker* worker) -> std::vector<double> {
+                        FlushWorker* flush_worker = static_cast<FlushWorker*>(worker);
+                        return std::vector<double>(1, fenced ? flush_worker->getMeanLineFlushTime() : flush_worker->getFlushThroughput());
+                    };
+                    if (!runWorkers("cache flush", cpus, create_worker, get_metrics, fenced ? 0 : 1, fenced ? latency_metrics : throughput_metrics, warning))
+                        return false;
+                }
+                const std::vector<double>& throughput_on_iter = throughput_metrics[0];
+                const std::vector<double>& latency_on_iter = latency_metrics[0];
+
+                std::printf("%s    %s, %s lines, %lu KB x %u threads, CPU node %u, memory node %u: %0.1f MB/s, %0.2f ns/line", benchmark_name.c_str(), flush_op_name(flush_op).c_str(), dirty ? "dirty" : "clean", static_cast<unsigned long>(working_set_size / KB), num_threads, cpu_node, mem_node, median_metric(throughput_on_iter), median_metric(latency_on_iter));
+                if (warning)
+                    std::printf(" (WARNING)");
+                std::printf("\n");
+                std::fflush(stdout);
+
+                std::string notes = static_cast<std::ostringstream*>(&(std::ostringstream() << flush_op_name(flush_op) << "; " << (dirty ? "dirty" : "clean") << " lines; throughput unfenced; latency fenced after every line"))->str();
+                writeWorkerResults(benchmark_name, working_set_size, num_threads, mem_node, static_cast<std::ostringstream*>(&(std::ostringstream() << cpu_node))->str(), throughput_on_iter, "MB/s", latency_on_iter, "ns/line", notes);
+            }
+        }
+        return true;
+    });
+}
+
+bool BenchmarkManager::runCopyBenchmark() {
+    //Each size setting is either one fixed size or a sequence drawn from the size distribution
+    std::vector<std::vector<size_t> > size_sequences;
+    std::vector<std::string> size_names;
+    std::list<size_t> sizes = config_.getCopySizes();
+    for (auto it = sizes.cbegin(); it != sizes.cend(); it++) {
+        size_sequences.push_back(std::vector<size_t>(1, *it));
+        size_names.push_back(static_cast<std::ostringstream*>(&(std::ostringstream() << *it << " B"))->str());
+    }
+    const CopySizeDistribution& distribution = config_.getCopySizeDistribution();
+    if (!distribution.isEmpty()) {
+        size_sequences.push_back(distribution.sample(COPY_SIZE_SEQUENCE_LENGTH, 1));
+        size_names.push_back(static_cast<std::ostringstream*>(&(std::ostringstream() << "distribution (mean " << static_cast<uint64_t>(distribution.getMeanSize()) << " B)"))->str());
+    }
+
+    std::vector<copy_engine_t> engines;
+    std::list<copy_engine_t> engine_list = config_.getCopyEngines();
+    engines.assign(engine_list.begin(), engine_list.end());
+    if (engines.empty() || size_sequences.empty()) {
+        std::cerr << "ERROR: The copy/fill benchmark needs at least one engine and one call size." << std::endl;
+        return false;
+    }
+
+    //The source buffer is the first half of the working set on its node and the destination buffer is the second half on its node, so they never overlap
+    size_t buffer_len = config_.getWorkingSetSizePerThread() / 2;
+#ifdef USE_TSC_TIMER
+    std::string call_units = "cycles/call";
+    double call_scale = 1;
+#else
+    std::string call_units = "ns/call";
+    double call_scale = g_ns_per_tick;
+#endif
+
+    std::cout << std::endl;
+    std::cout << "Copy/fill: one thread, " << buffer_len << " B source and destination buffers, about " << COPY_BENCHMARK_DURATION_MS << " ms per engine, size setting, placement, and iteration" << std::endl;
+
+    for (auto cpu_node_it = cpu_numa_node_affinities_.cbegin(); cpu_node_it != cpu_numa_node_affinities_.cend(); cpu_node_it++) { //iterate each CPU NUMA node
+        uint32_t cpu_node = *cpu_node_it;
+        int32_t cpu = cpu_id_in_numa_node(cpu_node, 0);
+        if (cpu < 0) {
+            std::cerr << "ERROR: CPU NUMA node " << cpu_node << " has no logical CPUs." << std::endl;
+            return false;
+        }
+
+        for (auto src_node_it = memory_numa_node_affinities_.cbegin(); src_node_it != memory_numa_node_affinities_.cend(); src_node_it++) { //iterate each source memory NUMA node
+            uint32_t src_node = *src_node_it;
+            uint8_t* src = reinterpret_cast<uint8_t*>(mem_arrays_[src_node]);
+
+            for (auto dst_node_it = memory_numa_node_affinities_.cbegin(); dst_node_it != memory_numa_node_affinities_.cend(); dst_node_it++) { //iterate each destination memory NUMA node
+                uint32_t dst_node = *dst_node_it;
+                uint8_t* dst = reinterpret_cast<uint8_t*>(mem_arrays_[dst_node]) + buffer_len;
+                bool first_src_node = (src_node_it == memory_numa_node_affinities_.cbegin());
+
+                //Throughput of each size setting and engine for the summary of this placement, or -1 if not run
+                std::vector<std::vector<double> > throughput_table(size_sequences.size(), std::vector<double>(engines.size(), -1));
+                std::vector<std::vector<double> > call_table(size_sequences.size(), std::vector<double>(engines.size(), -1));
+
+                for (uint32_t e = 0; e < engines.size(); e++) { //iterate engines
+                    copy_engine_t engine = engines[e];
+                    bool fill = copy_engine_is_fill(engine);
+                    if (fill && !first_src_node) //Fills have no source, so run them once per destination node
+                        continue;
+
+                    for (uint32_t size_index = 0; size_index < size_sequences.size(); size_index++) { //iterate size settings
+                        std::string benchmark_name = static_cast<std::ostringstream*>(&(std::ostringstream() << "Test #" << g_test_index++ << "M (Copy/Fill)"))->str();
+                        std::vector<std::vector<double> > metrics_on_iter;
+                        bool warning = false;
+                        auto create_worker = [&](uint32_t t, std::atomic<uint32_t>* arrived) -> MemoryWorker* {
+                            return new CopyWorker(dst, src, buffer_len, size_sequences[size_index], engine, cpu);
+                        };
+                        auto get_metrics = [&](MemoryWorker* worker) -> std::vector<double> {
+                            CopyWorker* copy_worker = static_cast<CopyWorker*>(worker);
+                            std::vector<double> metrics;
+                            metrics.push_back(copy_worker->getCopyThroughput());
+                            metrics.push_back(copy_worker->getMeanCallTicks() * call_scale);
+                            return metrics;
+                        };
+                        if (!runWorkers("copy/fill", std::vector<int32_t>(1, cpu), create_worker, get_metrics, 1, metrics_on_iter, warning))
                             return false;
-                        }
-                            
-                        //Add the latency benchmark
-                        //Special case: number of worker threads is 1, only need 1 latency thread in general to do unloaded latency tests.
-                        if (config_.getNumWorkerThreads() > 1 || buildLatBench) {
-                            benchmark_name = static_cast<std::ostringstream*>(&(std::ostringstream() << "Test #" << g_test_index << "L (Latency)"))->str();
-                            lat_benchmarks_.push_back(new LatencyBenchmark(mem_array,
-                                                                            mem_array_len,
-                                                                            config_.getIterationsPerTest(),
-                                                                            config_.getNumWorkerThreads(),
-                                                                            mem_node,
-                                                                            cpu_node,
-                                                                            RANDOM,
-                                                                            rw,
-                                                                            chunk,
-                                                                            0,
-                                                                            dram_power_readers_,
-                                                                            benchmark_name));
-                            if (lat_benchmarks_[lat_benchmarks_.size()-1] == NULL) {
-                                std::cerr << "ERROR: Failed to build a LatencyBenchmark!" << std::endl;
-                                return false;
+                        const std::vector<double>& throughput_on_iter = metrics_on_iter[0];
+                        const std::vector<double>& call_on_iter = metrics_on_iter[1];
+                        throughput_table[size_index][e] = median_metric(throughput_on_iter);
+                        call_table[size_index][e] = median_metric(call_on_iter);
+
+                        std::string placement;
+                        if (fill)
+                            placement = static_cast<std::ostringstream*>(&(std::ostringstream() << "CPU node " << cpu_node << ", dst node " << dst_node))->str();
+                        else
+                            placement = static_cast<std::ostringstream*>(&(std::ostringstream() << "CPU node " << cpu_node << ", src node " << src_node << " -> dst node " << dst_node))->str();
+                        std::printf("%s    %s, %s, %s: %0.1f MB/s, %0.1f %s", benchmark_name.c_str(), copy_engine_name(engine).c_str(), size_names[size_index].c_str(), placement.c_str(), throughput_table[size_index][e], call_table[size_index][e], call_units.c_str());
+                        if (warning)
+                            std::printf(" (WARNING)");
+                        std::printf("\n");
+                        std::fflush(stdout);
+
+                        std::string notes = static_cast<std::ostringstream*>(&(std::ostringstream() << copy_engine_name(engine) << "; " << size_names[size_index] << "; " << (fill ? std::string("fill") : static_cast<std::ostringstream*>(&(std::ostringstream() << "copy from memory node " << src_node))->str()) << "; " << buffer_len << " B buffers"))->str();
+                        writeWorkerResults(benchmark_name, buffer_len, 1, dst_node, static_cast<std::ostringstream*>(&(std::ostringstream() << cpu_node))->str(), throughput_on_iter, "MB/s", call_on_iter, call_units, notes);
+                    }
+                }
+
+                //Summarize which engine is fastest for each size setting at this placement
+                std::cout << std::endl;
+                std::cout << "*** COPY/FILL: CPU node " << cpu_node << ", src node " << src_node << " -> dst node " << dst_node << " ***" << std::endl;
+                for (uint32_t table = 0; table < 2; table++) {
+                    std::cout << std::endl;
+                    if (table == 0)
+                        std::cout << "Throughput by engine, MB/s:" << std::endl;
+                    else
+                        std::cout << "Cost per call by engine, " << call_units << ":" << std::endl;
+                    std::printf("    %-32s", "Size");
+                    for (uint32_t e = 0; e < engines.size(); e++)
+                        std::printf(" %14s", copy_engine_name(engines[e]).c_str());
+                    if (table == 0)
+                        std::printf("   %s", "Fastest copy / fill");
+                    std::printf("\n");
+                    for (uint32_t size_index = 0; size_index < size_sequences.size(); size_index++) {
+                        std::printf("    %-32s", size_names[size_index].c_str());
+                        int32_t best_copy = -1;
+                        int32_t best_fill = -1;
+                        for (uint32_t e = 0; e < engines.size(); e++) {
+                            double value = (table == 0) ? throughput_table[size_index][e] : call_table[size_index][e];
+                            if (value < 0) {
+                                std::printf(" %14s", "-");
+                                continue;
                             }
-                            
-                            buildLatBench = false; //Wait for next NUMA combo
+                            std::printf(" %14.1f", value);
+                            int32_t& best = copy_engine_is_fill(engines[e]) ? best_fill : best_copy;
+                            if (best < 0 || throughput_table[size_index][e] > throughput_table[size_index][best])
+                                best = e;
                         }
-
-                        g_test_index++;
+                        if (table == 0)
+                            std::printf("   %s / %s", best_copy < 0 ? "-" : copy_engine_name(engines[best_copy]).c_str(), best_fill < 0 ? "-" : copy_engine_name(engines[best_fill]).c_str());
+                        std::printf("\n");
                     }
                 }
+                std::cout << std::endl;
             }
         }
     }
-    
-    built_benchmarks_ = true;
+
     return true;
 }
 
+bool BenchmarkManager::runGatherBenchmark() {
+    std::list<gather_engine_t> engine_list = config_.getGatherEngines();
+    std::vector<gather_engine_t> engines(engine_list.begin(), engine_list.end());
+    std::list<gather_index_t> pattern_list = config_.getGatherIndexPatterns();
+    std::vector<gather_index_t> patterns(pattern_list.begin(), pattern_list.end());
+    size_t stride = config_.getGatherStride();
+    size_t window_elements = config_.getGatherWindowSize() / sizeof(Word64_t);
+
+    //Name each index pattern with its parameter, for reports
+    std::vector<std::string> pattern_names;
+    for (uint32_t p = 0; p < patterns.size(); p++) {
+        if (patterns[p] == GATHER_INDEX_STRIDED)
+            pattern_names.push_back(static_cast<std::ostringstream*>(&(std::ostringstream() << "strided " << stride))->str());
+        else if (patterns[p] == GATHER_INDEX_WINDOW)
+            pattern_names.push_back(static_cast<std::ostringstream*>(&(std::ostringstream() << "window " << config_.getGatherWindowSize() << " B"))->str());
+        else
+            pattern_names.push_back(gather_index_name(patterns[p]));
+    }
+
+    std::cout << std::endl;
+    std::cout << "Gather/scatter: 64-bit elements with 32-bit indices, about " << GATHER_BENCHMARK_DURATION_MS << " ms per engine, index pattern, and iteration. Effective bandwidth counts 8 B per element and excludes the index loads." << std::endl;
+
+    return runWorkerPlacements("gather/scatter", [&](uint32_t mem_node, uint8_t* mem_array, uint32_t cpu_node, const std::vector<int32_t>& cpus, size_t working_set_size) -> bool {
+        uint32_t num_threads = static_cast<uint32_t>(cpus.size());
+
+        //Each thread's working set holds the elements followed by one 32-bit index per element. The element count is a multiple of the vector width and of the stride.
+        size_t num_elements = working_set_size / (sizeof(Word64_t) + sizeof(uint32_t));
+        num_elements -= num_elements % (8 * stride);
+        if (num_elements == 0) {
+            std::cerr << "WARNING: The gather/scatter benchmark needs room for at least " << 8 * stride << " elements and their indices. Skipping " << working_set_size << " B." << std::endl;
+            return true;
+        }
+        if (num_elements > 0x80000000) { //Vector gathers sign-extend their 32-bit indices
+            std::cerr << "WARNING: The gather/scatter benchmark supports at most 2^31 elements per thread. Skipping " << working_set_size << " B." << std::endl;
+            return true;
+        }
+
+        std::vector<std::vector<double> > elem_table(patterns.size(), std::vector<double>(engines.size(), -1)); //Median Melem/s for each pattern and engine
+        std::vector<uint32_t> indices(num_elements);
+
+        for (uint32_t p = 0; p < patterns.size(); p++) { //iterate index patterns
+            if (!build_gather_indices(indices.data(), num_elements, patterns[p], stride, window_elements))
+                return false;
+            for (uint32_t t = 0; t < num_threads; t++)
+                std::memcpy(mem_array + t * working_set_size + num_elements * sizeof(Word64_t), indices.data(), num_elements * sizeof(uint32_t));
+
+            for (uint32_t e = 0; e < engines.size(); e++) { //iterate engines
+                gather_engine_t engine = engines[e];
+                std::string benchmark_name = static_cast<std::ostringstream*>(&(std::ostringstream() << "Test #" << g_test_index++ << "G (Gather/Scatter)"))->str();
+                std::vector<std::vector<double> > metrics_on_iter;
+                bool warning = false;
+
+                auto create_worker = [&](uint32_t t, std::atomic<uint32_t>*) -> MemoryWorker* {
+                    uint8_t* region = mem_array + t * working_set_size;
+                    return new GatherWorker(region, reinterpret_cast<uint32_t*>(region + num_elements * sizeof(Word64_t)), num_elements, engine, cpus[t]);
+                };
+                auto get_metrics = [](MemoryWorker* worker) -> std::vector<double> {
+                    GatherWorker* gather_worker = static_cast<GatherWorker*>(worker);
+                    std::vector<double> metrics;
+                    metrics.push_back(gather_worker->getElementThroughput());
+                    metrics.push_back(gather_worker->getMeanElementLatency());
+                    return metrics;
+                };
+                if (!runWorkers("gather/scatter", cpus, create_worker, get_metrics, 1, metrics_on_iter, warning))
+                    return false;
+                const std::vector<double>& elem_on_iter = metrics_on_iter[0];
+                const std::vector<double>& latency_on_iter = metrics_on_iter[1];
+                std::vector<double> bandwidth_on_iter;
+                for (uint32_t iter = 0; iter < elem_on_iter.size(); iter++)
+                    bandwidth_on_iter.push_back(elem_on_iter[iter] * 1e6 * sizeof(Word64_t) / MB);
+                elem_table[p][e] = median_metric(elem_on_iter);
+
+                std::printf("%s    %s, %s indices, %lu KB x %u threads, CPU node %u, memory node %u: %0.1f Melem/s, %0.1f MB/s, %0.3f ns/element", benchmark_name.c_str(), gather_engine_name(engine).c_str(), pattern_names[p].c_str(), static_cast<unsigned long>(working_set_size / KB), num_threads, cpu_node, mem_node, elem_table[p][e], median_metric(bandwidth_on_iter), median_metric(latency_on_iter));
+                if (warning)
+                    std::printf(" (WARNING)");
+                std::printf("\n");
+                std::fflush(stdout);
+
+                std::string notes = static_cast<std::ostringstream*>(&(std::ostringstream() << gather_engine_name(engine) << "; " << pattern_names[p] << " indices; " << num_elements << " elements per thread; " << elem_table[p][e] << " Melem/s"))->str();
+                writeWorkerResults(benchmark_name, working_set_size, num_threads, mem_node, static_cast<std::ostringstream*>(&(std::ostringstream() << cpu_node))->str(), bandwidth_on_iter, "MB/s", latency_on_iter, "ns/element", notes);
+            }
+        }
+
+        //Summarize how the vector engines compare to scalar accesses for each index pattern
+        int32_t scalar_load = -1;
+        int32_t scalar_store = -1;
+        for (uint32_t e = 0; e < engines.size(); e++) {
+            if (engines[e] == GATHER_SCALAR)
+                scalar_load = e;
+            else if (engines[e] == SCATTER_SCALAR)
+                scalar_store = e;
+        }
+
+        std::cout << std::endl;
+        std::cout << "*** GATHER/SCATTER: " << working_set_size / KB << " KB x " << num_threads << " threads, CPU node " << cpu_node << ", memory node " << mem_node << " ***" << std::endl;
+        std::cout << std::endl;
+        std::cout << "Element throughput by engine, Melem/s, and speedup of the best vector engine over scalar accesses:" << std::endl;
+        std::printf("    %-20s", "Indices");
+        for (uint32_t e = 0; e < engines.size(); e++)
+            std::printf(" %14s", gather_engine_name(engines[e]).c_str());
+        std::printf("   %s\n", "Gather / scatter speedup");
+        for (uint32_t p = 0; p < patterns.size(); p++) {
+            std::printf("    %-20s", pattern_names[p].c_str());
+            double best_gather = -1;
+            double best_scatter = -1;
+            for (uint32_t e = 0; e < engines.size(); e++) {
+                std::printf(" %14.1f", elem_table[p][e]);
+                if (engines[e] == GATHER_SCALAR || engines[e] == SCATTER_SCALAR)
+                    continue;
+                double& best = gather_engine_is_scatter(engines[e]) ? best_scatter : best_gather;
+                if (elem_table[p][e] > best)
+                    best = elem_table[p][e];
+            }
+            char gather_speedup[32] = "-";
+            char scatter_speedup[32] = "-";
+            if (best_gather > 0 && scalar_load >= 0 && elem_table[p][scalar_load] > 0)
+                std::snprintf(gather_speedup, sizeof(gather_speedup), "%0.2fx", best_gather / elem_table[p][scalar_load]);
+            if (best_scatter > 0 && scalar_store >= 0 && elem_table[p][scalar_store] > 0)
+                std::snprintf(scatter_speedup, sizeof(scatter_speedup), "%0.2fx", best_scatter / elem_table[p][scalar_store]);
+            std::printf("   %s / %s\n", gather_speedup, scatter_speedup);
+        }
+        std::cout << std::endl;
+        return true;
+    });
+}
+
+bool BenchmarkManager::runMultiStreamBenchmark() {
+    std::list<uint32_t> count_list = config_.getStreamCounts();
+    std::vector<uint32_t> stream_counts(count_list.begin(), count_list.end());
+
+    std::cout << std::endl;
+    std::cout << "Multi-stream: sequential reads of whole cache lines from each stream in turn, forward and reverse, about " << MULTI_STREAM_BENCHMARK_DURATION_MS << " ms per stream count, direction, and iteration" << std::endl;
+
+    return runWorkerPlacements("multi-stream", [&](uint32_t mem_node, uint8_t* mem_array, uint32_t cpu_node, const std::vector<int32_t>& cpus, size_t working_set_size) -> bool {
+        uint32_t num_threads = static_cast<uint32_t>(cpus.size());
+        std::vector<std::vector<double> > throughput_table(stream_counts.size(), std::vector<double>(2, -1)); //Median MB/s for each stream count, forward and reverse
+
+        for (uint32_t count_index = 0; count_index < stream_counts.size(); count_index++) { //iterate stream counts
+            uint32_t num_streams = stream_counts[count_index];
+            size_t stream_len = (working_set_size / num_streams) / CACHE_LINE_SIZE * CACHE_LINE_SIZE;
+            if (stream_len == 0) {
+                std::cerr << "WARNING: A " << working_set_size << " B working set is too small for " << num_streams << " streams of whole cache lines. Skipping." << std::endl;
+                continue;
+            }
+
+            for (uint32_t reverse = 0; reverse < 2; reverse++) { //forward, then reverse
+                std::string benchmark_name = static_cast<std::ostringstream*>(&(std::ostringstream() << "Test #" << g_test_index++ << "K (Multi-Stream)"))->str();
+                std::vector<std::vector<double> > metrics_on_iter;
+                bool warning = false;
+
+                auto create_worker = [&](uint32_t t, std::atomic<uint32_t>*) -> MemoryWorker* {
+                    return new MultiStreamWorker(mem_array + t * working_set_size, stream_len, num_streams, reverse == 1, cpus[t]);
+                };
+                auto get_metrics = [](MemoryWorker* worker) -> std::vector<double> {
+                    return std::vector<double>(1, static_cast<MultiStreamWorker*>(worker)->getThroughput());
+                };
+                if (!runWorkers("multi-stream", cpus, create_worker, get_metrics, 1, metrics_on_iter, warning))
+                    return false;
+                const std::vector<double>& throughput_on_iter = metrics_on_iter[0];
+                throughput_table[count_index][reverse] = median_metric(throughput_on_iter);
+
+                std::printf("%s    %u streams, %s, %lu KB x %u threads, CPU node %u, memory node %u: %0.1f MB/s", benchmark_name.c_str(), num_streams, reverse ? "reverse" : "forward", static_cast<unsigned long>(working_set_size / KB), num_threads, cpu_node, mem_node, throughput_table[count_index][reverse]);
+                if (warning)
+                    std::printf(" (WARNING)");
+                std::printf("\n");
+                std::fflush(stdout);
+
+                std::string notes = static_cast<std::ostringstream*>(&(std::ostringstream() << num_streams << " streams; " << (reverse ? "reverse" : "forward") << "; " << stream_len << " B per stream"))->str();
+                writeWorkerResults(benchmark_name, working_set_size, num_threads, mem_node, static_cast<std::ostringstream*>(&(std::ostringstream() << cpu_node))->str(), throughput_on_iter, "MB/s", std::vector<double>(), "", notes);
+            }
+        }
+
+        //Summarize bandwidth vs. stream count, and find where it falls well below the best bandwidth at fewer streams
+        std::cout << std::endl;
+        std::cout << "*** MULTI-STREAM: " << working_set_size / KB << " KB x " << num_threads << " threads, CPU node " << cpu_node << ", memory node " << mem_node << " ***" << std::endl;
+        std::cout << std::endl;
+        std::printf("    %-10s %14s %14s\n", "Streams", "Forward MB/s", "Reverse MB/s");
+        int32_t cliff[2] = { -1, -1 };
+        double best[2] = { 0, 0 };
+        for (uint32_t count_index = 0; count_index < stream_counts.size(); count_index++) {
+            std::printf("    %-10u", stream_counts[count_index]);
+            for (uint32_t reverse = 0; reverse < 2; reverse++) {
+                double value = throughput_table[count_index][reverse];
+                if (value < 0) {
+                    std::printf(" %14s", "-");
+                    continue;
+                }
+                std::printf(" %14.1f", value);
+                if (cliff[reverse] < 0 && best[reverse] > 0 && value < (1 - MULTI_STREAM_CLIFF_DROP) * best[reverse])
+                    cliff[reverse] = static_cast<int32_t>(stream_counts[count_index]);
+                if (value > best[reverse])
+                    best[reverse] = value;
+            }
+            std::printf("\n");
+        }
+        std::cout << std::endl;
+        for (uint32_t reverse = 0; reverse < 2; reverse++) {
+            std::cout << "Stream-tracking cliff, " << (reverse ? "reverse" : "forward") << ": ";
+            if (cliff[reverse] < 0)
+                std::cout << "none found";
+            else
+                std::cout << cliff[reverse] << " streams, more than " << static_cast<int32_t>(MULTI_STREAM_CLIFF_DROP * 100) << "% below the best throughput at fewer streams";
+            std::cout << std::endl;
+        }
+        std::cout << std::endl;
+        return true;
+    });
+}
+
+bool BenchmarkManager::runUnalignedBenchmark() {
+    //Only the chunk sizes of the load settings are used
+    std::vector<rw_mode_t> rws;
+    std::vector<chunk_size_t> chunks;
+    std::vector<int32_t> strides;
+    getConcurrentLoadSettings(rws, chunks, strides);
+    std::list<size_t> offset_list = config_.getUnalignedOffsets();
+    std::vector<size_t> offsets(offset_list.begin(), offset_list.end());
+    const char* measurement_names[3] = { "sequential read", "sequential write", "pointer chasing" };
+
+    std::cout << std::endl;
+    std::cout << "Unaligned access: sequential read and write throughput and pointer chasing latency at byte offsets from a cache line boundary, about " << UNALIGNED_BENCHMARK_DURATION_MS << " ms per measurement and iteration" << std::endl;
+
+    return runWorkerPlacements("unaligned access", [&](uint32_t mem_node, uint8_t* mem_array, uint32_t cpu_node, const std::vector<int32_t>& cpus, size_t working_set_size) -> bool {
+        uint32_t num_threads = static_cast<uint32_t>(cpus.size());
+        if (working_set_size < 8192 || working_set_size % 4096 != 0) { //the kernels work on whole 4 KB blocks, and one block makes room for the offset
+            std::cerr << "WARNING: The unaligned access benchmark needs working set sizes of at least 8 KB that are multiples of 4 KB. Skipping " << working_set_size << " B." << std::endl;
+            return true;
+        }
+
+        for (uint32_t chunk_index = 0; chunk_index < chunks.size(); chunk_index++) { //iterate chunk sizes
+            chunk_size_t chunk = chunks[chunk_index];
+            size_t chunk_bytes = chunk_size_bytes(chunk);
+            SequentialFunction seq_kernel = NULL;
+            SequentialFunction seq_dummy_kernel = NULL;
+            if (!determine_unaligned_kernel(READ, chunk, &seq_kernel, &seq_dummy_kernel)) {
+                std::cerr << "WARNING: Unaligned access kernels are not available for " << chunk_bytes * 8 << "-bit chunks. Skipping." << std::endl;
+                continue;
+            }
+            RandomFunction ran_kernel = NULL;
+            RandomFunction ran_dummy_kernel = NULL;
+            bool chase_available = determine_unaligned_random_kernel(chunk, &ran_kernel, &ran_dummy_kernel);
+
+            std::vector<std::vector<double> > table(offsets.size(), std::vector<double>(3, -1)); //Median read MB/s, write MB/s, and chase ns for each offset
+
+            for (uint32_t offset_index = 0; offset_index < offsets.size(); offset_index++) { //iterate offsets
+                size_t offset = offsets[offset_index];
+
+                //Share of accesses that straddle a cache line or a page. Sequential accesses that are not a multiple of the chunk size off alignment split once per line and once per page. Chased nodes split when they do not fit before the next line, and 1 in 64 of those lines ends a page.
+                bool seq_split = (offset % chunk_bytes) != 0;
+                bool chase_split = offset + chunk_bytes > CACHE_LINE_SIZE;
+                double seq_line_split = seq_split ? static_cast<double>(chunk_bytes) / CACHE_LINE_SIZE : 0;
+                double seq_page_split = seq_split ? static_cast<double>(chunk_bytes) / 4096 : 0;
+                double chase_line_split = chase_split ? 1 : 0;
+                double chase_page_split = chase_split ? static_cast<double>(CACHE_LINE_SIZE) / 4096 : 0;
+
+                for (uint32_t measurement = 0; measurement < 3; measurement++) { //read, write, then pointer chasing
+                    bool chase = (measurement == 2);
+                    if (chase && !chase_available)
+                        continue;
+
+                    std::string benchmark_name = static_cast<std::ostringstream*>(&(std::ostringstream() << "Test #" << g_test_index++ << "U (Unaligned)"))->str();
+                    std::vector<std::vector<double> > metrics_on_iter;
+                    bool warning = false;
+
+                    auto create_worker = [&](uint32_t t, std::atomic<uint32_t>*) -> MemoryWorker* {
+                        return new UnalignedWorker(mem_array + t * working_set_size, working_set_size, measurement == 1 ? WRITE : READ, chunk, offset, chase, cpus[t]);
+                    };
+                    auto get_metrics = [&](MemoryWorker* worker) -> std::vector<double> {
+                        UnalignedWorker* unaligned_worker = static_cast<UnalignedWorker*>(worker);
+                        return std::vector<double>(1, chase ? unaligned_worker->getMeanAccessLatency() : unaligned_worker->getThroughput());
+                    };
+                    if (!runWorkers("unaligned access", cpus, create_worker, get_metrics, chase ? 0 : 1, metrics_on_iter, warning))
+                        return false;
+                    const std::vector<double>& metric_on_iter = metrics_on_iter[0];
+                    table[offset_index][measurement] = median_metric(metric_on_iter);
+
+                    std::printf("%s    %s, %lu-bit chunks, offset %lu B, %lu KB x %u threads, CPU node %u, memory node %u: %0.*f %s", benchmark_name.c_str(), measurement_names[measurement], static_cast<unsigned long>(chunk_bytes * 8), static_cast<unsigned long>(offset), static_cast<unsigned long>(working_set_size / KB), num_threads, cpu_node, mem_node, chase ? 2 : 1, table[offset_index][measurement], chase ? "ns/access" : "MB/s");
+                    if (warning)
+                        std::printf(" (WARNING)");
+                    std::printf("\n");
+                    std::fflush(stdout);
+
+                    std::string notes = static_cast<std::ostringstream*>(&(std::ostringstream() << measurement_names[measurement] << "; " << chunk_bytes * 8 << "-bit chunks; offset " << offset << " B; " << (chase ? chase_line_split : seq_line_split) * 100 << "% line splits; " << (chase ? chase_page_split : seq_page_split) * 100 << "% page splits"))->str();
+                    if (chase)
+                        writeWorkerResults(benchmark_name, working_set_size, num_threads, mem_node, static_cast<std::ostringstream*>(&(std::ostringstream() << cpu_node))->str(), std::vector<double>(), "", metric_on_iter, "ns/access", notes);
+                    else
+                        writeWorkerResults(benchmark_name, working_set_size, num_threads, mem_node, static_cast<std::ostringstream*>(&(std::ostringstream() << cpu_node))->str(), metric_on_iter, "MB/s", std::vector<double>(), "", notes);
+                }
+            }
+
+            //Summarize the penalty of each offset relative to aligned accesses at offset 0, which is always the first one
+            std::cout << std::endl;
+            std::cout << "*** UNALIGNED ACCESS: " << chunk_bytes * 8 << "-bit chunks, " << working_set_size / KB << " KB x " << num_threads << " threads, CPU node " << cpu_node << ", memory node " << mem_node << " ***" << std::endl;
+            std::cout << std::endl;
+            std::printf("    %-8s %12s %9s %12s %9s %12s %9s %14s\n", "Offset", "Read MB/s", "Penalty", "Write MB/s", "Penalty", "Chase ns", "Penalty", "Line splits");
+            for (uint32_t offset_index = 0; offset_index < offsets.size(); offset_index++) {
+                size_t offset = offsets[offset_index];
+                std::printf("    %-8lu", static_cast<unsigned long>(offset));
+                for (uint32_t measurement = 0; measurement < 3; measurement++) {
+                    double value = table[offset_index][measurement];
+                    double aligned = table[0][measurement];
+                    if (value < 0) {
+                        std::printf(" %12s %9s", "-", "-");
+                        continue;
+                    }
+                    std::printf(" %12.*f", measurement == 2 ? 2 : 1, value);
+                    if (aligned > 0 && value > 0) {
+                        double penalty = (measurement == 2) ? (value / aligned - 1) : (aligned / value - 1); //Extra time per access
+                        std::printf(" %+8.1f%%", penalty * 100);
+                    } else
+                        std::printf(" %9s", "-");
+                }
+                double seq_line_split = (offset % chunk_bytes) != 0 ? 100.0 * chunk_bytes / CACHE_LINE_SIZE : 0;
+                double chase_line_split = offset + chunk_bytes > CACHE_LINE_SIZE ? 100.0 : 0;
+                std::printf("   %5.1f%% / %3.0f%%\n", seq_line_split, chase_line_split);
+            }
+            std::cout << std::endl;
+            std::cout << "Penalties are the extra time per access relative to offset 0. Line splits are given for sequential accesses / pointer chasing." << std::endl;
+            std::cout << std::endl;
+        }
+        return true;
+    });
+}
+
+bool BenchmarkManager::runDataPatternBenchmark() {
+    //Only the chunk sizes of the load settings are used
+    std::vector<rw_mode_t> rws;
+    std::vector<chunk_size_t> chunks;
+    std::vector<int32_t> strides;
+    getConcurrentLoadSettings(rws, chunks, strides);
+    std::list<data_pattern_t> pattern_list = config_.getDataPatterns();
+    std::vector<data_pattern_t> patterns(pattern_list.begin(), pattern_list.end());
+    const std::vector<uint8_t>& file_data = config_.getDataPatternFileData();
+    bool has_power_readers = false;
+    for (uint32_t i = 0; i < dram_power_readers_.size(); i++) {
+        if (dram_power_readers_[i] != NULL)
+            has_power_readers = true;
+    }
+
+    std::cout << std::endl;
+    std::cout << "Data pattern: sequential read and pattern write throughput on memory that holds each data pattern, about " << DATA_PATTERN_BENCHMARK_DURATION_MS << " ms per measurement and iteration" << std::endl;
+    if (!has_power_readers)
+        std::cout << "DRAM power readers are not available on this system, so power is not reported." << std::endl;
+
+    return runWorkerPlacements("data pattern", [&](uint32_t mem_node, uint8_t* mem_array, uint32_t cpu_node, const std::vector<int32_t>& cpus, size_t working_set_size) -> bool {
+        uint32_t num_threads = static_cast<uint32_t>(cpus.size());
+        if (working_set_size < 2 * DATA_PATTERN_BLOCK_SIZE || working_set_size % DATA_PATTERN_BLOCK_SIZE != 0) { //the write kernels repeat whole pattern blocks
+            std::cerr << "WARNING: The data pattern benchmark needs working set sizes of at least " << 2 * DATA_PATTERN_BLOCK_SIZE / KB << " KB that are multiples of " << DATA_PATTERN_BLOCK_SIZE / KB << " KB. Skipping " << working_set_size << " B." << std::endl;
+            return true;
+        }
+
+        for (uint32_t chunk_index = 0; chunk_index < chunks.size(); chunk_index++) { //iterate chunk sizes
+            chunk_size_t chunk = chunks[chunk_index];
+            size_t chunk_bits = chunk_size_bytes(chunk) * 8;
+            PatternWriteFunction write_kernel = NULL;
+            PatternWriteFunction write_dummy_kernel = NULL;
+            if (!determine_pattern_write_kernel(chunk, &write_kernel, &write_dummy_kernel)) {
+                std::cerr << "WARNING: Data pattern write kernels are not available for " << chunk_bits << "-bit chunks. Skipping." << std::endl;
+                continue;
+            }
+
+            //Median read and write MB/s and the power in W summed over sockets, for each pattern. Negative entries were not measured.
+            std::vector<std::vector<double> > table(patterns.size(), std::vector<double>(4, -1));
+
+            for (uint32_t pattern_index = 0; pattern_index < patterns.size(); pattern_index++) { //iterate data patterns
+                data_pattern_t pattern = patterns[pattern_index];
+                if (!fill_data_pattern(mem_array, mem_array + num_threads * working_set_size, pattern, file_data))
+                    return false;
+
+                for (uint32_t measurement = 0; measurement < 2; measurement++) { //read the initialized memory first, since writes repeat the first block of the pattern over the rest
+                    rw_mode_t rw_mode = (measurement == 0) ? READ : WRITE;
+                    std::string benchmark_name = static_cast<std::ostringstream*>(&(std::ostringstream() << "Test #" << g_test_index++ << "D (Data Pattern)"))->str();
+                    std::vector<std::vector<double> > metrics_on_iter;
+                    std::vector<double> mean_power;
+                    std::vector<double> peak_power;
+                    bool warning = false;
+
+                    auto create_worker = [&](uint32_t t, std::atomic<uint32_t>*) -> MemoryWorker* {
+                        return new DataPatternWorker(mem_array + t * working_set_size, working_set_size, rw_mode, chunk, cpus[t]);
+                    };
+                    auto get_metrics = [](MemoryWorker* worker) -> std::vector<double> {
+                        return std::vector<double>(1, static_cast<DataPatternWorker*>(worker)->getThroughput());
+                    };
+                    if (!runWorkers("data pattern", cpus, create_worker, get_metrics, 1, metrics_on_iter, warning, &mean_power, &peak_power))
+                        return false;
+                    const std::vector<double>& throughput_on_iter = metrics_on_iter[0];
+                    table[pattern_index][measurement] = median_metric(throughput_on_iter);
+                    double total_power = -1;
+                    for (uint32_t i = 0; i < mean_power.size(); i++) {
+                        if (mean_power[i] >= 0)
+                            total_power = std::max(total_power, 0.0) + mean_power[i];
+                    }
+                    table[pattern_index][2 + measurement] = total_power;
+
+                    std::printf("%s    %s, %s, %lu-bit chunks, %lu KB x %u threads, CPU node %u, memory node %u: %0.1f MB/s", benchmark_name.c_str(), data_pattern_name(pattern).c_str(), rw_mode == READ ? "read" : "write", static_cast<unsigned long>(chunk_bits), static_cast<unsigned long>(working_set_size / KB), num_threads, cpu_node, mem_node, table[pattern_index][measurement]);
+                    if (total_power >= 0)
+                        std::printf(", %0.2f W", total_power);
+                    if (warning)
+                        std::printf(" (WARNING)");
+                    std::printf("\n");
+                    std::fflush(stdout);
+
+                    std::string notes = static_cast<std::ostringstream*>(&(std::ostringstream() << data_pattern_name(pattern) << " data; " << (rw_mode == READ ? "sequential read" : "pattern write") << "; " << chunk_bits << "-bit chunks"))->str();
+                    writeWorkerResults(benchmark_name, working_set_size, num_threads, mem_node, static_cast<std::ostringstream*>(&(std::ostringstream() << cpu_node))->str(), throughput_on_iter, "MB/s", std::vector<double>(), "", mean_power, peak_power, notes);
+                }
+            }
+
+            //Compare each pattern to the first one
+            std::cout << std::endl;
+            std::cout << "*** DATA PATTERN: " << chunk_bits << "-bit chunks, " << working_set_size / KB << " KB x " << num_threads << " threads, CPU node " << cpu_node << ", memory node " << mem_node << " ***" << std::endl;
+            std::cout << std::endl;
+            std::printf("    %-12s %12s %9s %12s %9s %10s %10s\n", "Pattern", "Read MB/s", "Relative", "Write MB/s", "Relative", "Read W", "Write W");
+            for (uint32_t pattern_index = 0; pattern_index < patterns.size(); pattern_index++) {
+                std::printf("    %-12s", data_pattern_name(patterns[pattern_index]).c_str());
+                for (uint32_t measurement = 0; measurement < 2; measurement++) {
+                    double value = table[pattern_index][measurement];
+                    double baseline = table[0][measurement];
+                    std::printf(" %12.1f", value);
+                    if (baseline > 0)
+                        std::printf(" %8.1f%%", 100 * value / baseline);
+                    else
+                        std::printf(" %9s", "-");
+                }
+                for (uint32_t measurement = 0; measurement < 2; measurement++) {
+                    if (table[pattern_index][2 + measurement] >= 0)
+                        std::printf(" %10.2f", table[pattern_index][2 + measurement]);
+                    else
+                        std::printf(" %10s", "-");
+                }
+                std::printf("\n");
+            }
+            std::cout << std::endl;
+            std::cout << "Throughput is relative to the " << data_pattern_name(patterns[0]) << " pattern. Power is the mean DRAM power summed over sockets." << std::endl;
+            std::cout << std::endl;
+        }
+        return true;
+    });
+}
+
+bool BenchmarkManager::runTiledBenchmark() {
+    std::list<tile_order_t> order_list = config_.getTileOrders();
+    std::vector<tile_order_t> orders(order_list.begin(), order_list.end());
+    std::vector<rw_mode_t> rws;
+    if (config_.useReads())
+        rws.push_back(READ);
+    if (config_.useWrites())
+        rws.push_back(WRITE);
+    if (rws.empty()) {
+        std::cerr << "WARNING: The 2D tiled benchmark only reads and writes, but neither was selected. Only reading." << std::endl;
+        rws.push_back(READ);
+    }
+    size_t row_pitch = config_.getRowPitch();
+    size_t row_width = config_.getRowWidth();
+
+    std::cout << std::endl;
+    std::cout << "2D tiled: throughput of traversing a 2D array of 64-bit elements per thread with " << row_width << " B rows, a " << row_pitch << " B row pitch, and " << config_.getTileWidth() << "x" << config_.getTileHeight() << " element tiles, about " << TILED_BENCHMARK_DURATION_MS << " ms per measurement and iteration" << std::endl;
+
+    return runWorkerPlacements("2D tiled", [&](uint32_t mem_node, uint8_t* mem_array, uint32_t cpu_node, const std::vector<int32_t>& cpus, size_t working_set_size) -> bool {
+        uint32_t num_threads = static_cast<uint32_t>(cpus.size());
+
+        //Median MB/s of reads and writes in each order. The transpose is a copy and is kept in the read column. Negative entries were not measured.
+        std::vector<std::vector<double> > table(orders.size(), std::vector<double>(2, -1));
+
+        for (uint32_t order_index = 0; order_index < orders.size(); order_index++) { //iterate traversal orders
+            tile_order_t order = orders[order_index];
+
+            //The transpose keeps its destination in the second half of the working set
+            tile_geometry_t geometry;
+            geometry.width = row_width / sizeof(uint64_t);
+            geometry.pitch = row_pitch / sizeof(uint64_t);
+            geometry.height = ((order == TILE_ORDER_TRANSPOSE) ? working_set_size / 2 : working_set_size) / row_pitch;
+            geometry.tile_width = config_.getTileWidth();
+            geometry.tile_height = config_.getTileHeight();
+            if (geometry.height == 0) {
+                std::cerr << "WARNING: A " << working_set_size << " B working set cannot hold a row of the 2D array for the " << tile_order_name(order) << " order. Skipping." << std::endl;
+                continue;
+            }
+            if (geometry.tile_height > geometry.height) {
+                std::cerr << "WARNING: A " << working_set_size << " B working set cannot hold a full tile of the 2D array for the " << tile_order_name(order) << " order. Skipping." << std::endl;
+                continue;
+            }
+
+            for (uint32_t rw_index = 0; rw_index < rws.size(); rw_index++) { //iterate read/write modes
+                rw_mode_t rw_mode = rws[rw_index];
+                if (order == TILE_ORDER_TRANSPOSE && rw_index > 0) //the transpose both reads and writes, so run it once
+                    break;
+
+                std::string benchmark_name = static_cast<std::ostringstream*>(&(std::ostringstream() << "Test #" << g_test_index++ << "Z (2D Tiled)"))->str();
+                std::vector<std::vector<double> > metrics_on_iter;
+                bool warning = false;
+
+                auto create_worker = [&](uint32_t t, std::atomic<uint32_t>*) -> MemoryWorker* {
+                    return new TiledWorker(mem_array + t * working_set_size, working_set_size, order, rw_mode, geometry, cpus[t]);
+                };
+                auto get_metrics = [](MemoryWorker* worker) -> std::vector<double> {
+                    return std::vector<double>(1, static_cast<TiledWorker*>(worker)->getThroughput());
+                };
+                if (!runWorkers("2D tiled", cpus, create_worker, get_metrics, 1, metrics_on_iter, warning))
+                    return false;
+                const std::vector<double>& throughput_on_iter = metrics_on_iter[0];
+                double median_throughput = median_metric(throughput_on_iter);
+                table[order_index][(order == TILE_ORDER_TRANSPOSE || rw_mode == READ) ? 0 : 1] = median_throughput;
+                const char* operation = (order == TILE_ORDER_TRANSPOSE) ? "copy" : (rw_mode == READ ? "read" : "write");
+
+                std::printf("%s    %s %s, %lux%lu elements, %lu B pitch, %lux%lu tiles, %lu KB x %u threads, CPU node %u, memory node %u: %0.1f MB/s", benchmark_name.c_str(), tile_order_name(order).c_str(), operation, static_cast<unsigned long>(geometry.width), static_cast<unsigned long>(geometry.height), static_cast<unsigned long>(row_pitch), static_cast<unsigned long>(geometry.tile_width), static_cast<unsigned long>(geometry.tile_height), static_cast<unsigned long>(working_set_size / KB), num_threads, cpu_node, mem_node, median_throughput);
+                if (warning)
+                    std::printf(" (WARNING)");
+                std::printf("\n");
+                std::fflush(stdout);
+
+                std::string notes = static_cast<std::ostringstream*>(&(std::ostringstream() << tile_order_name(order) << " " << operation << "; " << geometry.width << "x" << geometry.height << " elements; " << row_pitch << " B pitch; " << geometry.tile_width << "x" << geometry.tile_height << " tiles"))->str();
+                writeWorkerResults(benchmark_name, working_set_size, num_threads, mem_node, static_cast<std::ostringstream*>(&(std::ostringstream() << cpu_node))->str(), throughput_on_iter, "MB/s", std::vector<double>(), "", notes);
+            }
+        }
+
+        std::cout << std::endl;
+        std::cout << "*** 2D TILED: " << working_set_size / KB << " KB x " << num_threads << " threads, CPU node " << cpu_node << ", memory node " << mem_node << " ***" << std::endl;
+        std::cout << std::endl;
+        std::printf("    %-10s %12s %12s\n", "Order", "Read MB/s", "Write MB/s");
+        for (uint32_t order_index = 0; order_index < orders.size(); order_index++) {
+            std::printf("    %-10s", tile_order_name(orders[order_index]).c_str());
+            for (uint32_t rw_index = 0; rw_index < 2; rw_index++) {
+                if (table[order_index][rw_index] >= 0)
+                    std::printf(" %12.1f", table[order_index][rw_index]);
+                else
+                    std::printf(" %12s", "-");
+            }
+            std::printf("\n");
+        }
+        std::cout << std::endl;
+        if (std::find(orders.begin(), orders.end(), TILE_ORDER_TRANSPOSE) != orders.end()) {
+            std::cout << "The transpose reads and writes every element once, and its bytes copied per second are given as reads." << std::endl;
+            std::cout << std::endl;
+        }
+        return true;
+    });
+}
+
+bool BenchmarkManager::runRooflineBenchmark() {
+    std::list<roofline_engine_t> engine_list = config_.getRooflineEngines();
+    std::vector<roofline_engine_t> engines(engine_list.begin(), engine_list.end());
+    std::list<uint32_t> ops_list = config_.getOpsPerElement();
+    std::vector<uint32_t> ops_per_element(ops_list.begin(), ops_list.end());
+
+    std::cout << std::endl;
+    std::cout << "Roofline: operation and load throughput of sequential reads with a fixed number of operations per loaded 64-bit element, about " << ROOFLINE_BENCHMARK_DURATION_MS << " ms per measurement and iteration" << std::endl;
+
+    return runWorkerPlacements("roofline", [&](uint32_t mem_node, uint8_t* mem_array, uint32_t cpu_node, const std::vector<int32_t>& cpus, size_t working_set_size) -> bool {
+        uint32_t num_threads = static_cast<uint32_t>(cpus.size());
+        if (working_set_size % ROOFLINE_BYTES_PER_ITERATION != 0) {
+            std::cerr << "WARNING: The roofline benchmark needs working set sizes that are multiples of " << ROOFLINE_BYTES_PER_ITERATION << " B. Skipping " << working_set_size << " B." << std::endl;
+            return true;
+        }
+
+        for (uint32_t engine_index = 0; engine_index < engines.size(); engine_index++) { //iterate compute engines
+            roofline_engine_t engine = engines[engine_index];
+            std::string ops_units = roofline_engine_is_integer(engine) ? "GOP/s" : "GFLOP/s";
+
+            //Median operation throughput and load throughput in MB/s at each arithmetic intensity
+            std::vector<double> ops_table(ops_per_element.size(), 0);
+            std::vector<double> throughput_table(ops_per_element.size(), 0);
+
+            for (uint32_t ops_index = 0; ops_index < ops_per_element.size(); ops_index++) { //iterate arithmetic intensities
+                uint32_t ops = ops_per_element[ops_index];
+                double intensity = static_cast<double>(ops) / sizeof(uint64_t);
+                std::string benchmark_name = static_cast<std::ostringstream*>(&(std::ostringstream() << "Test #" << g_test_index++ << "R (Roofline)"))->str();
+                std::vector<std::vector<double> > metrics_on_iter;
+                bool warning = false;
+
+                auto create_worker = [&](uint32_t t, std::atomic<uint32_t>*) -> MemoryWorker* {
+                    return new RooflineWorker(mem_array + t * working_set_size, working_set_size, engine, ops, cpus[t]);
+                };
+                auto get_metrics = [](MemoryWorker* worker) -> std::vector<double> {
+                    RooflineWorker* roofline_worker = static_cast<RooflineWorker*>(worker);
+                    std::vector<double> metrics;
+                    metrics.push_back(roofline_worker->getThroughput());
+                    metrics.push_back(roofline_worker->getOpsPerSecond());
+                    return metrics;
+                };
+                if (!runWorkers("roofline", cpus, create_worker, get_metrics, 2, metrics_on_iter, warning))
+                    return false;
+                const std::vector<double>& throughput_on_iter = metrics_on_iter[0];
+                const std::vector<double>& ops_on_iter = metrics_on_iter[1];
+                throughput_table[ops_index] = median_metric(throughput_on_iter);
+                ops_table[ops_index] = median_metric(ops_on_iter);
+
+                std::printf("%s    %s, %u ops/element (%0.3f ops/B), %lu KB x %u threads, CPU node %u, memory node %u: %0.2f %s, %0.1f MB/s", benchmark_name.c_str(), roofline_engine_name(engine).c_str(), ops, intensity, static_cast<unsigned long>(working_set_size / KB), num_threads, cpu_node, mem_node, ops_table[ops_index], ops_units.c_str(), throughput_table[ops_index]);
+                if (warning)
+                    std::printf(" (WARNING)");
+                std::printf("\n");
+                std::fflush(stdout);
+
+                std::string notes = static_cast<std::ostringstream*>(&(std::ostringstream() << roofline_engine_name(engine) << "; " << ops << " ops/element; " << intensity << " ops/B"))->str();
+                writeWorkerResults(benchmark_name, working_set_size, num_threads, mem_node, static_cast<std::ostringstream*>(&(std::ostringstream() << cpu_node))->str(), throughput_on_iter, "MB/s", ops_on_iter, ops_units, notes);
+            }
+
+            //The roofs are the best rates seen anywhere in the sweep, and they meet at the ridge point. Bytes are decimal here so that the operation rate divided by the byte rate is the intensity.
+            double compute_roof = 0;
+            double memory_roof = 0;
+            for (uint32_t ops_index = 0; ops_index < ops_per_element.size(); ops_index++) {
+                compute_roof = std::max(compute_roof, ops_table[ops_index]);
+                memory_roof = std::max(memory_roof, throughput_table[ops_index] * MB / 1e9);
+            }
+            double ridge = (memory_roof > 0) ? compute_roof / memory_roof : 0;
+
+            std::cout << std::endl;
+            std::cout << "*** ROOFLINE: " << roofline_engine_name(engine) << ", " << working_set_size / KB << " KB x " << num_threads << " threads, CPU node " << cpu_node << ", memory node " << mem_node << " ***" << std::endl;
+            std::cout << std::endl;
+            std::printf("    %-12s %10s %12s %12s %10s\n", "Ops/element", "Ops/B", ops_units.c_str(), "GB/s", "Bound");
+            for (uint32_t ops_index = 0; ops_index < ops_per_element.size(); ops_index++) {
+                double intensity = static_cast<double>(ops_per_element[ops_index]) / sizeof(uint64_t);
+                std::printf("    %-12u %10.3f %12.2f %12.2f %10s\n", ops_per_element[ops_index], intensity, ops_table[ops_index], throughput_table[ops_index] * MB / 1e9, (intensity < ridge) ? "memory" : "compute");
+            }
+            std::cout << std::endl;
+            std::printf("    Compute roof: %0.2f %s. Memory roof: %0.2f GB/s. Ridge point: %0.3f ops/B.\n", compute_roof, ops_units.c_str(), memory_roof, ridge);
+            std::cout << std::endl;
+        }
+        return true;
+    });
+}
+
 #ifdef EXT_DELAY_INJECTED_LOADED_LATENCY_BENCHMARK
 bool BenchmarkManager::runExtDelayInjectedLoadedLatencyBenchmark() {
     if (config_.getNumWorkerThreads() < 2) {   
-        std::cerr << "ERROR: Number of worker threads must be at least 1." << std::endl;
+        std::cerr << "ERROR: Number of worker threads must be at least 2." << std::endl;
         return false;
     }
 
     std::vector<DelayInjectedLoadedLatencyBenchmark*> del_lat_benchmarks;
     
-    //Put the enumerations into vectors to make constructing benchmarks more loopable
+    //Load threads use the same access pattern, read/write mode, chunk size, and stride settings as regular loaded latency benchmarks
+    std::vector<rw_mode_t> rws;
     std::vector<chunk_size_t> chunks;
-    chunks.push_back(CHUNK_32b); 
-#ifdef HAS_WORD_64
-    chunks.push_back(CHUNK_64b); 
-#endif
-#ifdef HAS_WORD_128
-    chunks.push_back(CHUNK_128b); 
-#endif
-#ifdef HAS_WORD_256
-    chunks.push_back(CHUNK_256b); 
-#endif
-#ifdef HAS_WORD_512
-    chunks.push_back(CHUNK_512b); 
-#endif
+    std::vector<int32_t> strides;
+    getConcurrentLoadSettings(rws, chunks, strides);
+    std::list<uint32_t> delays = config_.getExtDelayInjectedLoadedLatencyDelays();
+
+    //Special case: delay-injected kernels are only implemented for reads and writes, so drop the other read/write modes once up front
+    std::vector<rw_mode_t> supported_rws;
+    for (uint32_t rw_index = 0; rw_index < rws.size(); rw_index++) {
+        if (rws[rw_index] == READ || rws[rw_index] == WRITE)
+            supported_rws.push_back(rws[rw_index]);
+        else
+            std::cerr << "WARNING: The delay-injected loaded latency benchmark only supports reads and writes. Skipping the " << rw_mode_name(rws[rw_index]) << " mode." << std::endl;
+    }
+    rws = supported_rws;
 
     //Build benchmarks
     for (auto mem_node_it = memory_numa_node_affinities_.cbegin(); mem_node_it != memory_numa_node_affinities_.cend(); mem_node_it++) { //iterate each memory NUMA node
         uint32_t mem_node = *mem_node_it;
         
         void* mem_array = mem_arrays_[mem_node];           
-        size_t mem_array_len = mem_array_lens_[mem_node];
+        size_t mem_array_len = config_.getNumWorkerThreads() * config_.getWorkingSetSizePerThread(); //The node's allocation may be larger, to fit thread sweeps and multiple placements
 
         for (auto cpu_node_it = cpu_numa_node_affinities_.cbegin(); cpu_node_it != cpu_numa_node_affinities_.cend(); cpu_node_it++) { //iterate each cpuory NUMA node
             uint32_t cpu_node = *cpu_node_it;
 
-            for (uint32_t chunk_index = 0; chunk_index < chunks.size(); chunk_index++) { //iterate different chunk sizes
-                chunk_size_t chunk = chunks[chunk_index];
+            for (uint32_t rw_index = 0; rw_index < rws.size(); rw_index++) { //iterate read/write access types
+                rw_mode_t rw = rws[rw_index];
 
-                uint32_t d = 0;
-                while (d <= 1024) { //Iterate different delay values
-            
-                    std::string benchmark_name = static_cast<std::ostringstream*>(&(std::ostringstream() << "Test #" << g_test_index++ << "E" << EXT_NUM_DELAY_INJECTED_LOADED_LATENCY_BENCHMARK << " (Extension: Delay-Injected Loaded Latency)"))->str();
-                    
-                    del_lat_benchmarks.push_back(new DelayInjectedLoadedLatencyBenchmark(mem_array,
-                                                                             mem_array_len,
-                                                                             config_.getIterationsPerTest(),
-                                                                             config_.getNumWorkerThreads(),
-                                                                             mem_node,
-                                                                             cpu_node,
-                                                                             chunk,
-                                                                             dram_power_readers_,
-                                                                             benchmark_name,
-                                                                             d));
-                    if (del_lat_benchmarks[del_lat_benchmarks.size()-1] == NULL) {
-                        std::cerr << "ERROR: Failed to build a DelayInjectedLoadedLatencyBenchmark!" << std::endl;
-                        return false;
+                for (uint32_t chunk_index = 0; chunk_index < chunks.size(); chunk_index++) { //iterate different chunk sizes
+                    chunk_size_t chunk = chunks[chunk_index];
+
+#ifdef HAS_WORD_512
+                    if (chunk == CHUNK_512b) { //Special case: delay-injected kernels are not implemented for 512-bit chunks
+                        std::cerr << "WARNING: The delay-injected loaded latency benchmark does not support 512-bit chunks. Skipping." << std::endl;
+                        continue;
                     }
+#endif
 
-                    if (d == 0) //special case
-                        d = 1;
-                    else
-                        d *= 2;
+                    for (uint32_t stride_index = 0; stride_index < strides.size(); stride_index++) {  //iterate different stride lengths, where 0 means random access
+                        int32_t stride = strides[stride_index];
+
+                        if (stride == 0 && chunk == CHUNK_32b) //Special case: random load workers cannot use 32-bit chunks, so skip this benchmark combination
+                            continue;
+
+                        for (auto delay_it = delays.cbegin(); delay_it != delays.cend(); delay_it++) { //Iterate different delay values
+                            std::string benchmark_name = static_cast<std::ostringstream*>(&(std::ostringstream() << "Test #" << g_test_index++ << "E" << EXT_NUM_DELAY_INJECTED_LOADED_LATENCY_BENCHMARK << " (Extension: Delay-Injected Loaded Latency)"))->str();
+                            
+                            del_lat_benchmarks.push_back(new DelayInjectedLoadedLatencyBenchmark(mem_array,
+                                                                                     mem_array_len,
+                                                                                     config_.getIterationsPerTest(),
+                                                                                     config_.getNumWorkerThreads(),
+                                                                                     mem_node,
+                                                                                     cpu_node,
+                                                                                     (stride == 0) ? RANDOM : SEQUENTIAL,
+                                                                                     rw,
+                                                                                     chunk,
+                                                                                     stride,
+                                                                                     dram_power_readers_,
+                                                                                     benchmark_name,
+                                                                                     *delay_it));
+                            if (del_lat_benchmarks[del_lat_benchmarks.size()-1] == NULL) {
+                                std::cerr << "ERROR: Failed to build a DelayInjectedLoadedLatencyBenchmark!" << std::endl;
+                                return false;
+                            }
+                        }
+                    }
                 }
             }
         }
@@ -813,6 +3662,18 @@ bool BenchmarkManager::runExtDelayInjectedLoadedLatencyBenchmark() {
                     case WRITE:
                         results_file_ << "WRITE" << ",";
                         break;
+                    case READ_WRITE_1_1:
+                        results_file_ << "READ_WRITE_1_1" << ",";
+                        break;
+                    case READ_WRITE_2_1:
+                        results_file_ << "READ_WRITE_2_1" << ",";
+                        break;
+                    case READ_WRITE_3_1:
+                        results_file_ << "READ_WRITE_3_1" << ",";
+                        break;
+                    case READ_MODIFY_WRITE:
+                        results_file_ << "READ_MODIFY_WRITE" << ",";
+                        break;
                     default:
                         results_file_ << "UNKNOWN" << ",";
                         break;
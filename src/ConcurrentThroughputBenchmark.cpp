@@ -0,0 +1,374 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Microsoft
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Author: Mark Gottscho <mgottscho@ucla.edu>
+ */
+
+/**
+ * @file
+ * 
+ * @brief Implementation file for the ConcurrentThroughputBenchmark class.
+ */
+
+//Headers
+#include <ConcurrentThroughputBenchmark.h>
+#include <common.h>
+#include <benchmark_kernels.h>
+#include <LoadWorker.h>
+#include <Thread.h>
+
+//Libraries
+#include <iostream>
+#include <cstdio>
+#include <assert.h>
+#include <time.h>
+
+using namespace xmem;
+
+ConcurrentThroughputBenchmark::ConcurrentThroughputBenchmark(
+        std::vector<void*> mem_arrays,
+        size_t len,
+        uint32_t iterations,
+        uint32_t num_worker_threads,
+        std::vector<uint32_t> cpu_nodes,
+        std::vector<uint32_t> mem_nodes,
+        pattern_mode_t pattern_mode,
+        rw_mode_t rw_mode,
+        chunk_size_t chunk_size,
+        int32_t stride_size,
+        std::vector<PowerReader*> dram_power_readers,
+        std::string name
+    ) :
+    Benchmark(
+        mem_arrays[0],
+        len,
+        iterations,
+        num_worker_threads,
+        mem_nodes[0],
+        cpu_nodes[0],
+        pattern_mode,
+        rw_mode,
+        chunk_size,
+        stride_size,
+        dram_power_readers,
+        "MB/s",
+        name
+    ),
+    mem_arrays_(mem_arrays),
+    cpu_nodes_(cpu_nodes),
+    mem_nodes_(mem_nodes),
+    placement_metric_on_iter_(),
+    mean_placement_metric_()
+    {
+
+    assert(mem_arrays_.size() == cpu_nodes_.size() && cpu_nodes_.size() == mem_nodes_.size());
+    for (uint32_t p = 0; p < cpu_nodes_.size(); p++) {
+        placement_metric_on_iter_.push_back(std::vector<double>(iterations_, -1));
+        mean_placement_metric_.push_back(-1);
+    }
+}
+
+void ConcurrentThroughputBenchmark::reportBenchmarkInfo() const {
+    std::cout << "Concurrent CPU NUMA Node -> Memory NUMA Node placements:";
+    for (uint32_t p = 0; p < getNumPlacements(); p++)
+        std::cout << " " << cpu_nodes_[p] << "->" << mem_nodes_[p];
+    std::cout << std::endl;
+
+    std::cout << "Chunk Size: ";
+    switch (chunk_size_) {
+        case CHUNK_32b:
+            std::cout << "32-bit";
+            break;
+#ifdef HAS_WORD_64
+        case CHUNK_64b:
+            std::cout << "64-bit";
+            break;
+#endif
+#ifdef HAS_WORD_128
+        case CHUNK_128b:
+            std::cout << "128-bit";
+            break;
+#endif
+#ifdef HAS_WORD_256
+        case CHUNK_256b:
+            std::cout << "256-bit";
+            break;
+#endif
+#ifdef HAS_WORD_512
+        case CHUNK_512b:
+            std::cout << "512-bit";
+            break;
+#endif
+        default:
+            std::cout << "UNKNOWN";
+            break;
+    }
+    std::cout << std::endl;
+
+    std::cout << "Access Pattern: ";
+    switch (pattern_mode_) {
+        case SEQUENTIAL:
+            if (stride_size_ > 0)
+                std::cout << "forward ";
+            else if (stride_size_ < 0)
+                std::cout << "reverse ";
+            else 
+                std::cout << "UNKNOWN ";
+
+            if (stride_size_ == 1 || stride_size_ == -1)
+                std::cout << "sequential";
+            else 
+                std::cout << "strides of " << stride_size_ << " chunks";
+            break;
+        case RANDOM:
+            std::cout << "random";
+            break;
+        default:
+            std::cout << "UNKNOWN";
+            break;
+    }
+    std::cout << std::endl;
+
+    std::cout << "Read/Write Mode: ";
+    switch (rw_mode_) {
+        case READ:
+            std::cout << "read";
+            break;
+        case WRITE:
+            if (pattern_mode_ == RANDOM) //special case
+                std::cout << "read+write";
+            else
+                std::cout << "write";
+            break;
+        case READ_WRITE_1_1:
+        case READ_WRITE_2_1:
+        case READ_WRITE_3_1:
+        case READ_MODIFY_WRITE:
+            std::cout << rw_mode_name(rw_mode_);
+            break;
+        default:
+            std::cout << "UNKNOWN";
+            break;
+    }
+    std::cout << std::endl;
+
+    std::cout << "Number of worker threads: " << num_worker_threads_ << " per placement, " << getTotalNumThreads() << " in total";
+    std::cout << std::endl;
+
+    std::cout << std::endl;
+}
+
+void ConcurrentThroughputBenchmark::reportResults() const {
+    Benchmark::reportResults(); //System-wide aggregate
+
+    if (has_run_) {
+        std::cout << std::endl;
+        std::cout << "Per-placement mean throughput while running concurrently..." << std::endl;
+        for (uint32_t p = 0; p < getNumPlacements(); p++)
+            std::printf("...CPU NUMA Node %u -> Memory NUMA Node %u:    %0.3f    %s\n", cpu_nodes_[p], mem_nodes_[p], mean_placement_metric_[p], metric_units_.c_str());
+    }
+}
+
+double ConcurrentThroughputBenchmark::getPlacementMetricOnIter(uint32_t placement, uint32_t iter) const {
+    if (has_run_ && placement < getNumPlacements() && iter >= 1 && iter <= iterations_)
+        return placement_metric_on_iter_[placement][iter - 1];
+    else //bad call
+        return -1;
+}
+
+double ConcurrentThroughputBenchmark::getMeanPlacementMetric(uint32_t placement) const {
+    if (has_run_ && placement < getNumPlacements())
+        return mean_placement_metric_[placement];
+    else //bad call
+        return -1;
+}
+
+bool ConcurrentThroughputBenchmark::runCore() {
+    size_t len_per_thread = len_ / num_worker_threads_; //Carve up each placement's memory space so each worker has its own area to play in
+    uint32_t num_placements = getNumPlacements();
+
+    //Benchmark::run() only touches the first placement's region. Make sure the rest are resident in physical memory too.
+    for (uint32_t p = 1; p < num_placements; p++)
+        forwSequentialWrite_Word32(mem_arrays_[p],
+                                   reinterpret_cast<void*>(reinterpret_cast<uint8_t*>(mem_arrays_[p]) + len_));
+
+    //Set up kernel function pointers
+    SequentialFunction kernel_fptr_seq = NULL;
+    SequentialFunction kernel_dummy_fptr_seq = NULL; 
+    RandomFunction kernel_fptr_ran = NULL;
+    RandomFunction kernel_dummy_fptr_ran = NULL; 
+
+    if (pattern_mode_ == SEQUENTIAL) {
+        if (!determine_sequential_kernel(rw_mode_, chunk_size_, stride_size_, &kernel_fptr_seq, &kernel_dummy_fptr_seq)) {
+            std::cerr << "ERROR: Failed to find appropriate benchmark kernel." << std::endl;
+            return false;
+        }
+    } else if (pattern_mode_ == RANDOM) {
+        if (!determine_random_kernel(rw_mode_, chunk_size_, &kernel_fptr_ran, &kernel_dummy_fptr_ran)) {
+            std::cerr << "ERROR: Failed to find appropriate benchmark kernel." << std::endl;
+            return false;
+        }
+            
+        //Build pointer indices. Note that the pointers for each thread must stay within its respective region, otherwise sharing may occur. 
+        for (uint32_t p = 0; p < num_placements; p++) {
+            for (uint32_t i = 0; i < num_worker_threads_; i++) {
+                if (!build_random_pointer_permutation(reinterpret_cast<void*>(reinterpret_cast<uint8_t*>(mem_arrays_[p]) + i*len_per_thread), //casts to silence compiler warnings
+                                                   reinterpret_cast<void*>(reinterpret_cast<uint8_t*>(mem_arrays_[p]) + (i+1)*len_per_thread), //casts to silence compiler warnings
+                                                   chunk_size_)) {
+                    std::cerr << "ERROR: Failed to build a random pointer permutation for a worker thread!" << std::endl;
+                    return false;
+                }
+            }
+        }
+    } else {
+        std::cerr << "ERROR: Got an invalid pattern mode." << std::endl;
+        return false;
+    }
+
+    //Placements that share a CPU NUMA node must not share logical CPUs, so each one starts at a different rank within the node.
+    std::vector<uint32_t> cpu_rank_offsets;
+    for (uint32_t p = 0; p < num_placements; p++) {
+        uint32_t offset = 0;
+        for (uint32_t q = 0; q < p; q++)
+            if (cpu_nodes_[q] == cpu_nodes_[p])
+                offset += num_worker_threads_;
+        cpu_rank_offsets.push_back(offset);
+    }
+
+    //Set up some stuff for worker threads
+    std::vector<LoadWorker*> workers;
+    std::vector<Thread*> worker_threads;
+    uint32_t total_threads = getTotalNumThreads();
+
+    //Start power measurement
+    if (g_verbose) 
+        std::cout << "Starting power measurement threads...";
+    if (!startPowerThreads()) {
+        if (g_verbose)
+            std::cout << "FAIL" << std::endl;
+        std::cerr << "WARNING: Failed to start power measurement threads." << std::endl;
+    } else if (g_verbose)
+        std::cout << "done" << std::endl;
+
+    //Run benchmark
+    if (g_verbose)
+        std::cout << "Running benchmark." << std::endl << std::endl;
+
+    //Do a bunch of iterations of the core benchmark routines
+    for (uint32_t i = 0; i < iterations_; i++) {
+        //Create workers and worker threads for every placement. Worker index is p * num_worker_threads_ + t.
+        for (uint32_t p = 0; p < num_placements; p++) {
+            for (uint32_t t = 0; t < num_worker_threads_; t++) {
+                void* threadmem_array_ = reinterpret_cast<void*>(reinterpret_cast<uint8_t*>(mem_arrays_[p]) + t * len_per_thread);
+                int32_t cpu_id = cpu_id_in_numa_node(cpu_nodes_[p], cpu_rank_offsets[p] + t);
+                if (cpu_id < 0)
+                    std::cerr << "WARNING: Failed to find logical CPU " << cpu_rank_offsets[p] + t << " in NUMA node " << cpu_nodes_[p] << std::endl;
+                if (pattern_mode_ == SEQUENTIAL)
+                    workers.push_back(new LoadWorker(threadmem_array_,
+                                                     len_per_thread,
+                                                     kernel_fptr_seq,
+                                                     kernel_dummy_fptr_seq,
+                                                     cpu_id));
+                else if (pattern_mode_ == RANDOM)
+                    workers.push_back(new LoadWorker(threadmem_array_,
+                                                     len_per_thread,
+                                                     kernel_fptr_ran,
+                                                     kernel_dummy_fptr_ran,
+                                                     cpu_id));
+                else
+                    std::cerr << "WARNING: Invalid benchmark pattern mode." << std::endl;
+                worker_threads.push_back(new Thread(workers[workers.size()-1]));
+            }
+        }
+
+        //Start worker threads of all placements together! gogogo
+        for (uint32_t t = 0; t < total_threads; t++)
+            worker_threads[t]->create_and_start();
+
+        //Wait for all threads to complete
+        for (uint32_t t = 0; t < total_threads; t++)
+            if (!worker_threads[t]->join())
+                std::cerr << "WARNING: A worker thread failed to complete correctly!" << std::endl;
+
+        //Compute throughput achieved by each placement. The system-wide throughput is their sum.
+        uint32_t bytes_per_pass = workers[0]->getBytesPerPass(); //all should be the same.
+        bool iter_warning = false;
+        double system_metric = 0;
+        for (uint32_t p = 0; p < num_placements; p++) {
+            uint32_t total_passes = 0;
+            tick_t total_adjusted_ticks = 0;
+            tick_t avg_adjusted_ticks = 0;
+            for (uint32_t t = p * num_worker_threads_; t < (p+1) * num_worker_threads_; t++) {
+                total_passes += workers[t]->getPasses();
+                total_adjusted_ticks += workers[t]->getAdjustedTicks();
+                iter_warning |= workers[t]->hadWarning();
+            }
+
+            avg_adjusted_ticks = total_adjusted_ticks / num_worker_threads_;
+            placement_metric_on_iter_[p][i] = ((static_cast<double>(total_passes) * static_cast<double>(bytes_per_pass)) / static_cast<double>(MB))   /   ((static_cast<double>(avg_adjusted_ticks) * g_ns_per_tick) / 1e9);
+            system_metric += placement_metric_on_iter_[p][i];
+
+            if (g_verbose) { //Report throughput of this placement for this iteration
+                std::cout << "Iter " << i+1 << ", CPU NUMA node " << cpu_nodes_[p] << " -> memory NUMA node " << mem_nodes_[p] << " had " << total_passes << " passes in total across " << num_worker_threads_ << " threads, with " << bytes_per_pass << " bytes touched per pass, in " << total_adjusted_ticks << " adjusted clock ticks in total";
+                if (iter_warning) std::cout << " -- WARNING";
+                std::cout << std::endl;
+            }
+        }
+
+        if (iter_warning)
+            warning_ = true;
+
+        //Compute metric for this iteration
+        metric_on_iter_[i] = system_metric;
+
+        //Clean up workers and threads for this iteration
+        for (uint32_t t = 0; t < total_threads; t++) {
+            delete worker_threads[t];
+            delete workers[t];
+        }
+        worker_threads.clear();
+        workers.clear();
+    }
+
+    //Stopping power measurement
+    if (g_verbose) 
+        std::cout << "Stopping power measurement threads...";
+    if (!stopPowerThreads()) {
+        if (g_verbose)
+            std::cout << "FAIL" << std::endl;
+        std::cerr << "WARNING: Failed to stop power measurement threads." << std::endl;
+    } else if (g_verbose)
+        std::cout << "done" << std::endl;
+    
+    //Run metadata
+    has_run_ = true;
+    computeMetrics();
+
+    for (uint32_t p = 0; p < num_placements; p++) {
+        double sum = 0;
+        for (uint32_t i = 0; i < iterations_; i++)
+            sum += placement_metric_on_iter_[p][i];
+        mean_placement_metric_[p] = sum / iterations_;
+    }
+
+    return true;
+}
@@ -34,12 +34,15 @@
 #include <common.h>
 #include <optionparser.h>
 #include <MyArg.h>
+#include <benchmark_kernels.h>
 #include <common.h>
 
 //Libraries
 #include <cstdint>
 #include <iostream>
 #include <string>
+#include <algorithm>
+#include <fstream>
 
 using namespace xmem;
 
@@ -49,14 +52,73 @@ Configurator::Configurator(
     run_extensions_(false),
 #ifdef EXT_DELAY_INJECTED_LOADED_LATENCY_BENCHMARK
     run_ext_delay_injected_loaded_latency_benchmark_(false),
+    ext_delay_injected_loaded_latency_delays_(),
 #endif
 #ifdef EXT_STREAM_BENCHMARK
     run_ext_stream_benchmark_(false),
 #endif
     run_latency_(true),
     run_throughput_(true),
+    run_concurrent_throughput_(false),
+    concurrent_placements_(),
+    run_interconnect_(false),
+    run_interference_(false),
+    interference_duration_s_(0),
+    interference_report_interval_ms_(INTERFERENCE_DEFAULT_REPORT_INTERVAL_MS),
+    run_c2c_latency_(false),
+    c2c_cpu_step_(1),
+    run_c2c_bandwidth_(false),
+    c2c_pairs_(),
+    c2c_block_sizes_(),
+    run_atomics_(false),
+    atomic_ops_(),
+    atomic_sharing_modes_(),
+    atomic_spread_addresses_(ATOMIC_DEFAULT_SPREAD_ADDRESSES),
+    run_false_sharing_(false),
+    false_sharing_paddings_(),
+    false_sharing_work_(0),
+    run_flush_(false),
+    flush_ops_(),
+    run_copy_(false),
+    copy_engines_(),
+    copy_sizes_(),
+    copy_size_distribution_(),
+    run_gather_(false),
+    gather_engines_(),
+    gather_index_patterns_(),
+    gather_stride_(GATHER_DEFAULT_STRIDE),
+    gather_window_size_(GATHER_DEFAULT_WINDOW_SIZE),
+    run_multi_stream_(false),
+    stream_counts_(),
+    run_unaligned_(false),
+    unaligned_offsets_(),
+    run_data_pattern_(false),
+    data_patterns_(),
+    use_data_pattern_init_(false),
+    data_pattern_init_(DATA_ZEROS),
+    data_pattern_file_data_(),
+    run_tiled_(false),
+    tile_orders_(),
+    row_pitch_(TILED_DEFAULT_ROW_PITCH),
+    row_width_(TILED_DEFAULT_ROW_PITCH),
+    tile_width_(TILED_DEFAULT_TILE_SIZE),
+    tile_height_(TILED_DEFAULT_TILE_SIZE),
+    run_roofline_(false),
+    roofline_engines_(),
+    ops_per_element_(),
+    latency_load_placements_(),
+    load_target_bandwidth_(0),
+    all_core_latency_(false),
+    cold_cache_latency_(false),
+    load_profile_(),
+    latency_trace_filename_(),
+    use_latency_trace_file_(false),
     working_set_size_per_thread_(DEFAULT_WORKING_SET_SIZE_PER_THREAD),
+    use_working_set_size_sweep_(false),
+    working_set_size_sweep_(),
     num_worker_threads_(DEFAULT_NUM_WORKER_THREADS),
+    use_num_worker_threads_sweep_(false),
+    num_worker_threads_sweep_(),
 #ifdef HAS_WORD_64
     use_chunk_32b_(false),
     use_chunk_64b_(true),
@@ -89,6 +151,8 @@ Configurator::Configurator(
     use_large_pages_(false),
     use_reads_(true),
     use_writes_(true),
+    rw_mixes_(),
+    use_read_modify_write_(false),
     use_stride_p1_(true),
     use_stride_n1_(false),
     use_stride_p2_(false),
@@ -143,7 +207,7 @@ int32_t Configurator::configureFromInput(int argc, char* argv[]) {
     }
 
     //Check runtime modes
-    if (options[MEAS_LATENCY] || options[MEAS_THROUGHPUT] || options[EXTENSION]) { //User explicitly picked at least one mode, so override default selection
+    if (options[MEAS_LATENCY] || options[MEAS_THROUGHPUT] || options[EXTENSION] || options[CONCURRENT_THROUGHPUT] || options[NODE_MAP] || options[INTERCONNECT] || options[C2C_LATENCY] || options[C2C_BANDWIDTH] || options[ATOMICS] || options[FALSE_SHARING] || options[FLUSH] || options[COPY] || options[GATHER] || options[MULTI_STREAM] || options[UNALIGNED] || options[DATA_SENSITIVITY] || options[TILED] || options[ROOFLINE]) { //User explicitly picked at least one mode, so override default selection
         run_latency_ = false;
         run_throughput_ = false;
         run_extensions_ = false;
@@ -202,6 +266,23 @@ int32_t Configurator::configureFromInput(int argc, char* argv[]) {
             curr = curr->next();
         }
     }
+
+    //Check delay sweep for the delay-injected loaded latency benchmark extension
+#ifdef EXT_DELAY_INJECTED_LOADED_LATENCY_BENCHMARK
+    if (options[DELAY_SWEEP]) {
+        if (!check_single_option_occurrence(&options[DELAY_SWEEP]))
+            goto error;
+
+        if (!parse_delay_sweep(std::string(options[DELAY_SWEEP].arg)))
+            goto error;
+    } else if (!parse_delay_sweep(std::string(EXT_DELAY_INJECTED_LOADED_LATENCY_BENCHMARK_DEFAULT_DELAY_SWEEP)))
+        goto error;
+#else
+    if (options[DELAY_SWEEP]) {
+        std::cerr << "ERROR: The delay sweep option requires the delay-injected loaded latency benchmark extension, which was not included at build time." << std::endl;
+        goto error;
+    }
+#endif
     
     //Check working set size
     if (options[WORKING_SET_SIZE_PER_THREAD]) { //Override default value with user-specified value
@@ -217,6 +298,22 @@ int32_t Configurator::configureFromInput(int argc, char* argv[]) {
 
         working_set_size_per_thread_ = working_set_size_KB * KB; //convert to bytes
     }
+
+    //Check working set size sweep
+    if (options[WORKING_SET_SIZE_SWEEP]) {
+        if (!check_single_option_occurrence(&options[WORKING_SET_SIZE_SWEEP]))
+            goto error;
+
+        if (options[WORKING_SET_SIZE_PER_THREAD]) {
+            std::cerr << "ERROR: The working set size and working set size sweep options cannot be used in tandem." << std::endl;
+            goto error;
+        }
+
+        if (!parse_working_set_size_sweep(std::string(options[WORKING_SET_SIZE_SWEEP].arg)))
+            goto error;
+
+        use_working_set_size_sweep_ = true;
+    }
     
     //Check NUMA selection
 #ifndef HAS_NUMA
@@ -328,6 +425,71 @@ int32_t Configurator::configureFromInput(int argc, char* argv[]) {
             goto error;
         }
     }
+
+    //Check worker thread count sweep
+    if (options[NUM_WORKER_THREADS_SWEEP]) {
+        if (!check_single_option_occurrence(&options[NUM_WORKER_THREADS_SWEEP]))
+            goto error;
+
+        if (options[NUM_WORKER_THREADS]) {
+            std::cerr << "ERROR: The number of worker threads and worker thread count sweep options cannot be used in tandem." << std::endl;
+            goto error;
+        }
+
+        if (!parse_num_worker_threads_sweep(std::string(options[NUM_WORKER_THREADS_SWEEP].arg)))
+            goto error;
+
+        use_num_worker_threads_sweep_ = true;
+    }
+
+    //Check concurrent all-node throughput mode and its placements
+    if (options[CONCURRENT_THROUGHPUT] || options[NODE_MAP]) {
+        if (use_working_set_size_sweep_ || use_num_worker_threads_sweep_) {
+            std::cerr << "ERROR: The concurrent all-node throughput mode cannot be used in tandem with the sweep options." << std::endl;
+            goto error;
+        }
+
+        run_concurrent_throughput_ = true;
+
+        if (options[NODE_MAP]) { //User-mapped placements
+            Option* curr = options[NODE_MAP];
+            while (curr) { //NODE_MAP may occur more than once, this is perfectly OK.
+                uint32_t cpu_node = 0;
+                uint32_t mem_node = 0;
+                if (!parse_node_pair(std::string(curr->arg), cpu_node, mem_node))
+                    goto error;
+
+                concurrent_placements_.push_back(std::pair<uint32_t, uint32_t>(cpu_node, mem_node));
+                curr = curr->next();
+            }
+        } else { //Default: local traffic on every node that is both a selected CPU node and a selected memory node
+            for (auto cpu_it = cpu_numa_node_affinities_.cbegin(); cpu_it != cpu_numa_node_affinities_.cend(); cpu_it++) {
+                for (auto mem_it = memory_numa_node_affinities_.cbegin(); mem_it != memory_numa_node_affinities_.cend(); mem_it++) {
+                    if (*cpu_it == *mem_it)
+                        concurrent_placements_.push_back(std::pair<uint32_t, uint32_t>(*cpu_it, *mem_it));
+                }
+            }
+
+            if (concurrent_placements_.empty()) {
+                std::cerr << "ERROR: The concurrent all-node throughput mode needs at least one NUMA node that is included in both the CPU and memory NUMA node affinities." << std::endl;
+                goto error;
+            }
+        }
+
+        //Make sure placements that share a CPU node fit on distinct logical CPUs
+        uint32_t cpus_per_node = g_num_logical_cpus / g_num_numa_nodes;
+        for (auto it = concurrent_placements_.cbegin(); it != concurrent_placements_.cend(); it++) {
+            uint32_t threads_on_node = 0;
+            for (auto it2 = concurrent_placements_.cbegin(); it2 != concurrent_placements_.cend(); it2++) {
+                if (it2->first == it->first)
+                    threads_on_node += num_worker_threads_;
+            }
+            if (threads_on_node > cpus_per_node) {
+                std::cerr << "WARNING: Concurrent all-node throughput mode places " << threads_on_node << " worker threads on CPU NUMA node " << it->first << ", but there are only " << cpus_per_node << " logical CPUs per NUMA node. Some threads may not be pinned to CPUs in the intended node." << std::endl;
+                break;
+            }
+        }
+    }
     
     //Check chunk sizes
     if (options[CHUNK_SIZE]) {
@@ -437,7 +599,7 @@ int32_t Configurator::configureFromInput(int argc, char* argv[]) {
     }
 
     //Check if reads and/or writes should be used in throughput and loaded latency benchmarks
-    if (options[USE_READS] || options[USE_WRITES]) { //override defaults
+    if (options[USE_READS] || options[USE_WRITES] || options[RW_MIX] || options[USE_READ_MODIFY_WRITE]) { //override defaults
         use_reads_ = false;
         use_writes_ = false;
     }
@@ -448,6 +610,29 @@ int32_t Configurator::configureFromInput(int argc, char* argv[]) {
     if (options[USE_WRITES])
         use_writes_ = true;
 
+    if (options[USE_READ_MODIFY_WRITE])
+        use_read_modify_write_ = true;
+
+    if (options[RW_MIX]) {
+        Option* curr = options[RW_MIX];
+        while (curr) { //RW_MIX may occur more than once, this is perfectly OK.
+            std::string ratio(curr->arg);
+            if (ratio == "1:1")
+                rw_mixes_.push_back(READ_WRITE_1_1);
+            else if (ratio == "2:1")
+                rw_mixes_.push_back(READ_WRITE_2_1);
+            else if (ratio == "3:1")
+                rw_mixes_.push_back(READ_WRITE_3_1);
+            else {
+                std::cerr << "ERROR: Unsupported read/write mix " << ratio << ". It must be 1:1, 2:1, or 3:1." << std::endl;
+                goto error;
+            }
+            curr = curr->next();
+        }
+        rw_mixes_.sort();
+        rw_mixes_.unique();
+    }
+
     //Check stride sizes
     if (options[STRIDE_SIZE]) { //override defaults
         use_stride_p1_ = false;
@@ -505,227 +690,1305 @@ int32_t Configurator::configureFromInput(int argc, char* argv[]) {
         }
     }
 
-    //Make sure at least one mode is available
-    if (!run_latency_ && !run_throughput_ && !run_extensions_) {
-        std::cerr << "ERROR: At least one benchmark type must be selected." << std::endl;
-        goto error;
-    }
+    //Check load placements for loaded latency benchmarks
+    if (options[LOAD_NODE_MAP]) {
+        Option* curr = options[LOAD_NODE_MAP];
+        while (curr) { //LOAD_NODE_MAP may occur more than once, this is perfectly OK.
+            uint32_t cpu_node = 0;
+            uint32_t mem_node = 0;
+            if (!parse_node_pair(std::string(curr->arg), cpu_node, mem_node))
+                goto error;
 
-    //Make sure at least one access pattern is selectee
-    if (!use_random_access_pattern_ && !use_sequential_access_pattern_) {
-        std::cerr << "ERROR: No access pattern was specified!" << std::endl;    
-        goto error;
-    }
-    
-    //Make sure at least one read/write pattern is selected
-    if (!use_reads_ && !use_writes_) {
-        std::cerr << "ERROR: Throughput benchmark was selected, but no read/write pattern was specified!" << std::endl; 
-        goto error;
-    }
+            latency_load_placements_.push_back(std::pair<uint32_t, uint32_t>(cpu_node, mem_node));
+            curr = curr->next();
+        }
 
-    //If the user picked "all" option, override anything else they put in that is relevant.
-    if (options[ALL]) {
-        run_latency_ = true;
-        run_throughput_ = true;
-        run_extensions_ = true;
-#ifdef EXT_DELAY_INJECTED_LOADED_LATENCY_BENCHMARK
-        run_ext_delay_injected_loaded_latency_benchmark_ = true;
-#endif
-#ifdef EXT_STREAM_BENCHMARK
-        run_ext_stream_benchmark_ = true;
-#endif
-        use_chunk_32b_ = true;
-#ifdef HAS_WORD_64
-        use_chunk_64b_ = true;
-#endif
-#ifdef HAS_WORD_128
-        use_chunk_128b_ = true;
-#endif
-#ifdef HAS_WORD_256
-        use_chunk_256b_ = true;
-#endif
-#ifdef HAS_WORD_512
-        use_chunk_512b = true;
-#endif
-        use_random_access_pattern_ = true; 
-        use_sequential_access_pattern_ = true;
-        use_reads_ = true;
-        use_writes_ = true;
-        use_stride_p1_ = true;
-        use_stride_n1_ = true;
-        use_stride_p2_ = true;
-        use_stride_n2_ = true;
-        use_stride_p4_ = true;
-        use_stride_n4_ = true;
-        use_stride_p8_ = true;
-        use_stride_n8_ = true;
-        use_stride_p16_ = true;
-        use_stride_n16_ = true;
+        if (getMaxNumWorkerThreads() < 2)
+            std::cerr << "WARNING: Load placements only apply to loaded latency benchmarks, which need at least 2 worker threads." << std::endl;
     }
-    
-#ifdef HAS_WORD_64
-    //Notify that 32-bit chunks are not used on random throughput benchmarks on 64-bit machines
-    if (use_random_access_pattern_ && use_chunk_32b_) 
-        std::cerr << "NOTE: Random-access load kernels used in throughput and loaded latency benchmarks do not support 32-bit chunk sizes on 64-bit machines. These particular combinations will be omitted." << std::endl;
-#endif
 
-    //Check for help or bad options
-    if (options[HELP] || options[UNKNOWN] != NULL)
-        goto errorWithUsage;
-    
-    //Report final runtime configuration based on user inputs
-    std::cout << std::endl;
-    if (verbose_) {
-        std::cout << "Verbose output enabled!" << std::endl;
+    //Check target load bandwidth for loaded latency benchmarks
+    if (options[LOAD_BANDWIDTH]) {
+        if (!check_single_option_occurrence(&options[LOAD_BANDWIDTH]))
+            goto error;
 
-        std::cout << "Benchmarking modes:" << std::endl;
-        if (run_throughput_)
-            std::cout << "---> Throughput" << std::endl;
-        if (run_latency_) {
-            std::cout << "---> ";
-            if (num_worker_threads_ > 1)
-                std::cout << "Loaded ";
-            else
-                std::cout << "Unloaded ";
-            std::cout << "latency" << std::endl;
+        char* endptr = NULL;
+        load_target_bandwidth_ = strtod(options[LOAD_BANDWIDTH].arg, &endptr);
+        if (endptr == options[LOAD_BANDWIDTH].arg || *endptr != '\0' || load_target_bandwidth_ <= 0) {
+            std::cerr << "ERROR: Target load bandwidth must be a positive number of MB/s." << std::endl;
+            goto error;
         }
-        if (run_extensions_)
-            std::cout << "---> Extensions" << std::endl;
-        std::cout << std::endl;
-        
-        std::cout << "Benchmark settings:" << std::endl;
-        std::cout << "---> Random access:                   ";
-        if (use_random_access_pattern_)
-            std::cout << "yes";
-        else
-            std::cout << "no";
-        std::cout << std::endl;
-        std::cout << "---> Sequential access:               ";
-        if (use_sequential_access_pattern_)
-            std::cout << "yes";
-        else
-            std::cout << "no";
-        std::cout << std::endl;
-        std::cout << "---> Use memory reads:                ";
-        if (use_reads_)
-            std::cout << "yes";
-        else
-            std::cout << "no";
-        std::cout << std::endl;
-        std::cout << "---> Use memory writes:               ";
-        if (use_writes_)
-            std::cout << "yes";
-        else
-            std::cout << "no";
-        std::cout << std::endl;
-        std::cout << "---> Chunk sizes:                     ";
-        if (use_chunk_32b_)
-            std::cout << "32 ";
-#ifdef HAS_WORD_64
-        if (use_chunk_64b_)
-            std::cout << "64 ";
-#endif
-#ifdef HAS_WORD_128
-        if (use_chunk_128b_)
-            std::cout << "128 ";
-#endif
-#ifdef HAS_WORD_256
-        if (use_chunk_256b_)
-            std::cout << "256 ";
-#endif
-#ifdef HAS_WORD_512
-        if (use_chunk_512b)
-            std::cout << "512 ";
-#endif
-        std::cout << std::endl;
-        std::cout << "---> Stride sizes:                    ";
-        if (use_stride_p1_)
-            std::cout << "1 ";
-        if (use_stride_n1_)
-            std::cout << "-1 ";
-        if (use_stride_p2_)
-            std::cout << "2 ";
-        if (use_stride_n2_)
-            std::cout << "-2 ";
-        if (use_stride_p4_)
-            std::cout << "4 ";
-        if (use_stride_n4_)
-            std::cout << "-4 ";
-        if (use_stride_p8_)
-            std::cout << "8 ";
-        if (use_stride_n8_)
-            std::cout << "-8 ";
-        if (use_stride_p16_)
-            std::cout << "16 ";
-        if (use_stride_n16_)
-            std::cout << "-16 ";
-        std::cout << std::endl;
-        std::cout << "---> Number of worker threads:        ";
-        std::cout << num_worker_threads_ << std::endl;
-        std::cout << "---> NUMA enabled:                    ";
-#ifdef HAS_NUMA
-        if (numa_enabled_)
-            std::cout << "yes" << std::endl;
-        else
-            std::cout << "no" << std::endl;
-        std::cout << "------> CPU NUMA node affinities:     ";
-        for (auto it = cpu_numa_node_affinities_.cbegin(); it != cpu_numa_node_affinities_.cend(); it++)
-            std::cout << *it << " ";
-        std::cout << std::endl;
-        std::cout << "------> Memory NUMA node affinities:  ";
-        for (auto it = memory_numa_node_affinities_.cbegin(); it != memory_numa_node_affinities_.cend(); it++)
-            std::cout << *it << " ";
-        std::cout << std::endl;
-#else
-        std::cout << "not supported" << std::endl;
-#endif
-        std::cout << "---> Large pages:                     ";
-#ifdef HAS_LARGE_PAGES
-        if (use_large_pages_)
-            std::cout << "yes" << std::endl;
-        else
-            std::cout << "no" << std::endl;
-#else
-        std::cout << "not supported" << std::endl;
-#endif
-        std::cout << "---> Iterations:                      ";
-        std::cout << iterations_ << std::endl;
-        std::cout << "---> Starting test index:             ";
-        std::cout << starting_test_index_ << std::endl;
-        std::cout << std::endl;
-    }
 
-        std::cout << "Working set per thread:               ";
-    if (use_large_pages_) {
-        size_t num_large_pages = 0;
-        if (working_set_size_per_thread_ <= g_large_page_size) //sub one large page, round up to one
-            num_large_pages = 1;
-        else if (working_set_size_per_thread_ % g_large_page_size == 0) //multiple of large page
-            num_large_pages = working_set_size_per_thread_ / g_large_page_size;
-        else //larger than one large page but not a multiple of large page
-            num_large_pages = working_set_size_per_thread_ / g_large_page_size + 1;
-        std::cout << working_set_size_per_thread_ << " B == " << working_set_size_per_thread_ / KB  << " KB == " << working_set_size_per_thread_ / MB << " MB (fits in " << num_large_pages << " large pages)" << std::endl; 
-    } else { 
-        std::cout << working_set_size_per_thread_ << " B == " << working_set_size_per_thread_ / KB  << " KB == " << working_set_size_per_thread_ / MB << " MB (" << working_set_size_per_thread_/(g_page_size) << " pages)" << std::endl;   
+        if (getMaxNumWorkerThreads() < 2 && !options[INTERFERE])
+            std::cerr << "WARNING: The target load bandwidth only applies to loaded latency benchmarks, which need at least 2 worker threads, and to the interference generator mode." << std::endl;
     }
 
-    //Free up options memory
-    delete[] options;
-    delete[] buffer;
+    //Check time-varying load profile for loaded latency benchmarks
+    if (options[LOAD_PROFILE] || options[LOAD_BURST]) {
+        if (options[LOAD_PROFILE] && options[LOAD_BURST]) {
+            std::cerr << "ERROR: The load_profile and load_burst options cannot be used in tandem." << std::endl;
+            goto error;
+        }
 
-    return 0;
+        if (load_target_bandwidth_ > 0) {
+            std::cerr << "ERROR: A load profile cannot be used in tandem with the load_bandwidth option." << std::endl;
+            goto error;
+        }
 
-    errorWithUsage:
-        printUsage(std::cerr, usage); //Display help message
+        if (options[LOAD_PROFILE]) {
+            if (!check_single_option_occurrence(&options[LOAD_PROFILE]))
+                goto error;
+            if (!load_profile_.loadFile(std::string(options[LOAD_PROFILE].arg)))
+                goto error;
+        } else {
+            if (!check_single_option_occurrence(&options[LOAD_BURST]))
+                goto error;
+            if (!parse_load_burst(std::string(options[LOAD_BURST].arg)))
+                goto error;
+        }
 
-    error:
+        if (getMaxNumWorkerThreads() < 2)
+            std::cerr << "WARNING: The load profile only applies to loaded latency benchmarks, which need at least 2 worker threads." << std::endl;
+    }
 
-        //Free up options memory
-        delete[] options;
-        delete[] buffer;
+    if (options[LATENCY_TRACE]) {
+        if (!check_single_option_occurrence(&options[LATENCY_TRACE]))
+            goto error;
 
-        return -1;
-}
+        if (load_profile_.isEmpty())
+            std::cerr << "WARNING: The latency trace is only recorded with the load_profile or load_burst options." << std::endl;
+        else {
+            latency_trace_filename_ = options[LATENCY_TRACE].arg;
+            use_latency_trace_file_ = true;
+        }
+    }
+
+    //Check NUMA interconnect mode
+    if (options[INTERCONNECT]) {
+        if (use_working_set_size_sweep_ || use_num_worker_threads_sweep_) {
+            std::cerr << "ERROR: The NUMA interconnect mode cannot be used in tandem with the sweep options." << std::endl;
+            goto error;
+        }
+
+        if (cpu_numa_node_affinities_.size() < 2 && memory_numa_node_affinities_.size() < 2) {
+            std::cerr << "ERROR: The NUMA interconnect mode requires at least two CPU or memory NUMA nodes." << std::endl;
+            goto error;
+        }
+
+        //In the all-to-all run, every CPU node except the local one shares each memory node, and each CPU node hosts one placement per remote memory node.
+        uint32_t cpus_per_node = g_num_logical_cpus / g_num_numa_nodes;
+        if (num_worker_threads_ * memory_numa_node_affinities_.size() > cpus_per_node)
+            std::cerr << "WARNING: The all-to-all NUMA interconnect run places up to " << num_worker_threads_ * memory_numa_node_affinities_.size() << " worker threads on a CPU NUMA node, but there are only " << cpus_per_node << " logical CPUs per NUMA node. Some threads may not be pinned to CPUs in the intended node." << std::endl;
+
+        run_interconnect_ = true;
+    }
+
+    //Check all-core latency mode
+    if (options[ALL_CORE_LATENCY]) {
+        if (options[LOAD_NODE_MAP] || load_target_bandwidth_ > 0 || !load_profile_.isEmpty()) {
+            std::cerr << "ERROR: The all-core latency mode has no load threads, so it cannot be used in tandem with the load_node_map, load_bandwidth, load_profile, or load_burst options." << std::endl;
+            goto error;
+        }
+
+        if (!run_latency_)
+            std::cerr << "WARNING: The all-core latency mode only applies to latency benchmarks." << std::endl;
+
+        all_core_latency_ = true;
+    }
+
+    //Check cold-cache latency mode
+    if (options[COLD_CACHE]) {
+#ifndef ARCH_INTEL
+        std::cerr << "ERROR: The cold-cache latency mode is only available on x86 processors." << std::endl;
+        goto error;
+#else
+        if (!load_profile_.isEmpty()) {
+            std::cerr << "ERROR: The cold-cache latency mode cannot be used in tandem with the load_profile or load_burst options." << std::endl;
+            goto error;
+        }
+
+        if (!run_latency_)
+            std::cerr << "WARNING: The cold-cache latency mode only applies to latency benchmarks." << std::endl;
+
+        cold_cache_latency_ = true;
+#endif
+    }
+
+    //Check interference generator mode
+    if (options[INTERFERE]) {
+        if (!check_single_option_occurrence(&options[INTERFERE]))
+            goto error;
+
+        if (options[MEAS_LATENCY] || options[MEAS_THROUGHPUT] || options[EXTENSION] || options[CONCURRENT_THROUGHPUT] || options[NODE_MAP] || options[INTERCONNECT] || options[C2C_LATENCY] || options[C2C_BANDWIDTH] || options[ATOMICS] || options[FALSE_SHARING] || options[FLUSH] || options[COPY] || options[GATHER] || options[MULTI_STREAM] || options[UNALIGNED] || options[DATA_SENSITIVITY] || options[TILED] || options[ROOFLINE] || options[ALL]) {
+            std::cerr << "ERROR: The interference generator mode cannot be used in tandem with other benchmarking modes." << std::endl;
+            goto error;
+        }
+
+        if (use_working_set_size_sweep_ || use_num_worker_threads_sweep_ || !load_profile_.isEmpty()) {
+            std::cerr << "ERROR: The interference generator mode cannot be used in tandem with the sweep or load profile options." << std::endl;
+            goto error;
+        }
+
+        char* endptr = NULL;
+        interference_duration_s_ = static_cast<uint32_t>(strtoul(options[INTERFERE].arg, &endptr, 10));
+        run_interference_ = true;
+        run_latency_ = false;
+        run_throughput_ = false;
+        run_extensions_ = false;
+    }
+
+    if (options[REPORT_INTERVAL]) {
+        if (!check_single_option_occurrence(&options[REPORT_INTERVAL]))
+            goto error;
+
+        if (!options[INTERFERE])
+            std::cerr << "WARNING: The report interval only applies to the interference generator mode." << std::endl;
+
+        char* endptr = NULL;
+        interference_report_interval_ms_ = static_cast<uint32_t>(strtoul(options[REPORT_INTERVAL].arg, &endptr, 10));
+    }
+
+    //Check core-to-core latency mode
+    if (options[C2C_LATENCY]) {
+        if (use_working_set_size_sweep_ || use_num_worker_threads_sweep_) {
+            std::cerr << "ERROR: The core-to-core latency mode cannot be used in tandem with the sweep options." << std::endl;
+            goto error;
+        }
+
+        run_c2c_latency_ = true;
+    }
+
+    if (options[C2C_CPU_STEP]) {
+        if (!check_single_option_occurrence(&options[C2C_CPU_STEP]))
+            goto error;
+
+        if (!options[C2C_LATENCY] && !options[ATOMICS] && !options[FALSE_SHARING])
+            std::cerr << "WARNING: The CPU step only applies to the core-to-core benchmarks." << std::endl;
+
+        char* endptr = NULL;
+        c2c_cpu_step_ = static_cast<uint32_t>(strtoul(options[C2C_CPU_STEP].arg, &endptr, 10));
+    }
+
+    //Check core-to-core bandwidth mode
+    if (options[C2C_BANDWIDTH]) {
+        if (use_working_set_size_sweep_ || use_num_worker_threads_sweep_) {
+            std::cerr << "ERROR: The core-to-core bandwidth mode cannot be used in tandem with the sweep options." << std::endl;
+            goto error;
+        }
+
+        run_c2c_bandwidth_ = true;
+    }
+
+    if (options[C2C_PAIR]) {
+        Option* curr = options[C2C_PAIR];
+        while (curr) { //C2C_PAIR may occur more than once, this is perfectly OK.
+            uint32_t first_cpu = 0;
+            uint32_t second_cpu = 0;
+            if (!parse_cpu_pair(std::string(curr->arg), first_cpu, second_cpu))
+                goto error;
+
+            c2c_pairs_.push_back(std::pair<uint32_t, uint32_t>(first_cpu, second_cpu));
+            curr = curr->next();
+        }
+
+        if (!options[C2C_LATENCY] && !options[C2C_BANDWIDTH] && !options[FALSE_SHARING])
+            std::cerr << "WARNING: CPU pairs only apply to the core-to-core benchmarks." << std::endl;
+    }
+
+    if (options[C2C_BLOCK_SIZE]) {
+        Option* curr = options[C2C_BLOCK_SIZE];
+        while (curr) { //C2C_BLOCK_SIZE may occur more than once, this is perfectly OK.
+            char* endptr = NULL;
+            size_t block_size = static_cast<size_t>(strtoul(curr->arg, &endptr, 10));
+            if (block_size % CACHE_LINE_SIZE != 0) {
+                std::cerr << "ERROR: Core-to-core block size " << block_size << " B is not a multiple of " << CACHE_LINE_SIZE << " B." << std::endl;
+                goto error;
+            }
+            if (2 * block_size > working_set_size_per_thread_) {
+                std::cerr << "ERROR: Core-to-core block size " << block_size << " B does not fit twice in the ring buffer of " << working_set_size_per_thread_ << " B. Increase the working set size per thread." << std::endl;
+                goto error;
+            }
+            c2c_block_sizes_.push_back(block_size);
+            curr = curr->next();
+        }
+        c2c_block_sizes_.sort();
+        c2c_block_sizes_.unique();
+
+        if (!options[C2C_BANDWIDTH])
+            std::cerr << "WARNING: Block sizes only apply to the core-to-core bandwidth mode." << std::endl;
+    } else if (2 * C2C_BANDWIDTH_DEFAULT_BLOCK_SIZE <= working_set_size_per_thread_)
+        c2c_block_sizes_.push_back(C2C_BANDWIDTH_DEFAULT_BLOCK_SIZE);
+    else
+        c2c_block_sizes_.push_back(working_set_size_per_thread_ / 2);
+
+    //Check atomic operation mode
+    if (options[ATOMICS]) {
+        if (use_working_set_size_sweep_ || use_num_worker_threads_sweep_) {
+            std::cerr << "ERROR: The atomic operation mode cannot be used in tandem with the sweep options." << std::endl;
+            goto error;
+        }
+
+        run_atomics_ = true;
+    }
+
+    if (options[ATOMIC_OP]) {
+        Option* curr = options[ATOMIC_OP];
+        while (curr) { //ATOMIC_OP may occur more than once, this is perfectly OK.
+            std::string op(curr->arg);
+            if (op == "xadd")
+                atomic_ops_.push_back(ATOMIC_FETCH_ADD);
+            else if (op == "cmpxchg")
+                atomic_ops_.push_back(ATOMIC_COMPARE_EXCHANGE);
+            else if (op == "xchg")
+                atomic_ops_.push_back(ATOMIC_EXCHANGE);
+            else {
+                std::cerr << "ERROR: Unknown atomic operation " << op << ". It must be xadd, cmpxchg, or xchg." << std::endl;
+                goto error;
+            }
+            curr = curr->next();
+        }
+        atomic_ops_.sort();
+        atomic_ops_.unique();
+
+        if (!options[ATOMICS])
+            std::cerr << "WARNING: Atomic operations only apply to the atomic operation mode." << std::endl;
+    } else {
+        for (uint32_t op = 0; op < NUM_ATOMIC_OPS; op++)
+            atomic_ops_.push_back(static_cast<atomic_op_t>(op));
+    }
+
+    if (options[ATOMIC_SHARING]) {
+        Option* curr = options[ATOMIC_SHARING];
+        while (curr) { //ATOMIC_SHARING may occur more than once, this is perfectly OK.
+            std::string sharing(curr->arg);
+            if (sharing == "private")
+                atomic_sharing_modes_.push_back(ATOMIC_PRIVATE);
+            else if (sharing == "shared")
+                atomic_sharing_modes_.push_back(ATOMIC_SHARED);
+            else if (sharing == "spread")
+                atomic_sharing_modes_.push_back(ATOMIC_SPREAD);
+            else {
+                std::cerr << "ERROR: Unknown atomic sharing mode " << sharing << ". It must be private, shared, or spread." << std::endl;
+                goto error;
+            }
+            curr = curr->next();
+        }
+        atomic_sharing_modes_.sort();
+        atomic_sharing_modes_.unique();
+
+        if (!options[ATOMICS])
+            std::cerr << "WARNING: Atomic sharing modes only apply to the atomic operation mode." << std::endl;
+    } else {
+        for (uint32_t sharing = 0; sharing < NUM_ATOMIC_SHARING_MODES; sharing++)
+            atomic_sharing_modes_.push_back(static_cast<atomic_sharing_t>(sharing));
+    }
+
+    if (options[ATOMIC_ADDRESSES]) {
+        if (!check_single_option_occurrence(&options[ATOMIC_ADDRESSES]))
+            goto error;
+
+        if (!options[ATOMICS])
+            std::cerr << "WARNING: The number of atomic addresses only applies to the atomic operation mode." << std::endl;
+
+        char* endptr = NULL;
+        atomic_spread_addresses_ = static_cast<uint32_t>(strtoul(options[ATOMIC_ADDRESSES].arg, &endptr, 10));
+    }
+
+    //Check false sharing mode
+    if (options[FALSE_SHARING]) {
+        if (use_working_set_size_sweep_ || use_num_worker_threads_sweep_) {
+            std::cerr << "ERROR: The false sharing mode cannot be used in tandem with the sweep options." << std::endl;
+            goto error;
+        }
+
+        run_false_sharing_ = true;
+    }
+
+    if (options[FALSE_SHARING_PADDING]) {
+        Option* curr = options[FALSE_SHARING_PADDING];
+        while (curr) { //FALSE_SHARING_PADDING may occur more than once, this is perfectly OK.
+            char* endptr = NULL;
+            uint32_t padding = static_cast<uint32_t>(strtoul(curr->arg, &endptr, 10));
+            if (padding % sizeof(uint64_t) != 0 || padding > FALSE_SHARING_MAX_PADDING) {
+                std::cerr << "ERROR: False sharing padding " << padding << " B must be a multiple of " << sizeof(uint64_t) << " B and at most " << FALSE_SHARING_MAX_PADDING << " B." << std::endl;
+                goto error;
+            }
+            false_sharing_paddings_.push_back(padding);
+            curr = curr->next();
+        }
+        false_sharing_paddings_.sort();
+        false_sharing_paddings_.unique();
+
+        if (!options[FALSE_SHARING])
+            std::cerr << "WARNING: Paddings only apply to the false sharing mode." << std::endl;
+    } else {
+        false_sharing_paddings_.push_back(0);
+        false_sharing_paddings_.push_back(8);
+        false_sharing_paddings_.push_back(24);
+        false_sharing_paddings_.push_back(56);
+        false_sharing_paddings_.push_back(120);
+    }
+
+    if (options[FALSE_SHARING_WORK]) {
+        if (!check_single_option_occurrence(&options[FALSE_SHARING_WORK]))
+            goto error;
+
+        if (!options[FALSE_SHARING])
+            std::cerr << "WARNING: The work between writes only applies to the false sharing mode." << std::endl;
+
+        char* endptr = NULL;
+        false_sharing_work_ = static_cast<uint32_t>(strtoul(options[FALSE_SHARING_WORK].arg, &endptr, 10));
+    }
+
+    //Check cache flush mode
+    if (options[FLUSH]) {
+#ifndef ARCH_INTEL
+        std::cerr << "ERROR: The cache flush mode is only available on x86 processors." << std::endl;
+        goto error;
+#else
+        run_flush_ = true;
+#endif
+    }
+
+    if (options[FLUSH_OP]) {
+        Option* curr = options[FLUSH_OP];
+        while (curr) { //FLUSH_OP may occur more than once, this is perfectly OK.
+            std::string op(curr->arg);
+            flush_op_t flush_op;
+            if (op == "clflush")
+                flush_op = FLUSH_CLFLUSH;
+            else if (op == "clflushopt")
+                flush_op = FLUSH_CLFLUSHOPT;
+            else if (op == "clwb")
+                flush_op = FLUSH_CLWB;
+            else {
+                std::cerr << "ERROR: Unknown flush instruction " << op << ". It must be clflush, clflushopt, or clwb." << std::endl;
+                goto error;
+            }
+
+            if (!flush_op_supported(flush_op)) {
+                std::cerr << "ERROR: The processor does not support the " << op << " instruction." << std::endl;
+                goto error;
+            }
+            flush_ops_.push_back(flush_op);
+            curr = curr->next();
+        }
+        flush_ops_.sort();
+        flush_ops_.unique();
+
+        if (!options[FLUSH])
+            std::cerr << "WARNING: Flush instructions only apply to the cache flush mode." << std::endl;
+    } else {
+        for (uint32_t op = 0; op < NUM_FLUSH_OPS; op++) {
+            if (flush_op_supported(static_cast<flush_op_t>(op)))
+                flush_ops_.push_back(static_cast<flush_op_t>(op));
+        }
+
+        if (run_flush_ && flush_ops_.empty()) {
+            std::cerr << "ERROR: The processor does not support any cache line flush instruction." << std::endl;
+            goto error;
+        }
+    }
+
+    //Check copy/fill mode
+    if (options[COPY]) {
+        if (use_working_set_size_sweep_ || use_num_worker_threads_sweep_) {
+            std::cerr << "ERROR: The copy/fill mode cannot be used in tandem with the sweep options." << std::endl;
+            goto error;
+        }
+
+        run_copy_ = true;
+    }
+
+    if (options[COPY_ENGINE]) {
+        Option* curr = options[COPY_ENGINE];
+        while (curr) { //COPY_ENGINE may occur more than once, this is perfectly OK.
+            std::string name(curr->arg);
+            uint32_t engine = 0;
+            while (engine < NUM_COPY_ENGINES && copy_engine_name(static_cast<copy_engine_t>(engine)) != name)
+                engine++;
+            if (engine == NUM_COPY_ENGINES) {
+                std::cerr << "ERROR: Unknown copy engine " << name << ". It must be memcpy, memmove, memset, movsb, stosb, vector, vector_nt, vector_fill, or vector_fill_nt." << std::endl;
+                goto error;
+            }
+
+            CopyFunction kernel = NULL;
+            CopyFunction dummy_kernel = NULL;
+            if (!determine_copy_kernel(static_cast<copy_engine_t>(engine), &kernel, &dummy_kernel)) {
+                std::cerr << "ERROR: The " << name << " copy engine is not available on this build." << std::endl;
+                goto error;
+            }
+            copy_engines_.push_back(static_cast<copy_engine_t>(engine));
+            curr = curr->next();
+        }
+        copy_engines_.sort();
+        copy_engines_.unique();
+
+        if (!options[COPY])
+            std::cerr << "WARNING: Copy engines only apply to the copy/fill mode." << std::endl;
+    } else {
+        for (uint32_t engine = 0; engine < NUM_COPY_ENGINES; engine++) {
+            CopyFunction kernel = NULL;
+            CopyFunction dummy_kernel = NULL;
+            if (determine_copy_kernel(static_cast<copy_engine_t>(engine), &kernel, &dummy_kernel))
+                copy_engines_.push_back(static_cast<copy_engine_t>(engine));
+        }
+    }
+
+    if (options[COPY_SIZE_FILE]) {
+        if (!check_single_option_occurrence(&options[COPY_SIZE_FILE]))
+            goto error;
+
+        if (!options[COPY])
+            std::cerr << "WARNING: The copy size distribution only applies to the copy/fill mode." << std::endl;
+
+        if (!copy_size_distribution_.loadFile(std::string(options[COPY_SIZE_FILE].arg)))
+            goto error;
+
+        if (copy_size_distribution_.getMaxSize() > working_set_size_per_thread_ / 2) {
+            std::cerr << "ERROR: The largest size of the copy size distribution is " << copy_size_distribution_.getMaxSize() << " B, but each copy buffer is only half of the working set size per thread, or " << working_set_size_per_thread_ / 2 << " B." << std::endl;
+            goto error;
+        }
+    }
+
+    if (options[COPY_SIZE]) {
+        Option* curr = options[COPY_SIZE];
+        while (curr) { //COPY_SIZE may occur more than once, this is perfectly OK.
+            char* endptr = NULL;
+            size_t size = static_cast<size_t>(strtoul(curr->arg, &endptr, 10));
+            if (size > working_set_size_per_thread_ / 2) {
+                std::cerr << "ERROR: Copy size " << size << " B is larger than each copy buffer, which is half of the working set size per thread, or " << working_set_size_per_thread_ / 2 << " B." << std::endl;
+                goto error;
+            }
+            copy_sizes_.push_back(size);
+            curr = curr->next();
+        }
+        copy_sizes_.sort();
+        copy_sizes_.unique();
+
+        if (!options[COPY])
+            std::cerr << "WARNING: Copy sizes only apply to the copy/fill mode." << std::endl;
+    } else if (copy_size_distribution_.isEmpty()) {
+        for (size_t size = 64; size <= 4096 && size <= working_set_size_per_thread_ / 2; size *= 4)
+            copy_sizes_.push_back(size);
+    }
+
+    //Check gather/scatter mode
+    if (options[GATHER])
+        run_gather_ = true;
+
+    if (options[GATHER_ENGINE]) {
+        Option* curr = options[GATHER_ENGINE];
+        while (curr) { //GATHER_ENGINE may occur more than once, this is perfectly OK.
+            std::string name(curr->arg);
+            uint32_t engine = 0;
+            while (engine < NUM_GATHER_ENGINES && gather_engine_name(static_cast<gather_engine_t>(engine)) != name)
+                engine++;
+            if (engine == NUM_GATHER_ENGINES) {
+                std::cerr << "ERROR: Unknown gather engine " << name << ". It must be scalar_load, gather_avx2, gather_avx512, scalar_store, or scatter_avx512." << std::endl;
+                goto error;
+            }
+
+            GatherFunction kernel = NULL;
+            GatherFunction dummy_kernel = NULL;
+            if (!determine_gather_kernel(static_cast<gather_engine_t>(engine), &kernel, &dummy_kernel)) {
+                std::cerr << "ERROR: The " << name << " gather engine is not available on this build." << std::endl;
+                goto error;
+            }
+            if (!gather_engine_supported(static_cast<gather_engine_t>(engine))) {
+                std::cerr << "ERROR: The processor does not support the " << name << " gather engine." << std::endl;
+                goto error;
+            }
+            gather_engines_.push_back(static_cast<gather_engine_t>(engine));
+            curr = curr->next();
+        }
+        gather_engines_.sort();
+        gather_engines_.unique();
+
+        if (!options[GATHER])
+            std::cerr << "WARNING: Gather engines only apply to the gather/scatter mode." << std::endl;
+    } else {
+        for (uint32_t engine = 0; engine < NUM_GATHER_ENGINES; engine++) {
+            GatherFunction kernel = NULL;
+            GatherFunction dummy_kernel = NULL;
+            if (determine_gather_kernel(static_cast<gather_engine_t>(engine), &kernel, &dummy_kernel) && gather_engine_supported(static_cast<gather_engine_t>(engine)))
+                gather_engines_.push_back(static_cast<gather_engine_t>(engine));
+        }
+
+        if (run_gather_ && gather_engines_.empty()) {
+            std::cerr << "ERROR: No gather engine is available on this build and processor." << std::endl;
+            goto error;
+        }
+    }
+
+    if (options[GATHER_INDEX]) {
+        Option* curr = options[GATHER_INDEX];
+        while (curr) { //GATHER_INDEX may occur more than once, this is perfectly OK.
+            std::string name(curr->arg);
+            uint32_t pattern = 0;
+            while (pattern < NUM_GATHER_INDEX_PATTERNS && gather_index_name(static_cast<gather_index_t>(pattern)) != name)
+                pattern++;
+            if (pattern == NUM_GATHER_INDEX_PATTERNS) {
+                std::cerr << "ERROR: Unknown gather index pattern " << name << ". It must be sequential, strided, window, or random." << std::endl;
+                goto error;
+            }
+            gather_index_patterns_.push_back(static_cast<gather_index_t>(pattern));
+            curr = curr->next();
+        }
+        gather_index_patterns_.sort();
+        gather_index_patterns_.unique();
+
+        if (!options[GATHER])
+            std::cerr << "WARNING: Gather index patterns only apply to the gather/scatter mode." << std::endl;
+    } else {
+        for (uint32_t pattern = 0; pattern < NUM_GATHER_INDEX_PATTERNS; pattern++)
+            gather_index_patterns_.push_back(static_cast<gather_index_t>(pattern));
+    }
+
+    if (options[GATHER_STRIDE]) {
+        if (!check_single_option_occurrence(&options[GATHER_STRIDE]))
+            goto error;
+
+        if (!options[GATHER])
+            std::cerr << "WARNING: The gather stride only applies to the gather/scatter mode." << std::endl;
+
+        char* endptr = NULL;
+        gather_stride_ = static_cast<size_t>(strtoul(options[GATHER_STRIDE].arg, &endptr, 10));
+    }
+
+    if (options[GATHER_WINDOW]) {
+        if (!check_single_option_occurrence(&options[GATHER_WINDOW]))
+            goto error;
+
+        if (!options[GATHER])
+            std::cerr << "WARNING: The gather window size only applies to the gather/scatter mode." << std::endl;
+
+        char* endptr = NULL;
+        gather_window_size_ = static_cast<size_t>(strtoul(options[GATHER_WINDOW].arg, &endptr, 10));
+        if (gather_window_size_ % 8 != 0) {
+            std::cerr << "ERROR: The gather window size must be a multiple of 8 B." << std::endl;
+            goto error;
+        }
+    }
+
+    //Check multi-stream mode
+    if (options[MULTI_STREAM])
+        run_multi_stream_ = true;
+
+    if (options[STREAM_COUNT]) {
+        Option* curr = options[STREAM_COUNT];
+        while (curr) { //STREAM_COUNT may occur more than once, this is perfectly OK.
+            char* endptr = NULL;
+            uint32_t count = static_cast<uint32_t>(strtoul(curr->arg, &endptr, 10));
+            if (count > MULTI_STREAM_MAX_STREAMS) {
+                std::cerr << "ERROR: Stream count " << count << " is larger than the maximum of " << MULTI_STREAM_MAX_STREAMS << "." << std::endl;
+                goto error;
+            }
+            stream_counts_.push_back(count);
+            curr = curr->next();
+        }
+        stream_counts_.sort();
+        stream_counts_.unique();
+
+        if (!options[MULTI_STREAM])
+            std::cerr << "WARNING: Stream counts only apply to the multi-stream mode." << std::endl;
+    } else {
+        for (uint32_t count = 1; count <= MULTI_STREAM_MAX_STREAMS; count += (count < 16 ? 1 : (count < 32 ? 4 : 8)))
+            stream_counts_.push_back(count);
+    }
+
+    //Check unaligned access mode
+    if (options[UNALIGNED]) {
+#ifndef ARCH_INTEL
+        std::cerr << "ERROR: The unaligned access mode is only available on x86 processors." << std::endl;
+        goto error;
+#else
+        run_unaligned_ = true;
+#endif
+    }
+
+    unaligned_offsets_.push_back(0); //Aligned baseline
+    if (options[UNALIGNED_OFFSET]) {
+        Option* curr = options[UNALIGNED_OFFSET];
+        while (curr) { //UNALIGNED_OFFSET may occur more than once, this is perfectly OK.
+            char* endptr = NULL;
+            size_t offset = static_cast<size_t>(strtoul(curr->arg, &endptr, 10));
+            if (offset >= CACHE_LINE_SIZE) {
+                std::cerr << "ERROR: Unaligned offset " << offset << " B must be less than the " << CACHE_LINE_SIZE << " B cache line size." << std::endl;
+                goto error;
+            }
+            unaligned_offsets_.push_back(offset);
+            curr = curr->next();
+        }
+
+        if (!options[UNALIGNED])
+            std::cerr << "WARNING: Unaligned offsets only apply to the unaligned access mode." << std::endl;
+    } else {
+        unaligned_offsets_.push_back(1);
+        unaligned_offsets_.push_back(4);
+        unaligned_offsets_.push_back(8);
+        unaligned_offsets_.push_back(16);
+        unaligned_offsets_.push_back(32);
+        unaligned_offsets_.push_back(60);
+    }
+    unaligned_offsets_.sort();
+    unaligned_offsets_.unique();
+
+    //Check data pattern mode
+    if (options[DATA_SENSITIVITY])
+        run_data_pattern_ = true;
+
+    if (options[DATA_PATTERN_FILE]) {
+        if (!check_single_option_occurrence(&options[DATA_PATTERN_FILE]))
+            goto error;
+
+        std::ifstream file(options[DATA_PATTERN_FILE].arg, std::ios::binary);
+        if (!file.is_open()) {
+            std::cerr << "ERROR: Failed to open data pattern file " << options[DATA_PATTERN_FILE].arg << std::endl;
+            goto error;
+        }
+        data_pattern_file_data_.resize(DATA_PATTERN_FILE_MAX_SIZE);
+        file.read(reinterpret_cast<char*>(data_pattern_file_data_.data()), DATA_PATTERN_FILE_MAX_SIZE);
+        data_pattern_file_data_.resize(static_cast<size_t>(file.gcount()));
+        if (data_pattern_file_data_.empty()) {
+            std::cerr << "ERROR: Data pattern file " << options[DATA_PATTERN_FILE].arg << " is empty." << std::endl;
+            goto error;
+        }
+    }
+
+    if (options[DATA_PATTERN]) {
+        Option* curr = options[DATA_PATTERN];
+        while (curr) { //DATA_PATTERN may occur more than once, this is perfectly OK.
+            std::string name(curr->arg);
+            uint32_t pattern = 0;
+            while (pattern < NUM_DATA_PATTERNS && data_pattern_name(static_cast<data_pattern_t>(pattern)) != name)
+                pattern++;
+            if (pattern == NUM_DATA_PATTERNS) {
+                std::cerr << "ERROR: Unknown data pattern " << name << ". It must be zeros, ones, alternating, random, or file." << std::endl;
+                goto error;
+            }
+            if (pattern == DATA_FILE && data_pattern_file_data_.empty()) {
+                std::cerr << "ERROR: The file data pattern needs a data pattern file." << std::endl;
+                goto error;
+            }
+            data_patterns_.push_back(static_cast<data_pattern_t>(pattern));
+            curr = curr->next();
+        }
+
+        //The first pattern given initializes memory, before the list is put in order
+        use_data_pattern_init_ = true;
+        data_pattern_init_ = data_patterns_.front();
+        data_patterns_.sort();
+        data_patterns_.unique();
+    } else {
+        for (uint32_t pattern = 0; pattern < NUM_DATA_PATTERNS; pattern++) {
+            if (pattern != DATA_FILE || !data_pattern_file_data_.empty())
+                data_patterns_.push_back(static_cast<data_pattern_t>(pattern));
+        }
+    }
+
+    //Check 2D tiled mode
+    if (options[TILED])
+        run_tiled_ = true;
+
+    if (options[TILE_ORDER]) {
+        Option* curr = options[TILE_ORDER];
+        while (curr) { //TILE_ORDER may occur more than once, this is perfectly OK.
+            std::string name(curr->arg);
+            uint32_t order = 0;
+            while (order < NUM_TILE_ORDERS && tile_order_name(static_cast<tile_order_t>(order)) != name)
+                order++;
+            if (order == NUM_TILE_ORDERS) {
+                std::cerr << "ERROR: Unknown 2D traversal order " << name << ". It must be row, column, blocked, morton, or transpose." << std::endl;
+                goto error;
+            }
+            tile_orders_.push_back(static_cast<tile_order_t>(order));
+            curr = curr->next();
+        }
+        tile_orders_.sort();
+        tile_orders_.unique();
+
+        if (!options[TILED])
+            std::cerr << "WARNING: 2D traversal orders only apply to the 2D tiled mode." << std::endl;
+    } else {
+        for (uint32_t order = 0; order < NUM_TILE_ORDERS; order++)
+            tile_orders_.push_back(static_cast<tile_order_t>(order));
+    }
+
+    if (options[ROW_PITCH]) {
+        if (!check_single_option_occurrence(&options[ROW_PITCH]))
+            goto error;
+
+        if (!options[TILED])
+            std::cerr << "WARNING: The row pitch only applies to the 2D tiled mode." << std::endl;
+
+        char* endptr = NULL;
+        row_pitch_ = static_cast<size_t>(strtoul(options[ROW_PITCH].arg, &endptr, 10));
+        row_width_ = row_pitch_;
+    }
+
+    if (options[ROW_WIDTH]) {
+        if (!check_single_option_occurrence(&options[ROW_WIDTH]))
+            goto error;
+
+        if (!options[TILED])
+            std::cerr << "WARNING: The row width only applies to the 2D tiled mode." << std::endl;
+
+        char* endptr = NULL;
+        row_width_ = static_cast<size_t>(strtoul(options[ROW_WIDTH].arg, &endptr, 10));
+    }
+
+    if (row_pitch_ % 8 != 0 || row_width_ % 8 != 0) {
+        std::cerr << "ERROR: The row pitch and row width must be multiples of 8 B." << std::endl;
+        goto error;
+    }
+    if (row_width_ > row_pitch_) {
+        std::cerr << "ERROR: The row width of " << row_width_ << " B must be at most the row pitch of " << row_pitch_ << " B." << std::endl;
+        goto error;
+    }
+
+    if (options[TILE_WIDTH]) {
+        if (!check_single_option_occurrence(&options[TILE_WIDTH]))
+            goto error;
+
+        if (!options[TILED])
+            std::cerr << "WARNING: The tile width only applies to the 2D tiled mode." << std::endl;
+
+        char* endptr = NULL;
+        tile_width_ = static_cast<size_t>(strtoul(options[TILE_WIDTH].arg, &endptr, 10));
+    }
+
+    if (options[TILE_HEIGHT]) {
+        if (!check_single_option_occurrence(&options[TILE_HEIGHT]))
+            goto error;
+
+        if (!options[TILED])
+            std::cerr << "WARNING: The tile height only applies to the 2D tiled mode." << std::endl;
+
+        char* endptr = NULL;
+        tile_height_ = static_cast<size_t>(strtoul(options[TILE_HEIGHT].arg, &endptr, 10));
+    }
+    if (tile_width_ * sizeof(uint64_t) > row_width_) {
+        std::cerr << "ERROR: The tile width of " << tile_width_ << " elements must be at most the row width of " << row_width_ / sizeof(uint64_t) << " elements." << std::endl;
+        goto error;
+    }
+
+    //Check roofline mode
+    if (options[ROOFLINE])
+        run_roofline_ = true;
+
+    if (options[ROOFLINE_ENGINE]) {
+        Option* curr = options[ROOFLINE_ENGINE];
+        while (curr) { //ROOFLINE_ENGINE may occur more than once, this is perfectly OK.
+            std::string name(curr->arg);
+            uint32_t engine = 0;
+            while (engine < NUM_ROOFLINE_ENGINES && roofline_engine_name(static_cast<roofline_engine_t>(engine)) != name)
+                engine++;
+            if (engine == NUM_ROOFLINE_ENGINES) {
+                std::cerr << "ERROR: Unknown roofline engine " << name << ". It must be scalar_fma, avx2_fma, avx512_fma, or scalar_int." << std::endl;
+                goto error;
+            }
+            RooflineFunction kernel = NULL;
+            RooflineFunction dummy_kernel = NULL;
+            if (!determine_roofline_kernel(static_cast<roofline_engine_t>(engine), &kernel, &dummy_kernel)) {
+                std::cerr << "ERROR: The " << name << " roofline engine is not available on this build." << std::endl;
+                goto error;
+            }
+            if (!roofline_engine_supported(static_cast<roofline_engine_t>(engine))) {
+                std::cerr << "ERROR: The processor does not support the " << name << " roofline engine." << std::endl;
+                goto error;
+            }
+            roofline_engines_.push_back(static_cast<roofline_engine_t>(engine));
+            curr = curr->next();
+        }
+        roofline_engines_.sort();
+        roofline_engines_.unique();
+
+        if (!options[ROOFLINE])
+            std::cerr << "WARNING: Roofline engines only apply to the roofline mode." << std::endl;
+    } else {
+        for (uint32_t engine = 0; engine < NUM_ROOFLINE_ENGINES; engine++) {
+            RooflineFunction kernel = NULL;
+            RooflineFunction dummy_kernel = NULL;
+            if (determine_roofline_kernel(static_cast<roofline_engine_t>(engine), &kernel, &dummy_kernel) && roofline_engine_supported(static_cast<roofline_engine_t>(engine)))
+                roofline_engines_.push_back(static_cast<roofline_engine_t>(engine));
+        }
+
+        if (run_roofline_ && roofline_engines_.empty()) {
+            std::cerr << "ERROR: No roofline engine is available on this build and processor." << std::endl;
+            goto error;
+        }
+    }
+
+    if (options[OPS_PER_ELEMENT]) {
+        Option* curr = options[OPS_PER_ELEMENT];
+        while (curr) { //OPS_PER_ELEMENT may occur more than once, this is perfectly OK.
+            char* endptr = NULL;
+            uint32_t ops = static_cast<uint32_t>(strtoul(curr->arg, &endptr, 10));
+            if (ops % 2 != 0) {
+                std::cerr << "ERROR: The number of operations per element must be even, as each multiply-add counts as two." << std::endl;
+                goto error;
+            }
+            ops_per_element_.push_back(ops);
+            curr = curr->next();
+        }
+        ops_per_element_.sort();
+        ops_per_element_.unique();
+
+        if (!options[ROOFLINE])
+            std::cerr << "WARNING: The number of operations per element only applies to the roofline mode." << std::endl;
+    } else {
+        for (uint32_t ops = ROOFLINE_DEFAULT_MIN_OPS_PER_ELEMENT; ops <= ROOFLINE_DEFAULT_MAX_OPS_PER_ELEMENT; ops *= 2)
+            ops_per_element_.push_back(ops);
+    }
+
+    //Make sure at least one mode is available
+    if (!run_latency_ && !run_throughput_ && !run_concurrent_throughput_ && !run_interconnect_ && !run_interference_ && !run_c2c_latency_ && !run_c2c_bandwidth_ && !run_atomics_ && !run_false_sharing_ && !run_flush_ && !run_copy_ && !run_gather_ && !run_multi_stream_ && !run_unaligned_ && !run_data_pattern_ && !run_tiled_ && !run_roofline_ && !run_extensions_) {
+        std::cerr << "ERROR: At least one benchmark type must be selected." << std::endl;
+        goto error;
+    }
+
+    //Make sure at least one access pattern is selectee
+    if (!use_random_access_pattern_ && !use_sequential_access_pattern_) {
+        std::cerr << "ERROR: No access pattern was specified!" << std::endl;    
+        goto error;
+    }
+    
+    //Make sure at least one read/write pattern is selected
+    if (!use_reads_ && !use_writes_ && rw_mixes_.empty() && !use_read_modify_write_) {
+        std::cerr << "ERROR: Throughput benchmark was selected, but no read/write pattern was specified!" << std::endl; 
+        goto error;
+    }
+
+    //If the user picked "all" option, override anything else they put in that is relevant.
+    if (options[ALL]) {
+        run_latency_ = true;
+        run_throughput_ = true;
+        run_extensions_ = true;
+#ifdef EXT_DELAY_INJECTED_LOADED_LATENCY_BENCHMARK
+        run_ext_delay_injected_loaded_latency_benchmark_ = true;
+#endif
+#ifdef EXT_STREAM_BENCHMARK
+        run_ext_stream_benchmark_ = true;
+#endif
+        use_chunk_32b_ = true;
+#ifdef HAS_WORD_64
+        use_chunk_64b_ = true;
+#endif
+#ifdef HAS_WORD_128
+        use_chunk_128b_ = true;
+#endif
+#ifdef HAS_WORD_256
+        use_chunk_256b_ = true;
+#endif
+#ifdef HAS_WORD_512
+        use_chunk_512b = true;
+#endif
+        use_random_access_pattern_ = true; 
+        use_sequential_access_pattern_ = true;
+        use_reads_ = true;
+        use_writes_ = true;
+        use_stride_p1_ = true;
+        use_stride_n1_ = true;
+        use_stride_p2_ = true;
+        use_stride_n2_ = true;
+        use_stride_p4_ = true;
+        use_stride_n4_ = true;
+        use_stride_p8_ = true;
+        use_stride_n8_ = true;
+        use_stride_p16_ = true;
+        use_stride_n16_ = true;
+    }
+    
+#ifdef HAS_WORD_64
+    //Notify that 32-bit chunks are not used on random throughput benchmarks on 64-bit machines
+    if (use_random_access_pattern_ && use_chunk_32b_) 
+        std::cerr << "NOTE: Random-access load kernels used in throughput and loaded latency benchmarks do not support 32-bit chunk sizes on 64-bit machines. These particular combinations will be omitted." << std::endl;
+#endif
+
+    //Check for help or bad options
+    if (options[HELP] || options[UNKNOWN] != NULL)
+        goto errorWithUsage;
+    
+    //Report final runtime configuration based on user inputs
+    std::cout << std::endl;
+    if (verbose_) {
+        std::cout << "Verbose output enabled!" << std::endl;
+
+        std::cout << "Benchmarking modes:" << std::endl;
+        if (run_throughput_)
+            std::cout << "---> Throughput" << std::endl;
+        if (run_latency_) {
+            std::cout << "---> ";
+            if (all_core_latency_)
+                std::cout << "All-core ";
+            else if (num_worker_threads_ > 1)
+                std::cout << "Loaded ";
+            else
+                std::cout << "Unloaded ";
+            std::cout << "latency";
+            if (cold_cache_latency_)
+                std::cout << " (cold cache)";
+            if (num_worker_threads_ > 1 && load_target_bandwidth_ > 0)
+                std::cout << " (load held at " << load_target_bandwidth_ << " MB/s)";
+            if (num_worker_threads_ > 1 && !load_profile_.isEmpty())
+                std::cout << " (load following " << load_profile_.getDescription() << ")";
+            std::cout << std::endl;
+        }
+        if (run_concurrent_throughput_) {
+            std::cout << "---> Concurrent all-node throughput (CPU->memory NUMA node placements:";
+            for (auto it = concurrent_placements_.cbegin(); it != concurrent_placements_.cend(); it++)
+                std::cout << " " << it->first << "->" << it->second;
+            std::cout << ")" << std::endl;
+        }
+        if (run_interconnect_)
+            std::cout << "---> NUMA interconnect (idle, bidirectional, and all-to-all matrices)" << std::endl;
+        if (run_interference_) {
+            std::cout << "---> Interference generator (";
+            if (interference_duration_s_ > 0)
+                std::cout << interference_duration_s_ << " s";
+            else
+                std::cout << "until stopped";
+            if (load_target_bandwidth_ > 0)
+                std::cout << ", load held at " << load_target_bandwidth_ << " MB/s";
+            std::cout << ", reporting every " << interference_report_interval_ms_ << " ms)" << std::endl;
+        }
+        if (run_c2c_latency_) {
+            std::cout << "---> Core-to-core cache line transfer latency";
+            if (c2c_cpu_step_ > 1)
+                std::cout << " (logical CPU step of " << c2c_cpu_step_ << ")";
+            std::cout << std::endl;
+        }
+        if (run_c2c_bandwidth_) {
+            std::cout << "---> Core-to-core producer/consumer bandwidth (block sizes in B:";
+            for (auto it = c2c_block_sizes_.cbegin(); it != c2c_block_sizes_.cend(); it++)
+                std::cout << " " << *it;
+            std::cout << ")" << std::endl;
+        }
+        if (run_atomics_) {
+            std::cout << "---> Atomic operation contention (";
+            for (auto it = atomic_ops_.cbegin(); it != atomic_ops_.cend(); it++)
+                std::cout << (it != atomic_ops_.cbegin() ? ", " : "") << atomic_op_name(*it);
+            std::cout << ";";
+            for (auto it = atomic_sharing_modes_.cbegin(); it != atomic_sharing_modes_.cend(); it++)
+                std::cout << " " << atomic_sharing_name(*it);
+            std::cout << " lines";
+            if (std::find(atomic_sharing_modes_.cbegin(), atomic_sharing_modes_.cend(), ATOMIC_SPREAD) != atomic_sharing_modes_.cend())
+                std::cout << ", " << atomic_spread_addresses_ << " spread lines";
+            std::cout << ")" << std::endl;
+        }
+        if (run_false_sharing_) {
+            std::cout << "---> False sharing (paddings in B:";
+            for (auto it = false_sharing_paddings_.cbegin(); it != false_sharing_paddings_.cend(); it++)
+                std::cout << " " << *it;
+            std::cout << "; " << false_sharing_work_ << " iterations of work between writes)" << std::endl;
+        }
+        if (run_flush_) {
+            std::cout << "---> Cache flush (";
+            for (auto it = flush_ops_.cbegin(); it != flush_ops_.cend(); it++)
+                std::cout << (it != flush_ops_.cbegin() ? ", " : "") << flush_op_name(*it);
+            std::cout << "; clean and dirty lines)" << std::endl;
+        }
+        if (run_copy_) {
+            std::cout << "---> Copy/fill (";
+            for (auto it = copy_engines_.cbegin(); it != copy_engines_.cend(); it++)
+                std::cout << (it != copy_engines_.cbegin() ? ", " : "") << copy_engine_name(*it);
+            std::cout << "; sizes in B:";
+            for (auto it = copy_sizes_.cbegin(); it != copy_sizes_.cend(); it++)
+                std::cout << " " << *it;
+            if (!copy_size_distribution_.isEmpty())
+                std::cout << " and the distribution from " << copy_size_distribution_.getDescription();
+            std::cout << ")" << std::endl;
+        }
+        if (run_gather_) {
+            std::cout << "---> Gather/scatter (";
+            for (auto it = gather_engines_.cbegin(); it != gather_engines_.cend(); it++)
+                std::cout << (it != gather_engines_.cbegin() ? ", " : "") << gather_engine_name(*it);
+            std::cout << "; index patterns:";
+            for (auto it = gather_index_patterns_.cbegin(); it != gather_index_patterns_.cend(); it++)
+                std::cout << " " << gather_index_name(*it);
+            std::cout << "; stride " << gather_stride_ << " elements; window " << gather_window_size_ << " B)" << std::endl;
+        }
+        if (run_multi_stream_) {
+            std::cout << "---> Multi-stream (streams per thread:";
+            for (auto it = stream_counts_.cbegin(); it != stream_counts_.cend(); it++)
+                std::cout << " " << *it;
+            std::cout << "; forward and reverse)" << std::endl;
+        }
+        if (run_unaligned_) {
+            std::cout << "---> Unaligned access (offsets in B:";
+            for (auto it = unaligned_offsets_.cbegin(); it != unaligned_offsets_.cend(); it++)
+                std::cout << " " << *it;
+            std::cout << "; sequential read, sequential write, and pointer chasing)" << std::endl;
+        }
+        if (run_data_pattern_) {
+            std::cout << "---> Data pattern (patterns:";
+            for (auto it = data_patterns_.cbegin(); it != data_patterns_.cend(); it++)
+                std::cout << " " << data_pattern_name(*it);
+            if (!data_pattern_file_data_.empty())
+                std::cout << "; " << data_pattern_file_data_.size() << " B of file data";
+            std::cout << "; sequential read and pattern write)" << std::endl;
+        }
+        if (run_tiled_) {
+            std::cout << "---> 2D tiled (orders:";
+            for (auto it = tile_orders_.cbegin(); it != tile_orders_.cend(); it++)
+                std::cout << " " << tile_order_name(*it);
+            std::cout << "; " << row_width_ << " B rows with a " << row_pitch_ << " B pitch; " << tile_width_ << "x" << tile_height_ << " element tiles)" << std::endl;
+        }
+        if (run_roofline_) {
+            std::cout << "---> Roofline (engines:";
+            for (auto it = roofline_engines_.cbegin(); it != roofline_engines_.cend(); it++)
+                std::cout << " " << roofline_engine_name(*it);
+            std::cout << "; operations per element:";
+            for (auto it = ops_per_element_.cbegin(); it != ops_per_element_.cend(); it++)
+                std::cout << " " << *it;
+            std::cout << ")" << std::endl;
+        }
+        if (run_extensions_)
+            std::cout << "---> Extensions" << std::endl;
+#ifdef EXT_DELAY_INJECTED_LOADED_LATENCY_BENCHMARK
+        if (run_ext_delay_injected_loaded_latency_benchmark_) {
+            std::cout << "------> Delay-injected loaded latency delays (nops): ";
+            for (auto it = ext_delay_injected_loaded_latency_delays_.cbegin(); it != ext_delay_injected_loaded_latency_delays_.cend(); it++)
+                std::cout << *it << " ";
+            std::cout << std::endl;
+        }
+#endif
+        std::cout << std::endl;
+        
+        std::cout << "Benchmark settings:" << std::endl;
+        std::cout << "---> Random access:                   ";
+        if (use_random_access_pattern_)
+            std::cout << "yes";
+        else
+            std::cout << "no";
+        std::cout << std::endl;
+        std::cout << "---> Sequential access:               ";
+        if (use_sequential_access_pattern_)
+            std::cout << "yes";
+        else
+            std::cout << "no";
+        std::cout << std::endl;
+        std::cout << "---> Use memory reads:                ";
+        if (use_reads_)
+            std::cout << "yes";
+        else
+            std::cout << "no";
+        std::cout << std::endl;
+        std::cout << "---> Use memory writes:               ";
+        if (use_writes_)
+            std::cout << "yes";
+        else
+            std::cout << "no";
+        std::cout << std::endl;
+        std::cout << "---> Use read-modify-write:           ";
+        if (use_read_modify_write_)
+            std::cout << "yes";
+        else
+            std::cout << "no";
+        std::cout << std::endl;
+        std::cout << "---> Read/write mixes:                ";
+        if (rw_mixes_.empty())
+            std::cout << "none";
+        for (auto it = rw_mixes_.cbegin(); it != rw_mixes_.cend(); it++)
+            std::cout << (it != rw_mixes_.cbegin() ? ", " : "") << rw_mode_name(*it);
+        std::cout << std::endl;
+        std::cout << "---> Chunk sizes:                     ";
+        if (use_chunk_32b_)
+            std::cout << "32 ";
+#ifdef HAS_WORD_64
+        if (use_chunk_64b_)
+            std::cout << "64 ";
+#endif
+#ifdef HAS_WORD_128
+        if (use_chunk_128b_)
+            std::cout << "128 ";
+#endif
+#ifdef HAS_WORD_256
+        if (use_chunk_256b_)
+            std::cout << "256 ";
+#endif
+#ifdef HAS_WORD_512
+        if (use_chunk_512b)
+            std::cout << "512 ";
+#endif
+        std::cout << std::endl;
+        std::cout << "---> Stride sizes:                    ";
+        if (use_stride_p1_)
+            std::cout << "1 ";
+        if (use_stride_n1_)
+            std::cout << "-1 ";
+        if (use_stride_p2_)
+            std::cout << "2 ";
+        if (use_stride_n2_)
+            std::cout << "-2 ";
+        if (use_stride_p4_)
+            std::cout << "4 ";
+        if (use_stride_n4_)
+            std::cout << "-4 ";
+        if (use_stride_p8_)
+            std::cout << "8 ";
+        if (use_stride_n8_)
+            std::cout << "-8 ";
+        if (use_stride_p16_)
+            std::cout << "16 ";
+        if (use_stride_n16_)
+            std::cout << "-16 ";
+        std::cout << std::endl;
+        std::cout << "---> Number of worker threads:        ";
+        if (use_num_worker_threads_sweep_) {
+            for (auto it = num_worker_threads_sweep_.cbegin(); it != num_worker_threads_sweep_.cend(); it++)
+                std::cout << *it << " ";
+            std::cout << std::endl;
+        } else
+            std::cout << num_worker_threads_ << std::endl;
+        std::cout << "---> NUMA enabled:                    ";
+#ifdef HAS_NUMA
+        if (numa_enabled_)
+            std::cout << "yes" << std::endl;
+        else
+            std::cout << "no" << std::endl;
+        std::cout << "------> CPU NUMA node affinities:     ";
+        for (auto it = cpu_numa_node_affinities_.cbegin(); it != cpu_numa_node_affinities_.cend(); it++)
+            std::cout << *it << " ";
+        std::cout << std::endl;
+        std::cout << "------> Memory NUMA node affinities:  ";
+        for (auto it = memory_numa_node_affinities_.cbegin(); it != memory_numa_node_affinities_.cend(); it++)
+            std::cout << *it << " ";
+        std::cout << std::endl;
+#else
+        std::cout << "not supported" << std::endl;
+#endif
+        std::cout << "---> Large pages:                     ";
+#ifdef HAS_LARGE_PAGES
+        if (use_large_pages_)
+            std::cout << "yes" << std::endl;
+        else
+            std::cout << "no" << std::endl;
+#else
+        std::cout << "not supported" << std::endl;
+#endif
+        std::cout << "---> Iterations:                      ";
+        std::cout << iterations_ << std::endl;
+        std::cout << "---> Starting test index:             ";
+        std::cout << starting_test_index_ << std::endl;
+        std::cout << std::endl;
+    }
+
+    if (use_working_set_size_sweep_) {
+        std::cout << "Working set per thread sweep:         ";
+        std::cout << working_set_size_sweep_.front() / KB << " KB to " << working_set_size_sweep_.back() / KB << " KB (" << working_set_size_sweep_.size() << " points)" << std::endl;
+        std::cout << "Working set per thread allocated:     ";
+        std::cout << working_set_size_sweep_.back() << " B == " << working_set_size_sweep_.back() / KB << " KB == " << working_set_size_sweep_.back() / MB << " MB" << std::endl;
+    } else {
+        std::cout << "Working set per thread:               ";
+        if (use_large_pages_) {
+            size_t num_large_pages = 0;
+            if (working_set_size_per_thread_ <= g_large_page_size) //sub one large page, round up to one
+                num_large_pages = 1;
+            else if (working_set_size_per_thread_ % g_large_page_size == 0) //multiple of large page
+                num_large_pages = working_set_size_per_thread_ / g_large_page_size;
+            else //larger than one large page but not a multiple of large page
+                num_large_pages = working_set_size_per_thread_ / g_large_page_size + 1;
+            std::cout << working_set_size_per_thread_ << " B == " << working_set_size_per_thread_ / KB  << " KB == " << working_set_size_per_thread_ / MB << " MB (fits in " << num_large_pages << " large pages)" << std::endl; 
+        } else { 
+            std::cout << working_set_size_per_thread_ << " B == " << working_set_size_per_thread_ / KB  << " KB == " << working_set_size_per_thread_ / MB << " MB (" << working_set_size_per_thread_/(g_page_size) << " pages)" << std::endl;   
+        }
+    }
+
+    //Free up options memory
+    delete[] options;
+    delete[] buffer;
+
+    return 0;
+
+    errorWithUsage:
+        printUsage(std::cerr, usage); //Display help message
+
+    error:
+
+        //Free up options memory
+        delete[] options;
+        delete[] buffer;
+
+        return -1;
+}
+
+uint32_t Configurator::getMaxPlacementsPerMemoryNode() const {
+    uint32_t max_placements = 1;
+    if (run_interconnect_) //All-to-all traffic has at most one placement per CPU node on each memory node
+        max_placements = static_cast<uint32_t>(cpu_numa_node_affinities_.size());
+    for (auto it = concurrent_placements_.cbegin(); it != concurrent_placements_.cend(); it++) {
+        uint32_t placements = 0;
+        for (auto it2 = concurrent_placements_.cbegin(); it2 != concurrent_placements_.cend(); it2++) {
+            if (it2->second == it->second)
+                placements++;
+        }
+        if (placements > max_placements)
+            max_placements = placements;
+    }
+    return max_placements;
+}
+
+bool Configurator::parse_node_pair(const std::string& spec, uint32_t& cpu_node, uint32_t& mem_node) const {
+    size_t colon = spec.find(':');
+    char* endptr = NULL;
+    cpu_node = static_cast<uint32_t>(strtoul(spec.c_str(), &endptr, 10));
+    if (colon == std::string::npos || colon == 0 || endptr != spec.c_str() + colon) {
+        std::cerr << "ERROR: Node map must be specified as CPU:MEM, e.g., 0:1." << std::endl;
+        return false;
+    }
+    mem_node = static_cast<uint32_t>(strtoul(spec.c_str() + colon + 1, &endptr, 10));
+    if (endptr == spec.c_str() + colon + 1 || *endptr != '\0') {
+        std::cerr << "ERROR: Node map must be specified as CPU:MEM, e.g., 0:1." << std::endl;
+        return false;
+    }
+
+    if (cpu_node >= g_num_numa_nodes || (!numa_enabled_ && cpu_node != 0)) {
+        std::cerr << "ERROR: Node map " << spec << " uses CPU NUMA node " << cpu_node << ", which is not available." << std::endl;
+        return false;
+    }
+
+    //Memory is only allocated on the selected memory nodes, so the mapping has to stay within the memory affinities
+    bool mem_found = false;
+    for (auto it = memory_numa_node_affinities_.cbegin(); it != memory_numa_node_affinities_.cend(); it++) {
+        if (*it == mem_node)
+            mem_found = true;
+    }
+    if (!mem_found) {
+        std::cerr << "ERROR: Node map " << spec << " uses memory NUMA node " << mem_node << ", which is not included in the memory NUMA node affinities." << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+bool Configurator::parse_cpu_pair(const std::string& spec, uint32_t& first_cpu, uint32_t& second_cpu) const {
+    size_t colon = spec.find(':');
+    char* endptr = NULL;
+    first_cpu = static_cast<uint32_t>(strtoul(spec.c_str(), &endptr, 10));
+    if (colon == std::string::npos || colon == 0 || endptr != spec.c_str() + colon) {
+        std::cerr << "ERROR: CPU pair must be specified as FIRST:SECOND, e.g., 0:1." << std::endl;
+        return false;
+    }
+    second_cpu = static_cast<uint32_t>(strtoul(spec.c_str() + colon + 1, &endptr, 10));
+    if (endptr == spec.c_str() + colon + 1 || *endptr != '\0') {
+        std::cerr << "ERROR: CPU pair must be specified as FIRST:SECOND, e.g., 0:1." << std::endl;
+        return false;
+    }
+
+    if (first_cpu >= g_num_logical_cpus || second_cpu >= g_num_logical_cpus) {
+        std::cerr << "ERROR: CPU pair " << spec << " uses a logical CPU that is not available. There are " << g_num_logical_cpus << " logical CPUs." << std::endl;
+        return false;
+    }
+
+    if (first_cpu == second_cpu) {
+        std::cerr << "ERROR: CPU pair " << spec << " must use two different logical CPUs." << std::endl;
+        return false;
+    }
+
+    return true;
+}
 
 bool Configurator::check_single_option_occurrence(Option* opt) const {
     if (opt->count() > 1) {
@@ -734,3 +1997,267 @@ bool Configurator::check_single_option_occurrence(Option* opt) const {
     }
     return true;
 }
+
+bool Configurator::parse_working_set_size_sweep(const std::string& spec) {
+    //Split the specification into MIN:MAX:STEP fields
+    size_t first_colon = spec.find(':');
+    size_t second_colon = (first_colon == std::string::npos) ? std::string::npos : spec.find(':', first_colon+1);
+    if (first_colon == std::string::npos || second_colon == std::string::npos) {
+        std::cerr << "ERROR: Working set size sweep must be specified as MIN:MAX:xF or MIN:MAX:+STEP, e.g., 4K:1G:x2." << std::endl;
+        return false;
+    }
+
+    std::string fields[3];
+    fields[0] = spec.substr(0, first_colon);
+    fields[1] = spec.substr(first_colon+1, second_colon-first_colon-1);
+    fields[2] = spec.substr(second_colon+1);
+
+    if (fields[2].size() < 2 || (fields[2][0] != 'x' && fields[2][0] != 'X' && fields[2][0] != '+')) {
+        std::cerr << "ERROR: Working set size sweep step must be of the form xF or +STEP, e.g., x2 or +64K." << std::endl;
+        return false;
+    }
+    bool multiplicative = (fields[2][0] != '+');
+    fields[2] = fields[2].substr(1);
+
+    //Convert each size field to bytes. Plain numbers are interpreted as KB to be consistent with the working_set_size option.
+    size_t values[3];
+    for (uint32_t i = 0; i < 3; i++) {
+        const char* str = fields[i].c_str();
+        char* endptr = NULL;
+        unsigned long long value = strtoull(str, &endptr, 10);
+        if (endptr == str) {
+            std::cerr << "ERROR: Invalid number \"" << fields[i] << "\" in working set size sweep." << std::endl;
+            return false;
+        }
+
+        if (i == 2 && multiplicative) { //multiplicative factor has no units
+            if (*endptr != '\0' || value < 2) {
+                std::cerr << "ERROR: Working set size sweep multiplicative factor must be an integer of at least 2." << std::endl;
+                return false;
+            }
+            values[i] = static_cast<size_t>(value);
+            continue;
+        }
+
+        switch (*endptr) {
+            case '\0':
+            case 'k':
+            case 'K':
+                value *= KB;
+                break;
+            case 'm':
+            case 'M':
+                value *= MB;
+                break;
+            case 'g':
+            case 'G':
+                value *= GB;
+                break;
+            default:
+                std::cerr << "ERROR: Invalid size suffix in \"" << fields[i] << "\" in working set size sweep. Allowed suffixes: K, M, G." << std::endl;
+                return false;
+        }
+        if (*endptr != '\0' && *(endptr+1) != '\0' && *(endptr+1) != 'B' && *(endptr+1) != 'b') {
+            std::cerr << "ERROR: Invalid size suffix in \"" << fields[i] << "\" in working set size sweep. Allowed suffixes: K, M, G." << std::endl;
+            return false;
+        }
+        values[i] = static_cast<size_t>(value);
+    }
+
+    size_t min_size = values[0];
+    size_t max_size = values[1];
+    size_t step = values[2];
+
+    if (min_size == 0 || min_size > max_size) {
+        std::cerr << "ERROR: Working set size sweep minimum must be nonzero and no greater than the maximum." << std::endl;
+        return false;
+    }
+
+    if (!multiplicative && step == 0) {
+        std::cerr << "ERROR: Working set size sweep additive step must be nonzero." << std::endl;
+        return false;
+    }
+
+    //Generate the sweep points
+    working_set_size_sweep_.clear();
+    for (size_t size = min_size; size <= max_size; size = multiplicative ? size * step : size + step) {
+        if ((size % (4*KB)) != 0) {
+            std::cerr << "ERROR: Working set size sweep point of " << size << " B is not a multiple of 4 KB." << std::endl;
+            return false;
+        }
+        working_set_size_sweep_.push_back(size);
+    }
+
+    return true;
+}
+
+bool Configurator::parse_num_worker_threads_sweep(const std::string& spec) {
+    //Split the specification into MIN:MAX[:STEP] fields
+    size_t first_colon = spec.find(':');
+    if (first_colon == std::string::npos) {
+        std::cerr << "ERROR: Worker thread count sweep must be specified as MIN:MAX, MIN:MAX:+STEP, or MIN:MAX:xF, e.g., 1:all or 1:16:x2." << std::endl;
+        return false;
+    }
+    size_t second_colon = spec.find(':', first_colon+1);
+
+    std::string min_field = spec.substr(0, first_colon);
+    std::string max_field = spec.substr(first_colon+1, (second_colon == std::string::npos) ? std::string::npos : second_colon-first_colon-1);
+    std::string step_field = (second_colon == std::string::npos) ? std::string("+1") : spec.substr(second_colon+1);
+
+    //Maximum number of threads that can be placed on distinct logical CPUs within one NUMA node
+    uint32_t cpus_per_node = g_num_logical_cpus / g_num_numa_nodes;
+    if (cpus_per_node < 1)
+        cpus_per_node = 1;
+
+    char* endptr = NULL;
+    uint32_t min_threads = static_cast<uint32_t>(strtoul(min_field.c_str(), &endptr, 10));
+    if (endptr == min_field.c_str() || *endptr != '\0' || min_threads < 1) {
+        std::cerr << "ERROR: Worker thread count sweep minimum must be a positive integer." << std::endl;
+        return false;
+    }
+
+    uint32_t max_threads = 0;
+    if (max_field == "all")
+        max_threads = cpus_per_node;
+    else {
+        max_threads = static_cast<uint32_t>(strtoul(max_field.c_str(), &endptr, 10));
+        if (endptr == max_field.c_str() || *endptr != '\0') {
+            std::cerr << "ERROR: Worker thread count sweep maximum must be a positive integer or \"all\"." << std::endl;
+            return false;
+        }
+    }
+
+    if (min_threads > max_threads) {
+        std::cerr << "ERROR: Worker thread count sweep minimum may not exceed the maximum." << std::endl;
+        return false;
+    }
+
+    if (max_threads > g_num_logical_cpus) {
+        std::cerr << "ERROR: Number of worker threads may not exceed the number of logical CPUs (" << g_num_logical_cpus << ")" << std::endl;
+        return false;
+    }
+
+    if (step_field.size() < 2 || (step_field[0] != 'x' && step_field[0] != 'X' && step_field[0] != '+')) {
+        std::cerr << "ERROR: Worker thread count sweep step must be of the form +N or xF, e.g., +1 or x2." << std::endl;
+        return false;
+    }
+    bool multiplicative = (step_field[0] != '+');
+    uint32_t step = static_cast<uint32_t>(strtoul(step_field.c_str()+1, &endptr, 10));
+    if (*endptr != '\0' || step < 1 || (multiplicative && step < 2)) {
+        std::cerr << "ERROR: Worker thread count sweep step must be at least +1 or x2." << std::endl;
+        return false;
+    }
+
+    //Generate the sweep points. Always include the maximum so that the saturation point is captured.
+    num_worker_threads_sweep_.clear();
+    for (uint32_t threads = min_threads; threads <= max_threads; threads = multiplicative ? threads * step : threads + step)
+        num_worker_threads_sweep_.push_back(threads);
+    if (num_worker_threads_sweep_.back() != max_threads)
+        num_worker_threads_sweep_.push_back(max_threads);
+
+    if (max_threads > cpus_per_node)
+        std::cerr << "WARNING: Worker thread count sweep goes up to " << max_threads << " threads, but there are only " << cpus_per_node << " logical CPUs per NUMA node. Some threads may not be pinned to CPUs in the intended node." << std::endl;
+
+    return true;
+}
+
+#ifdef EXT_DELAY_INJECTED_LOADED_LATENCY_BENCHMARK
+bool Configurator::parse_delay_sweep(const std::string& spec) {
+    //Split the specification into MIN:MAX[:STEP] fields
+    size_t first_colon = spec.find(':');
+    if (first_colon == std::string::npos) {
+        std::cerr << "ERROR: Delay sweep must be specified as MIN:MAX, MIN:MAX:+STEP, or MIN:MAX:xF, e.g., 0:1024:x1.25 or 0:256:+4." << std::endl;
+        return false;
+    }
+    size_t second_colon = spec.find(':', first_colon+1);
+
+    std::string min_field = spec.substr(0, first_colon);
+    std::string max_field = spec.substr(first_colon+1, (second_colon == std::string::npos) ? std::string::npos : second_colon-first_colon-1);
+    std::string step_field = (second_colon == std::string::npos) ? std::string("+1") : spec.substr(second_colon+1);
+
+    char* endptr = NULL;
+    uint32_t min_delay = static_cast<uint32_t>(strtoul(min_field.c_str(), &endptr, 10));
+    if (endptr == min_field.c_str() || *endptr != '\0') {
+        std::cerr << "ERROR: Delay sweep minimum must be a non-negative integer." << std::endl;
+        return false;
+    }
+
+    uint32_t max_delay = static_cast<uint32_t>(strtoul(max_field.c_str(), &endptr, 10));
+    if (endptr == max_field.c_str() || *endptr != '\0') {
+        std::cerr << "ERROR: Delay sweep maximum must be a non-negative integer." << std::endl;
+        return false;
+    }
+
+    if (min_delay > max_delay) {
+        std::cerr << "ERROR: Delay sweep minimum may not exceed the maximum." << std::endl;
+        return false;
+    }
+
+    if (step_field.size() < 2 || (step_field[0] != 'x' && step_field[0] != 'X' && step_field[0] != '+')) {
+        std::cerr << "ERROR: Delay sweep step must be of the form +N or xF, e.g., +4 or x1.25." << std::endl;
+        return false;
+    }
+    bool multiplicative = (step_field[0] != '+');
+    uint32_t step = 0;
+    double factor = 0;
+    if (multiplicative) {
+        factor = strtod(step_field.c_str()+1, &endptr);
+        if (*endptr != '\0' || factor <= 1) {
+            std::cerr << "ERROR: Delay sweep multiplicative step must be greater than x1." << std::endl;
+            return false;
+        }
+    } else {
+        step = static_cast<uint32_t>(strtoul(step_field.c_str()+1, &endptr, 10));
+        if (*endptr != '\0' || step < 1) {
+            std::cerr << "ERROR: Delay sweep additive step must be at least +1." << std::endl;
+            return false;
+        }
+    }
+
+    //Generate the sweep points. Multiplicative steps round to the nearest nop but always advance, so small delays are not repeated. Always include the maximum.
+    ext_delay_injected_loaded_latency_delays_.clear();
+    uint64_t delay = min_delay;
+    while (delay <= max_delay) {
+        ext_delay_injected_loaded_latency_delays_.push_back(static_cast<uint32_t>(delay));
+        uint64_t next = multiplicative ? static_cast<uint64_t>(static_cast<double>(delay) * factor + 0.5) : delay + step;
+        delay = (next > delay) ? next : delay + 1;
+    }
+    if (ext_delay_injected_loaded_latency_delays_.back() != max_delay)
+        ext_delay_injected_loaded_latency_delays_.push_back(max_delay);
+
+    return true;
+}
+#endif
+
+bool Configurator::parse_load_burst(const std::string& spec) {
+    double values[4] = { 0, 0, 0, 0 };
+    uint32_t num_values = 0;
+    bool at_end = false;
+    const char* str = spec.c_str();
+    while (num_values < 4) {
+        char* endptr = NULL;
+        values[num_values] = strtod(str, &endptr);
+        if (endptr == str || (*endptr != ':' && *endptr != '\0'))
+            goto bad_spec;
+        num_values++;
+        if (*endptr == '\0') {
+            at_end = true;
+            break;
+        }
+        str = endptr+1;
+    }
+
+    if (num_values < 3 || !at_end)
+        goto bad_spec;
+
+    if (values[2] < 0 || values[3] < 0) {
+        std::cerr << "ERROR: Burst bandwidths must be non-negative numbers of MB/s." << std::endl;
+        return false;
+    }
+
+    return load_profile_.setBurst(values[0], values[1], values[2], values[3]);
+
+bad_spec:
+    std::cerr << "ERROR: Invalid load burst specification \"" << spec << "\". It must have the form ON_MS:OFF_MS:PEAK or ON_MS:OFF_MS:PEAK:BASE." << std::endl;
+    return false;
+}
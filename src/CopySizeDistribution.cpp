@@ -0,0 +1,111 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Microsoft
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Author: Mark Gottscho <mgottscho@ucla.edu>
+ */
+/**
+ * @file
+ * 
+ * @brief Implementation file for the CopySizeDistribution class.
+ */
+
+//Headers
+#include <CopySizeDistribution.h>
+#include <common.h>
+
+//Libraries
+#include <iostream>
+#include <random>
+#include <sstream>
+
+using namespace xmem;
+
+CopySizeDistribution::CopySizeDistribution() :
+        sizes_(),
+        weights_(),
+        description_()
+    {
+}
+
+bool CopySizeDistribution::loadFile(const std::string& filename) {
+    std::vector<double> points_sizes;
+    std::vector<double> points_weights;
+    if (!read_two_column_points(filename, "copy size distribution", "SIZE,WEIGHT", points_sizes, points_weights))
+        return false;
+
+    std::vector<size_t> sizes;
+    std::vector<double> weights;
+    double total_weight = 0;
+    for (size_t i = 0; i < points_sizes.size(); i++) {
+        if (points_sizes[i] < 1 || points_weights[i] < 0) {
+            std::cerr << "ERROR: Copy sizes in " << filename << " must be at least 1 B and have non-negative weights." << std::endl;
+            return false;
+        }
+
+        sizes.push_back(static_cast<size_t>(points_sizes[i]));
+        weights.push_back(points_weights[i]);
+        total_weight += points_weights[i];
+    }
+
+    if (total_weight <= 0) {
+        std::cerr << "ERROR: The copy size distribution in " << filename << " needs at least one size with a positive weight." << std::endl;
+        return false;
+    }
+
+    sizes_ = sizes;
+    weights_ = weights;
+    std::ostringstream description;
+    description << "file " << filename;
+    description_ = description.str();
+    return true;
+}
+
+size_t CopySizeDistribution::getMaxSize() const {
+    size_t max_size = 0;
+    for (size_t i = 0; i < sizes_.size(); i++) {
+        if (weights_[i] > 0 && sizes_[i] > max_size)
+            max_size = sizes_[i];
+    }
+    return max_size;
+}
+
+double CopySizeDistribution::getMeanSize() const {
+    double total_weight = 0;
+    double total_size = 0;
+    for (size_t i = 0; i < sizes_.size(); i++) {
+        total_weight += weights_[i];
+        total_size += weights_[i] * sizes_[i];
+    }
+    return (total_weight > 0) ? total_size / total_weight : 0;
+}
+
+std::vector<size_t> CopySizeDistribution::sample(size_t count, uint32_t seed) const {
+    std::vector<size_t> retval;
+    if (sizes_.empty())
+        return retval;
+
+    std::mt19937 gen(seed);
+    std::discrete_distribution<size_t> dist(weights_.begin(), weights_.end());
+    for (size_t i = 0; i < count; i++)
+        retval.push_back(sizes_[dist(gen)]);
+    return retval;
+}
@@ -0,0 +1,218 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Microsoft
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Author: Mark Gottscho <mgottscho@ucla.edu>
+ */
+/**
+ * @file
+ * 
+ * @brief Implementation file for the CopyWorker class.
+ */
+
+//Headers
+#include <CopyWorker.h>
+#include <benchmark_kernels.h>
+#include <common.h>
+
+//Libraries
+#include <cstring>
+#include <iostream>
+
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+using namespace xmem;
+
+CopyWorker::CopyWorker(
+        void* dst,
+        void* src,
+        size_t len,
+        const std::vector<size_t>& sizes,
+        copy_engine_t engine,
+        int32_t cpu_affinity
+    ) :
+        MemoryWorker(
+            dst,
+            len,
+            cpu_affinity
+        ),
+        src_(src),
+        sizes_(sizes),
+        engine_(engine),
+        calls_(0),
+        bytes_(0)
+    {
+}
+
+CopyWorker::~CopyWorker() {
+}
+
+double CopyWorker::getCopyThroughput() {
+    double retval = 0;
+    if (acquireLock(-1)) {
+        if (completed_ && adjusted_ticks_ > 0)
+            retval = (static_cast<double>(bytes_) / MB) / (adjusted_ticks_ * g_ns_per_tick / 1e9);
+        releaseLock();
+    }
+
+    return retval;
+}
+
+double CopyWorker::getMeanCallTicks() {
+    double retval = 0;
+    if (acquireLock(-1)) {
+        if (completed_ && calls_ > 0)
+            retval = static_cast<double>(adjusted_ticks_) / calls_;
+        releaseLock();
+    }
+
+    return retval;
+}
+
+void CopyWorker::run() {
+    //Set up relevant state -- localized to this thread's stack
+    int32_t cpu_affinity = 0;
+    uint8_t* dst = NULL;
+    uint8_t* src = NULL;
+    size_t len = 0;
+    std::vector<size_t> sizes;
+    copy_engine_t engine = COPY_MEMCPY;
+    CopyFunction kernel_fptr = NULL;
+    CopyFunction kernel_dummy_fptr = NULL;
+    tick_t start_tick = 0;
+    tick_t stop_tick = 0;
+    tick_t elapsed_ticks = 0;
+    tick_t elapsed_dummy_ticks = 0;
+    tick_t adjusted_ticks = 0;
+    tick_t target_ticks = g_ticks_per_ms * COPY_BENCHMARK_DURATION_MS; //Rough target run duration in ticks
+    uint64_t calls = 0;
+    uint64_t bytes = 0;
+    uint64_t c = 0;
+    size_t next_size = 0;
+    size_t offset = 0;
+    bool warning = false;
+
+    //Grab relevant setup state thread-safely and keep it local
+    if (acquireLock(-1)) {
+        dst = static_cast<uint8_t*>(mem_array_);
+        src = static_cast<uint8_t*>(src_);
+        len = len_;
+        sizes = sizes_;
+        engine = engine_;
+        cpu_affinity = cpu_affinity_;
+        releaseLock();
+    }
+
+    if (sizes.empty() || !determine_copy_kernel(engine, &kernel_fptr, &kernel_dummy_fptr)) {
+        std::cerr << "ERROR: Failed to find a copy kernel." << std::endl;
+        return;
+    }
+    
+    //Set processor affinity
+    bool locked = lock_thread_to_cpu(cpu_affinity);
+    if (!locked)
+        std::cerr << "WARNING: Failed to lock thread to logical CPU " << cpu_affinity << "! Results may not be correct." << std::endl;
+
+    //Increase scheduling priority
+#ifdef _WIN32
+    DWORD original_priority_class;
+    DWORD original_priority;
+    if (!boost_scheduling_priority(original_priority_class, original_priority))
+#endif
+#ifdef __gnu_linux__
+    if (!boost_scheduling_priority())
+#endif
+        std::cerr << "WARNING: Failed to boost scheduling priority. Perhaps running in Administrator mode would help." << std::endl;
+
+    //Prime memory
+    std::memset(src, 0x5A, len);
+    std::memset(dst, 0, len);
+
+    //Run actual version of function and loop overhead. Consecutive calls walk through the buffers and wrap around when the next call would not fit.
+    while (elapsed_ticks < target_ticks) {
+        start_tick = start_timer();
+        for (uint32_t i = 0; i < COPY_CALLS_PER_TIMING; i++) {
+            size_t size = sizes[next_size];
+            if (offset + size > len)
+                offset = 0;
+            (*kernel_fptr)(dst + offset, src + offset, size);
+            offset += size;
+            bytes += size;
+            if (++next_size == sizes.size())
+                next_size = 0;
+        }
+        stop_tick = stop_timer();
+        elapsed_ticks += (stop_tick - start_tick);
+        calls += COPY_CALLS_PER_TIMING;
+    }
+
+    //Run dummy version of function and loop overhead
+    next_size = 0;
+    offset = 0;
+    while (c < calls) {
+        start_tick = start_timer();
+        for (uint32_t i = 0; i < COPY_CALLS_PER_TIMING; i++) {
+            size_t size = sizes[next_size];
+            if (offset + size > len)
+                offset = 0;
+            (*kernel_dummy_fptr)(dst + offset, src + offset, size);
+            offset += size;
+            if (++next_size == sizes.size())
+                next_size = 0;
+        }
+        stop_tick = stop_timer();
+        elapsed_dummy_ticks += (stop_tick - start_tick);
+        c += COPY_CALLS_PER_TIMING;
+    }
+
+    adjusted_ticks = elapsed_ticks - elapsed_dummy_ticks;
+
+    //Warn if something looks fishy
+    if (elapsed_dummy_ticks >= elapsed_ticks || elapsed_ticks < MIN_ELAPSED_TICKS || adjusted_ticks < 0.5 * elapsed_ticks)
+        warning = true;
+
+    //Unset processor affinity
+    if (locked)
+        unlock_thread_to_cpu();
+
+    //Revert thread priority
+#ifdef _WIN32
+    if (!revert_scheduling_priority(original_priority_class, original_priority))
+#endif
+#ifdef __gnu_linux__
+    if (!revert_scheduling_priority())
+#endif
+        std::cerr << "WARNING: Failed to revert scheduling priority. Perhaps running in Administrator mode would help." << std::endl;
+
+    //Update the object state thread-safely
+    if (acquireLock(-1)) {
+        elapsed_ticks_ = elapsed_ticks;
+        elapsed_dummy_ticks_ = elapsed_dummy_ticks;
+        adjusted_ticks_ = adjusted_ticks;
+        calls_ = calls;
+        bytes_ = bytes;
+        warning_ = warning;
+        completed_ = true;
+        releaseLock();
+    }
+}
@@ -0,0 +1,217 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Microsoft
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Author: Mark Gottscho <mgottscho@ucla.edu>
+ */
+/**
+ * @file
+ * 
+ * @brief Implementation file for the DataPatternWorker class.
+ */
+
+//Headers
+#include <DataPatternWorker.h>
+#include <benchmark_kernels.h>
+#include <common.h>
+
+//Libraries
+#include <iostream>
+
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+using namespace xmem;
+
+DataPatternWorker::DataPatternWorker(
+        void* mem_array,
+        size_t len,
+        rw_mode_t rw_mode,
+        chunk_size_t chunk_size,
+        int32_t cpu_affinity
+    ) :
+        MemoryWorker(
+            mem_array,
+            len,
+            cpu_affinity
+        ),
+        rw_mode_(rw_mode),
+        chunk_size_(chunk_size),
+        bytes_(0)
+    {
+}
+
+DataPatternWorker::~DataPatternWorker() {
+}
+
+double DataPatternWorker::getThroughput() {
+    double retval = 0;
+    if (acquireLock(-1)) {
+        if (completed_ && adjusted_ticks_ > 0)
+            retval = (static_cast<double>(bytes_) / MB) / (adjusted_ticks_ * g_ns_per_tick / 1e9);
+        releaseLock();
+    }
+
+    return retval;
+}
+
+void DataPatternWorker::run() {
+    //Set up relevant state -- localized to this thread's stack
+    int32_t cpu_affinity = 0;
+    uint8_t* mem_array = NULL;
+    size_t len = 0;
+    rw_mode_t rw_mode = READ;
+    chunk_size_t chunk_size = CHUNK_32b;
+    SequentialFunction read_kernel_fptr = NULL;
+    SequentialFunction read_kernel_dummy_fptr = NULL;
+    PatternWriteFunction write_kernel_fptr = NULL;
+    PatternWriteFunction write_kernel_dummy_fptr = NULL;
+    void* start_address = NULL;
+    void* end_address = NULL;
+    size_t bytes_per_call = 0;
+    tick_t start_tick = 0;
+    tick_t stop_tick = 0;
+    tick_t elapsed_ticks = 0;
+    tick_t elapsed_dummy_ticks = 0;
+    tick_t adjusted_ticks = 0;
+    tick_t target_ticks = g_ticks_per_ms * DATA_PATTERN_BENCHMARK_DURATION_MS; //Rough target run duration in ticks
+    uint64_t calls_per_timing = 0;
+    uint64_t calls = 0;
+    uint64_t c = 0;
+    bool warning = false;
+
+    //Grab relevant setup state thread-safely and keep it local
+    if (acquireLock(-1)) {
+        mem_array = static_cast<uint8_t*>(mem_array_);
+        len = len_;
+        rw_mode = rw_mode_;
+        chunk_size = chunk_size_;
+        cpu_affinity = cpu_affinity_;
+        releaseLock();
+    }
+
+    if (len < 2 * DATA_PATTERN_BLOCK_SIZE || len % DATA_PATTERN_BLOCK_SIZE != 0) {
+        std::cerr << "ERROR: The data pattern worker needs a memory region of at least two whole pattern blocks." << std::endl;
+        return;
+    }
+
+    if (rw_mode == WRITE) {
+        if (!determine_pattern_write_kernel(chunk_size, &write_kernel_fptr, &write_kernel_dummy_fptr)) {
+            std::cerr << "ERROR: Failed to find a data pattern write kernel." << std::endl;
+            return;
+        }
+        //The first block holds the pattern, and the rest of the region is overwritten with copies of it
+        start_address = mem_array + DATA_PATTERN_BLOCK_SIZE;
+        end_address = mem_array + len;
+    } else {
+        if (!determine_sequential_kernel(READ, chunk_size, 1, &read_kernel_fptr, &read_kernel_dummy_fptr)) {
+            std::cerr << "ERROR: Failed to find a sequential read kernel." << std::endl;
+            return;
+        }
+        start_address = mem_array;
+        end_address = mem_array + len;
+    }
+    bytes_per_call = static_cast<uint8_t*>(end_address) - static_cast<uint8_t*>(start_address);
+    calls_per_timing = DATA_PATTERN_BYTES_PER_TIMING / bytes_per_call;
+    if (calls_per_timing == 0)
+        calls_per_timing = 1;
+    
+    //Set processor affinity
+    bool locked = lock_thread_to_cpu(cpu_affinity);
+    if (!locked)
+        std::cerr << "WARNING: Failed to lock thread to logical CPU " << cpu_affinity << "! Results may not be correct." << std::endl;
+
+    //Increase scheduling priority
+#ifdef _WIN32
+    DWORD original_priority_class;
+    DWORD original_priority;
+    if (!boost_scheduling_priority(original_priority_class, original_priority))
+#endif
+#ifdef __gnu_linux__
+    if (!boost_scheduling_priority())
+#endif
+        std::cerr << "WARNING: Failed to boost scheduling priority. Perhaps running in Administrator mode would help." << std::endl;
+
+    //Prime memory without disturbing the pattern
+    if (rw_mode == WRITE)
+        (*write_kernel_fptr)(mem_array, start_address, end_address);
+    else
+        (*read_kernel_fptr)(start_address, end_address);
+
+    //Run actual version of function and loop overhead
+    while (elapsed_ticks < target_ticks) {
+        start_tick = start_timer();
+        for (uint64_t i = 0; i < calls_per_timing; i++) {
+            if (rw_mode == WRITE)
+                (*write_kernel_fptr)(mem_array, start_address, end_address);
+            else
+                (*read_kernel_fptr)(start_address, end_address);
+        }
+        stop_tick = stop_timer();
+        elapsed_ticks += (stop_tick - start_tick);
+        calls += calls_per_timing;
+    }
+
+    //Run dummy version of function and loop overhead
+    while (c < calls) {
+        start_tick = start_timer();
+        for (uint64_t i = 0; i < calls_per_timing; i++) {
+            if (rw_mode == WRITE)
+                (*write_kernel_dummy_fptr)(mem_array, start_address, end_address);
+            else
+                (*read_kernel_dummy_fptr)(start_address, end_address);
+        }
+        stop_tick = stop_timer();
+        elapsed_dummy_ticks += (stop_tick - start_tick);
+        c += calls_per_timing;
+    }
+
+    adjusted_ticks = elapsed_ticks - elapsed_dummy_ticks;
+
+    //Warn if something looks fishy
+    if (elapsed_dummy_ticks >= elapsed_ticks || elapsed_ticks < MIN_ELAPSED_TICKS || adjusted_ticks < 0.5 * elapsed_ticks)
+        warning = true;
+
+    //Unset processor affinity
+    if (locked)
+        unlock_thread_to_cpu();
+
+    //Revert thread priority
+#ifdef _WIN32
+    if (!revert_scheduling_priority(original_priority_class, original_priority))
+#endif
+#ifdef __gnu_linux__
+    if (!revert_scheduling_priority())
+#endif
+        std::cerr << "WARNING: Failed to revert scheduling priority. Perhaps running in Administrator mode would help." << std::endl;
+
+    //Update the object state thread-safely
+    if (acquireLock(-1)) {
+        elapsed_ticks_ = elapsed_ticks;
+        elapsed_dummy_ticks_ = elapsed_dummy_ticks;
+        adjusted_ticks_ = adjusted_ticks;
+        bytes_ = calls * bytes_per_call;
+        warning_ = warning;
+        completed_ = true;
+        releaseLock();
+    }
+}
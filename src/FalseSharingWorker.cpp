@@ -0,0 +1,186 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Microsoft
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Author: Mark Gottscho <mgottscho@ucla.edu>
+ */
+
+/**
+ * @file
+ * 
+ * @brief Implementation file for the FalseSharingWorker class.
+ */
+
+//Headers
+#include <FalseSharingWorker.h>
+#include <common.h>
+
+//Libraries
+#include <iostream>
+
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+using namespace xmem;
+
+FalseSharingWorker::FalseSharingWorker(
+        void* word,
+        uint32_t work_per_write,
+        std::atomic<uint32_t>* arrived,
+        uint32_t num_workers,
+        int32_t cpu_affinity
+    ) :
+        MemoryWorker(
+            word,
+            sizeof(uint64_t),
+            cpu_affinity
+        ),
+        work_per_write_(work_per_write),
+        arrived_(arrived),
+        num_workers_(num_workers),
+        writes_(0)
+    {
+}
+
+FalseSharingWorker::~FalseSharingWorker() {
+}
+
+uint64_t FalseSharingWorker::getWrites() {
+    uint64_t retval = 0;
+    if (acquireLock(-1)) {
+        retval = writes_;
+        releaseLock();
+    }
+
+    return retval;
+}
+
+double FalseSharingWorker::getWriteThroughput() {
+    double retval = 0;
+    if (acquireLock(-1)) {
+        if (completed_ && elapsed_ticks_ > 0)
+            retval = (writes_ / 1e6) / (elapsed_ticks_ * g_ns_per_tick / 1e9);
+        releaseLock();
+    }
+
+    return retval;
+}
+
+void FalseSharingWorker::run() {
+    //Set up relevant state -- localized to this thread's stack
+    int32_t cpu_affinity = 0;
+    volatile uint64_t* word = NULL;
+    uint32_t work_per_write = 0;
+    std::atomic<uint32_t>* arrived = NULL;
+    uint32_t num_workers = 0;
+    tick_t start_tick = 0;
+    tick_t stop_tick = 0;
+    tick_t elapsed_ticks = 0;
+    tick_t target_ticks = g_ticks_per_ms * FALSE_SHARING_DURATION_MS; //Rough target run duration in ticks
+    uint64_t writes = 0;
+    uint64_t value = 0;
+    uint64_t work = 1;
+    bool warning = false;
+
+    //Grab relevant setup state thread-safely and keep it local
+    if (acquireLock(-1)) {
+        word = static_cast<volatile uint64_t*>(mem_array_);
+        work_per_write = work_per_write_;
+        arrived = arrived_;
+        num_workers = num_workers_;
+        cpu_affinity = cpu_affinity_;
+        releaseLock();
+    }
+    
+    //Set processor affinity
+    bool locked = lock_thread_to_cpu(cpu_affinity);
+    if (!locked)
+        std::cerr << "WARNING: Failed to lock thread to logical CPU " << cpu_affinity << "! Results may not be correct." << std::endl;
+
+    //Increase scheduling priority
+#ifdef _WIN32
+    DWORD original_priority_class;
+    DWORD original_priority;
+    if (!boost_scheduling_priority(original_priority_class, original_priority))
+#endif
+#ifdef __gnu_linux__
+    if (!boost_scheduling_priority())
+#endif
+        std::cerr << "WARNING: Failed to boost scheduling priority. Perhaps running in Administrator mode would help." << std::endl;
+
+    //Wait for the other workers so that all of them write for the whole run
+    arrived->fetch_add(1);
+    while (arrived->load() < num_workers)
+        ;
+
+    //Write the word. The work between writes is a dependent chain of arithmetic that stays in registers.
+    while (elapsed_ticks < target_ticks) {
+        start_tick = start_timer();
+        if (work_per_write == 0) {
+            UNROLL1024(*word = ++value;)
+        } else {
+            for (uint32_t i = 0; i < 1024; i++) {
+                *word = ++value;
+                for (uint32_t k = 0; k < work_per_write; k++)
+                    work = work * 3 + k;
+            }
+        }
+        stop_tick = stop_timer();
+        writes += 1024;
+        elapsed_ticks += (stop_tick - start_tick);
+    }
+
+    //Keep the work from being optimized away
+    volatile uint64_t work_sink = work;
+    (void)work_sink;
+
+    //Make sure nobody else wrote our word
+    if (*word != value)
+        warning = true;
+
+    //Warn if something looks fishy
+    if (elapsed_ticks < MIN_ELAPSED_TICKS)
+        warning = true;
+
+    //Unset processor affinity
+    if (locked)
+        unlock_thread_to_cpu();
+
+    //Revert thread priority
+#ifdef _WIN32
+    if (!revert_scheduling_priority(original_priority_class, original_priority))
+#endif
+#ifdef __gnu_linux__
+    if (!revert_scheduling_priority())
+#endif
+        std::cerr << "WARNING: Failed to revert scheduling priority. Perhaps running in Administrator mode would help." << std::endl;
+
+    //Update the object state thread-safely
+    if (acquireLock(-1)) {
+        elapsed_ticks_ = elapsed_ticks;
+        adjusted_ticks_ = elapsed_ticks;
+        writes_ = writes;
+        warning_ = warning;
+        completed_ = true;
+        releaseLock();
+    }
+}
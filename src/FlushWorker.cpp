@@ -0,0 +1,207 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Microsoft
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Author: Mark Gottscho <mgottscho@ucla.edu>
+ */
+
+/**
+ * @file
+ * 
+ * @brief Implementation file for the FlushWorker class.
+ */
+
+//Headers
+#include <FlushWorker.h>
+#include <benchmark_kernels.h>
+#include <common.h>
+
+//Libraries
+#include <iostream>
+
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+using namespace xmem;
+
+FlushWorker::FlushWorker(
+        void* mem_array,
+        size_t len,
+        flush_op_t flush_op,
+        bool dirty,
+        bool fenced,
+        std::atomic<uint32_t>* arrived,
+        uint32_t num_workers,
+        int32_t cpu_affinity
+    ) :
+        MemoryWorker(
+            mem_array,
+            len,
+            cpu_affinity
+        ),
+        flush_op_(flush_op),
+        dirty_(dirty),
+        fenced_(fenced),
+        arrived_(arrived),
+        num_workers_(num_workers)
+    {
+}
+
+FlushWorker::~FlushWorker() {
+}
+
+double FlushWorker::getFlushThroughput() {
+    double retval = 0;
+    if (acquireLock(-1)) {
+        if (completed_ && adjusted_ticks_ > 0)
+            retval = (static_cast<double>(passes_) * len_ / MB) / (adjusted_ticks_ * g_ns_per_tick / 1e9);
+        releaseLock();
+    }
+
+    return retval;
+}
+
+double FlushWorker::getMeanLineFlushTime() {
+    double retval = 0;
+    if (acquireLock(-1)) {
+        if (completed_ && passes_ > 0)
+            retval = (adjusted_ticks_ * g_ns_per_tick) / (static_cast<double>(passes_) * len_ / CACHE_LINE_SIZE);
+        releaseLock();
+    }
+
+    return retval;
+}
+
+void FlushWorker::run() {
+    //Set up relevant state -- localized to this thread's stack
+    int32_t cpu_affinity = 0;
+    void* start_address = NULL;
+    void* end_address = NULL;
+    flush_op_t flush_op = FLUSH_CLFLUSH;
+    bool dirty = false;
+    bool fenced = false;
+    std::atomic<uint32_t>* arrived = NULL;
+    uint32_t num_workers = 0;
+    SequentialFunction kernel_fptr = NULL;
+    SequentialFunction kernel_dummy_fptr = NULL;
+    tick_t start_tick = 0;
+    tick_t stop_tick = 0;
+    tick_t elapsed_ticks = 0;
+    tick_t elapsed_dummy_ticks = 0;
+    tick_t adjusted_ticks = 0;
+    tick_t target_ticks = g_ticks_per_ms * FLUSH_BENCHMARK_DURATION_MS; //Rough target flush duration in ticks
+    uint32_t passes = 0;
+    uint32_t p = 0;
+    bool warning = false;
+
+    //Grab relevant setup state thread-safely and keep it local
+    if (acquireLock(-1)) {
+        start_address = mem_array_;
+        end_address = reinterpret_cast<void*>(reinterpret_cast<uint8_t*>(mem_array_) + len_);
+        flush_op = flush_op_;
+        dirty = dirty_;
+        fenced = fenced_;
+        arrived = arrived_;
+        num_workers = num_workers_;
+        cpu_affinity = cpu_affinity_;
+        releaseLock();
+    }
+
+    if (!determine_flush_kernel(flush_op, fenced, &kernel_fptr, &kernel_dummy_fptr)) {
+        std::cerr << "ERROR: Failed to find a cache flush kernel." << std::endl;
+        arrived->fetch_add(1); //Still arrive, so that the other workers do not wait for this one forever
+        return;
+    }
+    
+    //Set processor affinity
+    bool locked = lock_thread_to_cpu(cpu_affinity);
+    if (!locked)
+        std::cerr << "WARNING: Failed to lock thread to logical CPU " << cpu_affinity << "! Results may not be correct." << std::endl;
+
+    //Increase scheduling priority
+#ifdef _WIN32
+    DWORD original_priority_class;
+    DWORD original_priority;
+    if (!boost_scheduling_priority(original_priority_class, original_priority))
+#endif
+#ifdef __gnu_linux__
+    if (!boost_scheduling_priority())
+#endif
+        std::cerr << "WARNING: Failed to boost scheduling priority. Perhaps running in Administrator mode would help." << std::endl;
+
+    //Wait for the other workers so that all of them flush at the same time
+    arrived->fetch_add(1);
+    while (arrived->load() < num_workers)
+        ;
+
+    //Run actual version of function and loop overhead. Bringing the lines into the cache before each pass is not timed.
+    while (elapsed_ticks < target_ticks) {
+        if (dirty)
+            forwSequentialWrite_Word32(start_address, end_address);
+        else
+            forwSequentialRead_Word32(start_address, end_address);
+        start_tick = start_timer();
+        (*kernel_fptr)(start_address, end_address);
+        stop_tick = stop_timer();
+        elapsed_ticks += (stop_tick - start_tick);
+        passes++;
+    }
+
+    //Run dummy version of function and loop overhead
+    while (p < passes) {
+        start_tick = start_timer();
+        (*kernel_dummy_fptr)(start_address, end_address);
+        stop_tick = stop_timer();
+        elapsed_dummy_ticks += (stop_tick - start_tick);
+        p++;
+    }
+
+    adjusted_ticks = elapsed_ticks - elapsed_dummy_ticks;
+
+    //Warn if something looks fishy
+    if (elapsed_dummy_ticks >= elapsed_ticks || elapsed_ticks < MIN_ELAPSED_TICKS || adjusted_ticks < 0.5 * elapsed_ticks)
+        warning = true;
+
+    //Unset processor affinity
+    if (locked)
+        unlock_thread_to_cpu();
+
+    //Revert thread priority
+#ifdef _WIN32
+    if (!revert_scheduling_priority(original_priority_class, original_priority))
+#endif
+#ifdef __gnu_linux__
+    if (!revert_scheduling_priority())
+#endif
+        std::cerr << "WARNING: Failed to revert scheduling priority. Perhaps running in Administrator mode would help." << std::endl;
+
+    //Update the object state thread-safely
+    if (acquireLock(-1)) {
+        elapsed_ticks_ = elapsed_ticks;
+        elapsed_dummy_ticks_ = elapsed_dummy_ticks;
+        adjusted_ticks_ = adjusted_ticks;
+        passes_ = passes;
+        warning_ = warning;
+        completed_ = true;
+        releaseLock();
+    }
+}
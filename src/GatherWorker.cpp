@@ -0,0 +1,199 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Microsoft
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Author: Mark Gottscho <mgottscho@ucla.edu>
+ */
+/**
+ * @file
+ * 
+ * @brief Implementation file for the GatherWorker class.
+ */
+
+//Headers
+#include <GatherWorker.h>
+#include <benchmark_kernels.h>
+#include <common.h>
+
+//Libraries
+#include <cstring>
+#include <iostream>
+
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+using namespace xmem;
+
+GatherWorker::GatherWorker(
+        void* data,
+        uint32_t* indices,
+        size_t num_elements,
+        gather_engine_t engine,
+        int32_t cpu_affinity
+    ) :
+        MemoryWorker(
+            data,
+            num_elements * sizeof(Word64_t),
+            cpu_affinity
+        ),
+        indices_(indices),
+        num_elements_(num_elements),
+        engine_(engine),
+        elements_(0)
+    {
+}
+
+GatherWorker::~GatherWorker() {
+}
+
+double GatherWorker::getElementThroughput() {
+    double retval = 0;
+    if (acquireLock(-1)) {
+        if (completed_ && adjusted_ticks_ > 0)
+            retval = (static_cast<double>(elements_) / 1e6) / (adjusted_ticks_ * g_ns_per_tick / 1e9);
+        releaseLock();
+    }
+
+    return retval;
+}
+
+double GatherWorker::getMeanElementLatency() {
+    double retval = 0;
+    if (acquireLock(-1)) {
+        if (completed_ && elements_ > 0)
+            retval = (adjusted_ticks_ * g_ns_per_tick) / elements_;
+        releaseLock();
+    }
+
+    return retval;
+}
+
+void GatherWorker::run() {
+    //Set up relevant state -- localized to this thread's stack
+    int32_t cpu_affinity = 0;
+    void* data = NULL;
+    uint32_t* indices = NULL;
+    size_t num_elements = 0;
+    gather_engine_t engine = GATHER_SCALAR;
+    GatherFunction kernel_fptr = NULL;
+    GatherFunction kernel_dummy_fptr = NULL;
+    tick_t start_tick = 0;
+    tick_t stop_tick = 0;
+    tick_t elapsed_ticks = 0;
+    tick_t elapsed_dummy_ticks = 0;
+    tick_t adjusted_ticks = 0;
+    tick_t target_ticks = g_ticks_per_ms * GATHER_BENCHMARK_DURATION_MS; //Rough target run duration in ticks
+    uint64_t passes_per_timing = 0;
+    uint64_t passes = 0;
+    uint64_t p = 0;
+    bool warning = false;
+
+    //Grab relevant setup state thread-safely and keep it local
+    if (acquireLock(-1)) {
+        data = mem_array_;
+        indices = indices_;
+        num_elements = num_elements_;
+        engine = engine_;
+        cpu_affinity = cpu_affinity_;
+        releaseLock();
+    }
+
+    if (num_elements == 0 || num_elements % 8 != 0 || !determine_gather_kernel(engine, &kernel_fptr, &kernel_dummy_fptr)) {
+        std::cerr << "ERROR: Failed to find a gather kernel." << std::endl;
+        return;
+    }
+
+    //Time several passes together when the index array is short, so that timer overhead stays small
+    passes_per_timing = GATHER_ELEMENTS_PER_TIMING / num_elements;
+    if (passes_per_timing == 0)
+        passes_per_timing = 1;
+    
+    //Set processor affinity
+    bool locked = lock_thread_to_cpu(cpu_affinity);
+    if (!locked)
+        std::cerr << "WARNING: Failed to lock thread to logical CPU " << cpu_affinity << "! Results may not be correct." << std::endl;
+
+    //Increase scheduling priority
+#ifdef _WIN32
+    DWORD original_priority_class;
+    DWORD original_priority;
+    if (!boost_scheduling_priority(original_priority_class, original_priority))
+#endif
+#ifdef __gnu_linux__
+    if (!boost_scheduling_priority())
+#endif
+        std::cerr << "WARNING: Failed to boost scheduling priority. Perhaps running in Administrator mode would help." << std::endl;
+
+    //Prime memory
+    std::memset(data, 0, num_elements * sizeof(Word64_t));
+    (*kernel_fptr)(data, indices, num_elements);
+
+    //Run actual version of function and loop overhead
+    while (elapsed_ticks < target_ticks) {
+        start_tick = start_timer();
+        for (uint64_t i = 0; i < passes_per_timing; i++)
+            (*kernel_fptr)(data, indices, num_elements);
+        stop_tick = stop_timer();
+        elapsed_ticks += (stop_tick - start_tick);
+        passes += passes_per_timing;
+    }
+
+    //Run dummy version of function and loop overhead
+    while (p < passes) {
+        start_tick = start_timer();
+        for (uint64_t i = 0; i < passes_per_timing; i++)
+            (*kernel_dummy_fptr)(data, indices, num_elements);
+        stop_tick = stop_timer();
+        elapsed_dummy_ticks += (stop_tick - start_tick);
+        p += passes_per_timing;
+    }
+
+    adjusted_ticks = elapsed_ticks - elapsed_dummy_ticks;
+
+    //Warn if something looks fishy
+    if (elapsed_dummy_ticks >= elapsed_ticks || elapsed_ticks < MIN_ELAPSED_TICKS || adjusted_ticks < 0.5 * elapsed_ticks)
+        warning = true;
+
+    //Unset processor affinity
+    if (locked)
+        unlock_thread_to_cpu();
+
+    //Revert thread priority
+#ifdef _WIN32
+    if (!revert_scheduling_priority(original_priority_class, original_priority))
+#endif
+#ifdef __gnu_linux__
+    if (!revert_scheduling_priority())
+#endif
+        std::cerr << "WARNING: Failed to revert scheduling priority. Perhaps running in Administrator mode would help." << std::endl;
+
+    //Update the object state thread-safely
+    if (acquireLock(-1)) {
+        elapsed_ticks_ = elapsed_ticks;
+        elapsed_dummy_ticks_ = elapsed_dummy_ticks;
+        adjusted_ticks_ = adjusted_ticks;
+        elements_ = passes * num_elements;
+        warning_ = warning;
+        completed_ = true;
+        releaseLock();
+    }
+}
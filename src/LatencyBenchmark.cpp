@@ -40,6 +40,7 @@
 //Libraries
 #include <iostream>
 #include <random>
+#include <algorithm>
 #include <assert.h>
 #include <time.h>
 
@@ -80,11 +81,75 @@ LatencyBenchmark::LatencyBenchmark(
             name
         ),
         load_metric_on_iter_(),
-        mean_load_metric_(0)
+        mean_load_metric_(0),
+        load_mem_arrays_(),
+        load_cpu_nodes_(),
+        load_mem_nodes_(),
+        load_target_bandwidth_(0),
+        load_controller_error_on_iter_(),
+        mean_load_controller_error_(0),
+        use_load_profile_(false),
+        load_profile_(),
+        time_series_on_iter_(),
+        low_load_latency_(-1),
+        high_load_latency_(-1),
+        high_load_99_percentile_latency_(-1),
+        mean_recovery_ms_(-1),
+        max_recovery_ms_(-1),
+        num_unrecovered_drops_(0),
+        all_core_latency_(false),
+        cold_cache_(false),
+        thread_cpus_(),
+        thread_latency_on_iter_(),
+        mean_thread_latency_(num_worker_threads, 0)
     { 
 
-    for (uint32_t i = 0; i < iterations_; i++) 
+    for (uint32_t i = 0; i < iterations_; i++) {
         load_metric_on_iter_.push_back(0);
+        load_controller_error_on_iter_.push_back(0);
+        time_series_on_iter_.push_back(std::vector<LatencySample>());
+        thread_latency_on_iter_.push_back(std::vector<double>(num_worker_threads_, 0));
+    }
+}
+
+LatencyBenchmark::LatencyBenchmark(
+        void* mem_array,
+        size_t len,
+        uint32_t iterations,
+        uint32_t num_worker_threads,
+        uint32_t mem_node,
+        uint32_t cpu_node,
+        pattern_mode_t pattern_mode,
+        rw_mode_t rw_mode,
+        chunk_size_t chunk_size,
+        int32_t stride_size,
+        std::vector<PowerReader*> dram_power_readers,
+        std::string name,
+        std::vector<void*> load_mem_arrays,
+        std::vector<uint32_t> load_cpu_nodes,
+        std::vector<uint32_t> load_mem_nodes,
+        double load_target_bandwidth
+    ) :
+        LatencyBenchmark(
+            mem_array,
+            len,
+            iterations,
+            num_worker_threads,
+            mem_node,
+            cpu_node,
+            pattern_mode,
+            rw_mode,
+            chunk_size,
+            stride_size,
+            dram_power_readers,
+            name
+        )
+    {
+
+    load_mem_arrays_ = load_mem_arrays;
+    load_cpu_nodes_ = load_cpu_nodes;
+    load_mem_nodes_ = load_mem_nodes;
+    load_target_bandwidth_ = load_target_bandwidth;
 }
 
 void LatencyBenchmark::reportBenchmarkInfo() const {
@@ -92,9 +157,14 @@ void LatencyBenchmark::reportBenchmarkInfo() const {
     std::cout << "Memory NUMA Node: " << mem_node_ << std::endl;
     std::cout << "Latency measurement chunk size: ";
     std::cout << sizeof(uintptr_t)*8 << "-bit" << std::endl;
-    std::cout << "Latency measurement access pattern: random read (pointer-chasing)" << std::endl;
+    std::cout << "Latency measurement access pattern: random read (pointer-chasing)";
+    if (cold_cache_)
+        std::cout << ", caches flushed before each pass (cold cache)";
+    std::cout << std::endl;
 
-    if (num_worker_threads_ > 1) {
+    if (all_core_latency_)
+        std::cout << "Latency measurement threads: " << num_worker_threads_ << " running at the same time, each over its own chain (all-core latency, no load threads)" << std::endl;
+    else if (num_worker_threads_ > 1) {
         std::cout << "Load Chunk Size: ";
         switch (chunk_size_) {
             case CHUNK_32b:
@@ -154,6 +224,12 @@ void LatencyBenchmark::reportBenchmarkInfo() const {
             case WRITE:
                 std::cout << "write";
                 break;
+            case READ_WRITE_1_1:
+            case READ_WRITE_2_1:
+            case READ_WRITE_3_1:
+            case READ_MODIFY_WRITE:
+                std::cout << rw_mode_name(rw_mode_);
+                break;
             default:
                 std::cout << "UNKNOWN";
                 break;
@@ -162,6 +238,19 @@ void LatencyBenchmark::reportBenchmarkInfo() const {
 
         std::cout << "Load number of worker threads: " << num_worker_threads_-1;
         std::cout << std::endl;
+
+        if (load_cpu_nodes_.size() > 0) {
+            std::cout << "Load CPU NUMA Node -> Memory NUMA Node placements:";
+            for (uint32_t p = 0; p < load_cpu_nodes_.size(); p++)
+                std::cout << " " << load_cpu_nodes_[p] << "->" << load_mem_nodes_[p];
+            std::cout << std::endl;
+        }
+
+        if (load_target_bandwidth_ > 0)
+            std::cout << "Load target bandwidth: " << load_target_bandwidth_ << " MB/s across all load threads (rate-controlled)" << std::endl;
+
+        if (use_load_profile_)
+            std::cout << "Load profile: " << load_profile_.getDescription() << ", " << load_profile_.getDurationMS() << " ms period, across all load threads (rate-controlled)" << std::endl;
     }
 
     std::cout << std::endl;
@@ -191,6 +280,29 @@ void LatencyBenchmark::reportResults() const {
             std::cout << " (WARNING)";
         std::cout << std::endl;
 
+        if (load_target_bandwidth_ > 0 && num_worker_threads_ > 1) {
+            std::cout << "Requested load: " << load_target_bandwidth_ << " MB/s, achieved: " << mean_load_metric_ << " MB/s (" << 100 * mean_load_metric_ / load_target_bandwidth_ << "% of requested), mean controller error: " << mean_load_controller_error_ << "%";
+            if (mean_load_metric_ < LOAD_RATE_CONTROL_SHORTFALL_THRESHOLD * load_target_bandwidth_)
+                std::cout << " (WARNING: target not reached)";
+            std::cout << std::endl;
+        }
+
+        if (use_load_profile_ && num_worker_threads_ > 1) {
+            std::cout << "Load profile mean controller error: " << mean_load_controller_error_ << "%" << std::endl;
+            if (low_load_latency_ >= 0 && high_load_latency_ >= 0) {
+                std::cout << "Load profile latency: " << low_load_latency_ << " " << metric_units_ << " at low load, " << high_load_latency_ << " " << metric_units_ << " at high load (99th percentile worst pass: " << high_load_99_percentile_latency_ << " " << metric_units_ << ")" << std::endl;
+                std::cout << "Load profile recovery after load drops: ";
+                if (mean_recovery_ms_ >= 0)
+                    std::cout << mean_recovery_ms_ << " ms mean, " << max_recovery_ms_ << " ms max";
+                else
+                    std::cout << "N/A";
+                if (num_unrecovered_drops_ > 0)
+                    std::cout << " (WARNING: " << num_unrecovered_drops_ << " drops did not recover)";
+                std::cout << std::endl;
+            } else
+                std::cout << "Load profile latency: not enough samples at both low and high load to compare" << std::endl;
+        }
+
         std::cout << "Min: " << min_metric_ << " " << metric_units_;
         if (warning_)
             std::cout << " (WARNING)";
@@ -234,6 +346,24 @@ void LatencyBenchmark::reportResults() const {
         std::cout << std::endl;
         std::cout << std::endl;
         
+        if (all_core_latency_) {
+            uint32_t fastest = 0;
+            uint32_t slowest = 0;
+            for (uint32_t t = 1; t < num_worker_threads_; t++) {
+                if (mean_thread_latency_[t] < mean_thread_latency_[fastest])
+                    fastest = t;
+                if (mean_thread_latency_[t] > mean_thread_latency_[slowest])
+                    slowest = t;
+            }
+
+            std::cout << "Per-CPU latency with all " << num_worker_threads_ << " threads measuring at the same time (CPU NUMA node " << cpu_node_ << "):" << std::endl;
+            for (uint32_t t = 0; t < num_worker_threads_; t++)
+                std::printf("    CPU %4d:    %0.3f %s    (+%0.1f%% vs. fastest)\n", thread_cpus_[t], mean_thread_latency_[t], metric_units_.c_str(), 100 * (mean_thread_latency_[t] / mean_thread_latency_[fastest] - 1));
+            std::cout << "Fastest: CPU " << thread_cpus_[fastest] << " at " << mean_thread_latency_[fastest] << " " << metric_units_ << ", slowest: CPU " << thread_cpus_[slowest] << " at " << mean_thread_latency_[slowest] << " " << metric_units_ << std::endl;
+            std::cout << std::endl;
+            std::cout << std::endl;
+        }
+
         for (uint32_t i = 0; i < dram_power_readers_.size(); i++) {
             if (dram_power_readers_[i] != NULL) {
                 std::cout << dram_power_readers_[i]->name() << " Power Statistics..." << std::endl;
@@ -260,6 +390,122 @@ double LatencyBenchmark::getMeanLoadMetric() const {
         return -1;
 }
 
+int32_t LatencyBenchmark::getThreadCPU(uint32_t thread) const {
+    if (has_run_ && thread < thread_cpus_.size())
+        return thread_cpus_[thread];
+    else //bad call
+        return -1;
+}
+
+double LatencyBenchmark::getMeanThreadLatency(uint32_t thread) const {
+    if (has_run_ && all_core_latency_ && thread < num_worker_threads_)
+        return mean_thread_latency_[thread];
+    else //bad call
+        return -1;
+}
+
+double LatencyBenchmark::getMeanLoadControllerError() const {     
+    if (has_run_)
+        return mean_load_controller_error_;
+    else //bad call
+        return -1;
+}
+
+void LatencyBenchmark::setLoadProfile(const LoadProfile& load_profile) {
+    load_profile_ = load_profile;
+    use_load_profile_ = !load_profile_.isEmpty();
+}
+
+std::vector<LatencySample> LatencyBenchmark::getTimeSeriesOnIter(uint32_t iter) const {
+    if (has_run_ && iter >= 1 && iter <= iterations_)
+        return time_series_on_iter_[iter - 1];
+    else //bad call
+        return std::vector<LatencySample>();
+}
+
+double LatencyBenchmark::getRequestedLoadAt(const LatencySample& sample) const {
+    return load_profile_.getBandwidthAt(sample.time_ms + static_cast<double>(LOAD_PROFILE_SAMPLE_PERIOD_US) / 2000);
+}
+
+void LatencyBenchmark::computeTimeSeriesMetrics() {
+    low_load_latency_ = -1;
+    high_load_latency_ = -1;
+    high_load_99_percentile_latency_ = -1;
+    mean_recovery_ms_ = -1;
+    max_recovery_ms_ = -1;
+    num_unrecovered_drops_ = 0;
+
+    //Samples are split into low and high load at the midpoint of the profile's bandwidth range. A flat profile has nothing to compare.
+    if (!use_load_profile_ || num_worker_threads_ < 2 || load_profile_.getMaxBandwidth() <= load_profile_.getMinBandwidth())
+        return;
+    double midpoint = (load_profile_.getMinBandwidth() + load_profile_.getMaxBandwidth()) / 2;
+
+    std::vector<double> low_latencies;
+    std::vector<double> high_worst_latencies;
+    double high_total_latency = 0;
+    for (uint32_t i = 0; i < iterations_; i++) {
+        for (size_t s = 0; s < time_series_on_iter_[i].size(); s++) {
+            const LatencySample& sample = time_series_on_iter_[i][s];
+            if (sample.passes == 0)
+                continue;
+            if (getRequestedLoadAt(sample) > midpoint) {
+                high_total_latency += sample.mean_latency_ns;
+                high_worst_latencies.push_back(sample.max_latency_ns);
+            } else
+                low_latencies.push_back(sample.mean_latency_ns);
+        }
+    }
+
+    if (low_latencies.empty() || high_worst_latencies.empty())
+        return;
+
+    std::sort(low_latencies.begin(), low_latencies.end());
+    std::sort(high_worst_latencies.begin(), high_worst_latencies.end());
+    low_load_latency_ = low_latencies[low_latencies.size() / 2];
+    high_load_latency_ = high_total_latency / high_worst_latencies.size();
+    high_load_99_percentile_latency_ = high_worst_latencies[static_cast<size_t>(0.99 * (high_worst_latencies.size()-1))];
+
+    //After each drop from high to low load, find the first sample whose latency is back near the low-load latency.
+    double recovered_latency = low_load_latency_ * (1 + LOAD_PROFILE_RECOVERY_TOLERANCE);
+    double total_recovery_ms = 0;
+    uint32_t num_recovered_drops = 0;
+    for (uint32_t i = 0; i < iterations_; i++) {
+        bool was_high = false;
+        bool recovering = false;
+        double drop_ms = 0;
+        for (size_t s = 0; s < time_series_on_iter_[i].size(); s++) {
+            const LatencySample& sample = time_series_on_iter_[i][s];
+            if (sample.passes == 0)
+                continue;
+            bool high = getRequestedLoadAt(sample) > midpoint;
+            if (high) {
+                if (recovering)
+                    num_unrecovered_drops_++;
+                recovering = false;
+            } else {
+                if (was_high) {
+                    recovering = true;
+                    drop_ms = sample.time_ms;
+                }
+                if (recovering && sample.mean_latency_ns <= recovered_latency) {
+                    double recovery_ms = sample.time_ms - drop_ms;
+                    total_recovery_ms += recovery_ms;
+                    if (recovery_ms > max_recovery_ms_)
+                        max_recovery_ms_ = recovery_ms;
+                    num_recovered_drops++;
+                    recovering = false;
+                }
+            }
+            was_high = high;
+        }
+        if (recovering)
+            num_unrecovered_drops_++;
+    }
+
+    if (num_recovered_drops > 0)
+        mean_recovery_ms_ = total_recovery_ms / num_recovered_drops;
+}
+
 bool LatencyBenchmark::runCore() {
     size_t len_per_thread = len_ / num_worker_threads_; //Carve up memory space so each worker has its own area to play in
 
@@ -271,6 +517,31 @@ bool LatencyBenchmark::runCore() {
     forwSequentialWrite_Word32(mem_array_,
                                reinterpret_cast<void*>(reinterpret_cast<uint8_t*>(mem_array_)+len_)); //static casts to silence compiler warnings
 
+    //Work out where each thread runs and which memory it uses. Thread 0 is the latency thread. Load threads are co-located with it unless separate load placements were given, in which case they
+    //are dealt round-robin across the load placements. Thread t always uses the t-th per-thread sub-range of its memory node's region, so threads never overlap even when placements share a node.
+    std::vector<void*> thread_mem_arrays;
+    std::vector<int32_t> thread_cpu_ids;
+    std::vector<uint32_t> next_rank_in_node(g_num_numa_nodes, 0);
+    for (uint32_t t = 0; t < num_worker_threads_; t++) {
+        void* base = mem_array_;
+        uint32_t thread_cpu_node = cpu_node_;
+        if (t > 0 && load_cpu_nodes_.size() > 0) {
+            uint32_t p = (t-1) % static_cast<uint32_t>(load_cpu_nodes_.size());
+            base = load_mem_arrays_[p];
+            thread_cpu_node = load_cpu_nodes_[p];
+        }
+        thread_mem_arrays.push_back(reinterpret_cast<void*>(reinterpret_cast<uint8_t*>(base) + t*len_per_thread));
+        uint32_t rank = next_rank_in_node[thread_cpu_node]++;
+        int32_t cpu_id = cpu_id_in_numa_node(thread_cpu_node, rank);
+        if (cpu_id < 0)
+            std::cerr << "WARNING: Failed to find logical CPU " << rank << " in NUMA node " << thread_cpu_node << std::endl;
+        thread_cpu_ids.push_back(cpu_id);
+
+        if (base != mem_array_) //Make sure separately placed load memory is physically resident too
+            forwSequentialWrite_Word32(thread_mem_arrays[t],
+                                       reinterpret_cast<void*>(reinterpret_cast<uint8_t*>(thread_mem_arrays[t])+len_per_thread)); //static casts to silence compiler warnings
+    }
+
     //Build pointer indices for random-access latency thread. We assume that latency thread is the first one, so we use beginning of memory region.
     if (!build_random_pointer_permutation(mem_array_,
                                        reinterpret_cast<void*>(reinterpret_cast<uint8_t*>(mem_array_)+len_per_thread), //static casts to silence compiler warnings
@@ -284,12 +555,28 @@ bool LatencyBenchmark::runCore() {
         return false;
     }
 
+    //In all-core latency mode, every other thread chases pointers over a chain in its own region too
+    for (uint32_t t = 1; t < num_worker_threads_ && all_core_latency_; t++) {
+        if (!build_random_pointer_permutation(thread_mem_arrays[t],
+                                           reinterpret_cast<void*>(reinterpret_cast<uint8_t*>(thread_mem_arrays[t])+len_per_thread), //static casts to silence compiler warnings
+#ifndef HAS_WORD_64 //special case: 32-bit architectures
+                                           CHUNK_32b)) { 
+#endif
+#ifdef HAS_WORD_64
+                                           CHUNK_64b)) { 
+#endif
+            std::cerr << "ERROR: Failed to build a random pointer permutation for a latency measurement thread!" << std::endl;
+            return false;
+        }
+    }
+    thread_cpus_ = thread_cpu_ids;
+
     //Set up load generation kernel function pointers
     SequentialFunction load_kernel_fptr_seq = NULL;
     SequentialFunction load_kernel_dummy_fptr_seq = NULL; 
     RandomFunction load_kernel_fptr_ran = NULL;
     RandomFunction load_kernel_dummy_fptr_ran = NULL; 
-    if (num_worker_threads_ > 1) { //If we only have one worker thread, it is used for latency measurement only, and no load threads will be used.
+    if (num_worker_threads_ > 1 && !all_core_latency_) { //If we only have one worker thread, it is used for latency measurement only, and no load threads will be used.
         if (pattern_mode_ == SEQUENTIAL) {
             if (!determine_sequential_kernel(rw_mode_, chunk_size_, stride_size_, &load_kernel_fptr_seq, &load_kernel_dummy_fptr_seq)) {
                 std::cerr << "ERROR: Failed to find appropriate benchmark kernel." << std::endl;
@@ -303,8 +590,8 @@ bool LatencyBenchmark::runCore() {
 
             //Build pointer indices for random-access load threads. Note that the pointers for each load thread must stay within its respective region, otherwise sharing may occur. 
             for (uint32_t i = 1; i < num_worker_threads_; i++) {
-                if (!build_random_pointer_permutation(reinterpret_cast<void*>(reinterpret_cast<uint8_t*>(mem_array_) + i*len_per_thread), //static casts to silence compiler warnings
-                                                   reinterpret_cast<void*>(reinterpret_cast<uint8_t*>(mem_array_) + (i+1)*len_per_thread), //static casts to silence compiler warnings
+                if (!build_random_pointer_permutation(thread_mem_arrays[i],
+                                                   reinterpret_cast<void*>(reinterpret_cast<uint8_t*>(thread_mem_arrays[i]) + len_per_thread), //static casts to silence compiler warnings
                                                    chunk_size_)) {
                     std::cerr << "ERROR: Failed to build a random pointer permutation for a load generation thread!" << std::endl;
                     return false;
@@ -335,36 +622,57 @@ bool LatencyBenchmark::runCore() {
     if (g_verbose)
         std::cout << "Running benchmark." << std::endl << std::endl;
 
+    //With a load profile, all workers of an iteration start the profile at the same tick and run for at least one period of it
+    bool follow_load_profile = use_load_profile_ && num_worker_threads_ > 1 && !all_core_latency_;
+    tick_t profile_duration_ticks = g_ticks_per_ms * BENCHMARK_DURATION_MS;
+    if (follow_load_profile && load_profile_.getDurationMS() > BENCHMARK_DURATION_MS)
+        profile_duration_ticks = static_cast<tick_t>(load_profile_.getDurationMS() * g_ticks_per_ms);
+    tick_t sample_ticks = static_cast<tick_t>(static_cast<double>(g_ticks_per_ms) * LOAD_PROFILE_SAMPLE_PERIOD_US / 1000);
+    if (sample_ticks < 1)
+        sample_ticks = 1;
+
     //Do a bunch of iterations of the core benchmark routine
     for (uint32_t i = 0; i < iterations_; i++) {
+        tick_t profile_start_tick = 0;
+        if (follow_load_profile)
+            profile_start_tick = start_timer() + g_ticks_per_ms * LOAD_PROFILE_START_DELAY_MS;
 
         //Create load workers and load worker threads
         for (uint32_t t = 0; t < num_worker_threads_; t++) {
-            void* thread_mem_array = reinterpret_cast<void*>(reinterpret_cast<uint8_t*>(mem_array_) + t*len_per_thread);
-            int32_t cpu_id = cpu_id_in_numa_node(cpu_node_, t);
-            if (cpu_id < 0)
-                std::cerr << "WARNING: Failed to find logical CPU " << t << " in NUMA node " << cpu_node_ << std::endl;
-            if (t == 0) { //special case: thread 0 is always latency thread
-                workers.push_back(new LatencyWorker(thread_mem_array,
-                                                    len_per_thread,
-                                                    lat_kernel_fptr,
-                                                    lat_kernel_dummy_fptr,
-                                                    cpu_id));
+            void* thread_mem_array = thread_mem_arrays[t];
+            int32_t cpu_id = thread_cpu_ids[t];
+            if (t == 0 || all_core_latency_) { //special case: thread 0 is always latency thread, and in all-core latency mode every thread is
+                LatencyWorker* lat_worker = new LatencyWorker(thread_mem_array,
+                                                              len_per_thread,
+                                                              lat_kernel_fptr,
+                                                              lat_kernel_dummy_fptr,
+                                                              cpu_id);
+                if (cold_cache_)
+                    lat_worker->setColdCache(true);
+                if (follow_load_profile)
+                    lat_worker->setTimeSeries(profile_start_tick, profile_duration_ticks, sample_ticks);
+                workers.push_back(lat_worker);
             } else {
+                LoadWorker* load_worker = NULL;
                 if (pattern_mode_ == SEQUENTIAL)
-                    workers.push_back(new LoadWorker(thread_mem_array,
-                                                     len_per_thread,
-                                                     load_kernel_fptr_seq,
-                                                     load_kernel_dummy_fptr_seq,
-                                                     cpu_id));
+                    load_worker = new LoadWorker(thread_mem_array,
+                                                 len_per_thread,
+                                                 load_kernel_fptr_seq,
+                                                 load_kernel_dummy_fptr_seq,
+                                                 cpu_id);
                 else if (pattern_mode_ == RANDOM)
-                    workers.push_back(new LoadWorker(thread_mem_array,
-                                                     len_per_thread,
-                                                     load_kernel_fptr_ran,
-                                                     load_kernel_dummy_fptr_ran,
-                                                     cpu_id));
+                    load_worker = new LoadWorker(thread_mem_array,
+                                                 len_per_thread,
+                                                 load_kernel_fptr_ran,
+                                                 load_kernel_dummy_fptr_ran,
+                                                 cpu_id);
                 else
                     std::cerr << "WARNING: Invalid benchmark pattern mode." << std::endl;
+                if (load_worker != NULL && load_target_bandwidth_ > 0)
+                    load_worker->setTargetBandwidth(load_target_bandwidth_ / (num_worker_threads_-1)); //Each load thread holds an equal share of the aggregate target
+                if (load_worker != NULL && follow_load_profile)
+                    load_worker->setLoadProfile(&load_profile_, 1.0 / (num_worker_threads_-1), profile_start_tick, profile_duration_ticks);
+                workers.push_back(load_worker);
             }
             worker_threads.push_back(new Thread(workers[t]));
         }
@@ -388,6 +696,8 @@ bool LatencyBenchmark::runCore() {
         uint32_t lat_bytes_per_pass = workers[0]->getBytesPerPass();
         uint32_t lat_accesses_per_pass = lat_bytes_per_pass / 8;
         iterwarning |= workers[0]->hadWarning();
+        if (follow_load_profile)
+            time_series_on_iter_[i] = static_cast<LatencyWorker*>(workers[0])->getTimeSeries();
         
         //Compute throughput generated by load threads
         uint32_t load_total_passes = 0;
@@ -395,7 +705,9 @@ bool LatencyBenchmark::runCore() {
         tick_t load_total_elapsed_dummy_ticks = 0;
         uint32_t load_bytes_per_pass = 0;
         double load_avg_adjusted_ticks = 0;
-        for (uint32_t t = 1; t < num_worker_threads_; t++) {
+        double load_total_controller_error = 0;
+        for (uint32_t t = 1; t < num_worker_threads_ && !all_core_latency_; t++) {
+            load_total_controller_error += static_cast<LoadWorker*>(workers[t])->getControllerError();
             load_total_passes += workers[t]->getPasses();
             load_total_adjusted_ticks += workers[t]->getAdjustedTicks();
             load_total_elapsed_dummy_ticks += workers[t]->getElapsedDummyTicks();
@@ -405,8 +717,10 @@ bool LatencyBenchmark::runCore() {
 
         //Compute load metrics for this iteration
         load_avg_adjusted_ticks = static_cast<double>(load_total_adjusted_ticks) / (num_worker_threads_-1);
-        if (num_worker_threads_ > 1)
+        if (num_worker_threads_ > 1 && !all_core_latency_) {
             load_metric_on_iter_[i] = (((static_cast<double>(load_total_passes) * static_cast<double>(load_bytes_per_pass)) / static_cast<double>(MB)))   /  ((load_avg_adjusted_ticks * g_ns_per_tick) / 1e9);
+            load_controller_error_on_iter_[i] = load_total_controller_error / (num_worker_threads_-1);
+        }
 
         if (iterwarning)
             warning_ = true;
@@ -430,7 +744,7 @@ bool LatencyBenchmark::runCore() {
             std::cout << std::endl;
 
             //Load threads
-            if (num_worker_threads_ > 1) {
+            if (num_worker_threads_ > 1 && !all_core_latency_) {
                 std::cout << "Iter " << i+1 << " had " << load_total_passes << " total load generation passes, with " << load_bytes_per_pass << " bytes per pass:";
                 if (iterwarning) std::cout << " -- WARNING";
                 std::cout << std::endl;
@@ -452,6 +766,16 @@ bool LatencyBenchmark::runCore() {
         
         //Compute overall metrics for this iteration
         metric_on_iter_[i] = static_cast<double>(lat_adjusted_ticks * g_ns_per_tick)  /  static_cast<double>(lat_accesses_per_pass * lat_passes);
+        if (all_core_latency_) { //Every thread measured latency, so keep each one and report their mean
+            double total_latency = 0;
+            for (uint32_t t = 0; t < num_worker_threads_; t++) {
+                thread_latency_on_iter_[i][t] = static_cast<double>(workers[t]->getAdjustedTicks() * g_ns_per_tick)  /  static_cast<double>((workers[t]->getBytesPerPass() / 8) * workers[t]->getPasses());
+                total_latency += thread_latency_on_iter_[i][t];
+                if (workers[t]->hadWarning())
+                    warning_ = true;
+            }
+            metric_on_iter_[i] = total_latency / num_worker_threads_;
+        }
         
         //Clean up workers and threads for this iteration
         for (uint32_t t = 0; t < num_worker_threads_; t++) {
@@ -480,9 +804,20 @@ bool LatencyBenchmark::runCore() {
     computeMetrics();
 
     //Get mean load metrics -- these aren't part of Benchmark class thus not covered by computeMetrics()
-    for (uint32_t i = 0; i < iterations_; i++)
+    for (uint32_t i = 0; i < iterations_; i++) {
         mean_load_metric_ += load_metric_on_iter_[i];
+        mean_load_controller_error_ += load_controller_error_on_iter_[i];
+    }
     mean_load_metric_ /= static_cast<double>(iterations_);
+    mean_load_controller_error_ /= static_cast<double>(iterations_);
+    for (uint32_t t = 0; t < num_worker_threads_ && all_core_latency_; t++) {
+        mean_thread_latency_[t] = 0;
+        for (uint32_t i = 0; i < iterations_; i++)
+            mean_thread_latency_[t] += thread_latency_on_iter_[i][t];
+        mean_thread_latency_[t] /= static_cast<double>(iterations_);
+    }
+
+    computeTimeSeriesMetrics();
 
     return true;
 }
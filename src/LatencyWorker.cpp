@@ -61,13 +61,44 @@ LatencyWorker::LatencyWorker(
             cpu_affinity
         ),
         kernel_fptr_(kernel_fptr),
-        kernel_dummy_fptr_(kernel_dummy_fptr)
+        kernel_dummy_fptr_(kernel_dummy_fptr),
+        series_start_tick_(0),
+        series_duration_ticks_(0),
+        sample_ticks_(0),
+        time_series_(),
+        cold_cache_(false)
     {
 }
 
 LatencyWorker::~LatencyWorker() {
 }
 
+void LatencyWorker::setTimeSeries(tick_t start_tick, tick_t duration_ticks, tick_t sample_ticks) {
+    if (acquireLock(-1)) {
+        series_start_tick_ = start_tick;
+        series_duration_ticks_ = duration_ticks;
+        sample_ticks_ = sample_ticks;
+        releaseLock();
+    }
+}
+
+void LatencyWorker::setColdCache(bool cold_cache) {
+    if (acquireLock(-1)) {
+        cold_cache_ = cold_cache;
+        releaseLock();
+    }
+}
+
+std::vector<LatencySample> LatencyWorker::getTimeSeries() {
+    std::vector<LatencySample> retval;
+    if (acquireLock(-1)) {
+        retval = time_series_;
+        releaseLock();
+    }
+
+    return retval;
+}
+
 void LatencyWorker::run() {
     //Set up relevant state -- localized to this thread's stack
     int32_t cpu_affinity = 0;
@@ -86,6 +117,10 @@ void LatencyWorker::run() {
     void* mem_array = NULL;
     size_t len = 0;
     tick_t target_ticks = g_ticks_per_ms * BENCHMARK_DURATION_MS; //Rough target run duration in ticks
+    tick_t series_start_tick = 0;
+    tick_t sample_ticks = 0;
+    std::vector<LatencySample> time_series;
+    bool cold_cache = false;
     
     //Grab relevant setup state thread-safely and keep it local
     if (acquireLock(-1)) {
@@ -95,6 +130,11 @@ void LatencyWorker::run() {
         cpu_affinity = cpu_affinity_;
         kernel_fptr = kernel_fptr_;
         kernel_dummy_fptr = kernel_dummy_fptr_;
+        series_start_tick = series_start_tick_;
+        sample_ticks = sample_ticks_;
+        if (sample_ticks > 0)
+            target_ticks = series_duration_ticks_;
+        cold_cache = cold_cache_;
         releaseLock();
     }
     
@@ -114,32 +154,110 @@ void LatencyWorker::run() {
 #endif
         std::cerr << "WARNING: Failed to boost scheduling priority. Perhaps running in Administrator mode would help." << std::endl;
 
-    //Prime memory
-    for (uint32_t i = 0; i < 4; i++) {
+    //Prime memory, unless every pass starts from a cold cache
+    for (uint32_t i = 0; i < 4 && !cold_cache; i++) {
         void* prime_start_address = mem_array; 
         void* prime_end_address = reinterpret_cast<void*>(reinterpret_cast<uint8_t*>(mem_array) + len);
         forwSequentialRead_Word32(prime_start_address, prime_end_address); //dependent reads on the memory, make sure caches are ready, coherence, etc...
     }
 
     //Run benchmark
-    //Run actual version of function and loop overhead
-    next_address = static_cast<uintptr_t*>(mem_array); 
-    while (elapsed_ticks < target_ticks) {
-        start_tick = start_timer();
-        UNROLL256((*kernel_fptr)(next_address, &next_address, 0);)
-        stop_tick = stop_timer();
-        elapsed_ticks += (stop_tick - start_tick);
-        passes+=256;
-    }
+    if (sample_ticks > 0) { //time series mode
+        //Time every pass on its own and bin it by the interval in which it started. Timer overhead is removed by the dummy run below, which is timed the same way.
+        size_t num_samples = static_cast<size_t>(target_ticks / sample_ticks) + 1;
+        std::vector<tick_t> sample_elapsed_ticks(num_samples, 0);
+        std::vector<tick_t> sample_max_ticks(num_samples, 0);
+        std::vector<uint32_t> sample_passes(num_samples, 0);
+
+        do { //Wait for the common start of the time series
+            stop_tick = stop_timer();
+        } while (stop_tick < series_start_tick);
+
+        //Run actual version of function and loop overhead
+        next_address = static_cast<uintptr_t*>(mem_array); 
+        while (stop_tick - series_start_tick < target_ticks) {
+            start_tick = start_timer();
+            (*kernel_fptr)(next_address, &next_address, 0);
+            stop_tick = stop_timer();
+            size_t s = static_cast<size_t>((start_tick - series_start_tick) / sample_ticks);
+            if (s >= num_samples)
+                s = num_samples-1;
+            sample_elapsed_ticks[s] += (stop_tick - start_tick);
+            if (stop_tick - start_tick > sample_max_ticks[s])
+                sample_max_ticks[s] = stop_tick - start_tick;
+            sample_passes[s]++;
+            elapsed_ticks += (stop_tick - start_tick);
+            passes++;
+        }
+
+        //Run dummy version of function and loop overhead
+        next_address = static_cast<uintptr_t*>(mem_array); 
+        while (p < passes) {
+            start_tick = start_timer();
+            (*kernel_dummy_fptr)(next_address, &next_address, 0);
+            stop_tick = stop_timer();
+            elapsed_dummy_ticks += (stop_tick - start_tick);
+            p++;
+        }
+
+        double dummy_ticks_per_pass = (passes > 0) ? static_cast<double>(elapsed_dummy_ticks) / passes : 0;
+        for (size_t s = 0; s < num_samples; s++) {
+            LatencySample sample;
+            sample.time_ms = static_cast<double>(s * sample_ticks) / g_ticks_per_ms;
+            sample.passes = sample_passes[s];
+            sample.mean_latency_ns = 0;
+            sample.max_latency_ns = 0;
+            if (sample.passes > 0) {
+                sample.mean_latency_ns = (static_cast<double>(sample_elapsed_ticks[s]) / sample.passes - dummy_ticks_per_pass) * g_ns_per_tick / LATENCY_BENCHMARK_UNROLL_LENGTH;
+                sample.max_latency_ns = (static_cast<double>(sample_max_ticks[s]) - dummy_ticks_per_pass) * g_ns_per_tick / LATENCY_BENCHMARK_UNROLL_LENGTH;
+            }
+            time_series.push_back(sample);
+        }
+    } else if (cold_cache) { //cold-cache mode
+        //Flush the whole region before every pass, outside of the timed section. The flushes dominate the run time, so the run is bounded by wall time rather than by timed ticks.
+        void* flush_end_address = reinterpret_cast<void*>(reinterpret_cast<uint8_t*>(mem_array) + len);
+        tick_t run_start_tick = start_timer();
+
+        //Run actual version of function and loop overhead
+        next_address = static_cast<uintptr_t*>(mem_array); 
+        do {
+            flush_region(mem_array, flush_end_address);
+            start_tick = start_timer();
+            (*kernel_fptr)(next_address, &next_address, 0);
+            stop_tick = stop_timer();
+            elapsed_ticks += (stop_tick - start_tick);
+            passes++;
+        } while (stop_tick - run_start_tick < target_ticks);
+
+        //Run dummy version of function and loop overhead
+        next_address = static_cast<uintptr_t*>(mem_array); 
+        while (p < passes) {
+            start_tick = start_timer();
+            (*kernel_dummy_fptr)(next_address, &next_address, 0);
+            stop_tick = stop_timer();
+            elapsed_dummy_ticks += (stop_tick - start_tick);
+            p++;
+        }
+    } else {
+        //Run actual version of function and loop overhead
+        next_address = static_cast<uintptr_t*>(mem_array); 
+        while (elapsed_ticks < target_ticks) {
+            start_tick = start_timer();
+            UNROLL256((*kernel_fptr)(next_address, &next_address, 0);)
+            stop_tick = stop_timer();
+            elapsed_ticks += (stop_tick - start_tick);
+            passes+=256;
+        }
 
-    //Run dummy version of function and loop overhead
-    next_address = static_cast<uintptr_t*>(mem_array); 
-    while (p < passes) {
-        start_tick = start_timer();
-        UNROLL256((*kernel_dummy_fptr)(next_address, &next_address, 0);)
-        stop_tick = stop_timer();
-        elapsed_dummy_ticks += (stop_tick - start_tick);
-        p+=256;
+        //Run dummy version of function and loop overhead
+        next_address = static_cast<uintptr_t*>(mem_array); 
+        while (p < passes) {
+            start_tick = start_timer();
+            UNROLL256((*kernel_dummy_fptr)(next_address, &next_address, 0);)
+            stop_tick = stop_timer();
+            elapsed_dummy_ticks += (stop_tick - start_tick);
+            p+=256;
+        }
     }
 
     adjusted_ticks = elapsed_ticks - elapsed_dummy_ticks;
@@ -170,6 +288,7 @@ void LatencyWorker::run() {
         bytes_per_pass_ = bytes_per_pass;
         completed_ = true;
         passes_ = passes;
+        time_series_ = time_series;
         releaseLock();
     }
 }
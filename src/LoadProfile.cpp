@@ -0,0 +1,151 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Microsoft
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Author: Mark Gottscho <mgottscho@ucla.edu>
+ */
+
+/**
+ * @file
+ * 
+ * @brief Implementation file for the LoadProfile class.
+ */
+
+//Headers
+#include <LoadProfile.h>
+#include <common.h>
+
+//Libraries
+#include <algorithm>
+#include <iostream>
+#include <sstream>
+
+using namespace xmem;
+
+LoadProfile::LoadProfile() :
+        times_ms_(),
+        bandwidths_(),
+        description_()
+    {
+}
+
+bool LoadProfile::loadFile(const std::string& filename) {
+    std::vector<double> times_ms;
+    std::vector<double> bandwidths;
+    if (!read_two_column_points(filename, "load profile", "TIME_MS,MBPS", times_ms, bandwidths))
+        return false;
+
+    std::ostringstream description;
+    description << "file " << filename;
+    return setPoints(times_ms, bandwidths, description.str());
+}
+
+bool LoadProfile::setBurst(double on_ms, double off_ms, double peak_bandwidth, double base_bandwidth) {
+    if (on_ms <= 0 || off_ms <= 0) {
+        std::cerr << "ERROR: Burst on and off times must be positive." << std::endl;
+        return false;
+    }
+
+    std::vector<double> times_ms;
+    std::vector<double> bandwidths;
+    times_ms.push_back(0);
+    bandwidths.push_back(peak_bandwidth);
+    times_ms.push_back(on_ms);
+    bandwidths.push_back(peak_bandwidth);
+    times_ms.push_back(on_ms);
+    bandwidths.push_back(base_bandwidth);
+    times_ms.push_back(on_ms + off_ms);
+    bandwidths.push_back(base_bandwidth);
+
+    std::ostringstream description;
+    description << "bursts of " << peak_bandwidth << " MB/s for " << on_ms << " ms, " << base_bandwidth << " MB/s for " << off_ms << " ms";
+    return setPoints(times_ms, bandwidths, description.str());
+}
+
+double LoadProfile::getBandwidthAt(double time_ms) const {
+    if (times_ms_.empty())
+        return 0;
+
+    double duration_ms = times_ms_.back();
+    if (duration_ms > 0 && time_ms >= duration_ms) 
+        time_ms -= duration_ms * static_cast<uint64_t>(time_ms / duration_ms);
+    if (time_ms < 0)
+        time_ms = 0;
+
+    //Find the segment [k, k+1) that contains the time. upper_bound skips over steps, so the bandwidth after a step applies from the time of the step on.
+    size_t k = std::upper_bound(times_ms_.begin(), times_ms_.end(), time_ms) - times_ms_.begin();
+    if (k >= times_ms_.size())
+        return bandwidths_.back();
+    if (k == 0)
+        return bandwidths_.front();
+    k--;
+
+    double span = times_ms_[k+1] - times_ms_[k];
+    if (span <= 0)
+        return bandwidths_[k+1];
+    return bandwidths_[k] + (bandwidths_[k+1] - bandwidths_[k]) * (time_ms - times_ms_[k]) / span;
+}
+
+double LoadProfile::getMinBandwidth() const {
+    if (bandwidths_.empty())
+        return 0;
+    return *std::min_element(bandwidths_.begin(), bandwidths_.end());
+}
+
+double LoadProfile::getMaxBandwidth() const {
+    if (bandwidths_.empty())
+        return 0;
+    return *std::max_element(bandwidths_.begin(), bandwidths_.end());
+}
+
+bool LoadProfile::setPoints(const std::vector<double>& times_ms, const std::vector<double>& bandwidths, std::string description) {
+    if (times_ms.empty()) {
+        std::cerr << "ERROR: A load profile needs at least one point." << std::endl;
+        return false;
+    }
+
+    for (size_t i = 0; i < times_ms.size(); i++) {
+        if (times_ms[i] < 0 || (i > 0 && times_ms[i] < times_ms[i-1])) {
+            std::cerr << "ERROR: Load profile times must be non-negative and in non-decreasing order." << std::endl;
+            return false;
+        }
+        if (bandwidths[i] < 0) {
+            std::cerr << "ERROR: Load profile bandwidths must be non-negative." << std::endl;
+            return false;
+        }
+    }
+
+    if (times_ms.back() <= 0) {
+        std::cerr << "ERROR: A load profile must span a positive length of time." << std::endl;
+        return false;
+    }
+
+    times_ms_.clear();
+    bandwidths_.clear();
+    if (times_ms.front() > 0) { //Hold the first bandwidth from time 0
+        times_ms_.push_back(0);
+        bandwidths_.push_back(bandwidths.front());
+    }
+    times_ms_.insert(times_ms_.end(), times_ms.begin(), times_ms.end());
+    bandwidths_.insert(bandwidths_.end(), bandwidths.begin(), bandwidths.end());
+    description_ = description;
+    return true;
+}
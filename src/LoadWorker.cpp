@@ -64,7 +64,15 @@ LoadWorker::LoadWorker(
         kernel_fptr_seq_(kernel_fptr),
         kernel_dummy_fptr_seq_(kernel_dummy_fptr),
         kernel_fptr_ran_(NULL),
-        kernel_dummy_fptr_ran_(NULL)
+        kernel_dummy_fptr_ran_(NULL),
+        target_bandwidth_(0),
+        controller_error_(0),
+        load_profile_(NULL),
+        load_profile_share_(0),
+        profile_start_tick_(0),
+        profile_duration_ticks_(0),
+        stop_flag_(NULL),
+        bytes_done_(0)
     {
 }
 
@@ -84,13 +92,65 @@ LoadWorker::LoadWorker(
         kernel_fptr_seq_(NULL),
         kernel_dummy_fptr_seq_(NULL),
         kernel_fptr_ran_(kernel_fptr),
-        kernel_dummy_fptr_ran_(kernel_dummy_fptr)
+        kernel_dummy_fptr_ran_(kernel_dummy_fptr),
+        target_bandwidth_(0),
+        controller_error_(0),
+        load_profile_(NULL),
+        load_profile_share_(0),
+        profile_start_tick_(0),
+        profile_duration_ticks_(0),
+        stop_flag_(NULL),
+        bytes_done_(0)
     {
 }
 
 LoadWorker::~LoadWorker() {
 }
 
+void LoadWorker::setTargetBandwidth(double target_bandwidth) {
+    if (acquireLock(-1)) {
+        target_bandwidth_ = target_bandwidth;
+        releaseLock();
+    }
+}
+
+double LoadWorker::getTargetBandwidth() {
+    double retval = 0;
+    if (acquireLock(-1)) {
+        retval = target_bandwidth_;
+        releaseLock();
+    }
+
+    return retval;
+}
+
+double LoadWorker::getControllerError() {
+    double retval = 0;
+    if (acquireLock(-1)) {
+        retval = controller_error_;
+        releaseLock();
+    }
+
+    return retval;
+}
+
+void LoadWorker::setLoadProfile(const LoadProfile* load_profile, double share, tick_t start_tick, tick_t duration_ticks) {
+    if (acquireLock(-1)) {
+        load_profile_ = load_profile;
+        load_profile_share_ = share;
+        profile_start_tick_ = start_tick;
+        profile_duration_ticks_ = duration_ticks;
+        releaseLock();
+    }
+}
+
+void LoadWorker::setStopFlag(const std::atomic<bool>* stop_flag) {
+    if (acquireLock(-1)) {
+        stop_flag_ = stop_flag;
+        releaseLock();
+    }
+}
+
 void LoadWorker::run() {
     //Set up relevant state -- localized to this thread's stack
     int32_t cpu_affinity = 0;
@@ -111,6 +171,12 @@ void LoadWorker::run() {
     tick_t elapsed_dummy_ticks = 0;
     tick_t adjusted_ticks = 0;
     bool warning = false;
+    double target_bandwidth = 0;
+    double controller_error = 0;
+    const LoadProfile* load_profile = NULL;
+    double load_profile_share = 0;
+    tick_t profile_start_tick = 0;
+    const std::atomic<bool>* stop_flag = NULL;
     void* mem_array = NULL;
     size_t len = 0;
     tick_t target_ticks = g_ticks_per_ms * BENCHMARK_DURATION_MS; //Rough target run duration in ticks
@@ -127,6 +193,13 @@ void LoadWorker::run() {
         kernel_dummy_fptr_seq = kernel_dummy_fptr_seq_;
         kernel_fptr_ran = kernel_fptr_ran_;
         kernel_dummy_fptr_ran = kernel_dummy_fptr_ran_;
+        target_bandwidth = target_bandwidth_;
+        load_profile = load_profile_;
+        load_profile_share = load_profile_share_;
+        profile_start_tick = profile_start_tick_;
+        if (load_profile != NULL)
+            target_ticks = profile_duration_ticks_;
+        stop_flag = stop_flag_;
         start_address = mem_array_;
         end_address = reinterpret_cast<void*>(reinterpret_cast<uint8_t*>(mem_array_)+bytes_per_pass);
         prime_start_address = mem_array_; 
@@ -157,49 +230,115 @@ void LoadWorker::run() {
 
     //Run the benchmark!
     uintptr_t* next_address = static_cast<uintptr_t*>(mem_array);
-    //Run actual version of function and loop overhead
-    while (elapsed_ticks < target_ticks) {
-        if (use_sequential_kernel_fptr) { //sequential function semantics
-            start_tick = start_timer();
-            UNROLL1024(
-                (*kernel_fptr_seq)(start_address, end_address);
-                start_address = reinterpret_cast<void*>(reinterpret_cast<uint8_t*>(mem_array)+(reinterpret_cast<uintptr_t>(start_address)+bytes_per_pass) % len);
-                end_address = reinterpret_cast<void*>(reinterpret_cast<uint8_t*>(start_address) + bytes_per_pass);
-            )
-            stop_tick = stop_timer();
-            passes+=1024;
-        } else { //random function semantics
+    if (target_bandwidth > 0 || load_profile != NULL) { //rate-controlled mode
+        //Each time slice, request enough kernel calls to meet the slice's byte target, corrected by the error of the previous slice and the accumulated error.
+        //Then idle until the slice ends. Time spent idling and on loop overhead is part of the schedule, so no dummy run is needed.
+        //With a load profile, the target of each slice is taken from the profile at the time the slice starts.
+        tick_t slice_ticks = static_cast<tick_t>(static_cast<double>(g_ticks_per_ms) * LOAD_RATE_CONTROL_SLICE_US / 1000);
+        if (slice_ticks < 1)
+            slice_ticks = 1;
+        double target_bytes_per_tick = (target_bandwidth * MB) / (static_cast<double>(g_ticks_per_ms) * 1000);
+        double error = 0;
+        double integral = 0;
+        double total_relative_error = 0;
+        uint32_t slices = 0;
+
+        if (load_profile != NULL) { //Wait for the common start of the profile
+            do {
+                start_tick = start_timer();
+            } while (start_tick < profile_start_tick);
+        } else
             start_tick = start_timer();
-            UNROLL1024((*kernel_fptr_ran)(next_address, &next_address, bytes_per_pass);)
-            stop_tick = stop_timer();
-            passes+=1024;
+
+        while (stop_flag != NULL ? !stop_flag->load(std::memory_order_relaxed) : elapsed_ticks < target_ticks) {
+            if (load_profile != NULL) {
+                double time_ms = static_cast<double>(start_tick - profile_start_tick) / g_ticks_per_ms;
+                target_bytes_per_tick = (load_profile->getBandwidthAt(time_ms) * load_profile_share * MB) / (static_cast<double>(g_ticks_per_ms) * 1000);
+            }
+            double slice_target_bytes = target_bytes_per_tick * static_cast<double>(slice_ticks);
+
+            double requested_bytes = slice_target_bytes + LOAD_RATE_CONTROL_KP * error + LOAD_RATE_CONTROL_KI * integral;
+            uint32_t calls = (requested_bytes > 0) ? static_cast<uint32_t>(requested_bytes / bytes_per_pass + 0.5) : 0;
+            for (uint32_t c = 0; c < calls; c++) {
+                if (use_sequential_kernel_fptr) { //sequential function semantics
+                    (*kernel_fptr_seq)(start_address, end_address);
+                    start_address = reinterpret_cast<void*>(reinterpret_cast<uint8_t*>(mem_array)+(reinterpret_cast<uintptr_t>(start_address)+bytes_per_pass) % len);
+                    end_address = reinterpret_cast<void*>(reinterpret_cast<uint8_t*>(start_address) + bytes_per_pass);
+                } else //random function semantics
+                    (*kernel_fptr_ran)(next_address, &next_address, bytes_per_pass);
+            }
+
+            do { //idle until the end of the slice
+                stop_tick = stop_timer();
+            } while (stop_tick - start_tick < slice_ticks);
+
+            //Slices may overrun when the target is above what the worker can sustain, so the target is based on the actual slice length
+            double due_bytes = target_bytes_per_tick * static_cast<double>(stop_tick - start_tick);
+            error = due_bytes - static_cast<double>(calls) * bytes_per_pass;
+            integral += error;
+            if (integral > LOAD_RATE_CONTROL_WINDUP_SLICES * slice_target_bytes) //Anti-windup: do not let an unreachable target build up an unbounded backlog
+                integral = LOAD_RATE_CONTROL_WINDUP_SLICES * slice_target_bytes;
+            else if (integral < -LOAD_RATE_CONTROL_WINDUP_SLICES * slice_target_bytes)
+                integral = -LOAD_RATE_CONTROL_WINDUP_SLICES * slice_target_bytes;
+            if (due_bytes > 0) { //Idle phases of a load profile have nothing to track
+                total_relative_error += (error < 0 ? -error : error) / due_bytes;
+                slices++;
+            }
+
+            passes += calls;
+            bytes_done_.fetch_add(static_cast<uint64_t>(calls) * bytes_per_pass, std::memory_order_relaxed);
+            elapsed_ticks += (stop_tick - start_tick);
+            start_tick = stop_tick;
         }
-        elapsed_ticks += (stop_tick - start_tick);
-    }
 
-    //Run dummy version of function and loop overhead
-    p = 0;
-    start_address = mem_array;
-    end_address = reinterpret_cast<void*>(reinterpret_cast<uint8_t*>(mem_array) + bytes_per_pass);
-    next_address = static_cast<uintptr_t*>(mem_array);
-    while (p < passes) {
-        if (use_sequential_kernel_fptr) { //sequential function semantics
-            start_tick = start_timer();
-            UNROLL1024(
-                (*kernel_dummy_fptr_seq)(start_address, end_address);
-                start_address = reinterpret_cast<void*>(reinterpret_cast<uint8_t*>(mem_array)+(reinterpret_cast<uintptr_t>(start_address)+bytes_per_pass) % len);
-                end_address = reinterpret_cast<void*>(reinterpret_cast<uint8_t*>(start_address) + bytes_per_pass);
-            )
-            stop_tick = stop_timer();
-            p+=1024;
-        } else { //random function semantics
-            start_tick = start_timer();
-            UNROLL1024((*kernel_dummy_fptr_ran)(next_address, &next_address, bytes_per_pass);)
-            stop_tick = stop_timer();
-            p+=1024;
+        if (slices > 0)
+            controller_error = 100 * total_relative_error / slices;
+    } else {
+        //Run actual version of function and loop overhead
+        while (stop_flag != NULL ? !stop_flag->load(std::memory_order_relaxed) : elapsed_ticks < target_ticks) {
+            if (use_sequential_kernel_fptr) { //sequential function semantics
+                start_tick = start_timer();
+                UNROLL1024(
+                    (*kernel_fptr_seq)(start_address, end_address);
+                    start_address = reinterpret_cast<void*>(reinterpret_cast<uint8_t*>(mem_array)+(reinterpret_cast<uintptr_t>(start_address)+bytes_per_pass) % len);
+                    end_address = reinterpret_cast<void*>(reinterpret_cast<uint8_t*>(start_address) + bytes_per_pass);
+                )
+                stop_tick = stop_timer();
+                passes+=1024;
+            } else { //random function semantics
+                start_tick = start_timer();
+                UNROLL1024((*kernel_fptr_ran)(next_address, &next_address, bytes_per_pass);)
+                stop_tick = stop_timer();
+                passes+=1024;
+            }
+            bytes_done_.fetch_add(static_cast<uint64_t>(1024) * bytes_per_pass, std::memory_order_relaxed);
+            elapsed_ticks += (stop_tick - start_tick);
         }
 
-        elapsed_dummy_ticks += (stop_tick - start_tick);
+        //Run dummy version of function and loop overhead, unless the worker ran open-ended
+        p = 0;
+        start_address = mem_array;
+        end_address = reinterpret_cast<void*>(reinterpret_cast<uint8_t*>(mem_array) + bytes_per_pass);
+        next_address = static_cast<uintptr_t*>(mem_array);
+        while (stop_flag == NULL && p < passes) {
+            if (use_sequential_kernel_fptr) { //sequential function semantics
+                start_tick = start_timer();
+                UNROLL1024(
+                    (*kernel_dummy_fptr_seq)(start_address, end_address);
+                    start_address = reinterpret_cast<void*>(reinterpret_cast<uint8_t*>(mem_array)+(reinterpret_cast<uintptr_t>(start_address)+bytes_per_pass) % len);
+                    end_address = reinterpret_cast<void*>(reinterpret_cast<uint8_t*>(start_address) + bytes_per_pass);
+                )
+                stop_tick = stop_timer();
+                p+=1024;
+            } else { //random function semantics
+                start_tick = start_timer();
+                UNROLL1024((*kernel_dummy_fptr_ran)(next_address, &next_address, bytes_per_pass);)
+                stop_tick = stop_timer();
+                p+=1024;
+            }
+
+            elapsed_dummy_ticks += (stop_tick - start_tick);
+        }
     }
 
     //Unset processor affinity
@@ -230,6 +369,7 @@ void LoadWorker::run() {
         bytes_per_pass_ = bytes_per_pass;
         completed_ = true;
         passes_ = passes;
+        controller_error_ = controller_error;
         releaseLock();
     }
 }
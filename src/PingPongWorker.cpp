@@ -0,0 +1,158 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Microsoft
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Author: Mark Gottscho <mgottscho@ucla.edu>
+ */
+
+/**
+ * @file
+ * 
+ * @brief Implementation file for the PingPongWorker class.
+ */
+
+//Headers
+#include <PingPongWorker.h>
+#include <common.h>
+
+//Libraries
+#include <iostream>
+#include <atomic>
+
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+using namespace xmem;
+
+PingPongWorker::PingPongWorker(
+        void* mem_array,
+        size_t len,
+        bool initiator,
+        uint32_t round_trips,
+        int32_t cpu_affinity
+    ) :
+        MemoryWorker(
+            mem_array,
+            len,
+            cpu_affinity
+        ),
+        initiator_(initiator)
+    {
+    passes_ = round_trips;
+}
+
+PingPongWorker::~PingPongWorker() {
+}
+
+double PingPongWorker::getMeanTransferLatency() {
+    double retval = 0;
+    if (acquireLock(-1)) {
+        if (initiator_ && completed_ && passes_ > 0)
+            retval = (elapsed_ticks_ * g_ns_per_tick) / (2.0 * passes_);
+        releaseLock();
+    }
+
+    return retval;
+}
+
+void PingPongWorker::run() {
+    //Set up relevant state -- localized to this thread's stack
+    int32_t cpu_affinity = 0;
+    std::atomic<uint64_t>* line = NULL;
+    bool initiator = false;
+    uint32_t round_trips = 0;
+    tick_t start_tick = 0;
+    tick_t stop_tick = 0;
+    tick_t elapsed_ticks = 0;
+    bool warning = false;
+
+    //Grab relevant setup state thread-safely and keep it local
+    if (acquireLock(-1)) {
+        line = static_cast<std::atomic<uint64_t>*>(mem_array_);
+        initiator = initiator_;
+        round_trips = passes_;
+        cpu_affinity = cpu_affinity_;
+        releaseLock();
+    }
+    
+    //Set processor affinity
+    bool locked = lock_thread_to_cpu(cpu_affinity);
+    if (!locked)
+        std::cerr << "WARNING: Failed to lock thread to logical CPU " << cpu_affinity << "! Results may not be correct." << std::endl;
+
+    //Increase scheduling priority
+#ifdef _WIN32
+    DWORD original_priority_class;
+    DWORD original_priority;
+    if (!boost_scheduling_priority(original_priority_class, original_priority))
+#endif
+#ifdef __gnu_linux__
+    if (!boost_scheduling_priority())
+#endif
+        std::cerr << "WARNING: Failed to boost scheduling priority. Perhaps running in Administrator mode would help." << std::endl;
+
+    //Bounce the line. The first round trips are not timed so that both threads are known to be running and spinning when timing starts.
+    uint64_t total_round_trips = static_cast<uint64_t>(round_trips) + C2C_LATENCY_WARMUP_ROUND_TRIPS;
+    if (initiator) {
+        for (uint64_t i = 0; i < total_round_trips; i++) {
+            if (i == C2C_LATENCY_WARMUP_ROUND_TRIPS)
+                start_tick = start_timer();
+            line->store(2*i+1, std::memory_order_release);
+            while (line->load(std::memory_order_acquire) != 2*i+2)
+                ;
+        }
+        stop_tick = stop_timer();
+        elapsed_ticks = stop_tick - start_tick;
+    } else {
+        for (uint64_t i = 0; i < total_round_trips; i++) {
+            while (line->load(std::memory_order_acquire) != 2*i+1)
+                ;
+            line->store(2*i+2, std::memory_order_release);
+        }
+    }
+
+    //Warn if something looks fishy
+    if (initiator && elapsed_ticks < MIN_ELAPSED_TICKS)
+        warning = true;
+
+    //Unset processor affinity
+    if (locked)
+        unlock_thread_to_cpu();
+
+    //Revert thread priority
+#ifdef _WIN32
+    if (!revert_scheduling_priority(original_priority_class, original_priority))
+#endif
+#ifdef __gnu_linux__
+    if (!revert_scheduling_priority())
+#endif
+        std::cerr << "WARNING: Failed to revert scheduling priority. Perhaps running in Administrator mode would help." << std::endl;
+
+    //Update the object state thread-safely
+    if (acquireLock(-1)) {
+        elapsed_ticks_ = elapsed_ticks;
+        adjusted_ticks_ = elapsed_ticks;
+        warning_ = warning;
+        completed_ = true;
+        releaseLock();
+    }
+}
@@ -0,0 +1,188 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Microsoft
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Author: Mark Gottscho <mgottscho@ucla.edu>
+ */
+
+/**
+ * @file
+ * 
+ * @brief Implementation file for the ProducerConsumerWorker class.
+ */
+
+//Headers
+#include <ProducerConsumerWorker.h>
+#include <common.h>
+
+//Libraries
+#include <iostream>
+
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+using namespace xmem;
+
+ProducerConsumerWorker::ProducerConsumerWorker(
+        void* mem_array,
+        size_t len,
+        RingBufferControl* control,
+        bool producer,
+        size_t block_size,
+        uint64_t blocks,
+        bool lock_step,
+        int32_t cpu_affinity
+    ) :
+        MemoryWorker(
+            mem_array,
+            len,
+            cpu_affinity
+        ),
+        control_(control),
+        producer_(producer),
+        block_size_(block_size),
+        blocks_(blocks),
+        lock_step_(lock_step)
+    {
+}
+
+ProducerConsumerWorker::~ProducerConsumerWorker() {
+}
+
+uint64_t ProducerConsumerWorker::getBlocks() {
+    uint64_t retval = 0;
+    if (acquireLock(-1)) {
+        retval = blocks_;
+        releaseLock();
+    }
+
+    return retval;
+}
+
+void ProducerConsumerWorker::run() {
+    //Set up relevant state -- localized to this thread's stack
+    int32_t cpu_affinity = 0;
+    uint8_t* ring = NULL;
+    size_t len = 0;
+    RingBufferControl* control = NULL;
+    bool producer = false;
+    size_t block_size = 0;
+    uint64_t blocks = 0;
+    bool lock_step = false;
+    tick_t start_tick = 0;
+    tick_t stop_tick = 0;
+    tick_t elapsed_ticks = 0;
+    bool warning = false;
+
+    //Grab relevant setup state thread-safely and keep it local
+    if (acquireLock(-1)) {
+        ring = static_cast<uint8_t*>(mem_array_);
+        len = len_;
+        control = control_;
+        producer = producer_;
+        block_size = block_size_;
+        blocks = blocks_;
+        lock_step = lock_step_;
+        cpu_affinity = cpu_affinity_;
+        releaseLock();
+    }
+    
+    //Set processor affinity
+    bool locked = lock_thread_to_cpu(cpu_affinity);
+    if (!locked)
+        std::cerr << "WARNING: Failed to lock thread to logical CPU " << cpu_affinity << "! Results may not be correct." << std::endl;
+
+    //Increase scheduling priority
+#ifdef _WIN32
+    DWORD original_priority_class;
+    DWORD original_priority;
+    if (!boost_scheduling_priority(original_priority_class, original_priority))
+#endif
+#ifdef __gnu_linux__
+    if (!boost_scheduling_priority())
+#endif
+        std::cerr << "WARNING: Failed to boost scheduling priority. Perhaps running in Administrator mode would help." << std::endl;
+
+    //Wait for the partner so that both threads start together
+    control->arrived.fetch_add(1);
+    while (control->arrived.load() < 2)
+        ;
+
+    uint64_t slots = len / block_size;
+    uint64_t max_in_flight = lock_step ? 1 : slots;
+    size_t words_per_block = block_size / sizeof(uintptr_t);
+    uintptr_t checksum = 0;
+    start_tick = start_timer();
+    if (producer) {
+        for (uint64_t b = 0; b < blocks; b++) {
+            while (b - control->consumed.load(std::memory_order_acquire) >= max_in_flight) //Wait for a free slot
+                ;
+            volatile uintptr_t* block = reinterpret_cast<volatile uintptr_t*>(ring + (b % slots) * block_size);
+            for (size_t w = 0; w < words_per_block; w++)
+                block[w] = static_cast<uintptr_t>(b);
+            control->produced.store(b+1, std::memory_order_release);
+        }
+        while (control->consumed.load(std::memory_order_acquire) < blocks) //The last block counts once it has been read
+            ;
+    } else {
+        for (uint64_t b = 0; b < blocks; b++) {
+            while (control->produced.load(std::memory_order_acquire) <= b) //Wait for the next block
+                ;
+            volatile uintptr_t* block = reinterpret_cast<volatile uintptr_t*>(ring + (b % slots) * block_size);
+            for (size_t w = 0; w < words_per_block; w++)
+                checksum += block[w];
+            control->consumed.store(b+1, std::memory_order_release);
+        }
+    }
+    stop_tick = stop_timer();
+    elapsed_ticks = stop_tick - start_tick;
+
+    //Warn if something looks fishy
+    if (elapsed_ticks < MIN_ELAPSED_TICKS)
+        warning = true;
+    if (!producer && checksum != static_cast<uintptr_t>(words_per_block * (blocks * (blocks-1) / 2))) //Every word of block b holds b, so the consumer must have seen every block intact
+        warning = true;
+
+    //Unset processor affinity
+    if (locked)
+        unlock_thread_to_cpu();
+
+    //Revert thread priority
+#ifdef _WIN32
+    if (!revert_scheduling_priority(original_priority_class, original_priority))
+#endif
+#ifdef __gnu_linux__
+    if (!revert_scheduling_priority())
+#endif
+        std::cerr << "WARNING: Failed to revert scheduling priority. Perhaps running in Administrator mode would help." << std::endl;
+
+    //Update the object state thread-safely
+    if (acquireLock(-1)) {
+        elapsed_ticks_ = elapsed_ticks;
+        adjusted_ticks_ = elapsed_ticks;
+        bytes_per_pass_ = static_cast<uint32_t>(block_size);
+        passes_ = static_cast<uint32_t>(blocks);
+        warning_ = warning;
+        completed_ = true;
+        releaseLock();
+    }
+}
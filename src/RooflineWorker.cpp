@@ -0,0 +1,213 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Microsoft
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Author: Mark Gottscho <mgottscho@ucla.edu>
+ */
+/**
+ * @file
+ * 
+ * @brief Implementation file for the RooflineWorker class.
+ */
+
+//Headers
+#include <RooflineWorker.h>
+#include <benchmark_kernels.h>
+#include <common.h>
+
+//Libraries
+#include <iostream>
+#include <algorithm>
+
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+using namespace xmem;
+
+RooflineWorker::RooflineWorker(
+        void* mem_array,
+        size_t len,
+        roofline_engine_t engine,
+        uint32_t ops_per_element,
+        int32_t cpu_affinity
+    ) :
+        MemoryWorker(
+            mem_array,
+            len,
+            cpu_affinity
+        ),
+        engine_(engine),
+        ops_per_element_(ops_per_element),
+        bytes_(0),
+        ops_(0)
+    {
+}
+
+RooflineWorker::~RooflineWorker() {
+}
+
+double RooflineWorker::getThroughput() {
+    double retval = 0;
+    if (acquireLock(-1)) {
+        if (completed_ && adjusted_ticks_ > 0)
+            retval = (static_cast<double>(bytes_) / MB) / (adjusted_ticks_ * g_ns_per_tick / 1e9);
+        releaseLock();
+    }
+
+    return retval;
+}
+
+double RooflineWorker::getOpsPerSecond() {
+    double retval = 0;
+    if (acquireLock(-1)) {
+        if (completed_ && adjusted_ticks_ > 0)
+            retval = static_cast<double>(ops_) / (adjusted_ticks_ * g_ns_per_tick); //ops per ns is billions of ops per second
+        releaseLock();
+    }
+
+    return retval;
+}
+
+void RooflineWorker::run() {
+    //Set up relevant state -- localized to this thread's stack
+    int32_t cpu_affinity = 0;
+    uint8_t* mem_array = NULL;
+    size_t len = 0;
+    roofline_engine_t engine = ROOFLINE_SCALAR_FMA;
+    uint32_t ops_per_element = 0;
+    RooflineFunction kernel_fptr = NULL;
+    RooflineFunction kernel_dummy_fptr = NULL;
+    uint32_t madds_per_element = 0;
+    tick_t start_tick = 0;
+    tick_t stop_tick = 0;
+    tick_t elapsed_ticks = 0;
+    tick_t elapsed_dummy_ticks = 0;
+    tick_t adjusted_ticks = 0;
+    tick_t target_ticks = g_ticks_per_ms * ROOFLINE_BENCHMARK_DURATION_MS; //Rough target run duration in ticks
+    uint64_t calls_per_timing = 0;
+    uint64_t calls = 0;
+    uint64_t c = 0;
+    bool warning = false;
+
+    //Grab relevant setup state thread-safely and keep it local
+    if (acquireLock(-1)) {
+        mem_array = static_cast<uint8_t*>(mem_array_);
+        len = len_;
+        engine = engine_;
+        ops_per_element = ops_per_element_;
+        cpu_affinity = cpu_affinity_;
+        releaseLock();
+    }
+
+    if (len == 0 || len % ROOFLINE_BYTES_PER_ITERATION != 0) {
+        std::cerr << "ERROR: The memory region of the roofline worker must be a non-zero multiple of " << ROOFLINE_BYTES_PER_ITERATION << " B." << std::endl;
+        return;
+    }
+    if (ops_per_element == 0 || ops_per_element % 2 != 0) {
+        std::cerr << "ERROR: The roofline worker needs a positive even number of operations per element." << std::endl;
+        return;
+    }
+
+    if (!determine_roofline_kernel(engine, &kernel_fptr, &kernel_dummy_fptr)) {
+        std::cerr << "ERROR: Failed to find a roofline kernel." << std::endl;
+        return;
+    }
+    madds_per_element = ops_per_element / 2;
+    calls_per_timing = ROOFLINE_BYTES_PER_TIMING / len;
+    if (calls_per_timing == 0)
+        calls_per_timing = 1;
+
+    //Fill memory with data that keeps floating-point accumulators in the normal range
+    std::fill(reinterpret_cast<double*>(mem_array), reinterpret_cast<double*>(mem_array + len), 1.0);
+    
+    //Set processor affinity
+    bool locked = lock_thread_to_cpu(cpu_affinity);
+    if (!locked)
+        std::cerr << "WARNING: Failed to lock thread to logical CPU " << cpu_affinity << "! Results may not be correct." << std::endl;
+
+    //Increase scheduling priority
+#ifdef _WIN32
+    DWORD original_priority_class;
+    DWORD original_priority;
+    if (!boost_scheduling_priority(original_priority_class, original_priority))
+#endif
+#ifdef __gnu_linux__
+    if (!boost_scheduling_priority())
+#endif
+        std::cerr << "WARNING: Failed to boost scheduling priority. Perhaps running in Administrator mode would help." << std::endl;
+
+    //Prime memory
+    (*kernel_fptr)(mem_array, mem_array + len, madds_per_element);
+
+    //Run actual version of function and loop overhead
+    while (elapsed_ticks < target_ticks) {
+        start_tick = start_timer();
+        for (uint64_t i = 0; i < calls_per_timing; i++) {
+            (*kernel_fptr)(mem_array, mem_array + len, madds_per_element);
+        }
+        stop_tick = stop_timer();
+        elapsed_ticks += (stop_tick - start_tick);
+        calls += calls_per_timing;
+    }
+
+    //Run dummy version of function and loop overhead
+    while (c < calls) {
+        start_tick = start_timer();
+        for (uint64_t i = 0; i < calls_per_timing; i++) {
+            (*kernel_dummy_fptr)(mem_array, mem_array + len, madds_per_element);
+        }
+        stop_tick = stop_timer();
+        elapsed_dummy_ticks += (stop_tick - start_tick);
+        c += calls_per_timing;
+    }
+
+    adjusted_ticks = elapsed_ticks - elapsed_dummy_ticks;
+
+    //Warn if something looks fishy
+    if (elapsed_dummy_ticks >= elapsed_ticks || elapsed_ticks < MIN_ELAPSED_TICKS || adjusted_ticks < 0.5 * elapsed_ticks)
+        warning = true;
+
+    //Unset processor affinity
+    if (locked)
+        unlock_thread_to_cpu();
+
+    //Revert thread priority
+#ifdef _WIN32
+    if (!revert_scheduling_priority(original_priority_class, original_priority))
+#endif
+#ifdef __gnu_linux__
+    if (!revert_scheduling_priority())
+#endif
+        std::cerr << "WARNING: Failed to revert scheduling priority. Perhaps running in Administrator mode would help." << std::endl;
+
+    //Update the object state thread-safely
+    if (acquireLock(-1)) {
+        elapsed_ticks_ = elapsed_ticks;
+        elapsed_dummy_ticks_ = elapsed_dummy_ticks;
+        adjusted_ticks_ = adjusted_ticks;
+        bytes_ = calls * len;
+        ops_ = calls * (len / sizeof(uint64_t)) * ops_per_element;
+        warning_ = warning;
+        completed_ = true;
+        releaseLock();
+    }
+}
@@ -0,0 +1,244 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Microsoft
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Author: Mark Gottscho <mgottscho@ucla.edu>
+ */
+/**
+ * @file
+ * 
+ * @brief Implementation file for the UnalignedWorker class.
+ */
+
+//Headers
+#include <UnalignedWorker.h>
+#include <benchmark_kernels.h>
+#include <common.h>
+
+//Libraries
+#include <cstring>
+#include <iostream>
+
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+using namespace xmem;
+
+UnalignedWorker::UnalignedWorker(
+        void* mem_array,
+        size_t len,
+        rw_mode_t rw_mode,
+        chunk_size_t chunk_size,
+        size_t offset,
+        bool chase,
+        int32_t cpu_affinity
+    ) :
+        MemoryWorker(
+            mem_array,
+            len,
+            cpu_affinity
+        ),
+        rw_mode_(rw_mode),
+        chunk_size_(chunk_size),
+        offset_(offset),
+        chase_(chase),
+        bytes_(0),
+        hops_(0)
+    {
+}
+
+UnalignedWorker::~UnalignedWorker() {
+}
+
+double UnalignedWorker::getThroughput() {
+    double retval = 0;
+    if (acquireLock(-1)) {
+        if (completed_ && adjusted_ticks_ > 0)
+            retval = (static_cast<double>(bytes_) / MB) / (adjusted_ticks_ * g_ns_per_tick / 1e9);
+        releaseLock();
+    }
+
+    return retval;
+}
+
+double UnalignedWorker::getMeanAccessLatency() {
+    double retval = 0;
+    if (acquireLock(-1)) {
+        if (completed_ && hops_ > 0)
+            retval = (adjusted_ticks_ * g_ns_per_tick) / hops_;
+        releaseLock();
+    }
+
+    return retval;
+}
+
+void UnalignedWorker::run() {
+    //Set up relevant state -- localized to this thread's stack
+    int32_t cpu_affinity = 0;
+    uint8_t* mem_array = NULL;
+    size_t len = 0;
+    rw_mode_t rw_mode = READ;
+    chunk_size_t chunk_size = CHUNK_32b;
+    size_t offset = 0;
+    bool chase = false;
+    SequentialFunction kernel_fptr_seq = NULL;
+    SequentialFunction kernel_dummy_fptr_seq = NULL;
+    RandomFunction kernel_fptr_ran = NULL;
+    RandomFunction kernel_dummy_fptr_ran = NULL;
+    void* start_address = NULL;
+    void* end_address = NULL;
+    uintptr_t* next_address = NULL;
+    tick_t start_tick = 0;
+    tick_t stop_tick = 0;
+    tick_t elapsed_ticks = 0;
+    tick_t elapsed_dummy_ticks = 0;
+    tick_t adjusted_ticks = 0;
+    tick_t target_ticks = g_ticks_per_ms * UNALIGNED_BENCHMARK_DURATION_MS; //Rough target run duration in ticks
+    uint64_t calls_per_timing = 0;
+    uint64_t calls = 0;
+    uint64_t c = 0;
+    bool warning = false;
+
+    //Grab relevant setup state thread-safely and keep it local
+    if (acquireLock(-1)) {
+        mem_array = static_cast<uint8_t*>(mem_array_);
+        len = len_;
+        rw_mode = rw_mode_;
+        chunk_size = chunk_size_;
+        offset = offset_;
+        chase = chase_;
+        cpu_affinity = cpu_affinity_;
+        releaseLock();
+    }
+
+    if (len < 8192 || len % 4096 != 0 || offset >= CACHE_LINE_SIZE) {
+        std::cerr << "ERROR: The unaligned access worker needs a memory region of at least 8 KB in whole 4 KB blocks, and an offset of less than one cache line." << std::endl;
+        return;
+    }
+
+    if (chase) {
+        if (!determine_unaligned_random_kernel(chunk_size, &kernel_fptr_ran, &kernel_dummy_fptr_ran)) {
+            std::cerr << "ERROR: Failed to find an unaligned pointer chasing kernel." << std::endl;
+            return;
+        }
+        calls_per_timing = 1; //Each call makes LATENCY_BENCHMARK_UNROLL_LENGTH dependent hops, which is long enough to time on its own
+    } else {
+        if (!determine_unaligned_kernel(rw_mode, chunk_size, &kernel_fptr_seq, &kernel_dummy_fptr_seq)) {
+            std::cerr << "ERROR: Failed to find an unaligned sequential kernel." << std::endl;
+            return;
+        }
+
+        //The kernels walk whole 4 KB blocks, so one block is given up to make room for the offset
+        start_address = mem_array + offset;
+        end_address = mem_array + offset + len - 4096;
+        calls_per_timing = UNALIGNED_BYTES_PER_TIMING / (len - 4096);
+        if (calls_per_timing == 0)
+            calls_per_timing = 1;
+    }
+    
+    //Set processor affinity
+    bool locked = lock_thread_to_cpu(cpu_affinity);
+    if (!locked)
+        std::cerr << "WARNING: Failed to lock thread to logical CPU " << cpu_affinity << "! Results may not be correct." << std::endl;
+
+    //Increase scheduling priority
+#ifdef _WIN32
+    DWORD original_priority_class;
+    DWORD original_priority;
+    if (!boost_scheduling_priority(original_priority_class, original_priority))
+#endif
+#ifdef __gnu_linux__
+    if (!boost_scheduling_priority())
+#endif
+        std::cerr << "WARNING: Failed to boost scheduling priority. Perhaps running in Administrator mode would help." << std::endl;
+
+    //Prime memory
+    if (chase) {
+        std::memset(mem_array, 0, len);
+        if (!build_unaligned_pointer_chain(mem_array, mem_array + len, offset, &next_address))
+            warning = true;
+        for (size_t i = 0; i < len / CACHE_LINE_SIZE / LATENCY_BENCHMARK_UNROLL_LENGTH + 1 && !warning; i++)
+            (*kernel_fptr_ran)(next_address, &next_address, 0);
+    } else {
+        std::memset(mem_array, 0, len);
+        (*kernel_fptr_seq)(start_address, end_address);
+    }
+
+    //Run actual version of function and loop overhead
+    while (elapsed_ticks < target_ticks && !warning) {
+        start_tick = start_timer();
+        for (uint64_t i = 0; i < calls_per_timing; i++) {
+            if (chase)
+                (*kernel_fptr_ran)(next_address, &next_address, 0);
+            else
+                (*kernel_fptr_seq)(start_address, end_address);
+        }
+        stop_tick = stop_timer();
+        elapsed_ticks += (stop_tick - start_tick);
+        calls += calls_per_timing;
+    }
+
+    //Run dummy version of function and loop overhead
+    while (c < calls) {
+        start_tick = start_timer();
+        for (uint64_t i = 0; i < calls_per_timing; i++) {
+            if (chase)
+                (*kernel_dummy_fptr_ran)(next_address, &next_address, 0);
+            else
+                (*kernel_dummy_fptr_seq)(start_address, end_address);
+        }
+        stop_tick = stop_timer();
+        elapsed_dummy_ticks += (stop_tick - start_tick);
+        c += calls_per_timing;
+    }
+
+    adjusted_ticks = elapsed_ticks - elapsed_dummy_ticks;
+
+    //Warn if something looks fishy
+    if (elapsed_dummy_ticks >= elapsed_ticks || elapsed_ticks < MIN_ELAPSED_TICKS || adjusted_ticks < 0.5 * elapsed_ticks)
+        warning = true;
+
+    //Unset processor affinity
+    if (locked)
+        unlock_thread_to_cpu();
+
+    //Revert thread priority
+#ifdef _WIN32
+    if (!revert_scheduling_priority(original_priority_class, original_priority))
+#endif
+#ifdef __gnu_linux__
+    if (!revert_scheduling_priority())
+#endif
+        std::cerr << "WARNING: Failed to revert scheduling priority. Perhaps running in Administrator mode would help." << std::endl;
+
+    //Update the object state thread-safely
+    if (acquireLock(-1)) {
+        elapsed_ticks_ = elapsed_ticks;
+        elapsed_dummy_ticks_ = elapsed_dummy_ticks;
+        adjusted_ticks_ = adjusted_ticks;
+        bytes_ = chase ? 0 : calls * (len - 4096);
+        hops_ = chase ? calls * LATENCY_BENCHMARK_UNROLL_LENGTH : 0;
+        warning_ = warning;
+        completed_ = true;
+        releaseLock();
+    }
+}
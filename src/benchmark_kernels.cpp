@@ -46,6 +46,10 @@
 #include <random>
 #include <algorithm>
 #include <time.h>
+#include <atomic>
+#include <cstring>
+#include <vector>
+#include <cmath>
 #if defined(ARCH_INTEL) && (defined(HAS_WORD_128) || defined(HAS_WORD_256) || defined(HAS_WORD_512)) 
 //Intel intrinsics
 #include <emmintrin.h>
@@ -57,6 +61,10 @@
 #include <arm_neon.h>
 #endif
 
+#if defined(_WIN32) && defined(ARCH_INTEL)
+#include <intrin.h> //for cache line flush and string instruction intrinsics
+#endif
+
 using namespace xmem;
 
 #if defined(__gnu_linux__) && defined(ARCH_INTEL)
@@ -143,6 +151,21 @@ ret = scratchptr[0];
 #define my_512b_load(p) _mm512_load_epi64(p) //This is needed because I get the compiler error 'error: class "__m512i" has no suitable assignment operator' using icc for Knight's Corner Xeon Phi. Also, I cannot use do a load on a volatile piece of memory. So the 512-bit code may not work...
 #endif
 
+#if defined(_WIN32) && defined(ARCH_INTEL)
+#define my_clflush(a) _mm_clflush(reinterpret_cast<void*>(a)) //SSE2 intrinsic, corresponds to "clflush" instruction. Header: intrin.h
+#define my_clflushopt(a) _mm_clflushopt(reinterpret_cast<void*>(a)) //CLFLUSHOPT intrinsic, corresponds to "clflushopt" instruction. Header: intrin.h
+#define my_clwb(a) _mm_clwb(reinterpret_cast<void*>(a)) //CLWB intrinsic, corresponds to "clwb" instruction. Header: intrin.h
+#define my_mfence() _mm_mfence() //SSE2 intrinsic, corresponds to "mfence" instruction. Header: intrin.h
+#endif
+
+#if defined(__gnu_linux__) && defined(ARCH_INTEL)
+//Inline assembly, so that no extra compiler flags are needed. clflushopt and clwb are spelled as their encodings (66-prefixed clflush and xsaveopt) so that older assemblers accept them.
+#define my_clflush(a) asm volatile("clflush %0" : "+m" (*reinterpret_cast<volatile char*>(a)))
+#define my_clflushopt(a) asm volatile(".byte 0x66; clflush %0" : "+m" (*reinterpret_cast<volatile char*>(a)))
+#define my_clwb(a) asm volatile(".byte 0x66; xsaveopt %0" : "+m" (*reinterpret_cast<volatile char*>(a)))
+#define my_mfence() asm volatile("mfence" ::: "memory")
+#endif
+
 
 #if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
 /* Hand-coded assembly functions for the 128-bit and 256-bit benchmark kernels on Windows x86-64 where applicable.
@@ -229,8 +252,15 @@ extern "C" int32_t win_x86_64_asm_dummy_revStride8Loop_Word256(Word256_t* first_
 extern "C" int32_t win_x86_64_asm_dummy_forwStride16Loop_Word256(Word256_t* first_word, Word256_t* last_word);
 extern "C" int32_t win_x86_64_asm_dummy_revStride16Loop_Word256(Word256_t* first_word, Word256_t* last_word);
 #endif
-#endif
 
+//Read-modify-write of one wide word, for the kernels that are written with intrinsics rather than assembly. AVX has no 256-bit integer XOR, so 256-bit words are XORed as doubles.
+#ifdef HAS_WORD_128
+#define my_128b_xor_in_place(p, v) _mm_store_si128(p, _mm_xor_si128(_mm_load_si128(p), v))
+#endif
+#ifdef HAS_WORD_256
+#define my_256b_xor_in_place(p, v) _mm256_store_pd(reinterpret_cast<double*>(p), _mm256_xor_pd(_mm256_load_pd(reinterpret_cast<const double*>(p)), _mm256_castsi256_pd(v)))
+#endif
+#endif
 
 bool xmem::determine_sequential_kernel(rw_mode_t rw_mode, chunk_size_t chunk_size, int32_t stride_size, SequentialFunction* kernel_function, SequentialFunction* dummy_kernel_function) {
     switch (rw_mode) {
@@ -726,84 +756,276 @@ bool xmem::determine_sequential_kernel(rw_mode_t rw_mode, chunk_size_t chunk_siz
             }
             return true;
 
-        default:
-            return false;
-    }
-
-    return false; //shouldn't reach this point
-}
-    
-bool xmem::determine_random_kernel(rw_mode_t rw_mode, chunk_size_t chunk_size, RandomFunction* kernel_function, RandomFunction* dummy_kernel_function) {
-    switch (rw_mode) {
-        case READ:
+        case READ_MODIFY_WRITE:
             switch (chunk_size) {
-                //special case on 32-bit architectures only.
-#ifndef HAS_WORD_64
                 case CHUNK_32b:
-                    *kernel_function = &randomRead_Word32;
-                    *dummy_kernel_function = &dummy_randomLoop_Word32;
+                    switch (stride_size) {
+                        case 1:
+                            *kernel_function = &forwSequentialReadModifyWrite_Word32;
+                            *dummy_kernel_function = &dummy_forwSequentialLoop_Word32;
+                            return true;
+                        case -1:
+                            *kernel_function = &revSequentialReadModifyWrite_Word32;
+                            *dummy_kernel_function = &dummy_revSequentialLoop_Word32;
+                            return true;
+                        case 2:
+                            *kernel_function = &forwStride2ReadModifyWrite_Word32;
+                            *dummy_kernel_function = &dummy_forwStride2Loop_Word32;
+                            return true;
+                        case -2:
+                            *kernel_function = &revStride2ReadModifyWrite_Word32;
+                            *dummy_kernel_function = &dummy_revStride2Loop_Word32;
+                            return true;
+                        case 4:
+                            *kernel_function = &forwStride4ReadModifyWrite_Word32;
+                            *dummy_kernel_function = &dummy_forwStride4Loop_Word32;
+                            return true;
+                        case -4:
+                            *kernel_function = &revStride4ReadModifyWrite_Word32;
+                            *dummy_kernel_function = &dummy_revStride4Loop_Word32;
+                            return true;
+                        case 8:
+                            *kernel_function = &forwStride8ReadModifyWrite_Word32;
+                            *dummy_kernel_function = &dummy_forwStride8Loop_Word32;
+                            return true;
+                        case -8:
+                            *kernel_function = &revStride8ReadModifyWrite_Word32;
+                            *dummy_kernel_function = &dummy_revStride8Loop_Word32;
+                            return true;
+                        case 16:
+                            *kernel_function = &forwStride16ReadModifyWrite_Word32;
+                            *dummy_kernel_function = &dummy_forwStride16Loop_Word32;
+                            return true;
+                        case -16:
+                            *kernel_function = &revStride16ReadModifyWrite_Word32;
+                            *dummy_kernel_function = &dummy_revStride16Loop_Word32;
+                            return true;
+                        default:
+                            return false;
+                    }
                     return true;
-#endif
 #ifdef HAS_WORD_64
                 case CHUNK_64b:
-                    *kernel_function = &randomRead_Word64;
-                    *dummy_kernel_function = &dummy_randomLoop_Word64;
+                    switch (stride_size) {
+                        case 1:
+                            *kernel_function = &forwSequentialReadModifyWrite_Word64;
+                            *dummy_kernel_function = &dummy_forwSequentialLoop_Word64;
+                            return true;
+                        case -1:
+                            *kernel_function = &revSequentialReadModifyWrite_Word64;
+                            *dummy_kernel_function = &dummy_revSequentialLoop_Word64;
+                            return true;
+                        case 2:
+                            *kernel_function = &forwStride2ReadModifyWrite_Word64;
+                            *dummy_kernel_function = &dummy_forwStride2Loop_Word64;
+                            return true;
+                        case -2:
+                            *kernel_function = &revStride2ReadModifyWrite_Word64;
+                            *dummy_kernel_function = &dummy_revStride2Loop_Word64;
+                            return true;
+                        case 4:
+                            *kernel_function = &forwStride4ReadModifyWrite_Word64;
+                            *dummy_kernel_function = &dummy_forwStride4Loop_Word64;
+                            return true;
+                        case -4:
+                            *kernel_function = &revStride4ReadModifyWrite_Word64;
+                            *dummy_kernel_function = &dummy_revStride4Loop_Word64;
+                            return true;
+                        case 8:
+                            *kernel_function = &forwStride8ReadModifyWrite_Word64;
+                            *dummy_kernel_function = &dummy_forwStride8Loop_Word64;
+                            return true;
+                        case -8:
+                            *kernel_function = &revStride8ReadModifyWrite_Word64;
+                            *dummy_kernel_function = &dummy_revStride8Loop_Word64;
+                            return true;
+                        case 16:
+                            *kernel_function = &forwStride16ReadModifyWrite_Word64;
+                            *dummy_kernel_function = &dummy_forwStride16Loop_Word64;
+                            return true;
+                        case -16:
+                            *kernel_function = &revStride16ReadModifyWrite_Word64;
+                            *dummy_kernel_function = &dummy_revStride16Loop_Word64;
+                            return true;
+                        default:
+                            return false;
+                    }
                     return true;
 #endif
 #ifdef HAS_WORD_128
                 case CHUNK_128b:
-                    *kernel_function = &randomRead_Word128;
-                    *dummy_kernel_function = &dummy_randomLoop_Word128;
+                    switch (stride_size) {
+                        case 1:
+                            *kernel_function = &forwSequentialReadModifyWrite_Word128;
+                            *dummy_kernel_function = &dummy_forwSequentialLoop_Word128;
+                            return true;
+                        case -1:
+                            *kernel_function = &revSequentialReadModifyWrite_Word128;
+                            *dummy_kernel_function = &dummy_revSequentialLoop_Word128;
+                            return true;
+                        case 2:
+                            *kernel_function = &forwStride2ReadModifyWrite_Word128;
+                            *dummy_kernel_function = &dummy_forwStride2Loop_Word128;
+                            return true;
+                        case -2:
+                            *kernel_function = &revStride2ReadModifyWrite_Word128;
+                            *dummy_kernel_function = &dummy_revStride2Loop_Word128;
+                            return true;
+                        case 4:
+                            *kernel_function = &forwStride4ReadModifyWrite_Word128;
+                            *dummy_kernel_function = &dummy_forwStride4Loop_Word128;
+                            return true;
+                        case -4:
+                            *kernel_function = &revStride4ReadModifyWrite_Word128;
+                            *dummy_kernel_function = &dummy_revStride4Loop_Word128;
+                            return true;
+                        case 8:
+                            *kernel_function = &forwStride8ReadModifyWrite_Word128;
+                            *dummy_kernel_function = &dummy_forwStride8Loop_Word128;
+                            return true;
+                        case -8:
+                            *kernel_function = &revStride8ReadModifyWrite_Word128;
+                            *dummy_kernel_function = &dummy_revStride8Loop_Word128;
+                            return true;
+                        case 16:
+                            *kernel_function = &forwStride16ReadModifyWrite_Word128;
+                            *dummy_kernel_function = &dummy_forwStride16Loop_Word128;
+                            return true;
+                        case -16:
+                            *kernel_function = &revStride16ReadModifyWrite_Word128;
+                            *dummy_kernel_function = &dummy_revStride16Loop_Word128;
+                            return true;
+                        default:
+                            return false;
+                    }
                     return true;
 #endif
 #ifdef HAS_WORD_256
                 case CHUNK_256b:
-                    *kernel_function = &randomRead_Word256;
-                    *dummy_kernel_function = &dummy_randomLoop_Word256;
+                    switch (stride_size) {
+                        case 1:
+                            *kernel_function = &forwSequentialReadModifyWrite_Word256;
+                            *dummy_kernel_function = &dummy_forwSequentialLoop_Word256;
+                            return true;
+                        case -1:
+                            *kernel_function = &revSequentialReadModifyWrite_Word256;
+                            *dummy_kernel_function = &dummy_revSequentialLoop_Word256;
+                            return true;
+                        case 2:
+                            *kernel_function = &forwStride2ReadModifyWrite_Word256;
+                            *dummy_kernel_function = &dummy_forwStride2Loop_Word256;
+                            return true;
+                        case -2:
+                            *kernel_function = &revStride2ReadModifyWrite_Word256;
+                            *dummy_kernel_function = &dummy_revStride2Loop_Word256;
+                            return true;
+                        case 4:
+                            *kernel_function = &forwStride4ReadModifyWrite_Word256;
+                            *dummy_kernel_function = &dummy_forwStride4Loop_Word256;
+                            return true;
+                        case -4:
+                            *kernel_function = &revStride4ReadModifyWrite_Word256;
+                            *dummy_kernel_function = &dummy_revStride4Loop_Word256;
+                            return true;
+                        case 8:
+                            *kernel_function = &forwStride8ReadModifyWrite_Word256;
+                            *dummy_kernel_function = &dummy_forwStride8Loop_Word256;
+                            return true;
+                        case -8:
+                            *kernel_function = &revStride8ReadModifyWrite_Word256;
+                            *dummy_kernel_function = &dummy_revStride8Loop_Word256;
+                            return true;
+                        case 16:
+                            *kernel_function = &forwStride16ReadModifyWrite_Word256;
+                            *dummy_kernel_function = &dummy_forwStride16Loop_Word256;
+                            return true;
+                        case -16:
+                            *kernel_function = &revStride16ReadModifyWrite_Word256;
+                            *dummy_kernel_function = &dummy_revStride16Loop_Word256;
+                            return true;
+                        default:
+                            return false;
+                    }
                     return true;
 #endif
 #ifdef HAS_WORD_512
                 case CHUNK_512b:
-                    *kernel_function = &randomRead_Word512;
-                    *dummy_kernel_function = &dummy_randomLoop_Word512;
+                    switch (stride_size) {
+                        case 1:
+                            *kernel_function = &forwSequentialReadModifyWrite_Word512;
+                            *dummy_kernel_function = &dummy_forwSequentialLoop_Word512;
+                            return true;
+                        case -1:
+                            *kernel_function = &revSequentialReadModifyWrite_Word512;
+                            *dummy_kernel_function = &dummy_revSequentialLoop_Word512;
+                            return true;
+                        case 2:
+                            *kernel_function = &forwStride2ReadModifyWrite_Word512;
+                            *dummy_kernel_function = &dummy_forwStride2Loop_Word512;
+                            return true;
+                        case -2:
+                            *kernel_function = &revStride2ReadModifyWrite_Word512;
+                            *dummy_kernel_function = &dummy_revStride2Loop_Word512;
+                            return true;
+                        case 4:
+                            *kernel_function = &forwStride4ReadModifyWrite_Word512;
+                            *dummy_kernel_function = &dummy_forwStride4Loop_Word512;
+                            return true;
+                        case -4:
+                            *kernel_function = &revStride4ReadModifyWrite_Word512;
+                            *dummy_kernel_function = &dummy_revStride4Loop_Word512;
+                            return true;
+                        case 8:
+                            *kernel_function = &forwStride8ReadModifyWrite_Word512;
+                            *dummy_kernel_function = &dummy_forwStride8Loop_Word512;
+                            return true;
+                        case -8:
+                            *kernel_function = &revStride8ReadModifyWrite_Word512;
+                            *dummy_kernel_function = &dummy_revStride8Loop_Word512;
+                            return true;
+                        case 16:
+                            *kernel_function = &forwStride16ReadModifyWrite_Word512;
+                            *dummy_kernel_function = &dummy_forwStride16Loop_Word512;
+                            return true;
+                        case -16:
+                            *kernel_function = &revStride16ReadModifyWrite_Word512;
+                            *dummy_kernel_function = &dummy_revStride16Loop_Word512;
+                            return true;
+                        default:
+                            return false;
+                    }
                     return true;
 #endif
+
                 default:
                     return false;
             }
             return true;
 
-        case WRITE:
+        case READ_WRITE_1_1: //Read/write mixes only have forward sequential kernels
+            if (stride_size != 1)
+                return false;
             switch (chunk_size) {
-                //special case on 32-bit architectures only.
-#ifndef HAS_WORD_64
                 case CHUNK_32b:
-                    *kernel_function = &randomWrite_Word32;
-                    *dummy_kernel_function = &dummy_randomLoop_Word32;
+                    *kernel_function = &forwSequentialMix1to1_Word32;
+                    *dummy_kernel_function = &dummy_forwSequentialMix1to1Loop_Word32;
                     return true;
-#endif
 #ifdef HAS_WORD_64
                 case CHUNK_64b:
-                    *kernel_function = &randomWrite_Word64;
-                    *dummy_kernel_function = &dummy_randomLoop_Word64;
+                    *kernel_function = &forwSequentialMix1to1_Word64;
+                    *dummy_kernel_function = &dummy_forwSequentialMix1to1Loop_Word64;
                     return true;
 #endif
 #ifdef HAS_WORD_128
                 case CHUNK_128b:
-                    *kernel_function = &randomWrite_Word128;
-                    *dummy_kernel_function = &dummy_randomLoop_Word128;
+                    *kernel_function = &forwSequentialMix1to1_Word128;
+                    *dummy_kernel_function = &dummy_forwSequentialMix1to1Loop_Word128;
                     return true;
 #endif
 #ifdef HAS_WORD_256
                 case CHUNK_256b:
-                    *kernel_function = &randomWrite_Word256;
-                    *dummy_kernel_function = &dummy_randomLoop_Word256;
-                    return true;
-#endif
-#ifdef HAS_WORD_512
-                case CHUNK_512b:
-                    *kernel_function = &randomWrite_Word512;
-                    *dummy_kernel_function = &dummy_randomLoop_Word512;
+                    *kernel_function = &forwSequentialMix1to1_Word256;
+                    *dummy_kernel_function = &dummy_forwSequentialMix1to1Loop_Word256;
                     return true;
 #endif
                 default:
@@ -811,360 +1033,3541 @@ bool xmem::determine_random_kernel(rw_mode_t rw_mode, chunk_size_t chunk_size, R
             }
             return true;
 
-        default:
-            return false;
-    }
-
-    return false;
-}
-
-bool xmem::build_random_pointer_permutation(void* start_address, void* end_address, chunk_size_t chunk_size) {
-    if (g_verbose)
-        std::cout << "Preparing a memory region under test. This might take a while...";
-
-    size_t length = reinterpret_cast<uint8_t*>(end_address) - reinterpret_cast<uint8_t*>(start_address); //length of region in bytes
-    size_t num_pointers = 0; //Number of pointers that fit into the memory region of interest
-    switch (chunk_size) {
-        //special case on 32-bit architectures only.
-#ifndef HAS_WORD_64
-        case CHUNK_32b:
-            num_pointers = length / sizeof(Word32_t);
-            break;
-#endif
+        case READ_WRITE_2_1: //Read/write mixes only have forward sequential kernels
+            if (stride_size != 1)
+                return false;
+            switch (chunk_size) {
+                case CHUNK_32b:
+                    *kernel_function = &forwSequentialMix2to1_Word32;
+                    *dummy_kernel_function = &dummy_forwSequentialMix2to1Loop_Word32;
+                    return true;
 #ifdef HAS_WORD_64
-        case CHUNK_64b:
-            num_pointers = length / sizeof(Word64_t);
-            break;
+                case CHUNK_64b:
+                    *kernel_function = &forwSequentialMix2to1_Word64;
+                    *dummy_kernel_function = &dummy_forwSequentialMix2to1Loop_Word64;
+                    return true;
 #endif
 #ifdef HAS_WORD_128
-        case CHUNK_128b:
-            num_pointers = length / sizeof(Word128_t);
-            break;
+                case CHUNK_128b:
+                    *kernel_function = &forwSequentialMix2to1_Word128;
+                    *dummy_kernel_function = &dummy_forwSequentialMix2to1Loop_Word128;
+                    return true;
 #endif
 #ifdef HAS_WORD_256
-        case CHUNK_256b:
-            num_pointers = length / sizeof(Word256_t);
-            break;
+                case CHUNK_256b:
+                    *kernel_function = &forwSequentialMix2to1_Word256;
+                    *dummy_kernel_function = &dummy_forwSequentialMix2to1Loop_Word256;
+                    return true;
 #endif
-#ifdef HAS_WORD_512
-        case CHUNK_512b:
-            num_pointers = length / sizeof(Word512_t);
-            break;
+                default:
+                    return false;
+            }
+            return true;
+
+        case READ_WRITE_3_1: //Read/write mixes only have forward sequential kernels
+            if (stride_size != 1)
+                return false;
+            switch (chunk_size) {
+                case CHUNK_32b:
+                    *kernel_function = &forwSequentialMix3to1_Word32;
+                    *dummy_kernel_function = &dummy_forwSequentialMix3to1Loop_Word32;
+                    return true;
+#ifdef HAS_WORD_64
+                case CHUNK_64b:
+                    *kernel_function = &forwSequentialMix3to1_Word64;
+                    *dummy_kernel_function = &dummy_forwSequentialMix3to1Loop_Word64;
+                    return true;
 #endif
-        default:
-            std::cerr << "ERROR: Chunk size must be at least "
-            //special case for 32-bit architectures
-#ifndef HAS_WORD_64
-            <<"32"
+#ifdef HAS_WORD_128
+                case CHUNK_128b:
+                    *kernel_function = &forwSequentialMix3to1_Word128;
+                    *dummy_kernel_function = &dummy_forwSequentialMix3to1Loop_Word128;
+                    return true;
 #endif
-#ifdef HAS_WORD_64
-            <<"64"
+#ifdef HAS_WORD_256
+                case CHUNK_256b:
+                    *kernel_function = &forwSequentialMix3to1_Word256;
+                    *dummy_kernel_function = &dummy_forwSequentialMix3to1Loop_Word256;
+                    return true;
 #endif
-            << "bits for building a random pointer permutation. This should not have happened." << std::endl;
+                default:
+                    return false;
+            }
+            return true;
+
+        default:
             return false;
     }
-            
-    std::mt19937_64 gen(time(NULL)); //Mersenne Twister random number generator, seeded at current time
+
+    return false; //shouldn't reach this point
+}
     
-    //Do a random shuffle of memory pointers. 
-    //I had originally used a random Hamiltonian Cycle generator, but this was much slower and aside from
-    //rare instances, did not make any difference in random-access performance measurement.
+bool xmem::determine_random_kernel(rw_mode_t rw_mode, chunk_size_t chunk_size, RandomFunction* kernel_function, RandomFunction* dummy_kernel_function) {
+    switch (rw_mode) {
+        case READ:
+            switch (chunk_size) {
+                //special case on 32-bit architectures only.
+#ifndef HAS_WORD_64
+                case CHUNK_32b:
+                    *kernel_function = &randomRead_Word32;
+                    *dummy_kernel_function = &dummy_randomLoop_Word32;
+                    return true;
+#endif
 #ifdef HAS_WORD_64
-    Word64_t* mem_region_base = reinterpret_cast<Word64_t*>(start_address);
-#else //special case for 32-bit architectures
-    Word32_t* mem_region_base = reinterpret_cast<Word32_t*>(start_address);
+                case CHUNK_64b:
+                    *kernel_function = &randomRead_Word64;
+                    *dummy_kernel_function = &dummy_randomLoop_Word64;
+                    return true;
+#endif
+#ifdef HAS_WORD_128
+                case CHUNK_128b:
+                    *kernel_function = &randomRead_Word128;
+                    *dummy_kernel_function = &dummy_randomLoop_Word128;
+                    return true;
+#endif
+#ifdef HAS_WORD_256
+                case CHUNK_256b:
+                    *kernel_function = &randomRead_Word256;
+                    *dummy_kernel_function = &dummy_randomLoop_Word256;
+                    return true;
+#endif
+#ifdef HAS_WORD_512
+                case CHUNK_512b:
+                    *kernel_function = &randomRead_Word512;
+                    *dummy_kernel_function = &dummy_randomLoop_Word512;
+                    return true;
+#endif
+                default:
+                    return false;
+            }
+            return true;
+
+        case WRITE:
+            switch (chunk_size) {
+                //special case on 32-bit architectures only.
+#ifndef HAS_WORD_64
+                case CHUNK_32b:
+                    *kernel_function = &randomWrite_Word32;
+                    *dummy_kernel_function = &dummy_randomLoop_Word32;
+                    return true;
 #endif
-    switch (chunk_size) {
 #ifdef HAS_WORD_64
-        case CHUNK_64b:
-            for (size_t i = 0; i < num_pointers; i++) { //Initialize pointers to point at themselves (identity mapping)
-                mem_region_base[i] = reinterpret_cast<Word64_t>(mem_region_base+i);
+                case CHUNK_64b:
+                    *kernel_function = &randomWrite_Word64;
+                    *dummy_kernel_function = &dummy_randomLoop_Word64;
+                    return true;
+#endif
+#ifdef HAS_WORD_128
+                case CHUNK_128b:
+                    *kernel_function = &randomWrite_Word128;
+                    *dummy_kernel_function = &dummy_randomLoop_Word128;
+                    return true;
+#endif
+#ifdef HAS_WORD_256
+                case CHUNK_256b:
+                    *kernel_function = &randomWrite_Word256;
+                    *dummy_kernel_function = &dummy_randomLoop_Word256;
+                    return true;
+#endif
+#ifdef HAS_WORD_512
+                case CHUNK_512b:
+                    *kernel_function = &randomWrite_Word512;
+                    *dummy_kernel_function = &dummy_randomLoop_Word512;
+                    return true;
+#endif
+                default:
+                    return false;
             }
-            std::shuffle(mem_region_base, mem_region_base + num_pointers, gen);
-            break;
-#else //special case for 32-bit architectures
-        case CHUNK_32b:
-            for (size_t i = 0; i < num_pointers; i++) { //Initialize pointers to point at themselves (identity mapping)
-                mem_region_base[i] = reinterpret_cast<Word32_t>(mem_region_base+i);
+            return true;
+
+        case READ_WRITE_1_1: //A random write already reads each pointer before writing it back, which is a 1:1 mix
+            switch (chunk_size) {
+                //special case on 32-bit architectures only.
+#ifndef HAS_WORD_64
+                case CHUNK_32b:
+                    *kernel_function = &randomWrite_Word32;
+                    *dummy_kernel_function = &dummy_randomLoop_Word32;
+                    return true;
+#endif
+#ifdef HAS_WORD_64
+                case CHUNK_64b:
+                    *kernel_function = &randomWrite_Word64;
+                    *dummy_kernel_function = &dummy_randomLoop_Word64;
+                    return true;
+#endif
+#ifdef HAS_WORD_128
+                case CHUNK_128b:
+                    *kernel_function = &randomWrite_Word128;
+                    *dummy_kernel_function = &dummy_randomLoop_Word128;
+                    return true;
+#endif
+#ifdef HAS_WORD_256
+                case CHUNK_256b:
+                    *kernel_function = &randomWrite_Word256;
+                    *dummy_kernel_function = &dummy_randomLoop_Word256;
+                    return true;
+#endif
+                default:
+                    return false;
             }
-            std::shuffle(mem_region_base, mem_region_base + num_pointers, gen);
-            break;
+            return true;
+
+        case READ_WRITE_2_1:
+            switch (chunk_size) {
+                //special case on 32-bit architectures only.
+#ifndef HAS_WORD_64
+                case CHUNK_32b:
+                    *kernel_function = &randomMix2to1_Word32;
+                    *dummy_kernel_function = &dummy_randomLoop_Word32;
+                    return true;
+#endif
+#ifdef HAS_WORD_64
+                case CHUNK_64b:
+                    *kernel_function = &randomMix2to1_Word64;
+                    *dummy_kernel_function = &dummy_randomLoop_Word64;
+                    return true;
 #endif
 #ifdef HAS_WORD_128
-        case CHUNK_128b:
-            for (size_t i = 0; i < num_pointers; i++) { //Initialize pointers to point at themselves (identity mapping)
+                case CHUNK_128b:
+                    *kernel_function = &randomMix2to1_Word128;
+                    *dummy_kernel_function = &dummy_randomLoop_Word128;
+                    return true;
+#endif
+#ifdef HAS_WORD_256
+                case CHUNK_256b:
+                    *kernel_function = &randomMix2to1_Word256;
+                    *dummy_kernel_function = &dummy_randomLoop_Word256;
+                    return true;
+#endif
+                default:
+                    return false;
+            }
+            return true;
+
+        case READ_WRITE_3_1:
+            switch (chunk_size) {
+                //special case on 32-bit architectures only.
+#ifndef HAS_WORD_64
+                case CHUNK_32b:
+                    *kernel_function = &randomMix3to1_Word32;
+                    *dummy_kernel_function = &dummy_randomLoop_Word32;
+                    return true;
+#endif
 #ifdef HAS_WORD_64
-                mem_region_base[i*2] = reinterpret_cast<Word64_t>(mem_region_base+(i*2));
-                mem_region_base[(i*2)+1] = 0xFFFFFFFFFFFFFFFF; //1-fill upper 64 bits
-#else //special case for 32-bit architectures
-                mem_region_base[i*4] = reinterpret_cast<Word32_t>(mem_region_base+(i*4));
-                mem_region_base[(i*4)+1] = 0xFFFFFFFF; //1-fill upper 96 bits
-                mem_region_base[(i*4)+2] = 0xFFFFFFFF; 
-                mem_region_base[(i*4)+3] = 0xFFFFFFFF; 
+                case CHUNK_64b:
+                    *kernel_function = &randomMix3to1_Word64;
+                    *dummy_kernel_function = &dummy_randomLoop_Word64;
+                    return true;
+#endif
+#ifdef HAS_WORD_128
+                case CHUNK_128b:
+                    *kernel_function = &randomMix3to1_Word128;
+                    *dummy_kernel_function = &dummy_randomLoop_Word128;
+                    return true;
+#endif
+#ifdef HAS_WORD_256
+                case CHUNK_256b:
+                    *kernel_function = &randomMix3to1_Word256;
+                    *dummy_kernel_function = &dummy_randomLoop_Word256;
+                    return true;
+#endif
+                default:
+                    return false;
+            }
+            return true;
+
+        default:
+            return false;
+    }
+
+    return false;
+}
+
+bool xmem::determine_atomic_kernel(atomic_op_t atomic_op, AtomicFunction* kernel_function, AtomicFunction* dummy_kernel_function) {
+    switch (atomic_op) {
+        case ATOMIC_FETCH_ADD:
+            *kernel_function = &atomicFetchAdd_Word64;
+            *dummy_kernel_function = &dummy_atomicLoop;
+            return true;
+        case ATOMIC_COMPARE_EXCHANGE:
+            *kernel_function = &atomicCompareExchange_Word64;
+            *dummy_kernel_function = &dummy_atomicLoop;
+            return true;
+        case ATOMIC_EXCHANGE:
+            *kernel_function = &atomicExchange_Word64;
+            *dummy_kernel_function = &dummy_atomicLoop;
+            return true;
+        default:
+            return false;
+    }
+
+    return false;
+}
+
+bool xmem::determine_flush_kernel(flush_op_t flush_op, bool fenced, SequentialFunction* kernel_function, SequentialFunction* dummy_kernel_function) {
+#ifdef ARCH_INTEL
+    switch (flush_op) {
+        case FLUSH_CLFLUSH:
+            *kernel_function = fenced ? &flushLinesFenced_clflush : &flushLines_clflush;
+            *dummy_kernel_function = &dummy_flushLoop;
+            return true;
+        case FLUSH_CLFLUSHOPT:
+            *kernel_function = fenced ? &flushLinesFenced_clflushopt : &flushLines_clflushopt;
+            *dummy_kernel_function = &dummy_flushLoop;
+            return true;
+        case FLUSH_CLWB:
+            *kernel_function = fenced ? &flushLinesFenced_clwb : &flushLines_clwb;
+            *dummy_kernel_function = &dummy_flushLoop;
+            return true;
+        default:
+            return false;
+    }
+#endif
+
+    return false;
+}
+
+void xmem::flush_region(void* start_address, void* end_address) {
+#ifdef ARCH_INTEL
+    //The kernel walks whole 4 KB blocks, so flush any tail line by line
+    uintptr_t start = reinterpret_cast<uintptr_t>(start_address);
+    uintptr_t end = reinterpret_cast<uintptr_t>(end_address);
+    uintptr_t blocks_end = start + ((end - start) / 4096) * 4096;
+    if (blocks_end > start)
+        flushLines_clflush(start_address, reinterpret_cast<void*>(blocks_end));
+    for (uintptr_t line = blocks_end; line < end; line += CACHE_LINE_SIZE)
+        my_clflush(line);
+    my_mfence();
+#endif
+}
+
+bool xmem::determine_copy_kernel(copy_engine_t engine, CopyFunction* kernel_function, CopyFunction* dummy_kernel_function) {
+    *dummy_kernel_function = &dummy_copyFunction;
+    switch (engine) {
+        case COPY_MEMCPY:
+            *kernel_function = &copy_memcpy;
+            return true;
+        case COPY_MEMMOVE:
+            *kernel_function = &copy_memmove;
+            return true;
+        case FILL_MEMSET:
+            *kernel_function = &fill_memset;
+            return true;
+#ifdef ARCH_INTEL
+        case COPY_REP_MOVSB:
+            *kernel_function = &copy_repMovsb;
+            return true;
+        case FILL_REP_STOSB:
+            *kernel_function = &fill_repStosb;
+            return true;
+#endif
+#if defined(ARCH_INTEL) && defined(HAS_WORD_256)
+        case COPY_VECTOR:
+            *kernel_function = &copyVector_Word256;
+            return true;
+        case COPY_VECTOR_NT:
+            *kernel_function = &copyVectorNT_Word256;
+            return true;
+        case FILL_VECTOR:
+            *kernel_function = &fillVector_Word256;
+            return true;
+        case FILL_VECTOR_NT:
+            *kernel_function = &fillVectorNT_Word256;
+            return true;
+#endif
+        default:
+            return false;
+    }
+}
+
+bool xmem::determine_gather_kernel(gather_engine_t engine, GatherFunction* kernel_function, GatherFunction* dummy_kernel_function) {
+    *dummy_kernel_function = &dummy_gatherLoop_Word64;
+    switch (engine) {
+#ifdef HAS_WORD_64
+        case GATHER_SCALAR:
+            *kernel_function = &gatherScalar_Word64;
+            return true;
+        case SCATTER_SCALAR:
+            *kernel_function = &scatterScalar_Word64;
+            return true;
+#endif
+#if defined(ARCH_INTEL_X86_64) && defined(HAS_WORD_256)
+        case GATHER_AVX2:
+            *kernel_function = &gatherAVX2_Word64;
+            return true;
+        case GATHER_AVX512:
+            *kernel_function = &gatherAVX512_Word64;
+            return true;
+        case SCATTER_AVX512:
+            *kernel_function = &scatterAVX512_Word64;
+            return true;
+#endif
+        default:
+            return false;
+    }
+}
+
+bool xmem::determine_multi_stream_kernel(bool reverse, MultiStreamFunction* kernel_function, MultiStreamFunction* dummy_kernel_function) {
+    *dummy_kernel_function = &dummy_multiStreamLoop;
+#if defined(HAS_WORD_256)
+    *kernel_function = reverse ? &revMultiStreamRead_Word256 : &forwMultiStreamRead_Word256;
+    return true;
+#elif defined(HAS_WORD_64)
+    *kernel_function = reverse ? &revMultiStreamRead_Word64 : &forwMultiStreamRead_Word64;
+    return true;
+#else
+    return false;
+#endif
+}
+
+bool xmem::determine_unaligned_kernel(rw_mode_t rw_mode, chunk_size_t chunk_size, SequentialFunction* kernel_function, SequentialFunction* dummy_kernel_function) {
+#ifdef ARCH_INTEL
+    if (rw_mode != READ && rw_mode != WRITE)
+        return false;
+
+    switch (chunk_size) {
+        case CHUNK_32b:
+            *kernel_function = (rw_mode == READ) ? &forwSequentialReadUnaligned_Word32 : &forwSequentialWriteUnaligned_Word32;
+            *dummy_kernel_function = &dummy_forwSequentialLoop_Word32;
+            return true;
+#ifdef HAS_WORD_64
+        case CHUNK_64b:
+            *kernel_function = (rw_mode == READ) ? &forwSequentialReadUnaligned_Word64 : &forwSequentialWriteUnaligned_Word64;
+            *dummy_kernel_function = &dummy_forwSequentialLoop_Word64;
+            return true;
+#endif
+#ifdef HAS_WORD_128
+        case CHUNK_128b:
+            *kernel_function = (rw_mode == READ) ? &forwSequentialReadUnaligned_Word128 : &forwSequentialWriteUnaligned_Word128;
+            *dummy_kernel_function = &dummy_forwSequentialLoop_Word128;
+            return true;
+#endif
+#ifdef HAS_WORD_256
+        case CHUNK_256b:
+            *kernel_function = (rw_mode == READ) ? &forwSequentialReadUnaligned_Word256 : &forwSequentialWriteUnaligned_Word256;
+            *dummy_kernel_function = &dummy_forwSequentialLoop_Word256;
+            return true;
+#endif
+        default:
+            return false;
+    }
+#else
+    return false;
+#endif
+}
+
+bool xmem::determine_unaligned_random_kernel(chunk_size_t chunk_size, RandomFunction* kernel_function, RandomFunction* dummy_kernel_function) {
+#if defined(ARCH_INTEL) && defined(HAS_WORD_64)
+    switch (chunk_size) {
+        case CHUNK_64b:
+            *kernel_function = &randomReadUnaligned_Word64;
+            *dummy_kernel_function = &dummy_randomLoop_Word64;
+            return true;
+#ifdef HAS_WORD_128
+        case CHUNK_128b:
+            *kernel_function = &randomReadUnaligned_Word128;
+            *dummy_kernel_function = &dummy_randomLoop_Word64;
+            return true;
+#endif
+#ifdef HAS_WORD_256
+        case CHUNK_256b:
+            *kernel_function = &randomReadUnaligned_Word256;
+            *dummy_kernel_function = &dummy_randomLoop_Word64;
+            return true;
+#endif
+        default:
+            return false;
+    }
+#else
+    return false; //32-bit chunks cannot hold a pointer on 64-bit machines, and unaligned pointer chasing is not implemented for 32-bit machines
+#endif
+}
+
+bool xmem::determine_pattern_write_kernel(chunk_size_t chunk_size, PatternWriteFunction* kernel_function, PatternWriteFunction* dummy_kernel_function) {
+    switch (chunk_size) {
+        case CHUNK_32b:
+            *kernel_function = &forwSequentialPatternWrite_Word32;
+            *dummy_kernel_function = &dummy_forwSequentialPatternLoop_Word32;
+            return true;
+#ifdef HAS_WORD_64
+        case CHUNK_64b:
+            *kernel_function = &forwSequentialPatternWrite_Word64;
+            *dummy_kernel_function = &dummy_forwSequentialPatternLoop_Word64;
+            return true;
+#endif
+#ifdef HAS_WORD_128
+        case CHUNK_128b:
+            *kernel_function = &forwSequentialPatternWrite_Word128;
+            *dummy_kernel_function = &dummy_forwSequentialPatternLoop_Word128;
+            return true;
+#endif
+#ifdef HAS_WORD_256
+        case CHUNK_256b:
+            *kernel_function = &forwSequentialPatternWrite_Word256;
+            *dummy_kernel_function = &dummy_forwSequentialPatternLoop_Word256;
+            return true;
+#endif
+#ifdef HAS_WORD_512
+        case CHUNK_512b:
+            *kernel_function = &forwSequentialPatternWrite_Word512;
+            *dummy_kernel_function = &dummy_forwSequentialPatternLoop_Word512;
+            return true;
+#endif
+        default:
+            return false;
+    }
+}
+
+bool xmem::determine_tiled_kernel(tile_order_t order, rw_mode_t rw_mode, TiledFunction* kernel_function, TiledFunction* dummy_kernel_function) {
+#ifdef HAS_WORD_64
+    if (order != TILE_ORDER_TRANSPOSE && rw_mode != READ && rw_mode != WRITE)
+        return false;
+
+    switch (order) {
+        case TILE_ORDER_ROW:
+            *kernel_function = (rw_mode == READ) ? &rowMajor2DRead_Word64 : &rowMajor2DWrite_Word64;
+            *dummy_kernel_function = &dummy_rowMajor2DLoop_Word64;
+            return true;
+        case TILE_ORDER_COLUMN:
+            *kernel_function = (rw_mode == READ) ? &columnMajor2DRead_Word64 : &columnMajor2DWrite_Word64;
+            *dummy_kernel_function = &dummy_columnMajor2DLoop_Word64;
+            return true;
+        case TILE_ORDER_BLOCKED:
+            *kernel_function = (rw_mode == READ) ? &blocked2DRead_Word64 : &blocked2DWrite_Word64;
+            *dummy_kernel_function = &dummy_blocked2DLoop_Word64;
+            return true;
+        case TILE_ORDER_MORTON:
+            *kernel_function = (rw_mode == READ) ? &morton2DRead_Word64 : &morton2DWrite_Word64;
+            *dummy_kernel_function = &dummy_morton2DLoop_Word64;
+            return true;
+        case TILE_ORDER_TRANSPOSE:
+            *kernel_function = &transpose2D_Word64;
+            *dummy_kernel_function = &dummy_transpose2DLoop_Word64;
+            return true;
+        default:
+            return false;
+    }
+#else
+    return false;
+#endif
+}
+
+bool xmem::determine_roofline_kernel(roofline_engine_t engine, RooflineFunction* kernel_function, RooflineFunction* dummy_kernel_function) {
+    *dummy_kernel_function = &dummy_rooflineLoop;
+    switch (engine) {
+#ifdef HAS_WORD_64
+        case ROOFLINE_SCALAR_FMA:
+            *kernel_function = &rooflineScalarFMA_Word64;
+            return true;
+        case ROOFLINE_SCALAR_INT:
+            *kernel_function = &rooflineScalarInt_Word64;
+            return true;
+#endif
+#if defined(ARCH_INTEL_X86_64) && defined(HAS_WORD_256)
+        case ROOFLINE_AVX2_FMA:
+            *kernel_function = &rooflineAVX2FMA_Word256;
+            return true;
+        case ROOFLINE_AVX512_FMA:
+            *kernel_function = &rooflineAVX512FMA_Word512;
+            return true;
+#endif
+        default:
+            return false;
+    }
+}
+
+bool xmem::build_random_pointer_permutation(void* start_address, void* end_address, chunk_size_t chunk_size) {
+    if (g_verbose)
+        std::cout << "Preparing a memory region under test. This might take a while...";
+
+    size_t length = reinterpret_cast<uint8_t*>(end_address) - reinterpret_cast<uint8_t*>(start_address); //length of region in bytes
+    size_t num_pointers = 0; //Number of pointers that fit into the memory region of interest
+    switch (chunk_size) {
+        //special case on 32-bit architectures only.
+#ifndef HAS_WORD_64
+        case CHUNK_32b:
+            num_pointers = length / sizeof(Word32_t);
+            break;
+#endif
+#ifdef HAS_WORD_64
+        case CHUNK_64b:
+            num_pointers = length / sizeof(Word64_t);
+            break;
+#endif
+#ifdef HAS_WORD_128
+        case CHUNK_128b:
+            num_pointers = length / sizeof(Word128_t);
+            break;
+#endif
+#ifdef HAS_WORD_256
+        case CHUNK_256b:
+            num_pointers = length / sizeof(Word256_t);
+            break;
+#endif
+#ifdef HAS_WORD_512
+        case CHUNK_512b:
+            num_pointers = length / sizeof(Word512_t);
+            break;
+#endif
+        default:
+            std::cerr << "ERROR: Chunk size must be at least "
+            //special case for 32-bit architectures
+#ifndef HAS_WORD_64
+            <<"32"
+#endif
+#ifdef HAS_WORD_64
+            <<"64"
+#endif
+            << "bits for building a random pointer permutation. This should not have happened." << std::endl;
+            return false;
+    }
+            
+    std::mt19937_64 gen(time(NULL)); //Mersenne Twister random number generator, seeded at current time
+    
+    //Do a random shuffle of memory pointers. 
+    //I had originally used a random Hamiltonian Cycle generator, but this was much slower and aside from
+    //rare instances, did not make any difference in random-access performance measurement.
+#ifdef HAS_WORD_64
+    Word64_t* mem_region_base = reinterpret_cast<Word64_t*>(start_address);
+#else //special case for 32-bit architectures
+    Word32_t* mem_region_base = reinterpret_cast<Word32_t*>(start_address);
+#endif
+    switch (chunk_size) {
+#ifdef HAS_WORD_64
+        case CHUNK_64b:
+            for (size_t i = 0; i < num_pointers; i++) { //Initialize pointers to point at themselves (identity mapping)
+                mem_region_base[i] = reinterpret_cast<Word64_t>(mem_region_base+i);
+            }
+            std::shuffle(mem_region_base, mem_region_base + num_pointers, gen);
+            break;
+#else //special case for 32-bit architectures
+        case CHUNK_32b:
+            for (size_t i = 0; i < num_pointers; i++) { //Initialize pointers to point at themselves (identity mapping)
+                mem_region_base[i] = reinterpret_cast<Word32_t>(mem_region_base+i);
+            }
+            std::shuffle(mem_region_base, mem_region_base + num_pointers, gen);
+            break;
+#endif
+#ifdef HAS_WORD_128
+        case CHUNK_128b:
+            for (size_t i = 0; i < num_pointers; i++) { //Initialize pointers to point at themselves (identity mapping)
+#ifdef HAS_WORD_64
+                mem_region_base[i*2] = reinterpret_cast<Word64_t>(mem_region_base+(i*2));
+                mem_region_base[(i*2)+1] = 0xFFFFFFFFFFFFFFFF; //1-fill upper 64 bits
+#else //special case for 32-bit architectures
+                mem_region_base[i*4] = reinterpret_cast<Word32_t>(mem_region_base+(i*4));
+                mem_region_base[(i*4)+1] = 0xFFFFFFFF; //1-fill upper 96 bits
+                mem_region_base[(i*4)+2] = 0xFFFFFFFF; 
+                mem_region_base[(i*4)+3] = 0xFFFFFFFF; 
+#endif
+            }
+            std::shuffle(reinterpret_cast<Word128_t*>(mem_region_base), reinterpret_cast<Word128_t*>(mem_region_base) + num_pointers, gen);
+            break;
+#endif
+#ifdef HAS_WORD_256
+        case CHUNK_256b:
+            for (size_t i = 0; i < num_pointers; i++) { //Initialize pointers to point at themselves (identity mapping)
+#ifdef HAS_WORD_64
+                mem_region_base[i*4] = reinterpret_cast<Word64_t>(mem_region_base+(i*4));
+                mem_region_base[(i*4)+1] = 0xFFFFFFFFFFFFFFFF; //1-fill upper 192 bits
+                mem_region_base[(i*4)+2] = 0xFFFFFFFFFFFFFFFF; 
+                mem_region_base[(i*4)+3] = 0xFFFFFFFFFFFFFFFF;
+#else //special case for 32-bit architectures
+                mem_region_base[i*8] = reinterpret_cast<Word32_t>(mem_region_base+(i*8));
+                mem_region_base[(i*8)+1] = 0xFFFFFFFF; //1-fill upper 224 bits
+                mem_region_base[(i*8)+2] = 0xFFFFFFFF;
+                mem_region_base[(i*8)+3] = 0xFFFFFFFF;
+                mem_region_base[(i*8)+4] = 0xFFFFFFFF;
+                mem_region_base[(i*8)+5] = 0xFFFFFFFF;
+                mem_region_base[(i*8)+6] = 0xFFFFFFFF;
+                mem_region_base[(i*8)+7] = 0xFFFFFFFF;
+#endif
+            }
+            std::shuffle(reinterpret_cast<Word256_t*>(mem_region_base), reinterpret_cast<Word256_t*>(mem_region_base) + num_pointers, gen);
+            break;
+#endif
+#ifdef HAS_WORD_512
+        case CHUNK_512b:
+            for (size_t i = 0; i < num_pointers; i++) { //Initialize pointers to point at themselves (identity mapping)
+#ifdef HAS_WORD_64
+                mem_region_base[i*4] = reinterpret_cast<Word64_t>(mem_region_base+(i*4));
+                mem_region_base[(i*4)+1] = 0xFFFFFFFFFFFFFFFF; //1-fill upper 448 bits
+                mem_region_base[(i*4)+2] = 0xFFFFFFFFFFFFFFFF; 
+                mem_region_base[(i*4)+3] = 0xFFFFFFFFFFFFFFFF;
+                mem_region_base[(i*4)+4] = 0xFFFFFFFFFFFFFFFF;
+                mem_region_base[(i*4)+5] = 0xFFFFFFFFFFFFFFFF;
+                mem_region_base[(i*4)+6] = 0xFFFFFFFFFFFFFFFF;
+                mem_region_base[(i*4)+7] = 0xFFFFFFFFFFFFFFFF;
+#else //special case for 32-bit architectures
+                mem_region_base[i*8] = reinterpret_cast<Word32_t>(mem_region_base+(i*8));
+                mem_region_base[(i*8)+1] = 0xFFFFFFFF; //1-fill upper 480 bits
+                mem_region_base[(i*8)+2] = 0xFFFFFFFF;
+                mem_region_base[(i*8)+3] = 0xFFFFFFFF;
+                mem_region_base[(i*8)+4] = 0xFFFFFFFF;
+                mem_region_base[(i*8)+5] = 0xFFFFFFFF;
+                mem_region_base[(i*8)+6] = 0xFFFFFFFF;
+                mem_region_base[(i*8)+7] = 0xFFFFFFFF;
+                mem_region_base[(i*8)+8] = 0xFFFFFFFF;
+                mem_region_base[(i*8)+9] = 0xFFFFFFFF;
+                mem_region_base[(i*8)+10] = 0xFFFFFFFF;
+                mem_region_base[(i*8)+11] = 0xFFFFFFFF;
+                mem_region_base[(i*8)+12] = 0xFFFFFFFF;
+                mem_region_base[(i*8)+13] = 0xFFFFFFFF;
+                mem_region_base[(i*8)+14] = 0xFFFFFFFF;
+                mem_region_base[(i*8)+15] = 0xFFFFFFFF;
+#endif
+            }
+            std::shuffle(reinterpret_cast<Word512_t*>(mem_region_base), reinterpret_cast<Word512_t*>(mem_region_base) + num_pointers, gen);
+            break;
+#endif
+        default:
+            std::cerr << "ERROR: Got an invalid chunk size. This should not have happened." << std::endl;
+            return false;
+    }
+
+    if (g_verbose) {
+        std::cout << "done" << std::endl;
+        std::cout << std::endl;
+    }
+
+    return true;
+}
+
+bool xmem::build_unaligned_pointer_chain(void* start_address, void* end_address, size_t offset, uintptr_t** first_node) {
+    size_t num_lines = (reinterpret_cast<uint8_t*>(end_address) - reinterpret_cast<uint8_t*>(start_address)) / CACHE_LINE_SIZE;
+    if (offset >= CACHE_LINE_SIZE || num_lines < 2) {
+        std::cerr << "ERROR: Cannot build an unaligned pointer chain at offset " << offset << " in " << num_lines << " cache lines. This should not have happened." << std::endl;
+        return false;
+    }
+
+    //The last line is left for the spilled bytes of the node before it
+    std::vector<size_t> lines(num_lines - 1);
+    for (size_t i = 0; i < lines.size(); i++)
+        lines[i] = i;
+    std::mt19937_64 gen(time(NULL)); //Mersenne Twister random number generator, seeded at current time
+    std::shuffle(lines.begin(), lines.end(), gen);
+
+    uint8_t* base = static_cast<uint8_t*>(start_address) + offset;
+    for (size_t i = 0; i < lines.size(); i++) {
+        uintptr_t next = reinterpret_cast<uintptr_t>(base + lines[(i + 1) % lines.size()] * CACHE_LINE_SIZE);
+        std::memcpy(base + lines[i] * CACHE_LINE_SIZE, &next, sizeof(next)); //Nodes may be unaligned
+    }
+    *first_node = reinterpret_cast<uintptr_t*>(base + lines[0] * CACHE_LINE_SIZE);
+    return true;
+}
+
+bool xmem::fill_data_pattern(void* start_address, void* end_address, data_pattern_t pattern, const std::vector<uint8_t>& file_data) {
+    uint8_t* start = static_cast<uint8_t*>(start_address);
+    uint8_t* end = static_cast<uint8_t*>(end_address);
+    size_t len = end - start;
+    uint64_t* words = reinterpret_cast<uint64_t*>(start);
+    size_t num_words = len / sizeof(uint64_t);
+    uint8_t* tail = start + num_words * sizeof(uint64_t);
+
+    switch (pattern) {
+        case DATA_ZEROS:
+            std::memset(start, 0x00, len);
+            return true;
+        case DATA_ONES:
+            std::memset(start, 0xFF, len);
+            return true;
+        case DATA_ALTERNATING:
+            for (size_t i = 0; i < num_words; i++)
+                words[i] = (i % 2 == 0) ? 0x5555555555555555 : 0xAAAAAAAAAAAAAAAA;
+            std::memset(tail, (num_words % 2 == 0) ? 0x55 : 0xAA, end - tail);
+            return true;
+        case DATA_RANDOM: {
+            std::mt19937_64 gen(time(NULL)); //Mersenne Twister random number generator, seeded at current time
+            for (size_t i = 0; i < num_words; i++)
+                words[i] = gen();
+            uint64_t last = gen();
+            std::memcpy(tail, &last, end - tail);
+            return true;
+        }
+        case DATA_FILE:
+            if (file_data.empty()) {
+                std::cerr << "ERROR: There is no file data to fill memory with. This should not have happened." << std::endl;
+                return false;
+            }
+            for (uint8_t* p = start; p < end; p += file_data.size())
+                std::memcpy(p, file_data.data(), std::min(file_data.size(), static_cast<size_t>(end - p)));
+            return true;
+        default:
+            std::cerr << "ERROR: Unknown data pattern. This should not have happened." << std::endl;
+            return false;
+    }
+}
+
+bool xmem::build_gather_indices(uint32_t* indices, size_t num_indices, gather_index_t pattern, size_t stride, size_t window_elements) {
+    switch (pattern) {
+        case GATHER_INDEX_SEQUENTIAL:
+            for (size_t i = 0; i < num_indices; i++)
+                indices[i] = static_cast<uint32_t>(i);
+            return true;
+        case GATHER_INDEX_STRIDED:
+            if (stride == 0 || num_indices % stride != 0) {
+                std::cerr << "ERROR: The number of gather indices must be a multiple of the stride. This should not have happened." << std::endl;
+                return false;
+            }
+            //Each wrap-around starts one element past the previous one, so every element is visited once
+            for (size_t i = 0; i < num_indices; i++)
+                indices[i] = static_cast<uint32_t>((i * stride) % num_indices + (i * stride) / num_indices);
+            return true;
+        case GATHER_INDEX_WINDOW:
+        case GATHER_INDEX_RANDOM: {
+            if (pattern == GATHER_INDEX_RANDOM || window_elements > num_indices)
+                window_elements = num_indices;
+            if (window_elements == 0) {
+                std::cerr << "ERROR: The gather index window must hold at least one element. This should not have happened." << std::endl;
+                return false;
+            }
+            std::mt19937_64 gen(time(NULL)); //Mersenne Twister random number generator, seeded at current time
+            for (size_t i = 0; i < num_indices; i++)
+                indices[i] = static_cast<uint32_t>(i);
+            for (size_t w = 0; w < num_indices; w += window_elements)
+                std::shuffle(indices + w, indices + std::min(w + window_elements, num_indices), gen);
+            return true;
+        }
+        default:
+            std::cerr << "ERROR: Unknown gather index pattern. This should not have happened." << std::endl;
+            return false;
+    }
+}
+
+/***********************************************************************
+ ***********************************************************************
+ ********************** LATENCY-RELATED BENCHMARK KERNELS **************
+ ***********************************************************************
+ ***********************************************************************/
+
+/* --------------------- DUMMY BENCHMARK ROUTINES --------------------------- */
+
+int32_t xmem::dummy_chasePointers(uintptr_t*, uintptr_t**, size_t len) {
+    volatile uintptr_t placeholder = 0; //Try to defeat compiler optimizations removing this method
+    return 0;
+}
+
+/* -------------------- CORE BENCHMARK ROUTINES -------------------------- */
+
+int32_t xmem::chasePointers(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len) {
+    volatile uintptr_t* p = first_address;
+    UNROLL512(p = reinterpret_cast<uintptr_t*>(*p);)
+    *last_touched_address = const_cast<uintptr_t*>(p);
+    return 0;
+}
+
+
+/***********************************************************************
+ ***********************************************************************
+ ******************* THROUGHPUT-RELATED BENCHMARK KERNELS **************
+ ***********************************************************************
+ ***********************************************************************/
+
+/* --------------------- DUMMY BENCHMARK ROUTINES --------------------------- */
+
+int32_t xmem::dummy_empty(void*, void*) { 
+    return 0;
+}
+        
+/* ------------ SEQUENTIAL LOOP --------------*/
+
+int32_t xmem::dummy_forwSequentialLoop_Word32(void* start_address, void* end_address) {
+    volatile int32_t placeholder = 0; //Try our best to defeat compiler optimizations
+    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(start_address), *endptr = static_cast<Word32_t*>(end_address); wordptr < endptr;) {
+        UNROLL1024(wordptr++;) 
+        placeholder = 0;
+    }
+    return placeholder;
+}
+
+#ifdef HAS_WORD_64
+int32_t xmem::dummy_forwSequentialLoop_Word64(void* start_address, void* end_address) {
+    volatile int32_t placeholder = 0; //Try our best to defeat compiler optimizations
+    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(start_address), *endptr = static_cast<Word64_t*>(end_address); wordptr < endptr;) {
+        UNROLL512(wordptr++;) 
+        placeholder = 0;
+    }
+    return placeholder;
+}
+#endif
+
+#ifdef HAS_WORD_128
+int32_t xmem::dummy_forwSequentialLoop_Word128(void* start_address, void* end_address) {
+#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
+    return win_x86_64_asm_dummy_forwSequentialLoop_Word128(static_cast<Word128_t*>(start_address), static_cast<Word128_t*>(end_address));
+#else
+    volatile int32_t placeholder = 0; //Try our best to defeat compiler optimizations
+    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(start_address), *endptr = static_cast<Word128_t*>(end_address); wordptr < endptr;) {
+        UNROLL256(wordptr++;) 
+        placeholder = 0;
+    }
+    return placeholder;
+#endif
+}
+#endif
+
+#ifdef HAS_WORD_256
+int32_t xmem::dummy_forwSequentialLoop_Word256(void* start_address, void* end_address) {
+#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
+    return win_x86_64_asm_dummy_forwSequentialLoop_Word256(static_cast<Word256_t*>(start_address), static_cast<Word256_t*>(end_address));
+#endif
+#ifdef __gnu_linux__
+    volatile int32_t placeholder = 0; //Try our best to defeat compiler optimizations
+    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(start_address), *endptr = static_cast<Word256_t*>(end_address); wordptr < endptr;) {
+        UNROLL128(wordptr++;) 
+        placeholder = 0;
+    }
+    return placeholder;
+#endif
+}
+#endif
+
+#ifdef HAS_WORD_512
+#ifdef _WIN32
+int32_t xmem::dummy_forwSequentialLoop_Word512(void* start_address, void* end_address) {
+#else
+//FIXME: We flag GCC/ICC not to optimize this function. The problem is that my_512b_load() -- which maps to _mm512_load_epi64 Intel AVX-512/KNC intrinsic -- cannot accept volatile* arguments. The only way to prevent the entire benchmark loop from being optimized away is to force the compiler not to optimize the function at all. Unfortunately, this will cause extra unwanted code to be included. The only solution seems to be to write inline assembly or allow eventual support for assignment of __m512i variables, e.g., val = *wordptr++; which is how the code for the other word sizes is written.
+int32_t __attribute__((optimize("O0"))) xmem::dummy_forwSequentialLoop_Word512(void* start_address, void* end_address) { 
+#endif
+#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
+    //return win_x86_64_asm_dummy_forwSequentialLoop_Word512(static_cast<Word512_t*>(start_address), static_cast<Word512_t*>(end_address));
+    #error 512-bit words on Windows are not currently supported.
+#endif
+#ifdef __gnu_linux__
+    volatile int32_t placeholder = 0; //Try our best to defeat compiler optimizations
+    for (Word512_t* wordptr = static_cast<Word512_t*>(start_address), *endptr = static_cast<Word512_t*>(end_address); wordptr < endptr;) {
+        UNROLL64(wordptr++;) 
+        placeholder = 0;
+    }
+    return placeholder;
+#endif
+}
+#endif
+
+int32_t xmem::dummy_revSequentialLoop_Word32(void* start_address, void* end_address) { 
+    volatile int32_t placeholder = 0; //Try our best to defeat compiler optimizations
+    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(end_address), *begptr = static_cast<Word32_t*>(start_address); wordptr > begptr;) {
+        UNROLL1024(wordptr--;)
+        placeholder = 0;
+    }
+    return placeholder;
+}
+
+#ifdef HAS_WORD_64
+int32_t xmem::dummy_revSequentialLoop_Word64(void* start_address, void* end_address) {
+    volatile int32_t placeholder = 0; //Try our best to defeat compiler optimizations
+    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(end_address), *begptr = static_cast<Word64_t*>(start_address); wordptr > begptr;) {
+        UNROLL512(wordptr--;)
+        placeholder = 0;
+    }
+    return placeholder;
+}
+#endif
+
+#ifdef HAS_WORD_128
+int32_t xmem::dummy_revSequentialLoop_Word128(void* start_address, void* end_address) {
+#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
+    return win_x86_64_asm_dummy_revSequentialLoop_Word128(static_cast<Word128_t*>(end_address), static_cast<Word128_t*>(start_address));
+#endif
+    volatile int32_t placeholder = 0; //Try our best to defeat compiler optimizations
+    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(end_address), *begptr = static_cast<Word128_t*>(start_address); wordptr > begptr;) {
+        UNROLL256(wordptr--;) 
+        placeholder = 0;
+    }
+    return placeholder;
+}
+#endif
+
+#ifdef HAS_WORD_256
+int32_t xmem::dummy_revSequentialLoop_Word256(void* start_address, void* end_address) {
+#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
+    return win_x86_64_asm_dummy_revSequentialLoop_Word256(static_cast<Word256_t*>(end_address), static_cast<Word256_t*>(start_address));
+#endif
+#ifdef __gnu_linux__
+    volatile int32_t placeholder = 0; //Try our best to defeat compiler optimizations
+    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(end_address), *begptr = static_cast<Word256_t*>(start_address); wordptr > begptr;) {
+        UNROLL128(wordptr--;) 
+        placeholder = 0;
+    }
+    return placeholder;
+#endif
+}
+#endif
+
+#ifdef HAS_WORD_512
+#ifdef _WIN32
+int32_t xmem::dummy_revSequentialLoop_Word512(void* start_address, void* end_address) {
+#else
+//FIXME: We flag GCC/ICC not to optimize this function. The problem is that my_512b_load() -- which maps to _mm512_load_epi64 Intel AVX-512/KNC intrinsic -- cannot accept volatile* arguments. The only way to prevent the entire benchmark loop from being optimized away is to force the compiler not to optimize the function at all. Unfortunately, this will cause extra unwanted code to be included. The only solution seems to be to write inline assembly or allow eventual support for assignment of __m512i variables, e.g., val = *wordptr++; which is how the code for the other word sizes is written.
+int32_t __attribute__((optimize("O0"))) xmem::dummy_revSequentialLoop_Word512(void* start_address, void* end_address) { 
+#endif
+#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
+    //return win_x86_64_asm_dummy_revSequentialLoop_Word512(static_cast<Word512_t*>(end_address), static_cast<Word512_t*>(start_address));
+    #error 512-bit words are not currently supported on Windows.
+#endif
+#ifdef __gnu_linux__
+    volatile int32_t placeholder = 0; //Try our best to defeat compiler optimizations
+    for (Word512_t* wordptr = static_cast<Word512_t*>(end_address), *begptr = static_cast<Word512_t*>(start_address); wordptr > begptr;) {
+        UNROLL64(wordptr--;) 
+        placeholder = 0;
+    }
+    return placeholder;
+#endif
+}
+#endif
+
+/* ------------ STRIDE 2 LOOP --------------*/
+
+int32_t xmem::dummy_forwStride2Loop_Word32(void* start_address, void* end_address) {
+    register Word32_t val; 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word32_t);
+    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(start_address); i < len; i += 512) {
+        UNROLL512(wordptr += 2;)
+        if (wordptr >= static_cast<Word32_t*>(end_address)) //end, modulo
+            wordptr -= len;
+    }
+    return 0;
+}
+
+#ifdef HAS_WORD_64
+int32_t xmem::dummy_forwStride2Loop_Word64(void* start_address, void* end_address) {
+    register Word64_t val; 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word64_t);
+    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(start_address); i < len; i += 256) {
+        UNROLL256(wordptr += 2;)
+        if (wordptr >= static_cast<Word64_t*>(end_address)) //end, modulo
+            wordptr -= len;
+    }
+    return 0;
+}
+#endif
+
+#ifdef HAS_WORD_128
+int32_t xmem::dummy_forwStride2Loop_Word128(void* start_address, void* end_address) {
+#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
+    return win_x86_64_asm_dummy_forwStride2Loop_Word128(static_cast<Word128_t*>(start_address), static_cast<Word128_t*>(end_address));
+#else
+    register Word128_t val; 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word128_t);
+    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(start_address); i < len; i += 128) {
+        UNROLL128(wordptr += 2;)
+        if (wordptr >= static_cast<Word128_t*>(end_address)) //end, modulo
+            wordptr -= len;
+    }
+    return 0;
+#endif
+}
+#endif
+
+#ifdef HAS_WORD_256
+int32_t xmem::dummy_forwStride2Loop_Word256(void* start_address, void* end_address) {
+#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
+    return win_x86_64_asm_dummy_forwStride2Loop_Word256(static_cast<Word256_t*>(start_address), static_cast<Word256_t*>(end_address));
+#else
+    register Word256_t val; 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word256_t);
+    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(start_address); i < len; i += 64) {
+        UNROLL64(wordptr += 2;)
+        if (wordptr >= static_cast<Word256_t*>(end_address)) //end, modulo
+            wordptr -= len;
+    }
+    return 0;
+#endif
+}
+#endif
+
+#ifdef HAS_WORD_512
+#ifdef _WIN32
+int32_t xmem::dummy_forwStride2Loop_Word512(void* start_address, void* end_address) {
+#else
+//FIXME: We flag GCC/ICC not to optimize this function. The problem is that my_512b_load() -- which maps to _mm512_load_epi64 Intel AVX-512/KNC intrinsic -- cannot accept volatile* arguments. The only way to prevent the entire benchmark loop from being optimized away is to force the compiler not to optimize the function at all. Unfortunately, this will cause extra unwanted code to be included. The only solution seems to be to write inline assembly or allow eventual support for assignment of __m512i variables, e.g., val = *wordptr++; which is how the code for the other word sizes is written.
+int32_t __attribute__((optimize("O0"))) xmem::dummy_forwStride2Loop_Word512(void* start_address, void* end_address) { 
+#endif
+#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
+//    return win_x86_64_asm_dummy_forwStride2Loop_Word512(static_cast<Word512_t*>(start_address), static_cast<Word512_t*>(end_address));
+    #error 512-bit words are not currently supported on Windows.
+#else
+    register Word512_t val; 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word512_t);
+    for (Word512_t* wordptr = static_cast<Word512_t*>(start_address); i < len; i += 32) {
+        UNROLL32(wordptr += 2;)
+        if (wordptr >= static_cast<Word512_t*>(end_address)) //end, modulo
+            wordptr -= len;
+    }
+    return 0;
+#endif
+}
+#endif
+
+int32_t xmem::dummy_revStride2Loop_Word32(void* start_address, void* end_address) {
+    register Word32_t val; 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word32_t);
+    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(end_address); i < len; i += 512) {
+        UNROLL512(wordptr -= 2;)
+        if (wordptr <= static_cast<Word32_t*>(start_address)) //end, modulo
+            wordptr += len;
+    }
+    return 0;
+}
+
+#ifdef HAS_WORD_64
+int32_t xmem::dummy_revStride2Loop_Word64(void* start_address, void* end_address) {
+    register Word64_t val; 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word64_t);
+    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(end_address); i < len; i += 256) {
+        UNROLL256(wordptr -= 2;)
+        if (wordptr <= static_cast<Word64_t*>(start_address)) //end, modulo
+            wordptr += len;
+    }
+    return 0;
+}
+#endif
+
+#ifdef HAS_WORD_128
+int32_t xmem::dummy_revStride2Loop_Word128(void* start_address, void* end_address) {
+#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
+    return win_x86_64_asm_dummy_revStride2Loop_Word128(static_cast<Word128_t*>(end_address), static_cast<Word128_t*>(start_address));
+#else
+    register Word128_t val; 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word128_t);
+    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(end_address); i < len; i += 128) {
+        UNROLL128(wordptr -= 2;)
+        if (wordptr <= static_cast<Word128_t*>(start_address)) //end, modulo
+            wordptr += len;
+    }
+    return 0;
+#endif
+}
+#endif
+
+#ifdef HAS_WORD_256
+int32_t xmem::dummy_revStride2Loop_Word256(void* start_address, void* end_address) { 
+#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
+    return win_x86_64_asm_dummy_revStride2Loop_Word256(static_cast<Word256_t*>(end_address), static_cast<Word256_t*>(start_address));
+#else
+    register Word256_t val; 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word256_t);
+    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(end_address); i < len; i += 64) {
+        UNROLL64(wordptr -= 2;)
+        if (wordptr <= static_cast<Word256_t*>(start_address)) //end, modulo
+            wordptr += len;
+    }
+    return 0;
+#endif
+}
+#endif
+
+#ifdef HAS_WORD_512
+#ifdef _WIN32
+int32_t xmem::dummy_revStride2Loop_Word512(void* start_address, void* end_address) {
+#else
+//FIXME: We flag GCC/ICC not to optimize this function. The problem is that my_512b_load() -- which maps to _mm512_load_epi64 Intel AVX-512/KNC intrinsic -- cannot accept volatile* arguments. The only way to prevent the entire benchmark loop from being optimized away is to force the compiler not to optimize the function at all. Unfortunately, this will cause extra unwanted code to be included. The only solution seems to be to write inline assembly or allow eventual support for assignment of __m512i variables, e.g., val = *wordptr++; which is how the code for the other word sizes is written.
+int32_t __attribute__((optimize("O0"))) xmem::dummy_revStride2Loop_Word512(void* start_address, void* end_address) { 
+#endif
+#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
+    //return win_x86_64_asm_dummy_revStride2Loop_Word512(static_cast<Word512_t*>(end_address), static_cast<Word512_t*>(start_address));
+#error 512-bit words are not currently supported on Windows.
+#else
+    register Word512_t val; 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word512_t);
+    for (Word512_t* wordptr = static_cast<Word512_t*>(end_address); i < len; i += 32) {
+        UNROLL32(wordptr -= 2;)
+        if (wordptr <= static_cast<Word512_t*>(start_address)) //end, modulo
+            wordptr += len;
+    }
+    return 0;
+#endif
+}
+#endif
+
+/* ------------ STRIDE 4 LOOP --------------*/
+
+int32_t xmem::dummy_forwStride4Loop_Word32(void* start_address, void* end_address) {
+    register Word32_t val; 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word32_t);
+    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(start_address); i < len; i += 256) {
+        UNROLL256(wordptr += 4;)
+        if (wordptr >= static_cast<Word32_t*>(end_address)) //end, modulo
+            wordptr -= len;
+    }
+    return 0;
+}
+
+#ifdef HAS_WORD_64
+int32_t xmem::dummy_forwStride4Loop_Word64(void* start_address, void* end_address) {
+    register Word64_t val; 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word64_t);
+    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(start_address); i < len; i += 128) {
+        UNROLL128(wordptr += 4;)
+        if (wordptr >= static_cast<Word64_t*>(end_address)) //end, modulo
+            wordptr -= len;
+    }
+    return 0;
+}
+#endif
+
+#ifdef HAS_WORD_128
+int32_t xmem::dummy_forwStride4Loop_Word128(void* start_address, void* end_address) {
+#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
+    return win_x86_64_asm_dummy_forwStride4Loop_Word128(static_cast<Word128_t*>(start_address), static_cast<Word128_t*>(end_address));
+#else
+    register Word128_t val; 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word128_t);
+    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(start_address); i < len; i += 64) {
+        UNROLL64(wordptr += 4;)
+        if (wordptr >= static_cast<Word128_t*>(end_address)) //end, modulo
+            wordptr -= len;
+    }
+    return 0;
+#endif
+}
+#endif
+
+#ifdef HAS_WORD_256
+int32_t xmem::dummy_forwStride4Loop_Word256(void* start_address, void* end_address) {
+#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
+    return win_x86_64_asm_dummy_forwStride4Loop_Word256(static_cast<Word256_t*>(start_address), static_cast<Word256_t*>(end_address));
+#else
+    register Word256_t val; 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word256_t);
+    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(start_address); i < len; i += 32) {
+        UNROLL32(wordptr += 4;)
+        if (wordptr >= static_cast<Word256_t*>(end_address)) //end, modulo
+            wordptr -= len;
+    }
+    return 0;
+#endif
+}
+#endif
+
+#ifdef HAS_WORD_512
+#ifdef _WIN32
+int32_t xmem::dummy_forwStride4Loop_Word512(void* start_address, void* end_address) {
+#else
+//FIXME: We flag GCC/ICC not to optimize this function. The problem is that my_512b_load() -- which maps to _mm512_load_epi64 Intel AVX-512/KNC intrinsic -- cannot accept volatile* arguments. The only way to prevent the entire benchmark loop from being optimized away is to force the compiler not to optimize the function at all. Unfortunately, this will cause extra unwanted code to be included. The only solution seems to be to write inline assembly or allow eventual support for assignment of __m512i variables, e.g., val = *wordptr++; which is how the code for the other word sizes is written.
+int32_t __attribute__((optimize("O0"))) xmem::dummy_forwStride4Loop_Word512(void* start_address, void* end_address) { 
+#endif
+#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
+    //return win_x86_64_asm_dummy_forwStride4Loop_Word512(static_cast<Word512_t*>(start_address), static_cast<Word512_t*>(end_address));
+#error 512-bit words are not currently supported on Windows.
+#else
+    register Word512_t val; 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word512_t);
+    for (Word512_t* wordptr = static_cast<Word512_t*>(start_address); i < len; i += 16) {
+        UNROLL16(wordptr += 4;)
+        if (wordptr >= static_cast<Word512_t*>(end_address)) //end, modulo
+            wordptr -= len;
+    }
+    return 0;
+#endif
+}
+#endif
+
+int32_t xmem::dummy_revStride4Loop_Word32(void* start_address, void* end_address) {
+    register Word32_t val; 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word32_t);
+    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(end_address); i < len; i += 256) {
+        UNROLL256(wordptr -= 4;)
+        if (wordptr <= static_cast<Word32_t*>(start_address)) //end, modulo
+            wordptr += len;
+    }
+    return 0;
+}
+
+#ifdef HAS_WORD_64
+int32_t xmem::dummy_revStride4Loop_Word64(void* start_address, void* end_address) {
+    register Word64_t val; 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word64_t);
+    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(end_address); i < len; i += 128) {
+        UNROLL128(wordptr -= 4;)
+        if (wordptr <= static_cast<Word64_t*>(start_address)) //end, modulo
+            wordptr += len;
+    }
+    return 0;
+}
+#endif
+
+#ifdef HAS_WORD_128
+int32_t xmem::dummy_revStride4Loop_Word128(void* start_address, void* end_address) {
+#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
+    return win_x86_64_asm_dummy_revStride4Loop_Word128(static_cast<Word128_t*>(end_address), static_cast<Word128_t*>(start_address));
+#else
+    register Word128_t val; 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word128_t);
+    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(end_address); i < len; i += 64) {
+        UNROLL64(wordptr -= 4;)
+        if (wordptr <= static_cast<Word128_t*>(start_address)) //end, modulo
+            wordptr += len;
+    }
+    return 0;
+#endif
+}
+#endif
+
+#ifdef HAS_WORD_256
+int32_t xmem::dummy_revStride4Loop_Word256(void* start_address, void* end_address) {
+#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
+    return win_x86_64_asm_dummy_revStride4Loop_Word256(static_cast<Word256_t*>(end_address), static_cast<Word256_t*>(start_address));
+#else
+    register Word256_t val; 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word256_t);
+    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(end_address); i < len; i += 32) {
+        UNROLL32(wordptr -= 4;)
+        if (wordptr <= static_cast<Word256_t*>(start_address)) //end, modulo
+            wordptr += len;
+    }
+    return 0;
+#endif
+}
+#endif
+
+#ifdef HAS_WORD_512
+#ifdef _WIN32
+int32_t xmem::dummy_revStride4Loop_Word512(void* start_address, void* end_address) {
+#else
+//FIXME: We flag GCC/ICC not to optimize this function. The problem is that my_512b_load() -- which maps to _mm512_load_epi64 Intel AVX-512/KNC intrinsic -- cannot accept volatile* arguments. The only way to prevent the entire benchmark loop from being optimized away is to force the compiler not to optimize the function at all. Unfortunately, this will cause extra unwanted code to be included. The only solution seems to be to write inline assembly or allow eventual support for assignment of __m512i variables, e.g., val = *wordptr++; which is how the code for the other word sizes is written.
+int32_t __attribute__((optimize("O0"))) xmem::dummy_revStride4Loop_Word512(void* start_address, void* end_address) { 
+#endif
+#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
+    //return win_x86_64_asm_dummy_revStride4Loop_Word512(static_cast<Word512_t*>(end_address), static_cast<Word512_t*>(start_address));
+    #error 512-bit words are not currently supported on Windows.
+#else
+    register Word512_t val; 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word512_t);
+    for (Word512_t* wordptr = static_cast<Word512_t*>(end_address); i < len; i += 16) {
+        UNROLL16(wordptr -= 4;)
+        if (wordptr <= static_cast<Word512_t*>(start_address)) //end, modulo
+            wordptr += len;
+    }
+    return 0;
+#endif
+}
+#endif
+
+/* ------------ STRIDE 8 LOOP --------------*/
+
+int32_t xmem::dummy_forwStride8Loop_Word32(void* start_address, void* end_address) {
+    register Word32_t val; 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word32_t);
+    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(start_address); i < len; i += 128) {
+        UNROLL128(wordptr += 8;)
+        if (wordptr >= static_cast<Word32_t*>(end_address)) //end, modulo
+            wordptr -= len;
+    }
+    return 0;
+}
+
+#ifdef HAS_WORD_64
+int32_t xmem::dummy_forwStride8Loop_Word64(void* start_address, void* end_address) {
+    register Word64_t val; 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word64_t);
+    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(start_address); i < len; i += 64) {
+        UNROLL64(wordptr += 8;)
+        if (wordptr >= static_cast<Word64_t*>(end_address)) //end, modulo
+            wordptr -= len;
+    }
+    return 0;
+}
+#endif
+
+#ifdef HAS_WORD_128
+int32_t xmem::dummy_forwStride8Loop_Word128(void* start_address, void* end_address) {
+#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
+    return win_x86_64_asm_dummy_forwStride8Loop_Word128(static_cast<Word128_t*>(start_address), static_cast<Word128_t*>(end_address));
+#else
+    register Word128_t val; 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word128_t);
+    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(start_address); i < len; i += 32) {
+        UNROLL32(wordptr += 8;)
+        if (wordptr >= static_cast<Word128_t*>(end_address)) //end, modulo
+            wordptr -= len;
+    }
+    return 0;
+#endif
+}
+#endif
+
+#ifdef HAS_WORD_256
+int32_t xmem::dummy_forwStride8Loop_Word256(void* start_address, void* end_address) {
+#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
+    return win_x86_64_asm_dummy_forwStride8Loop_Word256(static_cast<Word256_t*>(start_address), static_cast<Word256_t*>(end_address));
+#else
+    register Word256_t val; 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word256_t);
+    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(start_address); i < len; i += 16) {
+        UNROLL16(wordptr += 8;)
+        if (wordptr >= static_cast<Word256_t*>(end_address)) //end, modulo
+            wordptr -= len;
+    }
+    return 0;
+#endif
+}
+#endif
+
+#ifdef HAS_WORD_512
+#ifdef _WIN32
+int32_t xmem::dummy_forwStride8Loop_Word512(void* start_address, void* end_address) {
+#else
+//FIXME: We flag GCC/ICC not to optimize this function. The problem is that my_512b_load() -- which maps to _mm512_load_epi64 Intel AVX-512/KNC intrinsic -- cannot accept volatile* arguments. The only way to prevent the entire benchmark loop from being optimized away is to force the compiler not to optimize the function at all. Unfortunately, this will cause extra unwanted code to be included. The only solution seems to be to write inline assembly or allow eventual support for assignment of __m512i variables, e.g., val = *wordptr++; which is how the code for the other word sizes is written.
+int32_t __attribute__((optimize("O0"))) xmem::dummy_forwStride8Loop_Word512(void* start_address, void* end_address) { 
+#endif
+#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
+    //return win_x86_64_asm_dummy_forwStride8Loop_Word512(static_cast<Word512_t*>(start_address), static_cast<Word512_t*>(end_address));
+    #error 512-bit words are not currently supported on Windows.
+#else
+    register Word512_t val; 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word512_t);
+    for (Word512_t* wordptr = static_cast<Word512_t*>(start_address); i < len; i += 8) {
+        UNROLL8(wordptr += 8;)
+        if (wordptr >= static_cast<Word512_t*>(end_address)) //end, modulo
+            wordptr -= len;
+    }
+    return 0;
+#endif
+}
+#endif
+
+int32_t xmem::dummy_revStride8Loop_Word32(void* start_address, void* end_address) { 
+    register Word32_t val; 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word32_t);
+    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(end_address); i < len; i += 128) {
+        UNROLL128(wordptr -= 8;)
+        if (wordptr <= static_cast<Word32_t*>(start_address)) //end, modulo
+            wordptr += len;
+    }
+    return 0;
+}
+
+#ifdef HAS_WORD_64
+int32_t xmem::dummy_revStride8Loop_Word64(void* start_address, void* end_address) { 
+    register Word64_t val; 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word64_t);
+    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(end_address); i < len; i += 64) {
+        UNROLL64(wordptr -= 8;)
+        if (wordptr <= static_cast<Word64_t*>(start_address)) //end, modulo
+            wordptr += len;
+    }
+    return 0;
+}
+#endif
+
+#ifdef HAS_WORD_128
+int32_t xmem::dummy_revStride8Loop_Word128(void* start_address, void* end_address) { 
+#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
+    return win_x86_64_asm_dummy_revStride8Loop_Word128(static_cast<Word128_t*>(end_address), static_cast<Word128_t*>(start_address));
+#else
+    register Word128_t val; 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word128_t);
+    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(end_address); i < len; i += 32) {
+        UNROLL32(wordptr -= 8;)
+        if (wordptr <= static_cast<Word128_t*>(start_address)) //end, modulo
+            wordptr += len;
+    }
+    return 0;
+#endif
+}
+#endif
+
+#ifdef HAS_WORD_256
+int32_t xmem::dummy_revStride8Loop_Word256(void* start_address, void* end_address) { 
+#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
+    return win_x86_64_asm_dummy_revStride8Loop_Word256(static_cast<Word256_t*>(end_address), static_cast<Word256_t*>(start_address));
+#else
+    register Word256_t val; 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word256_t);
+    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(end_address); i < len; i += 16) {
+        UNROLL16(wordptr -= 8;)
+        if (wordptr <= static_cast<Word256_t*>(start_address)) //end, modulo
+            wordptr += len;
+    }
+    return 0;
+#endif
+}
+#endif
+
+#ifdef HAS_WORD_512
+#ifdef _WIN32
+int32_t xmem::dummy_revStride8Loop_Word512(void* start_address, void* end_address) {
+#else
+//FIXME: We flag GCC/ICC not to optimize this function. The problem is that my_512b_load() -- which maps to _mm512_load_epi64 Intel AVX-512/KNC intrinsic -- cannot accept volatile* arguments. The only way to prevent the entire benchmark loop from being optimized away is to force the compiler not to optimize the function at all. Unfortunately, this will cause extra unwanted code to be included. The only solution seems to be to write inline assembly or allow eventual support for assignment of __m512i variables, e.g., val = *wordptr++; which is how the code for the other word sizes is written.
+int32_t __attribute__((optimize("O0"))) xmem::dummy_revStride8Loop_Word512(void* start_address, void* end_address) { 
+#endif
+#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
+    //return win_x86_64_asm_dummy_revStride8Loop_Word512(static_cast<Word512_t*>(end_address), static_cast<Word512_t*>(start_address));
+    #error 512-bit words are not currently supported on Windows.
+#else
+    register Word512_t val; 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word512_t);
+    for (volatile Word512_t* wordptr = static_cast<Word512_t*>(end_address); i < len; i += 8) {
+        UNROLL8(wordptr -= 8;)
+        if (wordptr <= static_cast<Word512_t*>(start_address)) //end, modulo
+            wordptr += len;
+    }
+    return 0;
+#endif
+}
+#endif
+
+/* ------------ STRIDE 16 LOOP --------------*/
+
+int32_t xmem::dummy_forwStride16Loop_Word32(void* start_address, void* end_address) { 
+    register Word32_t val; 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word32_t);
+    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(start_address); i < len; i += 64) {
+        UNROLL64(wordptr += 16;)
+        if (wordptr >= static_cast<Word32_t*>(end_address)) //end, modulo
+            wordptr -= len;
+    }
+    return 0;
+}
+
+#ifdef HAS_WORD_64
+int32_t xmem::dummy_forwStride16Loop_Word64(void* start_address, void* end_address) { 
+    register Word64_t val; 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word64_t);
+    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(start_address); i < len; i += 32) {
+        UNROLL32(wordptr += 16;)
+        if (wordptr >= static_cast<Word64_t*>(end_address)) //end, modulo
+            wordptr -= len;
+    }
+    return 0;
+}
+#endif
+
+#ifdef HAS_WORD_128
+int32_t xmem::dummy_forwStride16Loop_Word128(void* start_address, void* end_address) { 
+#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
+    return win_x86_64_asm_dummy_forwStride16Loop_Word128(static_cast<Word128_t*>(start_address), static_cast<Word128_t*>(end_address));
+#else
+    register Word128_t val; 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word128_t);
+    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(start_address); i < len; i += 16) {
+        UNROLL16(wordptr += 16;)
+        if (wordptr >= static_cast<Word128_t*>(end_address)) //end, modulo
+            wordptr -= len;
+    }
+    return 0;
+#endif
+}
+#endif
+
+#ifdef HAS_WORD_256
+int32_t xmem::dummy_forwStride16Loop_Word256(void* start_address, void* end_address) { 
+#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
+    return win_x86_64_asm_dummy_forwStride16Loop_Word256(static_cast<Word256_t*>(start_address), static_cast<Word256_t*>(end_address));
+#else
+    register Word256_t val; 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word256_t);
+    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(start_address); i < len; i += 8) {
+        UNROLL8(wordptr += 16;)
+        if (wordptr >= static_cast<Word256_t*>(end_address)) //end, modulo
+            wordptr -= len;
+    }
+    return 0;
+#endif
+}
+#endif
+
+#ifdef HAS_WORD_512
+#ifdef _WIN32
+int32_t xmem::dummy_forwStride16Loop_Word512(void* start_address, void* end_address) {
+#else
+//FIXME: We flag GCC/ICC not to optimize this function. The problem is that my_512b_load() -- which maps to _mm512_load_epi64 Intel AVX-512/KNC intrinsic -- cannot accept volatile* arguments. The only way to prevent the entire benchmark loop from being optimized away is to force the compiler not to optimize the function at all. Unfortunately, this will cause extra unwanted code to be included. The only solution seems to be to write inline assembly or allow eventual support for assignment of __m512i variables, e.g., val = *wordptr++; which is how the code for the other word sizes is written.
+int32_t __attribute__((optimize("O0"))) xmem::dummy_forwStride16Loop_Word512(void* start_address, void* end_address) { 
+#endif
+#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
+    //return win_x86_64_asm_dummy_forwStride16Loop_Word512(static_cast<Word512_t*>(start_address), static_cast<Word512_t*>(end_address));
+    #error 512-bit words are not currently supported on Windows.
+#else
+    register Word512_t val; 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word512_t);
+    for (volatile Word512_t* wordptr = static_cast<Word512_t*>(start_address); i < len; i += 4) {
+        UNROLL4(wordptr += 16;)
+        if (wordptr >= static_cast<Word512_t*>(end_address)) //end, modulo
+            wordptr -= len;
+    }
+    return 0;
+#endif
+}
+#endif
+
+int32_t xmem::dummy_revStride16Loop_Word32(void* start_address, void* end_address) { 
+    register Word32_t val; 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word32_t);
+    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(end_address); i < len; i += 64) {
+        UNROLL64(wordptr -= 16;)
+        if (wordptr <= static_cast<Word32_t*>(start_address)) //end, modulo
+            wordptr += len;
+    }
+    return 0;
+}
+
+#ifdef HAS_WORD_64
+int32_t xmem::dummy_revStride16Loop_Word64(void* start_address, void* end_address) { 
+    register Word64_t val; 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word64_t);
+    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(end_address); i < len; i += 32) {
+        UNROLL32(wordptr -= 16;)
+        if (wordptr <= static_cast<Word64_t*>(start_address)) //end, modulo
+            wordptr += len;
+    }
+    return 0;
+}
+#endif
+
+#ifdef HAS_WORD_128
+int32_t xmem::dummy_revStride16Loop_Word128(void* start_address, void* end_address) { 
+#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
+    return win_x86_64_asm_dummy_revStride16Loop_Word128(static_cast<Word128_t*>(end_address), static_cast<Word128_t*>(start_address));
+#else
+    register Word128_t val; 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word128_t);
+    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(end_address); i < len; i += 16) {
+        UNROLL16(wordptr -= 16;)
+        if (wordptr <= static_cast<Word128_t*>(start_address)) //end, modulo
+            wordptr += len;
+    }
+    return 0;
+#endif
+}
+#endif
+
+#ifdef HAS_WORD_256
+int32_t xmem::dummy_revStride16Loop_Word256(void* start_address, void* end_address) { 
+#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
+    return win_x86_64_asm_dummy_revStride16Loop_Word256(static_cast<Word256_t*>(end_address), static_cast<Word256_t*>(start_address));
+#else
+    register Word256_t val; 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word256_t);
+    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(end_address); i < len; i += 8) {
+        UNROLL8(wordptr -= 16;)
+        if (wordptr <= static_cast<Word256_t*>(start_address)) //end, modulo
+            wordptr += len;
+    }
+    return 0;
+#endif
+}
+#endif
+
+#ifdef HAS_WORD_512
+#ifdef _WIN32
+int32_t xmem::dummy_revStride16Loop_Word512(void* start_address, void* end_address) {
+#else
+//FIXME: We flag GCC/ICC not to optimize this function. The problem is that my_512b_load() -- which maps to _mm512_load_epi64 Intel AVX-512/KNC intrinsic -- cannot accept volatile* arguments. The only way to prevent the entire benchmark loop from being optimized away is to force the compiler not to optimize the function at all. Unfortunately, this will cause extra unwanted code to be included. The only solution seems to be to write inline assembly or allow eventual support for assignment of __m512i variables, e.g., val = *wordptr++; which is how the code for the other word sizes is written.
+int32_t __attribute__((optimize("O0"))) xmem::dummy_revStride16Loop_Word512(void* start_address, void* end_address) { 
+#endif
+#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
+    //return win_x86_64_asm_dummy_revStride16Loop_Word512(static_cast<Word512_t*>(end_address), static_cast<Word512_t*>(start_address));
+    #error 512-bit words are not supported on Windows.
+#else
+    register Word512_t val; 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word512_t);
+    for (volatile Word512_t* wordptr = static_cast<Word512_t*>(end_address); i < len; i += 4) {
+        UNROLL4(wordptr -= 16;)
+        if (wordptr <= static_cast<Word512_t*>(start_address)) //end, modulo
+            wordptr += len;
+    }
+    return 0;
+#endif
+}
+#endif
+
+/* ------------ SEQUENTIAL READ/WRITE MIX LOOP --------------*/
+
+int32_t xmem::dummy_forwSequentialMix1to1Loop_Word32(void* start_address, void* end_address) {
+    volatile int32_t placeholder = 0; //Try our best to defeat compiler optimizations
+    register uintptr_t lines = (reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / CACHE_LINE_SIZE;
+    Word32_t* splitptr = static_cast<Word32_t*>(start_address) + (lines - lines / 2) * (CACHE_LINE_SIZE / sizeof(Word32_t)); //The last half of the lines form the write stream
+    volatile Word32_t* readptr = static_cast<Word32_t*>(start_address);
+    for (volatile Word32_t* writeptr = splitptr, *endptr = static_cast<Word32_t*>(end_address); writeptr < endptr;) {
+        UNROLL16(readptr++;) UNROLL16(writeptr++;)
+        placeholder = 0;
+    }
+    while (readptr < splitptr) { //Leftover lines that do not make up a whole group are only read
+        UNROLL16(readptr++;)
+        placeholder = 0;
+    }
+    return placeholder;
+}
+
+#ifdef HAS_WORD_64
+int32_t xmem::dummy_forwSequentialMix1to1Loop_Word64(void* start_address, void* end_address) {
+    volatile int32_t placeholder = 0; //Try our best to defeat compiler optimizations
+    register uintptr_t lines = (reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / CACHE_LINE_SIZE;
+    Word64_t* splitptr = static_cast<Word64_t*>(start_address) + (lines - lines / 2) * (CACHE_LINE_SIZE / sizeof(Word64_t)); //The last half of the lines form the write stream
+    volatile Word64_t* readptr = static_cast<Word64_t*>(start_address);
+    for (volatile Word64_t* writeptr = splitptr, *endptr = static_cast<Word64_t*>(end_address); writeptr < endptr;) {
+        UNROLL8(readptr++;) UNROLL8(writeptr++;)
+        placeholder = 0;
+    }
+    while (readptr < splitptr) { //Leftover lines that do not make up a whole group are only read
+        UNROLL8(readptr++;)
+        placeholder = 0;
+    }
+    return placeholder;
+}
+#endif
+
+#ifdef HAS_WORD_128
+int32_t xmem::dummy_forwSequentialMix1to1Loop_Word128(void* start_address, void* end_address) {
+    volatile int32_t placeholder = 0; //Try our best to defeat compiler optimizations
+    register uintptr_t lines = (reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / CACHE_LINE_SIZE;
+    Word128_t* splitptr = static_cast<Word128_t*>(start_address) + (lines - lines / 2) * (CACHE_LINE_SIZE / sizeof(Word128_t)); //The last half of the lines form the write stream
+    volatile Word128_t* readptr = static_cast<Word128_t*>(start_address);
+    for (volatile Word128_t* writeptr = splitptr, *endptr = static_cast<Word128_t*>(end_address); writeptr < endptr;) {
+        UNROLL4(readptr++;) UNROLL4(writeptr++;)
+        placeholder = 0;
+    }
+    while (readptr < splitptr) { //Leftover lines that do not make up a whole group are only read
+        UNROLL4(readptr++;)
+        placeholder = 0;
+    }
+    return placeholder;
+}
+#endif
+
+#ifdef HAS_WORD_256
+int32_t xmem::dummy_forwSequentialMix1to1Loop_Word256(void* start_address, void* end_address) {
+    volatile int32_t placeholder = 0; //Try our best to defeat compiler optimizations
+    register uintptr_t lines = (reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / CACHE_LINE_SIZE;
+    Word256_t* splitptr = static_cast<Word256_t*>(start_address) + (lines - lines / 2) * (CACHE_LINE_SIZE / sizeof(Word256_t)); //The last half of the lines form the write stream
+    volatile Word256_t* readptr = static_cast<Word256_t*>(start_address);
+    for (volatile Word256_t* writeptr = splitptr, *endptr = static_cast<Word256_t*>(end_address); writeptr < endptr;) {
+        UNROLL2(readptr++;) UNROLL2(writeptr++;)
+        placeholder = 0;
+    }
+    while (readptr < splitptr) { //Leftover lines that do not make up a whole group are only read
+        UNROLL2(readptr++;)
+        placeholder = 0;
+    }
+    return placeholder;
+}
+#endif
+
+int32_t xmem::dummy_forwSequentialMix2to1Loop_Word32(void* start_address, void* end_address) {
+    volatile int32_t placeholder = 0; //Try our best to defeat compiler optimizations
+    register uintptr_t lines = (reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / CACHE_LINE_SIZE;
+    Word32_t* splitptr = static_cast<Word32_t*>(start_address) + (lines - lines / 3) * (CACHE_LINE_SIZE / sizeof(Word32_t)); //The last third of the lines form the write stream
+    volatile Word32_t* readptr = static_cast<Word32_t*>(start_address);
+    for (volatile Word32_t* writeptr = splitptr, *endptr = static_cast<Word32_t*>(end_address); writeptr < endptr;) {
+        UNROLL16(readptr++;) UNROLL16(readptr++;) UNROLL16(writeptr++;)
+        placeholder = 0;
+    }
+    while (readptr < splitptr) { //Leftover lines that do not make up a whole group are only read
+        UNROLL16(readptr++;)
+        placeholder = 0;
+    }
+    return placeholder;
+}
+
+#ifdef HAS_WORD_64
+int32_t xmem::dummy_forwSequentialMix2to1Loop_Word64(void* start_address, void* end_address) {
+    volatile int32_t placeholder = 0; //Try our best to defeat compiler optimizations
+    register uintptr_t lines = (reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / CACHE_LINE_SIZE;
+    Word64_t* splitptr = static_cast<Word64_t*>(start_address) + (lines - lines / 3) * (CACHE_LINE_SIZE / sizeof(Word64_t)); //The last third of the lines form the write stream
+    volatile Word64_t* readptr = static_cast<Word64_t*>(start_address);
+    for (volatile Word64_t* writeptr = splitptr, *endptr = static_cast<Word64_t*>(end_address); writeptr < endptr;) {
+        UNROLL8(readptr++;) UNROLL8(readptr++;) UNROLL8(writeptr++;)
+        placeholder = 0;
+    }
+    while (readptr < splitptr) { //Leftover lines that do not make up a whole group are only read
+        UNROLL8(readptr++;)
+        placeholder = 0;
+    }
+    return placeholder;
+}
+#endif
+
+#ifdef HAS_WORD_128
+int32_t xmem::dummy_forwSequentialMix2to1Loop_Word128(void* start_address, void* end_address) {
+    volatile int32_t placeholder = 0; //Try our best to defeat compiler optimizations
+    register uintptr_t lines = (reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / CACHE_LINE_SIZE;
+    Word128_t* splitptr = static_cast<Word128_t*>(start_address) + (lines - lines / 3) * (CACHE_LINE_SIZE / sizeof(Word128_t)); //The last third of the lines form the write stream
+    volatile Word128_t* readptr = static_cast<Word128_t*>(start_address);
+    for (volatile Word128_t* writeptr = splitptr, *endptr = static_cast<Word128_t*>(end_address); writeptr < endptr;) {
+        UNROLL4(readptr++;) UNROLL4(readptr++;) UNROLL4(writeptr++;)
+        placeholder = 0;
+    }
+    while (readptr < splitptr) { //Leftover lines that do not make up a whole group are only read
+        UNROLL4(readptr++;)
+        placeholder = 0;
+    }
+    return placeholder;
+}
+#endif
+
+#ifdef HAS_WORD_256
+int32_t xmem::dummy_forwSequentialMix2to1Loop_Word256(void* start_address, void* end_address) {
+    volatile int32_t placeholder = 0; //Try our best to defeat compiler optimizations
+    register uintptr_t lines = (reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / CACHE_LINE_SIZE;
+    Word256_t* splitptr = static_cast<Word256_t*>(start_address) + (lines - lines / 3) * (CACHE_LINE_SIZE / sizeof(Word256_t)); //The last third of the lines form the write stream
+    volatile Word256_t* readptr = static_cast<Word256_t*>(start_address);
+    for (volatile Word256_t* writeptr = splitptr, *endptr = static_cast<Word256_t*>(end_address); writeptr < endptr;) {
+        UNROLL2(readptr++;) UNROLL2(readptr++;) UNROLL2(writeptr++;)
+        placeholder = 0;
+    }
+    while (readptr < splitptr) { //Leftover lines that do not make up a whole group are only read
+        UNROLL2(readptr++;)
+        placeholder = 0;
+    }
+    return placeholder;
+}
+#endif
+
+int32_t xmem::dummy_forwSequentialMix3to1Loop_Word32(void* start_address, void* end_address) {
+    volatile int32_t placeholder = 0; //Try our best to defeat compiler optimizations
+    register uintptr_t lines = (reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / CACHE_LINE_SIZE;
+    Word32_t* splitptr = static_cast<Word32_t*>(start_address) + (lines - lines / 4) * (CACHE_LINE_SIZE / sizeof(Word32_t)); //The last quarter of the lines form the write stream
+    volatile Word32_t* readptr = static_cast<Word32_t*>(start_address);
+    for (volatile Word32_t* writeptr = splitptr, *endptr = static_cast<Word32_t*>(end_address); writeptr < endptr;) {
+        UNROLL16(readptr++;) UNROLL16(readptr++;) UNROLL16(readptr++;) UNROLL16(writeptr++;)
+        placeholder = 0;
+    }
+    while (readptr < splitptr) { //Leftover lines that do not make up a whole group are only read
+        UNROLL16(readptr++;)
+        placeholder = 0;
+    }
+    return placeholder;
+}
+
+#ifdef HAS_WORD_64
+int32_t xmem::dummy_forwSequentialMix3to1Loop_Word64(void* start_address, void* end_address) {
+    volatile int32_t placeholder = 0; //Try our best to defeat compiler optimizations
+    register uintptr_t lines = (reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / CACHE_LINE_SIZE;
+    Word64_t* splitptr = static_cast<Word64_t*>(start_address) + (lines - lines / 4) * (CACHE_LINE_SIZE / sizeof(Word64_t)); //The last quarter of the lines form the write stream
+    volatile Word64_t* readptr = static_cast<Word64_t*>(start_address);
+    for (volatile Word64_t* writeptr = splitptr, *endptr = static_cast<Word64_t*>(end_address); writeptr < endptr;) {
+        UNROLL8(readptr++;) UNROLL8(readptr++;) UNROLL8(readptr++;) UNROLL8(writeptr++;)
+        placeholder = 0;
+    }
+    while (readptr < splitptr) { //Leftover lines that do not make up a whole group are only read
+        UNROLL8(readptr++;)
+        placeholder = 0;
+    }
+    return placeholder;
+}
+#endif
+
+#ifdef HAS_WORD_128
+int32_t xmem::dummy_forwSequentialMix3to1Loop_Word128(void* start_address, void* end_address) {
+    volatile int32_t placeholder = 0; //Try our best to defeat compiler optimizations
+    register uintptr_t lines = (reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / CACHE_LINE_SIZE;
+    Word128_t* splitptr = static_cast<Word128_t*>(start_address) + (lines - lines / 4) * (CACHE_LINE_SIZE / sizeof(Word128_t)); //The last quarter of the lines form the write stream
+    volatile Word128_t* readptr = static_cast<Word128_t*>(start_address);
+    for (volatile Word128_t* writeptr = splitptr, *endptr = static_cast<Word128_t*>(end_address); writeptr < endptr;) {
+        UNROLL4(readptr++;) UNROLL4(readptr++;) UNROLL4(readptr++;) UNROLL4(writeptr++;)
+        placeholder = 0;
+    }
+    while (readptr < splitptr) { //Leftover lines that do not make up a whole group are only read
+        UNROLL4(readptr++;)
+        placeholder = 0;
+    }
+    return placeholder;
+}
+#endif
+
+#ifdef HAS_WORD_256
+int32_t xmem::dummy_forwSequentialMix3to1Loop_Word256(void* start_address, void* end_address) {
+    volatile int32_t placeholder = 0; //Try our best to defeat compiler optimizations
+    register uintptr_t lines = (reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / CACHE_LINE_SIZE;
+    Word256_t* splitptr = static_cast<Word256_t*>(start_address) + (lines - lines / 4) * (CACHE_LINE_SIZE / sizeof(Word256_t)); //The last quarter of the lines form the write stream
+    volatile Word256_t* readptr = static_cast<Word256_t*>(start_address);
+    for (volatile Word256_t* writeptr = splitptr, *endptr = static_cast<Word256_t*>(end_address); writeptr < endptr;) {
+        UNROLL2(readptr++;) UNROLL2(readptr++;) UNROLL2(readptr++;) UNROLL2(writeptr++;)
+        placeholder = 0;
+    }
+    while (readptr < splitptr) { //Leftover lines that do not make up a whole group are only read
+        UNROLL2(readptr++;)
+        placeholder = 0;
+    }
+    return placeholder;
+}
+#endif
+
+/* ------------ RANDOM LOOP --------------*/
+
+#ifndef HAS_WORD_64 //special case: 32-bit architectures
+int32_t xmem::dummy_randomLoop_Word32(uintptr_t*, uintptr_t**, size_t len) {
+    volatile uintptr_t* placeholder = NULL; //Try to defeat compiler optimizations removing this method
+    return 0;
+}
+#endif
+
+#ifdef HAS_WORD_64
+int32_t xmem::dummy_randomLoop_Word64(uintptr_t*, uintptr_t**, size_t len) {
+    volatile uintptr_t* placeholder = NULL; //Try to defeat compiler optimizations removing this method
+    return 0;
+}
+#endif
+
+#ifdef HAS_WORD_128
+int32_t xmem::dummy_randomLoop_Word128(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len) {
+#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
+    return 0; //TODO: Implement for Windows.
+#else
+    //TODO: check that the compiler generates this code correctly
+    volatile Word128_t* placeholder = reinterpret_cast<Word128_t*>(first_address);
+    register Word128_t val;
+    volatile uintptr_t val_extract;
+    val = my_64b_set_128b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF);
+
+#ifdef HAS_WORD_64
+    UNROLL256(val_extract = my_64b_extractLSB_128b(val);) //Extract 64 LSB.
+#else //special case: 32-bit machines
+    UNROLL256(val_extract = my_32b_extractLSB_128b(val);) //Extract 32 LSB.
+#endif
+
+    return 0;
+#endif
+}
+#endif
+
+#ifdef HAS_WORD_256
+int32_t xmem::dummy_randomLoop_Word256(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len) {
+#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
+    return 0; //TODO: Implement for Windows.
+#else
+    //TODO: check that the compiler generates this code correctly
+    volatile Word256_t* placeholder = reinterpret_cast<Word256_t*>(first_address);
+    register Word256_t val;
+    volatile uintptr_t val_extract;
+    val = my_64b_set_256b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF);
+
+#ifdef HAS_WORD_64
+        UNROLL128(val_extract = my_64b_extractLSB_256b(val);) //Extract 64 LSB.
+#else //special case: 32-bit machines
+        UNROLL128(val_extract = my_32b_extractLSB_256b(val);) //Extract 32 LSB.
+#endif
+
+    return 0;
+#endif
+}
+#endif
+
+#ifdef HAS_WORD_512
+#ifdef _WIN32
+int32_t xmem::dummy_randomLoop_Word512(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len) {
+#else
+//FIXME: We flag GCC/ICC not to optimize this function. The problem is that my_512b_load() -- which maps to _mm512_load_epi64 Intel AVX-512/KNC intrinsic -- cannot accept volatile* arguments. The only way to prevent the entire benchmark loop from being optimized away is to force the compiler not to optimize the function at all. Unfortunately, this will cause extra unwanted code to be included. The only solution seems to be to write inline assembly or allow eventual support for assignment of __m512i variables, e.g., val = *wordptr++; which is how the code for the other word sizes is written.
+int32_t __attribute__((optimize("O0"))) xmem::dummy_randomLoop_Word512(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len) {
+#endif
+#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
+    return 0; //TODO: Implement for Windows.
+#else
+    //TODO: check that the compiler generates this code correctly
+    volatile Word512_t* placeholder = reinterpret_cast<Word512_t*>(first_address);
+    register Word512_t val;
+    volatile uintptr_t val_extract;
+
+    uint64_t scratchptr[8];
+    my_64b_set_512b_word(val, scratchptr, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF);
+    UNROLL64(my_64b_extractLSB_512b(val_extract, scratchptr, val);) //Extract 64 LSB.
+
+    return 0;
+#endif
+}
+#endif
+
+/* -------------------- CORE BENCHMARK ROUTINES -------------------------- 
+ *
+ * These routines access the memory in different ways for each benchmark type.
+ * Optimization tricks include:
+ *   - register keyword to hint to compiler values that should not be used in memory access
+ *   - UNROLL macros to manual loop unrolling. This reduces the relative branch overhead of the loop.
+ *     We don't want to benchmark loops, we want to benchmark memory!
+ *   - volatile keyword to prevent compiler from optimizing the code and removing instructions that we need.
+ *     The compiler is too smart for its own good!
+ *   - Hardcoding stride and chunk sizes in each benchmark snippet, so that way they do not have to waste cycles being computed at runtime.
+ *     This makes code harder to maintain and to read but ensures more accurate memory benchmarking.
+ *
+ * ----------------------------------------------------------------------- */
+
+/* ------------ SEQUENTIAL READ --------------*/
+
+int32_t xmem::forwSequentialRead_Word32(void* start_address, void* end_address) {
+    register Word32_t val; 
+    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(start_address), *endptr = static_cast<Word32_t*>(end_address); wordptr < endptr;) {
+        UNROLL1024(val = *wordptr++;) 
+    }
+    return 0;
+}
+
+#ifdef HAS_WORD_64
+int32_t xmem::forwSequentialRead_Word64(void* start_address, void* end_address) {
+    register Word64_t val;
+    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(start_address), *endptr = static_cast<Word64_t*>(end_address); wordptr < endptr;) {
+        UNROLL512(val = *wordptr++;)
+    }
+    return 0;
+}
+#endif
+
+#ifdef HAS_WORD_128
+int32_t xmem::forwSequentialRead_Word128(void* start_address, void* end_address) { 
+#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
+    return win_x86_64_asm_forwSequentialRead_Word128(static_cast<Word128_t*>(start_address), static_cast<Word128_t*>(end_address));
+#else
+    register Word128_t val;
+    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(start_address), *endptr = static_cast<Word128_t*>(end_address); wordptr < endptr;) {
+        UNROLL256(val = *wordptr++;)
+    }
+    return 0;
+#endif
+}
+#endif
+
+#ifdef HAS_WORD_256
+int32_t xmem::forwSequentialRead_Word256(void* start_address, void* end_address) { 
+#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
+    return win_x86_64_asm_forwSequentialRead_Word256(static_cast<Word256_t*>(start_address), static_cast<Word256_t*>(end_address));
+#else
+    register Word256_t val;
+    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(start_address), *endptr = static_cast<Word256_t*>(end_address); wordptr < endptr;) {
+        UNROLL128(val = *wordptr++;)
+    }
+    return 0;
+#endif
+}
+#endif
+
+#ifdef HAS_WORD_512
+#ifdef _WIN32
+int32_t xmem::forwSequentialRead_Word512(void* start_address, void* end_address) {
+#else
+//FIXME: We flag GCC/ICC not to optimize this function. The problem is that my_512b_load() -- which maps to _mm512_load_epi64 Intel AVX-512/KNC intrinsic -- cannot accept volatile* arguments. The only way to prevent the entire benchmark loop from being optimized away is to force the compiler not to optimize the function at all. Unfortunately, this will cause extra unwanted code to be included. The only solution seems to be to write inline assembly or allow eventual support for assignment of __m512i variables, e.g., val = *wordptr++; which is how the code for the other word sizes is written.
+int32_t __attribute__((optimize("O0"))) xmem::forwSequentialRead_Word512(void* start_address, void* end_address) { 
+#endif
+#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
+//    return win_x86_64_asm_forwSequentialRead_Word512(static_cast<Word512_t*>(start_address), static_cast<Word512_t*>(end_address));
+    #error 512-bit words are not supported on Windows.
+#else
+    register Word512_t val;
+    //for (volatile Word512_t* wordptr = static_cast<Word512_t*>(start_address), *endptr = static_cast<Word512_t*>(end_address); wordptr < endptr;) {
+    for (Word512_t* wordptr = static_cast<Word512_t*>(start_address), *endptr = static_cast<Word512_t*>(end_address); wordptr < endptr;) {
+        //UNROLL64(val = *wordptr++;)
+        UNROLL64(val = my_512b_load(wordptr++);)
+    }
+    return 0;
+#endif
+}
+#endif
+
+int32_t xmem::revSequentialRead_Word32(void* start_address, void* end_address) { 
+    register Word32_t val;
+    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(end_address), *begptr = static_cast<Word32_t*>(start_address); wordptr > begptr;) {
+        UNROLL1024(val = *wordptr--;)
+    }
+    return 0;
+}
+
+#ifdef HAS_WORD_64
+int32_t xmem::revSequentialRead_Word64(void* start_address, void* end_address) {
+    register Word64_t val;
+    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(end_address), *begptr = static_cast<Word64_t*>(start_address); wordptr > begptr;) {
+        UNROLL512(val = *wordptr--;)
+    }
+    return 0;
+}
+#endif
+
+#ifdef HAS_WORD_128
+int32_t xmem::revSequentialRead_Word128(void* start_address, void* end_address) { 
+#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
+    return win_x86_64_asm_revSequentialRead_Word128(static_cast<Word128_t*>(end_address), static_cast<Word128_t*>(start_address));
+#else
+    register Word128_t val;
+    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(end_address), *begptr = static_cast<Word128_t*>(start_address); wordptr > begptr;) {
+        UNROLL256(val = *wordptr--;)
+    }
+    return 0;
+#endif
+}
+#endif
+
+#ifdef HAS_WORD_256
+int32_t xmem::revSequentialRead_Word256(void* start_address, void* end_address) {
+#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
+    return win_x86_64_asm_revSequentialRead_Word256(static_cast<Word256_t*>(end_address), static_cast<Word256_t*>(start_address));
+#else
+    register Word256_t val;
+    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(end_address), *begptr = static_cast<Word256_t*>(start_address); wordptr > begptr;) {
+        UNROLL128(val = *wordptr--;)
+    }
+    return 0;
+#endif
+}
+#endif
+
+#ifdef HAS_WORD_512
+#ifdef _WIN32
+int32_t xmem::revSequentialRead_Word512(void* start_address, void* end_address) {
+#else
+//FIXME: We flag GCC/ICC not to optimize this function. The problem is that my_512b_load() -- which maps to _mm512_load_epi64 Intel AVX-512/KNC intrinsic -- cannot accept volatile* arguments. The only way to prevent the entire benchmark loop from being optimized away is to force the compiler not to optimize the function at all. Unfortunately, this will cause extra unwanted code to be included. The only solution seems to be to write inline assembly or allow eventual support for assignment of __m512i variables, e.g., val = *wordptr++; which is how the code for the other word sizes is written.
+int32_t __attribute__((optimize("O0"))) xmem::revSequentialRead_Word512(void* start_address, void* end_address) { 
+#endif
+#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
+    //return win_x86_64_asm_revSequentialRead_Word512(static_cast<Word512_t*>(end_address), static_cast<Word512_t*>(start_address));
+    #error 512-bit words are not supported on Windows.
+#else
+    register Word512_t val;
+    //for (volatile Word512_t* wordptr = static_cast<Word512_t*>(end_address), *begptr = static_cast<Word512_t*>(start_address); wordptr > begptr;) {
+    for (Word512_t* wordptr = static_cast<Word512_t*>(end_address), *begptr = static_cast<Word512_t*>(start_address); wordptr > begptr;) {
+        //UNROLL64(val = *wordptr--;)
+        UNROLL64(val = my_512b_load(wordptr--);)
+    }
+    return 0;
+#endif
+}
+#endif
+
+/* ------------ SEQUENTIAL WRITE --------------*/
+
+int32_t xmem::forwSequentialWrite_Word32(void* start_address, void* end_address) {
+    register Word32_t val = 0xFFFFFFFF; 
+    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(start_address), *endptr = static_cast<Word32_t*>(end_address); wordptr < endptr;) {
+        UNROLL1024(*wordptr++ = val;) 
+    }
+    return 0;
+}
+
+#ifdef HAS_WORD_64
+int32_t xmem::forwSequentialWrite_Word64(void* start_address, void* end_address) {
+    register Word64_t val = 0xFFFFFFFFFFFFFFFF; 
+    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(start_address), *endptr = static_cast<Word64_t*>(end_address); wordptr < endptr;) {
+        UNROLL512(*wordptr++ = val;) 
+    }
+    return 0;
+}
+#endif
+
+#ifdef HAS_WORD_128
+int32_t xmem::forwSequentialWrite_Word128(void* start_address, void* end_address) { 
+#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
+    return win_x86_64_asm_forwSequentialWrite_Word128(static_cast<Word128_t*>(start_address), static_cast<Word128_t*>(end_address));
+#else
+    register Word128_t val;
+    val = my_64b_set_128b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF);
+    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(start_address), *endptr = static_cast<Word128_t*>(end_address); wordptr < endptr;) {
+        UNROLL256(*wordptr++ = val;) 
+    }
+    return 0;
+#endif
+}
+#endif
+
+#ifdef HAS_WORD_256
+int32_t xmem::forwSequentialWrite_Word256(void* start_address, void* end_address) {
+#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
+    return win_x86_64_asm_forwSequentialWrite_Word256(static_cast<Word256_t*>(start_address), static_cast<Word256_t*>(end_address));
+#else
+    register Word256_t val;
+    val = my_64b_set_256b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF);
+    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(start_address), *endptr = static_cast<Word256_t*>(end_address); wordptr < endptr;) {
+        UNROLL128(*wordptr++ = val;) 
+    }
+    return 0;
+#endif
+}
+#endif
+
+#ifdef HAS_WORD_512
+#ifdef _WIN32
+int32_t xmem::forwSequentialWrite_Word512(void* start_address, void* end_address) {
+#else
+//FIXME: We flag GCC/ICC not to optimize this function. The problem is that my_512b_load() -- which maps to _mm512_load_epi64 Intel AVX-512/KNC intrinsic -- cannot accept volatile* arguments. The only way to prevent the entire benchmark loop from being optimized away is to force the compiler not to optimize the function at all. Unfortunately, this will cause extra unwanted code to be included. The only solution seems to be to write inline assembly or allow eventual support for assignment of __m512i variables, e.g., val = *wordptr++; which is how the code for the other word sizes is written.
+int32_t __attribute__((optimize("O0"))) xmem::forwSequentialWrite_Word512(void* start_address, void* end_address) { 
+#endif
+#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
+    //return win_x86_64_asm_forwSequentialWrite_Word512(static_cast<Word512_t*>(start_address), static_cast<Word512_t*>(end_address));
+    #error 512-bit words are not supported on Windows.
+#else
+    register Word512_t val;
+    uint64_t scratchptr[8] __attribute__ ((aligned(512)));
+    my_64b_set_512b_word(val, scratchptr, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF);
+    for (Word512_t* wordptr = static_cast<Word512_t*>(start_address), *endptr = static_cast<Word512_t*>(end_address); wordptr < endptr;) {
+        UNROLL64(*wordptr++ = val;) 
+    }
+    return 0;
+#endif
+}
+#endif
+
+int32_t xmem::revSequentialWrite_Word32(void* start_address, void* end_address) {
+    register Word32_t val = 0xFFFFFFFF;
+    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(end_address), *begptr = static_cast<Word32_t*>(start_address); wordptr > begptr;) {
+        UNROLL1024(*wordptr-- = val;)
+    }
+    return 0;
+}
+
+#ifdef HAS_WORD_64
+int32_t xmem::revSequentialWrite_Word64(void* start_address, void* end_address) {
+    register Word64_t val = 0xFFFFFFFFFFFFFFFF;
+    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(end_address), *begptr = static_cast<Word64_t*>(start_address); wordptr > begptr;) {
+        UNROLL512(*wordptr-- = val;)
+    }
+    return 0;
+}
+#endif
+
+#ifdef HAS_WORD_128
+int32_t xmem::revSequentialWrite_Word128(void* start_address, void* end_address) { 
+#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
+    return win_x86_64_asm_revSequentialWrite_Word128(static_cast<Word128_t*>(end_address), static_cast<Word128_t*>(start_address));
+#else
+    register Word128_t val;
+    val = my_64b_set_128b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF);
+    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(end_address), *begptr = static_cast<Word128_t*>(start_address); wordptr > begptr;) {
+        UNROLL256(*wordptr-- = val;)
+    }
+    return 0;
+#endif
+}
+#endif
+
+#ifdef HAS_WORD_256
+int32_t xmem::revSequentialWrite_Word256(void* start_address, void* end_address) {
+#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
+    return win_x86_64_asm_revSequentialWrite_Word256(static_cast<Word256_t*>(end_address), static_cast<Word256_t*>(start_address));
+#else
+    register Word256_t val;
+    val = my_64b_set_256b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF);
+    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(end_address), *begptr = static_cast<Word256_t*>(start_address); wordptr > begptr;) {
+        UNROLL128(*wordptr-- = val;)
+    }
+    return 0;
+#endif
+}
+#endif
+
+#ifdef HAS_WORD_512
+#ifdef _WIN32
+int32_t xmem::revSequentialWrite_Word512(void* start_address, void* end_address) {
+#else
+//FIXME: We flag GCC/ICC not to optimize this function. The problem is that my_512b_load() -- which maps to _mm512_load_epi64 Intel AVX-512/KNC intrinsic -- cannot accept volatile* arguments. The only way to prevent the entire benchmark loop from being optimized away is to force the compiler not to optimize the function at all. Unfortunately, this will cause extra unwanted code to be included. The only solution seems to be to write inline assembly or allow eventual support for assignment of __m512i variables, e.g., val = *wordptr++; which is how the code for the other word sizes is written.
+int32_t __attribute__((optimize("O0"))) xmem::revSequentialWrite_Word512(void* start_address, void* end_address) { 
+#endif
+#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
+    //return win_x86_64_asm_revSequentialWrite_Word512(static_cast<Word512_t*>(end_address), static_cast<Word512_t*>(start_address));
+    #error 512-bit words are not supported on Windows.
+#else
+    register Word512_t val;
+    uint64_t scratchptr[8] __attribute__ ((aligned(512)));
+    my_64b_set_512b_word(val, scratchptr, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF);
+    for (Word512_t* wordptr = static_cast<Word512_t*>(end_address), *begptr = static_cast<Word512_t*>(start_address); wordptr > begptr;) {
+        UNROLL64(*wordptr-- = val;)
+    }
+    return 0;
+#endif
+}
+#endif
+
+/* ------------ STRIDE 2 READ --------------*/
+
+int32_t xmem::forwStride2Read_Word32(void* start_address, void* end_address) {
+    register Word32_t val; 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word32_t);
+    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(start_address); i < len; i += 512) {
+        UNROLL512(val = *wordptr; wordptr += 2;) 
+        if (wordptr >= static_cast<Word32_t*>(end_address)) //end, modulo
+            wordptr -= len;
+    }
+    return 0;
+}
+
+#ifdef HAS_WORD_64
+int32_t xmem::forwStride2Read_Word64(void* start_address, void* end_address) { 
+    register Word64_t val; 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word64_t);
+    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(start_address); i < len; i += 256) {
+        UNROLL256(val = *wordptr; wordptr += 2;) 
+        if (wordptr >= static_cast<Word64_t*>(end_address)) //end, modulo
+            wordptr -= len;
+    }
+    return 0;
+}
+#endif
+
+#ifdef HAS_WORD_128
+int32_t xmem::forwStride2Read_Word128(void* start_address, void* end_address) { 
+#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
+    return win_x86_64_asm_forwStride2Read_Word128(static_cast<Word128_t*>(start_address), static_cast<Word128_t*>(end_address));
+#else
+    register Word128_t val; 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word128_t);
+    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(start_address); i < len; i += 128) {
+        UNROLL128(val = *wordptr; wordptr += 2;) 
+        if (wordptr >= static_cast<Word128_t*>(end_address)) //end, modulo
+            wordptr -= len;
+    }
+    return 0;
+#endif
+}
+#endif
+
+#ifdef HAS_WORD_256
+int32_t xmem::forwStride2Read_Word256(void* start_address, void* end_address) { 
+#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
+    return win_x86_64_asm_forwStride2Read_Word256(static_cast<Word256_t*>(start_address), static_cast<Word256_t*>(end_address));
+#else
+    register Word256_t val; 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word256_t);
+    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(start_address); i < len; i += 64) {
+        UNROLL64(val = *wordptr; wordptr += 2;) 
+        if (wordptr >= static_cast<Word256_t*>(end_address)) //end, modulo
+            wordptr -= len;
+    }
+    return 0;
+#endif
+}
+#endif
+
+#ifdef HAS_WORD_512
+#ifdef _WIN32
+int32_t xmem::forwStride2Read_Word512(void* start_address, void* end_address) {
+#else
+//FIXME: We flag GCC/ICC not to optimize this function. The problem is that my_512b_load() -- which maps to _mm512_load_epi64 Intel AVX-512/KNC intrinsic -- cannot accept volatile* arguments. The only way to prevent the entire benchmark loop from being optimized away is to force the compiler not to optimize the function at all. Unfortunately, this will cause extra unwanted code to be included. The only solution seems to be to write inline assembly or allow eventual support for assignment of __m512i variables, e.g., val = *wordptr++; which is how the code for the other word sizes is written.
+int32_t __attribute__((optimize("O0"))) xmem::forwStride2Read_Word512(void* start_address, void* end_address) { 
+#endif
+#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
+    //return win_x86_64_asm_forwStride2Read_Word512(static_cast<Word256_t*>(start_address), static_cast<Word256_t*>(end_address));
+    #error 512-bit words are not supported on Windows.
+#else
+    register Word512_t val; 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word512_t);
+    //for (volatile Word512_t* wordptr = static_cast<Word512_t*>(start_address); i < len; i += 32) {
+    for (Word512_t* wordptr = static_cast<Word512_t*>(start_address); i < len; i += 32) {
+        //UNROLL32(val = *wordptr; wordptr += 2;) 
+        UNROLL32(val = my_512b_load(wordptr); wordptr += 2;) 
+        if (wordptr >= static_cast<Word512_t*>(end_address)) //end, modulo
+            wordptr -= len;
+    }
+    return 0;
+#endif
+}
+#endif
+
+int32_t xmem::revStride2Read_Word32(void* start_address, void* end_address) {
+    register Word32_t val; 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word32_t);
+    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(end_address); i < len; i += 512) {
+        UNROLL512(val = *wordptr; wordptr -= 2;) 
+        if (wordptr <= static_cast<Word32_t*>(start_address)) //end, modulo
+            wordptr += len;
+    }
+    return 0;
+}
+
+#ifdef HAS_WORD_64
+int32_t xmem::revStride2Read_Word64(void* start_address, void* end_address) { 
+    register Word64_t val; 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word64_t);
+    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(end_address); i < len; i += 256) {
+        UNROLL256(val = *wordptr; wordptr -= 2;)
+        if (wordptr <= static_cast<Word64_t*>(start_address)) //end, modulo
+            wordptr += len;
+    }
+    return 0;
+}
+#endif
+
+#ifdef HAS_WORD_128
+int32_t xmem::revStride2Read_Word128(void* start_address, void* end_address) { 
+#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
+    return win_x86_64_asm_revStride2Read_Word128(static_cast<Word128_t*>(end_address), static_cast<Word128_t*>(start_address));
+#else
+    register Word128_t val; 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word128_t);
+    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(end_address); i < len; i += 128) {
+        UNROLL128(val = *wordptr; wordptr -= 2;)
+        if (wordptr <= static_cast<Word128_t*>(start_address)) //end, modulo
+            wordptr += len;
+    }
+    return 0;
+#endif
+}
+#endif
+
+#ifdef HAS_WORD_256
+int32_t xmem::revStride2Read_Word256(void* start_address, void* end_address) { 
+#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
+    return win_x86_64_asm_revStride2Read_Word256(static_cast<Word256_t*>(end_address), static_cast<Word256_t*>(start_address));
+#else
+    register Word256_t val; 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word256_t);
+    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(end_address); i < len; i += 64) {
+        UNROLL64(val = *wordptr; wordptr -= 2;)
+        if (wordptr <= static_cast<Word256_t*>(start_address)) //end, modulo
+            wordptr += len;
+    }
+    return 0;
+#endif
+}
+#endif
+
+#ifdef HAS_WORD_512
+#ifdef _WIN32
+int32_t xmem::revStride2Read_Word512(void* start_address, void* end_address) {
+#else
+//FIXME: We flag GCC/ICC not to optimize this function. The problem is that my_512b_load() -- which maps to _mm512_load_epi64 Intel AVX-512/KNC intrinsic -- cannot accept volatile* arguments. The only way to prevent the entire benchmark loop from being optimized away is to force the compiler not to optimize the function at all. Unfortunately, this will cause extra unwanted code to be included. The only solution seems to be to write inline assembly or allow eventual support for assignment of __m512i variables, e.g., val = *wordptr++; which is how the code for the other word sizes is written.
+int32_t __attribute__((optimize("O0"))) xmem::revStride2Read_Word512(void* start_address, void* end_address) { 
+#endif
+#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
+    //return win_x86_64_asm_revStride2Read_Word512(static_cast<Word512_t*>(end_address), static_cast<Word512_t*>(start_address));
+    #error 512-bit words are not supported on Windows.
+#else
+    register Word512_t val; 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word512_t);
+    //for (volatile Word512_t* wordptr = static_cast<Word512_t*>(end_address); i < len; i += 32) {
+    for (Word512_t* wordptr = static_cast<Word512_t*>(end_address); i < len; i += 32) {
+        //UNROLL32(val = *wordptr; wordptr -= 2;)
+        UNROLL32(val = my_512b_load(wordptr); wordptr -= 2;)
+        if (wordptr <= static_cast<Word512_t*>(start_address)) //end, modulo
+            wordptr += len;
+    }
+    return 0;
+#endif
+}
+#endif
+
+/* ------------ STRIDE 2 WRITE --------------*/
+
+int32_t xmem::forwStride2Write_Word32(void* start_address, void* end_address) {
+    register Word32_t val = 0xFFFFFFFF; 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word32_t);
+    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(start_address); i < len; i += 512) {
+        UNROLL512(*wordptr = val; wordptr += 2;)
+        if (wordptr >= static_cast<Word32_t*>(end_address)) //end, modulo
+            wordptr -= len;
+    }
+    return 0;
+}
+
+#ifdef HAS_WORD_64
+int32_t xmem::forwStride2Write_Word64(void* start_address, void* end_address) {
+    register Word64_t val = 0xFFFFFFFFFFFFFFFF; 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word64_t);
+    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(start_address); i < len; i += 256) {
+        UNROLL256(*wordptr = val; wordptr += 2;)
+        if (wordptr >= static_cast<Word64_t*>(end_address)) //end, modulo
+            wordptr -= len;
+    }
+    return 0;
+}
+#endif
+
+#ifdef HAS_WORD_128
+int32_t xmem::forwStride2Write_Word128(void* start_address, void* end_address) { 
+#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
+    return win_x86_64_asm_forwStride2Write_Word128(static_cast<Word128_t*>(start_address), static_cast<Word128_t*>(end_address));
+#else
+    register Word128_t val;
+    val = my_64b_set_128b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF);
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word128_t);
+    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(start_address); i < len; i += 128) {
+        UNROLL128(*wordptr = val; wordptr += 2;)
+        if (wordptr >= static_cast<Word128_t*>(end_address)) //end, modulo
+            wordptr -= len;
+    }
+    return 0;
+#endif
+}
+#endif
+
+#ifdef HAS_WORD_256
+int32_t xmem::forwStride2Write_Word256(void* start_address, void* end_address) { 
+#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
+    return win_x86_64_asm_forwStride2Write_Word256(static_cast<Word256_t*>(start_address), static_cast<Word256_t*>(end_address));
+#else
+    register Word256_t val;
+    val = my_64b_set_256b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF);
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word256_t);
+    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(start_address); i < len; i += 64) {
+        UNROLL64(*wordptr = val; wordptr += 2;)
+        if (wordptr >= static_cast<Word256_t*>(end_address)) //end, modulo
+            wordptr -= len;
+    }
+    return 0;
+#endif
+}
+#endif
+
+#ifdef HAS_WORD_512
+#ifdef _WIN32
+int32_t xmem::forwStride2Write_Word512(void* start_address, void* end_address) {
+#else
+//FIXME: We flag GCC/ICC not to optimize this function. The problem is that my_512b_load() -- which maps to _mm512_load_epi64 Intel AVX-512/KNC intrinsic -- cannot accept volatile* arguments. The only way to prevent the entire benchmark loop from being optimized away is to force the compiler not to optimize the function at all. Unfortunately, this will cause extra unwanted code to be included. The only solution seems to be to write inline assembly or allow eventual support for assignment of __m512i variables, e.g., val = *wordptr++; which is how the code for the other word sizes is written.
+int32_t __attribute__((optimize("O0"))) xmem::forwStride2Write_Word512(void* start_address, void* end_address) { 
+#endif
+#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
+    //return win_x86_64_asm_forwStride2Write_Word512(static_cast<Word512_t*>(start_address), static_cast<Word512_t*>(end_address));
+    #error 512-bit words are not supported on Windows.
+#else
+    register Word512_t val;
+    uint64_t scratchptr[8] __attribute__ ((aligned(512)));
+    my_64b_set_512b_word(val, scratchptr, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF);
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word512_t);
+    for (Word512_t* wordptr = static_cast<Word512_t*>(start_address); i < len; i += 32) {
+        UNROLL32(*wordptr = val; wordptr += 2;)
+        if (wordptr >= static_cast<Word512_t*>(end_address)) //end, modulo
+            wordptr -= len;
+    }
+    return 0;
+#endif
+}
+#endif
+
+int32_t xmem::revStride2Write_Word32(void* start_address, void* end_address) { 
+    register Word32_t val = 0xFFFFFFFF; 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word32_t);
+    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(end_address); i < len; i += 512) {
+        UNROLL512(*wordptr = val; wordptr -= 2;)
+        if (wordptr <= static_cast<Word32_t*>(start_address)) //end, modulo
+            wordptr += len;
+    }
+    return 0;
+}
+
+#ifdef HAS_WORD_64
+int32_t xmem::revStride2Write_Word64(void* start_address, void* end_address) { 
+    register Word64_t val = 0xFFFFFFFFFFFFFFFF; 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word64_t);
+    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(end_address); i < len; i += 256) {
+        UNROLL256(*wordptr = val; wordptr -= 2;)
+        if (wordptr <= static_cast<Word64_t*>(start_address)) //end, modulo
+            wordptr += len;
+    }
+    return 0;
+}
+#endif
+
+#ifdef HAS_WORD_128
+int32_t xmem::revStride2Write_Word128(void* start_address, void* end_address) { 
+#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
+    return win_x86_64_asm_revStride2Write_Word128(static_cast<Word128_t*>(end_address), static_cast<Word128_t*>(start_address));
+#else
+    register Word128_t val;
+    val = my_64b_set_128b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF); 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word128_t);
+    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(end_address); i < len; i += 128) {
+        UNROLL128(*wordptr = val; wordptr -= 2;)
+        if (wordptr <= static_cast<Word128_t*>(start_address)) //end, modulo
+            wordptr += len;
+    }
+    return 0;
+#endif
+}
+#endif
+
+#ifdef HAS_WORD_256
+int32_t xmem::revStride2Write_Word256(void* start_address, void* end_address) { 
+#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
+    return win_x86_64_asm_revStride2Write_Word256(static_cast<Word256_t*>(end_address), static_cast<Word256_t*>(start_address));
+#else
+    register Word256_t val;
+    val = my_64b_set_256b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF); 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word256_t);
+    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(end_address); i < len; i += 64) {
+        UNROLL64(*wordptr = val; wordptr -= 2;)
+        if (wordptr <= static_cast<Word256_t*>(start_address)) //end, modulo
+            wordptr += len;
+    }
+    return 0;
+#endif
+}
+#endif
+
+#ifdef HAS_WORD_512
+#ifdef _WIN32
+int32_t xmem::revStride2Write_Word512(void* start_address, void* end_address) {
+#else
+//FIXME: We flag GCC/ICC not to optimize this function. The problem is that my_512b_load() -- which maps to _mm512_load_epi64 Intel AVX-512/KNC intrinsic -- cannot accept volatile* arguments. The only way to prevent the entire benchmark loop from being optimized away is to force the compiler not to optimize the function at all. Unfortunately, this will cause extra unwanted code to be included. The only solution seems to be to write inline assembly or allow eventual support for assignment of __m512i variables, e.g., val = *wordptr++; which is how the code for the other word sizes is written.
+int32_t __attribute__((optimize("O0"))) xmem::revStride2Write_Word512(void* start_address, void* end_address) { 
+#endif
+#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
+    //return win_x86_64_asm_forwStride2Write_Word512(static_cast<Word512_t*>(start_address), static_cast<Word512_t*>(end_address));
+    #error 512-bit words are not supported on Windows.
+#else
+    register Word512_t val;
+    uint64_t scratchptr[8] __attribute__ ((aligned(512)));
+    my_64b_set_512b_word(val, scratchptr, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF);
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word512_t);
+    for (Word512_t* wordptr = static_cast<Word512_t*>(start_address); i < len; i += 32) {
+        UNROLL32(*wordptr = val; wordptr += 2;)
+        if (wordptr >= static_cast<Word512_t*>(end_address)) //end, modulo
+            wordptr -= len;
+    }
+    return 0;
+#endif
+}
+#endif
+
+/* ------------ STRIDE 4 READ --------------*/
+
+int32_t xmem::forwStride4Read_Word32(void* start_address, void* end_address) {
+    register Word32_t val; 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word32_t);
+    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(start_address); i < len; i += 256) {
+        UNROLL256(val = *wordptr; wordptr += 4;) 
+        if (wordptr >= static_cast<Word32_t*>(end_address)) //end, modulo
+            wordptr -= len;
+    }
+    return 0;
+}
+
+#ifdef HAS_WORD_64
+int32_t xmem::forwStride4Read_Word64(void* start_address, void* end_address) { 
+    register Word64_t val; 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word64_t);
+    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(start_address); i < len; i += 128) {
+        UNROLL128(val = *wordptr; wordptr += 4;) 
+        if (wordptr >= static_cast<Word64_t*>(end_address)) //end, modulo
+            wordptr -= len;
+    }
+    return 0;
+}
+#endif
+
+#ifdef HAS_WORD_128
+int32_t xmem::forwStride4Read_Word128(void* start_address, void* end_address) { 
+#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
+    return win_x86_64_asm_forwStride4Read_Word128(static_cast<Word128_t*>(start_address), static_cast<Word128_t*>(end_address));
+#else
+    register Word128_t val; 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word128_t);
+    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(start_address); i < len; i += 64) {
+        UNROLL64(val = *wordptr; wordptr += 4;) 
+        if (wordptr >= static_cast<Word128_t*>(end_address)) //end, modulo
+            wordptr -= len;
+    }
+    return 0;
+#endif
+}
+#endif
+
+#ifdef HAS_WORD_256
+int32_t xmem::forwStride4Read_Word256(void* start_address, void* end_address) { 
+#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
+    return win_x86_64_asm_forwStride4Read_Word256(static_cast<Word256_t*>(start_address), static_cast<Word256_t*>(end_address));
+#else
+    register Word256_t val; 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word256_t);
+    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(start_address); i < len; i += 32) {
+        UNROLL32(val = *wordptr; wordptr += 4;) 
+        if (wordptr >= static_cast<Word256_t*>(end_address)) //end, modulo
+            wordptr -= len;
+    }
+    return 0;
+#endif
+}
+#endif
+
+#ifdef HAS_WORD_512
+#ifdef _WIN32
+int32_t xmem::forwStride4Read_Word512(void* start_address, void* end_address) {
+#else
+//FIXME: We flag GCC/ICC not to optimize this function. The problem is that my_512b_load() -- which maps to _mm512_load_epi64 Intel AVX-512/KNC intrinsic -- cannot accept volatile* arguments. The only way to prevent the entire benchmark loop from being optimized away is to force the compiler not to optimize the function at all. Unfortunately, this will cause extra unwanted code to be included. The only solution seems to be to write inline assembly or allow eventual support for assignment of __m512i variables, e.g., val = *wordptr++; which is how the code for the other word sizes is written.
+int32_t __attribute__((optimize("O0"))) xmem::forwStride4Read_Word512(void* start_address, void* end_address) { 
+#endif
+#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
+    //return win_x86_64_asm_forwStride4Read_Word512(static_cast<Word512_t*>(start_address), static_cast<Word512_t*>(end_address));
+    #error 512-bit words are not supported on Windows.
+#else
+    register Word512_t val; 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word512_t);
+    //for (volatile Word512_t* wordptr = static_cast<Word512_t*>(start_address); i < len; i += 16) {
+    for (Word512_t* wordptr = static_cast<Word512_t*>(start_address); i < len; i += 16) {
+        //UNROLL16(val = *wordptr; wordptr += 4;) 
+        UNROLL16(val = my_512b_load(wordptr); wordptr += 4;) 
+        if (wordptr >= static_cast<Word512_t*>(end_address)) //end, modulo
+            wordptr -= len;
+    }
+    return 0;
+#endif
+}
+#endif
+
+int32_t xmem::revStride4Read_Word32(void* start_address, void* end_address) {
+    register Word32_t val; 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word32_t);
+    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(end_address); i < len; i += 256) {
+        UNROLL256(val = *wordptr; wordptr -= 4;) 
+        if (wordptr <= static_cast<Word32_t*>(start_address)) //end, modulo
+            wordptr += len;
+    }
+    return 0;
+}
+
+#ifdef HAS_WORD_64
+int32_t xmem::revStride4Read_Word64(void* start_address, void* end_address) { 
+    register Word64_t val; 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word64_t);
+    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(end_address); i < len; i += 128) {
+        UNROLL128(val = *wordptr; wordptr -= 4;)
+        if (wordptr <= static_cast<Word64_t*>(start_address)) //end, modulo
+            wordptr += len;
+    }
+    return 0;
+}
+#endif
+
+#ifdef HAS_WORD_128
+int32_t xmem::revStride4Read_Word128(void* start_address, void* end_address) { 
+#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
+    return win_x86_64_asm_revStride4Read_Word128(static_cast<Word128_t*>(end_address), static_cast<Word128_t*>(start_address));
+#else
+    register Word128_t val; 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word128_t);
+    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(end_address); i < len; i += 64) {
+        UNROLL64(val = *wordptr; wordptr -= 4;)
+        if (wordptr <= static_cast<Word128_t*>(start_address)) //end, modulo
+            wordptr += len;
+    }
+    return 0;
+#endif
+}
+#endif
+
+#ifdef HAS_WORD_256
+int32_t xmem::revStride4Read_Word256(void* start_address, void* end_address) { 
+#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
+    return win_x86_64_asm_revStride4Read_Word256(static_cast<Word256_t*>(end_address), static_cast<Word256_t*>(start_address));
+#else
+    register Word256_t val; 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word256_t);
+    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(end_address); i < len; i += 32) {
+        UNROLL32(val = *wordptr; wordptr -= 4;)
+        if (wordptr <= static_cast<Word256_t*>(start_address)) //end, modulo
+            wordptr += len;
+    }
+    return 0;
+#endif
+}
+#endif
+
+#ifdef HAS_WORD_512
+#ifdef _WIN32
+int32_t xmem::revStride4Read_Word512(void* start_address, void* end_address) {
+#else
+//FIXME: We flag GCC/ICC not to optimize this function. The problem is that my_512b_load() -- which maps to _mm512_load_epi64 Intel AVX-512/KNC intrinsic -- cannot accept volatile* arguments. The only way to prevent the entire benchmark loop from being optimized away is to force the compiler not to optimize the function at all. Unfortunately, this will cause extra unwanted code to be included. The only solution seems to be to write inline assembly or allow eventual support for assignment of __m512i variables, e.g., val = *wordptr++; which is how the code for the other word sizes is written.
+int32_t __attribute__((optimize("O0"))) xmem::revStride4Read_Word512(void* start_address, void* end_address) { 
+#endif
+#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
+    //return win_x86_64_asm_revStride4Read_Word512(static_cast<Word512_t*>(end_address), static_cast<Word512_t*>(start_address));
+    #error 512-bit words are not supported on Windows.
+#else
+    register Word512_t val; 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word512_t);
+    //for (volatile Word512_t* wordptr = static_cast<Word512_t*>(end_address); i < len; i += 16) {
+    for (Word512_t* wordptr = static_cast<Word512_t*>(end_address); i < len; i += 16) {
+        //UNROLL16(val = *wordptr; wordptr -= 4;)
+        UNROLL16(val = my_512b_load(wordptr); wordptr -= 4;)
+        if (wordptr <= static_cast<Word512_t*>(start_address)) //end, modulo
+            wordptr += len;
+    }
+    return 0;
+#endif
+}
+#endif
+
+/* ------------ STRIDE 4 WRITE --------------*/
+
+int32_t xmem::forwStride4Write_Word32(void* start_address, void* end_address) {
+    register Word32_t val = 0xFFFFFFFF; 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word32_t);
+    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(start_address); i < len; i += 256) {
+        UNROLL256(*wordptr = val; wordptr += 4;)
+        if (wordptr >= static_cast<Word32_t*>(end_address)) //end, modulo
+            wordptr -= len;
+    }
+    return 0;
+}
+
+#ifdef HAS_WORD_64
+int32_t xmem::forwStride4Write_Word64(void* start_address, void* end_address) {
+    register Word64_t val = 0xFFFFFFFFFFFFFFFF; 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word64_t);
+    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(start_address); i < len; i += 128) {
+        UNROLL128(*wordptr = val; wordptr += 4;)
+        if (wordptr >= static_cast<Word64_t*>(end_address)) //end, modulo
+            wordptr -= len;
+    }
+    return 0;
+}
+#endif
+
+#ifdef HAS_WORD_128
+int32_t xmem::forwStride4Write_Word128(void* start_address, void* end_address) { 
+#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
+    return win_x86_64_asm_forwStride4Write_Word128(static_cast<Word128_t*>(start_address), static_cast<Word128_t*>(end_address));
+#else
+    register Word128_t val;
+    val = my_64b_set_128b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF);
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word128_t);
+    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(start_address); i < len; i += 64) {
+        UNROLL64(*wordptr = val; wordptr += 4;)
+        if (wordptr >= static_cast<Word128_t*>(end_address)) //end, modulo
+            wordptr -= len;
+    }
+    return 0;
+#endif
+}
+#endif
+
+#ifdef HAS_WORD_256
+int32_t xmem::forwStride4Write_Word256(void* start_address, void* end_address) { 
+#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
+    return win_x86_64_asm_forwStride4Write_Word256(static_cast<Word256_t*>(start_address), static_cast<Word256_t*>(end_address));
+#else
+    register Word256_t val;
+    val = my_64b_set_256b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF);
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word256_t);
+    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(start_address); i < len; i += 32) {
+        UNROLL32(*wordptr = val; wordptr += 4;)
+        if (wordptr >= static_cast<Word256_t*>(end_address)) //end, modulo
+            wordptr -= len;
+    }
+    return 0;
+#endif
+}
+#endif
+
+#ifdef HAS_WORD_512
+#ifdef _WIN32
+int32_t xmem::forwStride4Write_Word512(void* start_address, void* end_address) {
+#else
+//FIXME: We flag GCC/ICC not to optimize this function. The problem is that my_512b_load() -- which maps to _mm512_load_epi64 Intel AVX-512/KNC intrinsic -- cannot accept volatile* arguments. The only way to prevent the entire benchmark loop from being optimized away is to force the compiler not to optimize the function at all. Unfortunately, this will cause extra unwanted code to be included. The only solution seems to be to write inline assembly or allow eventual support for assignment of __m512i variables, e.g., val = *wordptr++; which is how the code for the other word sizes is written.
+int32_t __attribute__((optimize("O0"))) xmem::forwStride4Write_Word512(void* start_address, void* end_address) { 
+#endif
+#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
+    //return win_x86_64_asm_forwStride4Write_Word512(static_cast<Word512_t*>(start_address), static_cast<Word512_t*>(end_address));
+    #error 512-bit words are not supported on Windows.
+#else
+    register Word512_t val;
+    uint64_t scratchptr[8] __attribute__ ((aligned(512)));
+    my_64b_set_512b_word(val, scratchptr, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF);
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word512_t);
+    for (Word512_t* wordptr = static_cast<Word512_t*>(start_address); i < len; i += 16) {
+        UNROLL16(*wordptr = val; wordptr += 4;)
+        if (wordptr >= static_cast<Word512_t*>(end_address)) //end, modulo
+            wordptr -= len;
+    }
+    return 0;
+#endif
+}
+#endif
+
+int32_t xmem::revStride4Write_Word32(void* start_address, void* end_address) { 
+    register Word32_t val = 0xFFFFFFFF; 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word32_t);
+    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(end_address); i < len; i += 256) {
+        UNROLL256(*wordptr = val; wordptr -= 4;)
+        if (wordptr <= static_cast<Word32_t*>(start_address)) //end, modulo
+            wordptr += len;
+    }
+    return 0;
+}
+
+#ifdef HAS_WORD_64
+int32_t xmem::revStride4Write_Word64(void* start_address, void* end_address) { 
+    register Word64_t val = 0xFFFFFFFFFFFFFFFF; 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word64_t);
+    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(end_address); i < len; i += 128) {
+        UNROLL128(*wordptr = val; wordptr -= 4;)
+        if (wordptr <= static_cast<Word64_t*>(start_address)) //end, modulo
+            wordptr += len;
+    }
+    return 0;
+}
+#endif
+
+#ifdef HAS_WORD_128
+int32_t xmem::revStride4Write_Word128(void* start_address, void* end_address) { 
+#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
+    return win_x86_64_asm_revStride4Write_Word128(static_cast<Word128_t*>(end_address), static_cast<Word128_t*>(start_address));
+#else
+    register Word128_t val;
+    val = my_64b_set_128b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF);
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word128_t);
+    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(end_address); i < len; i += 64) {
+        UNROLL64(*wordptr = val; wordptr -= 4;)
+        if (wordptr <= static_cast<Word128_t*>(start_address)) //end, modulo
+            wordptr += len;
+    }
+    return 0;
+#endif
+}
+#endif
+
+#ifdef HAS_WORD_256
+int32_t xmem::revStride4Write_Word256(void* start_address, void* end_address) { 
+#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
+    return win_x86_64_asm_revStride4Write_Word256(static_cast<Word256_t*>(end_address), static_cast<Word256_t*>(start_address));
+#else
+    register Word256_t val;
+    val = my_64b_set_256b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF);
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word256_t);
+    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(end_address); i < len; i += 32) {
+        UNROLL32(*wordptr = val; wordptr -= 4;)
+        if (wordptr <= static_cast<Word256_t*>(start_address)) //end, modulo
+            wordptr += len;
+    }
+    return 0;
+#endif
+}
+#endif
+
+#ifdef HAS_WORD_512
+#ifdef _WIN32
+int32_t xmem::revStride4Write_Word512(void* start_address, void* end_address) {
+#else
+//FIXME: We flag GCC/ICC not to optimize this function. The problem is that my_512b_load() -- which maps to _mm512_load_epi64 Intel AVX-512/KNC intrinsic -- cannot accept volatile* arguments. The only way to prevent the entire benchmark loop from being optimized away is to force the compiler not to optimize the function at all. Unfortunately, this will cause extra unwanted code to be included. The only solution seems to be to write inline assembly or allow eventual support for assignment of __m512i variables, e.g., val = *wordptr++; which is how the code for the other word sizes is written.
+int32_t __attribute__((optimize("O0"))) xmem::revStride4Write_Word512(void* start_address, void* end_address) { 
+#endif
+#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
+    //return win_x86_64_asm_revStride4Write_Word512(static_cast<Word512_t*>(end_address), static_cast<Word512_t*>(start_address));
+    #error 512-bit words are not supported on Windows.
+#else
+    register Word512_t val;
+    uint64_t scratchptr[8] __attribute__ ((aligned(512)));
+    my_64b_set_512b_word(val, scratchptr, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF);
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word512_t);
+    for (Word512_t* wordptr = static_cast<Word512_t*>(end_address); i < len; i += 16) {
+        UNROLL16(*wordptr = val; wordptr -= 4;)
+        if (wordptr <= static_cast<Word512_t*>(start_address)) //end, modulo
+            wordptr += len;
+    }
+    return 0;
+#endif
+}
+#endif
+
+/* ------------ STRIDE 8 READ --------------*/
+
+int32_t xmem::forwStride8Read_Word32(void* start_address, void* end_address) {
+    register Word32_t val; 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word32_t);
+    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(start_address); i < len; i += 128) {
+        UNROLL128(val = *wordptr; wordptr += 8;) 
+        if (wordptr >= static_cast<Word32_t*>(end_address)) //end, modulo
+            wordptr -= len;
+    }
+    return 0;
+}
+
+#ifdef HAS_WORD_64
+int32_t xmem::forwStride8Read_Word64(void* start_address, void* end_address) { 
+    register Word64_t val; 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word64_t);
+    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(start_address); i < len; i += 64) {
+        UNROLL64(val = *wordptr; wordptr += 8;) 
+        if (wordptr >= static_cast<Word64_t*>(end_address)) //end, modulo
+            wordptr -= len;
+    }
+    return 0;
+}
+#endif
+
+#ifdef HAS_WORD_128
+int32_t xmem::forwStride8Read_Word128(void* start_address, void* end_address) { 
+#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
+    return win_x86_64_asm_forwStride8Read_Word128(static_cast<Word128_t*>(start_address), static_cast<Word128_t*>(end_address));
+#else
+    register Word128_t val; 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word128_t);
+    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(start_address); i < len; i += 32) {
+        UNROLL32(val = *wordptr; wordptr += 8;) 
+        if (wordptr >= static_cast<Word128_t*>(end_address)) //end, modulo
+            wordptr -= len;
+    }
+    return 0;
+#endif
+}
+#endif
+
+#ifdef HAS_WORD_256
+int32_t xmem::forwStride8Read_Word256(void* start_address, void* end_address) { 
+#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
+    return win_x86_64_asm_forwStride8Read_Word256(static_cast<Word256_t*>(start_address), static_cast<Word256_t*>(end_address));
+#else
+    register Word256_t val; 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word256_t);
+    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(start_address); i < len; i += 16) {
+        UNROLL16(val = *wordptr; wordptr += 8;) 
+        if (wordptr >= static_cast<Word256_t*>(end_address)) //end, modulo
+            wordptr -= len;
+    }
+    return 0;
+#endif
+}
+#endif
+
+#ifdef HAS_WORD_512
+#ifdef _WIN32
+int32_t xmem::forwStride8Read_Word512(void* start_address, void* end_address) {
+#else
+//FIXME: We flag GCC/ICC not to optimize this function. The problem is that my_512b_load() -- which maps to _mm512_load_epi64 Intel AVX-512/KNC intrinsic -- cannot accept volatile* arguments. The only way to prevent the entire benchmark loop from being optimized away is to force the compiler not to optimize the function at all. Unfortunately, this will cause extra unwanted code to be included. The only solution seems to be to write inline assembly or allow eventual support for assignment of __m512i variables, e.g., val = *wordptr++; which is how the code for the other word sizes is written.
+int32_t __attribute__((optimize("O0"))) xmem::forwStride8Read_Word512(void* start_address, void* end_address) { 
+#endif
+#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
+    //return win_x86_64_asm_forwStride8Read_Word512(static_cast<Word512_t*>(start_address), static_cast<Word512_t*>(end_address));
+    #error 512-bit words are not supported on Windows.
+#else
+    register Word512_t val; 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word512_t);
+    //for (volatile Word512_t* wordptr = static_cast<Word512_t*>(start_address); i < len; i += 8) {
+    for (Word512_t* wordptr = static_cast<Word512_t*>(start_address); i < len; i += 8) {
+        //UNROLL8(val = *wordptr; wordptr += 8;) 
+        UNROLL8(val = my_512b_load(wordptr); wordptr += 8;) 
+        if (wordptr >= static_cast<Word512_t*>(end_address)) //end, modulo
+            wordptr -= len;
+    }
+    return 0;
+#endif
+}
+#endif
+
+int32_t xmem::revStride8Read_Word32(void* start_address, void* end_address) {
+    register Word32_t val; 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word32_t);
+    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(end_address); i < len; i += 128) {
+        UNROLL128(val = *wordptr; wordptr -= 8;) 
+        if (wordptr <= static_cast<Word32_t*>(start_address)) //end, modulo
+            wordptr += len;
+    }
+    return 0;
+}
+
+#ifdef HAS_WORD_64
+int32_t xmem::revStride8Read_Word64(void* start_address, void* end_address) { 
+    register Word64_t val; 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word64_t);
+    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(end_address); i < len; i += 64) {
+        UNROLL64(val = *wordptr; wordptr -= 8;)
+        if (wordptr <= static_cast<Word64_t*>(start_address)) //end, modulo
+            wordptr += len;
+    }
+    return 0;
+}
+#endif
+
+#ifdef HAS_WORD_128
+int32_t xmem::revStride8Read_Word128(void* start_address, void* end_address) { 
+#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
+    return win_x86_64_asm_revStride8Read_Word128(static_cast<Word128_t*>(end_address), static_cast<Word128_t*>(start_address));
+#else
+    register Word128_t val; 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word128_t);
+    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(end_address); i < len; i += 32) {
+        UNROLL32(val = *wordptr; wordptr -= 8;)
+        if (wordptr <= static_cast<Word128_t*>(start_address)) //end, modulo
+            wordptr += len;
+    }
+    return 0;
+#endif
+}
+#endif
+
+#ifdef HAS_WORD_256
+int32_t xmem::revStride8Read_Word256(void* start_address, void* end_address) { 
+#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
+    return win_x86_64_asm_revStride8Read_Word256(static_cast<Word256_t*>(end_address), static_cast<Word256_t*>(start_address));
+#else
+    register Word256_t val; 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word256_t);
+    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(end_address); i < len; i += 16) {
+        UNROLL16(val = *wordptr; wordptr -= 8;)
+        if (wordptr <= static_cast<Word256_t*>(start_address)) //end, modulo
+            wordptr += len;
+    }
+    return 0;
+#endif
+}
+#endif
+
+#ifdef HAS_WORD_512
+#ifdef _WIN32
+int32_t xmem::revStride8Read_Word512(void* start_address, void* end_address) {
+#else
+//FIXME: We flag GCC/ICC not to optimize this function. The problem is that my_512b_load() -- which maps to _mm512_load_epi64 Intel AVX-512/KNC intrinsic -- cannot accept volatile* arguments. The only way to prevent the entire benchmark loop from being optimized away is to force the compiler not to optimize the function at all. Unfortunately, this will cause extra unwanted code to be included. The only solution seems to be to write inline assembly or allow eventual support for assignment of __m512i variables, e.g., val = *wordptr++; which is how the code for the other word sizes is written.
+int32_t __attribute__((optimize("O0"))) xmem::revStride8Read_Word512(void* start_address, void* end_address) { 
+#endif
+#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
+    //return win_x86_64_asm_revStride8Read_Word512(static_cast<Word512_t*>(end_address), static_cast<Word512_t*>(start_address));
+    #error 512-bit words are not supported on Windows.
+#else
+    register Word512_t val; 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word512_t);
+    //for (volatile Word512_t* wordptr = static_cast<Word512_t*>(end_address); i < len; i += 8) {
+    for (Word512_t* wordptr = static_cast<Word512_t*>(end_address); i < len; i += 8) {
+        //UNROLL8(val = *wordptr; wordptr -= 8;)
+        UNROLL8(val = my_512b_load(wordptr); wordptr -= 8;)
+        if (wordptr <= static_cast<Word512_t*>(start_address)) //end, modulo
+            wordptr += len;
+    }
+    return 0;
+#endif
+}
+#endif
+
+/* ------------ STRIDE 8 WRITE --------------*/
+
+int32_t xmem::forwStride8Write_Word32(void* start_address, void* end_address) {
+    register Word32_t val = 0xFFFFFFFF; 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word32_t);
+    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(start_address); i < len; i += 128) {
+        UNROLL128(*wordptr = val; wordptr += 8;)
+        if (wordptr >= static_cast<Word32_t*>(end_address)) //end, modulo
+            wordptr -= len;
+    }
+    return 0;
+}
+
+#ifdef HAS_WORD_64
+int32_t xmem::forwStride8Write_Word64(void* start_address, void* end_address) {
+    register Word64_t val = 0xFFFFFFFFFFFFFFFF; 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word64_t);
+    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(start_address); i < len; i += 64) {
+        UNROLL64(*wordptr = val; wordptr += 8;)
+        if (wordptr >= static_cast<Word64_t*>(end_address)) //end, modulo
+            wordptr -= len;
+    }
+    return 0;
+}
+#endif
+
+#ifdef HAS_WORD_128
+int32_t xmem::forwStride8Write_Word128(void* start_address, void* end_address) { 
+#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
+    return win_x86_64_asm_forwStride8Write_Word128(static_cast<Word128_t*>(start_address), static_cast<Word128_t*>(end_address));
+#else
+    register Word128_t val;
+    val = my_64b_set_128b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF);
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word128_t);
+    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(start_address); i < len; i += 32) {
+        UNROLL32(*wordptr = val; wordptr += 8;)
+        if (wordptr >= static_cast<Word128_t*>(end_address)) //end, modulo
+            wordptr -= len;
+    }
+    return 0;
 #endif
-            }
-            std::shuffle(reinterpret_cast<Word128_t*>(mem_region_base), reinterpret_cast<Word128_t*>(mem_region_base) + num_pointers, gen);
-            break;
+}
 #endif
+
 #ifdef HAS_WORD_256
-        case CHUNK_256b:
-            for (size_t i = 0; i < num_pointers; i++) { //Initialize pointers to point at themselves (identity mapping)
-#ifdef HAS_WORD_64
-                mem_region_base[i*4] = reinterpret_cast<Word64_t>(mem_region_base+(i*4));
-                mem_region_base[(i*4)+1] = 0xFFFFFFFFFFFFFFFF; //1-fill upper 192 bits
-                mem_region_base[(i*4)+2] = 0xFFFFFFFFFFFFFFFF; 
-                mem_region_base[(i*4)+3] = 0xFFFFFFFFFFFFFFFF;
-#else //special case for 32-bit architectures
-                mem_region_base[i*8] = reinterpret_cast<Word32_t>(mem_region_base+(i*8));
-                mem_region_base[(i*8)+1] = 0xFFFFFFFF; //1-fill upper 224 bits
-                mem_region_base[(i*8)+2] = 0xFFFFFFFF;
-                mem_region_base[(i*8)+3] = 0xFFFFFFFF;
-                mem_region_base[(i*8)+4] = 0xFFFFFFFF;
-                mem_region_base[(i*8)+5] = 0xFFFFFFFF;
-                mem_region_base[(i*8)+6] = 0xFFFFFFFF;
-                mem_region_base[(i*8)+7] = 0xFFFFFFFF;
+int32_t xmem::forwStride8Write_Word256(void* start_address, void* end_address) { 
+#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
+    return win_x86_64_asm_forwStride8Write_Word256(static_cast<Word256_t*>(start_address), static_cast<Word256_t*>(end_address));
+#else
+    register Word256_t val;
+    val = my_64b_set_256b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF); 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word256_t);
+    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(start_address); i < len; i += 16) {
+        UNROLL16(*wordptr = val; wordptr += 8;)
+        if (wordptr >= static_cast<Word256_t*>(end_address)) //end, modulo
+            wordptr -= len;
+    }
+    return 0;
 #endif
-            }
-            std::shuffle(reinterpret_cast<Word256_t*>(mem_region_base), reinterpret_cast<Word256_t*>(mem_region_base) + num_pointers, gen);
-            break;
+}
 #endif
+
 #ifdef HAS_WORD_512
-        case CHUNK_512b:
-            for (size_t i = 0; i < num_pointers; i++) { //Initialize pointers to point at themselves (identity mapping)
-#ifdef HAS_WORD_64
-                mem_region_base[i*4] = reinterpret_cast<Word64_t>(mem_region_base+(i*4));
-                mem_region_base[(i*4)+1] = 0xFFFFFFFFFFFFFFFF; //1-fill upper 448 bits
-                mem_region_base[(i*4)+2] = 0xFFFFFFFFFFFFFFFF; 
-                mem_region_base[(i*4)+3] = 0xFFFFFFFFFFFFFFFF;
-                mem_region_base[(i*4)+4] = 0xFFFFFFFFFFFFFFFF;
-                mem_region_base[(i*4)+5] = 0xFFFFFFFFFFFFFFFF;
-                mem_region_base[(i*4)+6] = 0xFFFFFFFFFFFFFFFF;
-                mem_region_base[(i*4)+7] = 0xFFFFFFFFFFFFFFFF;
-#else //special case for 32-bit architectures
-                mem_region_base[i*8] = reinterpret_cast<Word32_t>(mem_region_base+(i*8));
-                mem_region_base[(i*8)+1] = 0xFFFFFFFF; //1-fill upper 480 bits
-                mem_region_base[(i*8)+2] = 0xFFFFFFFF;
-                mem_region_base[(i*8)+3] = 0xFFFFFFFF;
-                mem_region_base[(i*8)+4] = 0xFFFFFFFF;
-                mem_region_base[(i*8)+5] = 0xFFFFFFFF;
-                mem_region_base[(i*8)+6] = 0xFFFFFFFF;
-                mem_region_base[(i*8)+7] = 0xFFFFFFFF;
-                mem_region_base[(i*8)+8] = 0xFFFFFFFF;
-                mem_region_base[(i*8)+9] = 0xFFFFFFFF;
-                mem_region_base[(i*8)+10] = 0xFFFFFFFF;
-                mem_region_base[(i*8)+11] = 0xFFFFFFFF;
-                mem_region_base[(i*8)+12] = 0xFFFFFFFF;
-                mem_region_base[(i*8)+13] = 0xFFFFFFFF;
-                mem_region_base[(i*8)+14] = 0xFFFFFFFF;
-                mem_region_base[(i*8)+15] = 0xFFFFFFFF;
-#endif
-            }
-            std::shuffle(reinterpret_cast<Word512_t*>(mem_region_base), reinterpret_cast<Word512_t*>(mem_region_base) + num_pointers, gen);
-            break;
+#ifdef _WIN32
+int32_t xmem::forwStride8Write_Word512(void* start_address, void* end_address) {
+#else
+//FIXME: We flag GCC/ICC not to optimize this function. The problem is that my_512b_load() -- which maps to _mm512_load_epi64 Intel AVX-512/KNC intrinsic -- cannot accept volatile* arguments. The only way to prevent the entire benchmark loop from being optimized away is to force the compiler not to optimize the function at all. Unfortunately, this will cause extra unwanted code to be included. The only solution seems to be to write inline assembly or allow eventual support for assignment of __m512i variables, e.g., val = *wordptr++; which is how the code for the other word sizes is written.
+int32_t __attribute__((optimize("O0"))) xmem::forwStride8Write_Word512(void* start_address, void* end_address) { 
 #endif
-        default:
-            std::cerr << "ERROR: Got an invalid chunk size. This should not have happened." << std::endl;
-            return false;
+#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
+    //return win_x86_64_asm_forwStride8Write_Word512(static_cast<Word512_t*>(start_address), static_cast<Word512_t*>(end_address));
+    #error 512-bit words are not supported on Windows.
+#else
+    register Word512_t val;
+    uint64_t scratchptr[8] __attribute__ ((aligned(512)));
+    my_64b_set_512b_word(val, scratchptr, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF); 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word512_t);
+    for (Word512_t* wordptr = static_cast<Word512_t*>(start_address); i < len; i += 8) {
+        UNROLL8(*wordptr = val; wordptr += 8;)
+        if (wordptr >= static_cast<Word512_t*>(end_address)) //end, modulo
+            wordptr -= len;
     }
+    return 0;
+#endif
+}
+#endif
 
-    if (g_verbose) {
-        std::cout << "done" << std::endl;
-        std::cout << std::endl;
+int32_t xmem::revStride8Write_Word32(void* start_address, void* end_address) { 
+    register Word32_t val = 0xFFFFFFFF; 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word32_t);
+    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(end_address); i < len; i += 128) {
+        UNROLL128(*wordptr = val; wordptr -= 8;)
+        if (wordptr <= static_cast<Word32_t*>(start_address)) //end, modulo
+            wordptr += len;
     }
-
-    return true;
+    return 0;
 }
 
-/***********************************************************************
- ***********************************************************************
- ********************** LATENCY-RELATED BENCHMARK KERNELS **************
- ***********************************************************************
- ***********************************************************************/
-
-/* --------------------- DUMMY BENCHMARK ROUTINES --------------------------- */
-
-int32_t xmem::dummy_chasePointers(uintptr_t*, uintptr_t**, size_t len) {
-    volatile uintptr_t placeholder = 0; //Try to defeat compiler optimizations removing this method
+#ifdef HAS_WORD_64
+int32_t xmem::revStride8Write_Word64(void* start_address, void* end_address) { 
+    register Word64_t val = 0xFFFFFFFFFFFFFFFF; 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word64_t);
+    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(end_address); i < len; i += 64) {
+        UNROLL64(*wordptr = val; wordptr -= 8;)
+        if (wordptr <= static_cast<Word64_t*>(start_address)) //end, modulo
+            wordptr += len;
+    }
     return 0;
 }
+#endif
 
-/* -------------------- CORE BENCHMARK ROUTINES -------------------------- */
-
-int32_t xmem::chasePointers(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len) {
-    volatile uintptr_t* p = first_address;
-    UNROLL512(p = reinterpret_cast<uintptr_t*>(*p);)
-    *last_touched_address = const_cast<uintptr_t*>(p);
+#ifdef HAS_WORD_128
+int32_t xmem::revStride8Write_Word128(void* start_address, void* end_address) { 
+#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
+    return win_x86_64_asm_revStride8Write_Word128(static_cast<Word128_t*>(end_address), static_cast<Word128_t*>(start_address));
+#else
+    register Word128_t val;
+    val = my_64b_set_128b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF); 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word128_t);
+    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(end_address); i < len; i += 32) {
+        UNROLL32(*wordptr = val; wordptr -= 8;)
+        if (wordptr <= static_cast<Word128_t*>(start_address)) //end, modulo
+            wordptr += len;
+    }
     return 0;
+#endif
 }
+#endif
 
+#ifdef HAS_WORD_256
+int32_t xmem::revStride8Write_Word256(void* start_address, void* end_address) { 
+#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
+    return win_x86_64_asm_revStride8Write_Word256(static_cast<Word256_t*>(end_address), static_cast<Word256_t*>(start_address));
+#else
+    register Word256_t val;
+    val = my_64b_set_256b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF); 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word256_t);
+    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(end_address); i < len; i += 16) {
+        UNROLL16(*wordptr = val; wordptr -= 8;)
+        if (wordptr <= static_cast<Word256_t*>(start_address)) //end, modulo
+            wordptr += len;
+    }
+    return 0;
+#endif
+}
+#endif
 
-/***********************************************************************
- ***********************************************************************
- ******************* THROUGHPUT-RELATED BENCHMARK KERNELS **************
- ***********************************************************************
- ***********************************************************************/
-
-/* --------------------- DUMMY BENCHMARK ROUTINES --------------------------- */
-
-int32_t xmem::dummy_empty(void*, void*) { 
+#ifdef HAS_WORD_512
+#ifdef _WIN32
+int32_t xmem::revStride8Write_Word512(void* start_address, void* end_address) {
+#else
+//FIXME: We flag GCC/ICC not to optimize this function. The problem is that my_512b_load() -- which maps to _mm512_load_epi64 Intel AVX-512/KNC intrinsic -- cannot accept volatile* arguments. The only way to prevent the entire benchmark loop from being optimized away is to force the compiler not to optimize the function at all. Unfortunately, this will cause extra unwanted code to be included. The only solution seems to be to write inline assembly or allow eventual support for assignment of __m512i variables, e.g., val = *wordptr++; which is how the code for the other word sizes is written.
+int32_t __attribute__((optimize("O0"))) xmem::revStride8Write_Word512(void* start_address, void* end_address) { 
+#endif
+#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
+    //return win_x86_64_asm_revStride8Write_Word512(static_cast<Word512_t*>(end_address), static_cast<Word512_t*>(start_address));
+    #error 512-bit words are not supported on Windows.
+#else
+    register Word512_t val;
+    uint64_t scratchptr[8] __attribute__ ((aligned(512)));
+    my_64b_set_512b_word(val, scratchptr, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF); 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word512_t);
+    for (Word512_t* wordptr = static_cast<Word512_t*>(end_address); i < len; i += 8) {
+        UNROLL8(*wordptr = val; wordptr -= 8;)
+        if (wordptr <= static_cast<Word512_t*>(start_address)) //end, modulo
+            wordptr += len;
+    }
     return 0;
+#endif
 }
-        
-/* ------------ SEQUENTIAL LOOP --------------*/
+#endif
 
-int32_t xmem::dummy_forwSequentialLoop_Word32(void* start_address, void* end_address) {
-    volatile int32_t placeholder = 0; //Try our best to defeat compiler optimizations
-    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(start_address), *endptr = static_cast<Word32_t*>(end_address); wordptr < endptr;) {
-        UNROLL1024(wordptr++;) 
-        placeholder = 0;
+/* ------------ STRIDE 16 READ --------------*/
+
+int32_t xmem::forwStride16Read_Word32(void* start_address, void* end_address) {
+    register Word32_t val; 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word32_t);
+    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(start_address); i < len; i += 64) {
+        UNROLL64(val = *wordptr; wordptr += 16;) 
+        if (wordptr >= static_cast<Word32_t*>(end_address)) //end, modulo
+            wordptr -= len;
     }
-    return placeholder;
+    return 0;
 }
 
 #ifdef HAS_WORD_64
-int32_t xmem::dummy_forwSequentialLoop_Word64(void* start_address, void* end_address) {
-    volatile int32_t placeholder = 0; //Try our best to defeat compiler optimizations
-    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(start_address), *endptr = static_cast<Word64_t*>(end_address); wordptr < endptr;) {
-        UNROLL512(wordptr++;) 
-        placeholder = 0;
+int32_t xmem::forwStride16Read_Word64(void* start_address, void* end_address) { 
+    register Word64_t val; 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word64_t);
+    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(start_address); i < len; i += 32) {
+        UNROLL32(val = *wordptr; wordptr += 16;) 
+        if (wordptr >= static_cast<Word64_t*>(end_address)) //end, modulo
+            wordptr -= len;
     }
-    return placeholder;
+    return 0;
 }
 #endif
 
 #ifdef HAS_WORD_128
-int32_t xmem::dummy_forwSequentialLoop_Word128(void* start_address, void* end_address) {
+int32_t xmem::forwStride16Read_Word128(void* start_address, void* end_address) { 
 #if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_dummy_forwSequentialLoop_Word128(static_cast<Word128_t*>(start_address), static_cast<Word128_t*>(end_address));
-#else
-    volatile int32_t placeholder = 0; //Try our best to defeat compiler optimizations
-    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(start_address), *endptr = static_cast<Word128_t*>(end_address); wordptr < endptr;) {
-        UNROLL256(wordptr++;) 
-        placeholder = 0;
+    return win_x86_64_asm_forwStride16Read_Word128(static_cast<Word128_t*>(start_address), static_cast<Word128_t*>(end_address));
+#else
+    register Word128_t val; 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word128_t);
+    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(start_address); i < len; i += 16) {
+        UNROLL16(val = *wordptr; wordptr += 16;) 
+        if (wordptr >= static_cast<Word128_t*>(end_address)) //end, modulo
+            wordptr -= len;
     }
-    return placeholder;
+    return 0;
 #endif
 }
 #endif
 
 #ifdef HAS_WORD_256
-int32_t xmem::dummy_forwSequentialLoop_Word256(void* start_address, void* end_address) {
+int32_t xmem::forwStride16Read_Word256(void* start_address, void* end_address) { 
 #if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_dummy_forwSequentialLoop_Word256(static_cast<Word256_t*>(start_address), static_cast<Word256_t*>(end_address));
-#endif
-#ifdef __gnu_linux__
-    volatile int32_t placeholder = 0; //Try our best to defeat compiler optimizations
-    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(start_address), *endptr = static_cast<Word256_t*>(end_address); wordptr < endptr;) {
-        UNROLL128(wordptr++;) 
-        placeholder = 0;
+    return win_x86_64_asm_forwStride16Read_Word256(static_cast<Word256_t*>(start_address), static_cast<Word256_t*>(end_address));
+#else
+    register Word256_t val; 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word256_t);
+    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(start_address); i < len; i += 8) {
+        UNROLL8(val = *wordptr; wordptr += 16;) 
+        if (wordptr >= static_cast<Word256_t*>(end_address)) //end, modulo
+            wordptr -= len;
     }
-    return placeholder;
+    return 0;
 #endif
 }
 #endif
 
 #ifdef HAS_WORD_512
 #ifdef _WIN32
-int32_t xmem::dummy_forwSequentialLoop_Word512(void* start_address, void* end_address) {
+int32_t xmem::forwStride16Read_Word512(void* start_address, void* end_address) {
 #else
 //FIXME: We flag GCC/ICC not to optimize this function. The problem is that my_512b_load() -- which maps to _mm512_load_epi64 Intel AVX-512/KNC intrinsic -- cannot accept volatile* arguments. The only way to prevent the entire benchmark loop from being optimized away is to force the compiler not to optimize the function at all. Unfortunately, this will cause extra unwanted code to be included. The only solution seems to be to write inline assembly or allow eventual support for assignment of __m512i variables, e.g., val = *wordptr++; which is how the code for the other word sizes is written.
-int32_t __attribute__((optimize("O0"))) xmem::dummy_forwSequentialLoop_Word512(void* start_address, void* end_address) { 
+int32_t __attribute__((optimize("O0"))) xmem::forwStride16Read_Word512(void* start_address, void* end_address) { 
 #endif
 #if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    //return win_x86_64_asm_dummy_forwSequentialLoop_Word512(static_cast<Word512_t*>(start_address), static_cast<Word512_t*>(end_address));
-    #error 512-bit words on Windows are not currently supported.
-#endif
-#ifdef __gnu_linux__
-    volatile int32_t placeholder = 0; //Try our best to defeat compiler optimizations
-    for (Word512_t* wordptr = static_cast<Word512_t*>(start_address), *endptr = static_cast<Word512_t*>(end_address); wordptr < endptr;) {
-        UNROLL64(wordptr++;) 
-        placeholder = 0;
+    //return win_x86_64_asm_forwStride16Read_Word512(static_cast<Word512_t*>(start_address), static_cast<Word512_t*>(end_address));
+    #error 512-bit words are not supported on Windows.
+#else
+    register Word512_t val; 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word512_t);
+    //for (volatile Word512_t* wordptr = static_cast<Word512_t*>(start_address); i < len; i += 4) {
+    for (Word512_t* wordptr = static_cast<Word512_t*>(start_address); i < len; i += 4) {
+        //UNROLL4(val = *wordptr; wordptr += 16;) 
+        UNROLL4(val = my_512b_load(wordptr); wordptr += 16;) 
+        if (wordptr >= static_cast<Word512_t*>(end_address)) //end, modulo
+            wordptr -= len;
     }
-    return placeholder;
+    return 0;
 #endif
 }
 #endif
 
-int32_t xmem::dummy_revSequentialLoop_Word32(void* start_address, void* end_address) { 
-    volatile int32_t placeholder = 0; //Try our best to defeat compiler optimizations
-    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(end_address), *begptr = static_cast<Word32_t*>(start_address); wordptr > begptr;) {
-        UNROLL1024(wordptr--;)
-        placeholder = 0;
+int32_t xmem::revStride16Read_Word32(void* start_address, void* end_address) {
+    register Word32_t val; 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word32_t);
+    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(end_address); i < len; i += 64) {
+        UNROLL64(val = *wordptr; wordptr -= 16;) 
+        if (wordptr <= static_cast<Word32_t*>(start_address)) //end, modulo
+            wordptr += len;
     }
-    return placeholder;
+    return 0;
 }
 
 #ifdef HAS_WORD_64
-int32_t xmem::dummy_revSequentialLoop_Word64(void* start_address, void* end_address) {
-    volatile int32_t placeholder = 0; //Try our best to defeat compiler optimizations
-    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(end_address), *begptr = static_cast<Word64_t*>(start_address); wordptr > begptr;) {
-        UNROLL512(wordptr--;)
-        placeholder = 0;
+int32_t xmem::revStride16Read_Word64(void* start_address, void* end_address) { 
+    register Word64_t val; 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word64_t);
+    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(end_address); i < len; i += 32) {
+        UNROLL32(val = *wordptr; wordptr -= 16;)
+        if (wordptr <= static_cast<Word64_t*>(start_address)) //end, modulo
+            wordptr += len;
     }
-    return placeholder;
+    return 0;
 }
 #endif
 
 #ifdef HAS_WORD_128
-int32_t xmem::dummy_revSequentialLoop_Word128(void* start_address, void* end_address) {
+int32_t xmem::revStride16Read_Word128(void* start_address, void* end_address) { 
 #if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_dummy_revSequentialLoop_Word128(static_cast<Word128_t*>(end_address), static_cast<Word128_t*>(start_address));
-#endif
-    volatile int32_t placeholder = 0; //Try our best to defeat compiler optimizations
-    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(end_address), *begptr = static_cast<Word128_t*>(start_address); wordptr > begptr;) {
-        UNROLL256(wordptr--;) 
-        placeholder = 0;
+    return win_x86_64_asm_revStride16Read_Word128(static_cast<Word128_t*>(end_address), static_cast<Word128_t*>(start_address));
+#else
+    register Word128_t val; 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word128_t);
+    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(end_address); i < len; i += 16) {
+        UNROLL16(val = *wordptr; wordptr -= 16;)
+        if (wordptr <= static_cast<Word128_t*>(start_address)) //end, modulo
+            wordptr += len;
     }
-    return placeholder;
+    return 0;
+#endif
 }
 #endif
 
 #ifdef HAS_WORD_256
-int32_t xmem::dummy_revSequentialLoop_Word256(void* start_address, void* end_address) {
+int32_t xmem::revStride16Read_Word256(void* start_address, void* end_address) { 
 #if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_dummy_revSequentialLoop_Word256(static_cast<Word256_t*>(end_address), static_cast<Word256_t*>(start_address));
-#endif
-#ifdef __gnu_linux__
-    volatile int32_t placeholder = 0; //Try our best to defeat compiler optimizations
-    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(end_address), *begptr = static_cast<Word256_t*>(start_address); wordptr > begptr;) {
-        UNROLL128(wordptr--;) 
-        placeholder = 0;
+    return win_x86_64_asm_revStride16Read_Word256(static_cast<Word256_t*>(end_address), static_cast<Word256_t*>(start_address));
+#else
+    register Word256_t val; 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word256_t);
+    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(end_address); i < len; i += 8) {
+        UNROLL8(val = *wordptr; wordptr -= 16;)
+        if (wordptr <= static_cast<Word256_t*>(start_address)) //end, modulo
+            wordptr += len;
     }
-    return placeholder;
+    return 0;
 #endif
 }
 #endif
 
 #ifdef HAS_WORD_512
 #ifdef _WIN32
-int32_t xmem::dummy_revSequentialLoop_Word512(void* start_address, void* end_address) {
+int32_t xmem::revStride16Read_Word512(void* start_address, void* end_address) {
 #else
 //FIXME: We flag GCC/ICC not to optimize this function. The problem is that my_512b_load() -- which maps to _mm512_load_epi64 Intel AVX-512/KNC intrinsic -- cannot accept volatile* arguments. The only way to prevent the entire benchmark loop from being optimized away is to force the compiler not to optimize the function at all. Unfortunately, this will cause extra unwanted code to be included. The only solution seems to be to write inline assembly or allow eventual support for assignment of __m512i variables, e.g., val = *wordptr++; which is how the code for the other word sizes is written.
-int32_t __attribute__((optimize("O0"))) xmem::dummy_revSequentialLoop_Word512(void* start_address, void* end_address) { 
+int32_t __attribute__((optimize("O0"))) xmem::revStride16Read_Word512(void* start_address, void* end_address) { 
 #endif
 #if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    //return win_x86_64_asm_dummy_revSequentialLoop_Word512(static_cast<Word512_t*>(end_address), static_cast<Word512_t*>(start_address));
-    #error 512-bit words are not currently supported on Windows.
-#endif
-#ifdef __gnu_linux__
-    volatile int32_t placeholder = 0; //Try our best to defeat compiler optimizations
-    for (Word512_t* wordptr = static_cast<Word512_t*>(end_address), *begptr = static_cast<Word512_t*>(start_address); wordptr > begptr;) {
-        UNROLL64(wordptr--;) 
-        placeholder = 0;
+    //return win_x86_64_asm_revStride16Read_Word512(static_cast<Word512_t*>(end_address), static_cast<Word512_t*>(start_address));
+    #error 512-bit words are not supported on Windows.
+#else
+    register Word512_t val; 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word512_t);
+    //for (volatile Word512_t* wordptr = static_cast<Word512_t*>(end_address); i < len; i += 4) {
+    for (Word512_t* wordptr = static_cast<Word512_t*>(end_address); i < len; i += 4) {
+        //UNROLL4(val = *wordptr; wordptr -= 16;)
+        UNROLL4(val = my_512b_load(wordptr); wordptr -= 16;)
+        if (wordptr <= static_cast<Word512_t*>(start_address)) //end, modulo
+            wordptr += len;
     }
-    return placeholder;
+    return 0;
 #endif
 }
 #endif
 
-/* ------------ STRIDE 2 LOOP --------------*/
+/* ------------ STRIDE 16 WRITE --------------*/
 
-int32_t xmem::dummy_forwStride2Loop_Word32(void* start_address, void* end_address) {
-    register Word32_t val; 
+int32_t xmem::forwStride16Write_Word32(void* start_address, void* end_address) {
+    register Word32_t val = 0xFFFFFFFF; 
     register uint32_t i = 0;
     register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word32_t);
-    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(start_address); i < len; i += 512) {
-        UNROLL512(wordptr += 2;)
+    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(start_address); i < len; i += 64) {
+        UNROLL64(*wordptr = val; wordptr += 16;)
         if (wordptr >= static_cast<Word32_t*>(end_address)) //end, modulo
             wordptr -= len;
     }
@@ -1172,12 +4575,12 @@ int32_t xmem::dummy_forwStride2Loop_Word32(void* start_address, void* end_addres
 }
 
 #ifdef HAS_WORD_64
-int32_t xmem::dummy_forwStride2Loop_Word64(void* start_address, void* end_address) {
-    register Word64_t val; 
+int32_t xmem::forwStride16Write_Word64(void* start_address, void* end_address) {
+    register Word64_t val = 0xFFFFFFFFFFFFFFFF; 
     register uint32_t i = 0;
     register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word64_t);
-    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(start_address); i < len; i += 256) {
-        UNROLL256(wordptr += 2;)
+    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(start_address); i < len; i += 32) {
+        UNROLL32(*wordptr = val; wordptr += 16;)
         if (wordptr >= static_cast<Word64_t*>(end_address)) //end, modulo
             wordptr -= len;
     }
@@ -1186,15 +4589,16 @@ int32_t xmem::dummy_forwStride2Loop_Word64(void* start_address, void* end_addres
 #endif
 
 #ifdef HAS_WORD_128
-int32_t xmem::dummy_forwStride2Loop_Word128(void* start_address, void* end_address) {
+int32_t xmem::forwStride16Write_Word128(void* start_address, void* end_address) { 
 #if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_dummy_forwStride2Loop_Word128(static_cast<Word128_t*>(start_address), static_cast<Word128_t*>(end_address));
+    return win_x86_64_asm_forwStride16Write_Word128(static_cast<Word128_t*>(start_address), static_cast<Word128_t*>(end_address));
 #else
-    register Word128_t val; 
+    register Word128_t val;
+    val = my_64b_set_128b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF); 
     register uint32_t i = 0;
     register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word128_t);
-    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(start_address); i < len; i += 128) {
-        UNROLL128(wordptr += 2;)
+    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(start_address); i < len; i += 16) {
+        UNROLL16(*wordptr = val; wordptr += 16;)
         if (wordptr >= static_cast<Word128_t*>(end_address)) //end, modulo
             wordptr -= len;
     }
@@ -1204,15 +4608,16 @@ int32_t xmem::dummy_forwStride2Loop_Word128(void* start_address, void* end_addre
 #endif
 
 #ifdef HAS_WORD_256
-int32_t xmem::dummy_forwStride2Loop_Word256(void* start_address, void* end_address) {
+int32_t xmem::forwStride16Write_Word256(void* start_address, void* end_address) { 
 #if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_dummy_forwStride2Loop_Word256(static_cast<Word256_t*>(start_address), static_cast<Word256_t*>(end_address));
+    return win_x86_64_asm_forwStride16Write_Word256(static_cast<Word256_t*>(start_address), static_cast<Word256_t*>(end_address));
 #else
-    register Word256_t val; 
+    register Word256_t val;
+    val = my_64b_set_256b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF); 
     register uint32_t i = 0;
     register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word256_t);
-    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(start_address); i < len; i += 64) {
-        UNROLL64(wordptr += 2;)
+    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(start_address); i < len; i += 8) {
+        UNROLL8(*wordptr = val; wordptr += 16;)
         if (wordptr >= static_cast<Word256_t*>(end_address)) //end, modulo
             wordptr -= len;
     }
@@ -1223,20 +4628,22 @@ int32_t xmem::dummy_forwStride2Loop_Word256(void* start_address, void* end_addre
 
 #ifdef HAS_WORD_512
 #ifdef _WIN32
-int32_t xmem::dummy_forwStride2Loop_Word512(void* start_address, void* end_address) {
+int32_t xmem::forwStride16Write_Word512(void* start_address, void* end_address) {
 #else
 //FIXME: We flag GCC/ICC not to optimize this function. The problem is that my_512b_load() -- which maps to _mm512_load_epi64 Intel AVX-512/KNC intrinsic -- cannot accept volatile* arguments. The only way to prevent the entire benchmark loop from being optimized away is to force the compiler not to optimize the function at all. Unfortunately, this will cause extra unwanted code to be included. The only solution seems to be to write inline assembly or allow eventual support for assignment of __m512i variables, e.g., val = *wordptr++; which is how the code for the other word sizes is written.
-int32_t __attribute__((optimize("O0"))) xmem::dummy_forwStride2Loop_Word512(void* start_address, void* end_address) { 
+int32_t __attribute__((optimize("O0"))) xmem::forwStride16Write_Word512(void* start_address, void* end_address) { 
 #endif
 #if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-//    return win_x86_64_asm_dummy_forwStride2Loop_Word512(static_cast<Word512_t*>(start_address), static_cast<Word512_t*>(end_address));
-    #error 512-bit words are not currently supported on Windows.
+    //return win_x86_64_asm_forwStride16Write_Word512(static_cast<Word512_t*>(start_address), static_cast<Word512_t*>(end_address));
+    #error 512-bit words are not supported on Windows.
 #else
-    register Word512_t val; 
+    register Word512_t val;
+    uint64_t scratchptr[8] __attribute__ ((aligned(512)));
+    my_64b_set_512b_word(val, scratchptr, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF); 
     register uint32_t i = 0;
     register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word512_t);
-    for (Word512_t* wordptr = static_cast<Word512_t*>(start_address); i < len; i += 32) {
-        UNROLL32(wordptr += 2;)
+    for (Word512_t* wordptr = static_cast<Word512_t*>(start_address); i < len; i += 4) {
+        UNROLL4(*wordptr = val; wordptr += 16;)
         if (wordptr >= static_cast<Word512_t*>(end_address)) //end, modulo
             wordptr -= len;
     }
@@ -1245,63 +4652,69 @@ int32_t __attribute__((optimize("O0"))) xmem::dummy_forwStride2Loop_Word512(void
 }
 #endif
 
-int32_t xmem::dummy_revStride2Loop_Word32(void* start_address, void* end_address) {
-    register Word32_t val; 
+int32_t xmem::revStride16Write_Word32(void* start_address, void* end_address) { 
+    register Word32_t val = 0xFFFFFFFF; 
     register uint32_t i = 0;
     register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word32_t);
-    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(end_address); i < len; i += 512) {
-        UNROLL512(wordptr -= 2;)
+    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(end_address); i < len; i += 64) {
+        UNROLL64(*wordptr = val; wordptr -= 16;)
         if (wordptr <= static_cast<Word32_t*>(start_address)) //end, modulo
             wordptr += len;
     }
+
     return 0;
 }
 
 #ifdef HAS_WORD_64
-int32_t xmem::dummy_revStride2Loop_Word64(void* start_address, void* end_address) {
-    register Word64_t val; 
+int32_t xmem::revStride16Write_Word64(void* start_address, void* end_address) { 
+    register Word64_t val = 0xFFFFFFFFFFFFFFFF; 
     register uint32_t i = 0;
     register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word64_t);
-    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(end_address); i < len; i += 256) {
-        UNROLL256(wordptr -= 2;)
+    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(end_address); i < len; i += 32) {
+        UNROLL32(*wordptr = val; wordptr -= 16;)
         if (wordptr <= static_cast<Word64_t*>(start_address)) //end, modulo
             wordptr += len;
     }
+
     return 0;
 }
 #endif
 
 #ifdef HAS_WORD_128
-int32_t xmem::dummy_revStride2Loop_Word128(void* start_address, void* end_address) {
+int32_t xmem::revStride16Write_Word128(void* start_address, void* end_address) { 
 #if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_dummy_revStride2Loop_Word128(static_cast<Word128_t*>(end_address), static_cast<Word128_t*>(start_address));
+    return win_x86_64_asm_revStride16Write_Word128(static_cast<Word128_t*>(end_address), static_cast<Word128_t*>(start_address));
 #else
-    register Word128_t val; 
+    register Word128_t val;
+    val = my_64b_set_128b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF); 
     register uint32_t i = 0;
     register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word128_t);
-    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(end_address); i < len; i += 128) {
-        UNROLL128(wordptr -= 2;)
+    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(end_address); i < len; i += 16) {
+        UNROLL16(*wordptr = val; wordptr -= 16;)
         if (wordptr <= static_cast<Word128_t*>(start_address)) //end, modulo
             wordptr += len;
     }
+
     return 0;
 #endif
 }
 #endif
 
 #ifdef HAS_WORD_256
-int32_t xmem::dummy_revStride2Loop_Word256(void* start_address, void* end_address) { 
+int32_t xmem::revStride16Write_Word256(void* start_address, void* end_address) { 
 #if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_dummy_revStride2Loop_Word256(static_cast<Word256_t*>(end_address), static_cast<Word256_t*>(start_address));
+    return win_x86_64_asm_revStride16Write_Word256(static_cast<Word256_t*>(end_address), static_cast<Word256_t*>(start_address));
 #else
-    register Word256_t val; 
+    register Word256_t val;
+    val = my_64b_set_256b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF); 
     register uint32_t i = 0;
     register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word256_t);
-    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(end_address); i < len; i += 64) {
-        UNROLL64(wordptr -= 2;)
+    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(end_address); i < len; i += 8) {
+        UNROLL8(*wordptr = val; wordptr -= 16;)
         if (wordptr <= static_cast<Word256_t*>(start_address)) //end, modulo
             wordptr += len;
     }
+
     return 0;
 #endif
 }
@@ -1309,68 +4722,92 @@ int32_t xmem::dummy_revStride2Loop_Word256(void* start_address, void* end_addres
 
 #ifdef HAS_WORD_512
 #ifdef _WIN32
-int32_t xmem::dummy_revStride2Loop_Word512(void* start_address, void* end_address) {
+int32_t xmem::revStride16Write_Word512(void* start_address, void* end_address) {
 #else
 //FIXME: We flag GCC/ICC not to optimize this function. The problem is that my_512b_load() -- which maps to _mm512_load_epi64 Intel AVX-512/KNC intrinsic -- cannot accept volatile* arguments. The only way to prevent the entire benchmark loop from being optimized away is to force the compiler not to optimize the function at all. Unfortunately, this will cause extra unwanted code to be included. The only solution seems to be to write inline assembly or allow eventual support for assignment of __m512i variables, e.g., val = *wordptr++; which is how the code for the other word sizes is written.
-int32_t __attribute__((optimize("O0"))) xmem::dummy_revStride2Loop_Word512(void* start_address, void* end_address) { 
+int32_t __attribute__((optimize("O0"))) xmem::revStride16Write_Word512(void* start_address, void* end_address) { 
 #endif
 #if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    //return win_x86_64_asm_dummy_revStride2Loop_Word512(static_cast<Word512_t*>(end_address), static_cast<Word512_t*>(start_address));
-#error 512-bit words are not currently supported on Windows.
+    //return win_x86_64_asm_revStride16Write_Word512(static_cast<Word512_t*>(end_address), static_cast<Word512_t*>(start_address));
+    #error 512-bit words are not supported on Windows.
 #else
-    register Word512_t val; 
+    register Word512_t val;
+    uint64_t scratchptr[8] __attribute__ ((aligned(512)));
+    my_64b_set_512b_word(val, scratchptr, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF); 
     register uint32_t i = 0;
     register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word512_t);
-    for (Word512_t* wordptr = static_cast<Word512_t*>(end_address); i < len; i += 32) {
-        UNROLL32(wordptr -= 2;)
+    for (Word512_t* wordptr = static_cast<Word512_t*>(end_address); i < len; i += 4) {
+        UNROLL4(*wordptr = val; wordptr -= 16;)
         if (wordptr <= static_cast<Word512_t*>(start_address)) //end, modulo
             wordptr += len;
     }
+
     return 0;
 #endif
 }
 #endif
 
-/* ------------ STRIDE 4 LOOP --------------*/
+/* ------------ SEQUENTIAL READ/WRITE MIX --------------*/
 
-int32_t xmem::dummy_forwStride4Loop_Word32(void* start_address, void* end_address) {
-    register Word32_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word32_t);
-    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(start_address); i < len; i += 256) {
-        UNROLL256(wordptr += 4;)
-        if (wordptr >= static_cast<Word32_t*>(end_address)) //end, modulo
-            wordptr -= len;
+int32_t xmem::forwSequentialMix1to1_Word32(void* start_address, void* end_address) {
+    register Word32_t val;
+    register Word32_t write_val = 0xFFFFFFFF;
+    register uintptr_t lines = (reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / CACHE_LINE_SIZE;
+    Word32_t* splitptr = static_cast<Word32_t*>(start_address) + (lines - lines / 2) * (CACHE_LINE_SIZE / sizeof(Word32_t)); //The last half of the lines form the write stream
+    volatile Word32_t* readptr = static_cast<Word32_t*>(start_address);
+    for (volatile Word32_t* writeptr = splitptr, *endptr = static_cast<Word32_t*>(end_address); writeptr < endptr;) {
+        UNROLL16(val = *readptr++;) UNROLL16(*writeptr++ = write_val;)
+    }
+    while (readptr < splitptr) { //Leftover lines that do not make up a whole group are only read
+        UNROLL16(val = *readptr++;)
     }
     return 0;
 }
 
 #ifdef HAS_WORD_64
-int32_t xmem::dummy_forwStride4Loop_Word64(void* start_address, void* end_address) {
-    register Word64_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word64_t);
-    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(start_address); i < len; i += 128) {
-        UNROLL128(wordptr += 4;)
-        if (wordptr >= static_cast<Word64_t*>(end_address)) //end, modulo
-            wordptr -= len;
+int32_t xmem::forwSequentialMix1to1_Word64(void* start_address, void* end_address) {
+    register Word64_t val;
+    register Word64_t write_val = 0xFFFFFFFFFFFFFFFF;
+    register uintptr_t lines = (reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / CACHE_LINE_SIZE;
+    Word64_t* splitptr = static_cast<Word64_t*>(start_address) + (lines - lines / 2) * (CACHE_LINE_SIZE / sizeof(Word64_t)); //The last half of the lines form the write stream
+    volatile Word64_t* readptr = static_cast<Word64_t*>(start_address);
+    for (volatile Word64_t* writeptr = splitptr, *endptr = static_cast<Word64_t*>(end_address); writeptr < endptr;) {
+        UNROLL8(val = *readptr++;) UNROLL8(*writeptr++ = write_val;)
+    }
+    while (readptr < splitptr) { //Leftover lines that do not make up a whole group are only read
+        UNROLL8(val = *readptr++;)
     }
     return 0;
 }
 #endif
 
 #ifdef HAS_WORD_128
-int32_t xmem::dummy_forwStride4Loop_Word128(void* start_address, void* end_address) {
+int32_t xmem::forwSequentialMix1to1_Word128(void* start_address, void* end_address) {
 #if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_dummy_forwStride4Loop_Word128(static_cast<Word128_t*>(start_address), static_cast<Word128_t*>(end_address));
+    Word128_t val = _mm_setzero_si128(); //The loads are folded into the returned value so that the compiler keeps them without volatile vector accesses
+    Word128_t write_val = my_64b_set_128b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF);
+    uintptr_t lines = (reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / CACHE_LINE_SIZE;
+    Word128_t* splitptr = static_cast<Word128_t*>(start_address) + (lines - lines / 2) * (CACHE_LINE_SIZE / sizeof(Word128_t)); //The last half of the lines form the write stream
+    Word128_t* readptr = static_cast<Word128_t*>(start_address);
+    for (Word128_t* writeptr = splitptr, *endptr = static_cast<Word128_t*>(end_address); writeptr < endptr;) {
+        UNROLL4(val = _mm_xor_si128(val, _mm_load_si128(readptr++));) UNROLL4(_mm_store_si128(writeptr++, write_val);)
+    }
+    while (readptr < splitptr) { //Leftover lines that do not make up a whole group are only read
+        UNROLL4(val = _mm_xor_si128(val, _mm_load_si128(readptr++));)
+    }
+    return _mm_movemask_epi8(val);
 #else
-    register Word128_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word128_t);
-    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(start_address); i < len; i += 64) {
-        UNROLL64(wordptr += 4;)
-        if (wordptr >= static_cast<Word128_t*>(end_address)) //end, modulo
-            wordptr -= len;
+    register Word128_t val;
+    register Word128_t write_val;
+    write_val = my_64b_set_128b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF);
+    register uintptr_t lines = (reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / CACHE_LINE_SIZE;
+    Word128_t* splitptr = static_cast<Word128_t*>(start_address) + (lines - lines / 2) * (CACHE_LINE_SIZE / sizeof(Word128_t)); //The last half of the lines form the write stream
+    volatile Word128_t* readptr = static_cast<Word128_t*>(start_address);
+    for (volatile Word128_t* writeptr = splitptr, *endptr = static_cast<Word128_t*>(end_address); writeptr < endptr;) {
+        UNROLL4(val = *readptr++;) UNROLL4(*writeptr++ = write_val;)
+    }
+    while (readptr < splitptr) { //Leftover lines that do not make up a whole group are only read
+        UNROLL4(val = *readptr++;)
     }
     return 0;
 #endif
@@ -1378,85 +4815,97 @@ int32_t xmem::dummy_forwStride4Loop_Word128(void* start_address, void* end_addre
 #endif
 
 #ifdef HAS_WORD_256
-int32_t xmem::dummy_forwStride4Loop_Word256(void* start_address, void* end_address) {
+int32_t xmem::forwSequentialMix1to1_Word256(void* start_address, void* end_address) {
 #if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_dummy_forwStride4Loop_Word256(static_cast<Word256_t*>(start_address), static_cast<Word256_t*>(end_address));
-#else
-    register Word256_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word256_t);
-    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(start_address); i < len; i += 32) {
-        UNROLL32(wordptr += 4;)
-        if (wordptr >= static_cast<Word256_t*>(end_address)) //end, modulo
-            wordptr -= len;
+    __m256d val = _mm256_setzero_pd(); //The loads are folded into the returned value so that the compiler keeps them without volatile vector accesses
+    __m256d write_val = _mm256_castsi256_pd(my_64b_set_256b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF));
+    uintptr_t lines = (reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / CACHE_LINE_SIZE;
+    Word256_t* splitptr = static_cast<Word256_t*>(start_address) + (lines - lines / 2) * (CACHE_LINE_SIZE / sizeof(Word256_t)); //The last half of the lines form the write stream
+    Word256_t* readptr = static_cast<Word256_t*>(start_address);
+    for (Word256_t* writeptr = splitptr, *endptr = static_cast<Word256_t*>(end_address); writeptr < endptr;) {
+        UNROLL2(val = _mm256_xor_pd(val, _mm256_load_pd(reinterpret_cast<const double*>(readptr++)));) UNROLL2(_mm256_store_pd(reinterpret_cast<double*>(writeptr++), write_val);)
     }
-    return 0;
-#endif
-}
-#endif
-
-#ifdef HAS_WORD_512
-#ifdef _WIN32
-int32_t xmem::dummy_forwStride4Loop_Word512(void* start_address, void* end_address) {
-#else
-//FIXME: We flag GCC/ICC not to optimize this function. The problem is that my_512b_load() -- which maps to _mm512_load_epi64 Intel AVX-512/KNC intrinsic -- cannot accept volatile* arguments. The only way to prevent the entire benchmark loop from being optimized away is to force the compiler not to optimize the function at all. Unfortunately, this will cause extra unwanted code to be included. The only solution seems to be to write inline assembly or allow eventual support for assignment of __m512i variables, e.g., val = *wordptr++; which is how the code for the other word sizes is written.
-int32_t __attribute__((optimize("O0"))) xmem::dummy_forwStride4Loop_Word512(void* start_address, void* end_address) { 
-#endif
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    //return win_x86_64_asm_dummy_forwStride4Loop_Word512(static_cast<Word512_t*>(start_address), static_cast<Word512_t*>(end_address));
-#error 512-bit words are not currently supported on Windows.
+    while (readptr < splitptr) { //Leftover lines that do not make up a whole group are only read
+        UNROLL2(val = _mm256_xor_pd(val, _mm256_load_pd(reinterpret_cast<const double*>(readptr++)));)
+    }
+    return _mm256_movemask_pd(val);
 #else
-    register Word512_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word512_t);
-    for (Word512_t* wordptr = static_cast<Word512_t*>(start_address); i < len; i += 16) {
-        UNROLL16(wordptr += 4;)
-        if (wordptr >= static_cast<Word512_t*>(end_address)) //end, modulo
-            wordptr -= len;
+    register Word256_t val;
+    register Word256_t write_val;
+    write_val = my_64b_set_256b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF);
+    register uintptr_t lines = (reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / CACHE_LINE_SIZE;
+    Word256_t* splitptr = static_cast<Word256_t*>(start_address) + (lines - lines / 2) * (CACHE_LINE_SIZE / sizeof(Word256_t)); //The last half of the lines form the write stream
+    volatile Word256_t* readptr = static_cast<Word256_t*>(start_address);
+    for (volatile Word256_t* writeptr = splitptr, *endptr = static_cast<Word256_t*>(end_address); writeptr < endptr;) {
+        UNROLL2(val = *readptr++;) UNROLL2(*writeptr++ = write_val;)
+    }
+    while (readptr < splitptr) { //Leftover lines that do not make up a whole group are only read
+        UNROLL2(val = *readptr++;)
     }
     return 0;
 #endif
 }
 #endif
 
-int32_t xmem::dummy_revStride4Loop_Word32(void* start_address, void* end_address) {
-    register Word32_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word32_t);
-    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(end_address); i < len; i += 256) {
-        UNROLL256(wordptr -= 4;)
-        if (wordptr <= static_cast<Word32_t*>(start_address)) //end, modulo
-            wordptr += len;
+int32_t xmem::forwSequentialMix2to1_Word32(void* start_address, void* end_address) {
+    register Word32_t val;
+    register Word32_t write_val = 0xFFFFFFFF;
+    register uintptr_t lines = (reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / CACHE_LINE_SIZE;
+    Word32_t* splitptr = static_cast<Word32_t*>(start_address) + (lines - lines / 3) * (CACHE_LINE_SIZE / sizeof(Word32_t)); //The last third of the lines form the write stream
+    volatile Word32_t* readptr = static_cast<Word32_t*>(start_address);
+    for (volatile Word32_t* writeptr = splitptr, *endptr = static_cast<Word32_t*>(end_address); writeptr < endptr;) {
+        UNROLL16(val = *readptr++;) UNROLL16(val = *readptr++;) UNROLL16(*writeptr++ = write_val;)
+    }
+    while (readptr < splitptr) { //Leftover lines that do not make up a whole group are only read
+        UNROLL16(val = *readptr++;)
     }
     return 0;
 }
 
 #ifdef HAS_WORD_64
-int32_t xmem::dummy_revStride4Loop_Word64(void* start_address, void* end_address) {
-    register Word64_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word64_t);
-    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(end_address); i < len; i += 128) {
-        UNROLL128(wordptr -= 4;)
-        if (wordptr <= static_cast<Word64_t*>(start_address)) //end, modulo
-            wordptr += len;
+int32_t xmem::forwSequentialMix2to1_Word64(void* start_address, void* end_address) {
+    register Word64_t val;
+    register Word64_t write_val = 0xFFFFFFFFFFFFFFFF;
+    register uintptr_t lines = (reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / CACHE_LINE_SIZE;
+    Word64_t* splitptr = static_cast<Word64_t*>(start_address) + (lines - lines / 3) * (CACHE_LINE_SIZE / sizeof(Word64_t)); //The last third of the lines form the write stream
+    volatile Word64_t* readptr = static_cast<Word64_t*>(start_address);
+    for (volatile Word64_t* writeptr = splitptr, *endptr = static_cast<Word64_t*>(end_address); writeptr < endptr;) {
+        UNROLL8(val = *readptr++;) UNROLL8(val = *readptr++;) UNROLL8(*writeptr++ = write_val;)
+    }
+    while (readptr < splitptr) { //Leftover lines that do not make up a whole group are only read
+        UNROLL8(val = *readptr++;)
     }
     return 0;
 }
 #endif
 
 #ifdef HAS_WORD_128
-int32_t xmem::dummy_revStride4Loop_Word128(void* start_address, void* end_address) {
+int32_t xmem::forwSequentialMix2to1_Word128(void* start_address, void* end_address) {
 #if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_dummy_revStride4Loop_Word128(static_cast<Word128_t*>(end_address), static_cast<Word128_t*>(start_address));
+    Word128_t val = _mm_setzero_si128(); //The loads are folded into the returned value so that the compiler keeps them without volatile vector accesses
+    Word128_t write_val = my_64b_set_128b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF);
+    uintptr_t lines = (reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / CACHE_LINE_SIZE;
+    Word128_t* splitptr = static_cast<Word128_t*>(start_address) + (lines - lines / 3) * (CACHE_LINE_SIZE / sizeof(Word128_t)); //The last third of the lines form the write stream
+    Word128_t* readptr = static_cast<Word128_t*>(start_address);
+    for (Word128_t* writeptr = splitptr, *endptr = static_cast<Word128_t*>(end_address); writeptr < endptr;) {
+        UNROLL4(val = _mm_xor_si128(val, _mm_load_si128(readptr++));) UNROLL4(val = _mm_xor_si128(val, _mm_load_si128(readptr++));) UNROLL4(_mm_store_si128(writeptr++, write_val);)
+    }
+    while (readptr < splitptr) { //Leftover lines that do not make up a whole group are only read
+        UNROLL4(val = _mm_xor_si128(val, _mm_load_si128(readptr++));)
+    }
+    return _mm_movemask_epi8(val);
 #else
-    register Word128_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word128_t);
-    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(end_address); i < len; i += 64) {
-        UNROLL64(wordptr -= 4;)
-        if (wordptr <= static_cast<Word128_t*>(start_address)) //end, modulo
-            wordptr += len;
+    register Word128_t val;
+    register Word128_t write_val;
+    write_val = my_64b_set_128b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF);
+    register uintptr_t lines = (reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / CACHE_LINE_SIZE;
+    Word128_t* splitptr = static_cast<Word128_t*>(start_address) + (lines - lines / 3) * (CACHE_LINE_SIZE / sizeof(Word128_t)); //The last third of the lines form the write stream
+    volatile Word128_t* readptr = static_cast<Word128_t*>(start_address);
+    for (volatile Word128_t* writeptr = splitptr, *endptr = static_cast<Word128_t*>(end_address); writeptr < endptr;) {
+        UNROLL4(val = *readptr++;) UNROLL4(val = *readptr++;) UNROLL4(*writeptr++ = write_val;)
+    }
+    while (readptr < splitptr) { //Leftover lines that do not make up a whole group are only read
+        UNROLL4(val = *readptr++;)
     }
     return 0;
 #endif
@@ -1464,87 +4913,169 @@ int32_t xmem::dummy_revStride4Loop_Word128(void* start_address, void* end_addres
 #endif
 
 #ifdef HAS_WORD_256
-int32_t xmem::dummy_revStride4Loop_Word256(void* start_address, void* end_address) {
+int32_t xmem::forwSequentialMix2to1_Word256(void* start_address, void* end_address) {
 #if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_dummy_revStride4Loop_Word256(static_cast<Word256_t*>(end_address), static_cast<Word256_t*>(start_address));
+    __m256d val = _mm256_setzero_pd(); //The loads are folded into the returned value so that the compiler keeps them without volatile vector accesses
+    __m256d write_val = _mm256_castsi256_pd(my_64b_set_256b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF));
+    uintptr_t lines = (reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / CACHE_LINE_SIZE;
+    Word256_t* splitptr = static_cast<Word256_t*>(start_address) + (lines - lines / 3) * (CACHE_LINE_SIZE / sizeof(Word256_t)); //The last third of the lines form the write stream
+    Word256_t* readptr = static_cast<Word256_t*>(start_address);
+    for (Word256_t* writeptr = splitptr, *endptr = static_cast<Word256_t*>(end_address); writeptr < endptr;) {
+        UNROLL2(val = _mm256_xor_pd(val, _mm256_load_pd(reinterpret_cast<const double*>(readptr++)));) UNROLL2(val = _mm256_xor_pd(val, _mm256_load_pd(reinterpret_cast<const double*>(readptr++)));) UNROLL2(_mm256_store_pd(reinterpret_cast<double*>(writeptr++), write_val);)
+    }
+    while (readptr < splitptr) { //Leftover lines that do not make up a whole group are only read
+        UNROLL2(val = _mm256_xor_pd(val, _mm256_load_pd(reinterpret_cast<const double*>(readptr++)));)
+    }
+    return _mm256_movemask_pd(val);
 #else
-    register Word256_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word256_t);
-    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(end_address); i < len; i += 32) {
-        UNROLL32(wordptr -= 4;)
-        if (wordptr <= static_cast<Word256_t*>(start_address)) //end, modulo
-            wordptr += len;
+    register Word256_t val;
+    register Word256_t write_val;
+    write_val = my_64b_set_256b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF);
+    register uintptr_t lines = (reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / CACHE_LINE_SIZE;
+    Word256_t* splitptr = static_cast<Word256_t*>(start_address) + (lines - lines / 3) * (CACHE_LINE_SIZE / sizeof(Word256_t)); //The last third of the lines form the write stream
+    volatile Word256_t* readptr = static_cast<Word256_t*>(start_address);
+    for (volatile Word256_t* writeptr = splitptr, *endptr = static_cast<Word256_t*>(end_address); writeptr < endptr;) {
+        UNROLL2(val = *readptr++;) UNROLL2(val = *readptr++;) UNROLL2(*writeptr++ = write_val;)
+    }
+    while (readptr < splitptr) { //Leftover lines that do not make up a whole group are only read
+        UNROLL2(val = *readptr++;)
     }
     return 0;
 #endif
 }
 #endif
 
-#ifdef HAS_WORD_512
-#ifdef _WIN32
-int32_t xmem::dummy_revStride4Loop_Word512(void* start_address, void* end_address) {
+int32_t xmem::forwSequentialMix3to1_Word32(void* start_address, void* end_address) {
+    register Word32_t val;
+    register Word32_t write_val = 0xFFFFFFFF;
+    register uintptr_t lines = (reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / CACHE_LINE_SIZE;
+    Word32_t* splitptr = static_cast<Word32_t*>(start_address) + (lines - lines / 4) * (CACHE_LINE_SIZE / sizeof(Word32_t)); //The last quarter of the lines form the write stream
+    volatile Word32_t* readptr = static_cast<Word32_t*>(start_address);
+    for (volatile Word32_t* writeptr = splitptr, *endptr = static_cast<Word32_t*>(end_address); writeptr < endptr;) {
+        UNROLL16(val = *readptr++;) UNROLL16(val = *readptr++;) UNROLL16(val = *readptr++;) UNROLL16(*writeptr++ = write_val;)
+    }
+    while (readptr < splitptr) { //Leftover lines that do not make up a whole group are only read
+        UNROLL16(val = *readptr++;)
+    }
+    return 0;
+}
+
+#ifdef HAS_WORD_64
+int32_t xmem::forwSequentialMix3to1_Word64(void* start_address, void* end_address) {
+    register Word64_t val;
+    register Word64_t write_val = 0xFFFFFFFFFFFFFFFF;
+    register uintptr_t lines = (reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / CACHE_LINE_SIZE;
+    Word64_t* splitptr = static_cast<Word64_t*>(start_address) + (lines - lines / 4) * (CACHE_LINE_SIZE / sizeof(Word64_t)); //The last quarter of the lines form the write stream
+    volatile Word64_t* readptr = static_cast<Word64_t*>(start_address);
+    for (volatile Word64_t* writeptr = splitptr, *endptr = static_cast<Word64_t*>(end_address); writeptr < endptr;) {
+        UNROLL8(val = *readptr++;) UNROLL8(val = *readptr++;) UNROLL8(val = *readptr++;) UNROLL8(*writeptr++ = write_val;)
+    }
+    while (readptr < splitptr) { //Leftover lines that do not make up a whole group are only read
+        UNROLL8(val = *readptr++;)
+    }
+    return 0;
+}
+#endif
+
+#ifdef HAS_WORD_128
+int32_t xmem::forwSequentialMix3to1_Word128(void* start_address, void* end_address) {
+#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
+    Word128_t val = _mm_setzero_si128(); //The loads are folded into the returned value so that the compiler keeps them without volatile vector accesses
+    Word128_t write_val = my_64b_set_128b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF);
+    uintptr_t lines = (reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / CACHE_LINE_SIZE;
+    Word128_t* splitptr = static_cast<Word128_t*>(start_address) + (lines - lines / 4) * (CACHE_LINE_SIZE / sizeof(Word128_t)); //The last quarter of the lines form the write stream
+    Word128_t* readptr = static_cast<Word128_t*>(start_address);
+    for (Word128_t* writeptr = splitptr, *endptr = static_cast<Word128_t*>(end_address); writeptr < endptr;) {
+        UNROLL4(val = _mm_xor_si128(val, _mm_load_si128(readptr++));) UNROLL4(val = _mm_xor_si128(val, _mm_load_si128(readptr++));) UNROLL4(val = _mm_xor_si128(val, _mm_load_si128(readptr++));) UNROLL4(_mm_store_si128(writeptr++, write_val);)
+    }
+    while (readptr < splitptr) { //Leftover lines that do not make up a whole group are only read
+        UNROLL4(val = _mm_xor_si128(val, _mm_load_si128(readptr++));)
+    }
+    return _mm_movemask_epi8(val);
 #else
-//FIXME: We flag GCC/ICC not to optimize this function. The problem is that my_512b_load() -- which maps to _mm512_load_epi64 Intel AVX-512/KNC intrinsic -- cannot accept volatile* arguments. The only way to prevent the entire benchmark loop from being optimized away is to force the compiler not to optimize the function at all. Unfortunately, this will cause extra unwanted code to be included. The only solution seems to be to write inline assembly or allow eventual support for assignment of __m512i variables, e.g., val = *wordptr++; which is how the code for the other word sizes is written.
-int32_t __attribute__((optimize("O0"))) xmem::dummy_revStride4Loop_Word512(void* start_address, void* end_address) { 
+    register Word128_t val;
+    register Word128_t write_val;
+    write_val = my_64b_set_128b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF);
+    register uintptr_t lines = (reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / CACHE_LINE_SIZE;
+    Word128_t* splitptr = static_cast<Word128_t*>(start_address) + (lines - lines / 4) * (CACHE_LINE_SIZE / sizeof(Word128_t)); //The last quarter of the lines form the write stream
+    volatile Word128_t* readptr = static_cast<Word128_t*>(start_address);
+    for (volatile Word128_t* writeptr = splitptr, *endptr = static_cast<Word128_t*>(end_address); writeptr < endptr;) {
+        UNROLL4(val = *readptr++;) UNROLL4(val = *readptr++;) UNROLL4(val = *readptr++;) UNROLL4(*writeptr++ = write_val;)
+    }
+    while (readptr < splitptr) { //Leftover lines that do not make up a whole group are only read
+        UNROLL4(val = *readptr++;)
+    }
+    return 0;
+#endif
+}
 #endif
+
+#ifdef HAS_WORD_256
+int32_t xmem::forwSequentialMix3to1_Word256(void* start_address, void* end_address) {
 #if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    //return win_x86_64_asm_dummy_revStride4Loop_Word512(static_cast<Word512_t*>(end_address), static_cast<Word512_t*>(start_address));
-    #error 512-bit words are not currently supported on Windows.
+    __m256d val = _mm256_setzero_pd(); //The loads are folded into the returned value so that the compiler keeps them without volatile vector accesses
+    __m256d write_val = _mm256_castsi256_pd(my_64b_set_256b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF));
+    uintptr_t lines = (reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / CACHE_LINE_SIZE;
+    Word256_t* splitptr = static_cast<Word256_t*>(start_address) + (lines - lines / 4) * (CACHE_LINE_SIZE / sizeof(Word256_t)); //The last quarter of the lines form the write stream
+    Word256_t* readptr = static_cast<Word256_t*>(start_address);
+    for (Word256_t* writeptr = splitptr, *endptr = static_cast<Word256_t*>(end_address); writeptr < endptr;) {
+        UNROLL2(val = _mm256_xor_pd(val, _mm256_load_pd(reinterpret_cast<const double*>(readptr++)));) UNROLL2(val = _mm256_xor_pd(val, _mm256_load_pd(reinterpret_cast<const double*>(readptr++)));) UNROLL2(val = _mm256_xor_pd(val, _mm256_load_pd(reinterpret_cast<const double*>(readptr++)));) UNROLL2(_mm256_store_pd(reinterpret_cast<double*>(writeptr++), write_val);)
+    }
+    while (readptr < splitptr) { //Leftover lines that do not make up a whole group are only read
+        UNROLL2(val = _mm256_xor_pd(val, _mm256_load_pd(reinterpret_cast<const double*>(readptr++)));)
+    }
+    return _mm256_movemask_pd(val);
 #else
-    register Word512_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word512_t);
-    for (Word512_t* wordptr = static_cast<Word512_t*>(end_address); i < len; i += 16) {
-        UNROLL16(wordptr -= 4;)
-        if (wordptr <= static_cast<Word512_t*>(start_address)) //end, modulo
-            wordptr += len;
+    register Word256_t val;
+    register Word256_t write_val;
+    write_val = my_64b_set_256b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF);
+    register uintptr_t lines = (reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / CACHE_LINE_SIZE;
+    Word256_t* splitptr = static_cast<Word256_t*>(start_address) + (lines - lines / 4) * (CACHE_LINE_SIZE / sizeof(Word256_t)); //The last quarter of the lines form the write stream
+    volatile Word256_t* readptr = static_cast<Word256_t*>(start_address);
+    for (volatile Word256_t* writeptr = splitptr, *endptr = static_cast<Word256_t*>(end_address); writeptr < endptr;) {
+        UNROLL2(val = *readptr++;) UNROLL2(val = *readptr++;) UNROLL2(val = *readptr++;) UNROLL2(*writeptr++ = write_val;)
+    }
+    while (readptr < splitptr) { //Leftover lines that do not make up a whole group are only read
+        UNROLL2(val = *readptr++;)
     }
     return 0;
 #endif
 }
 #endif
 
-/* ------------ STRIDE 8 LOOP --------------*/
+/* ------------ SEQUENTIAL READ-MODIFY-WRITE --------------*/
 
-int32_t xmem::dummy_forwStride8Loop_Word32(void* start_address, void* end_address) {
-    register Word32_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word32_t);
-    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(start_address); i < len; i += 128) {
-        UNROLL128(wordptr += 8;)
-        if (wordptr >= static_cast<Word32_t*>(end_address)) //end, modulo
-            wordptr -= len;
+int32_t xmem::forwSequentialReadModifyWrite_Word32(void* start_address, void* end_address) {
+    register Word32_t val = 0xFFFFFFFF; 
+    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(start_address), *endptr = static_cast<Word32_t*>(end_address); wordptr < endptr;) {
+        UNROLL1024(*wordptr++ ^= val;) 
     }
     return 0;
 }
 
 #ifdef HAS_WORD_64
-int32_t xmem::dummy_forwStride8Loop_Word64(void* start_address, void* end_address) {
-    register Word64_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word64_t);
-    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(start_address); i < len; i += 64) {
-        UNROLL64(wordptr += 8;)
-        if (wordptr >= static_cast<Word64_t*>(end_address)) //end, modulo
-            wordptr -= len;
+int32_t xmem::forwSequentialReadModifyWrite_Word64(void* start_address, void* end_address) {
+    register Word64_t val = 0xFFFFFFFFFFFFFFFF; 
+    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(start_address), *endptr = static_cast<Word64_t*>(end_address); wordptr < endptr;) {
+        UNROLL512(*wordptr++ ^= val;) 
     }
     return 0;
 }
 #endif
 
 #ifdef HAS_WORD_128
-int32_t xmem::dummy_forwStride8Loop_Word128(void* start_address, void* end_address) {
+int32_t xmem::forwSequentialReadModifyWrite_Word128(void* start_address, void* end_address) { 
 #if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_dummy_forwStride8Loop_Word128(static_cast<Word128_t*>(start_address), static_cast<Word128_t*>(end_address));
+    Word128_t val = my_64b_set_128b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF);
+    for (Word128_t* wordptr = static_cast<Word128_t*>(start_address), *endptr = static_cast<Word128_t*>(end_address); wordptr < endptr;) {
+        UNROLL256(my_128b_xor_in_place(wordptr, val); wordptr++;) 
+    }
+    return 0;
 #else
-    register Word128_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word128_t);
-    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(start_address); i < len; i += 32) {
-        UNROLL32(wordptr += 8;)
-        if (wordptr >= static_cast<Word128_t*>(end_address)) //end, modulo
-            wordptr -= len;
+    register Word128_t val;
+    val = my_64b_set_128b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF);
+    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(start_address), *endptr = static_cast<Word128_t*>(end_address); wordptr < endptr;) {
+        UNROLL256(*wordptr++ ^= val;) 
     }
     return 0;
 #endif
@@ -1552,17 +5083,18 @@ int32_t xmem::dummy_forwStride8Loop_Word128(void* start_address, void* end_addre
 #endif
 
 #ifdef HAS_WORD_256
-int32_t xmem::dummy_forwStride8Loop_Word256(void* start_address, void* end_address) {
+int32_t xmem::forwSequentialReadModifyWrite_Word256(void* start_address, void* end_address) {
 #if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_dummy_forwStride8Loop_Word256(static_cast<Word256_t*>(start_address), static_cast<Word256_t*>(end_address));
+    Word256_t val = my_64b_set_256b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF);
+    for (Word256_t* wordptr = static_cast<Word256_t*>(start_address), *endptr = static_cast<Word256_t*>(end_address); wordptr < endptr;) {
+        UNROLL128(my_256b_xor_in_place(wordptr, val); wordptr++;) 
+    }
+    return 0;
 #else
-    register Word256_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word256_t);
-    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(start_address); i < len; i += 16) {
-        UNROLL16(wordptr += 8;)
-        if (wordptr >= static_cast<Word256_t*>(end_address)) //end, modulo
-            wordptr -= len;
+    register Word256_t val;
+    val = my_64b_set_256b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF);
+    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(start_address), *endptr = static_cast<Word256_t*>(end_address); wordptr < endptr;) {
+        UNROLL128(*wordptr++ ^= val;) 
     }
     return 0;
 #endif
@@ -1571,66 +5103,56 @@ int32_t xmem::dummy_forwStride8Loop_Word256(void* start_address, void* end_addre
 
 #ifdef HAS_WORD_512
 #ifdef _WIN32
-int32_t xmem::dummy_forwStride8Loop_Word512(void* start_address, void* end_address) {
+int32_t xmem::forwSequentialReadModifyWrite_Word512(void* start_address, void* end_address) {
 #else
 //FIXME: We flag GCC/ICC not to optimize this function. The problem is that my_512b_load() -- which maps to _mm512_load_epi64 Intel AVX-512/KNC intrinsic -- cannot accept volatile* arguments. The only way to prevent the entire benchmark loop from being optimized away is to force the compiler not to optimize the function at all. Unfortunately, this will cause extra unwanted code to be included. The only solution seems to be to write inline assembly or allow eventual support for assignment of __m512i variables, e.g., val = *wordptr++; which is how the code for the other word sizes is written.
-int32_t __attribute__((optimize("O0"))) xmem::dummy_forwStride8Loop_Word512(void* start_address, void* end_address) { 
+int32_t __attribute__((optimize("O0"))) xmem::forwSequentialReadModifyWrite_Word512(void* start_address, void* end_address) { 
 #endif
 #if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    //return win_x86_64_asm_dummy_forwStride8Loop_Word512(static_cast<Word512_t*>(start_address), static_cast<Word512_t*>(end_address));
-    #error 512-bit words are not currently supported on Windows.
+    #error 512-bit words are not supported on Windows.
 #else
-    register Word512_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word512_t);
-    for (Word512_t* wordptr = static_cast<Word512_t*>(start_address); i < len; i += 8) {
-        UNROLL8(wordptr += 8;)
-        if (wordptr >= static_cast<Word512_t*>(end_address)) //end, modulo
-            wordptr -= len;
+    register Word512_t val;
+    uint64_t scratchptr[8] __attribute__ ((aligned(512)));
+    my_64b_set_512b_word(val, scratchptr, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF);
+    for (Word512_t* wordptr = static_cast<Word512_t*>(start_address), *endptr = static_cast<Word512_t*>(end_address); wordptr < endptr;) {
+        UNROLL64(*wordptr++ ^= val;) 
     }
     return 0;
 #endif
 }
 #endif
 
-int32_t xmem::dummy_revStride8Loop_Word32(void* start_address, void* end_address) { 
-    register Word32_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word32_t);
-    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(end_address); i < len; i += 128) {
-        UNROLL128(wordptr -= 8;)
-        if (wordptr <= static_cast<Word32_t*>(start_address)) //end, modulo
-            wordptr += len;
-    }
-    return 0;
-}
-
-#ifdef HAS_WORD_64
-int32_t xmem::dummy_revStride8Loop_Word64(void* start_address, void* end_address) { 
-    register Word64_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word64_t);
-    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(end_address); i < len; i += 64) {
-        UNROLL64(wordptr -= 8;)
-        if (wordptr <= static_cast<Word64_t*>(start_address)) //end, modulo
-            wordptr += len;
+int32_t xmem::revSequentialReadModifyWrite_Word32(void* start_address, void* end_address) {
+    register Word32_t val = 0xFFFFFFFF;
+    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(end_address), *begptr = static_cast<Word32_t*>(start_address); wordptr > begptr;) {
+        UNROLL1024(*wordptr-- ^= val;)
+    }
+    return 0;
+}
+
+#ifdef HAS_WORD_64
+int32_t xmem::revSequentialReadModifyWrite_Word64(void* start_address, void* end_address) {
+    register Word64_t val = 0xFFFFFFFFFFFFFFFF;
+    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(end_address), *begptr = static_cast<Word64_t*>(start_address); wordptr > begptr;) {
+        UNROLL512(*wordptr-- ^= val;)
     }
     return 0;
 }
 #endif
 
 #ifdef HAS_WORD_128
-int32_t xmem::dummy_revStride8Loop_Word128(void* start_address, void* end_address) { 
+int32_t xmem::revSequentialReadModifyWrite_Word128(void* start_address, void* end_address) { 
 #if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_dummy_revStride8Loop_Word128(static_cast<Word128_t*>(end_address), static_cast<Word128_t*>(start_address));
+    Word128_t val = my_64b_set_128b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF);
+    for (Word128_t* wordptr = static_cast<Word128_t*>(end_address), *begptr = static_cast<Word128_t*>(start_address); wordptr > begptr;) {
+        UNROLL256(my_128b_xor_in_place(wordptr, val); wordptr--;)
+    }
+    return 0;
 #else
-    register Word128_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word128_t);
-    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(end_address); i < len; i += 32) {
-        UNROLL32(wordptr -= 8;)
-        if (wordptr <= static_cast<Word128_t*>(start_address)) //end, modulo
-            wordptr += len;
+    register Word128_t val;
+    val = my_64b_set_128b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF);
+    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(end_address), *begptr = static_cast<Word128_t*>(start_address); wordptr > begptr;) {
+        UNROLL256(*wordptr-- ^= val;)
     }
     return 0;
 #endif
@@ -1638,17 +5160,18 @@ int32_t xmem::dummy_revStride8Loop_Word128(void* start_address, void* end_addres
 #endif
 
 #ifdef HAS_WORD_256
-int32_t xmem::dummy_revStride8Loop_Word256(void* start_address, void* end_address) { 
+int32_t xmem::revSequentialReadModifyWrite_Word256(void* start_address, void* end_address) {
 #if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_dummy_revStride8Loop_Word256(static_cast<Word256_t*>(end_address), static_cast<Word256_t*>(start_address));
+    Word256_t val = my_64b_set_256b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF);
+    for (Word256_t* wordptr = static_cast<Word256_t*>(end_address), *begptr = static_cast<Word256_t*>(start_address); wordptr > begptr;) {
+        UNROLL128(my_256b_xor_in_place(wordptr, val); wordptr--;)
+    }
+    return 0;
 #else
-    register Word256_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word256_t);
-    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(end_address); i < len; i += 16) {
-        UNROLL16(wordptr -= 8;)
-        if (wordptr <= static_cast<Word256_t*>(start_address)) //end, modulo
-            wordptr += len;
+    register Word256_t val;
+    val = my_64b_set_256b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF);
+    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(end_address), *begptr = static_cast<Word256_t*>(start_address); wordptr > begptr;) {
+        UNROLL128(*wordptr-- ^= val;)
     }
     return 0;
 #endif
@@ -1657,36 +5180,33 @@ int32_t xmem::dummy_revStride8Loop_Word256(void* start_address, void* end_addres
 
 #ifdef HAS_WORD_512
 #ifdef _WIN32
-int32_t xmem::dummy_revStride8Loop_Word512(void* start_address, void* end_address) {
+int32_t xmem::revSequentialReadModifyWrite_Word512(void* start_address, void* end_address) {
 #else
 //FIXME: We flag GCC/ICC not to optimize this function. The problem is that my_512b_load() -- which maps to _mm512_load_epi64 Intel AVX-512/KNC intrinsic -- cannot accept volatile* arguments. The only way to prevent the entire benchmark loop from being optimized away is to force the compiler not to optimize the function at all. Unfortunately, this will cause extra unwanted code to be included. The only solution seems to be to write inline assembly or allow eventual support for assignment of __m512i variables, e.g., val = *wordptr++; which is how the code for the other word sizes is written.
-int32_t __attribute__((optimize("O0"))) xmem::dummy_revStride8Loop_Word512(void* start_address, void* end_address) { 
+int32_t __attribute__((optimize("O0"))) xmem::revSequentialReadModifyWrite_Word512(void* start_address, void* end_address) { 
 #endif
 #if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    //return win_x86_64_asm_dummy_revStride8Loop_Word512(static_cast<Word512_t*>(end_address), static_cast<Word512_t*>(start_address));
-    #error 512-bit words are not currently supported on Windows.
+    #error 512-bit words are not supported on Windows.
 #else
-    register Word512_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word512_t);
-    for (volatile Word512_t* wordptr = static_cast<Word512_t*>(end_address); i < len; i += 8) {
-        UNROLL8(wordptr -= 8;)
-        if (wordptr <= static_cast<Word512_t*>(start_address)) //end, modulo
-            wordptr += len;
+    register Word512_t val;
+    uint64_t scratchptr[8] __attribute__ ((aligned(512)));
+    my_64b_set_512b_word(val, scratchptr, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF);
+    for (Word512_t* wordptr = static_cast<Word512_t*>(end_address), *begptr = static_cast<Word512_t*>(start_address); wordptr > begptr;) {
+        UNROLL64(*wordptr-- ^= val;)
     }
     return 0;
 #endif
 }
 #endif
 
-/* ------------ STRIDE 16 LOOP --------------*/
+/* ------------ STRIDE 2 READ-MODIFY-WRITE --------------*/
 
-int32_t xmem::dummy_forwStride16Loop_Word32(void* start_address, void* end_address) { 
-    register Word32_t val; 
+int32_t xmem::forwStride2ReadModifyWrite_Word32(void* start_address, void* end_address) {
+    register Word32_t val = 0xFFFFFFFF; 
     register uint32_t i = 0;
     register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word32_t);
-    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(start_address); i < len; i += 64) {
-        UNROLL64(wordptr += 16;)
+    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(start_address); i < len; i += 512) {
+        UNROLL512(*wordptr ^= val; wordptr += 2;)
         if (wordptr >= static_cast<Word32_t*>(end_address)) //end, modulo
             wordptr -= len;
     }
@@ -1694,12 +5214,12 @@ int32_t xmem::dummy_forwStride16Loop_Word32(void* start_address, void* end_addre
 }
 
 #ifdef HAS_WORD_64
-int32_t xmem::dummy_forwStride16Loop_Word64(void* start_address, void* end_address) { 
-    register Word64_t val; 
+int32_t xmem::forwStride2ReadModifyWrite_Word64(void* start_address, void* end_address) {
+    register Word64_t val = 0xFFFFFFFFFFFFFFFF; 
     register uint32_t i = 0;
     register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word64_t);
-    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(start_address); i < len; i += 32) {
-        UNROLL32(wordptr += 16;)
+    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(start_address); i < len; i += 256) {
+        UNROLL256(*wordptr ^= val; wordptr += 2;)
         if (wordptr >= static_cast<Word64_t*>(end_address)) //end, modulo
             wordptr -= len;
     }
@@ -1708,15 +5228,24 @@ int32_t xmem::dummy_forwStride16Loop_Word64(void* start_address, void* end_addre
 #endif
 
 #ifdef HAS_WORD_128
-int32_t xmem::dummy_forwStride16Loop_Word128(void* start_address, void* end_address) { 
+int32_t xmem::forwStride2ReadModifyWrite_Word128(void* start_address, void* end_address) { 
 #if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_dummy_forwStride16Loop_Word128(static_cast<Word128_t*>(start_address), static_cast<Word128_t*>(end_address));
+    Word128_t val = my_64b_set_128b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF);
+    uint32_t i = 0;
+    uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word128_t);
+    for (Word128_t* wordptr = static_cast<Word128_t*>(start_address); i < len; i += 128) {
+        UNROLL128(my_128b_xor_in_place(wordptr, val); wordptr += 2;)
+        if (wordptr >= static_cast<Word128_t*>(end_address)) //end, modulo
+            wordptr -= len;
+    }
+    return 0;
 #else
-    register Word128_t val; 
+    register Word128_t val;
+    val = my_64b_set_128b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF);
     register uint32_t i = 0;
     register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word128_t);
-    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(start_address); i < len; i += 16) {
-        UNROLL16(wordptr += 16;)
+    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(start_address); i < len; i += 128) {
+        UNROLL128(*wordptr ^= val; wordptr += 2;)
         if (wordptr >= static_cast<Word128_t*>(end_address)) //end, modulo
             wordptr -= len;
     }
@@ -1726,15 +5255,24 @@ int32_t xmem::dummy_forwStride16Loop_Word128(void* start_address, void* end_addr
 #endif
 
 #ifdef HAS_WORD_256
-int32_t xmem::dummy_forwStride16Loop_Word256(void* start_address, void* end_address) { 
+int32_t xmem::forwStride2ReadModifyWrite_Word256(void* start_address, void* end_address) { 
 #if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_dummy_forwStride16Loop_Word256(static_cast<Word256_t*>(start_address), static_cast<Word256_t*>(end_address));
+    Word256_t val = my_64b_set_256b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF);
+    uint32_t i = 0;
+    uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word256_t);
+    for (Word256_t* wordptr = static_cast<Word256_t*>(start_address); i < len; i += 64) {
+        UNROLL64(my_256b_xor_in_place(wordptr, val); wordptr += 2;)
+        if (wordptr >= static_cast<Word256_t*>(end_address)) //end, modulo
+            wordptr -= len;
+    }
+    return 0;
 #else
-    register Word256_t val; 
+    register Word256_t val;
+    val = my_64b_set_256b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF);
     register uint32_t i = 0;
     register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word256_t);
-    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(start_address); i < len; i += 8) {
-        UNROLL8(wordptr += 16;)
+    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(start_address); i < len; i += 64) {
+        UNROLL64(*wordptr ^= val; wordptr += 2;)
         if (wordptr >= static_cast<Word256_t*>(end_address)) //end, modulo
             wordptr -= len;
     }
@@ -1745,20 +5283,21 @@ int32_t xmem::dummy_forwStride16Loop_Word256(void* start_address, void* end_addr
 
 #ifdef HAS_WORD_512
 #ifdef _WIN32
-int32_t xmem::dummy_forwStride16Loop_Word512(void* start_address, void* end_address) {
+int32_t xmem::forwStride2ReadModifyWrite_Word512(void* start_address, void* end_address) {
 #else
 //FIXME: We flag GCC/ICC not to optimize this function. The problem is that my_512b_load() -- which maps to _mm512_load_epi64 Intel AVX-512/KNC intrinsic -- cannot accept volatile* arguments. The only way to prevent the entire benchmark loop from being optimized away is to force the compiler not to optimize the function at all. Unfortunately, this will cause extra unwanted code to be included. The only solution seems to be to write inline assembly or allow eventual support for assignment of __m512i variables, e.g., val = *wordptr++; which is how the code for the other word sizes is written.
-int32_t __attribute__((optimize("O0"))) xmem::dummy_forwStride16Loop_Word512(void* start_address, void* end_address) { 
+int32_t __attribute__((optimize("O0"))) xmem::forwStride2ReadModifyWrite_Word512(void* start_address, void* end_address) { 
 #endif
 #if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    //return win_x86_64_asm_dummy_forwStride16Loop_Word512(static_cast<Word512_t*>(start_address), static_cast<Word512_t*>(end_address));
-    #error 512-bit words are not currently supported on Windows.
+    #error 512-bit words are not supported on Windows.
 #else
-    register Word512_t val; 
+    register Word512_t val;
+    uint64_t scratchptr[8] __attribute__ ((aligned(512)));
+    my_64b_set_512b_word(val, scratchptr, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF);
     register uint32_t i = 0;
     register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word512_t);
-    for (volatile Word512_t* wordptr = static_cast<Word512_t*>(start_address); i < len; i += 4) {
-        UNROLL4(wordptr += 16;)
+    for (Word512_t* wordptr = static_cast<Word512_t*>(start_address); i < len; i += 32) {
+        UNROLL32(*wordptr ^= val; wordptr += 2;)
         if (wordptr >= static_cast<Word512_t*>(end_address)) //end, modulo
             wordptr -= len;
     }
@@ -1767,12 +5306,12 @@ int32_t __attribute__((optimize("O0"))) xmem::dummy_forwStride16Loop_Word512(voi
 }
 #endif
 
-int32_t xmem::dummy_revStride16Loop_Word32(void* start_address, void* end_address) { 
-    register Word32_t val; 
+int32_t xmem::revStride2ReadModifyWrite_Word32(void* start_address, void* end_address) { 
+    register Word32_t val = 0xFFFFFFFF; 
     register uint32_t i = 0;
     register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word32_t);
-    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(end_address); i < len; i += 64) {
-        UNROLL64(wordptr -= 16;)
+    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(end_address); i < len; i += 512) {
+        UNROLL512(*wordptr ^= val; wordptr -= 2;)
         if (wordptr <= static_cast<Word32_t*>(start_address)) //end, modulo
             wordptr += len;
     }
@@ -1780,12 +5319,12 @@ int32_t xmem::dummy_revStride16Loop_Word32(void* start_address, void* end_addres
 }
 
 #ifdef HAS_WORD_64
-int32_t xmem::dummy_revStride16Loop_Word64(void* start_address, void* end_address) { 
-    register Word64_t val; 
+int32_t xmem::revStride2ReadModifyWrite_Word64(void* start_address, void* end_address) { 
+    register Word64_t val = 0xFFFFFFFFFFFFFFFF; 
     register uint32_t i = 0;
     register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word64_t);
-    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(end_address); i < len; i += 32) {
-        UNROLL32(wordptr -= 16;)
+    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(end_address); i < len; i += 256) {
+        UNROLL256(*wordptr ^= val; wordptr -= 2;)
         if (wordptr <= static_cast<Word64_t*>(start_address)) //end, modulo
             wordptr += len;
     }
@@ -1794,15 +5333,24 @@ int32_t xmem::dummy_revStride16Loop_Word64(void* start_address, void* end_addres
 #endif
 
 #ifdef HAS_WORD_128
-int32_t xmem::dummy_revStride16Loop_Word128(void* start_address, void* end_address) { 
+int32_t xmem::revStride2ReadModifyWrite_Word128(void* start_address, void* end_address) { 
 #if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_dummy_revStride16Loop_Word128(static_cast<Word128_t*>(end_address), static_cast<Word128_t*>(start_address));
+    Word128_t val = my_64b_set_128b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF); 
+    uint32_t i = 0;
+    uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word128_t);
+    for (Word128_t* wordptr = static_cast<Word128_t*>(end_address); i < len; i += 128) {
+        UNROLL128(my_128b_xor_in_place(wordptr, val); wordptr -= 2;)
+        if (wordptr <= static_cast<Word128_t*>(start_address)) //end, modulo
+            wordptr += len;
+    }
+    return 0;
 #else
-    register Word128_t val; 
+    register Word128_t val;
+    val = my_64b_set_128b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF); 
     register uint32_t i = 0;
     register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word128_t);
-    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(end_address); i < len; i += 16) {
-        UNROLL16(wordptr -= 16;)
+    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(end_address); i < len; i += 128) {
+        UNROLL128(*wordptr ^= val; wordptr -= 2;)
         if (wordptr <= static_cast<Word128_t*>(start_address)) //end, modulo
             wordptr += len;
     }
@@ -1812,40 +5360,25 @@ int32_t xmem::dummy_revStride16Loop_Word128(void* start_address, void* end_addre
 #endif
 
 #ifdef HAS_WORD_256
-int32_t xmem::dummy_revStride16Loop_Word256(void* start_address, void* end_address) { 
+int32_t xmem::revStride2ReadModifyWrite_Word256(void* start_address, void* end_address) { 
 #if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_dummy_revStride16Loop_Word256(static_cast<Word256_t*>(end_address), static_cast<Word256_t*>(start_address));
-#else
-    register Word256_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word256_t);
-    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(end_address); i < len; i += 8) {
-        UNROLL8(wordptr -= 16;)
+    Word256_t val = my_64b_set_256b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF); 
+    uint32_t i = 0;
+    uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word256_t);
+    for (Word256_t* wordptr = static_cast<Word256_t*>(end_address); i < len; i += 64) {
+        UNROLL64(my_256b_xor_in_place(wordptr, val); wordptr -= 2;)
         if (wordptr <= static_cast<Word256_t*>(start_address)) //end, modulo
             wordptr += len;
     }
     return 0;
-#endif
-}
-#endif
-
-#ifdef HAS_WORD_512
-#ifdef _WIN32
-int32_t xmem::dummy_revStride16Loop_Word512(void* start_address, void* end_address) {
-#else
-//FIXME: We flag GCC/ICC not to optimize this function. The problem is that my_512b_load() -- which maps to _mm512_load_epi64 Intel AVX-512/KNC intrinsic -- cannot accept volatile* arguments. The only way to prevent the entire benchmark loop from being optimized away is to force the compiler not to optimize the function at all. Unfortunately, this will cause extra unwanted code to be included. The only solution seems to be to write inline assembly or allow eventual support for assignment of __m512i variables, e.g., val = *wordptr++; which is how the code for the other word sizes is written.
-int32_t __attribute__((optimize("O0"))) xmem::dummy_revStride16Loop_Word512(void* start_address, void* end_address) { 
-#endif
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    //return win_x86_64_asm_dummy_revStride16Loop_Word512(static_cast<Word512_t*>(end_address), static_cast<Word512_t*>(start_address));
-    #error 512-bit words are not supported on Windows.
 #else
-    register Word512_t val; 
+    register Word256_t val;
+    val = my_64b_set_256b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF); 
     register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word512_t);
-    for (volatile Word512_t* wordptr = static_cast<Word512_t*>(end_address); i < len; i += 4) {
-        UNROLL4(wordptr -= 16;)
-        if (wordptr <= static_cast<Word512_t*>(start_address)) //end, modulo
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word256_t);
+    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(end_address); i < len; i += 64) {
+        UNROLL64(*wordptr ^= val; wordptr -= 2;)
+        if (wordptr <= static_cast<Word256_t*>(start_address)) //end, modulo
             wordptr += len;
     }
     return 0;
@@ -1853,132 +5386,80 @@ int32_t __attribute__((optimize("O0"))) xmem::dummy_revStride16Loop_Word512(void
 }
 #endif
 
-/* ------------ RANDOM LOOP --------------*/
-
-#ifndef HAS_WORD_64 //special case: 32-bit architectures
-int32_t xmem::dummy_randomLoop_Word32(uintptr_t*, uintptr_t**, size_t len) {
-    volatile uintptr_t* placeholder = NULL; //Try to defeat compiler optimizations removing this method
-    return 0;
-}
-#endif
-
-#ifdef HAS_WORD_64
-int32_t xmem::dummy_randomLoop_Word64(uintptr_t*, uintptr_t**, size_t len) {
-    volatile uintptr_t* placeholder = NULL; //Try to defeat compiler optimizations removing this method
-    return 0;
-}
-#endif
-
-#ifdef HAS_WORD_128
-int32_t xmem::dummy_randomLoop_Word128(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len) {
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return 0; //TODO: Implement for Windows.
-#else
-    //TODO: check that the compiler generates this code correctly
-    volatile Word128_t* placeholder = reinterpret_cast<Word128_t*>(first_address);
-    register Word128_t val;
-    volatile uintptr_t val_extract;
-    val = my_64b_set_128b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF);
-
-#ifdef HAS_WORD_64
-    UNROLL256(val_extract = my_64b_extractLSB_128b(val);) //Extract 64 LSB.
-#else //special case: 32-bit machines
-    UNROLL256(val_extract = my_32b_extractLSB_128b(val);) //Extract 32 LSB.
-#endif
-
-    return 0;
-#endif
-}
-#endif
-
-#ifdef HAS_WORD_256
-int32_t xmem::dummy_randomLoop_Word256(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len) {
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return 0; //TODO: Implement for Windows.
-#else
-    //TODO: check that the compiler generates this code correctly
-    volatile Word256_t* placeholder = reinterpret_cast<Word256_t*>(first_address);
-    register Word256_t val;
-    volatile uintptr_t val_extract;
-    val = my_64b_set_256b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF);
-
-#ifdef HAS_WORD_64
-        UNROLL128(val_extract = my_64b_extractLSB_256b(val);) //Extract 64 LSB.
-#else //special case: 32-bit machines
-        UNROLL128(val_extract = my_32b_extractLSB_256b(val);) //Extract 32 LSB.
-#endif
-
-    return 0;
-#endif
-}
-#endif
-
 #ifdef HAS_WORD_512
 #ifdef _WIN32
-int32_t xmem::dummy_randomLoop_Word512(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len) {
+int32_t xmem::revStride2ReadModifyWrite_Word512(void* start_address, void* end_address) {
 #else
 //FIXME: We flag GCC/ICC not to optimize this function. The problem is that my_512b_load() -- which maps to _mm512_load_epi64 Intel AVX-512/KNC intrinsic -- cannot accept volatile* arguments. The only way to prevent the entire benchmark loop from being optimized away is to force the compiler not to optimize the function at all. Unfortunately, this will cause extra unwanted code to be included. The only solution seems to be to write inline assembly or allow eventual support for assignment of __m512i variables, e.g., val = *wordptr++; which is how the code for the other word sizes is written.
-int32_t __attribute__((optimize("O0"))) xmem::dummy_randomLoop_Word512(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len) {
+int32_t __attribute__((optimize("O0"))) xmem::revStride2ReadModifyWrite_Word512(void* start_address, void* end_address) { 
 #endif
 #if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return 0; //TODO: Implement for Windows.
+    #error 512-bit words are not supported on Windows.
 #else
-    //TODO: check that the compiler generates this code correctly
-    volatile Word512_t* placeholder = reinterpret_cast<Word512_t*>(first_address);
     register Word512_t val;
-    volatile uintptr_t val_extract;
-
-    uint64_t scratchptr[8];
+    uint64_t scratchptr[8] __attribute__ ((aligned(512)));
     my_64b_set_512b_word(val, scratchptr, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF);
-    UNROLL64(my_64b_extractLSB_512b(val_extract, scratchptr, val);) //Extract 64 LSB.
-
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word512_t);
+    for (Word512_t* wordptr = static_cast<Word512_t*>(start_address); i < len; i += 32) {
+        UNROLL32(*wordptr ^= val; wordptr += 2;)
+        if (wordptr >= static_cast<Word512_t*>(end_address)) //end, modulo
+            wordptr -= len;
+    }
     return 0;
 #endif
 }
 #endif
 
-/* -------------------- CORE BENCHMARK ROUTINES -------------------------- 
- *
- * These routines access the memory in different ways for each benchmark type.
- * Optimization tricks include:
- *   - register keyword to hint to compiler values that should not be used in memory access
- *   - UNROLL macros to manual loop unrolling. This reduces the relative branch overhead of the loop.
- *     We don't want to benchmark loops, we want to benchmark memory!
- *   - volatile keyword to prevent compiler from optimizing the code and removing instructions that we need.
- *     The compiler is too smart for its own good!
- *   - Hardcoding stride and chunk sizes in each benchmark snippet, so that way they do not have to waste cycles being computed at runtime.
- *     This makes code harder to maintain and to read but ensures more accurate memory benchmarking.
- *
- * ----------------------------------------------------------------------- */
-
-/* ------------ SEQUENTIAL READ --------------*/
-
-int32_t xmem::forwSequentialRead_Word32(void* start_address, void* end_address) {
-    register Word32_t val; 
-    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(start_address), *endptr = static_cast<Word32_t*>(end_address); wordptr < endptr;) {
-        UNROLL1024(val = *wordptr++;) 
+/* ------------ STRIDE 4 READ-MODIFY-WRITE --------------*/
+
+int32_t xmem::forwStride4ReadModifyWrite_Word32(void* start_address, void* end_address) {
+    register Word32_t val = 0xFFFFFFFF; 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word32_t);
+    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(start_address); i < len; i += 256) {
+        UNROLL256(*wordptr ^= val; wordptr += 4;)
+        if (wordptr >= static_cast<Word32_t*>(end_address)) //end, modulo
+            wordptr -= len;
     }
     return 0;
 }
 
 #ifdef HAS_WORD_64
-int32_t xmem::forwSequentialRead_Word64(void* start_address, void* end_address) {
-    register Word64_t val;
-    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(start_address), *endptr = static_cast<Word64_t*>(end_address); wordptr < endptr;) {
-        UNROLL512(val = *wordptr++;)
+int32_t xmem::forwStride4ReadModifyWrite_Word64(void* start_address, void* end_address) {
+    register Word64_t val = 0xFFFFFFFFFFFFFFFF; 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word64_t);
+    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(start_address); i < len; i += 128) {
+        UNROLL128(*wordptr ^= val; wordptr += 4;)
+        if (wordptr >= static_cast<Word64_t*>(end_address)) //end, modulo
+            wordptr -= len;
     }
     return 0;
 }
 #endif
 
 #ifdef HAS_WORD_128
-int32_t xmem::forwSequentialRead_Word128(void* start_address, void* end_address) { 
+int32_t xmem::forwStride4ReadModifyWrite_Word128(void* start_address, void* end_address) { 
 #if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_forwSequentialRead_Word128(static_cast<Word128_t*>(start_address), static_cast<Word128_t*>(end_address));
+    Word128_t val = my_64b_set_128b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF);
+    uint32_t i = 0;
+    uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word128_t);
+    for (Word128_t* wordptr = static_cast<Word128_t*>(start_address); i < len; i += 64) {
+        UNROLL64(my_128b_xor_in_place(wordptr, val); wordptr += 4;)
+        if (wordptr >= static_cast<Word128_t*>(end_address)) //end, modulo
+            wordptr -= len;
+    }
+    return 0;
 #else
     register Word128_t val;
-    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(start_address), *endptr = static_cast<Word128_t*>(end_address); wordptr < endptr;) {
-        UNROLL256(val = *wordptr++;)
+    val = my_64b_set_128b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF);
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word128_t);
+    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(start_address); i < len; i += 64) {
+        UNROLL64(*wordptr ^= val; wordptr += 4;)
+        if (wordptr >= static_cast<Word128_t*>(end_address)) //end, modulo
+            wordptr -= len;
     }
     return 0;
 #endif
@@ -1986,13 +5467,26 @@ int32_t xmem::forwSequentialRead_Word128(void* start_address, void* end_address)
 #endif
 
 #ifdef HAS_WORD_256
-int32_t xmem::forwSequentialRead_Word256(void* start_address, void* end_address) { 
+int32_t xmem::forwStride4ReadModifyWrite_Word256(void* start_address, void* end_address) { 
 #if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_forwSequentialRead_Word256(static_cast<Word256_t*>(start_address), static_cast<Word256_t*>(end_address));
+    Word256_t val = my_64b_set_256b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF);
+    uint32_t i = 0;
+    uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word256_t);
+    for (Word256_t* wordptr = static_cast<Word256_t*>(start_address); i < len; i += 32) {
+        UNROLL32(my_256b_xor_in_place(wordptr, val); wordptr += 4;)
+        if (wordptr >= static_cast<Word256_t*>(end_address)) //end, modulo
+            wordptr -= len;
+    }
+    return 0;
 #else
     register Word256_t val;
-    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(start_address), *endptr = static_cast<Word256_t*>(end_address); wordptr < endptr;) {
-        UNROLL128(val = *wordptr++;)
+    val = my_64b_set_256b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF);
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word256_t);
+    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(start_address); i < len; i += 32) {
+        UNROLL32(*wordptr ^= val; wordptr += 4;)
+        if (wordptr >= static_cast<Word256_t*>(end_address)) //end, modulo
+            wordptr -= len;
     }
     return 0;
 #endif
@@ -2001,52 +5495,76 @@ int32_t xmem::forwSequentialRead_Word256(void* start_address, void* end_address)
 
 #ifdef HAS_WORD_512
 #ifdef _WIN32
-int32_t xmem::forwSequentialRead_Word512(void* start_address, void* end_address) {
+int32_t xmem::forwStride4ReadModifyWrite_Word512(void* start_address, void* end_address) {
 #else
 //FIXME: We flag GCC/ICC not to optimize this function. The problem is that my_512b_load() -- which maps to _mm512_load_epi64 Intel AVX-512/KNC intrinsic -- cannot accept volatile* arguments. The only way to prevent the entire benchmark loop from being optimized away is to force the compiler not to optimize the function at all. Unfortunately, this will cause extra unwanted code to be included. The only solution seems to be to write inline assembly or allow eventual support for assignment of __m512i variables, e.g., val = *wordptr++; which is how the code for the other word sizes is written.
-int32_t __attribute__((optimize("O0"))) xmem::forwSequentialRead_Word512(void* start_address, void* end_address) { 
+int32_t __attribute__((optimize("O0"))) xmem::forwStride4ReadModifyWrite_Word512(void* start_address, void* end_address) { 
 #endif
 #if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-//    return win_x86_64_asm_forwSequentialRead_Word512(static_cast<Word512_t*>(start_address), static_cast<Word512_t*>(end_address));
     #error 512-bit words are not supported on Windows.
 #else
     register Word512_t val;
-    //for (volatile Word512_t* wordptr = static_cast<Word512_t*>(start_address), *endptr = static_cast<Word512_t*>(end_address); wordptr < endptr;) {
-    for (Word512_t* wordptr = static_cast<Word512_t*>(start_address), *endptr = static_cast<Word512_t*>(end_address); wordptr < endptr;) {
-        //UNROLL64(val = *wordptr++;)
-        UNROLL64(val = my_512b_load(wordptr++);)
+    uint64_t scratchptr[8] __attribute__ ((aligned(512)));
+    my_64b_set_512b_word(val, scratchptr, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF);
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word512_t);
+    for (Word512_t* wordptr = static_cast<Word512_t*>(start_address); i < len; i += 16) {
+        UNROLL16(*wordptr ^= val; wordptr += 4;)
+        if (wordptr >= static_cast<Word512_t*>(end_address)) //end, modulo
+            wordptr -= len;
     }
     return 0;
 #endif
 }
 #endif
 
-int32_t xmem::revSequentialRead_Word32(void* start_address, void* end_address) { 
-    register Word32_t val;
-    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(end_address), *begptr = static_cast<Word32_t*>(start_address); wordptr > begptr;) {
-        UNROLL1024(val = *wordptr--;)
+int32_t xmem::revStride4ReadModifyWrite_Word32(void* start_address, void* end_address) { 
+    register Word32_t val = 0xFFFFFFFF; 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word32_t);
+    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(end_address); i < len; i += 256) {
+        UNROLL256(*wordptr ^= val; wordptr -= 4;)
+        if (wordptr <= static_cast<Word32_t*>(start_address)) //end, modulo
+            wordptr += len;
     }
     return 0;
 }
 
 #ifdef HAS_WORD_64
-int32_t xmem::revSequentialRead_Word64(void* start_address, void* end_address) {
-    register Word64_t val;
-    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(end_address), *begptr = static_cast<Word64_t*>(start_address); wordptr > begptr;) {
-        UNROLL512(val = *wordptr--;)
+int32_t xmem::revStride4ReadModifyWrite_Word64(void* start_address, void* end_address) { 
+    register Word64_t val = 0xFFFFFFFFFFFFFFFF; 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word64_t);
+    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(end_address); i < len; i += 128) {
+        UNROLL128(*wordptr ^= val; wordptr -= 4;)
+        if (wordptr <= static_cast<Word64_t*>(start_address)) //end, modulo
+            wordptr += len;
     }
     return 0;
 }
 #endif
 
 #ifdef HAS_WORD_128
-int32_t xmem::revSequentialRead_Word128(void* start_address, void* end_address) { 
+int32_t xmem::revStride4ReadModifyWrite_Word128(void* start_address, void* end_address) { 
 #if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_revSequentialRead_Word128(static_cast<Word128_t*>(end_address), static_cast<Word128_t*>(start_address));
+    Word128_t val = my_64b_set_128b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF);
+    uint32_t i = 0;
+    uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word128_t);
+    for (Word128_t* wordptr = static_cast<Word128_t*>(end_address); i < len; i += 64) {
+        UNROLL64(my_128b_xor_in_place(wordptr, val); wordptr -= 4;)
+        if (wordptr <= static_cast<Word128_t*>(start_address)) //end, modulo
+            wordptr += len;
+    }
+    return 0;
 #else
     register Word128_t val;
-    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(end_address), *begptr = static_cast<Word128_t*>(start_address); wordptr > begptr;) {
-        UNROLL256(val = *wordptr--;)
+    val = my_64b_set_128b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF);
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word128_t);
+    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(end_address); i < len; i += 64) {
+        UNROLL64(*wordptr ^= val; wordptr -= 4;)
+        if (wordptr <= static_cast<Word128_t*>(start_address)) //end, modulo
+            wordptr += len;
     }
     return 0;
 #endif
@@ -2054,13 +5572,26 @@ int32_t xmem::revSequentialRead_Word128(void* start_address, void* end_address)
 #endif
 
 #ifdef HAS_WORD_256
-int32_t xmem::revSequentialRead_Word256(void* start_address, void* end_address) {
+int32_t xmem::revStride4ReadModifyWrite_Word256(void* start_address, void* end_address) { 
 #if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_revSequentialRead_Word256(static_cast<Word256_t*>(end_address), static_cast<Word256_t*>(start_address));
+    Word256_t val = my_64b_set_256b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF);
+    uint32_t i = 0;
+    uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word256_t);
+    for (Word256_t* wordptr = static_cast<Word256_t*>(end_address); i < len; i += 32) {
+        UNROLL32(my_256b_xor_in_place(wordptr, val); wordptr -= 4;)
+        if (wordptr <= static_cast<Word256_t*>(start_address)) //end, modulo
+            wordptr += len;
+    }
+    return 0;
 #else
     register Word256_t val;
-    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(end_address), *begptr = static_cast<Word256_t*>(start_address); wordptr > begptr;) {
-        UNROLL128(val = *wordptr--;)
+    val = my_64b_set_256b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF);
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word256_t);
+    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(end_address); i < len; i += 32) {
+        UNROLL32(*wordptr ^= val; wordptr -= 4;)
+        if (wordptr <= static_cast<Word256_t*>(start_address)) //end, modulo
+            wordptr += len;
     }
     return 0;
 #endif
@@ -2069,55 +5600,78 @@ int32_t xmem::revSequentialRead_Word256(void* start_address, void* end_address)
 
 #ifdef HAS_WORD_512
 #ifdef _WIN32
-int32_t xmem::revSequentialRead_Word512(void* start_address, void* end_address) {
+int32_t xmem::revStride4ReadModifyWrite_Word512(void* start_address, void* end_address) {
 #else
 //FIXME: We flag GCC/ICC not to optimize this function. The problem is that my_512b_load() -- which maps to _mm512_load_epi64 Intel AVX-512/KNC intrinsic -- cannot accept volatile* arguments. The only way to prevent the entire benchmark loop from being optimized away is to force the compiler not to optimize the function at all. Unfortunately, this will cause extra unwanted code to be included. The only solution seems to be to write inline assembly or allow eventual support for assignment of __m512i variables, e.g., val = *wordptr++; which is how the code for the other word sizes is written.
-int32_t __attribute__((optimize("O0"))) xmem::revSequentialRead_Word512(void* start_address, void* end_address) { 
+int32_t __attribute__((optimize("O0"))) xmem::revStride4ReadModifyWrite_Word512(void* start_address, void* end_address) { 
 #endif
 #if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    //return win_x86_64_asm_revSequentialRead_Word512(static_cast<Word512_t*>(end_address), static_cast<Word512_t*>(start_address));
     #error 512-bit words are not supported on Windows.
 #else
     register Word512_t val;
-    //for (volatile Word512_t* wordptr = static_cast<Word512_t*>(end_address), *begptr = static_cast<Word512_t*>(start_address); wordptr > begptr;) {
-    for (Word512_t* wordptr = static_cast<Word512_t*>(end_address), *begptr = static_cast<Word512_t*>(start_address); wordptr > begptr;) {
-        //UNROLL64(val = *wordptr--;)
-        UNROLL64(val = my_512b_load(wordptr--);)
+    uint64_t scratchptr[8] __attribute__ ((aligned(512)));
+    my_64b_set_512b_word(val, scratchptr, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF);
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word512_t);
+    for (Word512_t* wordptr = static_cast<Word512_t*>(end_address); i < len; i += 16) {
+        UNROLL16(*wordptr ^= val; wordptr -= 4;)
+        if (wordptr <= static_cast<Word512_t*>(start_address)) //end, modulo
+            wordptr += len;
     }
     return 0;
 #endif
 }
 #endif
 
-/* ------------ SEQUENTIAL WRITE --------------*/
+/* ------------ STRIDE 8 READ-MODIFY-WRITE --------------*/
 
-int32_t xmem::forwSequentialWrite_Word32(void* start_address, void* end_address) {
+int32_t xmem::forwStride8ReadModifyWrite_Word32(void* start_address, void* end_address) {
     register Word32_t val = 0xFFFFFFFF; 
-    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(start_address), *endptr = static_cast<Word32_t*>(end_address); wordptr < endptr;) {
-        UNROLL1024(*wordptr++ = val;) 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word32_t);
+    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(start_address); i < len; i += 128) {
+        UNROLL128(*wordptr ^= val; wordptr += 8;)
+        if (wordptr >= static_cast<Word32_t*>(end_address)) //end, modulo
+            wordptr -= len;
     }
     return 0;
 }
 
 #ifdef HAS_WORD_64
-int32_t xmem::forwSequentialWrite_Word64(void* start_address, void* end_address) {
+int32_t xmem::forwStride8ReadModifyWrite_Word64(void* start_address, void* end_address) {
     register Word64_t val = 0xFFFFFFFFFFFFFFFF; 
-    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(start_address), *endptr = static_cast<Word64_t*>(end_address); wordptr < endptr;) {
-        UNROLL512(*wordptr++ = val;) 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word64_t);
+    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(start_address); i < len; i += 64) {
+        UNROLL64(*wordptr ^= val; wordptr += 8;)
+        if (wordptr >= static_cast<Word64_t*>(end_address)) //end, modulo
+            wordptr -= len;
     }
     return 0;
 }
 #endif
 
 #ifdef HAS_WORD_128
-int32_t xmem::forwSequentialWrite_Word128(void* start_address, void* end_address) { 
+int32_t xmem::forwStride8ReadModifyWrite_Word128(void* start_address, void* end_address) { 
 #if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_forwSequentialWrite_Word128(static_cast<Word128_t*>(start_address), static_cast<Word128_t*>(end_address));
+    Word128_t val = my_64b_set_128b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF);
+    uint32_t i = 0;
+    uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word128_t);
+    for (Word128_t* wordptr = static_cast<Word128_t*>(start_address); i < len; i += 32) {
+        UNROLL32(my_128b_xor_in_place(wordptr, val); wordptr += 8;)
+        if (wordptr >= static_cast<Word128_t*>(end_address)) //end, modulo
+            wordptr -= len;
+    }
+    return 0;
 #else
     register Word128_t val;
     val = my_64b_set_128b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF);
-    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(start_address), *endptr = static_cast<Word128_t*>(end_address); wordptr < endptr;) {
-        UNROLL256(*wordptr++ = val;) 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word128_t);
+    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(start_address); i < len; i += 32) {
+        UNROLL32(*wordptr ^= val; wordptr += 8;)
+        if (wordptr >= static_cast<Word128_t*>(end_address)) //end, modulo
+            wordptr -= len;
     }
     return 0;
 #endif
@@ -2125,14 +5679,26 @@ int32_t xmem::forwSequentialWrite_Word128(void* start_address, void* end_address
 #endif
 
 #ifdef HAS_WORD_256
-int32_t xmem::forwSequentialWrite_Word256(void* start_address, void* end_address) {
+int32_t xmem::forwStride8ReadModifyWrite_Word256(void* start_address, void* end_address) { 
 #if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_forwSequentialWrite_Word256(static_cast<Word256_t*>(start_address), static_cast<Word256_t*>(end_address));
+    Word256_t val = my_64b_set_256b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF); 
+    uint32_t i = 0;
+    uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word256_t);
+    for (Word256_t* wordptr = static_cast<Word256_t*>(start_address); i < len; i += 16) {
+        UNROLL16(my_256b_xor_in_place(wordptr, val); wordptr += 8;)
+        if (wordptr >= static_cast<Word256_t*>(end_address)) //end, modulo
+            wordptr -= len;
+    }
+    return 0;
 #else
     register Word256_t val;
-    val = my_64b_set_256b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF);
-    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(start_address), *endptr = static_cast<Word256_t*>(end_address); wordptr < endptr;) {
-        UNROLL128(*wordptr++ = val;) 
+    val = my_64b_set_256b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF); 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word256_t);
+    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(start_address); i < len; i += 16) {
+        UNROLL16(*wordptr ^= val; wordptr += 8;)
+        if (wordptr >= static_cast<Word256_t*>(end_address)) //end, modulo
+            wordptr -= len;
     }
     return 0;
 #endif
@@ -2141,53 +5707,76 @@ int32_t xmem::forwSequentialWrite_Word256(void* start_address, void* end_address
 
 #ifdef HAS_WORD_512
 #ifdef _WIN32
-int32_t xmem::forwSequentialWrite_Word512(void* start_address, void* end_address) {
+int32_t xmem::forwStride8ReadModifyWrite_Word512(void* start_address, void* end_address) {
 #else
 //FIXME: We flag GCC/ICC not to optimize this function. The problem is that my_512b_load() -- which maps to _mm512_load_epi64 Intel AVX-512/KNC intrinsic -- cannot accept volatile* arguments. The only way to prevent the entire benchmark loop from being optimized away is to force the compiler not to optimize the function at all. Unfortunately, this will cause extra unwanted code to be included. The only solution seems to be to write inline assembly or allow eventual support for assignment of __m512i variables, e.g., val = *wordptr++; which is how the code for the other word sizes is written.
-int32_t __attribute__((optimize("O0"))) xmem::forwSequentialWrite_Word512(void* start_address, void* end_address) { 
+int32_t __attribute__((optimize("O0"))) xmem::forwStride8ReadModifyWrite_Word512(void* start_address, void* end_address) { 
 #endif
 #if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    //return win_x86_64_asm_forwSequentialWrite_Word512(static_cast<Word512_t*>(start_address), static_cast<Word512_t*>(end_address));
     #error 512-bit words are not supported on Windows.
 #else
     register Word512_t val;
     uint64_t scratchptr[8] __attribute__ ((aligned(512)));
-    my_64b_set_512b_word(val, scratchptr, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF);
-    for (Word512_t* wordptr = static_cast<Word512_t*>(start_address), *endptr = static_cast<Word512_t*>(end_address); wordptr < endptr;) {
-        UNROLL64(*wordptr++ = val;) 
+    my_64b_set_512b_word(val, scratchptr, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF); 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word512_t);
+    for (Word512_t* wordptr = static_cast<Word512_t*>(start_address); i < len; i += 8) {
+        UNROLL8(*wordptr ^= val; wordptr += 8;)
+        if (wordptr >= static_cast<Word512_t*>(end_address)) //end, modulo
+            wordptr -= len;
     }
     return 0;
 #endif
 }
 #endif
 
-int32_t xmem::revSequentialWrite_Word32(void* start_address, void* end_address) {
-    register Word32_t val = 0xFFFFFFFF;
-    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(end_address), *begptr = static_cast<Word32_t*>(start_address); wordptr > begptr;) {
-        UNROLL1024(*wordptr-- = val;)
+int32_t xmem::revStride8ReadModifyWrite_Word32(void* start_address, void* end_address) { 
+    register Word32_t val = 0xFFFFFFFF; 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word32_t);
+    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(end_address); i < len; i += 128) {
+        UNROLL128(*wordptr ^= val; wordptr -= 8;)
+        if (wordptr <= static_cast<Word32_t*>(start_address)) //end, modulo
+            wordptr += len;
     }
     return 0;
 }
 
 #ifdef HAS_WORD_64
-int32_t xmem::revSequentialWrite_Word64(void* start_address, void* end_address) {
-    register Word64_t val = 0xFFFFFFFFFFFFFFFF;
-    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(end_address), *begptr = static_cast<Word64_t*>(start_address); wordptr > begptr;) {
-        UNROLL512(*wordptr-- = val;)
+int32_t xmem::revStride8ReadModifyWrite_Word64(void* start_address, void* end_address) { 
+    register Word64_t val = 0xFFFFFFFFFFFFFFFF; 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word64_t);
+    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(end_address); i < len; i += 64) {
+        UNROLL64(*wordptr ^= val; wordptr -= 8;)
+        if (wordptr <= static_cast<Word64_t*>(start_address)) //end, modulo
+            wordptr += len;
     }
     return 0;
 }
 #endif
 
 #ifdef HAS_WORD_128
-int32_t xmem::revSequentialWrite_Word128(void* start_address, void* end_address) { 
+int32_t xmem::revStride8ReadModifyWrite_Word128(void* start_address, void* end_address) { 
 #if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_revSequentialWrite_Word128(static_cast<Word128_t*>(end_address), static_cast<Word128_t*>(start_address));
+    Word128_t val = my_64b_set_128b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF); 
+    uint32_t i = 0;
+    uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word128_t);
+    for (Word128_t* wordptr = static_cast<Word128_t*>(end_address); i < len; i += 32) {
+        UNROLL32(my_128b_xor_in_place(wordptr, val); wordptr -= 8;)
+        if (wordptr <= static_cast<Word128_t*>(start_address)) //end, modulo
+            wordptr += len;
+    }
+    return 0;
 #else
     register Word128_t val;
-    val = my_64b_set_128b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF);
-    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(end_address), *begptr = static_cast<Word128_t*>(start_address); wordptr > begptr;) {
-        UNROLL256(*wordptr-- = val;)
+    val = my_64b_set_128b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF); 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word128_t);
+    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(end_address); i < len; i += 32) {
+        UNROLL32(*wordptr ^= val; wordptr -= 8;)
+        if (wordptr <= static_cast<Word128_t*>(start_address)) //end, modulo
+            wordptr += len;
     }
     return 0;
 #endif
@@ -2195,14 +5784,26 @@ int32_t xmem::revSequentialWrite_Word128(void* start_address, void* end_address)
 #endif
 
 #ifdef HAS_WORD_256
-int32_t xmem::revSequentialWrite_Word256(void* start_address, void* end_address) {
+int32_t xmem::revStride8ReadModifyWrite_Word256(void* start_address, void* end_address) { 
 #if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_revSequentialWrite_Word256(static_cast<Word256_t*>(end_address), static_cast<Word256_t*>(start_address));
+    Word256_t val = my_64b_set_256b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF); 
+    uint32_t i = 0;
+    uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word256_t);
+    for (Word256_t* wordptr = static_cast<Word256_t*>(end_address); i < len; i += 16) {
+        UNROLL16(my_256b_xor_in_place(wordptr, val); wordptr -= 8;)
+        if (wordptr <= static_cast<Word256_t*>(start_address)) //end, modulo
+            wordptr += len;
+    }
+    return 0;
 #else
     register Word256_t val;
-    val = my_64b_set_256b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF);
-    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(end_address), *begptr = static_cast<Word256_t*>(start_address); wordptr > begptr;) {
-        UNROLL128(*wordptr-- = val;)
+    val = my_64b_set_256b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF); 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word256_t);
+    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(end_address); i < len; i += 16) {
+        UNROLL16(*wordptr ^= val; wordptr -= 8;)
+        if (wordptr <= static_cast<Word256_t*>(start_address)) //end, modulo
+            wordptr += len;
     }
     return 0;
 #endif
@@ -2211,34 +5812,37 @@ int32_t xmem::revSequentialWrite_Word256(void* start_address, void* end_address)
 
 #ifdef HAS_WORD_512
 #ifdef _WIN32
-int32_t xmem::revSequentialWrite_Word512(void* start_address, void* end_address) {
+int32_t xmem::revStride8ReadModifyWrite_Word512(void* start_address, void* end_address) {
 #else
 //FIXME: We flag GCC/ICC not to optimize this function. The problem is that my_512b_load() -- which maps to _mm512_load_epi64 Intel AVX-512/KNC intrinsic -- cannot accept volatile* arguments. The only way to prevent the entire benchmark loop from being optimized away is to force the compiler not to optimize the function at all. Unfortunately, this will cause extra unwanted code to be included. The only solution seems to be to write inline assembly or allow eventual support for assignment of __m512i variables, e.g., val = *wordptr++; which is how the code for the other word sizes is written.
-int32_t __attribute__((optimize("O0"))) xmem::revSequentialWrite_Word512(void* start_address, void* end_address) { 
+int32_t __attribute__((optimize("O0"))) xmem::revStride8ReadModifyWrite_Word512(void* start_address, void* end_address) { 
 #endif
 #if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    //return win_x86_64_asm_revSequentialWrite_Word512(static_cast<Word512_t*>(end_address), static_cast<Word512_t*>(start_address));
     #error 512-bit words are not supported on Windows.
 #else
     register Word512_t val;
     uint64_t scratchptr[8] __attribute__ ((aligned(512)));
-    my_64b_set_512b_word(val, scratchptr, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF);
-    for (Word512_t* wordptr = static_cast<Word512_t*>(end_address), *begptr = static_cast<Word512_t*>(start_address); wordptr > begptr;) {
-        UNROLL64(*wordptr-- = val;)
+    my_64b_set_512b_word(val, scratchptr, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF); 
+    register uint32_t i = 0;
+    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word512_t);
+    for (Word512_t* wordptr = static_cast<Word512_t*>(end_address); i < len; i += 8) {
+        UNROLL8(*wordptr ^= val; wordptr -= 8;)
+        if (wordptr <= static_cast<Word512_t*>(start_address)) //end, modulo
+            wordptr += len;
     }
     return 0;
 #endif
 }
 #endif
 
-/* ------------ STRIDE 2 READ --------------*/
+/* ------------ STRIDE 16 READ-MODIFY-WRITE --------------*/
 
-int32_t xmem::forwStride2Read_Word32(void* start_address, void* end_address) {
-    register Word32_t val; 
+int32_t xmem::forwStride16ReadModifyWrite_Word32(void* start_address, void* end_address) {
+    register Word32_t val = 0xFFFFFFFF; 
     register uint32_t i = 0;
     register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word32_t);
-    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(start_address); i < len; i += 512) {
-        UNROLL512(val = *wordptr; wordptr += 2;) 
+    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(start_address); i < len; i += 64) {
+        UNROLL64(*wordptr ^= val; wordptr += 16;)
         if (wordptr >= static_cast<Word32_t*>(end_address)) //end, modulo
             wordptr -= len;
     }
@@ -2246,12 +5850,12 @@ int32_t xmem::forwStride2Read_Word32(void* start_address, void* end_address) {
 }
 
 #ifdef HAS_WORD_64
-int32_t xmem::forwStride2Read_Word64(void* start_address, void* end_address) { 
-    register Word64_t val; 
+int32_t xmem::forwStride16ReadModifyWrite_Word64(void* start_address, void* end_address) {
+    register Word64_t val = 0xFFFFFFFFFFFFFFFF; 
     register uint32_t i = 0;
     register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word64_t);
-    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(start_address); i < len; i += 256) {
-        UNROLL256(val = *wordptr; wordptr += 2;) 
+    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(start_address); i < len; i += 32) {
+        UNROLL32(*wordptr ^= val; wordptr += 16;)
         if (wordptr >= static_cast<Word64_t*>(end_address)) //end, modulo
             wordptr -= len;
     }
@@ -2260,15 +5864,24 @@ int32_t xmem::forwStride2Read_Word64(void* start_address, void* end_address) {
 #endif
 
 #ifdef HAS_WORD_128
-int32_t xmem::forwStride2Read_Word128(void* start_address, void* end_address) { 
+int32_t xmem::forwStride16ReadModifyWrite_Word128(void* start_address, void* end_address) { 
 #if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_forwStride2Read_Word128(static_cast<Word128_t*>(start_address), static_cast<Word128_t*>(end_address));
+    Word128_t val = my_64b_set_128b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF); 
+    uint32_t i = 0;
+    uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word128_t);
+    for (Word128_t* wordptr = static_cast<Word128_t*>(start_address); i < len; i += 16) {
+        UNROLL16(my_128b_xor_in_place(wordptr, val); wordptr += 16;)
+        if (wordptr >= static_cast<Word128_t*>(end_address)) //end, modulo
+            wordptr -= len;
+    }
+    return 0;
 #else
-    register Word128_t val; 
+    register Word128_t val;
+    val = my_64b_set_128b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF); 
     register uint32_t i = 0;
     register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word128_t);
-    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(start_address); i < len; i += 128) {
-        UNROLL128(val = *wordptr; wordptr += 2;) 
+    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(start_address); i < len; i += 16) {
+        UNROLL16(*wordptr ^= val; wordptr += 16;)
         if (wordptr >= static_cast<Word128_t*>(end_address)) //end, modulo
             wordptr -= len;
     }
@@ -2278,15 +5891,24 @@ int32_t xmem::forwStride2Read_Word128(void* start_address, void* end_address) {
 #endif
 
 #ifdef HAS_WORD_256
-int32_t xmem::forwStride2Read_Word256(void* start_address, void* end_address) { 
+int32_t xmem::forwStride16ReadModifyWrite_Word256(void* start_address, void* end_address) { 
 #if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_forwStride2Read_Word256(static_cast<Word256_t*>(start_address), static_cast<Word256_t*>(end_address));
+    Word256_t val = my_64b_set_256b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF); 
+    uint32_t i = 0;
+    uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word256_t);
+    for (Word256_t* wordptr = static_cast<Word256_t*>(start_address); i < len; i += 8) {
+        UNROLL8(my_256b_xor_in_place(wordptr, val); wordptr += 16;)
+        if (wordptr >= static_cast<Word256_t*>(end_address)) //end, modulo
+            wordptr -= len;
+    }
+    return 0;
 #else
-    register Word256_t val; 
+    register Word256_t val;
+    val = my_64b_set_256b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF); 
     register uint32_t i = 0;
     register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word256_t);
-    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(start_address); i < len; i += 64) {
-        UNROLL64(val = *wordptr; wordptr += 2;) 
+    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(start_address); i < len; i += 8) {
+        UNROLL8(*wordptr ^= val; wordptr += 16;)
         if (wordptr >= static_cast<Word256_t*>(end_address)) //end, modulo
             wordptr -= len;
     }
@@ -2297,22 +5919,21 @@ int32_t xmem::forwStride2Read_Word256(void* start_address, void* end_address) {
 
 #ifdef HAS_WORD_512
 #ifdef _WIN32
-int32_t xmem::forwStride2Read_Word512(void* start_address, void* end_address) {
+int32_t xmem::forwStride16ReadModifyWrite_Word512(void* start_address, void* end_address) {
 #else
 //FIXME: We flag GCC/ICC not to optimize this function. The problem is that my_512b_load() -- which maps to _mm512_load_epi64 Intel AVX-512/KNC intrinsic -- cannot accept volatile* arguments. The only way to prevent the entire benchmark loop from being optimized away is to force the compiler not to optimize the function at all. Unfortunately, this will cause extra unwanted code to be included. The only solution seems to be to write inline assembly or allow eventual support for assignment of __m512i variables, e.g., val = *wordptr++; which is how the code for the other word sizes is written.
-int32_t __attribute__((optimize("O0"))) xmem::forwStride2Read_Word512(void* start_address, void* end_address) { 
+int32_t __attribute__((optimize("O0"))) xmem::forwStride16ReadModifyWrite_Word512(void* start_address, void* end_address) { 
 #endif
 #if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    //return win_x86_64_asm_forwStride2Read_Word512(static_cast<Word256_t*>(start_address), static_cast<Word256_t*>(end_address));
     #error 512-bit words are not supported on Windows.
 #else
-    register Word512_t val; 
+    register Word512_t val;
+    uint64_t scratchptr[8] __attribute__ ((aligned(512)));
+    my_64b_set_512b_word(val, scratchptr, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF); 
     register uint32_t i = 0;
     register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word512_t);
-    //for (volatile Word512_t* wordptr = static_cast<Word512_t*>(start_address); i < len; i += 32) {
-    for (Word512_t* wordptr = static_cast<Word512_t*>(start_address); i < len; i += 32) {
-        //UNROLL32(val = *wordptr; wordptr += 2;) 
-        UNROLL32(val = my_512b_load(wordptr); wordptr += 2;) 
+    for (Word512_t* wordptr = static_cast<Word512_t*>(start_address); i < len; i += 4) {
+        UNROLL4(*wordptr ^= val; wordptr += 16;)
         if (wordptr >= static_cast<Word512_t*>(end_address)) //end, modulo
             wordptr -= len;
     }
@@ -2321,63 +5942,87 @@ int32_t __attribute__((optimize("O0"))) xmem::forwStride2Read_Word512(void* star
 }
 #endif
 
-int32_t xmem::revStride2Read_Word32(void* start_address, void* end_address) {
-    register Word32_t val; 
+int32_t xmem::revStride16ReadModifyWrite_Word32(void* start_address, void* end_address) { 
+    register Word32_t val = 0xFFFFFFFF; 
     register uint32_t i = 0;
     register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word32_t);
-    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(end_address); i < len; i += 512) {
-        UNROLL512(val = *wordptr; wordptr -= 2;) 
+    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(end_address); i < len; i += 64) {
+        UNROLL64(*wordptr ^= val; wordptr -= 16;)
         if (wordptr <= static_cast<Word32_t*>(start_address)) //end, modulo
             wordptr += len;
     }
+
     return 0;
 }
 
 #ifdef HAS_WORD_64
-int32_t xmem::revStride2Read_Word64(void* start_address, void* end_address) { 
-    register Word64_t val; 
+int32_t xmem::revStride16ReadModifyWrite_Word64(void* start_address, void* end_address) { 
+    register Word64_t val = 0xFFFFFFFFFFFFFFFF; 
     register uint32_t i = 0;
     register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word64_t);
-    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(end_address); i < len; i += 256) {
-        UNROLL256(val = *wordptr; wordptr -= 2;)
+    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(end_address); i < len; i += 32) {
+        UNROLL32(*wordptr ^= val; wordptr -= 16;)
         if (wordptr <= static_cast<Word64_t*>(start_address)) //end, modulo
             wordptr += len;
     }
+
     return 0;
 }
 #endif
 
 #ifdef HAS_WORD_128
-int32_t xmem::revStride2Read_Word128(void* start_address, void* end_address) { 
+int32_t xmem::revStride16ReadModifyWrite_Word128(void* start_address, void* end_address) { 
 #if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_revStride2Read_Word128(static_cast<Word128_t*>(end_address), static_cast<Word128_t*>(start_address));
+    Word128_t val = my_64b_set_128b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF); 
+    uint32_t i = 0;
+    uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word128_t);
+    for (Word128_t* wordptr = static_cast<Word128_t*>(end_address); i < len; i += 16) {
+        UNROLL16(my_128b_xor_in_place(wordptr, val); wordptr -= 16;)
+        if (wordptr <= static_cast<Word128_t*>(start_address)) //end, modulo
+            wordptr += len;
+    }
+
+    return 0;
 #else
-    register Word128_t val; 
+    register Word128_t val;
+    val = my_64b_set_128b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF); 
     register uint32_t i = 0;
     register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word128_t);
-    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(end_address); i < len; i += 128) {
-        UNROLL128(val = *wordptr; wordptr -= 2;)
+    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(end_address); i < len; i += 16) {
+        UNROLL16(*wordptr ^= val; wordptr -= 16;)
         if (wordptr <= static_cast<Word128_t*>(start_address)) //end, modulo
             wordptr += len;
     }
+
     return 0;
 #endif
 }
 #endif
 
 #ifdef HAS_WORD_256
-int32_t xmem::revStride2Read_Word256(void* start_address, void* end_address) { 
+int32_t xmem::revStride16ReadModifyWrite_Word256(void* start_address, void* end_address) { 
 #if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_revStride2Read_Word256(static_cast<Word256_t*>(end_address), static_cast<Word256_t*>(start_address));
+    Word256_t val = my_64b_set_256b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF); 
+    uint32_t i = 0;
+    uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word256_t);
+    for (Word256_t* wordptr = static_cast<Word256_t*>(end_address); i < len; i += 8) {
+        UNROLL8(my_256b_xor_in_place(wordptr, val); wordptr -= 16;)
+        if (wordptr <= static_cast<Word256_t*>(start_address)) //end, modulo
+            wordptr += len;
+    }
+
+    return 0;
 #else
-    register Word256_t val; 
+    register Word256_t val;
+    val = my_64b_set_256b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF); 
     register uint32_t i = 0;
     register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word256_t);
-    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(end_address); i < len; i += 64) {
-        UNROLL64(val = *wordptr; wordptr -= 2;)
+    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(end_address); i < len; i += 8) {
+        UNROLL8(*wordptr ^= val; wordptr -= 16;)
         if (wordptr <= static_cast<Word256_t*>(start_address)) //end, modulo
             wordptr += len;
     }
+
     return 0;
 #endif
 }
@@ -2385,91 +6030,87 @@ int32_t xmem::revStride2Read_Word256(void* start_address, void* end_address) {
 
 #ifdef HAS_WORD_512
 #ifdef _WIN32
-int32_t xmem::revStride2Read_Word512(void* start_address, void* end_address) {
+int32_t xmem::revStride16ReadModifyWrite_Word512(void* start_address, void* end_address) {
 #else
 //FIXME: We flag GCC/ICC not to optimize this function. The problem is that my_512b_load() -- which maps to _mm512_load_epi64 Intel AVX-512/KNC intrinsic -- cannot accept volatile* arguments. The only way to prevent the entire benchmark loop from being optimized away is to force the compiler not to optimize the function at all. Unfortunately, this will cause extra unwanted code to be included. The only solution seems to be to write inline assembly or allow eventual support for assignment of __m512i variables, e.g., val = *wordptr++; which is how the code for the other word sizes is written.
-int32_t __attribute__((optimize("O0"))) xmem::revStride2Read_Word512(void* start_address, void* end_address) { 
+int32_t __attribute__((optimize("O0"))) xmem::revStride16ReadModifyWrite_Word512(void* start_address, void* end_address) { 
 #endif
 #if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    //return win_x86_64_asm_revStride2Read_Word512(static_cast<Word512_t*>(end_address), static_cast<Word512_t*>(start_address));
     #error 512-bit words are not supported on Windows.
 #else
-    register Word512_t val; 
+    register Word512_t val;
+    uint64_t scratchptr[8] __attribute__ ((aligned(512)));
+    my_64b_set_512b_word(val, scratchptr, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF); 
     register uint32_t i = 0;
     register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word512_t);
-    //for (volatile Word512_t* wordptr = static_cast<Word512_t*>(end_address); i < len; i += 32) {
-    for (Word512_t* wordptr = static_cast<Word512_t*>(end_address); i < len; i += 32) {
-        //UNROLL32(val = *wordptr; wordptr -= 2;)
-        UNROLL32(val = my_512b_load(wordptr); wordptr -= 2;)
+    for (Word512_t* wordptr = static_cast<Word512_t*>(end_address); i < len; i += 4) {
+        UNROLL4(*wordptr ^= val; wordptr -= 16;)
         if (wordptr <= static_cast<Word512_t*>(start_address)) //end, modulo
             wordptr += len;
     }
+
     return 0;
 #endif
 }
 #endif
 
-/* ------------ STRIDE 2 WRITE --------------*/
+/* ------------ RANDOM READ --------------*/
 
-int32_t xmem::forwStride2Write_Word32(void* start_address, void* end_address) {
-    register Word32_t val = 0xFFFFFFFF; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word32_t);
-    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(start_address); i < len; i += 512) {
-        UNROLL512(*wordptr = val; wordptr += 2;)
-        if (wordptr >= static_cast<Word32_t*>(end_address)) //end, modulo
-            wordptr -= len;
-    }
+#ifndef HAS_WORD_64 //special case: 32-bit machine
+int32_t xmem::randomRead_Word32(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len) {
+    volatile uintptr_t* p = first_address;
+
+    UNROLL1024(p = reinterpret_cast<uintptr_t*>(*p);)
+    *last_touched_address = const_cast<uintptr_t*>(p);
     return 0;
 }
+#endif
 
 #ifdef HAS_WORD_64
-int32_t xmem::forwStride2Write_Word64(void* start_address, void* end_address) {
-    register Word64_t val = 0xFFFFFFFFFFFFFFFF; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word64_t);
-    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(start_address); i < len; i += 256) {
-        UNROLL256(*wordptr = val; wordptr += 2;)
-        if (wordptr >= static_cast<Word64_t*>(end_address)) //end, modulo
-            wordptr -= len;
-    }
+int32_t xmem::randomRead_Word64(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len) {
+    volatile uintptr_t* p = first_address;
+
+    UNROLL512(p = reinterpret_cast<uintptr_t*>(*p);)
+    *last_touched_address = const_cast<uintptr_t*>(p);
     return 0;
 }
 #endif
 
 #ifdef HAS_WORD_128
-int32_t xmem::forwStride2Write_Word128(void* start_address, void* end_address) { 
+int32_t xmem::randomRead_Word128(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len) {
 #if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_forwStride2Write_Word128(static_cast<Word128_t*>(start_address), static_cast<Word128_t*>(end_address));
+    return 0; //TODO: Implement for Windows.
 #else
+    volatile Word128_t* p = reinterpret_cast<Word128_t*>(first_address);
     register Word128_t val;
-    val = my_64b_set_128b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF);
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word128_t);
-    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(start_address); i < len; i += 128) {
-        UNROLL128(*wordptr = val; wordptr += 2;)
-        if (wordptr >= static_cast<Word128_t*>(end_address)) //end, modulo
-            wordptr -= len;
-    }
+
+#ifdef HAS_WORD_64
+    UNROLL256(val = *p; p = reinterpret_cast<Word128_t*>(my_64b_extractLSB_128b(val));) //Do 128-bit load. Then extract 64 LSB to use as next load address.
+#else //special case: 32-bit machine
+    UNROLL256(val = *p; p = reinterpret_cast<Word128_t*>(my_32b_extractLSB_128b(val));) //Do 128-bit load. Then extract 32 LSB to use as next load address.
+#endif
+
+    *last_touched_address = reinterpret_cast<uintptr_t*>(const_cast<Word128_t*>(p)); //Trick compiler. First get rid of volatile qualifier, and then reinterpret pointer
     return 0;
 #endif
 }
 #endif
 
 #ifdef HAS_WORD_256
-int32_t xmem::forwStride2Write_Word256(void* start_address, void* end_address) { 
+int32_t xmem::randomRead_Word256(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len) {
 #if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_forwStride2Write_Word256(static_cast<Word256_t*>(start_address), static_cast<Word256_t*>(end_address));
+    return 0; //TODO: Implement for Windows.
 #else
+    volatile Word256_t* p = reinterpret_cast<Word256_t*>(first_address);
     register Word256_t val;
-    val = my_64b_set_256b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF);
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word256_t);
-    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(start_address); i < len; i += 64) {
-        UNROLL64(*wordptr = val; wordptr += 2;)
-        if (wordptr >= static_cast<Word256_t*>(end_address)) //end, modulo
-            wordptr -= len;
-    }
+
+#ifdef HAS_WORD_64
+    UNROLL128(val = *p; p = reinterpret_cast<Word256_t*>(my_64b_extractLSB_256b(val));) //Do 256-bit load. Then extract 64 LSB to use as next load address.
+#else //special case: 32-bit machine
+    UNROLL128(val = *p; p = reinterpret_cast<Word256_t*>(my_32b_extractLSB_256b(val));) //Do 256-bit load. Then extract 32 LSB to use as next load address.
+#endif
+
+    *last_touched_address = reinterpret_cast<uintptr_t*>(const_cast<Word256_t*>(p)); //Trick compiler. First get rid of volatile qualifier, and then reinterpret pointer
     return 0;
 #endif
 }
@@ -2477,89 +6118,88 @@ int32_t xmem::forwStride2Write_Word256(void* start_address, void* end_address) {
 
 #ifdef HAS_WORD_512
 #ifdef _WIN32
-int32_t xmem::forwStride2Write_Word512(void* start_address, void* end_address) {
+int32_t xmem::randomRead_Word512(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len) {
 #else
 //FIXME: We flag GCC/ICC not to optimize this function. The problem is that my_512b_load() -- which maps to _mm512_load_epi64 Intel AVX-512/KNC intrinsic -- cannot accept volatile* arguments. The only way to prevent the entire benchmark loop from being optimized away is to force the compiler not to optimize the function at all. Unfortunately, this will cause extra unwanted code to be included. The only solution seems to be to write inline assembly or allow eventual support for assignment of __m512i variables, e.g., val = *wordptr++; which is how the code for the other word sizes is written.
-int32_t __attribute__((optimize("O0"))) xmem::forwStride2Write_Word512(void* start_address, void* end_address) { 
+int32_t __attribute__((optimize("O0"))) xmem::randomRead_Word512(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len) {
 #endif
 #if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    //return win_x86_64_asm_forwStride2Write_Word512(static_cast<Word512_t*>(start_address), static_cast<Word512_t*>(end_address));
     #error 512-bit words are not supported on Windows.
 #else
+    //volatile Word512_t* p = reinterpret_cast<Word512_t*>(first_address);
+    Word512_t* p = reinterpret_cast<Word512_t*>(first_address);
     register Word512_t val;
+
+    //UNROLL64(val = *p; p = reinterpret_cast<Word512_t*>(my_64b_extractLSB_512b(val));) //Do 512-bit load. Then extract 64 LSB to use as next load address.
     uint64_t scratchptr[8] __attribute__ ((aligned(512)));
-    my_64b_set_512b_word(val, scratchptr, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF);
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word512_t);
-    for (Word512_t* wordptr = static_cast<Word512_t*>(start_address); i < len; i += 32) {
-        UNROLL32(*wordptr = val; wordptr += 2;)
-        if (wordptr >= static_cast<Word512_t*>(end_address)) //end, modulo
-            wordptr -= len;
-    }
+    uint64_t tmp;
+    UNROLL64(val = my_512b_load(p); my_64b_extractLSB_512b(tmp, scratchptr, val); p = reinterpret_cast<Word512_t*>(tmp);) //Do 512-bit load. Then extract 64 LSB to use as next load address.
+
+    *last_touched_address = reinterpret_cast<uintptr_t*>(const_cast<Word512_t*>(p)); //Trick compiler. First get rid of volatile qualifier, and then reinterpret pointer
     return 0;
 #endif
 }
 #endif
 
-int32_t xmem::revStride2Write_Word32(void* start_address, void* end_address) { 
-    register Word32_t val = 0xFFFFFFFF; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word32_t);
-    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(end_address); i < len; i += 512) {
-        UNROLL512(*wordptr = val; wordptr -= 2;)
-        if (wordptr <= static_cast<Word32_t*>(start_address)) //end, modulo
-            wordptr += len;
-    }
+/* ------------ RANDOM WRITE --------------*/
+
+#ifndef HAS_WORD_64 //special case: 32-bit machine
+int32_t xmem::randomWrite_Word32(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len) {
+    volatile uintptr_t* p = first_address;
+    volatile uintptr_t* p2 = NULL;
+
+    UNROLL1024(p2 = reinterpret_cast<uintptr_t*>(*p); *p = reinterpret_cast<uintptr_t>(p2); p = p2;)
+    *last_touched_address = const_cast<uintptr_t*>(p);
     return 0;
 }
+#endif
 
 #ifdef HAS_WORD_64
-int32_t xmem::revStride2Write_Word64(void* start_address, void* end_address) { 
-    register Word64_t val = 0xFFFFFFFFFFFFFFFF; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word64_t);
-    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(end_address); i < len; i += 256) {
-        UNROLL256(*wordptr = val; wordptr -= 2;)
-        if (wordptr <= static_cast<Word64_t*>(start_address)) //end, modulo
-            wordptr += len;
-    }
+int32_t xmem::randomWrite_Word64(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len) {
+    volatile uintptr_t* p = first_address;
+    volatile uintptr_t* p2 = NULL;
+
+    UNROLL512(p2 = reinterpret_cast<uintptr_t*>(*p); *p = reinterpret_cast<uintptr_t>(p2); p = p2;)
+    *last_touched_address = const_cast<uintptr_t*>(p);
     return 0;
 }
 #endif
 
 #ifdef HAS_WORD_128
-int32_t xmem::revStride2Write_Word128(void* start_address, void* end_address) { 
+int32_t xmem::randomWrite_Word128(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len) {
 #if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_revStride2Write_Word128(static_cast<Word128_t*>(end_address), static_cast<Word128_t*>(start_address));
+    return 0; //TODO: Implement for Windows.
 #else
+    volatile Word128_t* p = reinterpret_cast<Word128_t*>(first_address);
     register Word128_t val;
-    val = my_64b_set_128b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF); 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word128_t);
-    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(end_address); i < len; i += 128) {
-        UNROLL128(*wordptr = val; wordptr -= 2;)
-        if (wordptr <= static_cast<Word128_t*>(start_address)) //end, modulo
-            wordptr += len;
-    }
+
+#ifdef HAS_WORD_64
+    UNROLL256(val = *p; *p = val; p = reinterpret_cast<Word128_t*>(my_64b_extractLSB_128b(val));) //Do 128-bit load. Then do 128-bit store. Then extract 64 LSB to use as next load address.
+#else //special case: 32-bit machine
+    UNROLL256(val = *p; *p = val; p = reinterpret_cast<Word128_t*>(my_32b_extractLSB_128b(val));) //Do 128-bit load. Then do 128-bit store. Then extract 32 LSB to use as next load address.
+#endif
+
+    *last_touched_address = reinterpret_cast<uintptr_t*>(const_cast<Word128_t*>(p)); //Trick compiler. First get rid of volatile qualifier, and then reinterpret pointer
     return 0;
 #endif
 }
 #endif
 
 #ifdef HAS_WORD_256
-int32_t xmem::revStride2Write_Word256(void* start_address, void* end_address) { 
+int32_t xmem::randomWrite_Word256(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len) {
 #if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_revStride2Write_Word256(static_cast<Word256_t*>(end_address), static_cast<Word256_t*>(start_address));
+    return 0; //TODO: Implement for Windows.
 #else
+    volatile Word256_t* p = reinterpret_cast<Word256_t*>(first_address);
     register Word256_t val;
-    val = my_64b_set_256b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF); 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word256_t);
-    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(end_address); i < len; i += 64) {
-        UNROLL64(*wordptr = val; wordptr -= 2;)
-        if (wordptr <= static_cast<Word256_t*>(start_address)) //end, modulo
-            wordptr += len;
-    }
+
+#ifdef HAS_WORD_64
+    UNROLL128(val = *p; *p = val; p = reinterpret_cast<Word256_t*>(my_64b_extractLSB_256b(val));) //Do 256-bit load. Then do 256-bit store. Then extract 64 LSB to use as next load address.
+#else //special case: 32-bit machine
+    UNROLL128(val = *p; *p = val; p = reinterpret_cast<Word256_t*>(my_32b_extractLSB_256b(val));) //Do 256-bit load. Then do 256-bit store. Then extract 32 LSB to use as next load address.
+#endif
+
+    *last_touched_address = reinterpret_cast<uintptr_t*>(const_cast<Word256_t*>(p)); //Trick compiler. First get rid of volatile qualifier, and then reinterpret pointer
     return 0;
 #endif
 }
@@ -2567,1287 +6207,1560 @@ int32_t xmem::revStride2Write_Word256(void* start_address, void* end_address) {
 
 #ifdef HAS_WORD_512
 #ifdef _WIN32
-int32_t xmem::revStride2Write_Word512(void* start_address, void* end_address) {
+int32_t xmem::randomWrite_Word512(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len) {
 #else
 //FIXME: We flag GCC/ICC not to optimize this function. The problem is that my_512b_load() -- which maps to _mm512_load_epi64 Intel AVX-512/KNC intrinsic -- cannot accept volatile* arguments. The only way to prevent the entire benchmark loop from being optimized away is to force the compiler not to optimize the function at all. Unfortunately, this will cause extra unwanted code to be included. The only solution seems to be to write inline assembly or allow eventual support for assignment of __m512i variables, e.g., val = *wordptr++; which is how the code for the other word sizes is written.
-int32_t __attribute__((optimize("O0"))) xmem::revStride2Write_Word512(void* start_address, void* end_address) { 
+int32_t __attribute__((optimize("O0"))) xmem::randomWrite_Word512(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len) {
 #endif
 #if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    //return win_x86_64_asm_forwStride2Write_Word512(static_cast<Word512_t*>(start_address), static_cast<Word512_t*>(end_address));
-    #error 512-bit words are not supported on Windows.
+#error 512-bit words are not supported on Windows.
 #else
+    //volatile Word512_t* p = reinterpret_cast<Word512_t*>(first_address);
+    Word512_t* p = reinterpret_cast<Word512_t*>(first_address);
     register Word512_t val;
+
+    //UNROLL64(val = *p; *p = val; p = reinterpret_cast<Word512_t*>(my_64b_extractLSB_512b(val));) //Do 512-bit load. Then do 512-bit store. Then extract 64 LSB to use as next load address.
     uint64_t scratchptr[8] __attribute__ ((aligned(512)));
-    my_64b_set_512b_word(val, scratchptr, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF);
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word512_t);
-    for (Word512_t* wordptr = static_cast<Word512_t*>(start_address); i < len; i += 32) {
-        UNROLL32(*wordptr = val; wordptr += 2;)
-        if (wordptr >= static_cast<Word512_t*>(end_address)) //end, modulo
-            wordptr -= len;
-    }
+    uint64_t tmp;
+    UNROLL64(val = my_512b_load(p); *p = val; my_64b_extractLSB_512b(tmp, scratchptr, val); p = reinterpret_cast<Word512_t*>(tmp);) //Do 512-bit load. Then do 512-bit store. Then extract 64 LSB to use as next load address.
+
+    *last_touched_address = reinterpret_cast<uintptr_t*>(const_cast<Word512_t*>(p)); //Trick compiler. First get rid of volatile qualifier, and then reinterpret pointer
     return 0;
 #endif
 }
 #endif
 
-/* ------------ STRIDE 4 READ --------------*/
+/* ------------ RANDOM READ/WRITE MIX --------------*/
 
-int32_t xmem::forwStride4Read_Word32(void* start_address, void* end_address) {
-    register Word32_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word32_t);
-    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(start_address); i < len; i += 256) {
-        UNROLL256(val = *wordptr; wordptr += 4;) 
-        if (wordptr >= static_cast<Word32_t*>(end_address)) //end, modulo
-            wordptr -= len;
-    }
+#ifndef HAS_WORD_64 //special case: 32-bit machine
+int32_t xmem::randomMix2to1_Word32(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len) {
+    volatile uintptr_t* p = first_address;
+    volatile uintptr_t* p2 = NULL;
+    volatile uintptr_t* p3 = NULL;
+
+    UNROLL256(p2 = reinterpret_cast<uintptr_t*>(*p); p3 = reinterpret_cast<uintptr_t*>(*p2); *p = reinterpret_cast<uintptr_t>(p2); p = p3;)
+    UNROLL64(p2 = reinterpret_cast<uintptr_t*>(*p); p3 = reinterpret_cast<uintptr_t*>(*p2); *p = reinterpret_cast<uintptr_t>(p2); p = p3;)
+    UNROLL16(p2 = reinterpret_cast<uintptr_t*>(*p); p3 = reinterpret_cast<uintptr_t*>(*p2); *p = reinterpret_cast<uintptr_t>(p2); p = p3;)
+    UNROLL4(p2 = reinterpret_cast<uintptr_t*>(*p); p3 = reinterpret_cast<uintptr_t*>(*p2); *p = reinterpret_cast<uintptr_t>(p2); p = p3;)
+    p2 = reinterpret_cast<uintptr_t*>(*p); p3 = reinterpret_cast<uintptr_t*>(*p2); *p = reinterpret_cast<uintptr_t>(p2); p = p3;
+    p = reinterpret_cast<uintptr_t*>(*p); //Finish the pass with a read
+    *last_touched_address = const_cast<uintptr_t*>(p);
     return 0;
 }
+#endif
 
 #ifdef HAS_WORD_64
-int32_t xmem::forwStride4Read_Word64(void* start_address, void* end_address) { 
-    register Word64_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word64_t);
-    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(start_address); i < len; i += 128) {
-        UNROLL128(val = *wordptr; wordptr += 4;) 
-        if (wordptr >= static_cast<Word64_t*>(end_address)) //end, modulo
-            wordptr -= len;
-    }
+int32_t xmem::randomMix2to1_Word64(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len) {
+    volatile uintptr_t* p = first_address;
+    volatile uintptr_t* p2 = NULL;
+    volatile uintptr_t* p3 = NULL;
+
+    UNROLL128(p2 = reinterpret_cast<uintptr_t*>(*p); p3 = reinterpret_cast<uintptr_t*>(*p2); *p = reinterpret_cast<uintptr_t>(p2); p = p3;)
+    UNROLL32(p2 = reinterpret_cast<uintptr_t*>(*p); p3 = reinterpret_cast<uintptr_t*>(*p2); *p = reinterpret_cast<uintptr_t>(p2); p = p3;)
+    UNROLL8(p2 = reinterpret_cast<uintptr_t*>(*p); p3 = reinterpret_cast<uintptr_t*>(*p2); *p = reinterpret_cast<uintptr_t>(p2); p = p3;)
+    UNROLL2(p2 = reinterpret_cast<uintptr_t*>(*p); p3 = reinterpret_cast<uintptr_t*>(*p2); *p = reinterpret_cast<uintptr_t>(p2); p = p3;)
+    UNROLL2(p = reinterpret_cast<uintptr_t*>(*p);) //Finish the pass with reads
+    *last_touched_address = const_cast<uintptr_t*>(p);
     return 0;
 }
 #endif
 
 #ifdef HAS_WORD_128
-int32_t xmem::forwStride4Read_Word128(void* start_address, void* end_address) { 
+int32_t xmem::randomMix2to1_Word128(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len) {
 #if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_forwStride4Read_Word128(static_cast<Word128_t*>(start_address), static_cast<Word128_t*>(end_address));
+    Word128_t* p = reinterpret_cast<Word128_t*>(first_address);
+    Word128_t* p2 = NULL;
+    Word128_t val, val2;
+
+    //The stored word keeps the next address in its low 64 bits and takes its upper bits from a later load, so that the compiler cannot drop the store as rewriting an unchanged value
+    UNROLL64(val = _mm_load_si128(p); p2 = reinterpret_cast<Word128_t*>(my_64b_extractLSB_128b(val)); val2 = _mm_load_si128(p2); _mm_store_si128(p, _mm_unpacklo_epi64(val, val2)); p = reinterpret_cast<Word128_t*>(my_64b_extractLSB_128b(val2));)
+    UNROLL16(val = _mm_load_si128(p); p2 = reinterpret_cast<Word128_t*>(my_64b_extractLSB_128b(val)); val2 = _mm_load_si128(p2); _mm_store_si128(p, _mm_unpacklo_epi64(val, val2)); p = reinterpret_cast<Word128_t*>(my_64b_extractLSB_128b(val2));)
+    UNROLL4(val = _mm_load_si128(p); p2 = reinterpret_cast<Word128_t*>(my_64b_extractLSB_128b(val)); val2 = _mm_load_si128(p2); _mm_store_si128(p, _mm_unpacklo_epi64(val, val2)); p = reinterpret_cast<Word128_t*>(my_64b_extractLSB_128b(val2));)
+    val = _mm_load_si128(p); p2 = reinterpret_cast<Word128_t*>(my_64b_extractLSB_128b(val)); val2 = _mm_load_si128(p2); _mm_store_si128(p, _mm_unpacklo_epi64(val, val2)); p = reinterpret_cast<Word128_t*>(my_64b_extractLSB_128b(val2));
+    val = _mm_load_si128(p); p = reinterpret_cast<Word128_t*>(my_64b_extractLSB_128b(val)); //Finish the pass with a read
+
+    *last_touched_address = reinterpret_cast<uintptr_t*>(p);
+    return 0;
 #else
-    register Word128_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word128_t);
-    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(start_address); i < len; i += 64) {
-        UNROLL64(val = *wordptr; wordptr += 4;) 
-        if (wordptr >= static_cast<Word128_t*>(end_address)) //end, modulo
-            wordptr -= len;
-    }
+    volatile Word128_t* p = reinterpret_cast<Word128_t*>(first_address);
+    volatile Word128_t* p2 = NULL;
+    register Word128_t val, val2;
+
+#ifdef HAS_WORD_64
+    UNROLL64(val = *p; p2 = reinterpret_cast<Word128_t*>(my_64b_extractLSB_128b(val)); val2 = *p2; *p = val; p = reinterpret_cast<Word128_t*>(my_64b_extractLSB_128b(val2));)
+    UNROLL16(val = *p; p2 = reinterpret_cast<Word128_t*>(my_64b_extractLSB_128b(val)); val2 = *p2; *p = val; p = reinterpret_cast<Word128_t*>(my_64b_extractLSB_128b(val2));)
+    UNROLL4(val = *p; p2 = reinterpret_cast<Word128_t*>(my_64b_extractLSB_128b(val)); val2 = *p2; *p = val; p = reinterpret_cast<Word128_t*>(my_64b_extractLSB_128b(val2));)
+    val = *p; p2 = reinterpret_cast<Word128_t*>(my_64b_extractLSB_128b(val)); val2 = *p2; *p = val; p = reinterpret_cast<Word128_t*>(my_64b_extractLSB_128b(val2));
+    val = *p; p = reinterpret_cast<Word128_t*>(my_64b_extractLSB_128b(val)); //Finish the pass with a read
+#else //special case: 32-bit machine
+    UNROLL64(val = *p; p2 = reinterpret_cast<Word128_t*>(my_32b_extractLSB_128b(val)); val2 = *p2; *p = val; p = reinterpret_cast<Word128_t*>(my_32b_extractLSB_128b(val2));)
+    UNROLL16(val = *p; p2 = reinterpret_cast<Word128_t*>(my_32b_extractLSB_128b(val)); val2 = *p2; *p = val; p = reinterpret_cast<Word128_t*>(my_32b_extractLSB_128b(val2));)
+    UNROLL4(val = *p; p2 = reinterpret_cast<Word128_t*>(my_32b_extractLSB_128b(val)); val2 = *p2; *p = val; p = reinterpret_cast<Word128_t*>(my_32b_extractLSB_128b(val2));)
+    val = *p; p2 = reinterpret_cast<Word128_t*>(my_32b_extractLSB_128b(val)); val2 = *p2; *p = val; p = reinterpret_cast<Word128_t*>(my_32b_extractLSB_128b(val2));
+    val = *p; p = reinterpret_cast<Word128_t*>(my_32b_extractLSB_128b(val)); //Finish the pass with a read
+#endif
+
+    *last_touched_address = reinterpret_cast<uintptr_t*>(const_cast<Word128_t*>(p)); //Trick compiler. First get rid of volatile qualifier, and then reinterpret pointer
     return 0;
 #endif
 }
 #endif
 
 #ifdef HAS_WORD_256
-int32_t xmem::forwStride4Read_Word256(void* start_address, void* end_address) { 
+int32_t xmem::randomMix2to1_Word256(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len) {
 #if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_forwStride4Read_Word256(static_cast<Word256_t*>(start_address), static_cast<Word256_t*>(end_address));
-#else
-    register Word256_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word256_t);
-    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(start_address); i < len; i += 32) {
-        UNROLL32(val = *wordptr; wordptr += 4;) 
-        if (wordptr >= static_cast<Word256_t*>(end_address)) //end, modulo
-            wordptr -= len;
-    }
-    return 0;
-#endif
-}
-#endif
+    Word256_t* p = reinterpret_cast<Word256_t*>(first_address);
+    Word256_t* p2 = NULL;
+    Word256_t val, val2;
 
-#ifdef HAS_WORD_512
-#ifdef _WIN32
-int32_t xmem::forwStride4Read_Word512(void* start_address, void* end_address) {
+    //As in randomMix2to1_Word128(), the stored word mixes in a later load so that the store is not dropped
+    UNROLL32(val = _mm256_load_si256(p); p2 = reinterpret_cast<Word256_t*>(my_64b_extractLSB_256b(val)); val2 = _mm256_load_si256(p2); _mm256_store_pd(reinterpret_cast<double*>(p), _mm256_blend_pd(_mm256_castsi256_pd(val2), _mm256_castsi256_pd(val), 0x1)); p = reinterpret_cast<Word256_t*>(my_64b_extractLSB_256b(val2));)
+    UNROLL8(val = _mm256_load_si256(p); p2 = reinterpret_cast<Word256_t*>(my_64b_extractLSB_256b(val)); val2 = _mm256_load_si256(p2); _mm256_store_pd(reinterpret_cast<double*>(p), _mm256_blend_pd(_mm256_castsi256_pd(val2), _mm256_castsi256_pd(val), 0x1)); p = reinterpret_cast<Word256_t*>(my_64b_extractLSB_256b(val2));)
+    UNROLL2(val = _mm256_load_si256(p); p2 = reinterpret_cast<Word256_t*>(my_64b_extractLSB_256b(val)); val2 = _mm256_load_si256(p2); _mm256_store_pd(reinterpret_cast<double*>(p), _mm256_blend_pd(_mm256_castsi256_pd(val2), _mm256_castsi256_pd(val), 0x1)); p = reinterpret_cast<Word256_t*>(my_64b_extractLSB_256b(val2));)
+    UNROLL2(val = _mm256_load_si256(p); p = reinterpret_cast<Word256_t*>(my_64b_extractLSB_256b(val));) //Finish the pass with reads
+
+    *last_touched_address = reinterpret_cast<uintptr_t*>(p);
+    return 0;
 #else
-//FIXME: We flag GCC/ICC not to optimize this function. The problem is that my_512b_load() -- which maps to _mm512_load_epi64 Intel AVX-512/KNC intrinsic -- cannot accept volatile* arguments. The only way to prevent the entire benchmark loop from being optimized away is to force the compiler not to optimize the function at all. Unfortunately, this will cause extra unwanted code to be included. The only solution seems to be to write inline assembly or allow eventual support for assignment of __m512i variables, e.g., val = *wordptr++; which is how the code for the other word sizes is written.
-int32_t __attribute__((optimize("O0"))) xmem::forwStride4Read_Word512(void* start_address, void* end_address) { 
+    volatile Word256_t* p = reinterpret_cast<Word256_t*>(first_address);
+    volatile Word256_t* p2 = NULL;
+    register Word256_t val, val2;
+
+#ifdef HAS_WORD_64
+    UNROLL32(val = *p; p2 = reinterpret_cast<Word256_t*>(my_64b_extractLSB_256b(val)); val2 = *p2; *p = val; p = reinterpret_cast<Word256_t*>(my_64b_extractLSB_256b(val2));)
+    UNROLL8(val = *p; p2 = reinterpret_cast<Word256_t*>(my_64b_extractLSB_256b(val)); val2 = *p2; *p = val; p = reinterpret_cast<Word256_t*>(my_64b_extractLSB_256b(val2));)
+    UNROLL2(val = *p; p2 = reinterpret_cast<Word256_t*>(my_64b_extractLSB_256b(val)); val2 = *p2; *p = val; p = reinterpret_cast<Word256_t*>(my_64b_extractLSB_256b(val2));)
+    UNROLL2(val = *p; p = reinterpret_cast<Word256_t*>(my_64b_extractLSB_256b(val));) //Finish the pass with reads
+#else //special case: 32-bit machine
+    UNROLL32(val = *p; p2 = reinterpret_cast<Word256_t*>(my_32b_extractLSB_256b(val)); val2 = *p2; *p = val; p = reinterpret_cast<Word256_t*>(my_32b_extractLSB_256b(val2));)
+    UNROLL8(val = *p; p2 = reinterpret_cast<Word256_t*>(my_32b_extractLSB_256b(val)); val2 = *p2; *p = val; p = reinterpret_cast<Word256_t*>(my_32b_extractLSB_256b(val2));)
+    UNROLL2(val = *p; p2 = reinterpret_cast<Word256_t*>(my_32b_extractLSB_256b(val)); val2 = *p2; *p = val; p = reinterpret_cast<Word256_t*>(my_32b_extractLSB_256b(val2));)
+    UNROLL2(val = *p; p = reinterpret_cast<Word256_t*>(my_32b_extractLSB_256b(val));) //Finish the pass with reads
 #endif
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    //return win_x86_64_asm_forwStride4Read_Word512(static_cast<Word512_t*>(start_address), static_cast<Word512_t*>(end_address));
-    #error 512-bit words are not supported on Windows.
-#else
-    register Word512_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word512_t);
-    //for (volatile Word512_t* wordptr = static_cast<Word512_t*>(start_address); i < len; i += 16) {
-    for (Word512_t* wordptr = static_cast<Word512_t*>(start_address); i < len; i += 16) {
-        //UNROLL16(val = *wordptr; wordptr += 4;) 
-        UNROLL16(val = my_512b_load(wordptr); wordptr += 4;) 
-        if (wordptr >= static_cast<Word512_t*>(end_address)) //end, modulo
-            wordptr -= len;
-    }
+
+    *last_touched_address = reinterpret_cast<uintptr_t*>(const_cast<Word256_t*>(p)); //Trick compiler. First get rid of volatile qualifier, and then reinterpret pointer
     return 0;
 #endif
 }
 #endif
 
-int32_t xmem::revStride4Read_Word32(void* start_address, void* end_address) {
-    register Word32_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word32_t);
-    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(end_address); i < len; i += 256) {
-        UNROLL256(val = *wordptr; wordptr -= 4;) 
-        if (wordptr <= static_cast<Word32_t*>(start_address)) //end, modulo
-            wordptr += len;
-    }
+#ifndef HAS_WORD_64 //special case: 32-bit machine
+int32_t xmem::randomMix3to1_Word32(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len) {
+    volatile uintptr_t* p = first_address;
+    volatile uintptr_t* p2 = NULL;
+    volatile uintptr_t* p3 = NULL;
+    volatile uintptr_t* p4 = NULL;
+
+    UNROLL256(p2 = reinterpret_cast<uintptr_t*>(*p); p3 = reinterpret_cast<uintptr_t*>(*p2); p4 = reinterpret_cast<uintptr_t*>(*p3); *p = reinterpret_cast<uintptr_t>(p2); p = p4;)
+    *last_touched_address = const_cast<uintptr_t*>(p);
     return 0;
 }
+#endif
 
 #ifdef HAS_WORD_64
-int32_t xmem::revStride4Read_Word64(void* start_address, void* end_address) { 
-    register Word64_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word64_t);
-    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(end_address); i < len; i += 128) {
-        UNROLL128(val = *wordptr; wordptr -= 4;)
-        if (wordptr <= static_cast<Word64_t*>(start_address)) //end, modulo
-            wordptr += len;
-    }
+int32_t xmem::randomMix3to1_Word64(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len) {
+    volatile uintptr_t* p = first_address;
+    volatile uintptr_t* p2 = NULL;
+    volatile uintptr_t* p3 = NULL;
+    volatile uintptr_t* p4 = NULL;
+
+    UNROLL128(p2 = reinterpret_cast<uintptr_t*>(*p); p3 = reinterpret_cast<uintptr_t*>(*p2); p4 = reinterpret_cast<uintptr_t*>(*p3); *p = reinterpret_cast<uintptr_t>(p2); p = p4;)
+    *last_touched_address = const_cast<uintptr_t*>(p);
     return 0;
 }
 #endif
 
 #ifdef HAS_WORD_128
-int32_t xmem::revStride4Read_Word128(void* start_address, void* end_address) { 
+int32_t xmem::randomMix3to1_Word128(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len) {
 #if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_revStride4Read_Word128(static_cast<Word128_t*>(end_address), static_cast<Word128_t*>(start_address));
+    Word128_t* p = reinterpret_cast<Word128_t*>(first_address);
+    Word128_t* p2 = NULL;
+    Word128_t* p3 = NULL;
+    Word128_t val, val2, val3;
+
+    //As in randomMix2to1_Word128(), the stored word mixes in a later load so that the store is not dropped
+    UNROLL64(val = _mm_load_si128(p); p2 = reinterpret_cast<Word128_t*>(my_64b_extractLSB_128b(val)); val2 = _mm_load_si128(p2); p3 = reinterpret_cast<Word128_t*>(my_64b_extractLSB_128b(val2)); val3 = _mm_load_si128(p3); _mm_store_si128(p, _mm_unpacklo_epi64(val, val3)); p = reinterpret_cast<Word128_t*>(my_64b_extractLSB_128b(val3));)
+
+    *last_touched_address = reinterpret_cast<uintptr_t*>(p);
+    return 0;
 #else
-    register Word128_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word128_t);
-    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(end_address); i < len; i += 64) {
-        UNROLL64(val = *wordptr; wordptr -= 4;)
-        if (wordptr <= static_cast<Word128_t*>(start_address)) //end, modulo
-            wordptr += len;
-    }
+    volatile Word128_t* p = reinterpret_cast<Word128_t*>(first_address);
+    volatile Word128_t* p2 = NULL;
+    volatile Word128_t* p3 = NULL;
+    register Word128_t val, val2, val3;
+
+#ifdef HAS_WORD_64
+    UNROLL64(val = *p; p2 = reinterpret_cast<Word128_t*>(my_64b_extractLSB_128b(val)); val2 = *p2; p3 = reinterpret_cast<Word128_t*>(my_64b_extractLSB_128b(val2)); val3 = *p3; *p = val; p = reinterpret_cast<Word128_t*>(my_64b_extractLSB_128b(val3));)
+#else //special case: 32-bit machine
+    UNROLL64(val = *p; p2 = reinterpret_cast<Word128_t*>(my_32b_extractLSB_128b(val)); val2 = *p2; p3 = reinterpret_cast<Word128_t*>(my_32b_extractLSB_128b(val2)); val3 = *p3; *p = val; p = reinterpret_cast<Word128_t*>(my_32b_extractLSB_128b(val3));)
+#endif
+
+    *last_touched_address = reinterpret_cast<uintptr_t*>(const_cast<Word128_t*>(p)); //Trick compiler. First get rid of volatile qualifier, and then reinterpret pointer
     return 0;
 #endif
 }
 #endif
 
 #ifdef HAS_WORD_256
-int32_t xmem::revStride4Read_Word256(void* start_address, void* end_address) { 
+int32_t xmem::randomMix3to1_Word256(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len) {
 #if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_revStride4Read_Word256(static_cast<Word256_t*>(end_address), static_cast<Word256_t*>(start_address));
+    Word256_t* p = reinterpret_cast<Word256_t*>(first_address);
+    Word256_t* p2 = NULL;
+    Word256_t* p3 = NULL;
+    Word256_t val, val2, val3;
+
+    //As in randomMix2to1_Word128(), the stored word mixes in a later load so that the store is not dropped
+    UNROLL32(val = _mm256_load_si256(p); p2 = reinterpret_cast<Word256_t*>(my_64b_extractLSB_256b(val)); val2 = _mm256_load_si256(p2); p3 = reinterpret_cast<Word256_t*>(my_64b_extractLSB_256b(val2)); val3 = _mm256_load_si256(p3); _mm256_store_pd(reinterpret_cast<double*>(p), _mm256_blend_pd(_mm256_castsi256_pd(val3), _mm256_castsi256_pd(val), 0x1)); p = reinterpret_cast<Word256_t*>(my_64b_extractLSB_256b(val3));)
+
+    *last_touched_address = reinterpret_cast<uintptr_t*>(p);
+    return 0;
 #else
-    register Word256_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word256_t);
-    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(end_address); i < len; i += 32) {
-        UNROLL32(val = *wordptr; wordptr -= 4;)
-        if (wordptr <= static_cast<Word256_t*>(start_address)) //end, modulo
-            wordptr += len;
-    }
+    volatile Word256_t* p = reinterpret_cast<Word256_t*>(first_address);
+    volatile Word256_t* p2 = NULL;
+    volatile Word256_t* p3 = NULL;
+    register Word256_t val, val2, val3;
+
+#ifdef HAS_WORD_64
+    UNROLL32(val = *p; p2 = reinterpret_cast<Word256_t*>(my_64b_extractLSB_256b(val)); val2 = *p2; p3 = reinterpret_cast<Word256_t*>(my_64b_extractLSB_256b(val2)); val3 = *p3; *p = val; p = reinterpret_cast<Word256_t*>(my_64b_extractLSB_256b(val3));)
+#else //special case: 32-bit machine
+    UNROLL32(val = *p; p2 = reinterpret_cast<Word256_t*>(my_32b_extractLSB_256b(val)); val2 = *p2; p3 = reinterpret_cast<Word256_t*>(my_32b_extractLSB_256b(val2)); val3 = *p3; *p = val; p = reinterpret_cast<Word256_t*>(my_32b_extractLSB_256b(val3));)
+#endif
+
+    *last_touched_address = reinterpret_cast<uintptr_t*>(const_cast<Word256_t*>(p)); //Trick compiler. First get rid of volatile qualifier, and then reinterpret pointer
     return 0;
 #endif
 }
 #endif
 
-#ifdef HAS_WORD_512
-#ifdef _WIN32
-int32_t xmem::revStride4Read_Word512(void* start_address, void* end_address) {
-#else
-//FIXME: We flag GCC/ICC not to optimize this function. The problem is that my_512b_load() -- which maps to _mm512_load_epi64 Intel AVX-512/KNC intrinsic -- cannot accept volatile* arguments. The only way to prevent the entire benchmark loop from being optimized away is to force the compiler not to optimize the function at all. Unfortunately, this will cause extra unwanted code to be included. The only solution seems to be to write inline assembly or allow eventual support for assignment of __m512i variables, e.g., val = *wordptr++; which is how the code for the other word sizes is written.
-int32_t __attribute__((optimize("O0"))) xmem::revStride4Read_Word512(void* start_address, void* end_address) { 
-#endif
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    //return win_x86_64_asm_revStride4Read_Word512(static_cast<Word512_t*>(end_address), static_cast<Word512_t*>(start_address));
-    #error 512-bit words are not supported on Windows.
-#else
-    register Word512_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word512_t);
-    //for (volatile Word512_t* wordptr = static_cast<Word512_t*>(end_address); i < len; i += 16) {
-    for (Word512_t* wordptr = static_cast<Word512_t*>(end_address); i < len; i += 16) {
-        //UNROLL16(val = *wordptr; wordptr -= 4;)
-        UNROLL16(val = my_512b_load(wordptr); wordptr -= 4;)
-        if (wordptr <= static_cast<Word512_t*>(start_address)) //end, modulo
-            wordptr += len;
-    }
+/***********************************************************************
+ ***********************************************************************
+ ******************* ATOMIC OPERATION BENCHMARK KERNELS ****************
+ ***********************************************************************
+ ***********************************************************************/
+
+//All atomic kernels do 64 operations per call, see ATOMIC_OPS_PER_KERNEL_CALL.
+
+/* --------------------- DUMMY BENCHMARK ROUTINES --------------------------- */
+
+int32_t xmem::dummy_atomicLoop(void* lines, size_t num_lines, size_t* next_line, uint64_t* result) {
+    volatile uintptr_t base = reinterpret_cast<uintptr_t>(lines);
+    size_t line = *next_line;
+    uint64_t sum = 0;
+
+    UNROLL64(sum += base + line * CACHE_LINE_SIZE; if (++line == num_lines) line = 0;)
+
+    *next_line = line;
+    *result += sum;
     return 0;
-#endif
 }
-#endif
 
-/* ------------ STRIDE 4 WRITE --------------*/
+/* -------------------- CORE BENCHMARK ROUTINES -------------------------- */
 
-int32_t xmem::forwStride4Write_Word32(void* start_address, void* end_address) {
-    register Word32_t val = 0xFFFFFFFF; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word32_t);
-    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(start_address); i < len; i += 256) {
-        UNROLL256(*wordptr = val; wordptr += 4;)
-        if (wordptr >= static_cast<Word32_t*>(end_address)) //end, modulo
-            wordptr -= len;
+int32_t xmem::atomicFetchAdd_Word64(void* lines, size_t num_lines, size_t* next_line, uint64_t* result) {
+    uint8_t* base = reinterpret_cast<uint8_t*>(lines);
+    size_t line = *next_line;
+    uint64_t sum = 0;
+
+    UNROLL64(sum += reinterpret_cast<std::atomic<uint64_t>*>(base + line * CACHE_LINE_SIZE)->fetch_add(1); if (++line == num_lines) line = 0;)
+
+    *next_line = line;
+    *result += sum;
+    return 0;
+}
+
+int32_t xmem::atomicCompareExchange_Word64(void* lines, size_t num_lines, size_t* next_line, uint64_t* result) {
+    uint8_t* base = reinterpret_cast<uint8_t*>(lines);
+    size_t line = *next_line;
+    uint64_t failures = 0;
+
+    UNROLL64({ std::atomic<uint64_t>* word = reinterpret_cast<std::atomic<uint64_t>*>(base + line * CACHE_LINE_SIZE); uint64_t expected = word->load(std::memory_order_relaxed); if (!word->compare_exchange_strong(expected, expected + 1)) failures++; if (++line == num_lines) line = 0; })
+
+    *next_line = line;
+    *result += failures;
+    return 0;
+}
+
+int32_t xmem::atomicExchange_Word64(void* lines, size_t num_lines, size_t* next_line, uint64_t* result) {
+    uint8_t* base = reinterpret_cast<uint8_t*>(lines);
+    size_t line = *next_line;
+    uint64_t sum = 0;
+
+    UNROLL64(sum += reinterpret_cast<std::atomic<uint64_t>*>(base + line * CACHE_LINE_SIZE)->exchange(line); if (++line == num_lines) line = 0;)
+
+    *next_line = line;
+    *result += sum;
+    return 0;
+}
+
+#ifdef ARCH_INTEL
+/***********************************************************************
+ ***********************************************************************
+ ******************* CACHE FLUSH BENCHMARK KERNELS *********************
+ ***********************************************************************
+ ***********************************************************************/
+
+//All flush kernels walk the region in blocks of 64 cache lines, so it must be a multiple of 4 KB.
+
+/* --------------------- DUMMY BENCHMARK ROUTINES --------------------------- */
+
+int32_t xmem::dummy_flushLoop(void* start_address, void* end_address) {
+    volatile uintptr_t line = reinterpret_cast<uintptr_t>(start_address);
+    uintptr_t end = reinterpret_cast<uintptr_t>(end_address);
+
+    while (line < end) {
+        UNROLL64(line += CACHE_LINE_SIZE;)
+    }
+    return 0;
+}
+
+/* -------------------- CORE BENCHMARK ROUTINES -------------------------- */
+
+int32_t xmem::flushLines_clflush(void* start_address, void* end_address) {
+    uintptr_t line = reinterpret_cast<uintptr_t>(start_address);
+    uintptr_t end = reinterpret_cast<uintptr_t>(end_address);
+
+    while (line < end) {
+        UNROLL64(my_clflush(line); line += CACHE_LINE_SIZE;)
     }
+    my_mfence();
     return 0;
 }
 
-#ifdef HAS_WORD_64
-int32_t xmem::forwStride4Write_Word64(void* start_address, void* end_address) {
-    register Word64_t val = 0xFFFFFFFFFFFFFFFF; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word64_t);
-    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(start_address); i < len; i += 128) {
-        UNROLL128(*wordptr = val; wordptr += 4;)
-        if (wordptr >= static_cast<Word64_t*>(end_address)) //end, modulo
-            wordptr -= len;
+int32_t xmem::flushLines_clflushopt(void* start_address, void* end_address) {
+    uintptr_t line = reinterpret_cast<uintptr_t>(start_address);
+    uintptr_t end = reinterpret_cast<uintptr_t>(end_address);
+
+    while (line < end) {
+        UNROLL64(my_clflushopt(line); line += CACHE_LINE_SIZE;)
     }
+    my_mfence();
     return 0;
 }
-#endif
 
-#ifdef HAS_WORD_128
-int32_t xmem::forwStride4Write_Word128(void* start_address, void* end_address) { 
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_forwStride4Write_Word128(static_cast<Word128_t*>(start_address), static_cast<Word128_t*>(end_address));
-#else
-    register Word128_t val;
-    val = my_64b_set_128b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF);
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word128_t);
-    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(start_address); i < len; i += 64) {
-        UNROLL64(*wordptr = val; wordptr += 4;)
-        if (wordptr >= static_cast<Word128_t*>(end_address)) //end, modulo
-            wordptr -= len;
+int32_t xmem::flushLines_clwb(void* start_address, void* end_address) {
+    uintptr_t line = reinterpret_cast<uintptr_t>(start_address);
+    uintptr_t end = reinterpret_cast<uintptr_t>(end_address);
+
+    while (line < end) {
+        UNROLL64(my_clwb(line); line += CACHE_LINE_SIZE;)
     }
+    my_mfence();
     return 0;
-#endif
 }
-#endif
 
-#ifdef HAS_WORD_256
-int32_t xmem::forwStride4Write_Word256(void* start_address, void* end_address) { 
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_forwStride4Write_Word256(static_cast<Word256_t*>(start_address), static_cast<Word256_t*>(end_address));
-#else
-    register Word256_t val;
-    val = my_64b_set_256b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF);
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word256_t);
-    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(start_address); i < len; i += 32) {
-        UNROLL32(*wordptr = val; wordptr += 4;)
-        if (wordptr >= static_cast<Word256_t*>(end_address)) //end, modulo
-            wordptr -= len;
+int32_t xmem::flushLinesFenced_clflush(void* start_address, void* end_address) {
+    uintptr_t line = reinterpret_cast<uintptr_t>(start_address);
+    uintptr_t end = reinterpret_cast<uintptr_t>(end_address);
+
+    while (line < end) {
+        UNROLL64(my_clflush(line); my_mfence(); line += CACHE_LINE_SIZE;)
     }
     return 0;
-#endif
 }
-#endif
 
-#ifdef HAS_WORD_512
-#ifdef _WIN32
-int32_t xmem::forwStride4Write_Word512(void* start_address, void* end_address) {
-#else
-//FIXME: We flag GCC/ICC not to optimize this function. The problem is that my_512b_load() -- which maps to _mm512_load_epi64 Intel AVX-512/KNC intrinsic -- cannot accept volatile* arguments. The only way to prevent the entire benchmark loop from being optimized away is to force the compiler not to optimize the function at all. Unfortunately, this will cause extra unwanted code to be included. The only solution seems to be to write inline assembly or allow eventual support for assignment of __m512i variables, e.g., val = *wordptr++; which is how the code for the other word sizes is written.
-int32_t __attribute__((optimize("O0"))) xmem::forwStride4Write_Word512(void* start_address, void* end_address) { 
-#endif
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    //return win_x86_64_asm_forwStride4Write_Word512(static_cast<Word512_t*>(start_address), static_cast<Word512_t*>(end_address));
-    #error 512-bit words are not supported on Windows.
-#else
-    register Word512_t val;
-    uint64_t scratchptr[8] __attribute__ ((aligned(512)));
-    my_64b_set_512b_word(val, scratchptr, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF);
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word512_t);
-    for (Word512_t* wordptr = static_cast<Word512_t*>(start_address); i < len; i += 16) {
-        UNROLL16(*wordptr = val; wordptr += 4;)
-        if (wordptr >= static_cast<Word512_t*>(end_address)) //end, modulo
-            wordptr -= len;
+int32_t xmem::flushLinesFenced_clflushopt(void* start_address, void* end_address) {
+    uintptr_t line = reinterpret_cast<uintptr_t>(start_address);
+    uintptr_t end = reinterpret_cast<uintptr_t>(end_address);
+
+    while (line < end) {
+        UNROLL64(my_clflushopt(line); my_mfence(); line += CACHE_LINE_SIZE;)
     }
     return 0;
-#endif
 }
-#endif
 
-int32_t xmem::revStride4Write_Word32(void* start_address, void* end_address) { 
-    register Word32_t val = 0xFFFFFFFF; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word32_t);
-    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(end_address); i < len; i += 256) {
-        UNROLL256(*wordptr = val; wordptr -= 4;)
-        if (wordptr <= static_cast<Word32_t*>(start_address)) //end, modulo
-            wordptr += len;
+int32_t xmem::flushLinesFenced_clwb(void* start_address, void* end_address) {
+    uintptr_t line = reinterpret_cast<uintptr_t>(start_address);
+    uintptr_t end = reinterpret_cast<uintptr_t>(end_address);
+
+    while (line < end) {
+        UNROLL64(my_clwb(line); my_mfence(); line += CACHE_LINE_SIZE;)
     }
     return 0;
 }
+#endif
 
-#ifdef HAS_WORD_64
-int32_t xmem::revStride4Write_Word64(void* start_address, void* end_address) { 
-    register Word64_t val = 0xFFFFFFFFFFFFFFFF; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word64_t);
-    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(end_address); i < len; i += 128) {
-        UNROLL128(*wordptr = val; wordptr -= 4;)
-        if (wordptr <= static_cast<Word64_t*>(start_address)) //end, modulo
-            wordptr += len;
-    }
+/***********************************************************************
+ ***********************************************************************
+ ******************* COPY AND FILL BENCHMARK KERNELS *******************
+ ***********************************************************************
+ ***********************************************************************/
+
+#define COPY_FILL_BYTE 0xA5 //Fill kernels write this byte rather than zeros, which some processors handle specially
+
+/* --------------------- DUMMY BENCHMARK ROUTINES --------------------------- */
+
+int32_t xmem::dummy_copyFunction(void* dst, void* src, size_t len) {
     return 0;
 }
-#endif
 
-#ifdef HAS_WORD_128
-int32_t xmem::revStride4Write_Word128(void* start_address, void* end_address) { 
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_revStride4Write_Word128(static_cast<Word128_t*>(end_address), static_cast<Word128_t*>(start_address));
-#else
-    register Word128_t val;
-    val = my_64b_set_128b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF);
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word128_t);
-    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(end_address); i < len; i += 64) {
-        UNROLL64(*wordptr = val; wordptr -= 4;)
-        if (wordptr <= static_cast<Word128_t*>(start_address)) //end, modulo
-            wordptr += len;
-    }
+/* -------------------- CORE BENCHMARK ROUTINES -------------------------- */
+
+int32_t xmem::copy_memcpy(void* dst, void* src, size_t len) {
+    std::memcpy(dst, src, len);
     return 0;
-#endif
 }
-#endif
 
-#ifdef HAS_WORD_256
-int32_t xmem::revStride4Write_Word256(void* start_address, void* end_address) { 
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_revStride4Write_Word256(static_cast<Word256_t*>(end_address), static_cast<Word256_t*>(start_address));
-#else
-    register Word256_t val;
-    val = my_64b_set_256b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF);
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word256_t);
-    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(end_address); i < len; i += 32) {
-        UNROLL32(*wordptr = val; wordptr -= 4;)
-        if (wordptr <= static_cast<Word256_t*>(start_address)) //end, modulo
-            wordptr += len;
-    }
+int32_t xmem::copy_memmove(void* dst, void* src, size_t len) {
+    std::memmove(dst, src, len);
     return 0;
-#endif
 }
-#endif
 
-#ifdef HAS_WORD_512
+int32_t xmem::fill_memset(void* dst, void* src, size_t len) {
+    std::memset(dst, COPY_FILL_BYTE, len);
+    return 0;
+}
+
+#ifdef ARCH_INTEL
+int32_t xmem::copy_repMovsb(void* dst, void* src, size_t len) {
 #ifdef _WIN32
-int32_t xmem::revStride4Write_Word512(void* start_address, void* end_address) {
-#else
-//FIXME: We flag GCC/ICC not to optimize this function. The problem is that my_512b_load() -- which maps to _mm512_load_epi64 Intel AVX-512/KNC intrinsic -- cannot accept volatile* arguments. The only way to prevent the entire benchmark loop from being optimized away is to force the compiler not to optimize the function at all. Unfortunately, this will cause extra unwanted code to be included. The only solution seems to be to write inline assembly or allow eventual support for assignment of __m512i variables, e.g., val = *wordptr++; which is how the code for the other word sizes is written.
-int32_t __attribute__((optimize("O0"))) xmem::revStride4Write_Word512(void* start_address, void* end_address) { 
+    __movsb(static_cast<unsigned char*>(dst), static_cast<const unsigned char*>(src), len);
+#endif
+#ifdef __gnu_linux__
+    asm volatile("rep movsb" : "+D" (dst), "+S" (src), "+c" (len) : : "memory");
 #endif
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    //return win_x86_64_asm_revStride4Write_Word512(static_cast<Word512_t*>(end_address), static_cast<Word512_t*>(start_address));
-    #error 512-bit words are not supported on Windows.
-#else
-    register Word512_t val;
-    uint64_t scratchptr[8] __attribute__ ((aligned(512)));
-    my_64b_set_512b_word(val, scratchptr, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF);
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word512_t);
-    for (Word512_t* wordptr = static_cast<Word512_t*>(end_address); i < len; i += 16) {
-        UNROLL16(*wordptr = val; wordptr -= 4;)
-        if (wordptr <= static_cast<Word512_t*>(start_address)) //end, modulo
-            wordptr += len;
-    }
     return 0;
+}
+
+int32_t xmem::fill_repStosb(void* dst, void* src, size_t len) {
+#ifdef _WIN32
+    __stosb(static_cast<unsigned char*>(dst), COPY_FILL_BYTE, len);
+#endif
+#ifdef __gnu_linux__
+    asm volatile("rep stosb" : "+D" (dst), "+c" (len) : "a" (COPY_FILL_BYTE) : "memory");
 #endif
+    return 0;
 }
 #endif
 
-/* ------------ STRIDE 8 READ --------------*/
+#if defined(ARCH_INTEL) && defined(HAS_WORD_256)
+int32_t xmem::copyVector_Word256(void* dst, void* src, size_t len) {
+    uint8_t* d = static_cast<uint8_t*>(dst);
+    uint8_t* s = static_cast<uint8_t*>(src);
+    uint8_t* end = d + len;
 
-int32_t xmem::forwStride8Read_Word32(void* start_address, void* end_address) {
-    register Word32_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word32_t);
-    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(start_address); i < len; i += 128) {
-        UNROLL128(val = *wordptr; wordptr += 8;) 
-        if (wordptr >= static_cast<Word32_t*>(end_address)) //end, modulo
-            wordptr -= len;
+    while (end - d >= 128) {
+        UNROLL4(_mm256_storeu_si256(reinterpret_cast<Word256_t*>(d), _mm256_loadu_si256(reinterpret_cast<Word256_t*>(s))); d += sizeof(Word256_t); s += sizeof(Word256_t);)
     }
-    return 0;
-}
-
-#ifdef HAS_WORD_64
-int32_t xmem::forwStride8Read_Word64(void* start_address, void* end_address) { 
-    register Word64_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word64_t);
-    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(start_address); i < len; i += 64) {
-        UNROLL64(val = *wordptr; wordptr += 8;) 
-        if (wordptr >= static_cast<Word64_t*>(end_address)) //end, modulo
-            wordptr -= len;
+    while (end - d >= static_cast<ptrdiff_t>(sizeof(Word256_t))) {
+        _mm256_storeu_si256(reinterpret_cast<Word256_t*>(d), _mm256_loadu_si256(reinterpret_cast<Word256_t*>(s)));
+        d += sizeof(Word256_t);
+        s += sizeof(Word256_t);
     }
+    while (d < end)
+        *d++ = *s++;
     return 0;
 }
-#endif
 
-#ifdef HAS_WORD_128
-int32_t xmem::forwStride8Read_Word128(void* start_address, void* end_address) { 
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_forwStride8Read_Word128(static_cast<Word128_t*>(start_address), static_cast<Word128_t*>(end_address));
-#else
-    register Word128_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word128_t);
-    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(start_address); i < len; i += 32) {
-        UNROLL32(val = *wordptr; wordptr += 8;) 
-        if (wordptr >= static_cast<Word128_t*>(end_address)) //end, modulo
-            wordptr -= len;
+int32_t xmem::copyVectorNT_Word256(void* dst, void* src, size_t len) {
+    uint8_t* d = static_cast<uint8_t*>(dst);
+    uint8_t* s = static_cast<uint8_t*>(src);
+    uint8_t* end = d + len;
+
+    //Streaming stores need aligned destinations
+    while (d < end && (reinterpret_cast<uintptr_t>(d) % sizeof(Word256_t)) != 0)
+        *d++ = *s++;
+    while (end - d >= 128) {
+        UNROLL4(_mm256_stream_si256(reinterpret_cast<Word256_t*>(d), _mm256_loadu_si256(reinterpret_cast<Word256_t*>(s))); d += sizeof(Word256_t); s += sizeof(Word256_t);)
     }
+    while (end - d >= static_cast<ptrdiff_t>(sizeof(Word256_t))) {
+        _mm256_stream_si256(reinterpret_cast<Word256_t*>(d), _mm256_loadu_si256(reinterpret_cast<Word256_t*>(s)));
+        d += sizeof(Word256_t);
+        s += sizeof(Word256_t);
+    }
+    while (d < end)
+        *d++ = *s++;
+    _mm_sfence();
     return 0;
-#endif
 }
-#endif
 
-#ifdef HAS_WORD_256
-int32_t xmem::forwStride8Read_Word256(void* start_address, void* end_address) { 
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_forwStride8Read_Word256(static_cast<Word256_t*>(start_address), static_cast<Word256_t*>(end_address));
-#else
-    register Word256_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word256_t);
-    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(start_address); i < len; i += 16) {
-        UNROLL16(val = *wordptr; wordptr += 8;) 
-        if (wordptr >= static_cast<Word256_t*>(end_address)) //end, modulo
-            wordptr -= len;
+int32_t xmem::fillVector_Word256(void* dst, void* src, size_t len) {
+    uint8_t* d = static_cast<uint8_t*>(dst);
+    uint8_t* end = d + len;
+    Word256_t val = _mm256_set1_epi8(static_cast<char>(COPY_FILL_BYTE));
+
+    while (end - d >= 128) {
+        UNROLL4(_mm256_storeu_si256(reinterpret_cast<Word256_t*>(d), val); d += sizeof(Word256_t);)
     }
+    while (end - d >= static_cast<ptrdiff_t>(sizeof(Word256_t))) {
+        _mm256_storeu_si256(reinterpret_cast<Word256_t*>(d), val);
+        d += sizeof(Word256_t);
+    }
+    while (d < end)
+        *d++ = COPY_FILL_BYTE;
     return 0;
-#endif
 }
-#endif
 
-#ifdef HAS_WORD_512
-#ifdef _WIN32
-int32_t xmem::forwStride8Read_Word512(void* start_address, void* end_address) {
-#else
-//FIXME: We flag GCC/ICC not to optimize this function. The problem is that my_512b_load() -- which maps to _mm512_load_epi64 Intel AVX-512/KNC intrinsic -- cannot accept volatile* arguments. The only way to prevent the entire benchmark loop from being optimized away is to force the compiler not to optimize the function at all. Unfortunately, this will cause extra unwanted code to be included. The only solution seems to be to write inline assembly or allow eventual support for assignment of __m512i variables, e.g., val = *wordptr++; which is how the code for the other word sizes is written.
-int32_t __attribute__((optimize("O0"))) xmem::forwStride8Read_Word512(void* start_address, void* end_address) { 
-#endif
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    //return win_x86_64_asm_forwStride8Read_Word512(static_cast<Word512_t*>(start_address), static_cast<Word512_t*>(end_address));
-    #error 512-bit words are not supported on Windows.
-#else
-    register Word512_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word512_t);
-    //for (volatile Word512_t* wordptr = static_cast<Word512_t*>(start_address); i < len; i += 8) {
-    for (Word512_t* wordptr = static_cast<Word512_t*>(start_address); i < len; i += 8) {
-        //UNROLL8(val = *wordptr; wordptr += 8;) 
-        UNROLL8(val = my_512b_load(wordptr); wordptr += 8;) 
-        if (wordptr >= static_cast<Word512_t*>(end_address)) //end, modulo
-            wordptr -= len;
+int32_t xmem::fillVectorNT_Word256(void* dst, void* src, size_t len) {
+    uint8_t* d = static_cast<uint8_t*>(dst);
+    uint8_t* end = d + len;
+    Word256_t val = _mm256_set1_epi8(static_cast<char>(COPY_FILL_BYTE));
+
+    //Streaming stores need aligned destinations
+    while (d < end && (reinterpret_cast<uintptr_t>(d) % sizeof(Word256_t)) != 0)
+        *d++ = COPY_FILL_BYTE;
+    while (end - d >= 128) {
+        UNROLL4(_mm256_stream_si256(reinterpret_cast<Word256_t*>(d), val); d += sizeof(Word256_t);)
     }
+    while (end - d >= static_cast<ptrdiff_t>(sizeof(Word256_t))) {
+        _mm256_stream_si256(reinterpret_cast<Word256_t*>(d), val);
+        d += sizeof(Word256_t);
+    }
+    while (d < end)
+        *d++ = COPY_FILL_BYTE;
+    _mm_sfence();
     return 0;
-#endif
 }
 #endif
 
-int32_t xmem::revStride8Read_Word32(void* start_address, void* end_address) {
-    register Word32_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word32_t);
-    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(end_address); i < len; i += 128) {
-        UNROLL128(val = *wordptr; wordptr -= 8;) 
-        if (wordptr <= static_cast<Word32_t*>(start_address)) //end, modulo
-            wordptr += len;
-    }
-    return 0;
+/***********************************************************************
+ ***********************************************************************
+ ***************** GATHER AND SCATTER BENCHMARK KERNELS ****************
+ ***********************************************************************
+ ***********************************************************************/
+
+/* --------------------- DUMMY BENCHMARK ROUTINES --------------------------- */
+
+int32_t xmem::dummy_gatherLoop_Word64(void* base, const uint32_t* indices, size_t count) {
+    volatile int32_t placeholder = 0; //Try our best to defeat compiler optimizations
+    for (volatile const uint32_t* idx = indices, *end = indices + count; idx < end; idx += 8)
+        placeholder = 0;
+    return placeholder;
 }
 
+/* -------------------- CORE BENCHMARK ROUTINES -------------------------- */
+
 #ifdef HAS_WORD_64
-int32_t xmem::revStride8Read_Word64(void* start_address, void* end_address) { 
-    register Word64_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word64_t);
-    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(end_address); i < len; i += 64) {
-        UNROLL64(val = *wordptr; wordptr -= 8;)
-        if (wordptr <= static_cast<Word64_t*>(start_address)) //end, modulo
-            wordptr += len;
+int32_t xmem::gatherScalar_Word64(void* base, const uint32_t* indices, size_t count) {
+    register Word64_t val = 0;
+    volatile Word64_t* data = static_cast<Word64_t*>(base);
+    for (const uint32_t* idx = indices, *end = indices + count; idx < end; idx += 8) {
+        val ^= data[idx[0]]; val ^= data[idx[1]]; val ^= data[idx[2]]; val ^= data[idx[3]];
+        val ^= data[idx[4]]; val ^= data[idx[5]]; val ^= data[idx[6]]; val ^= data[idx[7]];
     }
-    return 0;
+    return static_cast<int32_t>(val);
 }
-#endif
 
-#ifdef HAS_WORD_128
-int32_t xmem::revStride8Read_Word128(void* start_address, void* end_address) { 
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_revStride8Read_Word128(static_cast<Word128_t*>(end_address), static_cast<Word128_t*>(start_address));
-#else
-    register Word128_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word128_t);
-    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(end_address); i < len; i += 32) {
-        UNROLL32(val = *wordptr; wordptr -= 8;)
-        if (wordptr <= static_cast<Word128_t*>(start_address)) //end, modulo
-            wordptr += len;
+int32_t xmem::scatterScalar_Word64(void* base, const uint32_t* indices, size_t count) {
+    register Word64_t val = 0xFFFFFFFFFFFFFFFF;
+    volatile Word64_t* data = static_cast<Word64_t*>(base);
+    for (const uint32_t* idx = indices, *end = indices + count; idx < end; idx += 8) {
+        data[idx[0]] = val; data[idx[1]] = val; data[idx[2]] = val; data[idx[3]] = val;
+        data[idx[4]] = val; data[idx[5]] = val; data[idx[6]] = val; data[idx[7]] = val;
     }
     return 0;
-#endif
 }
 #endif
 
-#ifdef HAS_WORD_256
-int32_t xmem::revStride8Read_Word256(void* start_address, void* end_address) { 
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_revStride8Read_Word256(static_cast<Word256_t*>(end_address), static_cast<Word256_t*>(start_address));
+#if defined(ARCH_INTEL_X86_64) && defined(HAS_WORD_256)
+//The vector kernels are compiled for AVX2 and AVX-512F regardless of the build flags. Callers must check gather_engine_supported() first.
+#ifdef _WIN32
+int32_t xmem::gatherAVX2_Word64(void* base, const uint32_t* indices, size_t count) {
 #else
-    register Word256_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word256_t);
-    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(end_address); i < len; i += 16) {
-        UNROLL16(val = *wordptr; wordptr -= 8;)
-        if (wordptr <= static_cast<Word256_t*>(start_address)) //end, modulo
-            wordptr += len;
-    }
-    return 0;
+int32_t __attribute__((target("avx2"))) xmem::gatherAVX2_Word64(void* base, const uint32_t* indices, size_t count) {
 #endif
+    const long long* data = static_cast<const long long*>(base);
+    __m256i acc = _mm256_setzero_si256();
+    for (const uint32_t* idx = indices, *end = indices + count; idx < end; idx += 8) {
+        acc = _mm256_xor_si256(acc, _mm256_i32gather_epi64(data, _mm_loadu_si128(reinterpret_cast<const __m128i*>(idx)), 8));
+        acc = _mm256_xor_si256(acc, _mm256_i32gather_epi64(data, _mm_loadu_si128(reinterpret_cast<const __m128i*>(idx + 4)), 8));
+    }
+    return _mm_cvtsi128_si32(_mm256_castsi256_si128(acc));
 }
-#endif
 
-#ifdef HAS_WORD_512
 #ifdef _WIN32
-int32_t xmem::revStride8Read_Word512(void* start_address, void* end_address) {
+int32_t xmem::gatherAVX512_Word64(void* base, const uint32_t* indices, size_t count) {
 #else
-//FIXME: We flag GCC/ICC not to optimize this function. The problem is that my_512b_load() -- which maps to _mm512_load_epi64 Intel AVX-512/KNC intrinsic -- cannot accept volatile* arguments. The only way to prevent the entire benchmark loop from being optimized away is to force the compiler not to optimize the function at all. Unfortunately, this will cause extra unwanted code to be included. The only solution seems to be to write inline assembly or allow eventual support for assignment of __m512i variables, e.g., val = *wordptr++; which is how the code for the other word sizes is written.
-int32_t __attribute__((optimize("O0"))) xmem::revStride8Read_Word512(void* start_address, void* end_address) { 
+int32_t __attribute__((target("avx512f"))) xmem::gatherAVX512_Word64(void* base, const uint32_t* indices, size_t count) {
 #endif
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    //return win_x86_64_asm_revStride8Read_Word512(static_cast<Word512_t*>(end_address), static_cast<Word512_t*>(start_address));
-    #error 512-bit words are not supported on Windows.
+    __m512i zero = _mm512_setzero_si512(); //Explicit merge source, since the unmasked intrinsic leaves it undefined
+    __m512i acc = zero;
+    for (const uint32_t* idx = indices, *end = indices + count; idx < end; idx += 8)
+        acc = _mm512_xor_si512(acc, _mm512_mask_i32gather_epi64(zero, 0xFF, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(idx)), base, 8));
+    return _mm512_cvtsi512_si32(acc);
+}
+
+#ifdef _WIN32
+int32_t xmem::scatterAVX512_Word64(void* base, const uint32_t* indices, size_t count) {
 #else
-    register Word512_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word512_t);
-    //for (volatile Word512_t* wordptr = static_cast<Word512_t*>(end_address); i < len; i += 8) {
-    for (Word512_t* wordptr = static_cast<Word512_t*>(end_address); i < len; i += 8) {
-        //UNROLL8(val = *wordptr; wordptr -= 8;)
-        UNROLL8(val = my_512b_load(wordptr); wordptr -= 8;)
-        if (wordptr <= static_cast<Word512_t*>(start_address)) //end, modulo
-            wordptr += len;
-    }
-    return 0;
+int32_t __attribute__((target("avx512f"))) xmem::scatterAVX512_Word64(void* base, const uint32_t* indices, size_t count) {
 #endif
+    __m512i val = _mm512_set1_epi64(-1);
+    for (const uint32_t* idx = indices, *end = indices + count; idx < end; idx += 8)
+        _mm512_i32scatter_epi64(base, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(idx)), val, 8);
+    return 0;
 }
 #endif
 
-/* ------------ STRIDE 8 WRITE --------------*/
+/***********************************************************************
+ ***********************************************************************
+ ******************* MULTI-STREAM BENCHMARK KERNELS ********************
+ ***********************************************************************
+ ***********************************************************************/
 
-int32_t xmem::forwStride8Write_Word32(void* start_address, void* end_address) {
-    register Word32_t val = 0xFFFFFFFF; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word32_t);
-    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(start_address); i < len; i += 128) {
-        UNROLL128(*wordptr = val; wordptr += 8;)
-        if (wordptr >= static_cast<Word32_t*>(end_address)) //end, modulo
-            wordptr -= len;
+/* --------------------- DUMMY BENCHMARK ROUTINES --------------------------- */
+
+int32_t xmem::dummy_multiStreamLoop(void* start_address, size_t stream_len, uint32_t num_streams) {
+    volatile int32_t placeholder = 0; //Try our best to defeat compiler optimizations
+    uint8_t* streams_end = static_cast<uint8_t*>(start_address) + stream_len * num_streams;
+    for (size_t offset = 0; offset < stream_len; offset += CACHE_LINE_SIZE) {
+        for (uint8_t* line = static_cast<uint8_t*>(start_address) + offset; line < streams_end; line += stream_len)
+            placeholder = 0;
     }
-    return 0;
+    return placeholder;
 }
 
+/* -------------------- CORE BENCHMARK ROUTINES -------------------------- */
+
 #ifdef HAS_WORD_64
-int32_t xmem::forwStride8Write_Word64(void* start_address, void* end_address) {
-    register Word64_t val = 0xFFFFFFFFFFFFFFFF; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word64_t);
-    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(start_address); i < len; i += 64) {
-        UNROLL64(*wordptr = val; wordptr += 8;)
-        if (wordptr >= static_cast<Word64_t*>(end_address)) //end, modulo
-            wordptr -= len;
+int32_t xmem::forwMultiStreamRead_Word64(void* start_address, size_t stream_len, uint32_t num_streams) {
+    register Word64_t val;
+    uint8_t* streams_end = static_cast<uint8_t*>(start_address) + stream_len * num_streams;
+    for (size_t offset = 0; offset < stream_len; offset += CACHE_LINE_SIZE) {
+        for (uint8_t* line = static_cast<uint8_t*>(start_address) + offset; line < streams_end; line += stream_len) {
+            volatile Word64_t* wordptr = reinterpret_cast<Word64_t*>(line);
+            UNROLL8(val = *wordptr++;)
+        }
     }
     return 0;
 }
-#endif
 
-#ifdef HAS_WORD_128
-int32_t xmem::forwStride8Write_Word128(void* start_address, void* end_address) { 
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_forwStride8Write_Word128(static_cast<Word128_t*>(start_address), static_cast<Word128_t*>(end_address));
-#else
-    register Word128_t val;
-    val = my_64b_set_128b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF);
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word128_t);
-    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(start_address); i < len; i += 32) {
-        UNROLL32(*wordptr = val; wordptr += 8;)
-        if (wordptr >= static_cast<Word128_t*>(end_address)) //end, modulo
-            wordptr -= len;
+int32_t xmem::revMultiStreamRead_Word64(void* start_address, size_t stream_len, uint32_t num_streams) {
+    register Word64_t val;
+    uint8_t* streams_end = static_cast<uint8_t*>(start_address) + stream_len * num_streams;
+    for (size_t offset = stream_len; offset > 0; offset -= CACHE_LINE_SIZE) {
+        for (uint8_t* line = static_cast<uint8_t*>(start_address) + offset - CACHE_LINE_SIZE; line < streams_end; line += stream_len) {
+            volatile Word64_t* wordptr = reinterpret_cast<Word64_t*>(line) + CACHE_LINE_SIZE / sizeof(Word64_t);
+            UNROLL8(val = *(--wordptr);)
+        }
     }
     return 0;
-#endif
 }
 #endif
 
 #ifdef HAS_WORD_256
-int32_t xmem::forwStride8Write_Word256(void* start_address, void* end_address) { 
+int32_t xmem::forwMultiStreamRead_Word256(void* start_address, size_t stream_len, uint32_t num_streams) {
 #if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_forwStride8Write_Word256(static_cast<Word256_t*>(start_address), static_cast<Word256_t*>(end_address));
+    __m256d val = _mm256_setzero_pd(); //The loads are folded into the returned value so that the compiler keeps them without volatile vector accesses
+    uint8_t* streams_end = static_cast<uint8_t*>(start_address) + stream_len * num_streams;
+    for (size_t offset = 0; offset < stream_len; offset += CACHE_LINE_SIZE) {
+        for (uint8_t* line = static_cast<uint8_t*>(start_address) + offset; line < streams_end; line += stream_len) {
+            const double* wordptr = reinterpret_cast<const double*>(line);
+            val = _mm256_xor_pd(val, _mm256_load_pd(wordptr));
+            val = _mm256_xor_pd(val, _mm256_load_pd(wordptr + 4));
+        }
+    }
+    return _mm256_movemask_pd(val);
 #else
     register Word256_t val;
-    val = my_64b_set_256b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF); 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word256_t);
-    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(start_address); i < len; i += 16) {
-        UNROLL16(*wordptr = val; wordptr += 8;)
-        if (wordptr >= static_cast<Word256_t*>(end_address)) //end, modulo
-            wordptr -= len;
+    uint8_t* streams_end = static_cast<uint8_t*>(start_address) + stream_len * num_streams;
+    for (size_t offset = 0; offset < stream_len; offset += CACHE_LINE_SIZE) {
+        for (uint8_t* line = static_cast<uint8_t*>(start_address) + offset; line < streams_end; line += stream_len) {
+            volatile Word256_t* wordptr = reinterpret_cast<Word256_t*>(line);
+            UNROLL2(val = *wordptr++;)
+        }
     }
     return 0;
 #endif
 }
-#endif
 
-#ifdef HAS_WORD_512
-#ifdef _WIN32
-int32_t xmem::forwStride8Write_Word512(void* start_address, void* end_address) {
-#else
-//FIXME: We flag GCC/ICC not to optimize this function. The problem is that my_512b_load() -- which maps to _mm512_load_epi64 Intel AVX-512/KNC intrinsic -- cannot accept volatile* arguments. The only way to prevent the entire benchmark loop from being optimized away is to force the compiler not to optimize the function at all. Unfortunately, this will cause extra unwanted code to be included. The only solution seems to be to write inline assembly or allow eventual support for assignment of __m512i variables, e.g., val = *wordptr++; which is how the code for the other word sizes is written.
-int32_t __attribute__((optimize("O0"))) xmem::forwStride8Write_Word512(void* start_address, void* end_address) { 
-#endif
+int32_t xmem::revMultiStreamRead_Word256(void* start_address, size_t stream_len, uint32_t num_streams) {
 #if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    //return win_x86_64_asm_forwStride8Write_Word512(static_cast<Word512_t*>(start_address), static_cast<Word512_t*>(end_address));
-    #error 512-bit words are not supported on Windows.
+    __m256d val = _mm256_setzero_pd(); //The loads are folded into the returned value so that the compiler keeps them without volatile vector accesses
+    uint8_t* streams_end = static_cast<uint8_t*>(start_address) + stream_len * num_streams;
+    for (size_t offset = stream_len; offset > 0; offset -= CACHE_LINE_SIZE) {
+        for (uint8_t* line = static_cast<uint8_t*>(start_address) + offset - CACHE_LINE_SIZE; line < streams_end; line += stream_len) {
+            const double* wordptr = reinterpret_cast<const double*>(line);
+            val = _mm256_xor_pd(val, _mm256_load_pd(wordptr + 4));
+            val = _mm256_xor_pd(val, _mm256_load_pd(wordptr));
+        }
+    }
+    return _mm256_movemask_pd(val);
 #else
-    register Word512_t val;
-    uint64_t scratchptr[8] __attribute__ ((aligned(512)));
-    my_64b_set_512b_word(val, scratchptr, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF); 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word512_t);
-    for (Word512_t* wordptr = static_cast<Word512_t*>(start_address); i < len; i += 8) {
-        UNROLL8(*wordptr = val; wordptr += 8;)
-        if (wordptr >= static_cast<Word512_t*>(end_address)) //end, modulo
-            wordptr -= len;
+    register Word256_t val;
+    uint8_t* streams_end = static_cast<uint8_t*>(start_address) + stream_len * num_streams;
+    for (size_t offset = stream_len; offset > 0; offset -= CACHE_LINE_SIZE) {
+        for (uint8_t* line = static_cast<uint8_t*>(start_address) + offset - CACHE_LINE_SIZE; line < streams_end; line += stream_len) {
+            volatile Word256_t* wordptr = reinterpret_cast<Word256_t*>(line) + CACHE_LINE_SIZE / sizeof(Word256_t);
+            UNROLL2(val = *(--wordptr);)
+        }
     }
     return 0;
 #endif
 }
 #endif
 
-int32_t xmem::revStride8Write_Word32(void* start_address, void* end_address) { 
-    register Word32_t val = 0xFFFFFFFF; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word32_t);
-    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(end_address); i < len; i += 128) {
-        UNROLL128(*wordptr = val; wordptr -= 8;)
-        if (wordptr <= static_cast<Word32_t*>(start_address)) //end, modulo
-            wordptr += len;
-    }
-    return 0;
-}
+/***********************************************************************
+ ***********************************************************************
+ ****************** UNALIGNED ACCESS BENCHMARK KERNELS *****************
+ ***********************************************************************
+ ***********************************************************************/
 
+#ifdef ARCH_INTEL
+//Word types that may sit at any byte address, so that the compiler never assumes natural alignment when loading or storing them
+#ifdef __gnu_linux__
+typedef Word32_t UnalignedWord32_t __attribute__((aligned(1)));
 #ifdef HAS_WORD_64
-int32_t xmem::revStride8Write_Word64(void* start_address, void* end_address) { 
-    register Word64_t val = 0xFFFFFFFFFFFFFFFF; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word64_t);
-    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(end_address); i < len; i += 64) {
-        UNROLL64(*wordptr = val; wordptr -= 8;)
-        if (wordptr <= static_cast<Word64_t*>(start_address)) //end, modulo
-            wordptr += len;
-    }
-    return 0;
-}
+typedef Word64_t UnalignedWord64_t __attribute__((aligned(1)));
 #endif
-
 #ifdef HAS_WORD_128
-int32_t xmem::revStride8Write_Word128(void* start_address, void* end_address) { 
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_revStride8Write_Word128(static_cast<Word128_t*>(end_address), static_cast<Word128_t*>(start_address));
+typedef Word128_t UnalignedWord128_t __attribute__((aligned(1)));
+#endif
+#ifdef HAS_WORD_256
+typedef Word256_t UnalignedWord256_t __attribute__((aligned(1)));
+#endif
 #else
-    register Word128_t val;
-    val = my_64b_set_128b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF); 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word128_t);
-    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(end_address); i < len; i += 32) {
-        UNROLL32(*wordptr = val; wordptr -= 8;)
-        if (wordptr <= static_cast<Word128_t*>(start_address)) //end, modulo
-            wordptr += len;
-    }
-    return 0;
+typedef Word32_t UnalignedWord32_t; //VC++ uses unaligned moves for scalar words
+#ifdef HAS_WORD_64
+typedef Word64_t UnalignedWord64_t;
 #endif
-}
 #endif
 
-#ifdef HAS_WORD_256
-int32_t xmem::revStride8Write_Word256(void* start_address, void* end_address) { 
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_revStride8Write_Word256(static_cast<Word256_t*>(end_address), static_cast<Word256_t*>(start_address));
-#else
-    register Word256_t val;
-    val = my_64b_set_256b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF); 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word256_t);
-    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(end_address); i < len; i += 16) {
-        UNROLL16(*wordptr = val; wordptr -= 8;)
-        if (wordptr <= static_cast<Word256_t*>(start_address)) //end, modulo
-            wordptr += len;
+/* -------------------- CORE BENCHMARK ROUTINES -------------------------- */
+
+int32_t xmem::forwSequentialReadUnaligned_Word32(void* start_address, void* end_address) {
+    register Word32_t val;
+    for (volatile UnalignedWord32_t* wordptr = static_cast<UnalignedWord32_t*>(start_address), *endptr = static_cast<UnalignedWord32_t*>(end_address); wordptr < endptr;) {
+        UNROLL1024(val = *wordptr++;)
     }
     return 0;
-#endif
 }
-#endif
 
-#ifdef HAS_WORD_512
-#ifdef _WIN32
-int32_t xmem::revStride8Write_Word512(void* start_address, void* end_address) {
-#else
-//FIXME: We flag GCC/ICC not to optimize this function. The problem is that my_512b_load() -- which maps to _mm512_load_epi64 Intel AVX-512/KNC intrinsic -- cannot accept volatile* arguments. The only way to prevent the entire benchmark loop from being optimized away is to force the compiler not to optimize the function at all. Unfortunately, this will cause extra unwanted code to be included. The only solution seems to be to write inline assembly or allow eventual support for assignment of __m512i variables, e.g., val = *wordptr++; which is how the code for the other word sizes is written.
-int32_t __attribute__((optimize("O0"))) xmem::revStride8Write_Word512(void* start_address, void* end_address) { 
-#endif
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    //return win_x86_64_asm_revStride8Write_Word512(static_cast<Word512_t*>(end_address), static_cast<Word512_t*>(start_address));
-    #error 512-bit words are not supported on Windows.
-#else
-    register Word512_t val;
-    uint64_t scratchptr[8] __attribute__ ((aligned(512)));
-    my_64b_set_512b_word(val, scratchptr, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF); 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word512_t);
-    for (Word512_t* wordptr = static_cast<Word512_t*>(end_address); i < len; i += 8) {
-        UNROLL8(*wordptr = val; wordptr -= 8;)
-        if (wordptr <= static_cast<Word512_t*>(start_address)) //end, modulo
-            wordptr += len;
+int32_t xmem::forwSequentialWriteUnaligned_Word32(void* start_address, void* end_address) {
+    register Word32_t val = 0xFFFFFFFF;
+    for (volatile UnalignedWord32_t* wordptr = static_cast<UnalignedWord32_t*>(start_address), *endptr = static_cast<UnalignedWord32_t*>(end_address); wordptr < endptr;) {
+        UNROLL1024(*wordptr++ = val;)
     }
     return 0;
-#endif
 }
-#endif
-
-/* ------------ STRIDE 16 READ --------------*/
 
-int32_t xmem::forwStride16Read_Word32(void* start_address, void* end_address) {
-    register Word32_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word32_t);
-    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(start_address); i < len; i += 64) {
-        UNROLL64(val = *wordptr; wordptr += 16;) 
-        if (wordptr >= static_cast<Word32_t*>(end_address)) //end, modulo
-            wordptr -= len;
+#ifdef HAS_WORD_64
+int32_t xmem::forwSequentialReadUnaligned_Word64(void* start_address, void* end_address) {
+    register Word64_t val;
+    for (volatile UnalignedWord64_t* wordptr = static_cast<UnalignedWord64_t*>(start_address), *endptr = static_cast<UnalignedWord64_t*>(end_address); wordptr < endptr;) {
+        UNROLL512(val = *wordptr++;)
     }
     return 0;
 }
 
-#ifdef HAS_WORD_64
-int32_t xmem::forwStride16Read_Word64(void* start_address, void* end_address) { 
-    register Word64_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word64_t);
-    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(start_address); i < len; i += 32) {
-        UNROLL32(val = *wordptr; wordptr += 16;) 
-        if (wordptr >= static_cast<Word64_t*>(end_address)) //end, modulo
-            wordptr -= len;
+int32_t xmem::forwSequentialWriteUnaligned_Word64(void* start_address, void* end_address) {
+    register Word64_t val = 0xFFFFFFFFFFFFFFFF;
+    for (volatile UnalignedWord64_t* wordptr = static_cast<UnalignedWord64_t*>(start_address), *endptr = static_cast<UnalignedWord64_t*>(end_address); wordptr < endptr;) {
+        UNROLL512(*wordptr++ = val;)
     }
     return 0;
 }
+
+int32_t xmem::randomReadUnaligned_Word64(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len) {
+    volatile UnalignedWord64_t* p = reinterpret_cast<UnalignedWord64_t*>(first_address);
+
+    UNROLL512(p = reinterpret_cast<UnalignedWord64_t*>(*p);)
+    *last_touched_address = reinterpret_cast<uintptr_t*>(const_cast<UnalignedWord64_t*>(p));
+    return 0;
+}
 #endif
 
 #ifdef HAS_WORD_128
-int32_t xmem::forwStride16Read_Word128(void* start_address, void* end_address) { 
+int32_t xmem::forwSequentialReadUnaligned_Word128(void* start_address, void* end_address) {
 #if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_forwStride16Read_Word128(static_cast<Word128_t*>(start_address), static_cast<Word128_t*>(end_address));
+    Word128_t val = _mm_setzero_si128(); //The loads are folded into the returned value so that the compiler keeps them without volatile vector accesses
+    for (Word128_t* wordptr = static_cast<Word128_t*>(start_address), *endptr = static_cast<Word128_t*>(end_address); wordptr < endptr;) {
+        UNROLL256(val = _mm_xor_si128(val, _mm_loadu_si128(wordptr++));)
+    }
+    return _mm_movemask_epi8(val);
 #else
-    register Word128_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word128_t);
-    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(start_address); i < len; i += 16) {
-        UNROLL16(val = *wordptr; wordptr += 16;) 
-        if (wordptr >= static_cast<Word128_t*>(end_address)) //end, modulo
-            wordptr -= len;
+    register Word128_t val;
+    for (volatile UnalignedWord128_t* wordptr = static_cast<UnalignedWord128_t*>(start_address), *endptr = static_cast<UnalignedWord128_t*>(end_address); wordptr < endptr;) {
+        UNROLL256(val = *wordptr++;)
     }
     return 0;
 #endif
 }
-#endif
 
-#ifdef HAS_WORD_256
-int32_t xmem::forwStride16Read_Word256(void* start_address, void* end_address) { 
+int32_t xmem::forwSequentialWriteUnaligned_Word128(void* start_address, void* end_address) {
 #if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_forwStride16Read_Word256(static_cast<Word256_t*>(start_address), static_cast<Word256_t*>(end_address));
-#else
-    register Word256_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word256_t);
-    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(start_address); i < len; i += 8) {
-        UNROLL8(val = *wordptr; wordptr += 16;) 
-        if (wordptr >= static_cast<Word256_t*>(end_address)) //end, modulo
-            wordptr -= len;
+    Word128_t val = my_64b_set_128b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF);
+    for (Word128_t* wordptr = static_cast<Word128_t*>(start_address), *endptr = static_cast<Word128_t*>(end_address); wordptr < endptr;) {
+        UNROLL256(_mm_storeu_si128(wordptr++, val);)
     }
     return 0;
-#endif
-}
-#endif
-
-#ifdef HAS_WORD_512
-#ifdef _WIN32
-int32_t xmem::forwStride16Read_Word512(void* start_address, void* end_address) {
-#else
-//FIXME: We flag GCC/ICC not to optimize this function. The problem is that my_512b_load() -- which maps to _mm512_load_epi64 Intel AVX-512/KNC intrinsic -- cannot accept volatile* arguments. The only way to prevent the entire benchmark loop from being optimized away is to force the compiler not to optimize the function at all. Unfortunately, this will cause extra unwanted code to be included. The only solution seems to be to write inline assembly or allow eventual support for assignment of __m512i variables, e.g., val = *wordptr++; which is how the code for the other word sizes is written.
-int32_t __attribute__((optimize("O0"))) xmem::forwStride16Read_Word512(void* start_address, void* end_address) { 
-#endif
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    //return win_x86_64_asm_forwStride16Read_Word512(static_cast<Word512_t*>(start_address), static_cast<Word512_t*>(end_address));
-    #error 512-bit words are not supported on Windows.
 #else
-    register Word512_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word512_t);
-    //for (volatile Word512_t* wordptr = static_cast<Word512_t*>(start_address); i < len; i += 4) {
-    for (Word512_t* wordptr = static_cast<Word512_t*>(start_address); i < len; i += 4) {
-        //UNROLL4(val = *wordptr; wordptr += 16;) 
-        UNROLL4(val = my_512b_load(wordptr); wordptr += 16;) 
-        if (wordptr >= static_cast<Word512_t*>(end_address)) //end, modulo
-            wordptr -= len;
+    register Word128_t val;
+    val = my_64b_set_128b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF);
+    for (volatile UnalignedWord128_t* wordptr = static_cast<UnalignedWord128_t*>(start_address), *endptr = static_cast<UnalignedWord128_t*>(end_address); wordptr < endptr;) {
+        UNROLL256(*wordptr++ = val;)
     }
     return 0;
 #endif
 }
-#endif
 
-int32_t xmem::revStride16Read_Word32(void* start_address, void* end_address) {
-    register Word32_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word32_t);
-    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(end_address); i < len; i += 64) {
-        UNROLL64(val = *wordptr; wordptr -= 16;) 
-        if (wordptr <= static_cast<Word32_t*>(start_address)) //end, modulo
-            wordptr += len;
-    }
+int32_t xmem::randomReadUnaligned_Word128(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len) {
+#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
+    Word128_t* p = reinterpret_cast<Word128_t*>(first_address);
+    Word128_t val;
+
+    UNROLL512(val = _mm_loadu_si128(p); p = reinterpret_cast<Word128_t*>(my_64b_extractLSB_128b(val));) //Do 128-bit unaligned load. Then extract 64 LSB to use as next load address.
+    *last_touched_address = reinterpret_cast<uintptr_t*>(p);
     return 0;
-}
+#else
+    volatile UnalignedWord128_t* p = reinterpret_cast<UnalignedWord128_t*>(first_address);
+    register Word128_t val;
 
-#ifdef HAS_WORD_64
-int32_t xmem::revStride16Read_Word64(void* start_address, void* end_address) { 
-    register Word64_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word64_t);
-    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(end_address); i < len; i += 32) {
-        UNROLL32(val = *wordptr; wordptr -= 16;)
-        if (wordptr <= static_cast<Word64_t*>(start_address)) //end, modulo
-            wordptr += len;
-    }
+    UNROLL512(val = *p; p = reinterpret_cast<UnalignedWord128_t*>(my_64b_extractLSB_128b(val));) //Do 128-bit unaligned load. Then extract 64 LSB to use as next load address.
+    *last_touched_address = reinterpret_cast<uintptr_t*>(const_cast<UnalignedWord128_t*>(p));
     return 0;
+#endif
 }
 #endif
 
-#ifdef HAS_WORD_128
-int32_t xmem::revStride16Read_Word128(void* start_address, void* end_address) { 
+#ifdef HAS_WORD_256
+int32_t xmem::forwSequentialReadUnaligned_Word256(void* start_address, void* end_address) {
 #if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_revStride16Read_Word128(static_cast<Word128_t*>(end_address), static_cast<Word128_t*>(start_address));
+    __m256d val = _mm256_setzero_pd(); //The loads are folded into the returned value so that the compiler keeps them without volatile vector accesses
+    for (Word256_t* wordptr = static_cast<Word256_t*>(start_address), *endptr = static_cast<Word256_t*>(end_address); wordptr < endptr;) {
+        UNROLL128(val = _mm256_xor_pd(val, _mm256_loadu_pd(reinterpret_cast<const double*>(wordptr++)));)
+    }
+    return _mm256_movemask_pd(val);
 #else
-    register Word128_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word128_t);
-    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(end_address); i < len; i += 16) {
-        UNROLL16(val = *wordptr; wordptr -= 16;)
-        if (wordptr <= static_cast<Word128_t*>(start_address)) //end, modulo
-            wordptr += len;
+    register Word256_t val;
+    for (volatile UnalignedWord256_t* wordptr = static_cast<UnalignedWord256_t*>(start_address), *endptr = static_cast<UnalignedWord256_t*>(end_address); wordptr < endptr;) {
+        UNROLL128(val = *wordptr++;)
     }
     return 0;
 #endif
 }
-#endif
 
-#ifdef HAS_WORD_256
-int32_t xmem::revStride16Read_Word256(void* start_address, void* end_address) { 
+int32_t xmem::forwSequentialWriteUnaligned_Word256(void* start_address, void* end_address) {
 #if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_revStride16Read_Word256(static_cast<Word256_t*>(end_address), static_cast<Word256_t*>(start_address));
+    Word256_t val = my_64b_set_256b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF);
+    for (Word256_t* wordptr = static_cast<Word256_t*>(start_address), *endptr = static_cast<Word256_t*>(end_address); wordptr < endptr;) {
+        UNROLL128(_mm256_storeu_si256(wordptr++, val);)
+    }
+    return 0;
 #else
-    register Word256_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word256_t);
-    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(end_address); i < len; i += 8) {
-        UNROLL8(val = *wordptr; wordptr -= 16;)
-        if (wordptr <= static_cast<Word256_t*>(start_address)) //end, modulo
-            wordptr += len;
+    register Word256_t val;
+    val = my_64b_set_256b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF);
+    for (volatile UnalignedWord256_t* wordptr = static_cast<UnalignedWord256_t*>(start_address), *endptr = static_cast<UnalignedWord256_t*>(end_address); wordptr < endptr;) {
+        UNROLL128(*wordptr++ = val;)
     }
     return 0;
 #endif
 }
-#endif
 
-#ifdef HAS_WORD_512
-#ifdef _WIN32
-int32_t xmem::revStride16Read_Word512(void* start_address, void* end_address) {
-#else
-//FIXME: We flag GCC/ICC not to optimize this function. The problem is that my_512b_load() -- which maps to _mm512_load_epi64 Intel AVX-512/KNC intrinsic -- cannot accept volatile* arguments. The only way to prevent the entire benchmark loop from being optimized away is to force the compiler not to optimize the function at all. Unfortunately, this will cause extra unwanted code to be included. The only solution seems to be to write inline assembly or allow eventual support for assignment of __m512i variables, e.g., val = *wordptr++; which is how the code for the other word sizes is written.
-int32_t __attribute__((optimize("O0"))) xmem::revStride16Read_Word512(void* start_address, void* end_address) { 
-#endif
+int32_t xmem::randomReadUnaligned_Word256(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len) {
 #if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    //return win_x86_64_asm_revStride16Read_Word512(static_cast<Word512_t*>(end_address), static_cast<Word512_t*>(start_address));
-    #error 512-bit words are not supported on Windows.
+    Word256_t* p = reinterpret_cast<Word256_t*>(first_address);
+    Word256_t val;
+
+    UNROLL512(val = _mm256_loadu_si256(p); p = reinterpret_cast<Word256_t*>(my_64b_extractLSB_256b(val));) //Do 256-bit unaligned load. Then extract 64 LSB to use as next load address.
+    *last_touched_address = reinterpret_cast<uintptr_t*>(p);
+    return 0;
 #else
-    register Word512_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word512_t);
-    //for (volatile Word512_t* wordptr = static_cast<Word512_t*>(end_address); i < len; i += 4) {
-    for (Word512_t* wordptr = static_cast<Word512_t*>(end_address); i < len; i += 4) {
-        //UNROLL4(val = *wordptr; wordptr -= 16;)
-        UNROLL4(val = my_512b_load(wordptr); wordptr -= 16;)
-        if (wordptr <= static_cast<Word512_t*>(start_address)) //end, modulo
-            wordptr += len;
-    }
+    volatile UnalignedWord256_t* p = reinterpret_cast<UnalignedWord256_t*>(first_address);
+    register Word256_t val;
+
+    UNROLL512(val = *p; p = reinterpret_cast<UnalignedWord256_t*>(my_64b_extractLSB_256b(val));) //Do 256-bit unaligned load. Then extract 64 LSB to use as next load address.
+    *last_touched_address = reinterpret_cast<uintptr_t*>(const_cast<UnalignedWord256_t*>(p));
     return 0;
 #endif
 }
 #endif
+#endif
 
-/* ------------ STRIDE 16 WRITE --------------*/
+/***********************************************************************
+ ***********************************************************************
+ ******************** DATA PATTERN BENCHMARK KERNELS *******************
+ ***********************************************************************
+ ***********************************************************************/
 
-int32_t xmem::forwStride16Write_Word32(void* start_address, void* end_address) {
-    register Word32_t val = 0xFFFFFFFF; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word32_t);
-    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(start_address); i < len; i += 64) {
-        UNROLL64(*wordptr = val; wordptr += 16;)
-        if (wordptr >= static_cast<Word32_t*>(end_address)) //end, modulo
-            wordptr -= len;
+/* --------------------- DUMMY BENCHMARK ROUTINES --------------------------- */
+
+int32_t xmem::dummy_forwSequentialPatternLoop_Word32(void* pattern_block, void* start_address, void* end_address) {
+    volatile int32_t placeholder = 0; //Try our best to defeat compiler optimizations
+    Word32_t* block = static_cast<Word32_t*>(pattern_block);
+    Word32_t* block_end = block + DATA_PATTERN_BLOCK_SIZE / sizeof(Word32_t);
+    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(start_address), *endptr = static_cast<Word32_t*>(end_address); wordptr < endptr;) {
+        for (volatile Word32_t* srcptr = block; srcptr < block_end;) {
+            UNROLL256(wordptr++; srcptr++;)
+        }
+        placeholder = 0;
     }
-    return 0;
+    return placeholder;
 }
 
 #ifdef HAS_WORD_64
-int32_t xmem::forwStride16Write_Word64(void* start_address, void* end_address) {
-    register Word64_t val = 0xFFFFFFFFFFFFFFFF; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word64_t);
-    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(start_address); i < len; i += 32) {
-        UNROLL32(*wordptr = val; wordptr += 16;)
-        if (wordptr >= static_cast<Word64_t*>(end_address)) //end, modulo
-            wordptr -= len;
+int32_t xmem::dummy_forwSequentialPatternLoop_Word64(void* pattern_block, void* start_address, void* end_address) {
+    volatile int32_t placeholder = 0; //Try our best to defeat compiler optimizations
+    Word64_t* block = static_cast<Word64_t*>(pattern_block);
+    Word64_t* block_end = block + DATA_PATTERN_BLOCK_SIZE / sizeof(Word64_t);
+    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(start_address), *endptr = static_cast<Word64_t*>(end_address); wordptr < endptr;) {
+        for (volatile Word64_t* srcptr = block; srcptr < block_end;) {
+            UNROLL256(wordptr++; srcptr++;)
+        }
+        placeholder = 0;
     }
-    return 0;
+    return placeholder;
 }
 #endif
 
 #ifdef HAS_WORD_128
-int32_t xmem::forwStride16Write_Word128(void* start_address, void* end_address) { 
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_forwStride16Write_Word128(static_cast<Word128_t*>(start_address), static_cast<Word128_t*>(end_address));
-#else
-    register Word128_t val;
-    val = my_64b_set_128b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF); 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word128_t);
-    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(start_address); i < len; i += 16) {
-        UNROLL16(*wordptr = val; wordptr += 16;)
-        if (wordptr >= static_cast<Word128_t*>(end_address)) //end, modulo
-            wordptr -= len;
+int32_t xmem::dummy_forwSequentialPatternLoop_Word128(void* pattern_block, void* start_address, void* end_address) {
+    volatile int32_t placeholder = 0; //Try our best to defeat compiler optimizations
+    Word128_t* block = static_cast<Word128_t*>(pattern_block);
+    Word128_t* block_end = block + DATA_PATTERN_BLOCK_SIZE / sizeof(Word128_t);
+    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(start_address), *endptr = static_cast<Word128_t*>(end_address); wordptr < endptr;) {
+        for (volatile Word128_t* srcptr = block; srcptr < block_end;) {
+            UNROLL128(wordptr++; srcptr++;)
+        }
+        placeholder = 0;
     }
-    return 0;
-#endif
+    return placeholder;
 }
 #endif
 
 #ifdef HAS_WORD_256
-int32_t xmem::forwStride16Write_Word256(void* start_address, void* end_address) { 
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_forwStride16Write_Word256(static_cast<Word256_t*>(start_address), static_cast<Word256_t*>(end_address));
-#else
-    register Word256_t val;
-    val = my_64b_set_256b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF); 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word256_t);
-    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(start_address); i < len; i += 8) {
-        UNROLL8(*wordptr = val; wordptr += 16;)
-        if (wordptr >= static_cast<Word256_t*>(end_address)) //end, modulo
-            wordptr -= len;
+int32_t xmem::dummy_forwSequentialPatternLoop_Word256(void* pattern_block, void* start_address, void* end_address) {
+    volatile int32_t placeholder = 0; //Try our best to defeat compiler optimizations
+    Word256_t* block = static_cast<Word256_t*>(pattern_block);
+    Word256_t* block_end = block + DATA_PATTERN_BLOCK_SIZE / sizeof(Word256_t);
+    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(start_address), *endptr = static_cast<Word256_t*>(end_address); wordptr < endptr;) {
+        for (volatile Word256_t* srcptr = block; srcptr < block_end;) {
+            UNROLL64(wordptr++; srcptr++;)
+        }
+        placeholder = 0;
     }
-    return 0;
-#endif
+    return placeholder;
 }
 #endif
 
 #ifdef HAS_WORD_512
-#ifdef _WIN32
-int32_t xmem::forwStride16Write_Word512(void* start_address, void* end_address) {
-#else
-//FIXME: We flag GCC/ICC not to optimize this function. The problem is that my_512b_load() -- which maps to _mm512_load_epi64 Intel AVX-512/KNC intrinsic -- cannot accept volatile* arguments. The only way to prevent the entire benchmark loop from being optimized away is to force the compiler not to optimize the function at all. Unfortunately, this will cause extra unwanted code to be included. The only solution seems to be to write inline assembly or allow eventual support for assignment of __m512i variables, e.g., val = *wordptr++; which is how the code for the other word sizes is written.
-int32_t __attribute__((optimize("O0"))) xmem::forwStride16Write_Word512(void* start_address, void* end_address) { 
-#endif
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    //return win_x86_64_asm_forwStride16Write_Word512(static_cast<Word512_t*>(start_address), static_cast<Word512_t*>(end_address));
-    #error 512-bit words are not supported on Windows.
-#else
-    register Word512_t val;
-    uint64_t scratchptr[8] __attribute__ ((aligned(512)));
-    my_64b_set_512b_word(val, scratchptr, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF); 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word512_t);
-    for (Word512_t* wordptr = static_cast<Word512_t*>(start_address); i < len; i += 4) {
-        UNROLL4(*wordptr = val; wordptr += 16;)
-        if (wordptr >= static_cast<Word512_t*>(end_address)) //end, modulo
-            wordptr -= len;
+int32_t xmem::dummy_forwSequentialPatternLoop_Word512(void* pattern_block, void* start_address, void* end_address) {
+    volatile int32_t placeholder = 0; //Try our best to defeat compiler optimizations
+    Word512_t* block = static_cast<Word512_t*>(pattern_block);
+    Word512_t* block_end = block + DATA_PATTERN_BLOCK_SIZE / sizeof(Word512_t);
+    for (volatile Word512_t* wordptr = static_cast<Word512_t*>(start_address), *endptr = static_cast<Word512_t*>(end_address); wordptr < endptr;) {
+        for (volatile Word512_t* srcptr = block; srcptr < block_end;) {
+            UNROLL32(wordptr++; srcptr++;)
+        }
+        placeholder = 0;
     }
-    return 0;
-#endif
+    return placeholder;
 }
 #endif
 
-int32_t xmem::revStride16Write_Word32(void* start_address, void* end_address) { 
-    register Word32_t val = 0xFFFFFFFF; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word32_t);
-    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(end_address); i < len; i += 64) {
-        UNROLL64(*wordptr = val; wordptr -= 16;)
-        if (wordptr <= static_cast<Word32_t*>(start_address)) //end, modulo
-            wordptr += len;
-    }
+/* -------------------- CORE BENCHMARK ROUTINES -------------------------- */
 
+int32_t xmem::forwSequentialPatternWrite_Word32(void* pattern_block, void* start_address, void* end_address) {
+    Word32_t* block = static_cast<Word32_t*>(pattern_block);
+    Word32_t* block_end = block + DATA_PATTERN_BLOCK_SIZE / sizeof(Word32_t);
+    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(start_address), *endptr = static_cast<Word32_t*>(end_address); wordptr < endptr;) {
+        for (Word32_t* srcptr = block; srcptr < block_end;) {
+            UNROLL256(*wordptr++ = *srcptr++;) //The block stays in the L1 cache, so only the stores go to memory
+        }
+    }
     return 0;
 }
 
 #ifdef HAS_WORD_64
-int32_t xmem::revStride16Write_Word64(void* start_address, void* end_address) { 
-    register Word64_t val = 0xFFFFFFFFFFFFFFFF; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word64_t);
-    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(end_address); i < len; i += 32) {
-        UNROLL32(*wordptr = val; wordptr -= 16;)
-        if (wordptr <= static_cast<Word64_t*>(start_address)) //end, modulo
-            wordptr += len;
+int32_t xmem::forwSequentialPatternWrite_Word64(void* pattern_block, void* start_address, void* end_address) {
+    Word64_t* block = static_cast<Word64_t*>(pattern_block);
+    Word64_t* block_end = block + DATA_PATTERN_BLOCK_SIZE / sizeof(Word64_t);
+    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(start_address), *endptr = static_cast<Word64_t*>(end_address); wordptr < endptr;) {
+        for (Word64_t* srcptr = block; srcptr < block_end;) {
+            UNROLL256(*wordptr++ = *srcptr++;) //The block stays in the L1 cache, so only the stores go to memory
+        }
     }
-
     return 0;
 }
 #endif
 
 #ifdef HAS_WORD_128
-int32_t xmem::revStride16Write_Word128(void* start_address, void* end_address) { 
+int32_t xmem::forwSequentialPatternWrite_Word128(void* pattern_block, void* start_address, void* end_address) {
 #if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_revStride16Write_Word128(static_cast<Word128_t*>(end_address), static_cast<Word128_t*>(start_address));
-#else
-    register Word128_t val;
-    val = my_64b_set_128b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF); 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word128_t);
-    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(end_address); i < len; i += 16) {
-        UNROLL16(*wordptr = val; wordptr -= 16;)
-        if (wordptr <= static_cast<Word128_t*>(start_address)) //end, modulo
-            wordptr += len;
+    __m128i* block = static_cast<__m128i*>(pattern_block);
+    __m128i* block_end = block + DATA_PATTERN_BLOCK_SIZE / sizeof(__m128i);
+    for (__m128i* wordptr = static_cast<__m128i*>(start_address), *endptr = static_cast<__m128i*>(end_address); wordptr < endptr;) {
+        for (__m128i* srcptr = block; srcptr < block_end;) {
+            UNROLL128(_mm_store_si128(wordptr++, _mm_load_si128(srcptr++));) //The block stays in the L1 cache, so only the stores go to memory
+        }
+    }
+    return 0;
+#else
+    Word128_t* block = static_cast<Word128_t*>(pattern_block);
+    Word128_t* block_end = block + DATA_PATTERN_BLOCK_SIZE / sizeof(Word128_t);
+    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(start_address), *endptr = static_cast<Word128_t*>(end_address); wordptr < endptr;) {
+        for (Word128_t* srcptr = block; srcptr < block_end;) {
+            UNROLL128(*wordptr++ = *srcptr++;) //The block stays in the L1 cache, so only the stores go to memory
+        }
     }
-
     return 0;
 #endif
 }
 #endif
 
 #ifdef HAS_WORD_256
-int32_t xmem::revStride16Write_Word256(void* start_address, void* end_address) { 
+int32_t xmem::forwSequentialPatternWrite_Word256(void* pattern_block, void* start_address, void* end_address) {
 #if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_revStride16Write_Word256(static_cast<Word256_t*>(end_address), static_cast<Word256_t*>(start_address));
+    __m256i* block = static_cast<__m256i*>(pattern_block);
+    __m256i* block_end = block + DATA_PATTERN_BLOCK_SIZE / sizeof(__m256i);
+    for (__m256i* wordptr = static_cast<__m256i*>(start_address), *endptr = static_cast<__m256i*>(end_address); wordptr < endptr;) {
+        for (__m256i* srcptr = block; srcptr < block_end;) {
+            UNROLL64(_mm256_store_si256(wordptr++, _mm256_load_si256(srcptr++));) //The block stays in the L1 cache, so only the stores go to memory
+        }
+    }
+    return 0;
 #else
-    register Word256_t val;
-    val = my_64b_set_256b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF); 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word256_t);
-    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(end_address); i < len; i += 8) {
-        UNROLL8(*wordptr = val; wordptr -= 16;)
-        if (wordptr <= static_cast<Word256_t*>(start_address)) //end, modulo
-            wordptr += len;
+    Word256_t* block = static_cast<Word256_t*>(pattern_block);
+    Word256_t* block_end = block + DATA_PATTERN_BLOCK_SIZE / sizeof(Word256_t);
+    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(start_address), *endptr = static_cast<Word256_t*>(end_address); wordptr < endptr;) {
+        for (Word256_t* srcptr = block; srcptr < block_end;) {
+            UNROLL64(*wordptr++ = *srcptr++;) //The block stays in the L1 cache, so only the stores go to memory
+        }
     }
-
     return 0;
 #endif
 }
 #endif
 
 #ifdef HAS_WORD_512
-#ifdef _WIN32
-int32_t xmem::revStride16Write_Word512(void* start_address, void* end_address) {
-#else
-//FIXME: We flag GCC/ICC not to optimize this function. The problem is that my_512b_load() -- which maps to _mm512_load_epi64 Intel AVX-512/KNC intrinsic -- cannot accept volatile* arguments. The only way to prevent the entire benchmark loop from being optimized away is to force the compiler not to optimize the function at all. Unfortunately, this will cause extra unwanted code to be included. The only solution seems to be to write inline assembly or allow eventual support for assignment of __m512i variables, e.g., val = *wordptr++; which is how the code for the other word sizes is written.
-int32_t __attribute__((optimize("O0"))) xmem::revStride16Write_Word512(void* start_address, void* end_address) { 
-#endif
+int32_t xmem::forwSequentialPatternWrite_Word512(void* pattern_block, void* start_address, void* end_address) {
 #if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    //return win_x86_64_asm_revStride16Write_Word512(static_cast<Word512_t*>(end_address), static_cast<Word512_t*>(start_address));
-    #error 512-bit words are not supported on Windows.
+    #error 512-bit words are not currently supported on Windows.
 #else
-    register Word512_t val;
-    uint64_t scratchptr[8] __attribute__ ((aligned(512)));
-    my_64b_set_512b_word(val, scratchptr, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF); 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word512_t);
-    for (Word512_t* wordptr = static_cast<Word512_t*>(end_address); i < len; i += 4) {
-        UNROLL4(*wordptr = val; wordptr -= 16;)
-        if (wordptr <= static_cast<Word512_t*>(start_address)) //end, modulo
-            wordptr += len;
+    Word512_t* block = static_cast<Word512_t*>(pattern_block);
+    Word512_t* block_end = block + DATA_PATTERN_BLOCK_SIZE / sizeof(Word512_t);
+    for (volatile Word512_t* wordptr = static_cast<Word512_t*>(start_address), *endptr = static_cast<Word512_t*>(end_address); wordptr < endptr;) {
+        for (Word512_t* srcptr = block; srcptr < block_end;) {
+            UNROLL32(*wordptr++ = *srcptr++;) //The block stays in the L1 cache, so only the stores go to memory
+        }
     }
-
     return 0;
 #endif
 }
 #endif
 
-/* ------------ RANDOM READ --------------*/
+/***********************************************************************
+ ***********************************************************************
+ ********************* 2D TILED BENCHMARK KERNELS **********************
+ ***********************************************************************
+ ***********************************************************************/
 
-#ifndef HAS_WORD_64 //special case: 32-bit machine
-int32_t xmem::randomRead_Word32(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len) {
-    volatile uintptr_t* p = first_address;
+#ifdef HAS_WORD_64
+/**
+ * @brief Gathers the even bits of a Morton code into the low half of the result, which gives the x coordinate. Shift the code right by one first to get the y coordinate.
+ * @param code The Morton code.
+ * @returns The coordinate.
+ */
+static inline size_t compact_even_bits(uint64_t code) {
+    code &= 0x5555555555555555;
+    code = (code | (code >> 1)) & 0x3333333333333333;
+    code = (code | (code >> 2)) & 0x0F0F0F0F0F0F0F0F;
+    code = (code | (code >> 4)) & 0x00FF00FF00FF00FF;
+    code = (code | (code >> 8)) & 0x0000FFFF0000FFFF;
+    code = (code | (code >> 16)) & 0x00000000FFFFFFFF;
+    return static_cast<size_t>(code);
+}
 
-    UNROLL1024(p = reinterpret_cast<uintptr_t*>(*p);)
-    *last_touched_address = const_cast<uintptr_t*>(p);
-    return 0;
+/**
+ * @brief Gets the side of the squares of tiles that the Morton-order kernels walk a 2D array in. Each square is the largest power of two that fits along the shorter side of the array, so the codes walked stay within four times the number of tiles, however elongated the array is.
+ * @param geometry Shape of the array and its tiles.
+ * @returns The number of tiles along each side of a square.
+ */
+static size_t morton_side(const tile_geometry_t* geometry) {
+    size_t tiles_x = (geometry->width + geometry->tile_width - 1) / geometry->tile_width;
+    size_t tiles_y = (geometry->height + geometry->tile_height - 1) / geometry->tile_height;
+    size_t side = 1;
+    while (side * 2 <= tiles_x && side * 2 <= tiles_y)
+        side *= 2;
+    return side;
 }
-#endif
 
-#ifdef HAS_WORD_64
-int32_t xmem::randomRead_Word64(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len) {
-    volatile uintptr_t* p = first_address;
+/* --------------------- DUMMY BENCHMARK ROUTINES --------------------------- */
 
-    UNROLL512(p = reinterpret_cast<uintptr_t*>(*p);)
-    *last_touched_address = const_cast<uintptr_t*>(p);
-    return 0;
+int32_t xmem::dummy_rowMajor2DLoop_Word64(void* src, void* dst, const tile_geometry_t* geometry) {
+    volatile int32_t placeholder = 0; //Try our best to defeat compiler optimizations
+    Word64_t* base = static_cast<Word64_t*>(src);
+    size_t width = geometry->width;
+    size_t height = geometry->height;
+    size_t pitch = geometry->pitch;
+    for (size_t y = 0; y < height; y++) {
+        volatile Word64_t* wordptr = base + y * pitch;
+        volatile Word64_t* endptr = wordptr + width;
+        while (wordptr + 8 <= endptr) {
+            UNROLL8(wordptr++;)
+        }
+        while (wordptr < endptr) {
+            wordptr++;
+        }
+        placeholder = 0;
+    }
+    return placeholder;
 }
-#endif
 
-#ifdef HAS_WORD_128
-int32_t xmem::randomRead_Word128(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len) {
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return 0; //TODO: Implement for Windows.
-#else
-    volatile Word128_t* p = reinterpret_cast<Word128_t*>(first_address);
-    register Word128_t val;
+int32_t xmem::dummy_columnMajor2DLoop_Word64(void* src, void* dst, const tile_geometry_t* geometry) {
+    volatile int32_t placeholder = 0; //Try our best to defeat compiler optimizations
+    Word64_t* base = static_cast<Word64_t*>(src);
+    size_t width = geometry->width;
+    size_t height = geometry->height;
+    size_t pitch = geometry->pitch;
+    for (size_t x = 0; x < width; x++) {
+        volatile Word64_t* wordptr = base + x;
+        volatile Word64_t* endptr = wordptr + height * pitch;
+        while (wordptr + 8 * pitch <= endptr) {
+            UNROLL8(wordptr += pitch;)
+        }
+        while (wordptr < endptr) {
+            wordptr += pitch;
+        }
+        placeholder = 0;
+    }
+    return placeholder;
+}
 
-#ifdef HAS_WORD_64
-    UNROLL256(val = *p; p = reinterpret_cast<Word128_t*>(my_64b_extractLSB_128b(val));) //Do 128-bit load. Then extract 64 LSB to use as next load address.
-#else //special case: 32-bit machine
-    UNROLL256(val = *p; p = reinterpret_cast<Word128_t*>(my_32b_extractLSB_128b(val));) //Do 128-bit load. Then extract 32 LSB to use as next load address.
-#endif
+int32_t xmem::dummy_blocked2DLoop_Word64(void* src, void* dst, const tile_geometry_t* geometry) {
+    volatile int32_t placeholder = 0; //Try our best to defeat compiler optimizations
+    Word64_t* base = static_cast<Word64_t*>(src);
+    size_t width = geometry->width;
+    size_t height = geometry->height;
+    size_t pitch = geometry->pitch;
+    size_t tile_width = geometry->tile_width;
+    size_t tile_height = geometry->tile_height;
+    for (size_t y0 = 0; y0 < height; y0 += tile_height) {
+        for (size_t x0 = 0; x0 < width; x0 += tile_width) {
+            size_t y_end = std::min(y0 + tile_height, height);
+            size_t x_end = std::min(x0 + tile_width, width);
+            for (size_t y = y0; y < y_end; y++) {
+                volatile Word64_t* wordptr = base + y * pitch + x0;
+                volatile Word64_t* endptr = base + y * pitch + x_end;
+                while (wordptr + 8 <= endptr) {
+                    UNROLL8(wordptr++;)
+                }
+                while (wordptr < endptr) {
+                    wordptr++;
+                }
+            }
+        }
+        placeholder = 0;
+    }
+    return placeholder;
+}
 
-    *last_touched_address = reinterpret_cast<uintptr_t*>(const_cast<Word128_t*>(p)); //Trick compiler. First get rid of volatile qualifier, and then reinterpret pointer
-    return 0;
-#endif
+int32_t xmem::dummy_morton2DLoop_Word64(void* src, void* dst, const tile_geometry_t* geometry) {
+    volatile int32_t placeholder = 0; //Try our best to defeat compiler optimizations
+    Word64_t* base = static_cast<Word64_t*>(src);
+    size_t width = geometry->width;
+    size_t height = geometry->height;
+    size_t pitch = geometry->pitch;
+    size_t tile_width = geometry->tile_width;
+    size_t tile_height = geometry->tile_height;
+    size_t side = morton_side(geometry);
+    for (size_t square_y0 = 0; square_y0 < height; square_y0 += side * tile_height) { //Squares of tiles in row-major order, tiles in Z order within each square
+        for (size_t square_x0 = 0; square_x0 < width; square_x0 += side * tile_width) {
+            for (uint64_t code = 0; code < side * side; code++) {
+                size_t x0 = square_x0 + compact_even_bits(code) * tile_width;
+                size_t y0 = square_y0 + compact_even_bits(code >> 1) * tile_height;
+                if (x0 < width && y0 < height) { //The squares along the right and bottom edges may stick out of the array, so skip the codes outside of it
+                    size_t y_end = std::min(y0 + tile_height, height);
+                    size_t x_end = std::min(x0 + tile_width, width);
+                    for (size_t y = y0; y < y_end; y++) {
+                        volatile Word64_t* wordptr = base + y * pitch + x0;
+                        volatile Word64_t* endptr = base + y * pitch + x_end;
+                        while (wordptr + 8 <= endptr) {
+                            UNROLL8(wordptr++;)
+                        }
+                        while (wordptr < endptr) {
+                            wordptr++;
+                        }
+                    }
+                    placeholder = 0;
+                }
+            }
+        }
+    }
+    return placeholder;
 }
-#endif
 
-#ifdef HAS_WORD_256
-int32_t xmem::randomRead_Word256(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len) {
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return 0; //TODO: Implement for Windows.
-#else
-    volatile Word256_t* p = reinterpret_cast<Word256_t*>(first_address);
-    register Word256_t val;
+int32_t xmem::dummy_transpose2DLoop_Word64(void* src, void* dst, const tile_geometry_t* geometry) {
+    volatile int32_t placeholder = 0; //Try our best to defeat compiler optimizations
+    Word64_t* base = static_cast<Word64_t*>(src);
+    Word64_t* transposed = static_cast<Word64_t*>(dst);
+    size_t width = geometry->width;
+    size_t height = geometry->height;
+    size_t pitch = geometry->pitch;
+    size_t tile_width = geometry->tile_width;
+    size_t tile_height = geometry->tile_height;
+    for (size_t y0 = 0; y0 < height; y0 += tile_height) {
+        for (size_t x0 = 0; x0 < width; x0 += tile_width) {
+            size_t y_end = std::min(y0 + tile_height, height);
+            size_t x_end = std::min(x0 + tile_width, width);
+            for (size_t y = y0; y < y_end; y++) {
+                volatile Word64_t* wordptr = base + y * pitch + x0;
+                volatile Word64_t* endptr = base + y * pitch + x_end;
+                volatile Word64_t* transposed_ptr = transposed + x0 * height + y;
+                while (wordptr + 8 <= endptr) {
+                    UNROLL8(wordptr++; transposed_ptr += height;)
+                }
+                while (wordptr < endptr) {
+                    wordptr++; transposed_ptr += height;
+                }
+            }
+        }
+        placeholder = 0;
+    }
+    return placeholder;
+}
 
-#ifdef HAS_WORD_64
-    UNROLL128(val = *p; p = reinterpret_cast<Word256_t*>(my_64b_extractLSB_256b(val));) //Do 256-bit load. Then extract 64 LSB to use as next load address.
-#else //special case: 32-bit machine
-    UNROLL128(val = *p; p = reinterpret_cast<Word256_t*>(my_32b_extractLSB_256b(val));) //Do 256-bit load. Then extract 32 LSB to use as next load address.
-#endif
+/* -------------------- CORE BENCHMARK ROUTINES -------------------------- */
 
-    *last_touched_address = reinterpret_cast<uintptr_t*>(const_cast<Word256_t*>(p)); //Trick compiler. First get rid of volatile qualifier, and then reinterpret pointer
+int32_t xmem::rowMajor2DRead_Word64(void* src, void* dst, const tile_geometry_t* geometry) {
+    register Word64_t val;
+    Word64_t* base = static_cast<Word64_t*>(src);
+    size_t width = geometry->width;
+    size_t height = geometry->height;
+    size_t pitch = geometry->pitch;
+    for (size_t y = 0; y < height; y++) {
+        volatile Word64_t* wordptr = base + y * pitch;
+        volatile Word64_t* endptr = wordptr + width;
+        while (wordptr + 8 <= endptr) {
+            UNROLL8(val = *wordptr++;)
+        }
+        while (wordptr < endptr) {
+            val = *wordptr++;
+        }
+    }
     return 0;
-#endif
 }
-#endif
-
-#ifdef HAS_WORD_512
-#ifdef _WIN32
-int32_t xmem::randomRead_Word512(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len) {
-#else
-//FIXME: We flag GCC/ICC not to optimize this function. The problem is that my_512b_load() -- which maps to _mm512_load_epi64 Intel AVX-512/KNC intrinsic -- cannot accept volatile* arguments. The only way to prevent the entire benchmark loop from being optimized away is to force the compiler not to optimize the function at all. Unfortunately, this will cause extra unwanted code to be included. The only solution seems to be to write inline assembly or allow eventual support for assignment of __m512i variables, e.g., val = *wordptr++; which is how the code for the other word sizes is written.
-int32_t __attribute__((optimize("O0"))) xmem::randomRead_Word512(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len) {
-#endif
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    #error 512-bit words are not supported on Windows.
-#else
-    //volatile Word512_t* p = reinterpret_cast<Word512_t*>(first_address);
-    Word512_t* p = reinterpret_cast<Word512_t*>(first_address);
-    register Word512_t val;
 
-    //UNROLL64(val = *p; p = reinterpret_cast<Word512_t*>(my_64b_extractLSB_512b(val));) //Do 512-bit load. Then extract 64 LSB to use as next load address.
-    uint64_t scratchptr[8] __attribute__ ((aligned(512)));
-    uint64_t tmp;
-    UNROLL64(val = my_512b_load(p); my_64b_extractLSB_512b(tmp, scratchptr, val); p = reinterpret_cast<Word512_t*>(tmp);) //Do 512-bit load. Then extract 64 LSB to use as next load address.
+int32_t xmem::rowMajor2DWrite_Word64(void* src, void* dst, const tile_geometry_t* geometry) {
+    register Word64_t val = 0xFFFFFFFFFFFFFFFF;
+    Word64_t* base = static_cast<Word64_t*>(src);
+    size_t width = geometry->width;
+    size_t height = geometry->height;
+    size_t pitch = geometry->pitch;
+    for (size_t y = 0; y < height; y++) {
+        volatile Word64_t* wordptr = base + y * pitch;
+        volatile Word64_t* endptr = wordptr + width;
+        while (wordptr + 8 <= endptr) {
+            UNROLL8(*wordptr++ = val;)
+        }
+        while (wordptr < endptr) {
+            *wordptr++ = val;
+        }
+    }
+    return 0;
+}
 
-    *last_touched_address = reinterpret_cast<uintptr_t*>(const_cast<Word512_t*>(p)); //Trick compiler. First get rid of volatile qualifier, and then reinterpret pointer
+int32_t xmem::columnMajor2DRead_Word64(void* src, void* dst, const tile_geometry_t* geometry) {
+    register Word64_t val;
+    Word64_t* base = static_cast<Word64_t*>(src);
+    size_t width = geometry->width;
+    size_t height = geometry->height;
+    size_t pitch = geometry->pitch;
+    for (size_t x = 0; x < width; x++) {
+        volatile Word64_t* wordptr = base + x;
+        volatile Word64_t* endptr = wordptr + height * pitch;
+        while (wordptr + 8 * pitch <= endptr) {
+            UNROLL8(val = *wordptr; wordptr += pitch;)
+        }
+        while (wordptr < endptr) {
+            val = *wordptr; wordptr += pitch;
+        }
+    }
     return 0;
-#endif
 }
-#endif
 
-/* ------------ RANDOM WRITE --------------*/
+int32_t xmem::columnMajor2DWrite_Word64(void* src, void* dst, const tile_geometry_t* geometry) {
+    register Word64_t val = 0xFFFFFFFFFFFFFFFF;
+    Word64_t* base = static_cast<Word64_t*>(src);
+    size_t width = geometry->width;
+    size_t height = geometry->height;
+    size_t pitch = geometry->pitch;
+    for (size_t x = 0; x < width; x++) {
+        volatile Word64_t* wordptr = base + x;
+        volatile Word64_t* endptr = wordptr + height * pitch;
+        while (wordptr + 8 * pitch <= endptr) {
+            UNROLL8(*wordptr = val; wordptr += pitch;)
+        }
+        while (wordptr < endptr) {
+            *wordptr = val; wordptr += pitch;
+        }
+    }
+    return 0;
+}
 
-#ifndef HAS_WORD_64 //special case: 32-bit machine
-int32_t xmem::randomWrite_Word32(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len) {
-    volatile uintptr_t* p = first_address;
-    volatile uintptr_t* p2 = NULL;
+int32_t xmem::blocked2DRead_Word64(void* src, void* dst, const tile_geometry_t* geometry) {
+    register Word64_t val;
+    Word64_t* base = static_cast<Word64_t*>(src);
+    size_t width = geometry->width;
+    size_t height = geometry->height;
+    size_t pitch = geometry->pitch;
+    size_t tile_width = geometry->tile_width;
+    size_t tile_height = geometry->tile_height;
+    for (size_t y0 = 0; y0 < height; y0 += tile_height) {
+        for (size_t x0 = 0; x0 < width; x0 += tile_width) {
+            size_t y_end = std::min(y0 + tile_height, height);
+            size_t x_end = std::min(x0 + tile_width, width);
+            for (size_t y = y0; y < y_end; y++) {
+                volatile Word64_t* wordptr = base + y * pitch + x0;
+                volatile Word64_t* endptr = base + y * pitch + x_end;
+                while (wordptr + 8 <= endptr) {
+                    UNROLL8(val = *wordptr++;)
+                }
+                while (wordptr < endptr) {
+                    val = *wordptr++;
+                }
+            }
+        }
+    }
+    return 0;
+}
 
-    UNROLL1024(p2 = reinterpret_cast<uintptr_t*>(*p); *p = reinterpret_cast<uintptr_t>(p2); p = p2;)
-    *last_touched_address = const_cast<uintptr_t*>(p);
+int32_t xmem::blocked2DWrite_Word64(void* src, void* dst, const tile_geometry_t* geometry) {
+    register Word64_t val = 0xFFFFFFFFFFFFFFFF;
+    Word64_t* base = static_cast<Word64_t*>(src);
+    size_t width = geometry->width;
+    size_t height = geometry->height;
+    size_t pitch = geometry->pitch;
+    size_t tile_width = geometry->tile_width;
+    size_t tile_height = geometry->tile_height;
+    for (size_t y0 = 0; y0 < height; y0 += tile_height) {
+        for (size_t x0 = 0; x0 < width; x0 += tile_width) {
+            size_t y_end = std::min(y0 + tile_height, height);
+            size_t x_end = std::min(x0 + tile_width, width);
+            for (size_t y = y0; y < y_end; y++) {
+                volatile Word64_t* wordptr = base + y * pitch + x0;
+                volatile Word64_t* endptr = base + y * pitch + x_end;
+                while (wordptr + 8 <= endptr) {
+                    UNROLL8(*wordptr++ = val;)
+                }
+                while (wordptr < endptr) {
+                    *wordptr++ = val;
+                }
+            }
+        }
+    }
     return 0;
 }
-#endif
 
-#ifdef HAS_WORD_64
-int32_t xmem::randomWrite_Word64(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len) {
-    volatile uintptr_t* p = first_address;
-    volatile uintptr_t* p2 = NULL;
+int32_t xmem::morton2DRead_Word64(void* src, void* dst, const tile_geometry_t* geometry) {
+    register Word64_t val;
+    Word64_t* base = static_cast<Word64_t*>(src);
+    size_t width = geometry->width;
+    size_t height = geometry->height;
+    size_t pitch = geometry->pitch;
+    size_t tile_width = geometry->tile_width;
+    size_t tile_height = geometry->tile_height;
+    size_t side = morton_side(geometry);
+    for (size_t square_y0 = 0; square_y0 < height; square_y0 += side * tile_height) { //Squares of tiles in row-major order, tiles in Z order within each square
+        for (size_t square_x0 = 0; square_x0 < width; square_x0 += side * tile_width) {
+            for (uint64_t code = 0; code < side * side; code++) {
+                size_t x0 = square_x0 + compact_even_bits(code) * tile_width;
+                size_t y0 = square_y0 + compact_even_bits(code >> 1) * tile_height;
+                if (x0 < width && y0 < height) { //The squares along the right and bottom edges may stick out of the array, so skip the codes outside of it
+                    size_t y_end = std::min(y0 + tile_height, height);
+                    size_t x_end = std::min(x0 + tile_width, width);
+                    for (size_t y = y0; y < y_end; y++) {
+                        volatile Word64_t* wordptr = base + y * pitch + x0;
+                        volatile Word64_t* endptr = base + y * pitch + x_end;
+                        while (wordptr + 8 <= endptr) {
+                            UNROLL8(val = *wordptr++;)
+                        }
+                        while (wordptr < endptr) {
+                            val = *wordptr++;
+                        }
+                    }
+                }
+            }
+        }
+    }
+    return 0;
+}
 
-    UNROLL512(p2 = reinterpret_cast<uintptr_t*>(*p); *p = reinterpret_cast<uintptr_t>(p2); p = p2;)
-    *last_touched_address = const_cast<uintptr_t*>(p);
+int32_t xmem::morton2DWrite_Word64(void* src, void* dst, const tile_geometry_t* geometry) {
+    register Word64_t val = 0xFFFFFFFFFFFFFFFF;
+    Word64_t* base = static_cast<Word64_t*>(src);
+    size_t width = geometry->width;
+    size_t height = geometry->height;
+    size_t pitch = geometry->pitch;
+    size_t tile_width = geometry->tile_width;
+    size_t tile_height = geometry->tile_height;
+    size_t side = morton_side(geometry);
+    for (size_t square_y0 = 0; square_y0 < height; square_y0 += side * tile_height) { //Squares of tiles in row-major order, tiles in Z order within each square
+        for (size_t square_x0 = 0; square_x0 < width; square_x0 += side * tile_width) {
+            for (uint64_t code = 0; code < side * side; code++) {
+                size_t x0 = square_x0 + compact_even_bits(code) * tile_width;
+                size_t y0 = square_y0 + compact_even_bits(code >> 1) * tile_height;
+                if (x0 < width && y0 < height) { //The squares along the right and bottom edges may stick out of the array, so skip the codes outside of it
+                    size_t y_end = std::min(y0 + tile_height, height);
+                    size_t x_end = std::min(x0 + tile_width, width);
+                    for (size_t y = y0; y < y_end; y++) {
+                        volatile Word64_t* wordptr = base + y * pitch + x0;
+                        volatile Word64_t* endptr = base + y * pitch + x_end;
+                        while (wordptr + 8 <= endptr) {
+                            UNROLL8(*wordptr++ = val;)
+                        }
+                        while (wordptr < endptr) {
+                            *wordptr++ = val;
+                        }
+                    }
+                }
+            }
+        }
+    }
+    return 0;
+}
+
+int32_t xmem::transpose2D_Word64(void* src, void* dst, const tile_geometry_t* geometry) {
+    Word64_t* base = static_cast<Word64_t*>(src);
+    Word64_t* transposed = static_cast<Word64_t*>(dst);
+    size_t width = geometry->width;
+    size_t height = geometry->height;
+    size_t pitch = geometry->pitch;
+    size_t tile_width = geometry->tile_width;
+    size_t tile_height = geometry->tile_height;
+    //Row y of the source becomes column y of the destination, whose rows are height elements long
+    for (size_t y0 = 0; y0 < height; y0 += tile_height) {
+        for (size_t x0 = 0; x0 < width; x0 += tile_width) {
+            size_t y_end = std::min(y0 + tile_height, height);
+            size_t x_end = std::min(x0 + tile_width, width);
+            for (size_t y = y0; y < y_end; y++) {
+                volatile Word64_t* wordptr = base + y * pitch + x0;
+                volatile Word64_t* endptr = base + y * pitch + x_end;
+                volatile Word64_t* transposed_ptr = transposed + x0 * height + y;
+                while (wordptr + 8 <= endptr) {
+                    UNROLL8(*transposed_ptr = *wordptr++; transposed_ptr += height;)
+                }
+                while (wordptr < endptr) {
+                    *transposed_ptr = *wordptr++; transposed_ptr += height;
+                }
+            }
+        }
+    }
     return 0;
 }
 #endif
 
-#ifdef HAS_WORD_128
-int32_t xmem::randomWrite_Word128(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len) {
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return 0; //TODO: Implement for Windows.
-#else
-    volatile Word128_t* p = reinterpret_cast<Word128_t*>(first_address);
-    register Word128_t val;
+/***********************************************************************
+ ***********************************************************************
+ ********************* ROOFLINE BENCHMARK KERNELS **********************
+ ***********************************************************************
+ ***********************************************************************/
 
-#ifdef HAS_WORD_64
-    UNROLL256(val = *p; *p = val; p = reinterpret_cast<Word128_t*>(my_64b_extractLSB_128b(val));) //Do 128-bit load. Then do 128-bit store. Then extract 64 LSB to use as next load address.
-#else //special case: 32-bit machine
-    UNROLL256(val = *p; *p = val; p = reinterpret_cast<Word128_t*>(my_32b_extractLSB_128b(val));) //Do 128-bit load. Then do 128-bit store. Then extract 32 LSB to use as next load address.
-#endif
+/* --------------------- DUMMY BENCHMARK ROUTINES --------------------------- */
 
-    *last_touched_address = reinterpret_cast<uintptr_t*>(const_cast<Word128_t*>(p)); //Trick compiler. First get rid of volatile qualifier, and then reinterpret pointer
-    return 0;
-#endif
+int32_t xmem::dummy_rooflineLoop(void* start_address, void* end_address, uint32_t madds_per_element) {
+    volatile int32_t placeholder = 0; //Try our best to defeat compiler optimizations
+    for (uint8_t* page = static_cast<uint8_t*>(start_address), *endptr = static_cast<uint8_t*>(end_address); page < endptr; page += DEFAULT_PAGE_SIZE)
+        placeholder = 0;
+    return placeholder;
 }
-#endif
 
-#ifdef HAS_WORD_256
-int32_t xmem::randomWrite_Word256(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len) {
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return 0; //TODO: Implement for Windows.
-#else
-    volatile Word256_t* p = reinterpret_cast<Word256_t*>(first_address);
-    register Word256_t val;
+/* -------------------- CORE BENCHMARK ROUTINES -------------------------- */
+
+//Each kernel keeps eight independent multiply-add chains in flight to cover the latency of the multiply-add units, and applies the first multiply-add of every element to the loaded value.
+//The multiplier and addend go through a volatile so that the compiler can neither fold nor strength-reduce them. With a multiplier of 0.5, the floating-point accumulators converge instead of overflowing or going denormal.
 
 #ifdef HAS_WORD_64
-    UNROLL128(val = *p; *p = val; p = reinterpret_cast<Word256_t*>(my_64b_extractLSB_256b(val));) //Do 256-bit load. Then do 256-bit store. Then extract 64 LSB to use as next load address.
-#else //special case: 32-bit machine
-    UNROLL128(val = *p; *p = val; p = reinterpret_cast<Word256_t*>(my_32b_extractLSB_256b(val));) //Do 256-bit load. Then do 256-bit store. Then extract 32 LSB to use as next load address.
+#if defined(ARCH_INTEL_X86_64) && defined(HAS_WORD_128)
+//Scalar intrinsics keep the compiler from packing the eight chains into vectors. Callers must check roofline_engine_supported() first.
+#ifdef _WIN32
+int32_t xmem::rooflineScalarFMA_Word64(void* start_address, void* end_address, uint32_t madds_per_element) {
+#else
+int32_t __attribute__((target("fma"))) xmem::rooflineScalarFMA_Word64(void* start_address, void* end_address, uint32_t madds_per_element) {
 #endif
-
-    *last_touched_address = reinterpret_cast<uintptr_t*>(const_cast<Word256_t*>(p)); //Trick compiler. First get rid of volatile qualifier, and then reinterpret pointer
-    return 0;
+    volatile double seed = 0.5;
+    __m128d m = _mm_set_sd(seed);
+    __m128d a0 = _mm_setzero_pd(), a1 = a0, a2 = a0, a3 = a0, a4 = a0, a5 = a0, a6 = a0, a7 = a0;
+    for (const double* p = static_cast<const double*>(start_address), *endptr = static_cast<const double*>(end_address); p < endptr; p += 8) {
+        a0 = _mm_fmadd_sd(a0, m, _mm_load_sd(p)); a1 = _mm_fmadd_sd(a1, m, _mm_load_sd(p+1));
+        a2 = _mm_fmadd_sd(a2, m, _mm_load_sd(p+2)); a3 = _mm_fmadd_sd(a3, m, _mm_load_sd(p+3));
+        a4 = _mm_fmadd_sd(a4, m, _mm_load_sd(p+4)); a5 = _mm_fmadd_sd(a5, m, _mm_load_sd(p+5));
+        a6 = _mm_fmadd_sd(a6, m, _mm_load_sd(p+6)); a7 = _mm_fmadd_sd(a7, m, _mm_load_sd(p+7));
+        for (uint32_t k = 1; k < madds_per_element; k++) {
+            a0 = _mm_fmadd_sd(a0, m, m); a1 = _mm_fmadd_sd(a1, m, m); a2 = _mm_fmadd_sd(a2, m, m); a3 = _mm_fmadd_sd(a3, m, m);
+            a4 = _mm_fmadd_sd(a4, m, m); a5 = _mm_fmadd_sd(a5, m, m); a6 = _mm_fmadd_sd(a6, m, m); a7 = _mm_fmadd_sd(a7, m, m);
+        }
+    }
+    a0 = _mm_add_sd(_mm_add_sd(_mm_add_sd(a0, a1), _mm_add_sd(a2, a3)), _mm_add_sd(_mm_add_sd(a4, a5), _mm_add_sd(a6, a7)));
+    return static_cast<int32_t>(_mm_cvtsd_f64(a0));
+}
+#else
+int32_t xmem::rooflineScalarFMA_Word64(void* start_address, void* end_address, uint32_t madds_per_element) {
+    volatile double seed = 0.5;
+    double m = seed;
+    double a0 = 0, a1 = 0, a2 = 0, a3 = 0, a4 = 0, a5 = 0, a6 = 0, a7 = 0;
+    for (const double* p = static_cast<const double*>(start_address), *endptr = static_cast<const double*>(end_address); p < endptr; p += 8) {
+        a0 = std::fma(a0, m, p[0]); a1 = std::fma(a1, m, p[1]); a2 = std::fma(a2, m, p[2]); a3 = std::fma(a3, m, p[3]);
+        a4 = std::fma(a4, m, p[4]); a5 = std::fma(a5, m, p[5]); a6 = std::fma(a6, m, p[6]); a7 = std::fma(a7, m, p[7]);
+        for (uint32_t k = 1; k < madds_per_element; k++) {
+            a0 = std::fma(a0, m, m); a1 = std::fma(a1, m, m); a2 = std::fma(a2, m, m); a3 = std::fma(a3, m, m);
+            a4 = std::fma(a4, m, m); a5 = std::fma(a5, m, m); a6 = std::fma(a6, m, m); a7 = std::fma(a7, m, m);
+        }
+    }
+    return static_cast<int32_t>(a0 + a1 + a2 + a3 + a4 + a5 + a6 + a7);
+}
 #endif
+
+int32_t xmem::rooflineScalarInt_Word64(void* start_address, void* end_address, uint32_t madds_per_element) {
+    volatile Word64_t seed = 0x9E3779B97F4A7C15;
+    Word64_t m = seed;
+    Word64_t a0 = 0, a1 = 0, a2 = 0, a3 = 0, a4 = 0, a5 = 0, a6 = 0, a7 = 0;
+    for (const Word64_t* p = static_cast<const Word64_t*>(start_address), *endptr = static_cast<const Word64_t*>(end_address); p < endptr; p += 8) {
+        a0 = a0 * m + p[0]; a1 = a1 * m + p[1]; a2 = a2 * m + p[2]; a3 = a3 * m + p[3];
+        a4 = a4 * m + p[4]; a5 = a5 * m + p[5]; a6 = a6 * m + p[6]; a7 = a7 * m + p[7];
+        for (uint32_t k = 1; k < madds_per_element; k++) {
+            a0 = a0 * m + m; a1 = a1 * m + m; a2 = a2 * m + m; a3 = a3 * m + m;
+            a4 = a4 * m + m; a5 = a5 * m + m; a6 = a6 * m + m; a7 = a7 * m + m;
+        }
+    }
+    return static_cast<int32_t>(a0 ^ a1 ^ a2 ^ a3 ^ a4 ^ a5 ^ a6 ^ a7);
 }
 #endif
 
-#ifdef HAS_WORD_512
+#if defined(ARCH_INTEL_X86_64) && defined(HAS_WORD_256)
+//The vector kernels are compiled for AVX2 with FMA and AVX-512F regardless of the build flags. Callers must check roofline_engine_supported() first.
 #ifdef _WIN32
-int32_t xmem::randomWrite_Word512(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len) {
+int32_t xmem::rooflineAVX2FMA_Word256(void* start_address, void* end_address, uint32_t madds_per_element) {
 #else
-//FIXME: We flag GCC/ICC not to optimize this function. The problem is that my_512b_load() -- which maps to _mm512_load_epi64 Intel AVX-512/KNC intrinsic -- cannot accept volatile* arguments. The only way to prevent the entire benchmark loop from being optimized away is to force the compiler not to optimize the function at all. Unfortunately, this will cause extra unwanted code to be included. The only solution seems to be to write inline assembly or allow eventual support for assignment of __m512i variables, e.g., val = *wordptr++; which is how the code for the other word sizes is written.
-int32_t __attribute__((optimize("O0"))) xmem::randomWrite_Word512(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len) {
+int32_t __attribute__((target("avx2,fma"))) xmem::rooflineAVX2FMA_Word256(void* start_address, void* end_address, uint32_t madds_per_element) {
 #endif
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-#error 512-bit words are not supported on Windows.
-#else
-    //volatile Word512_t* p = reinterpret_cast<Word512_t*>(first_address);
-    Word512_t* p = reinterpret_cast<Word512_t*>(first_address);
-    register Word512_t val;
-
-    //UNROLL64(val = *p; *p = val; p = reinterpret_cast<Word512_t*>(my_64b_extractLSB_512b(val));) //Do 512-bit load. Then do 512-bit store. Then extract 64 LSB to use as next load address.
-    uint64_t scratchptr[8] __attribute__ ((aligned(512)));
-    uint64_t tmp;
-    UNROLL64(val = my_512b_load(p); *p = val; my_64b_extractLSB_512b(tmp, scratchptr, val); p = reinterpret_cast<Word512_t*>(tmp);) //Do 512-bit load. Then do 512-bit store. Then extract 64 LSB to use as next load address.
+    volatile double seed = 0.5;
+    __m256d m = _mm256_set1_pd(seed);
+    __m256d a0 = _mm256_setzero_pd(), a1 = a0, a2 = a0, a3 = a0, a4 = a0, a5 = a0, a6 = a0, a7 = a0;
+    for (const double* p = static_cast<const double*>(start_address), *endptr = static_cast<const double*>(end_address); p < endptr; p += 32) {
+        a0 = _mm256_fmadd_pd(a0, m, _mm256_load_pd(p)); a1 = _mm256_fmadd_pd(a1, m, _mm256_load_pd(p+4));
+        a2 = _mm256_fmadd_pd(a2, m, _mm256_load_pd(p+8)); a3 = _mm256_fmadd_pd(a3, m, _mm256_load_pd(p+12));
+        a4 = _mm256_fmadd_pd(a4, m, _mm256_load_pd(p+16)); a5 = _mm256_fmadd_pd(a5, m, _mm256_load_pd(p+20));
+        a6 = _mm256_fmadd_pd(a6, m, _mm256_load_pd(p+24)); a7 = _mm256_fmadd_pd(a7, m, _mm256_load_pd(p+28));
+        for (uint32_t k = 1; k < madds_per_element; k++) {
+            a0 = _mm256_fmadd_pd(a0, m, m); a1 = _mm256_fmadd_pd(a1, m, m); a2 = _mm256_fmadd_pd(a2, m, m); a3 = _mm256_fmadd_pd(a3, m, m);
+            a4 = _mm256_fmadd_pd(a4, m, m); a5 = _mm256_fmadd_pd(a5, m, m); a6 = _mm256_fmadd_pd(a6, m, m); a7 = _mm256_fmadd_pd(a7, m, m);
+        }
+    }
+    a0 = _mm256_add_pd(_mm256_add_pd(_mm256_add_pd(a0, a1), _mm256_add_pd(a2, a3)), _mm256_add_pd(_mm256_add_pd(a4, a5), _mm256_add_pd(a6, a7)));
+    return static_cast<int32_t>(_mm_cvtsd_f64(_mm256_castpd256_pd128(a0)));
+}
 
-    *last_touched_address = reinterpret_cast<uintptr_t*>(const_cast<Word512_t*>(p)); //Trick compiler. First get rid of volatile qualifier, and then reinterpret pointer
-    return 0;
-#endif
+#ifdef _WIN32
+int32_t xmem::rooflineAVX512FMA_Word512(void* start_address, void* end_address, uint32_t madds_per_element) {
+#else
+int32_t __attribute__((target("avx512f"))) xmem::rooflineAVX512FMA_Word512(void* start_address, void* end_address, uint32_t madds_per_element) {
+#endif
+    volatile double seed = 0.5;
+    __m512d m = _mm512_set1_pd(seed);
+    __m512d a0 = _mm512_setzero_pd(), a1 = a0, a2 = a0, a3 = a0, a4 = a0, a5 = a0, a6 = a0, a7 = a0;
+    for (const double* p = static_cast<const double*>(start_address), *endptr = static_cast<const double*>(end_address); p < endptr; p += 64) {
+        a0 = _mm512_fmadd_pd(a0, m, _mm512_load_pd(p)); a1 = _mm512_fmadd_pd(a1, m, _mm512_load_pd(p+8));
+        a2 = _mm512_fmadd_pd(a2, m, _mm512_load_pd(p+16)); a3 = _mm512_fmadd_pd(a3, m, _mm512_load_pd(p+24));
+        a4 = _mm512_fmadd_pd(a4, m, _mm512_load_pd(p+32)); a5 = _mm512_fmadd_pd(a5, m, _mm512_load_pd(p+40));
+        a6 = _mm512_fmadd_pd(a6, m, _mm512_load_pd(p+48)); a7 = _mm512_fmadd_pd(a7, m, _mm512_load_pd(p+56));
+        for (uint32_t k = 1; k < madds_per_element; k++) {
+            a0 = _mm512_fmadd_pd(a0, m, m); a1 = _mm512_fmadd_pd(a1, m, m); a2 = _mm512_fmadd_pd(a2, m, m); a3 = _mm512_fmadd_pd(a3, m, m);
+            a4 = _mm512_fmadd_pd(a4, m, m); a5 = _mm512_fmadd_pd(a5, m, m); a6 = _mm512_fmadd_pd(a6, m, m); a7 = _mm512_fmadd_pd(a7, m, m);
+        }
+    }
+    a0 = _mm512_add_pd(_mm512_add_pd(_mm512_add_pd(a0, a1), _mm512_add_pd(a2, a3)), _mm512_add_pd(_mm512_add_pd(a4, a5), _mm512_add_pd(a6, a7)));
+    double sum[8];
+    _mm512_storeu_pd(sum, a0);
+    return static_cast<int32_t>(sum[0]);
 }
 #endif
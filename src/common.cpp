@@ -36,6 +36,9 @@
 //Libraries
 #include <iostream>
 #include <vector> //for std::vector
+#include <fstream> //for std::ifstream
+#include <algorithm> //for std::find
+#include <cstdlib> //for strtod
 
 #ifdef _WIN32
 #include <windows.h>
@@ -48,8 +51,7 @@
 #ifdef HAS_NUMA
 #include <numa.h>
 #endif
-#include <fstream> //for std::ifstream
-#include <algorithm> //for std::find
+#include <sstream> //for std::ostringstream
 
 #ifdef ARCH_INTEL
 #include <immintrin.h> //for timer
@@ -446,6 +448,506 @@ int32_t xmem::cpu_id_in_numa_node(uint32_t numa_node, uint32_t cpu_in_node) {
     return cpu_id;
 #endif
 }
+
+#ifdef __gnu_linux__
+/**
+ * @brief Reads the first line of a sysfs attribute of a logical CPU.
+ * @param cpu_id The logical CPU identifier.
+ * @param attribute Path of the attribute relative to the CPU's sysfs directory, e.g., "topology/core_id".
+ * @param value Filled in with the attribute value.
+ * @returns True on success.
+ */
+static bool read_cpu_sysfs_attribute(uint32_t cpu_id, std::string attribute, std::string& value) {
+    std::ostringstream path;
+    path << "/sys/devices/system/cpu/cpu" << cpu_id << "/" << attribute;
+    std::ifstream in(path.str().c_str());
+    if (!in.is_open())
+        return false;
+    std::getline(in, value);
+    return !in.fail();
+}
+
+/**
+ * @brief Finds the CPUs that share the last-level data or unified cache with a logical CPU.
+ * @param cpu_id The logical CPU identifier.
+ * @param shared_cpu_map Filled in with the sysfs CPU mask of the last-level cache.
+ * @returns True on success.
+ */
+static bool read_llc_shared_cpu_map(uint32_t cpu_id, std::string& shared_cpu_map) {
+    uint32_t llc_level = 0;
+    for (uint32_t index = 0; ; index++) {
+        std::ostringstream cache;
+        cache << "cache/index" << index << "/";
+        std::string level;
+        std::string type;
+        std::string map;
+        if (!read_cpu_sysfs_attribute(cpu_id, cache.str() + "level", level))
+            break;
+        if (!read_cpu_sysfs_attribute(cpu_id, cache.str() + "type", type) || type == "Instruction")
+            continue;
+        if (!read_cpu_sysfs_attribute(cpu_id, cache.str() + "shared_cpu_map", map))
+            continue;
+        uint32_t l = static_cast<uint32_t>(strtoul(level.c_str(), NULL, 10));
+        if (l > llc_level) {
+            llc_level = l;
+            shared_cpu_map = map;
+        }
+    }
+    return llc_level > 0;
+}
+#endif
+
+cpu_relation_t xmem::get_cpu_relation(uint32_t cpu_a, uint32_t cpu_b) {
+#ifdef _WIN32
+    PSYSTEM_LOGICAL_PROCESSOR_INFORMATION buffer = NULL;
+    PSYSTEM_LOGICAL_PROCESSOR_INFORMATION curr = NULL;
+    DWORD len = 0;
+    DWORD offset = 0;
+    GetLogicalProcessorInformation(buffer, &len); //this will fail because buffer is not yet allocated.
+    buffer = static_cast<PSYSTEM_LOGICAL_PROCESSOR_INFORMATION>(malloc(len));
+    if (!buffer)
+        return CPU_RELATION_UNKNOWN;
+    if (!GetLogicalProcessorInformation(buffer, &len)) {
+        free(buffer);
+        return CPU_RELATION_UNKNOWN;
+    }
+
+    ULONG_PTR pair_mask = (static_cast<ULONG_PTR>(1) << cpu_a) | (static_cast<ULONG_PTR>(1) << cpu_b);
+    bool same_core = false;
+    bool same_package = false;
+    bool shared_llc = false;
+    BYTE llc_level = 0;
+    curr = buffer;
+    while (offset + sizeof(SYSTEM_LOGICAL_PROCESSOR_INFORMATION) <= len) {
+        bool both = ((curr->ProcessorMask & pair_mask) == pair_mask);
+        if (curr->Relationship == RelationProcessorCore && both)
+            same_core = true;
+        else if (curr->Relationship == RelationProcessorPackage && both)
+            same_package = true;
+        else if (curr->Relationship == RelationCache && curr->Cache.Type != CacheInstruction && (curr->ProcessorMask & pair_mask) != 0) {
+            if (curr->Cache.Level > llc_level) { //a deeper cache level than seen so far
+                llc_level = curr->Cache.Level;
+                shared_llc = both;
+            } else if (curr->Cache.Level == llc_level && both)
+                shared_llc = true;
+        }
+        curr++;
+        offset += sizeof(SYSTEM_LOGICAL_PROCESSOR_INFORMATION);
+    }
+    free(buffer);
+#endif
+#ifdef __gnu_linux__
+    std::string package_a, package_b, core_a, core_b, llc_a, llc_b;
+    if (!read_cpu_sysfs_attribute(cpu_a, "topology/physical_package_id", package_a) || !read_cpu_sysfs_attribute(cpu_b, "topology/physical_package_id", package_b))
+        return CPU_RELATION_UNKNOWN;
+    bool same_package = (package_a == package_b);
+    bool same_core = same_package && read_cpu_sysfs_attribute(cpu_a, "topology/core_id", core_a) && read_cpu_sysfs_attribute(cpu_b, "topology/core_id", core_b) && core_a == core_b;
+    bool shared_llc = read_llc_shared_cpu_map(cpu_a, llc_a) && read_llc_shared_cpu_map(cpu_b, llc_b) && llc_a == llc_b;
+#endif
+
+    if (same_core)
+        return CPU_RELATION_SMT;
+    if (shared_llc)
+        return CPU_RELATION_SHARED_LLC;
+    if (same_package)
+        return CPU_RELATION_SAME_PACKAGE;
+    return CPU_RELATION_CROSS_PACKAGE;
+}
+
+std::string xmem::cpu_relation_name(cpu_relation_t relation) {
+    switch (relation) {
+        case CPU_RELATION_SMT:
+            return "SMT siblings";
+        case CPU_RELATION_SHARED_LLC:
+            return "Shared LLC (same CCX)";
+        case CPU_RELATION_SAME_PACKAGE:
+            return "Same socket (cross-CCX)";
+        case CPU_RELATION_CROSS_PACKAGE:
+            return "Cross-socket";
+        default:
+            return "Unknown topology";
+    }
+}
+
+std::string xmem::atomic_op_name(atomic_op_t atomic_op) {
+    switch (atomic_op) {
+        case ATOMIC_FETCH_ADD:
+            return "xadd";
+        case ATOMIC_COMPARE_EXCHANGE:
+            return "cmpxchg";
+        case ATOMIC_EXCHANGE:
+            return "xchg";
+        default:
+            return "unknown";
+    }
+}
+
+std::string xmem::atomic_sharing_name(atomic_sharing_t sharing) {
+    switch (sharing) {
+        case ATOMIC_PRIVATE:
+            return "private";
+        case ATOMIC_SHARED:
+            return "shared";
+        case ATOMIC_SPREAD:
+            return "spread";
+        default:
+            return "unknown";
+    }
+}
+
+std::string xmem::flush_op_name(flush_op_t flush_op) {
+    switch (flush_op) {
+        case FLUSH_CLFLUSH:
+            return "clflush";
+        case FLUSH_CLFLUSHOPT:
+            return "clflushopt";
+        case FLUSH_CLWB:
+            return "clwb";
+        default:
+            return "unknown";
+    }
+}
+
+std::string xmem::rw_mode_name(rw_mode_t rw_mode) {
+    switch (rw_mode) {
+        case READ:
+            return "read";
+        case WRITE:
+            return "write";
+        case READ_WRITE_1_1:
+            return "1:1 read/write";
+        case READ_WRITE_2_1:
+            return "2:1 read/write";
+        case READ_WRITE_3_1:
+            return "3:1 read/write";
+        case READ_MODIFY_WRITE:
+            return "read-modify-write";
+        default:
+            return "unknown";
+    }
+}
+
+std::string xmem::copy_engine_name(copy_engine_t engine) {
+    switch (engine) {
+        case COPY_MEMCPY:
+            return "memcpy";
+        case COPY_MEMMOVE:
+            return "memmove";
+        case COPY_REP_MOVSB:
+            return "movsb";
+        case COPY_VECTOR:
+            return "vector";
+        case COPY_VECTOR_NT:
+            return "vector_nt";
+        case FILL_MEMSET:
+            return "memset";
+        case FILL_REP_STOSB:
+            return "stosb";
+        case FILL_VECTOR:
+            return "vector_fill";
+        case FILL_VECTOR_NT:
+            return "vector_fill_nt";
+        default:
+            return "unknown";
+    }
+}
+
+bool xmem::copy_engine_is_fill(copy_engine_t engine) {
+    return engine >= FILL_MEMSET && engine < NUM_COPY_ENGINES;
+}
+
+bool xmem::flush_op_supported(flush_op_t flush_op) {
+#ifdef ARCH_INTEL
+    uint32_t leaf = 0;
+    uint32_t bit = 0;
+    bool in_ebx = false;
+    switch (flush_op) {
+        case FLUSH_CLFLUSH: //CPUID.01H:EDX[19]
+            leaf = 1;
+            bit = 19;
+            break;
+        case FLUSH_CLFLUSHOPT: //CPUID.(EAX=07H,ECX=0):EBX[23]
+            leaf = 7;
+            bit = 23;
+            in_ebx = true;
+            break;
+        case FLUSH_CLWB: //CPUID.(EAX=07H,ECX=0):EBX[24]
+            leaf = 7;
+            bit = 24;
+            in_ebx = true;
+            break;
+        default:
+            return false;
+    }
+
+    uint32_t regs[4] = { 0, 0, 0, 0 }; //EAX, EBX, ECX, EDX
+#ifdef _WIN32
+    int max_regs[4];
+    __cpuid(max_regs, 0);
+    if (static_cast<uint32_t>(max_regs[0]) < leaf)
+        return false;
+    __cpuidex(reinterpret_cast<int*>(regs), leaf, 0);
+#endif
+#ifdef __gnu_linux__
+    if (__get_cpuid_max(0, NULL) < leaf)
+        return false;
+    __cpuid_count(leaf, 0, regs[0], regs[1], regs[2], regs[3]);
+#endif
+    return ((in_ebx ? regs[1] : regs[3]) >> bit) & 1;
+#else
+    return false;
+#endif
+}
+
+std::string xmem::gather_engine_name(gather_engine_t engine) {
+    switch (engine) {
+        case GATHER_SCALAR:
+            return "scalar_load";
+        case GATHER_AVX2:
+            return "gather_avx2";
+        case GATHER_AVX512:
+            return "gather_avx512";
+        case SCATTER_SCALAR:
+            return "scalar_store";
+        case SCATTER_AVX512:
+            return "scatter_avx512";
+        default:
+            return "unknown";
+    }
+}
+
+bool xmem::gather_engine_is_scatter(gather_engine_t engine) {
+    return engine >= SCATTER_SCALAR && engine < NUM_GATHER_ENGINES;
+}
+
+bool xmem::gather_engine_supported(gather_engine_t engine) {
+    switch (engine) {
+        case GATHER_SCALAR:
+        case SCATTER_SCALAR:
+#ifdef HAS_WORD_64
+            return true;
+#else
+            return false;
+#endif
+        case GATHER_AVX2:
+        case GATHER_AVX512:
+        case SCATTER_AVX512:
+            break;
+        default:
+            return false;
+    }
+
+#ifdef ARCH_INTEL_X86_64
+    uint32_t leaf1[4] = { 0, 0, 0, 0 }; //EAX, EBX, ECX, EDX
+    uint32_t leaf7[4] = { 0, 0, 0, 0 };
+    uint64_t xcr0 = 0;
+#ifdef _WIN32
+    int max_regs[4];
+    __cpuid(max_regs, 0);
+    if (static_cast<uint32_t>(max_regs[0]) < 7)
+        return false;
+    __cpuidex(reinterpret_cast<int*>(leaf1), 1, 0);
+    __cpuidex(reinterpret_cast<int*>(leaf7), 7, 0);
+    if (!((leaf1[2] >> 27) & 1)) //CPUID.01H:ECX[27] OSXSAVE
+        return false;
+    xcr0 = _xgetbv(0);
+#endif
+#ifdef __gnu_linux__
+    if (__get_cpuid_max(0, NULL) < 7)
+        return false;
+    __cpuid_count(1, 0, leaf1[0], leaf1[1], leaf1[2], leaf1[3]);
+    __cpuid_count(7, 0, leaf7[0], leaf7[1], leaf7[2], leaf7[3]);
+    if (!((leaf1[2] >> 27) & 1)) //CPUID.01H:ECX[27] OSXSAVE
+        return false;
+    uint32_t xcr0_lo = 0, xcr0_hi = 0;
+    __asm__ __volatile__("xgetbv" : "=a"(xcr0_lo), "=d"(xcr0_hi) : "c"(0));
+    xcr0 = (static_cast<uint64_t>(xcr0_hi) << 32) | xcr0_lo;
+#endif
+
+    if (engine == GATHER_AVX2) //CPUID.(EAX=07H,ECX=0):EBX[5], OS saves XMM and YMM state
+        return ((leaf7[1] >> 5) & 1) && (xcr0 & 0x6) == 0x6;
+    else //CPUID.(EAX=07H,ECX=0):EBX[16], OS saves XMM, YMM, opmask, and ZMM state
+        return ((leaf7[1] >> 16) & 1) && (xcr0 & 0xE6) == 0xE6;
+#else
+    return false;
+#endif
+}
+
+std::string xmem::gather_index_name(gather_index_t pattern) {
+    switch (pattern) {
+        case GATHER_INDEX_SEQUENTIAL:
+            return "sequential";
+        case GATHER_INDEX_STRIDED:
+            return "strided";
+        case GATHER_INDEX_WINDOW:
+            return "window";
+        case GATHER_INDEX_RANDOM:
+            return "random";
+        default:
+            return "unknown";
+    }
+}
+
+std::string xmem::data_pattern_name(data_pattern_t pattern) {
+    switch (pattern) {
+        case DATA_ZEROS:
+            return "zeros";
+        case DATA_ONES:
+            return "ones";
+        case DATA_ALTERNATING:
+            return "alternating";
+        case DATA_RANDOM:
+            return "random";
+        case DATA_FILE:
+            return "file";
+        default:
+            return "unknown";
+    }
+}
+
+std::string xmem::tile_order_name(tile_order_t order) {
+    switch (order) {
+        case TILE_ORDER_ROW:
+            return "row";
+        case TILE_ORDER_COLUMN:
+            return "column";
+        case TILE_ORDER_BLOCKED:
+            return "blocked";
+        case TILE_ORDER_MORTON:
+            return "morton";
+        case TILE_ORDER_TRANSPOSE:
+            return "transpose";
+        default:
+            return "unknown";
+    }
+}
+
+std::string xmem::roofline_engine_name(roofline_engine_t engine) {
+    switch (engine) {
+        case ROOFLINE_SCALAR_FMA:
+            return "scalar_fma";
+        case ROOFLINE_AVX2_FMA:
+            return "avx2_fma";
+        case ROOFLINE_AVX512_FMA:
+            return "avx512_fma";
+        case ROOFLINE_SCALAR_INT:
+            return "scalar_int";
+        default:
+            return "unknown";
+    }
+}
+
+bool xmem::roofline_engine_is_integer(roofline_engine_t engine) {
+    return engine == ROOFLINE_SCALAR_INT;
+}
+
+bool xmem::roofline_engine_supported(roofline_engine_t engine) {
+    switch (engine) {
+        case ROOFLINE_SCALAR_INT:
+#ifdef HAS_WORD_64
+            return true;
+#else
+            return false;
+#endif
+        case ROOFLINE_SCALAR_FMA:
+#ifndef ARCH_INTEL_X86_64
+            return true; //Other architectures fuse multiply-adds in their base instruction sets or fall back to the C library
+#endif
+        case ROOFLINE_AVX2_FMA:
+        case ROOFLINE_AVX512_FMA:
+            break;
+        default:
+            return false;
+    }
+
+#ifdef ARCH_INTEL_X86_64
+    uint32_t leaf1[4] = { 0, 0, 0, 0 }; //EAX, EBX, ECX, EDX
+    uint32_t leaf7[4] = { 0, 0, 0, 0 };
+    uint64_t xcr0 = 0;
+#ifdef _WIN32
+    int max_regs[4];
+    __cpuid(max_regs, 0);
+    if (static_cast<uint32_t>(max_regs[0]) < 7)
+        return false;
+    __cpuidex(reinterpret_cast<int*>(leaf1), 1, 0);
+    __cpuidex(reinterpret_cast<int*>(leaf7), 7, 0);
+    if (!((leaf1[2] >> 27) & 1)) //CPUID.01H:ECX[27] OSXSAVE
+        return false;
+    xcr0 = _xgetbv(0);
+#endif
+#ifdef __gnu_linux__
+    if (__get_cpuid_max(0, NULL) < 7)
+        return false;
+    __cpuid_count(1, 0, leaf1[0], leaf1[1], leaf1[2], leaf1[3]);
+    __cpuid_count(7, 0, leaf7[0], leaf7[1], leaf7[2], leaf7[3]);
+    if (!((leaf1[2] >> 27) & 1)) //CPUID.01H:ECX[27] OSXSAVE
+        return false;
+    uint32_t xcr0_lo = 0, xcr0_hi = 0;
+    __asm__ __volatile__("xgetbv" : "=a"(xcr0_lo), "=d"(xcr0_hi) : "c"(0));
+    xcr0 = (static_cast<uint64_t>(xcr0_hi) << 32) | xcr0_lo;
+#endif
+
+    bool fma = ((leaf1[2] >> 12) & 1) && (xcr0 & 0x6) == 0x6; //CPUID.01H:ECX[12] FMA, OS saves XMM and YMM state
+    if (engine == ROOFLINE_SCALAR_FMA)
+        return fma;
+    else if (engine == ROOFLINE_AVX2_FMA) //CPUID.(EAX=07H,ECX=0):EBX[5] AVX2
+        return fma && ((leaf7[1] >> 5) & 1);
+    else //CPUID.(EAX=07H,ECX=0):EBX[16] AVX-512F, OS saves XMM, YMM, opmask, and ZMM state
+        return ((leaf7[1] >> 16) & 1) && (xcr0 & 0xE6) == 0xE6;
+#else
+    return false;
+#endif
+}
+
+bool xmem::read_two_column_points(const std::string& filename, const std::string& what, const std::string& point_format, std::vector<double>& first, std::vector<double>& second) {
+    std::ifstream file(filename.c_str());
+    if (!file.is_open()) {
+        std::cerr << "ERROR: Failed to open " << what << " file " << filename << std::endl;
+        return false;
+    }
+
+    std::string line;
+    uint32_t line_number = 0;
+    bool have_points = false;
+    while (std::getline(file, line)) {
+        line_number++;
+        line.erase(std::remove(line.begin(), line.end(), '\r'), line.end());
+        size_t first_char = line.find_first_not_of(" \t");
+        if (first_char == std::string::npos || line[first_char] == '#') //Blank line or comment
+            continue;
+
+        const char* str = line.c_str();
+        char* endptr = NULL;
+        double x = strtod(str, &endptr);
+        bool ok = (endptr != str);
+        const char* sep = endptr;
+        while (*sep == ' ' || *sep == '\t')
+            sep++;
+        ok = ok && (*sep == ',');
+        double y = 0;
+        if (ok) {
+            str = sep+1;
+            y = strtod(str, &endptr);
+            ok = (endptr != str);
+            while (*endptr == ' ' || *endptr == '\t')
+                endptr++;
+            ok = ok && (*endptr == '\0' || *endptr == ',');
+        }
+
+        if (!ok) {
+            if (!have_points && line_number == 1) //Header line
+                continue;
+            std::cerr << "ERROR: Invalid " << what << " point on line " << line_number << " of " << filename << ". Each point must have the form " << point_format << "." << std::endl;
+            return false;
+        }
+
+        first.push_back(x);
+        second.push_back(y);
+        have_points = true;
+    }
+
+    return true;
+}
     
 void xmem::init_globals() {
     //Initialize global variables to defaults.
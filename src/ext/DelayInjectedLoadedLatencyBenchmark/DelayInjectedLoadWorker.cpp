@@ -0,0 +1,252 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Microsoft
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Author: Mark Gottscho <mgottscho@ucla.edu>
+ */
+
+/**
+ * @file
+ * 
+ * @brief Implementation file for the DelayInjectedLoadWorker class.
+ */
+
+//Headers
+#include <common.h>
+
+#ifdef EXT_DELAY_INJECTED_LOADED_LATENCY_BENCHMARK
+
+#include <DelayInjectedLoadWorker.h>
+#include <delay_injected_benchmark_kernels.h>
+#include <benchmark_kernels.h>
+
+//Libraries
+#include <iostream>
+
+#ifdef _WIN32
+#include <windows.h>
+#include <processthreadsapi.h>
+#endif
+
+#ifdef __gnu_linux__
+#include <unistd.h>
+#endif
+
+using namespace xmem;
+
+DelayInjectedLoadWorker::DelayInjectedLoadWorker(
+        void* mem_array,
+        size_t len,
+        DelayInjectedSequentialFunction kernel_fptr,
+        DelayInjectedSequentialFunction kernel_dummy_fptr,
+        int32_t stride_size,
+        uint32_t delay,
+        int32_t cpu_affinity
+    ) :
+        MemoryWorker(
+            mem_array,
+            len,
+            cpu_affinity
+        ),
+        use_sequential_kernel_fptr_(true),
+        kernel_fptr_seq_(kernel_fptr),
+        kernel_dummy_fptr_seq_(kernel_dummy_fptr),
+        kernel_fptr_ran_(NULL),
+        kernel_dummy_fptr_ran_(NULL),
+        stride_size_(stride_size),
+        delay_(delay)
+    {
+}
+
+DelayInjectedLoadWorker::DelayInjectedLoadWorker(
+        void* mem_array,
+        size_t len,
+        DelayInjectedRandomFunction kernel_fptr,
+        DelayInjectedRandomFunction kernel_dummy_fptr,
+        uint32_t delay,
+        int32_t cpu_affinity
+    ) :
+        MemoryWorker(
+            mem_array,
+            len,
+            cpu_affinity
+        ),
+        use_sequential_kernel_fptr_(false),
+        kernel_fptr_seq_(NULL),
+        kernel_dummy_fptr_seq_(NULL),
+        kernel_fptr_ran_(kernel_fptr),
+        kernel_dummy_fptr_ran_(kernel_dummy_fptr),
+        stride_size_(1),
+        delay_(delay)
+    {
+}
+
+DelayInjectedLoadWorker::~DelayInjectedLoadWorker() {
+}
+
+void DelayInjectedLoadWorker::run() {
+    //Set up relevant state -- localized to this thread's stack
+    int32_t cpu_affinity = 0;
+    bool use_sequential_kernel_fptr = false;
+    DelayInjectedSequentialFunction kernel_fptr_seq = NULL;
+    DelayInjectedSequentialFunction kernel_dummy_fptr_seq = NULL;
+    DelayInjectedRandomFunction kernel_fptr_ran = NULL;
+    DelayInjectedRandomFunction kernel_dummy_fptr_ran = NULL;
+    int32_t stride_size = 1;
+    uint32_t delay = 0;
+    void* start_address = NULL;
+    void* end_address = NULL;
+    void* prime_start_address = NULL;
+    void* prime_end_address = NULL;
+    uint32_t bytes_per_pass = 0;
+    uint32_t passes = 0;
+    tick_t start_tick = 0;
+    tick_t stop_tick = 0;
+    tick_t elapsed_ticks = 0;
+    tick_t elapsed_dummy_ticks = 0;
+    tick_t adjusted_ticks = 0;
+    bool warning = false;
+    void* mem_array = NULL;
+    size_t len = 0;
+    tick_t target_ticks = g_ticks_per_ms * BENCHMARK_DURATION_MS; //Rough target run duration in ticks
+    uint32_t p = 0;
+    bytes_per_pass = THROUGHPUT_BENCHMARK_BYTES_PER_PASS;
+    
+    //Grab relevant setup state thread-safely and keep it local
+    if (acquireLock(-1)) {
+        mem_array = mem_array_;
+        len = len_;
+        cpu_affinity = cpu_affinity_;
+        use_sequential_kernel_fptr = use_sequential_kernel_fptr_;
+        kernel_fptr_seq = kernel_fptr_seq_;
+        kernel_dummy_fptr_seq = kernel_dummy_fptr_seq_;
+        kernel_fptr_ran = kernel_fptr_ran_;
+        kernel_dummy_fptr_ran = kernel_dummy_fptr_ran_;
+        stride_size = stride_size_;
+        delay = delay_;
+        start_address = mem_array_;
+        end_address = reinterpret_cast<void*>(reinterpret_cast<uint8_t*>(mem_array_)+bytes_per_pass);
+        prime_start_address = mem_array_; 
+        prime_end_address = reinterpret_cast<void*>(reinterpret_cast<uint8_t*>(mem_array_) + len_);
+        releaseLock();
+    }
+    
+    //Set processor affinity
+    bool locked = lock_thread_to_cpu(cpu_affinity);
+    if (!locked)
+        std::cerr << "WARNING: Failed to lock thread to logical CPU " << cpu_affinity << "! Results may not be correct." << std::endl;
+
+    //Increase scheduling priority
+#ifdef _WIN32
+    DWORD original_priority_class;
+    DWORD original_priority;
+    if (!boost_scheduling_priority(original_priority_class, original_priority))
+#endif
+#ifdef __gnu_linux__
+    if (!boost_scheduling_priority())
+#endif
+        std::cerr << "WARNING: Failed to boost scheduling priority. Perhaps running in Administrator mode would help." << std::endl;
+
+    //Prime memory
+    for (uint32_t i = 0; i < 4; i++) {
+        forwSequentialRead_Word32(prime_start_address, prime_end_address); //dependent reads on the memory, make sure caches are ready, coherence, etc...
+    }
+
+    //Run the benchmark! Kernel calls are timed in batches of 64 rather than 1024, because a single call can take a long time with large delays.
+    uintptr_t* next_address = static_cast<uintptr_t*>(mem_array);
+    //Run actual version of function and loop overhead
+    while (elapsed_ticks < target_ticks) {
+        if (use_sequential_kernel_fptr) { //sequential function semantics
+            start_tick = start_timer();
+            UNROLL64(
+                (*kernel_fptr_seq)(start_address, end_address, stride_size, delay);
+                start_address = reinterpret_cast<void*>(reinterpret_cast<uint8_t*>(mem_array)+(reinterpret_cast<uintptr_t>(start_address)+bytes_per_pass) % len);
+                end_address = reinterpret_cast<void*>(reinterpret_cast<uint8_t*>(start_address) + bytes_per_pass);
+            )
+            stop_tick = stop_timer();
+            passes+=64;
+        } else { //random function semantics
+            start_tick = start_timer();
+            UNROLL64((*kernel_fptr_ran)(next_address, &next_address, bytes_per_pass, delay);)
+            stop_tick = stop_timer();
+            passes+=64;
+        }
+        elapsed_ticks += (stop_tick - start_tick);
+    }
+
+    //Run dummy version of function and loop overhead
+    p = 0;
+    start_address = mem_array;
+    end_address = reinterpret_cast<void*>(reinterpret_cast<uint8_t*>(mem_array) + bytes_per_pass);
+    next_address = static_cast<uintptr_t*>(mem_array);
+    while (p < passes) {
+        if (use_sequential_kernel_fptr) { //sequential function semantics
+            start_tick = start_timer();
+            UNROLL64(
+                (*kernel_dummy_fptr_seq)(start_address, end_address, stride_size, delay);
+                start_address = reinterpret_cast<void*>(reinterpret_cast<uint8_t*>(mem_array)+(reinterpret_cast<uintptr_t>(start_address)+bytes_per_pass) % len);
+                end_address = reinterpret_cast<void*>(reinterpret_cast<uint8_t*>(start_address) + bytes_per_pass);
+            )
+            stop_tick = stop_timer();
+            p+=64;
+        } else { //random function semantics
+            start_tick = start_timer();
+            UNROLL64((*kernel_dummy_fptr_ran)(next_address, &next_address, bytes_per_pass, delay);)
+            stop_tick = stop_timer();
+            p+=64;
+        }
+
+        elapsed_dummy_ticks += (stop_tick - start_tick);
+    }
+
+    //Unset processor affinity
+    if (locked)
+        unlock_thread_to_numa_node();
+
+    //Revert thread priority
+#ifdef _WIN32
+    if (!revert_scheduling_priority(original_priority_class, original_priority))
+#endif
+#ifdef __gnu_linux__
+    if (!revert_scheduling_priority())
+#endif
+        std::cerr << "WARNING: Failed to revert scheduling priority. Perhaps running in Administrator mode would help." << std::endl;
+
+    adjusted_ticks = elapsed_ticks - elapsed_dummy_ticks;
+
+    //Warn if something looks fishy
+    if (elapsed_dummy_ticks >= elapsed_ticks || elapsed_ticks < MIN_ELAPSED_TICKS || adjusted_ticks < 0.5 * elapsed_ticks)
+        warning = true;
+
+    //Update the object state thread-safely
+    if (acquireLock(-1)) {
+        adjusted_ticks_ = adjusted_ticks;
+        elapsed_ticks_ = elapsed_ticks;
+        elapsed_dummy_ticks_ = elapsed_dummy_ticks;
+        warning_ = warning;
+        bytes_per_pass_ = bytes_per_pass;
+        completed_ = true;
+        passes_ = passes;
+        releaseLock();
+    }
+}
+
+#endif
@@ -40,6 +40,7 @@
 #include <MemoryWorker.h>
 #include <LatencyWorker.h>
 #include <LoadWorker.h>
+#include <DelayInjectedLoadWorker.h>
 
 //Libraries
 #include <iostream>
@@ -61,7 +62,10 @@ DelayInjectedLoadedLatencyBenchmark::DelayInjectedLoadedLatencyBenchmark(
         uint32_t num_worker_threads,
         uint32_t mem_node,
         uint32_t cpu_node,
+        pattern_mode_t pattern_mode,
+        rw_mode_t rw_mode,
         chunk_size_t chunk_size,
+        int32_t stride_size,
         std::vector<PowerReader*> dram_power_readers,
         std::string name,
         uint32_t delay
@@ -73,10 +77,10 @@ DelayInjectedLoadedLatencyBenchmark::DelayInjectedLoadedLatencyBenchmark(
             num_worker_threads,
             mem_node,
             cpu_node,
-            SEQUENTIAL,
-            READ,
+            pattern_mode,
+            rw_mode,
             chunk_size,
-            1,
+            stride_size,
             dram_power_readers,
             name
         ),
@@ -117,240 +121,45 @@ bool DelayInjectedLoadedLatencyBenchmark::runCore() {
         return false;
     }
 
-    //Set up load generation kernel function pointers
-    SequentialFunction load_kernel_fptr = NULL;
-    SequentialFunction load_kernel_dummy_fptr = NULL; 
+    //Set up load generation kernel function pointers. With no delay, the regular benchmark kernels are used so that the curve starts at the same peak load as the LatencyBenchmark.
+    SequentialFunction load_kernel_fptr_seq = NULL;
+    SequentialFunction load_kernel_dummy_fptr_seq = NULL; 
+    RandomFunction load_kernel_fptr_ran = NULL;
+    RandomFunction load_kernel_dummy_fptr_ran = NULL; 
+    DelayInjectedSequentialFunction del_load_kernel_fptr_seq = NULL;
+    DelayInjectedSequentialFunction del_load_kernel_dummy_fptr_seq = NULL; 
+    DelayInjectedRandomFunction del_load_kernel_fptr_ran = NULL;
+    DelayInjectedRandomFunction del_load_kernel_dummy_fptr_ran = NULL; 
     if (num_worker_threads_ > 1) { //If we only have one worker thread, it is used for latency measurement only, and no load threads will be used.
-        switch (chunk_size_) {
-            case CHUNK_32b:
-                switch (delay_) {
-                    case 0:
-                        load_kernel_fptr = &forwSequentialRead_Word32; //not an extended kernel
-                        load_kernel_dummy_fptr = &dummy_forwSequentialLoop_Word32; //not an extended kernel
-                        break;
-                    case 1:
-                        load_kernel_fptr = &forwSequentialRead_Word32_Delay1;
-                        load_kernel_dummy_fptr = &dummy_forwSequentialLoop_Word32_Delay1;
-                        break;
-                    case 2:
-                        load_kernel_fptr = &forwSequentialRead_Word32_Delay2;
-                        load_kernel_dummy_fptr = &dummy_forwSequentialLoop_Word32_Delay2;
-                        break;
-                    case 4:
-                        load_kernel_fptr = &forwSequentialRead_Word32_Delay4;
-                        load_kernel_dummy_fptr = &dummy_forwSequentialLoop_Word32_Delay4;
-                        break;
-                    case 8:
-                        load_kernel_fptr = &forwSequentialRead_Word32_Delay8;
-                        load_kernel_dummy_fptr = &dummy_forwSequentialLoop_Word32_Delay8;
-                        break;
-                    case 16:
-                        load_kernel_fptr = &forwSequentialRead_Word32_Delay16;
-                        load_kernel_dummy_fptr = &dummy_forwSequentialLoop_Word32_Delay16;
-                        break;
-                    case 32:
-                        load_kernel_fptr = &forwSequentialRead_Word32_Delay32;
-                        load_kernel_dummy_fptr = &dummy_forwSequentialLoop_Word32_Delay32;
-                        break;
-                    case 64:
-                        load_kernel_fptr = &forwSequentialRead_Word32_Delay64;
-                        load_kernel_dummy_fptr = &dummy_forwSequentialLoop_Word32_Delay64;
-                        break;
-                    case 128:
-                        load_kernel_fptr = &forwSequentialRead_Word32_Delay128;
-                        load_kernel_dummy_fptr = &dummy_forwSequentialLoop_Word32_Delay128;
-                        break;
-                    case 256:
-                        load_kernel_fptr = &forwSequentialRead_Word32_Delay256;
-                        load_kernel_dummy_fptr = &dummy_forwSequentialLoop_Word32_Delay256;
-                        break;
-                    case 512:
-                        load_kernel_fptr = &forwSequentialRead_Word32_Delay512;
-                        load_kernel_dummy_fptr = &dummy_forwSequentialLoop_Word32_Delay512plus;
-                        break;
-                    case 1024:
-                        load_kernel_fptr = &forwSequentialRead_Word32_Delay1024;
-                        load_kernel_dummy_fptr = &dummy_forwSequentialLoop_Word32_Delay512plus;
-                        break;
-                    default:
-                        std::cerr << "ERROR: Failed to find appropriate benchmark kernel." << std::endl;
-                        return false;
+        bool found = false;
+        if (pattern_mode_ == SEQUENTIAL) {
+            if (delay_ == 0)
+                found = determine_sequential_kernel(rw_mode_, chunk_size_, stride_size_, &load_kernel_fptr_seq, &load_kernel_dummy_fptr_seq);
+            else
+                found = determine_delay_injected_sequential_kernel(rw_mode_, chunk_size_, &del_load_kernel_fptr_seq, &del_load_kernel_dummy_fptr_seq);
+        } else if (pattern_mode_ == RANDOM) {
+            if (delay_ == 0)
+                found = determine_random_kernel(rw_mode_, chunk_size_, &load_kernel_fptr_ran, &load_kernel_dummy_fptr_ran);
+            else
+                found = determine_delay_injected_random_kernel(rw_mode_, chunk_size_, &del_load_kernel_fptr_ran, &del_load_kernel_dummy_fptr_ran);
+
+            //Build pointer indices for random-access load threads. Note that the pointers for each load thread must stay within its respective region, otherwise sharing may occur. 
+            for (uint32_t i = 1; found && i < num_worker_threads_; i++) {
+                if (!build_random_pointer_permutation(reinterpret_cast<void*>(reinterpret_cast<uint8_t*>(mem_array_) + i*len_per_thread), //static casts to silence compiler warnings
+                                                   reinterpret_cast<void*>(reinterpret_cast<uint8_t*>(mem_array_) + (i+1)*len_per_thread), //static casts to silence compiler warnings
+                                                   chunk_size_)) {
+                    std::cerr << "ERROR: Failed to build a random pointer permutation for a load generation thread!" << std::endl;
+                    return false;
                 }
-                break;
-#ifdef HAS_WORD_64
-            case CHUNK_64b:
-                switch (delay_) {
-                    case 0:
-                        load_kernel_fptr = &forwSequentialRead_Word64; //not an extended kernel
-                        load_kernel_dummy_fptr = &dummy_forwSequentialLoop_Word64; //not an extended kernel
-                        break;
-                    case 1:
-                        load_kernel_fptr = &forwSequentialRead_Word64_Delay1;
-                        load_kernel_dummy_fptr = &dummy_forwSequentialLoop_Word64_Delay1;
-                        break;
-                    case 2:
-                        load_kernel_fptr = &forwSequentialRead_Word64_Delay2;
-                        load_kernel_dummy_fptr = &dummy_forwSequentialLoop_Word64_Delay2;
-                        break;
-                    case 4:
-                        load_kernel_fptr = &forwSequentialRead_Word64_Delay4;
-                        load_kernel_dummy_fptr = &dummy_forwSequentialLoop_Word64_Delay4;
-                        break;
-                    case 8:
-                        load_kernel_fptr = &forwSequentialRead_Word64_Delay8;
-                        load_kernel_dummy_fptr = &dummy_forwSequentialLoop_Word64_Delay8;
-                        break;
-                    case 16:
-                        load_kernel_fptr = &forwSequentialRead_Word64_Delay16;
-                        load_kernel_dummy_fptr = &dummy_forwSequentialLoop_Word64_Delay16;
-                        break;
-                    case 32:
-                        load_kernel_fptr = &forwSequentialRead_Word64_Delay32;
-                        load_kernel_dummy_fptr = &dummy_forwSequentialLoop_Word64_Delay32;
-                        break;
-                    case 64:
-                        load_kernel_fptr = &forwSequentialRead_Word64_Delay64;
-                        load_kernel_dummy_fptr = &dummy_forwSequentialLoop_Word64_Delay64;
-                        break;
-                    case 128:
-                        load_kernel_fptr = &forwSequentialRead_Word64_Delay128;
-                        load_kernel_dummy_fptr = &dummy_forwSequentialLoop_Word64_Delay128;
-                        break;
-                    case 256:
-                        load_kernel_fptr = &forwSequentialRead_Word64_Delay256;
-                        load_kernel_dummy_fptr = &dummy_forwSequentialLoop_Word64_Delay256plus;
-                        break;
-                    case 512:
-                        load_kernel_fptr = &forwSequentialRead_Word64_Delay512;
-                        load_kernel_dummy_fptr = &dummy_forwSequentialLoop_Word64_Delay256plus;
-                        break;
-                    case 1024:
-                        load_kernel_fptr = &forwSequentialRead_Word64_Delay1024;
-                        load_kernel_dummy_fptr = &dummy_forwSequentialLoop_Word64_Delay256plus;
-                        break;
-                    default:
-                        std::cerr << "ERROR: Failed to find appropriate benchmark kernel." << std::endl;
-                        return false;
-                }
-                break;
-#endif
-#ifdef HAS_WORD_128
-            case CHUNK_128b:
-                switch (delay_) {
-                    case 0:
-                        load_kernel_fptr = &forwSequentialRead_Word128; //not an extended kernel
-                        load_kernel_dummy_fptr = &dummy_forwSequentialLoop_Word128; //not an extended kernel
-                        break;
-                    case 1:
-                        load_kernel_fptr = &forwSequentialRead_Word128_Delay1;
-                        load_kernel_dummy_fptr = &dummy_forwSequentialLoop_Word128_Delay1;
-                        break;
-                    case 2:
-                        load_kernel_fptr = &forwSequentialRead_Word128_Delay2;
-                        load_kernel_dummy_fptr = &dummy_forwSequentialLoop_Word128_Delay2;
-                        break;
-                    case 4:
-                        load_kernel_fptr = &forwSequentialRead_Word128_Delay4;
-                        load_kernel_dummy_fptr = &dummy_forwSequentialLoop_Word128_Delay4;
-                        break;
-                    case 8:
-                        load_kernel_fptr = &forwSequentialRead_Word128_Delay8;
-                        load_kernel_dummy_fptr = &dummy_forwSequentialLoop_Word128_Delay8;
-                        break;
-                    case 16:
-                        load_kernel_fptr = &forwSequentialRead_Word128_Delay16;
-                        load_kernel_dummy_fptr = &dummy_forwSequentialLoop_Word128_Delay16;
-                        break;
-                    case 32:
-                        load_kernel_fptr = &forwSequentialRead_Word128_Delay32;
-                        load_kernel_dummy_fptr = &dummy_forwSequentialLoop_Word128_Delay32;
-                        break;
-                    case 64:
-                        load_kernel_fptr = &forwSequentialRead_Word128_Delay64;
-                        load_kernel_dummy_fptr = &dummy_forwSequentialLoop_Word128_Delay64;
-                        break;
-                    case 128:
-                        load_kernel_fptr = &forwSequentialRead_Word128_Delay128;
-                        load_kernel_dummy_fptr = &dummy_forwSequentialLoop_Word128_Delay128plus;
-                        break;
-                    case 256:
-                        load_kernel_fptr = &forwSequentialRead_Word128_Delay256;
-                        load_kernel_dummy_fptr = &dummy_forwSequentialLoop_Word128_Delay128plus;
-                        break;
-                    case 512:
-                        load_kernel_fptr = &forwSequentialRead_Word128_Delay512;
-                        load_kernel_dummy_fptr = &dummy_forwSequentialLoop_Word128_Delay128plus;
-                        break;
-                    case 1024:
-                        load_kernel_fptr = &forwSequentialRead_Word128_Delay1024;
-                        load_kernel_dummy_fptr = &dummy_forwSequentialLoop_Word128_Delay128plus;
-                        break;
-                    default:
-                        std::cerr << "ERROR: Failed to find appropriate benchmark kernel." << std::endl;
-                        return false;
-                }
-                break;
-#endif
-#ifdef HAS_WORD_256
-            case CHUNK_256b:
-                switch (delay_) {
-                    case 0:
-                        load_kernel_fptr = &forwSequentialRead_Word256; //not an extended kernel
-                        load_kernel_dummy_fptr = &dummy_forwSequentialLoop_Word256; //not an extended kernel
-                        break;
-                    case 1:
-                        load_kernel_fptr = &forwSequentialRead_Word256_Delay1;
-                        load_kernel_dummy_fptr = &dummy_forwSequentialLoop_Word256_Delay1;
-                        break;
-                    case 2:
-                        load_kernel_fptr = &forwSequentialRead_Word256_Delay2;
-                        load_kernel_dummy_fptr = &dummy_forwSequentialLoop_Word256_Delay2;
-                        break;
-                    case 4:
-                        load_kernel_fptr = &forwSequentialRead_Word256_Delay4;
-                        load_kernel_dummy_fptr = &dummy_forwSequentialLoop_Word256_Delay4;
-                        break;
-                    case 8:
-                        load_kernel_fptr = &forwSequentialRead_Word256_Delay8;
-                        load_kernel_dummy_fptr = &dummy_forwSequentialLoop_Word256_Delay8;
-                        break;
-                    case 16:
-                        load_kernel_fptr = &forwSequentialRead_Word256_Delay16;
-                        load_kernel_dummy_fptr = &dummy_forwSequentialLoop_Word256_Delay16;
-                        break;
-                    case 32:
-                        load_kernel_fptr = &forwSequentialRead_Word256_Delay32;
-                        load_kernel_dummy_fptr = &dummy_forwSequentialLoop_Word256_Delay32;
-                        break;
-                    case 64:
-                        load_kernel_fptr = &forwSequentialRead_Word256_Delay64;
-                        load_kernel_dummy_fptr = &dummy_forwSequentialLoop_Word256_Delay64plus;
-                        break;
-                    case 128:
-                        load_kernel_fptr = &forwSequentialRead_Word256_Delay128;
-                        load_kernel_dummy_fptr = &dummy_forwSequentialLoop_Word256_Delay64plus;
-                        break;
-                    case 256:
-                        load_kernel_fptr = &forwSequentialRead_Word256_Delay256;
-                        load_kernel_dummy_fptr = &dummy_forwSequentialLoop_Word256_Delay64plus;
-                        break;
-                    case 512:
-                        load_kernel_fptr = &forwSequentialRead_Word256_Delay512;
-                        load_kernel_dummy_fptr = &dummy_forwSequentialLoop_Word256_Delay64plus;
-                        break;
-                    case 1024:
-                        load_kernel_fptr = &forwSequentialRead_Word256_Delay1024;
-                        load_kernel_dummy_fptr = &dummy_forwSequentialLoop_Word256_Delay64plus;
-                        break;
-                    default:
-                        std::cerr << "ERROR: Failed to find appropriate benchmark kernel." << std::endl;
-                        return false;
-                }
-                break;
-#endif
-            default:
-                std::cerr << "ERROR: Chunk size must be 64-bit or 256-bit to run the delay-injected latency benchmark extension!" << std::endl;
-                return false;
+            }
+        } else {
+            std::cerr << "ERROR: Got an invalid pattern mode." << std::endl;
+            return false;
+        }
+
+        if (!found) {
+            std::cerr << "ERROR: Failed to find appropriate benchmark kernel." << std::endl;
+            return false;
         }
     }
 
@@ -388,12 +197,35 @@ bool DelayInjectedLoadedLatencyBenchmark::runCore() {
                                                     lat_kernel_fptr,
                                                     lat_kernel_dummy_fptr,
                                                     cpu_id));
+            } else if (pattern_mode_ == SEQUENTIAL) {
+                if (delay_ == 0)
+                    workers.push_back(new LoadWorker(threadmem_array_,
+                                                     len_per_thread,
+                                                     load_kernel_fptr_seq,
+                                                     load_kernel_dummy_fptr_seq,
+                                                     cpu_id));
+                else
+                    workers.push_back(new DelayInjectedLoadWorker(threadmem_array_,
+                                                                  len_per_thread,
+                                                                  del_load_kernel_fptr_seq,
+                                                                  del_load_kernel_dummy_fptr_seq,
+                                                                  stride_size_,
+                                                                  delay_,
+                                                                  cpu_id));
             } else {
-                workers.push_back(new LoadWorker(threadmem_array_,
-                                                 len_per_thread,
-                                                 load_kernel_fptr,
-                                                 load_kernel_dummy_fptr,
-                                                 cpu_id));
+                if (delay_ == 0)
+                    workers.push_back(new LoadWorker(threadmem_array_,
+                                                     len_per_thread,
+                                                     load_kernel_fptr_ran,
+                                                     load_kernel_dummy_fptr_ran,
+                                                     cpu_id));
+                else
+                    workers.push_back(new DelayInjectedLoadWorker(threadmem_array_,
+                                                                  len_per_thread,
+                                                                  del_load_kernel_fptr_ran,
+                                                                  del_load_kernel_dummy_fptr_ran,
+                                                                  delay_,
+                                                                  cpu_id));
             }
             worker_threads.push_back(new Thread(workers[t]));
         }
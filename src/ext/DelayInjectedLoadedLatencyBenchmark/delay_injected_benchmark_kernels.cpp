@@ -28,11 +28,9 @@
  * 
  * @brief Implementation file for benchmark kernel functions for the delay-injected loaded latency benchmark.
  *
+ * Unlike the main benchmark kernels, these are not unrolled, because the number of nops between memory accesses is only known at runtime.
+ * The delay is inserted with a simple counted loop, so any delay value may be used, and one kernel per read/write mode and chunk size covers all strides and delays.
  * Optimization tricks include:
- *   - UNROLL macros to manual loop unrolling. This reduces the relative branch overhead of the loop.
- *     We don't want to benchmark loops, we want to benchmark memory! But unrolling too much can hurt
- *     code size and instruction locality, potentially decreasing I-cache utilization and causing extra overheads.
- *     This is why we allow multiple unroll lengths at compile-time.
  *   - volatile keyword to prevent compiler from optimizing the code and removing instructions that we need.
  *     The compiler is too smart for its own good!
  */
@@ -43,794 +41,662 @@
 
 //Libraries
 #include <iostream>
+#if defined(ARCH_INTEL) && (defined(HAS_WORD_128) || defined(HAS_WORD_256))
+//Intel intrinsics
+#include <emmintrin.h>
+#include <immintrin.h>
+#include <smmintrin.h>
+#endif
 
-using namespace xmem;
-
-/***********************************************************************
- ***********************************************************************
- ******************* THROUGHPUT-RELATED BENCHMARK KERNELS **************
- ***********************************************************************
- ***********************************************************************/
-
-/* -------------------- DUMMY BENCHMARK ROUTINES ------------------------- */
-
-int32_t xmem::dummy_forwSequentialLoop_Word32_Delay1(void* start_address, void* end_address) {
-    volatile int32_t placeholder = 0; //Try our best to defeat compiler optimizations
-    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(start_address), *endptr = static_cast<Word32_t*>(end_address); wordptr < endptr;) {
-        UNROLL512(wordptr++;) 
-        placeholder = 0;
-    }
-    return placeholder;
-}
-
-int32_t xmem::dummy_forwSequentialLoop_Word32_Delay2(void* start_address, void* end_address) {
-    volatile int32_t placeholder = 0; //Try our best to defeat compiler optimizations
-    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(start_address), *endptr = static_cast<Word32_t*>(end_address); wordptr < endptr;) {
-        UNROLL256(wordptr++;) 
-        placeholder = 0;
-    }
-    return placeholder;
-}
-
-int32_t xmem::dummy_forwSequentialLoop_Word32_Delay4(void* start_address, void* end_address) {
-    volatile int32_t placeholder = 0; //Try our best to defeat compiler optimizations
-    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(start_address), *endptr = static_cast<Word32_t*>(end_address); wordptr < endptr;) {
-        UNROLL128(wordptr++;) 
-        placeholder = 0;
-    }
-    return placeholder;
-}
-
-int32_t xmem::dummy_forwSequentialLoop_Word32_Delay8(void* start_address, void* end_address) {
-    volatile int32_t placeholder = 0; //Try our best to defeat compiler optimizations
-    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(start_address), *endptr = static_cast<Word32_t*>(end_address); wordptr < endptr;) {
-        UNROLL64(wordptr++;) 
-        placeholder = 0;
-    }
-    return placeholder;
-}
+#if defined(ARCH_ARM) && defined(ARCH_ARM_NEON)
+#include <arm_neon.h>
+#endif
 
-int32_t xmem::dummy_forwSequentialLoop_Word32_Delay16(void* start_address, void* end_address) {
-    volatile int32_t placeholder = 0; //Try our best to defeat compiler optimizations
-    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(start_address), *endptr = static_cast<Word32_t*>(end_address); wordptr < endptr;) {
-        UNROLL32(wordptr++;) 
-        placeholder = 0;
-    }
-    return placeholder;
-}
+using namespace xmem;
 
-int32_t xmem::dummy_forwSequentialLoop_Word32_Delay32(void* start_address, void* end_address) {
-    volatile int32_t placeholder = 0; //Try our best to defeat compiler optimizations
-    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(start_address), *endptr = static_cast<Word32_t*>(end_address); wordptr < endptr;) {
-        UNROLL16(wordptr++;) 
-        placeholder = 0;
-    }
-    return placeholder;
-}
+#if defined(__gnu_linux__) && defined(ARCH_INTEL)
 
-int32_t xmem::dummy_forwSequentialLoop_Word32_Delay64(void* start_address, void* end_address) {
-    volatile int32_t placeholder = 0; //Try our best to defeat compiler optimizations
-    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(start_address), *endptr = static_cast<Word32_t*>(end_address); wordptr < endptr;) {
-        UNROLL8(wordptr++;) 
-        placeholder = 0;
-    }
-    return placeholder;
-}
+#ifdef HAS_WORD_128
+#define my_64b_set_128b_word(a, b) _mm_set_epi64x(a, b) //SSE2 intrinsic, corresponds to ??? instruction. Header: emmintrin.h
+#define my_32b_extractLSB_128b(w) _mm_extract_epi32(w, 0) //SSE 4.1 intrinsic, corresponds to "pextrd" instruction. Header: smmintrin.h
+#define my_64b_extractLSB_128b(w) _mm_extract_epi64(w, 0) //SSE 4.1 intrinsic, corresponds to "pextrq" instruction. Header: smmintrin.h
+#endif
 
-int32_t xmem::dummy_forwSequentialLoop_Word32_Delay128(void* start_address, void* end_address) {
-    volatile int32_t placeholder = 0; //Try our best to defeat compiler optimizations
-    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(start_address), *endptr = static_cast<Word32_t*>(end_address); wordptr < endptr;) {
-        UNROLL4(wordptr++;) 
-        placeholder = 0;
-    }
-    return placeholder;
-}
+#ifdef HAS_WORD_256
+#define my_64b_set_256b_word(a, b, c, d) _mm256_set_epi64x(a, b, c, d) //AVX intrinsic, corresponds to ??? (pseudo?) instruction. Header: immintrin.h
+#define my_32b_extractLSB_256b(w) _mm256_extract_epi32(w, 0) //AVX intrinsic, corresponds to ??? (pseudo?) instruction. Header: immintrin.h
+#define my_64b_extractLSB_256b(w) _mm256_extract_epi64(w, 0) //AVX intrinsic, corresponds to ??? (pseudo?) instruction. Header: immintrin.h
+#endif
 
-int32_t xmem::dummy_forwSequentialLoop_Word32_Delay256(void* start_address, void* end_address) {
-    volatile int32_t placeholder = 0; //Try our best to defeat compiler optimizations
-    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(start_address), *endptr = static_cast<Word32_t*>(end_address); wordptr < endptr;) {
-        UNROLL2(wordptr++;)
-        placeholder = 0;
-    }
-    return placeholder;
-}
+#endif
 
-int32_t xmem::dummy_forwSequentialLoop_Word32_Delay512plus(void* start_address, void* end_address) {
-    volatile int32_t placeholder = 0; //Try our best to defeat compiler optimizations
-    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(start_address), *endptr = static_cast<Word32_t*>(end_address); wordptr < endptr;) {
-        wordptr++;
-        placeholder = 0;
-    }
-    return placeholder;
-}
+#if defined(ARCH_ARM) && (defined(ARCH_ARM_NEON) || defined(HAS_WORD_128))
+#define my_64b_set_128b_word(a, b) vcombine_u64(a, b)
+#define my_32b_extractLSB_128b(w) static_cast<uint32_t>(vget_low_u64(w)) //NEON intrinsic, corresponds to "vmov" instruction. Header: arm_neon.h
+#define my_64b_extractLSB_128b(w) vget_low_u64(w) //NEON intrinsic, corresponds to "vmov" instruction. Header: arm_neon.h
+#endif
 
+bool xmem::determine_delay_injected_sequential_kernel(rw_mode_t rw_mode, chunk_size_t chunk_size, DelayInjectedSequentialFunction* kernel_function, DelayInjectedSequentialFunction* dummy_kernel_function) {
+    switch (rw_mode) {
+        case READ:
+            switch (chunk_size) {
+                case CHUNK_32b:
+                    *kernel_function = &stridedRead_Word32_Delay;
+                    *dummy_kernel_function = &dummy_stridedLoop_Word32_Delay;
+                    return true;
 #ifdef HAS_WORD_64
-int32_t xmem::dummy_forwSequentialLoop_Word64_Delay1(void* start_address, void* end_address) {
-    volatile int32_t placeholder = 0; //Try our best to defeat compiler optimizations
-    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(start_address), *endptr = static_cast<Word64_t*>(end_address); wordptr < endptr;) {
-        UNROLL256(wordptr++;) 
-        placeholder = 0;
-    }
-    return placeholder;
-}
-
-int32_t xmem::dummy_forwSequentialLoop_Word64_Delay2(void* start_address, void* end_address) {
-    volatile int32_t placeholder = 0; //Try our best to defeat compiler optimizations
-    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(start_address), *endptr = static_cast<Word64_t*>(end_address); wordptr < endptr;) {
-        UNROLL128(wordptr++;) 
-        placeholder = 0;
-    }
-    return placeholder;
-}
-
-int32_t xmem::dummy_forwSequentialLoop_Word64_Delay4(void* start_address, void* end_address) {
-    volatile int32_t placeholder = 0; //Try our best to defeat compiler optimizations
-    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(start_address), *endptr = static_cast<Word64_t*>(end_address); wordptr < endptr;) {
-        UNROLL64(wordptr++;) 
-        placeholder = 0;
-    }
-    return placeholder;
-}
-
-int32_t xmem::dummy_forwSequentialLoop_Word64_Delay8(void* start_address, void* end_address) {
-    volatile int32_t placeholder = 0; //Try our best to defeat compiler optimizations
-    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(start_address), *endptr = static_cast<Word64_t*>(end_address); wordptr < endptr;) {
-        UNROLL32(wordptr++;) 
-        placeholder = 0;
-    }
-    return placeholder;
-}
-
-int32_t xmem::dummy_forwSequentialLoop_Word64_Delay16(void* start_address, void* end_address) {
-    volatile int32_t placeholder = 0; //Try our best to defeat compiler optimizations
-    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(start_address), *endptr = static_cast<Word64_t*>(end_address); wordptr < endptr;) {
-        UNROLL16(wordptr++;) 
-        placeholder = 0;
-    }
-    return placeholder;
-}
-
-int32_t xmem::dummy_forwSequentialLoop_Word64_Delay32(void* start_address, void* end_address) {
-    volatile int32_t placeholder = 0; //Try our best to defeat compiler optimizations
-    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(start_address), *endptr = static_cast<Word64_t*>(end_address); wordptr < endptr;) {
-        UNROLL8(wordptr++;) 
-        placeholder = 0;
-    }
-    return placeholder;
-}
-
-int32_t xmem::dummy_forwSequentialLoop_Word64_Delay64(void* start_address, void* end_address) {
-    volatile int32_t placeholder = 0; //Try our best to defeat compiler optimizations
-    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(start_address), *endptr = static_cast<Word64_t*>(end_address); wordptr < endptr;) {
-        UNROLL4(wordptr++;) 
-        placeholder = 0;
-    }
-    return placeholder;
-}
-
-int32_t xmem::dummy_forwSequentialLoop_Word64_Delay128(void* start_address, void* end_address) {
-    volatile int32_t placeholder = 0; //Try our best to defeat compiler optimizations
-    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(start_address), *endptr = static_cast<Word64_t*>(end_address); wordptr < endptr;) {
-        UNROLL2(wordptr++;) 
-        placeholder = 0;
-    }
-    return placeholder;
-}
-
-int32_t xmem::dummy_forwSequentialLoop_Word64_Delay256plus(void* start_address, void* end_address) {
-    volatile int32_t placeholder = 0; //Try our best to defeat compiler optimizations
-    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(start_address), *endptr = static_cast<Word64_t*>(end_address); wordptr < endptr;) {
-        wordptr++;
-        placeholder = 0;
-    }
-    return placeholder;
-}
+                case CHUNK_64b:
+                    *kernel_function = &stridedRead_Word64_Delay;
+                    *dummy_kernel_function = &dummy_stridedLoop_Word64_Delay;
+                    return true;
 #endif
-
 #ifdef HAS_WORD_128
-int32_t xmem::dummy_forwSequentialLoop_Word128_Delay1(void* start_address, void* end_address) {
-    volatile int32_t placeholder = 0; //Try our best to defeat compiler optimizations
-    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(start_address), *endptr = static_cast<Word128_t*>(end_address); wordptr < endptr;) {
-        UNROLL128(wordptr++;) 
-        placeholder = 0;
-    }
-    return placeholder;
-}
-
-int32_t xmem::dummy_forwSequentialLoop_Word128_Delay2(void* start_address, void* end_address) {
-    volatile int32_t placeholder = 0; //Try our best to defeat compiler optimizations
-    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(start_address), *endptr = static_cast<Word128_t*>(end_address); wordptr < endptr;) {
-        UNROLL64(wordptr++;) 
-        placeholder = 0;
-    }
-    return placeholder;
-}
-
-int32_t xmem::dummy_forwSequentialLoop_Word128_Delay4(void* start_address, void* end_address) {
-    volatile int32_t placeholder = 0; //Try our best to defeat compiler optimizations
-    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(start_address), *endptr = static_cast<Word128_t*>(end_address); wordptr < endptr;) {
-        UNROLL32(wordptr++;) 
-        placeholder = 0;
-    }
-    return placeholder;
-}
-
-int32_t xmem::dummy_forwSequentialLoop_Word128_Delay8(void* start_address, void* end_address) {
-    volatile int32_t placeholder = 0; //Try our best to defeat compiler optimizations
-    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(start_address), *endptr = static_cast<Word128_t*>(end_address); wordptr < endptr;) {
-        UNROLL16(wordptr++;) 
-        placeholder = 0;
-    }
-    return placeholder;
-}
-
-int32_t xmem::dummy_forwSequentialLoop_Word128_Delay16(void* start_address, void* end_address) {
-    volatile int32_t placeholder = 0; //Try our best to defeat compiler optimizations
-    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(start_address), *endptr = static_cast<Word128_t*>(end_address); wordptr < endptr;) {
-        UNROLL8(wordptr++;) 
-        placeholder = 0;
-    }
-    return placeholder;
-}
-
-int32_t xmem::dummy_forwSequentialLoop_Word128_Delay32(void* start_address, void* end_address) {
-    volatile int32_t placeholder = 0; //Try our best to defeat compiler optimizations
-    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(start_address), *endptr = static_cast<Word128_t*>(end_address); wordptr < endptr;) {
-        UNROLL4(wordptr++;) 
-        placeholder = 0;
-    }
-    return placeholder;
-}
-
-int32_t xmem::dummy_forwSequentialLoop_Word128_Delay64(void* start_address, void* end_address) {
-    volatile int32_t placeholder = 0; //Try our best to defeat compiler optimizations
-    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(start_address), *endptr = static_cast<Word128_t*>(end_address); wordptr < endptr;) {
-        UNROLL2(wordptr++;)
-        placeholder = 0;
-    }
-    return placeholder;
-}
-
-int32_t xmem::dummy_forwSequentialLoop_Word128_Delay128plus(void* start_address, void* end_address) {
-    volatile int32_t placeholder = 0; //Try our best to defeat compiler optimizations
-    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(start_address), *endptr = static_cast<Word128_t*>(end_address); wordptr < endptr;) {
-        wordptr++;
-        placeholder = 0;
-    }
-    return placeholder;
-}
+                case CHUNK_128b:
+                    *kernel_function = &stridedRead_Word128_Delay;
+                    *dummy_kernel_function = &dummy_stridedLoop_Word128_Delay;
+                    return true;
 #endif
-
 #ifdef HAS_WORD_256
-int32_t xmem::dummy_forwSequentialLoop_Word256_Delay1(void* start_address, void* end_address) {
-    volatile int32_t placeholder = 0; //Try our best to defeat compiler optimizations
-    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(start_address), *endptr = static_cast<Word256_t*>(end_address); wordptr < endptr;) {
-        UNROLL64(wordptr++;) 
-        placeholder = 0;
+                case CHUNK_256b:
+                    *kernel_function = &stridedRead_Word256_Delay;
+                    *dummy_kernel_function = &dummy_stridedLoop_Word256_Delay;
+                    return true;
+#endif
+                default:
+                    return false;
+            }
+
+        case WRITE:
+            switch (chunk_size) {
+                case CHUNK_32b:
+                    *kernel_function = &stridedWrite_Word32_Delay;
+                    *dummy_kernel_function = &dummy_stridedLoop_Word32_Delay;
+                    return true;
+#ifdef HAS_WORD_64
+                case CHUNK_64b:
+                    *kernel_function = &stridedWrite_Word64_Delay;
+                    *dummy_kernel_function = &dummy_stridedLoop_Word64_Delay;
+                    return true;
+#endif
+#ifdef HAS_WORD_128
+                case CHUNK_128b:
+                    *kernel_function = &stridedWrite_Word128_Delay;
+                    *dummy_kernel_function = &dummy_stridedLoop_Word128_Delay;
+                    return true;
+#endif
+#ifdef HAS_WORD_256
+                case CHUNK_256b:
+                    *kernel_function = &stridedWrite_Word256_Delay;
+                    *dummy_kernel_function = &dummy_stridedLoop_Word256_Delay;
+                    return true;
+#endif
+                default:
+                    return false;
+            }
+        default:
+            return false;
+    }
+}
+
+bool xmem::determine_delay_injected_random_kernel(rw_mode_t rw_mode, chunk_size_t chunk_size, DelayInjectedRandomFunction* kernel_function, DelayInjectedRandomFunction* dummy_kernel_function) {
+    switch (rw_mode) {
+        case READ:
+            switch (chunk_size) {
+                //special case on 32-bit architectures only.
+#ifndef HAS_WORD_64
+                case CHUNK_32b:
+                    *kernel_function = &randomRead_Word32_Delay;
+                    *dummy_kernel_function = &dummy_randomLoop_Word32_Delay;
+                    return true;
+#endif
+#ifdef HAS_WORD_64
+                case CHUNK_64b:
+                    *kernel_function = &randomRead_Word64_Delay;
+                    *dummy_kernel_function = &dummy_randomLoop_Word64_Delay;
+                    return true;
+#endif
+#ifdef HAS_WORD_128
+                case CHUNK_128b:
+                    *kernel_function = &randomRead_Word128_Delay;
+                    *dummy_kernel_function = &dummy_randomLoop_Word128_Delay;
+                    return true;
+#endif
+#ifdef HAS_WORD_256
+                case CHUNK_256b:
+                    *kernel_function = &randomRead_Word256_Delay;
+                    *dummy_kernel_function = &dummy_randomLoop_Word256_Delay;
+                    return true;
+#endif
+                default:
+                    return false;
+            }
+
+        case WRITE:
+            switch (chunk_size) {
+                //special case on 32-bit architectures only.
+#ifndef HAS_WORD_64
+                case CHUNK_32b:
+                    *kernel_function = &randomWrite_Word32_Delay;
+                    *dummy_kernel_function = &dummy_randomLoop_Word32_Delay;
+                    return true;
+#endif
+#ifdef HAS_WORD_64
+                case CHUNK_64b:
+                    *kernel_function = &randomWrite_Word64_Delay;
+                    *dummy_kernel_function = &dummy_randomLoop_Word64_Delay;
+                    return true;
+#endif
+#ifdef HAS_WORD_128
+                case CHUNK_128b:
+                    *kernel_function = &randomWrite_Word128_Delay;
+                    *dummy_kernel_function = &dummy_randomLoop_Word128_Delay;
+                    return true;
+#endif
+#ifdef HAS_WORD_256
+                case CHUNK_256b:
+                    *kernel_function = &randomWrite_Word256_Delay;
+                    *dummy_kernel_function = &dummy_randomLoop_Word256_Delay;
+                    return true;
+#endif
+                default:
+                    return false;
+            }
+        default:
+            return false;
     }
-    return placeholder;
 }
 
-int32_t xmem::dummy_forwSequentialLoop_Word256_Delay2(void* start_address, void* end_address) {
-    volatile int32_t placeholder = 0; //Try our best to defeat compiler optimizations
-    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(start_address), *endptr = static_cast<Word256_t*>(end_address); wordptr < endptr;) {
-        UNROLL32(wordptr++;) 
-        placeholder = 0;
-    }
-    return placeholder;
-}
+/***********************************************************************
+ ***********************************************************************
+ ******************* THROUGHPUT-RELATED BENCHMARK KERNELS **************
+ ***********************************************************************
+ ***********************************************************************/
 
-int32_t xmem::dummy_forwSequentialLoop_Word256_Delay4(void* start_address, void* end_address) {
-    volatile int32_t placeholder = 0; //Try our best to defeat compiler optimizations
-    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(start_address), *endptr = static_cast<Word256_t*>(end_address); wordptr < endptr;) {
-        UNROLL16(wordptr++;) 
-        placeholder = 0;
-    }
-    return placeholder;
-}
+/* -------------------- DUMMY BENCHMARK ROUTINES ------------------------- */
 
-int32_t xmem::dummy_forwSequentialLoop_Word256_Delay8(void* start_address, void* end_address) {
+int32_t xmem::dummy_stridedLoop_Word32_Delay(void* start_address, void* end_address, int32_t stride_size, uint32_t delay) {
     volatile int32_t placeholder = 0; //Try our best to defeat compiler optimizations
-    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(start_address), *endptr = static_cast<Word256_t*>(end_address); wordptr < endptr;) {
-        UNROLL8(wordptr++;) 
+    register size_t len = static_cast<size_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word32_t);
+    volatile Word32_t* startptr = static_cast<Word32_t*>(start_address);
+    volatile Word32_t* endptr = static_cast<Word32_t*>(end_address);
+    volatile Word32_t* wordptr = (stride_size > 0) ? startptr : endptr-1; //reverse strides start at the end
+    for (register size_t i = 0; i < len; i++) {
         placeholder = 0;
+        wordptr += stride_size;
+        if (wordptr >= endptr) //end, modulo
+            wordptr -= len;
+        else if (wordptr < startptr) //beginning, modulo
+            wordptr += len;
     }
     return placeholder;
 }
 
-int32_t xmem::dummy_forwSequentialLoop_Word256_Delay16(void* start_address, void* end_address) {
+#ifdef HAS_WORD_64
+int32_t xmem::dummy_stridedLoop_Word64_Delay(void* start_address, void* end_address, int32_t stride_size, uint32_t delay) {
     volatile int32_t placeholder = 0; //Try our best to defeat compiler optimizations
-    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(start_address), *endptr = static_cast<Word256_t*>(end_address); wordptr < endptr;) {
-        UNROLL4(wordptr++;) 
+    register size_t len = static_cast<size_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word64_t);
+    volatile Word64_t* startptr = static_cast<Word64_t*>(start_address);
+    volatile Word64_t* endptr = static_cast<Word64_t*>(end_address);
+    volatile Word64_t* wordptr = (stride_size > 0) ? startptr : endptr-1; //reverse strides start at the end
+    for (register size_t i = 0; i < len; i++) {
         placeholder = 0;
+        wordptr += stride_size;
+        if (wordptr >= endptr) //end, modulo
+            wordptr -= len;
+        else if (wordptr < startptr) //beginning, modulo
+            wordptr += len;
     }
     return placeholder;
 }
+#endif
 
-int32_t xmem::dummy_forwSequentialLoop_Word256_Delay32(void* start_address, void* end_address) {
+#ifdef HAS_WORD_128
+int32_t xmem::dummy_stridedLoop_Word128_Delay(void* start_address, void* end_address, int32_t stride_size, uint32_t delay) {
+#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
+    return 0; //TODO: Not yet implemented for Windows.
+#else
     volatile int32_t placeholder = 0; //Try our best to defeat compiler optimizations
-    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(start_address), *endptr = static_cast<Word256_t*>(end_address); wordptr < endptr;) {
-        UNROLL2(wordptr++;) 
+    register size_t len = static_cast<size_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word128_t);
+    volatile Word128_t* startptr = static_cast<Word128_t*>(start_address);
+    volatile Word128_t* endptr = static_cast<Word128_t*>(end_address);
+    volatile Word128_t* wordptr = (stride_size > 0) ? startptr : endptr-1; //reverse strides start at the end
+    for (register size_t i = 0; i < len; i++) {
         placeholder = 0;
+        wordptr += stride_size;
+        if (wordptr >= endptr) //end, modulo
+            wordptr -= len;
+        else if (wordptr < startptr) //beginning, modulo
+            wordptr += len;
     }
     return placeholder;
+#endif
 }
+#endif
 
-int32_t xmem::dummy_forwSequentialLoop_Word256_Delay64plus(void* start_address, void* end_address) {
+#ifdef HAS_WORD_256
+int32_t xmem::dummy_stridedLoop_Word256_Delay(void* start_address, void* end_address, int32_t stride_size, uint32_t delay) {
+#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
+    return 0; //TODO: Not yet implemented for Windows.
+#else
     volatile int32_t placeholder = 0; //Try our best to defeat compiler optimizations
-    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(start_address), *endptr = static_cast<Word256_t*>(end_address); wordptr < endptr;) {
-        wordptr++;
+    register size_t len = static_cast<size_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word256_t);
+    volatile Word256_t* startptr = static_cast<Word256_t*>(start_address);
+    volatile Word256_t* endptr = static_cast<Word256_t*>(end_address);
+    volatile Word256_t* wordptr = (stride_size > 0) ? startptr : endptr-1; //reverse strides start at the end
+    for (register size_t i = 0; i < len; i++) {
         placeholder = 0;
+        wordptr += stride_size;
+        if (wordptr >= endptr) //end, modulo
+            wordptr -= len;
+        else if (wordptr < startptr) //beginning, modulo
+            wordptr += len;
     }
     return placeholder;
-}
 #endif
-
-/* -------------------- CORE BENCHMARK ROUTINES -------------------------- */
-
-int32_t xmem::forwSequentialRead_Word32_Delay1(void* start_address, void* end_address) {
-    register Word32_t val;
-    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(start_address), *endptr = static_cast<Word32_t*>(end_address); wordptr < endptr;) {
-        UNROLL512(val = *wordptr++; my_nop();)
-    }
-    return 0;
 }
+#endif
 
-int32_t xmem::forwSequentialRead_Word32_Delay2(void* start_address, void* end_address) {
-    register Word32_t val;
-    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(start_address), *endptr = static_cast<Word32_t*>(end_address); wordptr < endptr;) {
-        UNROLL256(val = *wordptr++; my_nop2();)
-    }
+#ifndef HAS_WORD_64 //special case: 32-bit architectures
+int32_t xmem::dummy_randomLoop_Word32_Delay(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len, uint32_t delay) {
+    volatile uintptr_t* placeholder = NULL; //Try our best to defeat compiler optimizations
+    for (register size_t i = 0; i < len / sizeof(Word32_t); i++)
+        placeholder = NULL;
     return 0;
 }
+#endif
 
-int32_t xmem::forwSequentialRead_Word32_Delay4(void* start_address, void* end_address) {
-    register Word32_t val;
-    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(start_address), *endptr = static_cast<Word32_t*>(end_address); wordptr < endptr;) {
-        UNROLL128(val = *wordptr++; my_nop4();)
-    }
+#ifdef HAS_WORD_64
+int32_t xmem::dummy_randomLoop_Word64_Delay(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len, uint32_t delay) {
+    volatile uintptr_t* placeholder = NULL; //Try our best to defeat compiler optimizations
+    for (register size_t i = 0; i < len / sizeof(Word64_t); i++)
+        placeholder = NULL;
     return 0;
 }
+#endif
 
-int32_t xmem::forwSequentialRead_Word32_Delay8(void* start_address, void* end_address) {
-    register Word32_t val;
-    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(start_address), *endptr = static_cast<Word32_t*>(end_address); wordptr < endptr;) {
-        UNROLL64(val = *wordptr++; my_nop8();)
+#ifdef HAS_WORD_128
+int32_t xmem::dummy_randomLoop_Word128_Delay(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len, uint32_t delay) {
+#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
+    return 0; //TODO: Not yet implemented for Windows.
+#else
+    volatile uintptr_t val_extract; //Try our best to defeat compiler optimizations
+    register Word128_t val;
+    val = my_64b_set_128b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF);
+    for (register size_t i = 0; i < len / sizeof(Word128_t); i++) {
+#ifdef HAS_WORD_64
+        val_extract = my_64b_extractLSB_128b(val); //Extract 64 LSB.
+#else //special case: 32-bit machines
+        val_extract = my_32b_extractLSB_128b(val); //Extract 32 LSB.
+#endif
     }
     return 0;
+#endif
 }
+#endif
 
-int32_t xmem::forwSequentialRead_Word32_Delay16(void* start_address, void* end_address) {
-    register Word32_t val;
-    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(start_address), *endptr = static_cast<Word32_t*>(end_address); wordptr < endptr;) {
-        UNROLL32(val = *wordptr++; my_nop16();)
+#ifdef HAS_WORD_256
+int32_t xmem::dummy_randomLoop_Word256_Delay(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len, uint32_t delay) {
+#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
+    return 0; //TODO: Not yet implemented for Windows.
+#else
+    volatile uintptr_t val_extract; //Try our best to defeat compiler optimizations
+    register Word256_t val;
+    val = my_64b_set_256b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF);
+    for (register size_t i = 0; i < len / sizeof(Word256_t); i++) {
+#ifdef HAS_WORD_64
+        val_extract = my_64b_extractLSB_256b(val); //Extract 64 LSB.
+#else //special case: 32-bit machines
+        val_extract = my_32b_extractLSB_256b(val); //Extract 32 LSB.
+#endif
     }
     return 0;
+#endif
 }
+#endif
 
-int32_t xmem::forwSequentialRead_Word32_Delay32(void* start_address, void* end_address) {
-    register Word32_t val;
-    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(start_address), *endptr = static_cast<Word32_t*>(end_address); wordptr < endptr;) {
-        UNROLL16(val = *wordptr++; my_nop32();)
-    }
-    return 0;
-}
+/* -------------------- CORE BENCHMARK ROUTINES -------------------------- */
 
-int32_t xmem::forwSequentialRead_Word32_Delay64(void* start_address, void* end_address) {
+int32_t xmem::stridedRead_Word32_Delay(void* start_address, void* end_address, int32_t stride_size, uint32_t delay) {
     register Word32_t val;
-    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(start_address), *endptr = static_cast<Word32_t*>(end_address); wordptr < endptr;) {
-        UNROLL8(val = *wordptr++; my_nop64();)
+    register size_t len = static_cast<size_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word32_t);
+    volatile Word32_t* startptr = static_cast<Word32_t*>(start_address);
+    volatile Word32_t* endptr = static_cast<Word32_t*>(end_address);
+    volatile Word32_t* wordptr = (stride_size > 0) ? startptr : endptr-1; //reverse strides start at the end
+    for (register size_t i = 0; i < len; i++) {
+        val = *wordptr;
+        for (register uint32_t d = 0; d < delay; d++)
+            my_nop();
+        wordptr += stride_size;
+        if (wordptr >= endptr) //end, modulo
+            wordptr -= len;
+        else if (wordptr < startptr) //beginning, modulo
+            wordptr += len;
     }
     return 0;
 }
 
-int32_t xmem::forwSequentialRead_Word32_Delay128(void* start_address, void* end_address) {
-    register Word32_t val;
-    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(start_address), *endptr = static_cast<Word32_t*>(end_address); wordptr < endptr;) {
-        UNROLL4(val = *wordptr++; my_nop128();)
+#ifdef HAS_WORD_64
+int32_t xmem::stridedRead_Word64_Delay(void* start_address, void* end_address, int32_t stride_size, uint32_t delay) {
+    register Word64_t val;
+    register size_t len = static_cast<size_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word64_t);
+    volatile Word64_t* startptr = static_cast<Word64_t*>(start_address);
+    volatile Word64_t* endptr = static_cast<Word64_t*>(end_address);
+    volatile Word64_t* wordptr = (stride_size > 0) ? startptr : endptr-1; //reverse strides start at the end
+    for (register size_t i = 0; i < len; i++) {
+        val = *wordptr;
+        for (register uint32_t d = 0; d < delay; d++)
+            my_nop();
+        wordptr += stride_size;
+        if (wordptr >= endptr) //end, modulo
+            wordptr -= len;
+        else if (wordptr < startptr) //beginning, modulo
+            wordptr += len;
     }
     return 0;
 }
+#endif
 
-int32_t xmem::forwSequentialRead_Word32_Delay256(void* start_address, void* end_address) {
-    register Word32_t val;
-    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(start_address), *endptr = static_cast<Word32_t*>(end_address); wordptr < endptr;) {
-        UNROLL2(val = *wordptr++; my_nop256();)
+#ifdef HAS_WORD_128
+int32_t xmem::stridedRead_Word128_Delay(void* start_address, void* end_address, int32_t stride_size, uint32_t delay) {
+#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
+    return 0; //TODO: Not yet implemented for Windows.
+#else
+    register Word128_t val;
+    register size_t len = static_cast<size_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word128_t);
+    volatile Word128_t* startptr = static_cast<Word128_t*>(start_address);
+    volatile Word128_t* endptr = static_cast<Word128_t*>(end_address);
+    volatile Word128_t* wordptr = (stride_size > 0) ? startptr : endptr-1; //reverse strides start at the end
+    for (register size_t i = 0; i < len; i++) {
+        val = *wordptr;
+        for (register uint32_t d = 0; d < delay; d++)
+            my_nop();
+        wordptr += stride_size;
+        if (wordptr >= endptr) //end, modulo
+            wordptr -= len;
+        else if (wordptr < startptr) //beginning, modulo
+            wordptr += len;
     }
     return 0;
+#endif
 }
+#endif
 
-int32_t xmem::forwSequentialRead_Word32_Delay512(void* start_address, void* end_address) {
-    register Word32_t val;
-    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(start_address), *endptr = static_cast<Word32_t*>(end_address); wordptr < endptr;) {
-        val = *wordptr++; my_nop512();
+#ifdef HAS_WORD_256
+int32_t xmem::stridedRead_Word256_Delay(void* start_address, void* end_address, int32_t stride_size, uint32_t delay) {
+#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
+    return 0; //TODO: Not yet implemented for Windows.
+#else
+    register Word256_t val;
+    register size_t len = static_cast<size_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word256_t);
+    volatile Word256_t* startptr = static_cast<Word256_t*>(start_address);
+    volatile Word256_t* endptr = static_cast<Word256_t*>(end_address);
+    volatile Word256_t* wordptr = (stride_size > 0) ? startptr : endptr-1; //reverse strides start at the end
+    for (register size_t i = 0; i < len; i++) {
+        val = *wordptr;
+        for (register uint32_t d = 0; d < delay; d++)
+            my_nop();
+        wordptr += stride_size;
+        if (wordptr >= endptr) //end, modulo
+            wordptr -= len;
+        else if (wordptr < startptr) //beginning, modulo
+            wordptr += len;
     }
     return 0;
+#endif
 }
+#endif
 
-int32_t xmem::forwSequentialRead_Word32_Delay1024(void* start_address, void* end_address) {
+int32_t xmem::stridedWrite_Word32_Delay(void* start_address, void* end_address, int32_t stride_size, uint32_t delay) {
     register Word32_t val;
-    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(start_address), *endptr = static_cast<Word32_t*>(end_address); wordptr < endptr;) {
-        val = *wordptr++; my_nop1024();
+    val = 0xFFFFFFFF;
+    register size_t len = static_cast<size_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word32_t);
+    volatile Word32_t* startptr = static_cast<Word32_t*>(start_address);
+    volatile Word32_t* endptr = static_cast<Word32_t*>(end_address);
+    volatile Word32_t* wordptr = (stride_size > 0) ? startptr : endptr-1; //reverse strides start at the end
+    for (register size_t i = 0; i < len; i++) {
+        *wordptr = val;
+        for (register uint32_t d = 0; d < delay; d++)
+            my_nop();
+        wordptr += stride_size;
+        if (wordptr >= endptr) //end, modulo
+            wordptr -= len;
+        else if (wordptr < startptr) //beginning, modulo
+            wordptr += len;
     }
     return 0;
 }
 
 #ifdef HAS_WORD_64
-int32_t xmem::forwSequentialRead_Word64_Delay1(void* start_address, void* end_address) {
-    register Word64_t val;
-    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(start_address), *endptr = static_cast<Word64_t*>(end_address); wordptr < endptr;) {
-        UNROLL256(val = *wordptr++; my_nop();)
-    }
-    return 0;
-}
-
-int32_t xmem::forwSequentialRead_Word64_Delay2(void* start_address, void* end_address) {
-    register Word64_t val;
-    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(start_address), *endptr = static_cast<Word64_t*>(end_address); wordptr < endptr;) {
-        UNROLL128(val = *wordptr++; my_nop2();)
-    }
-    return 0;
-}
-
-int32_t xmem::forwSequentialRead_Word64_Delay4(void* start_address, void* end_address) {
+int32_t xmem::stridedWrite_Word64_Delay(void* start_address, void* end_address, int32_t stride_size, uint32_t delay) {
     register Word64_t val;
-    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(start_address), *endptr = static_cast<Word64_t*>(end_address); wordptr < endptr;) {
-        UNROLL64(val = *wordptr++; my_nop4();)
+    val = 0xFFFFFFFFFFFFFFFF;
+    register size_t len = static_cast<size_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word64_t);
+    volatile Word64_t* startptr = static_cast<Word64_t*>(start_address);
+    volatile Word64_t* endptr = static_cast<Word64_t*>(end_address);
+    volatile Word64_t* wordptr = (stride_size > 0) ? startptr : endptr-1; //reverse strides start at the end
+    for (register size_t i = 0; i < len; i++) {
+        *wordptr = val;
+        for (register uint32_t d = 0; d < delay; d++)
+            my_nop();
+        wordptr += stride_size;
+        if (wordptr >= endptr) //end, modulo
+            wordptr -= len;
+        else if (wordptr < startptr) //beginning, modulo
+            wordptr += len;
     }
     return 0;
 }
+#endif
 
-int32_t xmem::forwSequentialRead_Word64_Delay8(void* start_address, void* end_address) {
-    register Word64_t val;
-    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(start_address), *endptr = static_cast<Word64_t*>(end_address); wordptr < endptr;) {
-        UNROLL32(val = *wordptr++; my_nop8();)
+#ifdef HAS_WORD_128
+int32_t xmem::stridedWrite_Word128_Delay(void* start_address, void* end_address, int32_t stride_size, uint32_t delay) {
+#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
+    return 0; //TODO: Not yet implemented for Windows.
+#else
+    register Word128_t val;
+    val = my_64b_set_128b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF);
+    register size_t len = static_cast<size_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word128_t);
+    volatile Word128_t* startptr = static_cast<Word128_t*>(start_address);
+    volatile Word128_t* endptr = static_cast<Word128_t*>(end_address);
+    volatile Word128_t* wordptr = (stride_size > 0) ? startptr : endptr-1; //reverse strides start at the end
+    for (register size_t i = 0; i < len; i++) {
+        *wordptr = val;
+        for (register uint32_t d = 0; d < delay; d++)
+            my_nop();
+        wordptr += stride_size;
+        if (wordptr >= endptr) //end, modulo
+            wordptr -= len;
+        else if (wordptr < startptr) //beginning, modulo
+            wordptr += len;
     }
     return 0;
+#endif
 }
+#endif
 
-int32_t xmem::forwSequentialRead_Word64_Delay16(void* start_address, void* end_address) {
-    register Word64_t val;
-    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(start_address), *endptr = static_cast<Word64_t*>(end_address); wordptr < endptr;) {
-        UNROLL16(val = *wordptr++; my_nop16();)
+#ifdef HAS_WORD_256
+int32_t xmem::stridedWrite_Word256_Delay(void* start_address, void* end_address, int32_t stride_size, uint32_t delay) {
+#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
+    return 0; //TODO: Not yet implemented for Windows.
+#else
+    register Word256_t val;
+    val = my_64b_set_256b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF);
+    register size_t len = static_cast<size_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word256_t);
+    volatile Word256_t* startptr = static_cast<Word256_t*>(start_address);
+    volatile Word256_t* endptr = static_cast<Word256_t*>(end_address);
+    volatile Word256_t* wordptr = (stride_size > 0) ? startptr : endptr-1; //reverse strides start at the end
+    for (register size_t i = 0; i < len; i++) {
+        *wordptr = val;
+        for (register uint32_t d = 0; d < delay; d++)
+            my_nop();
+        wordptr += stride_size;
+        if (wordptr >= endptr) //end, modulo
+            wordptr -= len;
+        else if (wordptr < startptr) //beginning, modulo
+            wordptr += len;
     }
     return 0;
+#endif
 }
+#endif
 
-int32_t xmem::forwSequentialRead_Word64_Delay32(void* start_address, void* end_address) {
-    register Word64_t val;
-    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(start_address), *endptr = static_cast<Word64_t*>(end_address); wordptr < endptr;) {
-        UNROLL8(val = *wordptr++; my_nop32();)
-    }
-    return 0;
-}
+#ifndef HAS_WORD_64 //special case: 32-bit architectures
+int32_t xmem::randomRead_Word32_Delay(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len, uint32_t delay) {
+    volatile uintptr_t* p = first_address;
 
-int32_t xmem::forwSequentialRead_Word64_Delay64(void* start_address, void* end_address) {
-    register Word64_t val;
-    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(start_address), *endptr = static_cast<Word64_t*>(end_address); wordptr < endptr;) {
-        UNROLL4(val = *wordptr++; my_nop64();)
+    for (register size_t i = 0; i < len / sizeof(Word32_t); i++) {
+        p = reinterpret_cast<uintptr_t*>(*p);
+        for (register uint32_t d = 0; d < delay; d++)
+            my_nop();
     }
-    return 0;
-}
 
-int32_t xmem::forwSequentialRead_Word64_Delay128(void* start_address, void* end_address) {
-    register Word64_t val;
-    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(start_address), *endptr = static_cast<Word64_t*>(end_address); wordptr < endptr;) {
-        UNROLL2(val = *wordptr++; my_nop128();)
-    }
+    *last_touched_address = const_cast<uintptr_t*>(p);
     return 0;
 }
+#endif
 
-int32_t xmem::forwSequentialRead_Word64_Delay256(void* start_address, void* end_address) {
-    register Word64_t val;
-    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(start_address), *endptr = static_cast<Word64_t*>(end_address); wordptr < endptr;) {
-        val = *wordptr++; my_nop256();
-    }
-    return 0;
-}
+#ifdef HAS_WORD_64
+int32_t xmem::randomRead_Word64_Delay(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len, uint32_t delay) {
+    volatile uintptr_t* p = first_address;
 
-int32_t xmem::forwSequentialRead_Word64_Delay512(void* start_address, void* end_address) {
-    register Word64_t val;
-    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(start_address), *endptr = static_cast<Word64_t*>(end_address); wordptr < endptr;) {
-        val = *wordptr++; my_nop512();
+    for (register size_t i = 0; i < len / sizeof(Word64_t); i++) {
+        p = reinterpret_cast<uintptr_t*>(*p);
+        for (register uint32_t d = 0; d < delay; d++)
+            my_nop();
     }
-    return 0;
-}
 
-int32_t xmem::forwSequentialRead_Word64_Delay1024(void* start_address, void* end_address) {
-    register Word64_t val;
-    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(start_address), *endptr = static_cast<Word64_t*>(end_address); wordptr < endptr;) {
-        val = *wordptr++; my_nop1024();
-    }
+    *last_touched_address = const_cast<uintptr_t*>(p);
     return 0;
 }
 #endif
 
 #ifdef HAS_WORD_128
-int32_t xmem::forwSequentialRead_Word128_Delay1(void* start_address, void* end_address) {
-#ifdef _WIN32
+int32_t xmem::randomRead_Word128_Delay(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len, uint32_t delay) {
+#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
     return 0; //TODO: Not yet implemented for Windows.
-#endif
-#ifdef __gnu_linux__
+#else
+    volatile Word128_t* p = reinterpret_cast<Word128_t*>(first_address);
     register Word128_t val;
-    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(start_address), *endptr = static_cast<Word128_t*>(end_address); wordptr < endptr;) {
-        UNROLL128(val = *wordptr++; my_nop();)
-    }
-    return 0;
-#endif
-}
 
-int32_t xmem::forwSequentialRead_Word128_Delay2(void* start_address, void* end_address) {
-#ifdef _WIN32
-    return 0; //TODO: Not yet implemented for Windows.
+    for (register size_t i = 0; i < len / sizeof(Word128_t); i++) {
+#ifdef HAS_WORD_64
+        val = *p; p = reinterpret_cast<Word128_t*>(my_64b_extractLSB_128b(val)); //Do 128-bit load. Then extract 64 LSB to use as next load address.
+#else //special case: 32-bit machine
+        val = *p; p = reinterpret_cast<Word128_t*>(my_32b_extractLSB_128b(val)); //Do 128-bit load. Then extract 32 LSB to use as next load address.
 #endif
-#ifdef __gnu_linux__
-    register Word128_t val;
-    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(start_address), *endptr = static_cast<Word128_t*>(end_address); wordptr < endptr;) {
-        UNROLL64(val = *wordptr++; my_nop2();)
+        for (register uint32_t d = 0; d < delay; d++)
+            my_nop();
     }
-    return 0;
-#endif
-}
 
-int32_t xmem::forwSequentialRead_Word128_Delay4(void* start_address, void* end_address) {
-#ifdef _WIN32
-    return 0; //TODO: Not yet implemented for Windows.
-#endif
-#ifdef __gnu_linux__
-    register Word128_t val;
-    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(start_address), *endptr = static_cast<Word128_t*>(end_address); wordptr < endptr;) {
-        UNROLL32(val = *wordptr++; my_nop4();)
-    }
+    *last_touched_address = reinterpret_cast<uintptr_t*>(const_cast<Word128_t*>(p)); //Trick compiler. First get rid of volatile qualifier, and then reinterpret pointer
     return 0;
 #endif
 }
-
-int32_t xmem::forwSequentialRead_Word128_Delay8(void* start_address, void* end_address) {
-#ifdef _WIN32
-    return 0; //TODO: Not yet implemented for Windows.
 #endif
-#ifdef __gnu_linux__
-    register Word128_t val;
-    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(start_address), *endptr = static_cast<Word128_t*>(end_address); wordptr < endptr;) {
-        UNROLL16(val = *wordptr++; my_nop8();)
-    }
-    return 0;
-#endif
-}
 
-int32_t xmem::forwSequentialRead_Word128_Delay16(void* start_address, void* end_address) {
-#ifdef _WIN32
+#ifdef HAS_WORD_256
+int32_t xmem::randomRead_Word256_Delay(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len, uint32_t delay) {
+#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
     return 0; //TODO: Not yet implemented for Windows.
-#endif
-#ifdef __gnu_linux__
-    register Word128_t val;
-    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(start_address), *endptr = static_cast<Word128_t*>(end_address); wordptr < endptr;) {
-        UNROLL8(val = *wordptr++; my_nop16();)
-    }
-    return 0;
-#endif
-}
+#else
+    volatile Word256_t* p = reinterpret_cast<Word256_t*>(first_address);
+    register Word256_t val;
 
-int32_t xmem::forwSequentialRead_Word128_Delay32(void* start_address, void* end_address) {
-#ifdef _WIN32
-    return 0; //TODO: Not yet implemented for Windows.
+    for (register size_t i = 0; i < len / sizeof(Word256_t); i++) {
+#ifdef HAS_WORD_64
+        val = *p; p = reinterpret_cast<Word256_t*>(my_64b_extractLSB_256b(val)); //Do 256-bit load. Then extract 64 LSB to use as next load address.
+#else //special case: 32-bit machine
+        val = *p; p = reinterpret_cast<Word256_t*>(my_32b_extractLSB_256b(val)); //Do 256-bit load. Then extract 32 LSB to use as next load address.
 #endif
-#ifdef __gnu_linux__
-    register Word128_t val;
-    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(start_address), *endptr = static_cast<Word128_t*>(end_address); wordptr < endptr;) {
-        UNROLL4(val = *wordptr++; my_nop32();)
+        for (register uint32_t d = 0; d < delay; d++)
+            my_nop();
     }
-    return 0;
-#endif
-}
 
-int32_t xmem::forwSequentialRead_Word128_Delay64(void* start_address, void* end_address) {
-#ifdef _WIN32
-    return 0; //TODO: Not yet implemented for Windows.
-#endif
-#ifdef __gnu_linux__
-    register Word128_t val;
-    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(start_address), *endptr = static_cast<Word128_t*>(end_address); wordptr < endptr;) {
-        UNROLL2(val = *wordptr++; my_nop64();)
-    }
+    *last_touched_address = reinterpret_cast<uintptr_t*>(const_cast<Word256_t*>(p)); //Trick compiler. First get rid of volatile qualifier, and then reinterpret pointer
     return 0;
 #endif
 }
-
-int32_t xmem::forwSequentialRead_Word128_Delay128(void* start_address, void* end_address) {
-#ifdef _WIN32
-    return 0; //TODO: Not yet implemented for Windows.
-#endif
-#ifdef __gnu_linux__
-    register Word128_t val;
-    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(start_address), *endptr = static_cast<Word128_t*>(end_address); wordptr < endptr;) {
-        val = *wordptr++; my_nop128();
-    }
-    return 0;
 #endif
-}
 
-int32_t xmem::forwSequentialRead_Word128_Delay256(void* start_address, void* end_address) {
-#ifdef _WIN32
-    return 0; //TODO: Not yet implemented for Windows.
-#endif
-#ifdef __gnu_linux__
-    register Word128_t val;
-    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(start_address), *endptr = static_cast<Word128_t*>(end_address); wordptr < endptr;) {
-        val = *wordptr++; my_nop256();
-    }
-    return 0;
-#endif
-}
+#ifndef HAS_WORD_64 //special case: 32-bit architectures
+int32_t xmem::randomWrite_Word32_Delay(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len, uint32_t delay) {
+    volatile uintptr_t* p = first_address;
+    volatile uintptr_t* p2 = NULL;
 
-int32_t xmem::forwSequentialRead_Word128_Delay512(void* start_address, void* end_address) {
-#ifdef _WIN32
-    return 0; //TODO: Not yet implemented for Windows.
-#endif
-#ifdef __gnu_linux__
-    register Word128_t val;
-    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(start_address), *endptr = static_cast<Word128_t*>(end_address); wordptr < endptr;) {
-        val = *wordptr++; my_nop512();
+    for (register size_t i = 0; i < len / sizeof(Word32_t); i++) {
+        p2 = reinterpret_cast<uintptr_t*>(*p);
+        *p = reinterpret_cast<uintptr_t>(p2);
+        p = p2;
+        for (register uint32_t d = 0; d < delay; d++)
+            my_nop();
     }
-    return 0;
-#endif
-}
 
-int32_t xmem::forwSequentialRead_Word128_Delay1024(void* start_address, void* end_address) {
-#ifdef _WIN32
-    return 0; //TODO: Not yet implemented for Windows.
-#endif
-#ifdef __gnu_linux__
-    register Word128_t val;
-    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(start_address), *endptr = static_cast<Word128_t*>(end_address); wordptr < endptr;) {
-        val = *wordptr++; my_nop1024();
-    }
+    *last_touched_address = const_cast<uintptr_t*>(p);
     return 0;
-#endif
 }
 #endif
 
-#ifdef HAS_WORD_256
-int32_t xmem::forwSequentialRead_Word256_Delay1(void* start_address, void* end_address) {
-#ifdef _WIN32
-    return 0; //TODO: Not yet implemented for Windows.
-#endif
-#ifdef __gnu_linux__
-    register Word256_t val;
-    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(start_address), *endptr = static_cast<Word256_t*>(end_address); wordptr < endptr;) {
-        UNROLL64(val = *wordptr++; my_nop();)
-    }
-    return 0;
-#endif
-}
+#ifdef HAS_WORD_64
+int32_t xmem::randomWrite_Word64_Delay(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len, uint32_t delay) {
+    volatile uintptr_t* p = first_address;
+    volatile uintptr_t* p2 = NULL;
 
-int32_t xmem::forwSequentialRead_Word256_Delay2(void* start_address, void* end_address) {
-#ifdef _WIN32
-    return 0; //TODO: Not yet implemented for Windows.
-#endif
-#ifdef __gnu_linux__
-    register Word256_t val;
-    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(start_address), *endptr = static_cast<Word256_t*>(end_address); wordptr < endptr;) {
-        UNROLL32(val = *wordptr++; my_nop2();)
+    for (register size_t i = 0; i < len / sizeof(Word64_t); i++) {
+        p2 = reinterpret_cast<uintptr_t*>(*p);
+        *p = reinterpret_cast<uintptr_t>(p2);
+        p = p2;
+        for (register uint32_t d = 0; d < delay; d++)
+            my_nop();
     }
-    return 0;
-#endif
-}
 
-int32_t xmem::forwSequentialRead_Word256_Delay4(void* start_address, void* end_address) {
-#ifdef _WIN32
-    return 0; //TODO: Not yet implemented for Windows.
-#endif
-#ifdef __gnu_linux__
-    register Word256_t val;
-    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(start_address), *endptr = static_cast<Word256_t*>(end_address); wordptr < endptr;) {
-        UNROLL16(val = *wordptr++; my_nop4();)
-    }
+    *last_touched_address = const_cast<uintptr_t*>(p);
     return 0;
-#endif
 }
-
-int32_t xmem::forwSequentialRead_Word256_Delay8(void* start_address, void* end_address) {
-#ifdef _WIN32
-    return 0; //TODO: Not yet implemented for Windows.
 #endif
-#ifdef __gnu_linux__
-    register Word256_t val;
-    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(start_address), *endptr = static_cast<Word256_t*>(end_address); wordptr < endptr;) {
-        UNROLL8(val = *wordptr++; my_nop8();)
-    }
-    return 0;
-#endif
-}
 
-int32_t xmem::forwSequentialRead_Word256_Delay16(void* start_address, void* end_address) {
-#ifdef _WIN32
+#ifdef HAS_WORD_128
+int32_t xmem::randomWrite_Word128_Delay(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len, uint32_t delay) {
+#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
     return 0; //TODO: Not yet implemented for Windows.
-#endif
-#ifdef __gnu_linux__
-    register Word256_t val;
-    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(start_address), *endptr = static_cast<Word256_t*>(end_address); wordptr < endptr;) {
-        UNROLL4(val = *wordptr++; my_nop16();)
-    }
-    return 0;
-#endif
-}
+#else
+    volatile Word128_t* p = reinterpret_cast<Word128_t*>(first_address);
+    register Word128_t val;
 
-int32_t xmem::forwSequentialRead_Word256_Delay32(void* start_address, void* end_address) {
-#ifdef _WIN32
-    return 0; //TODO: Not yet implemented for Windows.
+    for (register size_t i = 0; i < len / sizeof(Word128_t); i++) {
+#ifdef HAS_WORD_64
+        val = *p; *p = val; p = reinterpret_cast<Word128_t*>(my_64b_extractLSB_128b(val)); //Do 128-bit load. Then do 128-bit store. Then extract 64 LSB to use as next load address.
+#else //special case: 32-bit machine
+        val = *p; *p = val; p = reinterpret_cast<Word128_t*>(my_32b_extractLSB_128b(val)); //Do 128-bit load. Then do 128-bit store. Then extract 32 LSB to use as next load address.
 #endif
-#ifdef __gnu_linux__
-    register Word256_t val;
-    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(start_address), *endptr = static_cast<Word256_t*>(end_address); wordptr < endptr;) {
-        UNROLL2(val = *wordptr++; my_nop32();)
+        for (register uint32_t d = 0; d < delay; d++)
+            my_nop();
     }
-    return 0;
-#endif
-}
 
-int32_t xmem::forwSequentialRead_Word256_Delay64(void* start_address, void* end_address) {
-#ifdef _WIN32
-    return 0; //TODO: Not yet implemented for Windows.
-#endif
-#ifdef __gnu_linux__
-    register Word256_t val;
-    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(start_address), *endptr = static_cast<Word256_t*>(end_address); wordptr < endptr;) {
-        val = *wordptr++; my_nop64();
-    }
+    *last_touched_address = reinterpret_cast<uintptr_t*>(const_cast<Word128_t*>(p)); //Trick compiler. First get rid of volatile qualifier, and then reinterpret pointer
     return 0;
 #endif
 }
-
-int32_t xmem::forwSequentialRead_Word256_Delay128(void* start_address, void* end_address) {
-#ifdef _WIN32
-    return 0; //TODO: Not yet implemented for Windows.
-#endif
-#ifdef __gnu_linux__
-    register Word256_t val;
-    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(start_address), *endptr = static_cast<Word256_t*>(end_address); wordptr < endptr;) {
-        val = *wordptr++; my_nop128();
-    }
-    return 0;
 #endif
-}
 
-int32_t xmem::forwSequentialRead_Word256_Delay256(void* start_address, void* end_address) {
-#ifdef _WIN32
+#ifdef HAS_WORD_256
+int32_t xmem::randomWrite_Word256_Delay(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len, uint32_t delay) {
+#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
     return 0; //TODO: Not yet implemented for Windows.
-#endif
-#ifdef __gnu_linux__
+#else
+    volatile Word256_t* p = reinterpret_cast<Word256_t*>(first_address);
     register Word256_t val;
-    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(start_address), *endptr = static_cast<Word256_t*>(end_address); wordptr < endptr;) {
-        val = *wordptr++; my_nop256();
-    }
-    return 0;
-#endif
-}
 
-int32_t xmem::forwSequentialRead_Word256_Delay512(void* start_address, void* end_address) {
-#ifdef _WIN32
-    return 0; //TODO: Not yet implemented for Windows.
+    for (register size_t i = 0; i < len / sizeof(Word256_t); i++) {
+#ifdef HAS_WORD_64
+        val = *p; *p = val; p = reinterpret_cast<Word256_t*>(my_64b_extractLSB_256b(val)); //Do 256-bit load. Then do 256-bit store. Then extract 64 LSB to use as next load address.
+#else //special case: 32-bit machine
+        val = *p; *p = val; p = reinterpret_cast<Word256_t*>(my_32b_extractLSB_256b(val)); //Do 256-bit load. Then do 256-bit store. Then extract 32 LSB to use as next load address.
 #endif
-#ifdef __gnu_linux__
-    register Word256_t val;
-    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(start_address), *endptr = static_cast<Word256_t*>(end_address); wordptr < endptr;) {
-        val = *wordptr++; my_nop512();
+        for (register uint32_t d = 0; d < delay; d++)
+            my_nop();
     }
-    return 0;
-#endif
-}
 
-int32_t xmem::forwSequentialRead_Word256_Delay1024(void* start_address, void* end_address) {
-#ifdef _WIN32
-    return 0; //TODO: Not yet implemented for Windows.
-#endif
-#ifdef __gnu_linux__
-    register Word256_t val;
-    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(start_address), *endptr = static_cast<Word256_t*>(end_address); wordptr < endptr;) {
-        val = *wordptr++; my_nop1024();
-    }
+    *last_touched_address = reinterpret_cast<uintptr_t*>(const_cast<Word256_t*>(p)); //Trick compiler. First get rid of volatile qualifier, and then reinterpret pointer
     return 0;
 #endif
 }
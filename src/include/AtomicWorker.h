@@ -0,0 +1,110 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Microsoft
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Author: Mark Gottscho <mgottscho@ucla.edu>
+ */
+
+/**
+ * @file
+ * 
+ * @brief Header file for the AtomicWorker class.
+ */
+
+#ifndef ATOMIC_WORKER_H
+#define ATOMIC_WORKER_H
+
+//Headers
+#include <MemoryWorker.h>
+#include <benchmark_kernels.h>
+#include <common.h>
+
+//Libraries
+#include <cstdint>
+#include <atomic>
+
+namespace xmem {
+    /** 
+     * @brief Multithreading-friendly class that hammers one or more cache lines with atomic read-modify-write operations, possibly together with workers on other logical CPUs that target the same lines.
+     */
+    class AtomicWorker : public MemoryWorker {
+        public:
+            
+            /** 
+             * @brief Constructor.
+             * @param lines Address of the first cache line to target. It must be aligned to CACHE_LINE_SIZE.
+             * @param num_lines Number of consecutive cache lines to cycle over.
+             * @param first_line Index of the first cache line to target, so that workers sharing the same lines can start on different ones.
+             * @param atomic_op The atomic operation to do.
+             * @param arrived Shared counter of workers that are ready to start. It must be zero when the first worker starts.
+             * @param num_workers Number of workers that start together. Each waits until all of them have arrived.
+             * @param cpu_affinity Logical CPU identifier to lock this worker's thread to.
+             */
+            AtomicWorker(
+                void* lines,
+                size_t num_lines,
+                size_t first_line,
+                atomic_op_t atomic_op,
+                std::atomic<uint32_t>* arrived,
+                uint32_t num_workers,
+                int32_t cpu_affinity
+            );
+            
+            /**
+             * @brief Destructor.
+             */
+            virtual ~AtomicWorker();
+
+            /**
+             * @brief Thread-safe worker method.
+             */
+            virtual void run();
+
+            /**
+             * @brief Gets the number of atomic operations that were done.
+             * @returns The number of operations.
+             */
+            uint64_t getOps();
+
+            /**
+             * @brief Gets the number of compare-and-swap operations that failed because another thread changed the line first.
+             * @returns The number of failed operations, or 0 for other atomic operations.
+             */
+            uint64_t getCompareExchangeFailures();
+
+            /**
+             * @brief Gets the mean time to do one atomic operation, excluding loop overhead.
+             * @returns The mean latency per operation in ns.
+             */
+            double getMeanOpLatency();
+
+        private:
+            // ONLY ACCESS OBJECT VARIABLES UNDER THE RUNNABLE OBJECT LOCK!!!!
+            size_t num_lines_; /**< Number of consecutive cache lines to cycle over. */
+            size_t first_line_; /**< Index of the first cache line to target. */
+            atomic_op_t atomic_op_; /**< The atomic operation to do. */
+            std::atomic<uint32_t>* arrived_; /**< Shared counter of workers that are ready to start. */
+            uint32_t num_workers_; /**< Number of workers that start together. */
+            uint64_t cas_failures_; /**< Number of failed compare-and-swap operations. */
+    };
+};
+
+#endif
@@ -36,15 +36,20 @@
 #include <common.h>
 #include <Timer.h>
 #include <PowerReader.h>
+#include <Thread.h>
 #include <Benchmark.h>
 #include <ThroughputBenchmark.h>
 #include <LatencyBenchmark.h>
+#include <ConcurrentThroughputBenchmark.h>
 #include <Configurator.h>
+#include <MemoryWorker.h>
 
 //Libraries
 #include <cstdint>
 #include <vector>
 #include <fstream>
+#include <atomic>
+#include <functional>
 
 namespace xmem {
     /**
@@ -81,6 +86,97 @@ namespace xmem {
          */
         bool runLatencyBenchmarks();
 
+        /**
+         * @brief Runs the concurrent all-node throughput benchmarks, where every configured CPU/memory NUMA node placement generates load at the same time.
+         * @returns True on benchmarking success.
+         */
+        bool runConcurrentThroughputBenchmarks();
+
+        /**
+         * @brief Runs the NUMA interconnect benchmarks. For each load setting, every CPU/memory NUMA node pair is first measured alone, then with bidirectional pairs and with all-to-all remote traffic running at the same time. The results are reported as NUMA node matrices.
+         * @returns True on benchmarking success.
+         */
+        bool runInterconnectBenchmarks();
+
+        /**
+         * @brief Runs the interference generator. Load threads with the first selected load setting run on the first selected CPU NUMA node against the first selected memory NUMA node until a stop signal is received or the configured run time passes.
+         * Achieved bandwidth is reported periodically to the console and to the results file if one is used.
+         * @returns True if the load threads ran.
+         */
+        bool runInterferenceGenerator();
+
+        /**
+         * @brief Runs the core-to-core cache line transfer latency benchmark. For every pair of the selected logical CPUs, two pinned threads bounce ownership of a shared cache line, and the one-way transfer latency is reported as a CPU by CPU matrix and grouped by the topological relation of the two CPUs.
+         * @returns True on benchmarking success.
+         */
+        bool runCoreToCoreLatencyBenchmark();
+
+        /**
+         * @brief Runs the core-to-core producer/consumer bandwidth benchmark. For each pair of logical CPUs and block size, a producer thread writes blocks into a shared ring buffer that a consumer thread reads, and the sustained transfer throughput and the handoff latency of a single block are reported.
+         * @returns True on benchmarking success.
+         */
+        bool runCoreToCoreBandwidthBenchmark();
+
+        /**
+         * @brief Runs the atomic operation contention benchmark. For each atomic operation and way of sharing cache lines, a growing number of pinned threads do atomic read-modify-write operations at the same time, and the aggregate throughput and mean latency per operation are reported as the threads spread across cores, last-level caches, and sockets.
+         * @returns True on benchmarking success.
+         */
+        bool runAtomicBenchmark();
+
+        /**
+         * @brief Runs the false sharing benchmark. Pinned threads repeatedly write private words that are separated by a varying amount of padding, so that they share cache lines when the padding is small. The write throughput is reported for each padding, for pairs of logical CPUs at each topological distance, and for the configured number of threads.
+         * @returns True on benchmarking success.
+         */
+        bool runFalseSharingBenchmark();
+
+        /**
+         * @brief Runs the cache flush benchmark. For each flush instruction, worker threads bring their working sets into the cache, either clean or dirty, and flush every line. The aggregate flush throughput and the latency of a single flush are reported for each CPU/memory NUMA node combination, working set size, and number of threads.
+         * @returns True on benchmarking success.
+         */
+        bool runFlushBenchmark();
+
+        /**
+         * @brief Runs the copy/fill benchmark. A single pinned thread times back-to-back copy or fill calls with each engine, for each fixed call size and for the call size distribution, with the source and destination buffers on every combination of memory NUMA nodes. The throughput and the cost per call are reported, along with the fastest engine for each size.
+         * @returns True on benchmarking success.
+         */
+        bool runCopyBenchmark();
+
+        /**
+         * @brief Runs the gather/scatter benchmark. Worker threads repeatedly gather or scatter 64-bit elements through an index array with each engine, for each index pattern. The element throughput, effective bandwidth, and time per element are reported for each CPU/memory NUMA node combination, working set size, and number of threads, along with how the vector engines compare to scalar loads and stores.
+         * @returns True on benchmarking success.
+         */
+        bool runGatherBenchmark();
+
+        /**
+         * @brief Runs the multi-stream benchmark. Worker threads read several sequential streams at the same time, forward and in reverse, for each stream count. The aggregate read throughput is reported for each CPU/memory NUMA node combination, working set size, and number of threads, along with the stream count at which the hardware prefetchers stop keeping up.
+         * @returns True on benchmarking success.
+         */
+        bool runMultiStreamBenchmark();
+
+        /**
+         * @brief Runs the unaligned access benchmark. For each chunk size and byte offset from a cache line boundary, worker threads measure sequential read and write throughput with unaligned accesses and the latency of chasing unaligned pointers. The results are reported for each CPU/memory NUMA node combination, working set size, and number of threads, along with the penalty relative to aligned accesses.
+         * @returns True on benchmarking success.
+         */
+        bool runUnalignedBenchmark();
+
+        /**
+         * @brief Runs the data pattern benchmark. For each data pattern and chunk size, worker threads measure sequential read throughput on memory initialized with the pattern and the throughput of writing the pattern, along with the DRAM power where it can be measured. The results are reported for each CPU/memory NUMA node combination, working set size, and number of threads.
+         * @returns True on benchmarking success.
+         */
+        bool runDataPatternBenchmark();
+
+        /**
+         * @brief Runs the 2D tiled benchmark. Worker threads traverse their working sets as 2D arrays of 64-bit elements with padded rows, in row-major, column-major, blocked, and Morton order, and copy them into their transposes. The throughput is reported for each CPU/memory NUMA node combination, working set size, and number of threads.
+         * @returns True on benchmarking success.
+         */
+        bool runTiledBenchmark();
+
+        /**
+         * @brief Runs the roofline benchmark. Worker threads read their working sets sequentially and apply a fixed number of multiply-adds to every loaded element, sweeping the arithmetic intensity. The operation and load throughputs are reported for each engine, CPU/memory NUMA node combination, working set size, and number of threads, with estimates of the compute and memory roofs.
+         * @returns True on benchmarking success.
+         */
+        bool runRooflineBenchmark();
+
 #ifdef EXT_DELAY_INJECTED_LOADED_LATENCY_BENCHMARK
         /**
          * @brief Runs the delay-injected loaded latency benchmark extension.
@@ -104,6 +200,191 @@ namespace xmem {
          */
         void setupWorkingSets(size_t working_set_size);
 
+        /**
+         * @brief Reports the results of a working set size sweep to the console as one curve per NUMA node pair and benchmark setting.
+         * @param benchmarks The benchmarks that were run as part of the sweep, in the order they were built.
+         * @param label A human-friendly name for the kind of benchmarks, e.g., "Throughput" or "Latency".
+         */
+        void reportWorkingSetSizeSweep(const std::vector<Benchmark*>& benchmarks, std::string label) const;
+
+        /**
+         * @brief Locates the memory hierarchy levels in one working set size sweep curve and reports their plateaus and effective capacities to the console.
+         * @param working_set_sizes The working set sizes per thread in bytes of each sweep point, in increasing order.
+         * @param metrics The median benchmark metric of each sweep point.
+         * @param metric_units The units of the benchmark metric.
+         */
+        void reportMemoryLevels(const std::vector<size_t>& working_set_sizes, const std::vector<double>& metrics, std::string metric_units) const;
+
+        /**
+         * @brief Reports the results of a worker thread count sweep to the console as aggregate throughput, per-thread throughput, and parallel efficiency relative to the smallest thread count.
+         * @param benchmarks The throughput benchmarks that were run as part of the sweep.
+         */
+        void reportNumWorkerThreadsSweep(const std::vector<ThroughputBenchmark*>& benchmarks) const;
+
+        /**
+         * @brief Prints a one-line description of the NUMA placement and, optionally, the load traffic settings of a benchmark in a sweep, without a trailing newline.
+         * @param benchmark The benchmark to describe.
+         * @param include_load_settings If true, include the access pattern, read/write mode, chunk size, and stride.
+         */
+        void reportSweepCurveHeader(const Benchmark* benchmark, bool include_load_settings) const;
+
+        /**
+         * @brief Prints a short description of the access pattern, read/write mode, chunk size, and stride of a benchmark, without a trailing newline.
+         * @param benchmark The benchmark to describe.
+         */
+        void reportLoadSettings(const Benchmark* benchmark) const;
+
+        /**
+         * @brief Reports a CPU NUMA node by memory NUMA node matrix of benchmark metrics to the console.
+         * @param label A human-friendly name for the matrix.
+         * @param cpu_nodes The CPU NUMA node of each row.
+         * @param mem_nodes The memory NUMA node of each column.
+         * @param matrix The metric of each entry, indexed by row and then column. Negative entries were not measured.
+         * @param metric_units The units of the benchmark metric.
+         */
+        void reportNUMAMatrix(std::string label, const std::vector<uint32_t>& cpu_nodes, const std::vector<uint32_t>& mem_nodes, const std::vector<std::vector<double> >& matrix, std::string metric_units) const;
+
+        /**
+         * @brief Reports a logical CPU by logical CPU matrix of benchmark metrics to the console.
+         * @param label A human-friendly name for the matrix.
+         * @param cpus The logical CPU of each row and column.
+         * @param matrix The metric of each entry, indexed by row and then column. Negative entries were not measured.
+         * @param metric_units The units of the benchmark metric.
+         */
+        void reportCPUMatrix(std::string label, const std::vector<uint32_t>& cpus, const std::vector<std::vector<double> >& matrix, std::string metric_units) const;
+
+        /**
+         * @brief Reports summary statistics of a metric measured on pairs of logical CPUs to the console, grouped by the topological relation of each pair.
+         * @param pair_metrics The metrics of all pairs, indexed by cpu_relation_t.
+         * @param metric_units The units of the metric.
+         */
+        void reportCPURelationSummary(const std::vector<std::vector<double> >& pair_metrics, std::string metric_units) const;
+
+        /**
+         * @brief Gets the logical CPUs that the core-to-core benchmarks run on: every Nth logical CPU of each selected CPU NUMA node, where N is the configured CPU step.
+         * @param cpus Filled in with the logical CPU identifiers.
+         * @param cpu_nodes Filled in with the NUMA node of each logical CPU.
+         */
+        void getCoreToCoreCPUs(std::vector<uint32_t>& cpus, std::vector<uint32_t>& cpu_nodes) const;
+
+        /**
+         * @brief Gets the logical CPUs of the core-to-core benchmarks in order of topological distance from the first one, so that a growing prefix of them crosses cores, last-level caches, and sockets in turn.
+         * @param cpus Filled in with the logical CPU identifiers.
+         * @param cpu_nodes Filled in with the NUMA node of each logical CPU.
+         * @param relations Filled in with the relation of each logical CPU to the first one, as a cpu_relation_t. The first entry is -1.
+         */
+        void getCoreToCoreCPUsByDistance(std::vector<uint32_t>& cpus, std::vector<uint32_t>& cpu_nodes, std::vector<int32_t>& relations) const;
+
+        /**
+         * @brief Gets the pairs of logical CPUs that the pairwise core-to-core benchmarks run on: the pairs given by the user, or else the first logical CPU paired with the first CPU of each topological relation that is present.
+         * @param pairs Filled in with the (first, second) logical CPU pairs.
+         */
+        void getCoreToCoreCPUPairs(std::vector<std::pair<uint32_t, uint32_t> >& pairs) const;
+
+        /**
+         * @brief Gets the NUMA node that a logical CPU belongs to.
+         * @param cpu The logical CPU identifier.
+         * @returns The NUMA node, or 0 if it cannot be determined.
+         */
+        uint32_t getCPUNumaNode(uint32_t cpu) const;
+
+        /**
+         * @brief Writes one row of results of a benchmark mode that runs its own worker threads to the results file, if it is in use. Columns that do not apply are written as N/A.
+         * @param name The test name.
+         * @param working_set_size The working set size per thread in bytes, or 0 if it does not apply.
+         * @param num_threads The number of threads involved.
+         * @param mem_node The memory NUMA node of the shared data.
+         * @param cpu_nodes A description of the CPU NUMA nodes involved.
+         * @param throughput_on_iter The throughput metric of each iteration, or empty if there is none.
+         * @param throughput_units The units of the throughput metric.
+         * @param latency_on_iter The latency metric of each iteration, or empty if there is none.
+         * @param latency_units The units of the latency metric.
+         * @param notes Free-form notes on the row.
+         */
+        void writeWorkerResults(std::string name, size_t working_set_size, uint32_t num_threads, uint32_t mem_node, std::string cpu_nodes, const std::vector<double>& throughput_on_iter, std::string throughput_units, const std::vector<double>& latency_on_iter, std::string latency_units, std::string notes);
+
+        /**
+         * @brief Writes one row of results of a benchmark mode that runs its own worker threads to the results file, if it is in use, including the DRAM power of each socket. Columns that do not apply are written as N/A.
+         * @param name The test name.
+         * @param working_set_size The working set size per thread in bytes, or 0 if it does not apply.
+         * @param num_threads The number of threads involved.
+         * @param mem_node The memory NUMA node of the shared data.
+         * @param cpu_nodes A description of the CPU NUMA nodes involved.
+         * @param throughput_on_iter The throughput metric of each iteration, or empty if there is none.
+         * @param throughput_units The units of the throughput metric.
+         * @param latency_on_iter The latency metric of each iteration, or empty if there is none.
+         * @param latency_units The units of the latency metric.
+         * @param mean_power The mean DRAM power in W of each socket. Negative or missing entries were not measured.
+         * @param peak_power The peak DRAM power in W of each socket. Negative or missing entries were not measured.
+         * @param notes Free-form notes on the row.
+         */
+        void writeWorkerResults(std::string name, size_t working_set_size, uint32_t num_threads, uint32_t mem_node, std::string cpu_nodes, const std::vector<double>& throughput_on_iter, std::string throughput_units, const std::vector<double>& latency_on_iter, std::string latency_units, const std::vector<double>& mean_power, const std::vector<double>& peak_power, std::string notes);
+
+        /**
+         * @brief Starts a thread for each available DRAM power reader, outside of a Benchmark object.
+         * @param power_threads Filled in with one thread per power reader, or NULL for sockets without one.
+         * @returns True on success.
+         */
+        bool startDRAMPowerThreads(std::vector<Thread*>& power_threads);
+
+        /**
+         * @brief Stops and deletes the threads started by startDRAMPowerThreads() and collects their measurements.
+         * @param power_threads The threads to stop. Cleared on return.
+         * @param mean_power Filled in with the mean DRAM power in W of each socket, or -1 for sockets without a power reader.
+         * @param peak_power Filled in with the peak DRAM power in W of each socket, or -1 for sockets without a power reader.
+         * @returns True on success.
+         */
+        bool stopDRAMPowerThreads(std::vector<Thread*>& power_threads, std::vector<double>& mean_power, std::vector<double>& peak_power);
+
+        /**
+         * @brief Runs a benchmark mode that starts its own worker threads at every placement: each memory NUMA node, CPU NUMA node, number of worker threads, and working set size per thread, including their sweeps. The worker threads run on the first logical CPUs of the CPU NUMA node.
+         * @param mode_name Name of the benchmark mode, for error messages.
+         * @param run_placement Runs the measurements of one placement, given the memory NUMA node, the start of its memory region, the CPU NUMA node, the logical CPU of each worker thread, and the working set size per thread. Thread t uses the working set that starts t working sets into the memory region. Returns false to stop on an error.
+         * @returns True on success.
+         */
+        bool runWorkerPlacements(std::string mode_name, std::function<bool(uint32_t mem_node, uint8_t* mem_array, uint32_t cpu_node, const std::vector<int32_t>& cpus, size_t working_set_size)> run_placement);
+
+        /**
+         * @brief Repeats a measurement of a benchmark mode that starts its own worker threads, once per iteration. Every iteration creates, runs, and deletes one worker per thread and combines their metrics over the threads.
+         * @param mode_name Name of the benchmark mode, for error messages.
+         * @param cpus The logical CPU of each worker thread.
+         * @param create_worker Creates the worker of a thread, given its index and the start barrier counter that the workers of an iteration can share.
+         * @param get_metrics Gets the metrics of a worker that has run. The first num_rates of them are rates, which add up over the threads because each thread runs for about the same time. The others are averaged over the threads.
+         * @param num_rates The number of metrics that are rates.
+         * @param metrics_on_iter Filled in with the combined metrics of each iteration, indexed by metric and then by iteration.
+         * @param warning Set to true if any worker had a warning.
+         * @param mean_power If not NULL, DRAM power is sampled over all of the iterations, and this is filled in with the mean DRAM power in W of each socket, or -1 for sockets without a power reader.
+         * @param peak_power Filled in with the peak DRAM power in W of each socket when power is sampled. It must be given together with mean_power.
+         * @returns True if every worker thread started.
+         */
+        bool runWorkers(std::string mode_name, const std::vector<int32_t>& cpus, std::function<MemoryWorker*(uint32_t thread, std::atomic<uint32_t>* arrived)> create_worker, std::function<std::vector<double>(MemoryWorker* worker)> get_metrics, uint32_t num_rates, std::vector<std::vector<double> >& metrics_on_iter, bool& warning, std::vector<double>* mean_power = NULL, std::vector<double>* peak_power = NULL);
+
+        /**
+         * @brief Gets the load settings that concurrent throughput and extension benchmarks should iterate over. Random access patterns are indicated by a stride of 0.
+         * @param rws Filled in with the read/write modes to use.
+         * @param chunks Filled in with the chunk sizes to use.
+         * @param strides Filled in with the stride sizes to use.
+         */
+        void getConcurrentLoadSettings(std::vector<rw_mode_t>& rws, std::vector<chunk_size_t>& chunks, std::vector<int32_t>& strides) const;
+
+        /**
+         * @brief Constructs a concurrent throughput benchmark for a set of placements, giving each placement its own memory region. The benchmark is owned by the BenchmarkManager.
+         * @param cpu_nodes The CPU NUMA node of each placement.
+         * @param mem_nodes The memory NUMA node of each placement.
+         * @param rw The read/write mode.
+         * @param chunk The chunk size.
+         * @param stride The stride size in chunks, or 0 for a random access pattern.
+         * @param label Suffix of the benchmark name after the test index.
+         * @returns The benchmark, or NULL on failure.
+         */
+        ConcurrentThroughputBenchmark* buildConcurrentThroughputBenchmark(const std::vector<uint32_t>& cpu_nodes, const std::vector<uint32_t>& mem_nodes, rw_mode_t rw, chunk_size_t chunk, int32_t stride, std::string label);
+
+        /**
+         * @brief Writes the system-wide and per-placement results of a concurrent throughput benchmark to the results file, if it is in use.
+         * @param bench The benchmark that has run.
+         */
+        void writeConcurrentThroughputResults(const ConcurrentThroughputBenchmark* bench);
+
         /**
          * @brief Constructs and initializes all configured benchmarks.
          * @returns True on success.
@@ -121,8 +402,10 @@ namespace xmem {
         std::vector<size_t> mem_array_lens_; /**< Length of each memory region to use in benchmarks. */
         std::vector<ThroughputBenchmark*> tp_benchmarks_; /**< Set of throughput benchmarks. */
         std::vector<LatencyBenchmark*> lat_benchmarks_; /**< Set of latency benchmarks. */
+        std::vector<ConcurrentThroughputBenchmark*> conc_tp_benchmarks_; /**< Set of concurrent throughput benchmarks used by the concurrent all-node throughput and NUMA interconnect modes. */
         std::vector<PowerReader*> dram_power_readers_; /**< Set of power measurement objects for DRAM on each NUMA node. */
         std::fstream results_file_; /**< The results CSV file. */
+        std::fstream latency_trace_file_; /**< The latency time series CSV file for loaded latency benchmarks with a load profile. */
         bool built_benchmarks_; /**< If true, finished building all benchmarks. */
     };
 };
@@ -0,0 +1,152 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Microsoft
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Author: Mark Gottscho <mgottscho@ucla.edu>
+ */
+
+/**
+ * @file
+ * 
+ * @brief Header file for the ConcurrentThroughputBenchmark class.
+ */
+
+#ifndef CONCURRENT_THROUGHPUT_BENCHMARK_H
+#define CONCURRENT_THROUGHPUT_BENCHMARK_H
+
+//Headers
+#include <Benchmark.h>
+#include <common.h>
+
+//Libraries
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace xmem {
+
+    /**
+     * @brief A type of benchmark that measures memory throughput of several CPU/memory NUMA node placements at the same time.
+     *
+     * Each placement is a group of worker threads pinned to one CPU NUMA node that access memory on one memory NUMA node. All worker threads of all placements are started together, so
+     * shared resources such as the inter-socket interconnect and package power limits are contended just as they would be in a whole-system workload.
+     * The benchmark metric is the system-wide aggregate throughput, i.e., the sum of the throughput of every placement. Per-placement throughput is also available.
+     */
+    class ConcurrentThroughputBenchmark : public Benchmark {
+    public:
+        /**
+         * @brief Constructor. The Benchmark base class is given the memory region, CPU node, and memory node of the first placement. See Benchmark class documentation for other parameter semantics.
+         * @param mem_arrays The memory region to use for each placement. Regions must not overlap, even if several placements use the same memory NUMA node.
+         * @param len Length of each placement's memory region in bytes. This is the per-thread working set size times the number of worker threads per placement.
+         * @param iterations Number of iterations of the complete benchmark.
+         * @param num_worker_threads The number of worker threads in each placement.
+         * @param cpu_nodes The CPU NUMA node of each placement.
+         * @param mem_nodes The memory NUMA node of each placement.
+         * @param pattern_mode Access pattern used by all worker threads.
+         * @param rw_mode Read/write mode used by all worker threads.
+         * @param chunk_size Chunk size used by all worker threads.
+         * @param stride_size Stride size in chunks used by all worker threads for sequential access patterns.
+         * @param dram_power_readers A group of PowerReader objects for measuring DRAM power.
+         * @param name The name of the benchmark to use when reporting to console.
+         */
+        ConcurrentThroughputBenchmark(
+            std::vector<void*> mem_arrays,
+            size_t len,
+            uint32_t iterations,
+            uint32_t num_worker_threads,
+            std::vector<uint32_t> cpu_nodes,
+            std::vector<uint32_t> mem_nodes,
+            pattern_mode_t pattern_mode,
+            rw_mode_t rw_mode,
+            chunk_size_t chunk_size,
+            int32_t stride_size,
+            std::vector<PowerReader*> dram_power_readers,
+            std::string name
+        );
+
+        /**
+         * @brief Destructor.
+         */
+        virtual ~ConcurrentThroughputBenchmark() {}
+
+        /**
+         * @brief Reports benchmark configuration details to the console.
+         */
+        virtual void reportBenchmarkInfo() const;
+
+        /**
+         * @brief Reports results to the console.
+         */
+        virtual void reportResults() const;
+
+        /**
+         * @brief Gets the number of CPU/memory NUMA node placements that run concurrently in this benchmark.
+         * @returns The number of placements.
+         */
+        uint32_t getNumPlacements() const { return static_cast<uint32_t>(cpu_nodes_.size()); }
+
+        /**
+         * @brief Gets the total number of worker threads across all placements.
+         * @returns The total number of worker threads.
+         */
+        uint32_t getTotalNumThreads() const { return num_worker_threads_ * getNumPlacements(); }
+
+        /**
+         * @brief Gets the CPU NUMA node of a placement.
+         * @param placement Index of the placement.
+         * @returns The CPU NUMA node.
+         */
+        uint32_t getPlacementCPUNode(uint32_t placement) const { return cpu_nodes_[placement]; }
+
+        /**
+         * @brief Gets the memory NUMA node of a placement.
+         * @param placement Index of the placement.
+         * @returns The memory NUMA node.
+         */
+        uint32_t getPlacementMemNode(uint32_t placement) const { return mem_nodes_[placement]; }
+
+        /**
+         * @brief Gets the throughput of a placement on a given iteration.
+         * @param placement Index of the placement.
+         * @param iter Iteration to extract, starting at 1.
+         * @returns The throughput in MB/s, or -1 if the benchmark has not run.
+         */
+        double getPlacementMetricOnIter(uint32_t placement, uint32_t iter) const;
+
+        /**
+         * @brief Gets the arithmetic mean throughput of a placement across all iterations.
+         * @param placement Index of the placement.
+         * @returns The mean throughput in MB/s, or -1 if the benchmark has not run.
+         */
+        double getMeanPlacementMetric(uint32_t placement) const;
+
+    protected:
+        virtual bool runCore();
+
+        std::vector<void*> mem_arrays_; /**< Memory region of each placement. */
+        std::vector<uint32_t> cpu_nodes_; /**< CPU NUMA node of each placement. */
+        std::vector<uint32_t> mem_nodes_; /**< Memory NUMA node of each placement. */
+        std::vector<std::vector<double> > placement_metric_on_iter_; /**< Throughput in MB/s of each placement on each iteration. Indexed by placement, then iteration. */
+        std::vector<double> mean_placement_metric_; /**< Mean throughput in MB/s of each placement across all iterations. */
+    };
+};
+
+#endif
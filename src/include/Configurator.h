@@ -36,11 +36,15 @@
 #include <common.h>
 #include <optionparser.h>
 #include <MyArg.h>
+#include <LoadProfile.h>
+#include <CopySizeDistribution.h>
 
 //Libraries
 #include <cstdint>
 #include <string>
 #include <list>
+#include <utility>
+#include <vector>
 
 namespace xmem {
     /**
@@ -68,7 +72,63 @@ namespace xmem {
         MEMORY_NUMA_NODE_AFFINITY,
         USE_READS,
         USE_WRITES,
-        STRIDE_SIZE
+        STRIDE_SIZE,
+        WORKING_SET_SIZE_SWEEP,
+        NUM_WORKER_THREADS_SWEEP,
+        CONCURRENT_THROUGHPUT,
+        NODE_MAP,
+        INTERCONNECT,
+        LOAD_NODE_MAP,
+        DELAY_SWEEP,
+        LOAD_BANDWIDTH,
+        LOAD_PROFILE,
+        LOAD_BURST,
+        LATENCY_TRACE,
+        INTERFERE,
+        REPORT_INTERVAL,
+        ALL_CORE_LATENCY,
+        C2C_LATENCY,
+        C2C_CPU_STEP,
+        C2C_BANDWIDTH,
+        C2C_PAIR,
+        C2C_BLOCK_SIZE,
+        ATOMICS,
+        ATOMIC_OP,
+        ATOMIC_SHARING,
+        ATOMIC_ADDRESSES,
+        FALSE_SHARING,
+        FALSE_SHARING_PADDING,
+        FALSE_SHARING_WORK,
+        FLUSH,
+        FLUSH_OP,
+        COLD_CACHE,
+        COPY,
+        COPY_ENGINE,
+        COPY_SIZE,
+        COPY_SIZE_FILE,
+        RW_MIX,
+        USE_READ_MODIFY_WRITE,
+        GATHER,
+        GATHER_ENGINE,
+        GATHER_INDEX,
+        GATHER_STRIDE,
+        GATHER_WINDOW,
+        MULTI_STREAM,
+        STREAM_COUNT,
+        UNALIGNED,
+        UNALIGNED_OFFSET,
+        DATA_SENSITIVITY,
+        DATA_PATTERN,
+        DATA_PATTERN_FILE,
+        TILED,
+        TILE_ORDER,
+        ROW_PITCH,
+        ROW_WIDTH,
+        TILE_WIDTH,
+        TILE_HEIGHT,
+        ROOFLINE,
+        ROOFLINE_ENGINE,
+        OPS_PER_ELEMENT
     };
 
     /**
@@ -98,6 +158,62 @@ namespace xmem {
         { USE_READS, 0, "R", "reads", Arg::None, "    -R, --reads    \tUse memory read-based patterns in load traffic-generating threads." },
         { USE_WRITES, 0, "W", "writes", Arg::None, "    -W, --writes    \tUse memory write-based patterns in load traffic-generating threads." },
         { STRIDE_SIZE, 0, "S", "stride_size", MyArg::Integer, "    -S, --stride_size    \tA stride size to use for load traffic-generating threads, specified in powers-of-two multiples of the chunk size(s). Allowed values: 1, -1, 2, -2, 4, -4, 8, -8, 16, -16. Positive indicates the forward direction (increasing addresses), while negative indicates the reverse direction." },
+        { WORKING_SET_SIZE_SWEEP, 0, "", "ws_sweep", MyArg::Required, "    --ws_sweep    \tSweep the working set size per worker thread instead of using a single value. The argument has the form MIN:MAX:STEP, where MIN and MAX are sizes in KB that may carry a K, M, or G suffix (e.g., 4K, 32M, 1G), and STEP is either xF to multiply the size by F at each point or +SIZE to add SIZE at each point. Every size must be a multiple of 4 KB. Memory for the largest size is allocated only once per NUMA node, and each sweep point runs on a sub-range of it. Results are reported as one throughput and one latency curve per CPU/memory NUMA node pair and benchmark setting. This cannot be used in tandem with the working_set_size option." },
+        { NUM_WORKER_THREADS_SWEEP, 0, "", "threads_sweep", MyArg::Required, "    --threads_sweep    \tSweep the number of worker threads instead of using a single value, to measure how throughput scales with cores. The argument has the form MIN:MAX or MIN:MAX:STEP, where MAX may be \"all\" to use every logical CPU in a NUMA node, and STEP is either +N to add N threads at each point (the default is +1) or xF to multiply the thread count by F at each point. Memory for the largest thread count is allocated only once per NUMA node, and each sweep point runs on a sub-range of it. Throughput results are additionally reported with per-thread throughput and parallel efficiency relative to the first sweep point. This cannot be used in tandem with the num_worker_threads option, and does not apply to extensions." },
+        { CONCURRENT_THROUGHPUT, 0, "", "all_nodes", Arg::None, "    --all_nodes    \tConcurrent all-node throughput benchmarking mode. Load traffic runs on every selected NUMA node at the same time, and the system-wide aggregate throughput is reported along with the throughput of each node from the same synchronized run. By default, each CPU NUMA node accesses its local memory NUMA node, for every node that is included in both the CPU and memory NUMA node affinities. Each node uses the configured number of worker threads and working set size per thread. Use the node_map option to choose other placements. This cannot be used in tandem with the sweep options." },
+        { NODE_MAP, 0, "", "node_map", MyArg::Required, "    --node_map    \tA CPU:MEM pair of NUMA nodes to use as one placement in the concurrent all-node throughput mode, replacing the default local placements. This option may be specified multiple times, and implies the all_nodes option. Several placements may share a CPU or memory NUMA node; they are given disjoint logical CPUs and disjoint memory regions." },
+        { INTERCONNECT, 0, "", "interconnect", Arg::None, "    --interconnect    \tNUMA interconnect saturation benchmarking mode. For each load setting, every CPU/memory NUMA node pair from the selected affinities is measured alone to form an idle throughput matrix. Then each pair of nodes reads the other's memory at the same time (bidirectional), and finally every CPU node accesses every remote memory node at the same time (all-to-all). The loaded matrices are reported next to the idle matrix so that degraded inter-socket links stand out. Each pair uses the configured number of worker threads and working set size per thread. At least two NUMA nodes are required. This cannot be used in tandem with the sweep options." },
+        { LOAD_NODE_MAP, 0, "", "load_node_map", MyArg::Required, "    --load_node_map    \tA CPU:MEM pair of NUMA nodes on which to place load traffic-generating threads in loaded latency benchmarks, instead of co-locating them with the latency measurement thread. The latency measurement thread still uses each selected CPU/memory NUMA node combination. This option may be specified multiple times, in which case load threads are dealt round-robin across the given placements. This can be used to measure how traffic from other sockets inflates latency, e.g., a latency probe on node 0 reading node 0 memory while node 1 hammers node 0 memory." },
+        { LOAD_BANDWIDTH, 0, "", "load_bandwidth", MyArg::Required, "    --load_bandwidth    \tTarget aggregate bandwidth in MB/s for the load traffic-generating threads of loaded latency benchmarks, split evenly among them. Instead of accessing memory as fast as possible, each load thread meters its accesses in short time slices with a feedback controller so that it holds its share of the target. This makes it possible to measure latency at a given utilization that is comparable across platforms. The achieved bandwidth and the mean controller error are reported next to the requested bandwidth. If the target cannot be reached, the load threads run as fast as they can and a warning is reported." },
+        { LOAD_PROFILE, 0, "", "load_profile", MyArg::Required, "    --load_profile    \tA CSV file with a time-varying target aggregate bandwidth for the load traffic-generating threads of loaded latency benchmarks, e.g., to replay bursty or diurnal production traffic. Each line holds one TIME_MS,MBPS point, in non-decreasing order of time. Bandwidth is interpolated linearly between points, two points at the same time form a step, and the profile repeats after its last point. Load threads follow the profile with the same feedback controller as the load_bandwidth option. Each benchmark runs for at least one period of the profile, and the latency measurement thread records a time series of latency samples aligned with the profile. Latency at low and high load and the time for latency to recover after load drops are reported. This cannot be used in tandem with the load_bandwidth or load_burst options." },
+        { LOAD_BURST, 0, "", "load_burst", MyArg::Required, "    --load_burst    \tA periodic on/off burst load profile for loaded latency benchmarks, of the form ON_MS:OFF_MS:PEAK or ON_MS:OFF_MS:PEAK:BASE. The load threads generate PEAK MB/s in total for ON_MS milliseconds, then BASE MB/s (default 0) for OFF_MS milliseconds, and so on. See the load_profile option for how the profile is followed and reported. This cannot be used in tandem with the load_bandwidth or load_profile options." },
+        { LATENCY_TRACE, 0, "", "latency_trace", MyArg::Required, "    --latency_trace    \tWrite the latency time series recorded in loaded latency benchmarks with a load profile to the given file in CSV format, with one row per sampling interval and the load requested by the profile at that time. This only applies with the load_profile or load_burst options." },
+        { ALL_CORE_LATENCY, 0, "", "all_core_latency", Arg::None, "    --all_core_latency    \tAll-core latency benchmarking mode. In latency benchmarks, every worker thread measures latency at the same time using 64-bit random reads over its own disjoint pointer chain, instead of one latency measurement thread running next to load threads. The latency of each logical CPU is reported along with the fastest and slowest CPUs, which reveals how distance to the memory controllers differs across cores of a die. Use as many worker threads as there are logical CPUs in a NUMA node to cover all of them. This cannot be used in tandem with the load_node_map, load_bandwidth, load_profile, or load_burst options." },
+        { INTERFERE, 0, "", "interfere", MyArg::NonnegativeInteger, "    --interfere    \tInterference generator mode. Instead of running benchmarks, X-Mem starts the configured number of load traffic-generating threads, pinned to logical CPUs of the first selected CPU NUMA node and accessing memory of the first selected memory NUMA node, and keeps them running as a background memory hog while other software runs. The argument is the run time in seconds, or 0 to run until X-Mem receives SIGTERM or SIGINT (Ctrl-C). The load uses the first selected read/write mode, chunk size, and access pattern or stride, and holds the target bandwidth of the load_bandwidth option if given. Achieved bandwidth is printed periodically (see the report_interval option), and also written to the output file if one is given. This cannot be used in tandem with other benchmarking modes or the sweep options." },
+        { REPORT_INTERVAL, 0, "", "report_interval", MyArg::PositiveInteger, "    --report_interval    \tPeriod in milliseconds at which the interference generator mode reports achieved bandwidth. DEFAULT: 1000" },
+        { C2C_LATENCY, 0, "", "c2c_latency", Arg::None, "    --c2c_latency    \tCore-to-core cache line transfer latency benchmarking mode. For every pair of logical CPUs in the selected CPU NUMA nodes, two pinned threads bounce ownership of a shared cache line back and forth, so that each transfer moves the line in the modified state from one core to the other. The line is placed in the first selected memory NUMA node. The median one-way transfer latency over all iterations is reported as a CPU by CPU matrix, and pairs are grouped by topology into SMT siblings, cores sharing a last-level cache (e.g., the same CCX), cores in the same socket with different last-level caches, and cores in different sockets. The number of pairs grows quadratically with the number of CPUs; see the c2c_cpu_step option to sample a subset. This cannot be used in tandem with the sweep options." },
+        { C2C_CPU_STEP, 0, "", "c2c_cpu_step", MyArg::PositiveInteger, "    --c2c_cpu_step    \tOnly use every Nth logical CPU of each selected CPU NUMA node in the core-to-core benchmarks, to cover large machines in less time. DEFAULT: 1" },
+        { C2C_BANDWIDTH, 0, "", "c2c_bandwidth", Arg::None, "    --c2c_bandwidth    \tCore-to-core producer/consumer bandwidth benchmarking mode. For each pair of logical CPUs, a producer thread writes blocks into a shared ring buffer and a consumer thread on the other CPU reads them, so that the data moves between the cores through the cache hierarchy as in ring buffer based pipelines. The ring buffer is placed in the first selected memory NUMA node and its size is the working set size per thread, which should be chosen to fit the L2 or L3 cache of interest. The sustained transfer throughput with the ring kept full and the handoff latency with one block in flight at a time are reported for each pair and block size. See the c2c_pair and c2c_block_size options. This cannot be used in tandem with the sweep options." },
+        { C2C_PAIR, 0, "", "c2c_pair", MyArg::Required, "    --c2c_pair    \tA FIRST:SECOND pair of logical CPUs to use in the core-to-core benchmarks, e.g., a producer and a consumer CPU. This option may be specified multiple times. In the core-to-core latency mode, only the given pairs are measured. By default, the bandwidth mode pairs the first logical CPU of the selected CPU NUMA nodes with the nearest CPU of every topological relation (SMT sibling, shared last-level cache, same socket, other socket) that is present." },
+        { C2C_BLOCK_SIZE, 0, "", "c2c_block_size", MyArg::PositiveInteger, "    --c2c_block_size    \tA block size in bytes to move at a time in the core-to-core bandwidth mode. It must be a multiple of 64 B, and at most half of the working set size per thread so that the ring buffer holds at least two blocks. This option may be specified multiple times. DEFAULT: 4096" },
+        { ATOMICS, 0, "", "atomics", Arg::None, "    --atomics    \tAtomic operation contention benchmarking mode. Threads pinned to logical CPUs of the selected CPU NUMA nodes do atomic read-modify-write operations on 64-bit words in the first selected memory NUMA node, each on its own cache line (private), all on the same cache line (shared), or cycling over a fixed number of cache lines (spread). The number of threads grows from one to all selected logical CPUs, adding CPUs in order of topological distance from the first one (SMT sibling, shared last-level cache, same socket, other socket), so that the cost of contention can be seen as it crosses cores, CCXs, and sockets. The aggregate throughput in millions of operations per second and the mean latency per operation are reported for each setting. See the atomic_op, atomic_sharing, atomic_addresses, and c2c_cpu_step options. This cannot be used in tandem with the sweep options." },
+        { ATOMIC_OP, 0, "", "atomic_op", MyArg::Required, "    --atomic_op    \tAn atomic operation to benchmark in the atomic operation mode: xadd (fetch-and-add), cmpxchg (compare-and-swap of the last observed value, also reporting the failure rate), or xchg (swap). This option may be specified multiple times. DEFAULT: all of them" },
+        { ATOMIC_SHARING, 0, "", "atomic_sharing", MyArg::Required, "    --atomic_sharing    \tHow threads share cache lines in the atomic operation mode: private, shared, or spread. This option may be specified multiple times. DEFAULT: all of them" },
+        { ATOMIC_ADDRESSES, 0, "", "atomic_addresses", MyArg::PositiveInteger, "    --atomic_addresses    \tNumber of cache lines that all threads cycle over in the spread sharing mode of the atomic operation mode. Each thread starts on a different line. DEFAULT: 16" },
+        { FALSE_SHARING, 0, "", "false_sharing", Arg::None, "    --false_sharing    \tFalse sharing benchmarking mode. Pinned threads repeatedly write their own private 64-bit word in the first selected memory NUMA node, with a configurable amount of padding between the words of consecutive threads. With little padding, several private words share a cache line and every write takes the line away from the other cores. The aggregate write throughput and the mean time per write are reported for each padding, and relative to the largest padding, for pairs of logical CPUs at each topological distance (SMT sibling, shared last-level cache, same socket, other socket; see the c2c_pair option) and for the configured number of threads placed by topological distance if it is more than two. See the false_sharing_padding and false_sharing_work options. This cannot be used in tandem with the sweep options." },
+        { FALSE_SHARING_PADDING, 0, "", "false_sharing_padding", MyArg::NonnegativeInteger, "    --false_sharing_padding    \tPadding in bytes between the private words of consecutive threads in the false sharing mode. It must be a multiple of 8 B and at most 128 B. This option may be specified multiple times. DEFAULT: 0, 8, 24, 56, and 120, i.e., 8, 4, 2, and 1 words per 64 B cache line, and words on every other line" },
+        { FALSE_SHARING_WORK, 0, "", "false_sharing_work", MyArg::NonnegativeInteger, "    --false_sharing_work    \tIterations of register-only work that each thread does between writes in the false sharing mode, which lowers the write frequency. DEFAULT: 0 (write as fast as possible)" },
+        { FLUSH, 0, "", "flush", Arg::None, "    --flush    \tCache flush benchmarking mode. Each worker thread brings its own working set into the cache, either clean (read) or dirty (written), and then flushes all of its cache lines with a cache line flush instruction. Bringing the lines into the cache is not timed. For each flush instruction and line state, the aggregate flush throughput in MB/s is reported with flushes allowed to overlap until a fence at the end of the working set, and the latency of a single flush in ns/line is reported with a fence after every line. This runs for every selected CPU/memory NUMA node combination, and it follows the working set size and number of worker threads, including their sweeps. See the flush_op option. Only available on x86 processors." },
+        { FLUSH_OP, 0, "", "flush_op", MyArg::Required, "    --flush_op    \tA cache line flush instruction to benchmark in the cache flush mode: clflush, clflushopt, or clwb. This option may be specified multiple times. DEFAULT: all of them that the processor supports" },
+        { COLD_CACHE, 0, "", "cold_cache", Arg::None, "    --cold_cache    \tCold-cache latency mode. In latency benchmarks, the latency measurement threads flush their pointer chain out of the caches with clflush before each timed pass, instead of priming it once. The flushes are not timed. Each pass visits 512 pointers, so the working set size per thread should hold many more cache lines than that for every access to miss. This cannot be used in tandem with the load_profile or load_burst options. Only available on x86 processors." },
+        { COPY, 0, "", "copy", Arg::None, "    --copy    \tCopy/fill benchmarking mode. A single thread pinned to the first logical CPU of each selected CPU NUMA node times back-to-back copy or fill calls with each engine, for each call size and for the size distribution. The working set size per thread is split evenly into a source buffer on one memory NUMA node and a destination buffer on another, or the same, memory NUMA node, and consecutive calls walk through the buffers. Every combination of the selected memory NUMA nodes is used as source and destination. Throughput is reported in MB/s of copied or filled bytes, and the mean cost per call is reported in cycles of the time stamp counter (reference cycles), or in ns if X-Mem was built with the OS timer. See the copy_engine, copy_size, and copy_size_file options. This cannot be used in tandem with the sweep options." },
+        { COPY_ENGINE, 0, "", "copy_engine", MyArg::Required, "    --copy_engine    \tA copy or fill engine to benchmark in the copy/fill mode: memcpy, memmove, or memset from the C library, movsb or stosb for the rep movsb and rep stosb instructions, vector or vector_fill for X-Mem's 256-bit vector loads and stores, or vector_nt or vector_fill_nt for the same with non-temporal stores. This option may be specified multiple times. DEFAULT: all of them that are available on this build" },
+        { COPY_SIZE, 0, "", "copy_size", MyArg::PositiveInteger, "    --copy_size    \tA fixed call size in bytes in the copy/fill mode. Each size is benchmarked on its own. It must be at most half the working set size per thread. This option may be specified multiple times. DEFAULT: 64, 256, 1024, and 4096, unless the copy_size_file option is given" },
+        { COPY_SIZE_FILE, 0, "", "copy_size_file", MyArg::Required, "    --copy_size_file    \tA CSV file with one SIZE,WEIGHT point per line that gives the distribution of call sizes in bytes in the copy/fill mode, e.g., a histogram of the memcpy() sizes of a real workload. Call sizes are drawn from it up front with a fixed seed, so every engine sees the same sequence. Empty lines, lines starting with '#', and a header line are ignored. The largest size must be at most half the working set size per thread." },
+        { USE_READ_MODIFY_WRITE, 0, "", "read_modify_write", Arg::None, "    --read_modify_write    \tUse in-place read-modify-write patterns in load traffic-generating threads, where each chunk is loaded, modified, and stored back to the same location, as in counter, histogram, and column updates. This is available for all sequential and strided patterns and chunk sizes, but not for the random pattern, whose write kernels already read each location before writing it. Like the reads and writes options, it overrides the default of using both reads and writes." },
+        { RW_MIX, 0, "", "rw_mix", MyArg::Required, "    --rw_mix    \tA read/write mix to use in load traffic-generating threads, given as a READS:WRITES ratio of 1:1, 2:1, or 3:1. A mix reads one stream of memory and writes a separate one, interleaved a cache line at a time, rather than writing back the locations it reads. Random-access mixes write back one location out of each group of reads to keep the pointer chain intact. Mixes are only available for the forward sequential pattern (a stride of 1) and the random pattern, with chunks of up to 256 bits; other combinations are skipped. This option may be specified multiple times. Like the reads and writes options, it overrides the default of using both reads and writes, so combine it with them to measure pure reads and writes too." },
+        { GATHER, 0, "", "gather", Arg::None, "    --gather    \tGather/scatter benchmarking mode. Each worker thread splits its working set into an array of 64-bit elements and an array of 32-bit indices into it, and repeatedly loads (gathers) or stores (scatters) the element at every index with each engine, for each index pattern. The index patterns are sequential, strided, random within a window, and fully random, and each of them touches every element exactly once per pass. The aggregate element throughput in millions of elements per second is reported along with the effective bandwidth in MB/s of 8 B elements, which excludes the index loads, and a summary table compares the vector engines to scalar loads and stores. This runs for every selected CPU/memory NUMA node combination, and it follows the working set size and number of worker threads, including their sweeps. See the gather_engine, gather_index, gather_stride, and gather_window options." },
+        { GATHER_ENGINE, 0, "", "gather_engine", MyArg::Required, "    --gather_engine    \tA gather or scatter engine to benchmark in the gather/scatter mode: scalar_load or scalar_store for one scalar access per index, gather_avx2 for AVX2 gathers, or gather_avx512 or scatter_avx512 for AVX-512 gathers and scatters. This option may be specified multiple times. DEFAULT: all of them that the processor supports" },
+        { GATHER_INDEX, 0, "", "gather_index", MyArg::Required, "    --gather_index    \tAn index pattern to use in the gather/scatter mode: sequential, strided, window, or random. This option may be specified multiple times. DEFAULT: all of them" },
+        { GATHER_STRIDE, 0, "", "gather_stride", MyArg::PositiveInteger, "    --gather_stride    \tDistance in 64-bit elements between consecutive indices of the strided index pattern in the gather/scatter mode. The index stream wraps around with an offset of one element each time it reaches the end of the array. DEFAULT: 8, or one element per 64 B cache line" },
+        { GATHER_WINDOW, 0, "", "gather_window", MyArg::PositiveInteger, "    --gather_window    \tWindow size in bytes of the window index pattern in the gather/scatter mode. Consecutive windows of the element array are visited in order, and the elements within each window are visited in random order. It must be a multiple of 8. DEFAULT: 4096" },
+        { MULTI_STREAM, 0, "", "multi_stream", Arg::None, "    --multi_stream    \tMulti-stream sequential read benchmarking mode. Each worker thread splits its working set into K equal streams and reads them at the same time, one whole cache line of each stream in turn, either forward or in reverse. The aggregate read throughput in MB/s is reported for every stream count, and the first stream count at which the throughput drops well below the best throughput at fewer streams is reported as the stream-tracking cliff of the hardware prefetchers. This runs for every selected CPU/memory NUMA node combination, and it follows the working set size and number of worker threads, including their sweeps. See the stream_count option." },
+        { STREAM_COUNT, 0, "", "stream_count", MyArg::PositiveInteger, "    --stream_count    \tA number of concurrent sequential streams per thread in the multi-stream mode, from 1 to 64. This option may be specified multiple times. DEFAULT: 1 to 16 streams in steps of 1, then 20 to 32 in steps of 4, then 40 to 64 in steps of 8" },
+        { UNALIGNED, 0, "", "unaligned", Arg::None, "    --unaligned    \tUnaligned access benchmarking mode. For each chunk size and byte offset from a cache line boundary, worker threads measure forward sequential read and write throughput with unaligned loads and stores that start at the offset, and the latency of chasing pointers that sit at the offset in random cache lines. Accesses at offsets that are not a multiple of the chunk size straddle cache lines, and some of them straddle pages. The penalty relative to aligned accesses at offset 0 is reported for each chunk size, along with the share of accesses that are split. This runs for every selected CPU/memory NUMA node combination, and it follows the chunk size, working set size, and number of worker threads options, including their sweeps. 32-bit chunks are only used for throughput, and 512-bit chunks are not supported. See the unaligned_offset option. Only available on x86 processors." },
+        { UNALIGNED_OFFSET, 0, "", "unaligned_offset", MyArg::NonnegativeInteger, "    --unaligned_offset    \tA byte offset from a cache line boundary, from 0 to 63, to use in the unaligned access mode. Offset 0 is always included as the aligned baseline. This option may be specified multiple times. DEFAULT: 0, 1, 4, 8, 16, 32, and 60" },
+        { DATA_SENSITIVITY, 0, "", "data_sensitivity", Arg::None, "    --data_sensitivity    \tData pattern benchmarking mode. For each data pattern and chunk size, every worker thread initializes its working set with the pattern, then measures forward sequential read throughput on it, and then the throughput of writing copies of an 8 KB block of the pattern over it. Some platforms use memory compression, data bus inversion, or zero-line optimizations, so their bandwidth and power depend on the data. The mean and peak DRAM power of every measurement are reported where power readers are available, and a summary table compares the patterns. This runs for every selected CPU/memory NUMA node combination, and it follows the chunk size, working set size, and number of worker threads options, including their sweeps. Working set sizes must be multiples of 8 KB and at least 16 KB. See the data_pattern and data_pattern_file options." },
+        { DATA_PATTERN, 0, "", "data_pattern", MyArg::Required, "    --data_pattern    \tA data pattern: zeros, ones, alternating, random, or file. Alternating 64-bit words hold 0x55...55 and 0xAA...AA, and random data are incompressible. This option may be specified multiple times to select the patterns of the data pattern mode. If it is given, all memory regions are also initialized with the first pattern before any benchmark runs, which otherwise read memory in whatever state it was allocated. DEFAULT: zeros, ones, alternating, random, and file if a data pattern file is given" },
+        { DATA_PATTERN_FILE, 0, "", "data_pattern_file", MyArg::Required, "    --data_pattern_file    \tA file whose contents are repeated over memory for the file data pattern, e.g., a dump of real application data. At most the first 64 MB are used." },
+        { TILED, 0, "", "tiled", Arg::None, "    --tiled    \tTwo-dimensional (2D) tiled benchmarking mode. Each worker thread lays its working set out as a 2D array of 64-bit elements with padded rows, and measures the throughput of reading and writing every element in each traversal order: row-major, column-major, blocked by tiles, and tiles in Morton (Z) order. The transpose order copies the array in the first half of the working set into its transpose in the second half, tile by tile, and reports the bytes copied per second. Row pitches, row widths, and tile shapes change the cache and TLB behavior of the traversals, as in image processing and matrix code. This runs for every selected CPU/memory NUMA node combination, and it follows the read/write mode, working set size, and number of worker threads options, including their sweeps. See the tile_order, row_pitch, row_width, tile_width, and tile_height options." },
+        { TILE_ORDER, 0, "", "tile_order", MyArg::Required, "    --tile_order    \tA traversal order to use in the 2D tiled mode: row, column, blocked, morton, or transpose. This option may be specified multiple times. DEFAULT: all of them" },
+        { ROW_PITCH, 0, "", "row_pitch", MyArg::PositiveInteger, "    --row_pitch    \tDistance in bytes between the starts of consecutive rows in the 2D tiled mode. It must be a multiple of 8 B. The number of rows is the working set size divided by the pitch, or half of that for the transpose. DEFAULT: 4096" },
+        { ROW_WIDTH, 0, "", "row_width", MyArg::PositiveInteger, "    --row_width    \tLength in bytes of each row in the 2D tiled mode. It must be a multiple of 8 B and at most the row pitch, and the rest of the pitch is padding. DEFAULT: the row pitch" },
+        { TILE_WIDTH, 0, "", "tile_width", MyArg::PositiveInteger, "    --tile_width    \tNumber of 64-bit elements in each row of a tile in the 2D tiled mode. DEFAULT: 8" },
+        { TILE_HEIGHT, 0, "", "tile_height", MyArg::PositiveInteger, "    --tile_height    \tNumber of rows in a tile in the 2D tiled mode. DEFAULT: 8" },
+        { ROOFLINE, 0, "", "roofline", Arg::None, "    --roofline    \tRoofline benchmarking mode. Each worker thread reads its working set sequentially and applies a fixed number of multiply-adds to every 64-bit element it loads, sweeping the arithmetic intensity in operations per byte loaded. Each multiply-add counts as two operations, and the floating-point engines use double-precision fused multiply-adds. Both the operation throughput in GFLOP/s (or GOP/s for integer engines) and the load throughput are reported, and a summary table estimates the compute roof, the memory roof, and the ridge point where they meet. Working set sizes that fit in each cache level and in memory, together with the NUMA node options, give an empirical roofline per cache level and NUMA node. This runs for every selected CPU/memory NUMA node combination, and it follows the working set size and number of worker threads options, including their sweeps. Working set sizes must be multiples of 512 B. Worker threads overwrite their working sets with floating-point ones. See the roofline_engine and ops_per_element options." },
+        { ROOFLINE_ENGINE, 0, "", "roofline_engine", MyArg::Required, "    --roofline_engine    \tA compute engine to use in the roofline mode: scalar_fma, avx2_fma, avx512_fma, or scalar_int. The FMA engines load 1, 4, or 8 doubles per instruction, and scalar_int does 64-bit integer multiplies and adds. The vector engines are only available on x86-64 processors that support them. This option may be specified multiple times. DEFAULT: all engines that the build and processor support" },
+        { OPS_PER_ELEMENT, 0, "", "ops_per_element", MyArg::PositiveInteger, "    --ops_per_element    \tA number of operations per loaded 64-bit element in the roofline mode. It must be even, as each multiply-add counts as two. The arithmetic intensity is this number divided by 8 B. This option may be specified multiple times. DEFAULT: 2, 4, 8, and so on up to 256" },
+        { DELAY_SWEEP, 0, "", "delay_sweep", MyArg::Required, "    --delay_sweep    \tThe delays to inject between load thread memory accesses in the delay-injected loaded latency benchmark extension, which traces a latency vs. load bandwidth curve. The argument has the form MIN:MAX or MIN:MAX:STEP, where MIN and MAX are numbers of nops, and STEP is either +N to add N nops at each point (the default is +1) or xF to multiply the delay by F at each point, where F is a real number greater than 1. Multiplicative steps always advance by at least one nop. A delay of 0 uses the regular load kernels at full speed. The extension uses the selected access patterns, read/write modes, chunk sizes, and strides for its load threads. The default is 0:1024:x1.25. This only applies if the extension is run." },
         { UNKNOWN, 0, "", "", Arg::None,
         "\n"
         "If a given option is not specified, X-Mem defaults will be used where appropriate.\n"
@@ -127,6 +243,11 @@ namespace xmem {
         "        xmem -w128 -n3 -j4 -l -t --extension=0 -e1 -s -S1 -S-4 -r -S16 -R -W -u -L -v\n"
         "\n"
         "\n"
+        "Trace a dense loaded latency vs. bandwidth curve with 8 worker threads, where the 7 load threads do 128-bit random writes and inject every delay from 0 to 256 nops in steps of 4.\n"
+        "\n"
+        "        xmem -e0 -j8 -r -W -c128 -w262144 --delay_sweep=0:256:+4\n"
+        "\n"
+        "\n"
         "Measure sequential write throughput to remote DRAM from socket 0 using 12 worker threads and chunk size of 256-bits.\n"
         "\n"
         "        xmem -j12 -c256 -C0 -M1 -W -w262144 -s"
@@ -136,6 +257,117 @@ namespace xmem {
         "\n"
         "        xmem -a -v -ftest.csv -L\n"
         "\n"
+        "\n"
+        "Measure unloaded latency and single-threaded sequential read throughput for working set sizes from 4 KB to 1 GB, doubling at each point, on every CPU/memory NUMA node pair. Memory is allocated only once per NUMA node.\n"
+        "\n"
+        "        xmem -t -l -R -s --ws_sweep=4K:1G:x2\n"
+        "\n"
+        "\n"
+        "Measure how sequential read throughput from DRAM scales from 1 thread up to every logical CPU in each NUMA node, using a working set of 256 MB per thread.\n"
+        "\n"
+        "        xmem -t -R -s -w262144 --threads_sweep=1:all\n"
+        "\n"
+        "\n"
+        "Measure the system-wide peak sequential read throughput with 8 worker threads per NUMA node all reading local memory at the same time, then with node 0 and node 1 both reading memory on node 1.\n"
+        "\n"
+        "        xmem --all_nodes -R -s -j8 -w262144\n"
+        "        xmem --node_map=0:1 --node_map=1:1 -R -s -j8 -w262144\n"
+        "\n"
+        "\n"
+        "Compare the idle NUMA node throughput matrix against the bidirectional and all-to-all loaded matrices using 4 worker threads per node pair, 256-bit sequential reads, and a working set size of 64 MB per thread.\n"
+        "\n"
+        "        xmem --interconnect -R -s -c256 -j4 -w65536\n"
+        "\n"
+        "\n"
+        "Measure the latency seen by a thread on node 0 reading node 0 memory while 8 load threads on node 1 read node 0 memory as fast as possible.\n"
+        "\n"
+        "        xmem -l -C0 -M0 -j9 -R -s --load_node_map=1:0\n"
+        "\n"
+        "\n"
+        "Measure loaded latency on each NUMA node while 8 load threads hold 40 GB/s of sequential reads in total, regardless of how fast the platform could go.\n"
+        "\n"
+        "        xmem -l -j9 -R -s --load_bandwidth=40960\n"
+        "\n"
+        "Measure how latency reacts to 10 ms bursts of 40 GB/s of sequential reads every 100 ms, and write the latency time series to trace.csv.\n"
+        "\n"
+        "        xmem -l -j9 -R -s --load_burst=10:90:40960 --latency_trace=trace.csv\n"
+        "\n"
+        "Measure the latency to NUMA node 0 memory from each of 16 logical CPUs in NUMA node 0 at the same time, with 64 MB pointer chains per CPU.\n"
+        "\n"
+        "        xmem -l -j16 -C0 -M0 -w65536 --all_core_latency\n"
+        "\n"
+        "Keep 4 threads on NUMA node 0 generating 10 GB/s of random 64-bit reads in total to node 1 memory in the background until terminated, logging the achieved bandwidth every 500 ms to hog.csv.\n"
+        "\n"
+        "        xmem --interfere=0 -j4 -C0 -M1 -r -R -c64 -w65536 --load_bandwidth=10240 --report_interval=500 -f hog.csv\n"
+        "\n"
+        "Measure the cache line transfer latency between every pair of logical CPUs in NUMA nodes 0 and 1 with 3 iterations per pair, and between every other logical CPU only.\n"
+        "\n"
+        "        xmem --c2c_latency -C0 -C1 -M0 -n3\n"
+        "        xmem --c2c_latency -C0 -C1 -M0 -n3 --c2c_cpu_step=2\n"
+        "\n"
+        "Measure producer/consumer bandwidth and handoff latency from logical CPU 0 to logical CPUs 1 and 8 through a 1 MB ring buffer, moving blocks of 256 B and 16 KB.\n"
+        "\n"
+        "        xmem --c2c_bandwidth -w1024 --c2c_pair=0:1 --c2c_pair=0:8 --c2c_block_size=256 --c2c_block_size=16384\n"
+        "\n"
+        "Measure how lock xadd and lock cmpxchg throughput degrades as threads on NUMA nodes 0 and 1 contend for a single cache line or for 4 cache lines.\n"
+        "\n"
+        "        xmem --atomics -C0 -C1 -M0 --atomic_op=xadd --atomic_op=cmpxchg --atomic_sharing=shared --atomic_sharing=spread --atomic_addresses=4\n"
+        "\n"
+        "Measure the cost of false sharing between 8 threads and between pairs of logical CPUs, with 0 B and 56 B padding between their words and some work between writes.\n"
+        "\n"
+        "        xmem --false_sharing -j8 -C0 -M0 --false_sharing_padding=0 --false_sharing_padding=56 --false_sharing_work=20\n"
+        "\n"
+        "Measure the throughput and latency of flushing clean and dirty lines with clflushopt and clwb, for 4 KB to 64 MB per thread and 1 to 8 threads.\n"
+        "\n"
+        "        xmem --flush -C0 -M0 --ws_sweep=4K:64M:x4 --threads_sweep=1:8:x2 --flush_op=clflushopt --flush_op=clwb\n"
+        "\n"
+        "Measure unloaded memory latency with the pointer chain flushed out of the caches before each pass.\n"
+        "\n"
+        "        xmem -l -w262144 --cold_cache\n"
+        "\n"
+        "Compare memcpy, rep movsb, and non-temporal vector copies for a size distribution, with every source/destination placement across memory NUMA nodes 0 and 1.\n"
+        "\n"
+        "        xmem --copy -w65536 -C0 -M0 -M1 --copy_engine=memcpy --copy_engine=movsb --copy_engine=vector_nt --copy_size_file=sizes.csv\n"
+        "\n"
+        "Measure sequential and random throughput for pure reads and for 1:1 and 3:1 read/write mixes across all NUMA node pairs.\n"
+        "\n"
+        "        xmem -t -R -S1 -s -r -w65536 --rw_mix=1:1 --rw_mix=3:1\n"
+        "\n"
+        "Compare stores with in-place read-modify-write updates for forward, reverse, and stride 4 patterns with 64-bit and 256-bit chunks.\n"
+        "\n"
+        "        xmem -t -W --read_modify_write -s -S1 -S-1 -S4 -c64 -c256 -w65536\n"
+        "\n"
+        "Compare AVX2 and AVX-512 gathers to scalar loads on a 16 MB working set per thread with 2 worker threads, using strided indices that skip 4 elements at a time and random indices within 64 KB windows.\n"
+        "\n"
+        "        xmem --gather -w16384 -j2 --gather_engine=scalar_load --gather_engine=gather_avx2 --gather_engine=gather_avx512 --gather_index=strided --gather_index=window --gather_stride=4 --gather_window=65536\n"
+        "\n"
+        "\n"
+        "Find the prefetcher stream-tracking cliff with a 64 MB working set per thread, reading 1 to 32 streams at once.\n"
+        "\n"
+        "        xmem --multi_stream -w65536 --stream_count=1 --stream_count=2 --stream_count=4 --stream_count=8 --stream_count=16 --stream_count=24 --stream_count=32\n"
+        "\n"
+        "\n"
+        "Measure the cost of unaligned 64-bit and 256-bit accesses that start 1 B or 60 B past a cache line boundary, compared to aligned accesses, on a 1 MB working set per thread.\n"
+        "\n"
+        "        xmem --unaligned -w1024 -c64 -c256 --unaligned_offset=1 --unaligned_offset=60\n"
+        "\n"
+        "\n"
+        "Compare the write bandwidth and DRAM power of zeros, random data, and a dump of application data with 256-bit stores on a 64 MB working set per thread.\n"
+        "\n"
+        "        xmem --data_sensitivity -w65536 -c256 --data_pattern=zeros --data_pattern=random --data_pattern=file --data_pattern_file=heap.bin\n"
+        "\n"
+        "\n"
+        "Compare column-major and blocked reads of a 16 MB array per thread with 4 KB rows, without and with 64 B of padding per row.\n"
+        "\n"
+        "        xmem --tiled -w16384 -R --tile_order=column --tile_order=blocked --row_width=4096 --row_pitch=4096\n"
+        "        xmem --tiled -w16384 -R --tile_order=column --tile_order=blocked --row_width=4096 --row_pitch=4160\n"
+        "\n"
+        "\n"
+        "Draw an empirical roofline of the AVX2 engine with one thread for a 16 KB working set that fits in the L1 cache and a 256 MB one in memory.\n"
+        "\n"
+        "        xmem --roofline --roofline_engine=avx2_fma --ws_sweep=16:262144:x16384\n"
+        "\n"
+        "\n"
         "Have fun! =]\n"
         },
         { 0, 0, 0, 0, 0, 0 }
@@ -171,6 +403,12 @@ namespace xmem {
          * @returns True if it should be run.
          */
         bool runExtDelayInjectedLoadedLatencyBenchmark() const { return run_ext_delay_injected_loaded_latency_benchmark_; }
+
+        /**
+         * @brief If included at compile-time, gets the delays to inject in load threads of the delay-injected loaded latency benchmark extension.
+         * @returns The delays in nops, in increasing order.
+         */
+        std::list<uint32_t> getExtDelayInjectedLoadedLatencyDelays() const { return ext_delay_injected_loaded_latency_delays_; }
 #endif
 
 #ifdef EXT_STREAM_BENCHMARK
@@ -193,12 +431,366 @@ namespace xmem {
          */
         bool throughputTestSelected() const { return run_throughput_; }
 
+        /**
+         * @brief Indicates if the concurrent all-node throughput test has been selected.
+         * @returns True if the concurrent all-node throughput test has been selected to run.
+         */
+        bool concurrentThroughputTestSelected() const { return run_concurrent_throughput_; }
+
+        /**
+         * @brief Gets the CPU/memory NUMA node placements that run at the same time in the concurrent all-node throughput test.
+         * @returns The list of placements as (CPU NUMA node, memory NUMA node) pairs.
+         */
+        std::list<std::pair<uint32_t, uint32_t> > getConcurrentPlacements() const { return concurrent_placements_; }
+
+        /**
+         * @brief Indicates if the NUMA interconnect test has been selected.
+         * @returns True if the NUMA interconnect test has been selected to run.
+         */
+        bool interconnectTestSelected() const { return run_interconnect_; }
+
+        /**
+         * @brief Indicates if the interference generator mode has been selected.
+         * @returns True if the interference generator should run instead of benchmarks.
+         */
+        bool interferenceSelected() const { return run_interference_; }
+
+        /**
+         * @brief Gets the run time of the interference generator mode.
+         * @returns The run time in seconds, or 0 if the interference generator should run until it receives a stop signal.
+         */
+        uint32_t getInterferenceDuration() const { return interference_duration_s_; }
+
+        /**
+         * @brief Gets the period at which the interference generator mode reports achieved bandwidth.
+         * @returns The report interval in milliseconds.
+         */
+        uint32_t getInterferenceReportInterval() const { return interference_report_interval_ms_; }
+
+        /**
+         * @brief Indicates if the core-to-core cache line transfer latency test has been selected.
+         * @returns True if the core-to-core latency test has been selected to run.
+         */
+        bool coreToCoreLatencyTestSelected() const { return run_c2c_latency_; }
+
+        /**
+         * @brief Gets the step between logical CPUs of a NUMA node used in the core-to-core benchmarks.
+         * @returns The step. 1 means every logical CPU is used.
+         */
+        uint32_t getCoreToCoreCPUStep() const { return c2c_cpu_step_; }
+
+        /**
+         * @brief Indicates if the core-to-core producer/consumer bandwidth test has been selected.
+         * @returns True if the core-to-core bandwidth test has been selected to run.
+         */
+        bool coreToCoreBandwidthTestSelected() const { return run_c2c_bandwidth_; }
+
+        /**
+         * @brief Gets the pairs of logical CPUs given by the user for the core-to-core benchmarks.
+         * @returns The list of (first, second) logical CPU pairs, or an empty list if the benchmarks should choose their own.
+         */
+        std::list<std::pair<uint32_t, uint32_t> > getCoreToCorePairs() const { return c2c_pairs_; }
+
+        /**
+         * @brief Gets the block sizes of the core-to-core bandwidth test.
+         * @returns The block sizes in bytes, in increasing order.
+         */
+        std::list<size_t> getCoreToCoreBlockSizes() const { return c2c_block_sizes_; }
+
+        /**
+         * @brief Indicates if the atomic operation contention test has been selected.
+         * @returns True if the atomic operation test has been selected to run.
+         */
+        bool atomicsTestSelected() const { return run_atomics_; }
+
+        /**
+         * @brief Gets the atomic operations to benchmark in the atomic operation test.
+         * @returns The list of atomic operations.
+         */
+        std::list<atomic_op_t> getAtomicOps() const { return atomic_ops_; }
+
+        /**
+         * @brief Gets the ways threads share cache lines in the atomic operation test.
+         * @returns The list of sharing modes.
+         */
+        std::list<atomic_sharing_t> getAtomicSharingModes() const { return atomic_sharing_modes_; }
+
+        /**
+         * @brief Gets the number of cache lines that threads cycle over in the spread sharing mode of the atomic operation test.
+         * @returns The number of cache lines.
+         */
+        uint32_t getAtomicSpreadAddresses() const { return atomic_spread_addresses_; }
+
+        /**
+         * @brief Indicates if the false sharing test has been selected.
+         * @returns True if the false sharing test has been selected to run.
+         */
+        bool falseSharingTestSelected() const { return run_false_sharing_; }
+
+        /**
+         * @brief Gets the paddings between the private words of consecutive threads in the false sharing test.
+         * @returns The paddings in bytes, in increasing order.
+         */
+        std::list<uint32_t> getFalseSharingPaddings() const { return false_sharing_paddings_; }
+
+        /**
+         * @brief Gets the amount of work that each thread does between writes in the false sharing test.
+         * @returns The number of iterations of register-only work.
+         */
+        uint32_t getFalseSharingWork() const { return false_sharing_work_; }
+
+        /**
+         * @brief Indicates if the cache flush test has been selected.
+         * @returns True if the cache flush test has been selected to run.
+         */
+        bool flushTestSelected() const { return run_flush_; }
+
+        /**
+         * @brief Gets the cache line flush instructions to benchmark in the cache flush test.
+         * @returns The list of flush instructions.
+         */
+        std::list<flush_op_t> getFlushOps() const { return flush_ops_; }
+
+        /**
+         * @brief Gets the CPU/memory NUMA node placements of load threads in loaded latency benchmarks.
+         * @returns The list of placements as (CPU NUMA node, memory NUMA node) pairs, or an empty list if load threads should be co-located with the latency measurement thread.
+         */
+        std::list<std::pair<uint32_t, uint32_t> > getLatencyLoadPlacements() const { return latency_load_placements_; }
+
+        /**
+         * @brief Gets the target aggregate bandwidth of load threads in loaded latency benchmarks.
+         * @returns The target bandwidth in MB/s, or 0 if load threads should run as fast as possible.
+         */
+        double getLoadTargetBandwidth() const { return load_target_bandwidth_; }
+
+        /**
+         * @brief Determines whether every worker thread in latency benchmarks measures latency at the same time.
+         * @returns True in all-core latency mode.
+         */
+        bool useAllCoreLatency() const { return all_core_latency_; }
+
+        /**
+         * @brief Determines whether latency measurement threads flush their pointer chain before each timed pass instead of priming it.
+         * @returns True in cold-cache latency mode.
+         */
+        bool useColdCacheLatency() const { return cold_cache_latency_; }
+
+        /**
+         * @brief Indicates if the copy/fill test has been selected.
+         * @returns True if the copy/fill test has been selected to run.
+         */
+        bool copyTestSelected() const { return run_copy_; }
+
+        /**
+         * @brief Gets the copy and fill engines to benchmark in the copy/fill test.
+         * @returns The list of engines.
+         */
+        std::list<copy_engine_t> getCopyEngines() const { return copy_engines_; }
+
+        /**
+         * @brief Gets the fixed call sizes of the copy/fill test.
+         * @returns The sizes in bytes, in increasing order. Each one is benchmarked on its own.
+         */
+        std::list<size_t> getCopySizes() const { return copy_sizes_; }
+
+        /**
+         * @brief Gets the distribution of call sizes of the copy/fill test.
+         * @returns The distribution, which is empty if none should be used.
+         */
+        const CopySizeDistribution& getCopySizeDistribution() const { return copy_size_distribution_; }
+
+        /**
+         * @brief Indicates if the gather/scatter test has been selected.
+         * @returns True if the gather/scatter test has been selected to run.
+         */
+        bool gatherTestSelected() const { return run_gather_; }
+
+        /**
+         * @brief Gets the gather and scatter engines to benchmark in the gather/scatter test.
+         * @returns The list of engines.
+         */
+        std::list<gather_engine_t> getGatherEngines() const { return gather_engines_; }
+
+        /**
+         * @brief Gets the index patterns to use in the gather/scatter test.
+         * @returns The list of index patterns.
+         */
+        std::list<gather_index_t> getGatherIndexPatterns() const { return gather_index_patterns_; }
+
+        /**
+         * @brief Gets the stride of the strided index pattern in the gather/scatter test.
+         * @returns The stride in 64-bit elements.
+         */
+        size_t getGatherStride() const { return gather_stride_; }
+
+        /**
+         * @brief Gets the window size of the window index pattern in the gather/scatter test.
+         * @returns The window size in bytes.
+         */
+        size_t getGatherWindowSize() const { return gather_window_size_; }
+
+        /**
+         * @brief Indicates if the multi-stream test has been selected.
+         * @returns True if the multi-stream test has been selected to run.
+         */
+        bool multiStreamTestSelected() const { return run_multi_stream_; }
+
+        /**
+         * @brief Gets the numbers of concurrent sequential streams per thread in the multi-stream test.
+         * @returns The stream counts, in increasing order.
+         */
+        std::list<uint32_t> getStreamCounts() const { return stream_counts_; }
+
+        /**
+         * @brief Indicates if the unaligned access test has been selected.
+         * @returns True if the unaligned access test has been selected to run.
+         */
+        bool unalignedTestSelected() const { return run_unaligned_; }
+
+        /**
+         * @brief Gets the byte offsets from a cache line boundary to use in the unaligned access test.
+         * @returns The offsets, in increasing order. The first one is always 0.
+         */
+        std::list<size_t> getUnalignedOffsets() const { return unaligned_offsets_; }
+
+        /**
+         * @brief Indicates if the data pattern test has been selected.
+         * @returns True if the data pattern test has been selected to run.
+         */
+        bool dataPatternTestSelected() const { return run_data_pattern_; }
+
+        /**
+         * @brief Gets the data patterns to use in the data pattern test.
+         * @returns The data patterns.
+         */
+        std::list<data_pattern_t> getDataPatterns() const { return data_patterns_; }
+
+        /**
+         * @brief Determines whether memory regions should be initialized with a data pattern after they are allocated.
+         * @returns True if memory should be initialized.
+         */
+        bool useDataPatternInitialization() const { return use_data_pattern_init_; }
+
+        /**
+         * @brief Gets the data pattern that memory regions are initialized with.
+         * @returns The data pattern.
+         */
+        data_pattern_t getDataPatternInitialization() const { return data_pattern_init_; }
+
+        /**
+         * @brief Gets the contents of the data pattern file.
+         * @returns The bytes of the file. Empty if no file was given.
+         */
+        const std::vector<uint8_t>& getDataPatternFileData() const { return data_pattern_file_data_; }
+
+        /**
+         * @brief Indicates if the 2D tiled test has been selected.
+         * @returns True if the 2D tiled test has been selected to run.
+         */
+        bool tiledTestSelected() const { return run_tiled_; }
+
+        /**
+         * @brief Gets the traversal orders to use in the 2D tiled test.
+         * @returns The traversal orders.
+         */
+        std::list<tile_order_t> getTileOrders() const { return tile_orders_; }
+
+        /**
+         * @brief Gets the distance between the starts of consecutive rows in the 2D tiled test.
+         * @returns The row pitch in bytes.
+         */
+        size_t getRowPitch() const { return row_pitch_; }
+
+        /**
+         * @brief Gets the length of each row in the 2D tiled test.
+         * @returns The row width in bytes.
+         */
+        size_t getRowWidth() const { return row_width_; }
+
+        /**
+         * @brief Gets the number of elements in each row of a tile in the 2D tiled test.
+         * @returns The tile width in 64-bit elements.
+         */
+        size_t getTileWidth() const { return tile_width_; }
+
+        /**
+         * @brief Gets the number of rows in a tile in the 2D tiled test.
+         * @returns The tile height in rows.
+         */
+        size_t getTileHeight() const { return tile_height_; }
+
+        /**
+         * @brief Indicates if the roofline test has been selected.
+         * @returns True if the roofline test has been selected to run.
+         */
+        bool rooflineTestSelected() const { return run_roofline_; }
+
+        /**
+         * @brief Gets the compute engines to use in the roofline test.
+         * @returns The engines.
+         */
+        std::list<roofline_engine_t> getRooflineEngines() const { return roofline_engines_; }
+
+        /**
+         * @brief Gets the numbers of operations per loaded element to sweep in the roofline test.
+         * @returns The numbers of operations per 64-bit element, in increasing order.
+         */
+        std::list<uint32_t> getOpsPerElement() const { return ops_per_element_; }
+
+        /**
+         * @brief Determines whether load threads in loaded latency benchmarks follow a time-varying load profile.
+         * @returns True if a load profile should be used.
+         */
+        bool useLoadProfile() const { return !load_profile_.isEmpty(); }
+
+        /**
+         * @brief Gets the time-varying load profile of load threads in loaded latency benchmarks.
+         * @returns The load profile, which is empty if none should be used.
+         */
+        const LoadProfile& getLoadProfile() const { return load_profile_; }
+
+        /**
+         * @brief Determines whether to write the latency time series of loaded latency benchmarks with a load profile to a CSV file.
+         * @returns True if a latency trace file should be used.
+         */
+        bool useLatencyTraceFile() const { return use_latency_trace_file_; }
+
+        /**
+         * @brief Gets the latency trace filename to use, if applicable.
+         * @returns The latency trace filename to use if useLatencyTraceFile() returns true. Otherwise return value is "".
+         */
+        std::string getLatencyTraceFilename() const { return latency_trace_filename_; }
+
+        /**
+         * @brief Gets the largest number of placements that access any single memory NUMA node at the same time. This determines how much memory needs to be allocated per node.
+         * @returns The largest number of placements per memory NUMA node, which is at least 1.
+         */
+        uint32_t getMaxPlacementsPerMemoryNode() const;
+
         /**
          * @brief Gets the working set size in bytes for each worker thread, if applicable.
          * @returns The working set size in bytes.
          */
         size_t getWorkingSetSizePerThread() const { return working_set_size_per_thread_; }
 
+        /**
+         * @brief Determines whether the working set size per thread should be swept.
+         * @returns True if a working set size sweep should be performed.
+         */
+        bool useWorkingSetSizeSweep() const { return use_working_set_size_sweep_; }
+
+        /**
+         * @brief Gets the working set sizes in bytes for each worker thread to use in a sweep, if applicable.
+         * @returns The working set sizes in bytes, in increasing order.
+         */
+        std::list<size_t> getWorkingSetSizeSweep() const { return working_set_size_sweep_; }
+
+        /**
+         * @brief Gets the largest working set size in bytes for each worker thread that may be used by any benchmark. This is what needs to be allocated.
+         * @returns The largest working set size in bytes.
+         */
+        size_t getMaxWorkingSetSizePerThread() const { return use_working_set_size_sweep_ ? working_set_size_sweep_.back() : working_set_size_per_thread_; }
+
         /**
          * @brief Determines if chunk size of 32 bits should be used in relevant benchmarks.
          * @returns True if 32-bit chunks should be used.
@@ -279,6 +871,24 @@ namespace xmem {
          */
         uint32_t getNumWorkerThreads() const { return num_worker_threads_; }
 
+        /**
+         * @brief Determines whether the number of worker threads should be swept.
+         * @returns True if a worker thread count sweep should be performed.
+         */
+        bool useNumWorkerThreadsSweep() const { return use_num_worker_threads_sweep_; }
+
+        /**
+         * @brief Gets the numbers of worker threads to use in a sweep, if applicable.
+         * @returns The worker thread counts, in increasing order.
+         */
+        std::list<uint32_t> getNumWorkerThreadsSweep() const { return num_worker_threads_sweep_; }
+
+        /**
+         * @brief Gets the largest number of worker threads that may be used by any benchmark. This determines how much memory needs to be allocated.
+         * @returns The largest number of worker threads.
+         */
+        uint32_t getMaxNumWorkerThreads() const { return use_num_worker_threads_sweep_ ? num_worker_threads_sweep_.back() : num_worker_threads_; }
+
         /** 
          * @brief Gets the numerical index of the first benchmark for CSV output purposes.
          * @returns The starting benchmark index.
@@ -327,6 +937,18 @@ namespace xmem {
          */
         bool useWrites() const { return use_writes_; }
 
+        /**
+         * @brief Gets the read/write mixes that should be used in throughput benchmarks, in addition to plain reads and writes.
+         * @returns The read/write modes of the mixes, in increasing order of reads per write.
+         */
+        std::list<rw_mode_t> getReadWriteMixes() const { return rw_mixes_; }
+
+        /**
+         * @brief Determines whether in-place read-modify-write should be used in throughput benchmarks.
+         * @returns True if read-modify-write should be used.
+         */
+        bool useReadModifyWrite() const { return use_read_modify_write_; }
+
         /**
          * @brief Determines if a stride of +1 should be used in relevant benchmarks.
          * @returns True if a stride of +1 should be used.
@@ -395,11 +1017,60 @@ namespace xmem {
          */
         bool check_single_option_occurrence(Option* opt) const;
 
+        /**
+         * @brief Parses a working set size sweep specification of the form MIN:MAX:xF or MIN:MAX:+STEP and fills in the list of sweep points.
+         * @param spec The sweep specification string provided by the user.
+         * @returns True on success.
+         */
+        bool parse_working_set_size_sweep(const std::string& spec);
+
+        /**
+         * @brief Parses a worker thread count sweep specification of the form MIN:MAX, MIN:MAX:+STEP, or MIN:MAX:xF and fills in the list of sweep points.
+         * @param spec The sweep specification string provided by the user.
+         * @returns True on success.
+         */
+        bool parse_num_worker_threads_sweep(const std::string& spec);
+
+        /**
+         * @brief Parses a CPU:MEM NUMA node pair and checks that the CPU node exists and the memory node is included in the selected memory NUMA node affinities.
+         * @param spec The node pair string provided by the user.
+         * @param cpu_node Filled in with the CPU NUMA node.
+         * @param mem_node Filled in with the memory NUMA node.
+         * @returns True on success.
+         */
+        bool parse_node_pair(const std::string& spec, uint32_t& cpu_node, uint32_t& mem_node) const;
+
+        /**
+         * @brief Parses a FIRST:SECOND pair of distinct logical CPUs and checks that both exist.
+         * @param spec The CPU pair string provided by the user.
+         * @param first_cpu Filled in with the first logical CPU.
+         * @param second_cpu Filled in with the second logical CPU.
+         * @returns True on success.
+         */
+        bool parse_cpu_pair(const std::string& spec, uint32_t& first_cpu, uint32_t& second_cpu) const;
+
+        /**
+         * @brief Parses an on/off burst specification of the form ON_MS:OFF_MS:PEAK or ON_MS:OFF_MS:PEAK:BASE and sets up the load profile from it.
+         * @param spec The burst specification string.
+         * @returns True on success.
+         */
+        bool parse_load_burst(const std::string& spec);
+
+#ifdef EXT_DELAY_INJECTED_LOADED_LATENCY_BENCHMARK
+        /**
+         * @brief Parses a delay sweep specification of the form MIN:MAX, MIN:MAX:+STEP, or MIN:MAX:xF for the delay-injected loaded latency benchmark extension and fills in the list of delays.
+         * @param spec The sweep specification string.
+         * @returns True on success.
+         */
+        bool parse_delay_sweep(const std::string& spec);
+#endif
+
         bool configured_; /**< If true, this object has been configured. configureFromInput() will only work if this is false. */
 
         bool run_extensions_; /**< If true, run extensions. */
 #ifdef EXT_DELAY_INJECTED_LOADED_LATENCY_BENCHMARK
         bool run_ext_delay_injected_loaded_latency_benchmark_; /**< If true, then run the delay-injected loaded latency benchmark extension. */
+        std::list<uint32_t> ext_delay_injected_loaded_latency_delays_; /**< Delays in nops to inject in load threads of the delay-injected loaded latency benchmark extension, in increasing order. */
 #endif
 #ifdef EXT_STREAM_BENCHMARK
         bool run_ext_stream_benchmark_; /**< If true, then run the STREAM-like benchmark extension. */
@@ -407,8 +1078,66 @@ namespace xmem {
 
         bool run_latency_; /**< True if latency tests should be run. */
         bool run_throughput_; /**< True if throughput tests should be run. */
+        bool run_concurrent_throughput_; /**< True if the concurrent all-node throughput test should be run. */
+        std::list<std::pair<uint32_t, uint32_t> > concurrent_placements_; /**< (CPU NUMA node, memory NUMA node) placements to run at the same time in the concurrent all-node throughput test. */
+        bool run_interconnect_; /**< True if the NUMA interconnect test should be run. */
+        bool run_interference_; /**< True if the interference generator should run instead of benchmarks. */
+        uint32_t interference_duration_s_; /**< Run time of the interference generator in seconds. If 0, it runs until it receives a stop signal. */
+        uint32_t interference_report_interval_ms_; /**< Period in milliseconds at which the interference generator reports achieved bandwidth. */
+        bool run_c2c_latency_; /**< True if the core-to-core cache line transfer latency test should be run. */
+        uint32_t c2c_cpu_step_; /**< Only every Nth logical CPU of a NUMA node is used in the core-to-core benchmarks. */
+        bool run_c2c_bandwidth_; /**< True if the core-to-core producer/consumer bandwidth test should be run. */
+        std::list<std::pair<uint32_t, uint32_t> > c2c_pairs_; /**< (first, second) logical CPU pairs given by the user for the core-to-core benchmarks. Empty if the benchmarks choose their own. */
+        std::list<size_t> c2c_block_sizes_; /**< Block sizes in bytes of the core-to-core bandwidth test, in increasing order. */
+        bool run_atomics_; /**< True if the atomic operation contention test should be run. */
+        std::list<atomic_op_t> atomic_ops_; /**< Atomic operations to benchmark in the atomic operation test. */
+        std::list<atomic_sharing_t> atomic_sharing_modes_; /**< Ways threads share cache lines in the atomic operation test. */
+        uint32_t atomic_spread_addresses_; /**< Number of cache lines that threads cycle over in the spread sharing mode of the atomic operation test. */
+        bool run_false_sharing_; /**< True if the false sharing test should be run. */
+        std::list<uint32_t> false_sharing_paddings_; /**< Paddings in bytes between the private words of consecutive threads in the false sharing test, in increasing order. */
+        uint32_t false_sharing_work_; /**< Iterations of register-only work between writes in the false sharing test. */
+        bool run_flush_; /**< True if the cache flush test should be run. */
+        std::list<flush_op_t> flush_ops_; /**< Cache line flush instructions to benchmark in the cache flush test. */
+        bool run_copy_; /**< True if the copy/fill test should be run. */
+        std::list<copy_engine_t> copy_engines_; /**< Copy and fill engines to benchmark in the copy/fill test. */
+        std::list<size_t> copy_sizes_; /**< Fixed call sizes in bytes of the copy/fill test, in increasing order. */
+        CopySizeDistribution copy_size_distribution_; /**< Distribution of call sizes of the copy/fill test. Empty if none is used. */
+        bool run_gather_; /**< True if the gather/scatter test should be run. */
+        std::list<gather_engine_t> gather_engines_; /**< Gather and scatter engines to benchmark in the gather/scatter test. */
+        std::list<gather_index_t> gather_index_patterns_; /**< Index patterns to use in the gather/scatter test. */
+        size_t gather_stride_; /**< Stride in 64-bit elements of the strided index pattern in the gather/scatter test. */
+        size_t gather_window_size_; /**< Window size in bytes of the window index pattern in the gather/scatter test. */
+        bool run_multi_stream_; /**< True if the multi-stream test should be run. */
+        std::list<uint32_t> stream_counts_; /**< Numbers of concurrent sequential streams per thread in the multi-stream test, in increasing order. */
+        bool run_unaligned_; /**< True if the unaligned access test should be run. */
+        std::list<size_t> unaligned_offsets_; /**< Byte offsets from a cache line boundary in the unaligned access test, in increasing order, starting with 0. */
+        bool run_data_pattern_; /**< True if the data pattern test should be run. */
+        std::list<data_pattern_t> data_patterns_; /**< Data patterns to use in the data pattern test. */
+        bool use_data_pattern_init_; /**< If true, initialize memory regions with a data pattern after they are allocated. */
+        data_pattern_t data_pattern_init_; /**< Data pattern that memory regions are initialized with. */
+        std::vector<uint8_t> data_pattern_file_data_; /**< Contents of the data pattern file. Empty if none was given. */
+        bool run_tiled_; /**< True if the 2D tiled test should be run. */
+        std::list<tile_order_t> tile_orders_; /**< Traversal orders to use in the 2D tiled test. */
+        size_t row_pitch_; /**< Distance in bytes between the starts of consecutive rows in the 2D tiled test. */
+        size_t row_width_; /**< Length in bytes of each row in the 2D tiled test. */
+        size_t tile_width_; /**< Number of 64-bit elements in each row of a tile in the 2D tiled test. */
+        size_t tile_height_; /**< Number of rows in a tile in the 2D tiled test. */
+        bool run_roofline_; /**< True if the roofline test should be run. */
+        std::list<roofline_engine_t> roofline_engines_; /**< Compute engines to use in the roofline test. */
+        std::list<uint32_t> ops_per_element_; /**< Numbers of operations per loaded 64-bit element to sweep in the roofline test. */
+        std::list<std::pair<uint32_t, uint32_t> > latency_load_placements_; /**< (CPU NUMA node, memory NUMA node) placements of load threads in loaded latency benchmarks. Empty if load threads are co-located with the latency measurement thread. */
+        double load_target_bandwidth_; /**< Target aggregate bandwidth in MB/s of load threads in loaded latency benchmarks. If 0, load threads run as fast as possible. */
+        bool all_core_latency_; /**< If true, every worker thread in latency benchmarks measures latency at the same time. */
+        bool cold_cache_latency_; /**< If true, latency measurement threads flush their pointer chain before each timed pass. */
+        LoadProfile load_profile_; /**< Time-varying target aggregate bandwidth of load threads in loaded latency benchmarks. Empty if none is used. */
+        std::string latency_trace_filename_; /**< The latency trace filename if applicable. */
+        bool use_latency_trace_file_; /**< If true, write the latency time series of loaded latency benchmarks with a load profile to a CSV file. */
         size_t working_set_size_per_thread_; /**< Working set size in bytes for each thread, if applicable. */
+        bool use_working_set_size_sweep_; /**< If true, sweep the working set size per thread instead of using a single value. */
+        std::list<size_t> working_set_size_sweep_; /**< Working set sizes in bytes for each thread to use in a sweep, in increasing order. */
         uint32_t num_worker_threads_; /**< Number of load threads to use for throughput benchmarks, loaded latency benchmarks, and stress tests. */
+        bool use_num_worker_threads_sweep_; /**< If true, sweep the number of worker threads instead of using a single value. */
+        std::list<uint32_t> num_worker_threads_sweep_; /**< Numbers of worker threads to use in a sweep, in increasing order. */
         bool use_chunk_32b_; /**< If true, use chunk sizes of 32-bits where applicable. */
 #ifdef HAS_WORD_64
         bool use_chunk_64b_; /**< If true, use chunk sizes of 64-bits where applicable. */
@@ -435,6 +1164,8 @@ namespace xmem {
         bool use_large_pages_; /**< If true, then large pages should be used. */
         bool use_reads_; /**< If true, throughput benchmarks should use reads. */
         bool use_writes_; /**< If true, throughput benchmarks should use writes. */
+        std::list<rw_mode_t> rw_mixes_; /**< Read/write mixes that throughput benchmarks should use. */
+        bool use_read_modify_write_; /**< If true, throughput benchmarks should use in-place read-modify-write. */
         bool use_stride_p1_; /**< If true, use a stride of +1 in relevant benchmarks. */
         bool use_stride_n1_; /**< If true, use a stride of -1 in relevant benchmarks. */
         bool use_stride_p2_; /**< If true, use a stride of +2 in relevant benchmarks. */
@@ -0,0 +1,97 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Microsoft
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Author: Mark Gottscho <mgottscho@ucla.edu>
+ */
+/**
+ * @file
+ * 
+ * @brief Header file for the CopySizeDistribution class.
+ */
+
+#ifndef COPY_SIZE_DISTRIBUTION_H
+#define COPY_SIZE_DISTRIBUTION_H
+
+//Libraries
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace xmem {
+    /**
+     * @brief A weighted distribution of copy or fill call sizes, e.g., a histogram of the memcpy() sizes of a real workload.
+     */
+    class CopySizeDistribution {
+    public:
+        /**
+         * @brief Constructor. The distribution is empty until it is loaded from a file.
+         */
+        CopySizeDistribution();
+
+        /**
+         * @brief Loads the distribution from a CSV file with one SIZE,WEIGHT point per line, where SIZE is in bytes and WEIGHT is the relative frequency of calls of that size. Empty lines, lines starting with '#', and a non-numeric header line are ignored.
+         * @param filename Name of the distribution file.
+         * @returns True on success.
+         */
+        bool loadFile(const std::string& filename);
+
+        /**
+         * @brief Indicates whether the distribution has any points.
+         * @returns True if the distribution is empty.
+         */
+        bool isEmpty() const { return sizes_.empty(); }
+
+        /**
+         * @brief Gets the largest size of the distribution.
+         * @returns The size in bytes.
+         */
+        size_t getMaxSize() const;
+
+        /**
+         * @brief Gets the mean size of the distribution, weighted by the frequency of each size.
+         * @returns The mean size in bytes.
+         */
+        double getMeanSize() const;
+
+        /**
+         * @brief Draws a sequence of sizes from the distribution. The same seed always gives the same sequence.
+         * @param count Number of sizes to draw.
+         * @param seed Seed of the random number generator.
+         * @returns The sizes in bytes.
+         */
+        std::vector<size_t> sample(size_t count, uint32_t seed) const;
+
+        /**
+         * @brief Gets a short human-readable description of the distribution.
+         * @returns The description.
+         */
+        std::string getDescription() const { return description_; }
+
+    private:
+        std::vector<size_t> sizes_; /**< Size of each point in bytes. */
+        std::vector<double> weights_; /**< Relative frequency of each point. */
+        std::string description_; /**< Human-readable description of the distribution. */
+    };
+};
+
+#endif
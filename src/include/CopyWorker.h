@@ -0,0 +1,100 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Microsoft
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Author: Mark Gottscho <mgottscho@ucla.edu>
+ */
+/**
+ * @file
+ * 
+ * @brief Header file for the CopyWorker class.
+ */
+
+#ifndef COPY_WORKER_H
+#define COPY_WORKER_H
+
+//Headers
+#include <MemoryWorker.h>
+#include <benchmark_kernels.h>
+#include <common.h>
+
+//Libraries
+#include <cstdint>
+#include <vector>
+
+namespace xmem {
+    /** 
+     * @brief Multithreading-friendly class that times a sequence of copy or fill calls of varying sizes with one copy or fill engine.
+     */
+    class CopyWorker : public MemoryWorker {
+        public:
+            
+            /** 
+             * @brief Constructor.
+             * @param dst Destination buffer. Consecutive calls walk through it and wrap around at its end.
+             * @param src Source buffer of the same length as the destination. It must not overlap the destination. It is unused by fill engines.
+             * @param len Length of each buffer in bytes. It must be at least the largest call size.
+             * @param sizes Sizes in bytes of consecutive calls. The calls cycle over them.
+             * @param engine The copy or fill engine to use.
+             * @param cpu_affinity Logical CPU identifier to lock this worker's thread to.
+             */
+            CopyWorker(
+                void* dst,
+                void* src,
+                size_t len,
+                const std::vector<size_t>& sizes,
+                copy_engine_t engine,
+                int32_t cpu_affinity
+            );
+            
+            /**
+             * @brief Destructor.
+             */
+            virtual ~CopyWorker();
+
+            /**
+             * @brief Thread-safe worker method.
+             */
+            virtual void run();
+
+            /**
+             * @brief Gets the rate at which this worker copied or filled bytes. Each copied byte counts once, not once for the read and once for the write.
+             * @returns The throughput in MB/s.
+             */
+            double getCopyThroughput();
+
+            /**
+             * @brief Gets the mean time per call, excluding the call overhead measured with a dummy function.
+             * @returns The mean time per call in timer ticks. With the TSC timer, these are reference cycles.
+             */
+            double getMeanCallTicks();
+
+        private:
+            // ONLY ACCESS OBJECT VARIABLES UNDER THE RUNNABLE OBJECT LOCK!!!!
+            void* src_; /**< Source buffer. */
+            std::vector<size_t> sizes_; /**< Sizes in bytes of consecutive calls. */
+            copy_engine_t engine_; /**< The copy or fill engine to use. */
+            uint64_t calls_; /**< Number of timed calls. */
+            uint64_t bytes_; /**< Number of bytes copied or filled by the timed calls. */
+    };
+};
+
+#endif
@@ -0,0 +1,89 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Microsoft
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Author: Mark Gottscho <mgottscho@ucla.edu>
+ */
+/**
+ * @file
+ * 
+ * @brief Header file for the DataPatternWorker class.
+ */
+
+#ifndef DATA_PATTERN_WORKER_H
+#define DATA_PATTERN_WORKER_H
+
+//Headers
+#include <MemoryWorker.h>
+#include <benchmark_kernels.h>
+#include <common.h>
+
+//Libraries
+#include <cstdint>
+
+namespace xmem {
+    /** 
+     * @brief Multithreading-friendly class that measures sequential throughput on memory that holds a data pattern. Reads walk the whole region as it was initialized. Writes repeat the pattern block at the start of the region over the rest of it, so that the stored data follow the pattern too.
+     */
+    class DataPatternWorker : public MemoryWorker {
+        public:
+            
+            /** 
+             * @brief Constructor.
+             * @param mem_array Pointer to the memory region to use by this worker. It must be page aligned and already initialized with the data pattern.
+             * @param len Length of the memory region in bytes. It must be a multiple of DATA_PATTERN_BLOCK_SIZE and at least twice that size.
+             * @param rw_mode Read or write.
+             * @param chunk_size Access granularity.
+             * @param cpu_affinity Logical CPU identifier to lock this worker's thread to.
+             */
+            DataPatternWorker(
+                void* mem_array,
+                size_t len,
+                rw_mode_t rw_mode,
+                chunk_size_t chunk_size,
+                int32_t cpu_affinity
+            );
+            
+            /**
+             * @brief Destructor.
+             */
+            virtual ~DataPatternWorker();
+
+            /**
+             * @brief Thread-safe worker method.
+             */
+            virtual void run();
+
+            /**
+             * @brief Gets the sequential throughput of this worker.
+             * @returns The throughput in MB/s.
+             */
+            double getThroughput();
+
+        private:
+            // ONLY ACCESS OBJECT VARIABLES UNDER THE RUNNABLE OBJECT LOCK!!!!
+            rw_mode_t rw_mode_; /**< Read or write. */
+            chunk_size_t chunk_size_; /**< Access granularity. */
+            uint64_t bytes_; /**< Number of bytes accessed by the timed passes. */
+    };
+};
+
+#endif
@@ -0,0 +1,97 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Microsoft
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Author: Mark Gottscho <mgottscho@ucla.edu>
+ */
+
+/**
+ * @file
+ * 
+ * @brief Header file for the FalseSharingWorker class.
+ */
+
+#ifndef FALSE_SHARING_WORKER_H
+#define FALSE_SHARING_WORKER_H
+
+//Headers
+#include <MemoryWorker.h>
+#include <common.h>
+
+//Libraries
+#include <cstdint>
+#include <atomic>
+
+namespace xmem {
+    /** 
+     * @brief Multithreading-friendly class that repeatedly writes its own private 64-bit word. When the words of several workers are placed closer together than a cache line, every write takes the line away from the other cores even though no data is actually shared.
+     */
+    class FalseSharingWorker : public MemoryWorker {
+        public:
+            
+            /** 
+             * @brief Constructor.
+             * @param word Pointer to this worker's private 64-bit word. It must be 8-byte aligned.
+             * @param work_per_write Number of iterations of register-only work between successive writes, which sets the write frequency. 0 writes as fast as possible.
+             * @param arrived Shared counter of workers that are ready to start. It must be zero when the first worker starts.
+             * @param num_workers Number of workers that start together. Each waits until all of them have arrived.
+             * @param cpu_affinity Logical CPU identifier to lock this worker's thread to.
+             */
+            FalseSharingWorker(
+                void* word,
+                uint32_t work_per_write,
+                std::atomic<uint32_t>* arrived,
+                uint32_t num_workers,
+                int32_t cpu_affinity
+            );
+            
+            /**
+             * @brief Destructor.
+             */
+            virtual ~FalseSharingWorker();
+
+            /**
+             * @brief Thread-safe worker method.
+             */
+            virtual void run();
+
+            /**
+             * @brief Gets the number of writes that were done.
+             * @returns The number of writes.
+             */
+            uint64_t getWrites();
+
+            /**
+             * @brief Gets the rate at which this worker wrote its word.
+             * @returns The write throughput in millions of writes per second.
+             */
+            double getWriteThroughput();
+
+        private:
+            // ONLY ACCESS OBJECT VARIABLES UNDER THE RUNNABLE OBJECT LOCK!!!!
+            uint32_t work_per_write_; /**< Number of iterations of register-only work between successive writes. */
+            std::atomic<uint32_t>* arrived_; /**< Shared counter of workers that are ready to start. */
+            uint32_t num_workers_; /**< Number of workers that start together. */
+            uint64_t writes_; /**< Number of writes that were done. */
+    };
+};
+
+#endif
@@ -0,0 +1,105 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Microsoft
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Author: Mark Gottscho <mgottscho@ucla.edu>
+ */
+
+/**
+ * @file
+ * 
+ * @brief Header file for the FlushWorker class.
+ */
+
+#ifndef FLUSH_WORKER_H
+#define FLUSH_WORKER_H
+
+//Headers
+#include <MemoryWorker.h>
+#include <benchmark_kernels.h>
+#include <common.h>
+
+//Libraries
+#include <cstdint>
+#include <atomic>
+
+namespace xmem {
+    /** 
+     * @brief Multithreading-friendly class that repeatedly brings a memory region into the cache, either clean or dirty, and times flushing all of its cache lines with a cache line flush instruction.
+     */
+    class FlushWorker : public MemoryWorker {
+        public:
+            
+            /** 
+             * @brief Constructor.
+             * @param mem_array Pointer to the memory region to use by this worker. It must be cache line aligned.
+             * @param len Length of the memory region in bytes. It must be a multiple of 4 KB.
+             * @param flush_op The flush instruction to use.
+             * @param dirty If true, every line is written before it is flushed. Otherwise, every line is only read, so it is clean when flushed.
+             * @param fenced If true, each flush completes before the next one starts, which measures the latency of a single flush. Otherwise, flushes may overlap until a fence at the end of the region, which measures flush throughput.
+             * @param arrived Shared counter of workers that are ready to start. It must be zero when the first worker starts.
+             * @param num_workers Number of workers that start together. Each waits until all of them have arrived.
+             * @param cpu_affinity Logical CPU identifier to lock this worker's thread to.
+             */
+            FlushWorker(
+                void* mem_array,
+                size_t len,
+                flush_op_t flush_op,
+                bool dirty,
+                bool fenced,
+                std::atomic<uint32_t>* arrived,
+                uint32_t num_workers,
+                int32_t cpu_affinity
+            );
+            
+            /**
+             * @brief Destructor.
+             */
+            virtual ~FlushWorker();
+
+            /**
+             * @brief Thread-safe worker method.
+             */
+            virtual void run();
+
+            /**
+             * @brief Gets the rate at which this worker flushed its memory region, excluding the time to bring the lines into the cache.
+             * @returns The flush throughput in MB/s.
+             */
+            double getFlushThroughput();
+
+            /**
+             * @brief Gets the mean time to flush one cache line, excluding the time to bring the lines into the cache.
+             * @returns The mean time per line in ns.
+             */
+            double getMeanLineFlushTime();
+
+        private:
+            // ONLY ACCESS OBJECT VARIABLES UNDER THE RUNNABLE OBJECT LOCK!!!!
+            flush_op_t flush_op_; /**< The flush instruction to use. */
+            bool dirty_; /**< If true, lines are written before they are flushed. */
+            bool fenced_; /**< If true, each flush completes before the next one starts. */
+            std::atomic<uint32_t>* arrived_; /**< Shared counter of workers that are ready to start. */
+            uint32_t num_workers_; /**< Number of workers that start together. */
+    };
+};
+
+#endif
@@ -0,0 +1,96 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Microsoft
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Author: Mark Gottscho <mgottscho@ucla.edu>
+ */
+/**
+ * @file
+ * 
+ * @brief Header file for the GatherWorker class.
+ */
+
+#ifndef GATHER_WORKER_H
+#define GATHER_WORKER_H
+
+//Headers
+#include <MemoryWorker.h>
+#include <benchmark_kernels.h>
+#include <common.h>
+
+//Libraries
+#include <cstdint>
+
+namespace xmem {
+    /** 
+     * @brief Multithreading-friendly class that times repeated passes of one gather or scatter engine over an index array.
+     */
+    class GatherWorker : public MemoryWorker {
+        public:
+            
+            /** 
+             * @brief Constructor.
+             * @param data Array of 64-bit elements to gather from or scatter to.
+             * @param indices Element indices visited by each pass. They must not overlap the element array.
+             * @param num_elements Number of elements, which is also the number of indices. It must be a multiple of 8.
+             * @param engine The gather or scatter engine to use.
+             * @param cpu_affinity Logical CPU identifier to lock this worker's thread to.
+             */
+            GatherWorker(
+                void* data,
+                uint32_t* indices,
+                size_t num_elements,
+                gather_engine_t engine,
+                int32_t cpu_affinity
+            );
+            
+            /**
+             * @brief Destructor.
+             */
+            virtual ~GatherWorker();
+
+            /**
+             * @brief Thread-safe worker method.
+             */
+            virtual void run();
+
+            /**
+             * @brief Gets the rate at which this worker gathered or scattered elements.
+             * @returns The element throughput in millions of elements per second. Multiply by the 8 B element size for the effective bandwidth.
+             */
+            double getElementThroughput();
+
+            /**
+             * @brief Gets the mean time per element, excluding the loop overhead measured with a dummy function.
+             * @returns The mean time per element in ns.
+             */
+            double getMeanElementLatency();
+
+        private:
+            // ONLY ACCESS OBJECT VARIABLES UNDER THE RUNNABLE OBJECT LOCK!!!!
+            uint32_t* indices_; /**< Element indices visited by each pass. */
+            size_t num_elements_; /**< Number of elements and indices. */
+            gather_engine_t engine_; /**< The gather or scatter engine to use. */
+            uint64_t elements_; /**< Number of elements moved by the timed passes. */
+    };
+};
+
+#endif
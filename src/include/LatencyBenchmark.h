@@ -35,10 +35,13 @@
 //Headers
 #include <Benchmark.h>
 #include <common.h>
+#include <LoadProfile.h>
+#include <LatencyWorker.h>
 
 //Libraries
 #include <cstdint>
 #include <string>
+#include <vector>
 
 namespace xmem {
 
@@ -65,6 +68,33 @@ namespace xmem {
             std::vector<PowerReader*> dram_power_readers,
             std::string name
         );
+
+        /**
+         * @brief Constructor for loaded latency with load threads placed apart from the latency measurement thread. The latency measurement thread runs on cpu_node and reads mem_node as usual, while
+         * load thread t (t >= 1) runs on the CPU NUMA node of load placement (t-1) modulo the number of load placements and accesses that placement's memory NUMA node. See Benchmark class documentation for other parameter semantics.
+         * @param load_mem_arrays For each load placement, the base of the memory region on its memory NUMA node. Load thread t uses the t-th per-thread sub-range of it, so it must be at least len bytes long.
+         * @param load_cpu_nodes The CPU NUMA node of each load placement.
+         * @param load_mem_nodes The memory NUMA node of each load placement.
+         * @param load_target_bandwidth Target aggregate bandwidth of all load threads in MB/s, split evenly among them. Load threads then hold this rate with a feedback controller instead of running as fast as possible. A value of 0 disables rate control.
+         */
+        LatencyBenchmark(
+            void* mem_array,
+            size_t len,
+            uint32_t iterations,
+            uint32_t num_worker_threads,
+            uint32_t mem_node,
+            uint32_t cpu_node,
+            pattern_mode_t pattern_mode,
+            rw_mode_t rw_mode,
+            chunk_size_t chunk_size,
+            int32_t stride_size,
+            std::vector<PowerReader*> dram_power_readers,
+            std::string name,
+            std::vector<void*> load_mem_arrays,
+            std::vector<uint32_t> load_cpu_nodes,
+            std::vector<uint32_t> load_mem_nodes,
+            double load_target_bandwidth
+        );
         
         /**
          * @brief Destructor.
@@ -83,6 +113,140 @@ namespace xmem {
          * @returns The mean throughput in MB/sec.
          */
         double getMeanLoadMetric() const;        
+
+        /**
+         * @brief Gets the number of load placements that are separate from the latency measurement thread's placement.
+         * @returns The number of load placements, or 0 if load threads share the latency measurement thread's CPU and memory NUMA nodes.
+         */
+        uint32_t getNumLoadPlacements() const { return static_cast<uint32_t>(load_cpu_nodes_.size()); }
+
+        /**
+         * @brief Gets the CPU NUMA node of a load placement.
+         * @param placement Index of the load placement.
+         * @returns The CPU NUMA node.
+         */
+        uint32_t getLoadCPUNode(uint32_t placement) const { return load_cpu_nodes_[placement]; }
+
+        /**
+         * @brief Gets the memory NUMA node of a load placement.
+         * @param placement Index of the load placement.
+         * @returns The memory NUMA node.
+         */
+        uint32_t getLoadMemNode(uint32_t placement) const { return load_mem_nodes_[placement]; }
+
+        /**
+         * @brief Gets the target aggregate bandwidth of the load threads.
+         * @returns The target bandwidth in MB/s, or 0 if load threads run as fast as possible.
+         */
+        double getLoadTargetBandwidth() const { return load_target_bandwidth_; }
+
+        /**
+         * @brief Gets the mean load thread rate controller error, averaged over load threads and iterations.
+         * @returns The mean absolute controller error in percent of the per-slice target, or -1 if the benchmark has not run.
+         */
+        double getMeanLoadControllerError() const;
+
+        /**
+         * @brief Makes the load threads follow a time-varying load profile with their rate controllers instead of running as fast as possible. The profile bandwidth is an aggregate that is split evenly among the load threads.
+         * The latency measurement thread then records a time-aligned series of latency samples. Must be called before the benchmark runs, and has no effect without load threads.
+         * @param load_profile The load profile. It is copied.
+         */
+        void setLoadProfile(const LoadProfile& load_profile);
+
+        /**
+         * @brief Indicates whether the load threads follow a load profile.
+         * @returns True if a load profile is used.
+         */
+        bool usesLoadProfile() const { return use_load_profile_; }
+
+        /**
+         * @brief Gets the load profile followed by the load threads.
+         * @returns The load profile. It is empty if no load profile is used.
+         */
+        const LoadProfile& getLoadProfile() const { return load_profile_; }
+
+        /**
+         * @brief Gets the time series of latency samples recorded during an iteration with a load profile.
+         * @param iter The iteration of interest, starting at 1.
+         * @returns The latency samples, or an empty vector if no load profile is used, the benchmark has not run, or the iteration is invalid.
+         */
+        std::vector<LatencySample> getTimeSeriesOnIter(uint32_t iter) const;
+
+        /**
+         * @brief Gets the aggregate load bandwidth that the load profile requested during a latency sample.
+         * @param sample The latency sample.
+         * @returns The requested bandwidth in MB/s at the middle of the sampling interval.
+         */
+        double getRequestedLoadAt(const LatencySample& sample) const;
+
+        /**
+         * @brief Gets the median latency of samples taken while the load profile was in its lower half, over all iterations.
+         * @returns The latency in ns/access, or -1 if it is not available.
+         */
+        double getLowLoadLatency() const { return low_load_latency_; }
+
+        /**
+         * @brief Gets the mean latency of samples taken while the load profile was in its upper half, over all iterations.
+         * @returns The latency in ns/access, or -1 if it is not available.
+         */
+        double getHighLoadLatency() const { return high_load_latency_; }
+
+        /**
+         * @brief Gets the 99th percentile of the worst per-pass latency of samples taken while the load profile was in its upper half, over all iterations.
+         * @returns The latency in ns/access, or -1 if it is not available.
+         */
+        double getHighLoad99PercentileLatency() const { return high_load_99_percentile_latency_; }
+
+        /**
+         * @brief Gets the mean time from each drop of the load profile to its lower half until latency recovered to within LOAD_PROFILE_RECOVERY_TOLERANCE of the low-load latency, over all recovered drops.
+         * @returns The recovery time in ms, or -1 if it is not available.
+         */
+        double getMeanRecoveryTime() const { return mean_recovery_ms_; }
+
+        /**
+         * @brief Gets the longest recovery time after a drop of the load profile, over all recovered drops.
+         * @returns The recovery time in ms, or -1 if it is not available.
+         */
+        double getMaxRecoveryTime() const { return max_recovery_ms_; }
+
+        /**
+         * @brief Gets the number of drops of the load profile after which latency did not recover before the load rose again or the run ended.
+         * @returns The number of unrecovered drops.
+         */
+        uint32_t getNumUnrecoveredDrops() const { return num_unrecovered_drops_; }
+
+        /**
+         * @brief Makes every worker thread measure latency at the same time, each chasing pointers over its own disjoint chain, instead of using one latency measurement thread and load threads.
+         * The latency of each logical CPU is reported, and the overall latency metric is their mean. Must be called before the benchmark runs.
+         * @param all_core_latency If true, every worker thread measures latency.
+         */
+        void setAllCoreLatency(bool all_core_latency) { all_core_latency_ = all_core_latency; }
+
+        /**
+         * @brief Indicates whether every worker thread measures latency.
+         * @returns True in all-core latency mode.
+         */
+        bool measuresAllCores() const { return all_core_latency_; }
+
+        /**
+         * @brief Makes the latency measurement threads flush their pointer chain out of the caches before every timed pass, so that latency is measured from a cold cache. Must be called before the benchmark runs.
+         * @param cold_cache If true, flush before every pass.
+         */
+        void setColdCache(bool cold_cache) { cold_cache_ = cold_cache; }
+
+        /**
+         * @brief Gets the logical CPU that a worker thread ran on.
+         * @param thread Index of the worker thread.
+         * @returns The logical CPU, or -1 if the benchmark has not run or the thread could not be placed.
+         */
+        int32_t getThreadCPU(uint32_t thread) const;
+
+        /**
+         * @brief Gets the mean latency measured by a worker thread over all iterations in all-core latency mode.
+         * @param thread Index of the worker thread.
+         * @returns The latency in ns/access, or -1 if the benchmark has not run or is not in all-core latency mode.
+         */
+        double getMeanThreadLatency(uint32_t thread) const;
         
         /**
          * @brief Reports benchmark configuration details to the console.
@@ -96,9 +260,34 @@ namespace xmem {
 
     protected:
         virtual bool runCore();
+
+        /**
+         * @brief Computes the low-load latency, high-load latency, and recovery time metrics from the latency time series of all iterations.
+         */
+        void computeTimeSeriesMetrics();
         
         std::vector<double> load_metric_on_iter_; /**< Load metrics for each iteration of the benchmark. This is in MB/s. */
         double mean_load_metric_; /**< The average load throughput in MB/sec that was imposed on the latency measurement. */   
+        std::vector<void*> load_mem_arrays_; /**< Base of the memory region of each load placement. Empty if load threads are co-located with the latency measurement thread. */
+        std::vector<uint32_t> load_cpu_nodes_; /**< CPU NUMA node of each load placement. */
+        std::vector<uint32_t> load_mem_nodes_; /**< Memory NUMA node of each load placement. */
+        double load_target_bandwidth_; /**< Target aggregate bandwidth of all load threads in MB/s. If 0, load threads run as fast as possible. */
+        std::vector<double> load_controller_error_on_iter_; /**< Mean load thread rate controller error for each iteration of the benchmark. This is in percent. */
+        double mean_load_controller_error_; /**< Mean load thread rate controller error over all iterations. This is in percent. */
+        bool use_load_profile_; /**< If true, load threads follow the load profile and the latency measurement thread records a time series. */
+        LoadProfile load_profile_; /**< Time-varying aggregate target bandwidth of all load threads. */
+        std::vector<std::vector<LatencySample> > time_series_on_iter_; /**< Latency time series recorded during each iteration of the benchmark. */
+        double low_load_latency_; /**< Median latency in ns/access while the load profile was in its lower half. */
+        double high_load_latency_; /**< Mean latency in ns/access while the load profile was in its upper half. */
+        double high_load_99_percentile_latency_; /**< 99th percentile of the worst per-pass latency in ns/access while the load profile was in its upper half. */
+        double mean_recovery_ms_; /**< Mean latency recovery time in ms after the load profile dropped to its lower half. */
+        double max_recovery_ms_; /**< Longest latency recovery time in ms after the load profile dropped to its lower half. */
+        uint32_t num_unrecovered_drops_; /**< Number of load profile drops after which latency did not recover. */
+        bool all_core_latency_; /**< If true, every worker thread measures latency over its own chain and there are no load threads. */
+        bool cold_cache_; /**< If true, latency measurement threads flush their pointer chain before every timed pass. */
+        std::vector<int32_t> thread_cpus_; /**< Logical CPU of each worker thread in the last run. */
+        std::vector<std::vector<double> > thread_latency_on_iter_; /**< Latency in ns/access measured by each worker thread during each iteration in all-core latency mode. */
+        std::vector<double> mean_thread_latency_; /**< Mean latency in ns/access of each worker thread over all iterations in all-core latency mode. */
     };
 };
 
@@ -37,7 +37,20 @@
 #include <benchmark_kernels.h>
 #include <common.h>
 
+//Libraries
+#include <vector>
+
 namespace xmem {
+    /**
+     * @brief Latency measured over one sampling interval of a time series.
+     */
+    struct LatencySample {
+        double time_ms; /**< Start of the sampling interval in milliseconds, relative to the start of the time series. */
+        double mean_latency_ns; /**< Mean latency per access over the interval in ns. */
+        double max_latency_ns; /**< Worst latency per access over the interval in ns. Each pass is timed as a whole, so this is the worst mean over the accesses of a single pass. */
+        uint32_t passes; /**< Number of latency measurement passes that started in the interval. 0 if none did, in which case the latencies are not valid. */
+    };
+
     /** 
      * @brief Multithreading-friendly class to do memory loading.
      */
@@ -70,10 +83,38 @@ namespace xmem {
              */
             virtual void run();
 
+            /**
+             * @brief Makes this worker record a time series of latency samples instead of only the overall latency. Each pass is then timed separately and assigned to the interval in which it started.
+             * The worker waits until the start tick, then runs until the given duration has passed, so that it stays aligned in time with other workers that share the start tick.
+             * Must be called before the worker runs.
+             * @param start_tick Timer tick at which the time series starts.
+             * @param duration_ticks Number of ticks to run for from the start tick.
+             * @param sample_ticks Length of each sampling interval in ticks.
+             */
+            void setTimeSeries(tick_t start_tick, tick_t duration_ticks, tick_t sample_ticks);
+
+            /**
+             * @brief Gets the recorded time series of latency samples.
+             * @returns One sample per sampling interval, or an empty vector if no time series was requested or the worker has not completed.
+             */
+            std::vector<LatencySample> getTimeSeries();
+
+            /**
+             * @brief Makes this worker flush its memory region out of the caches before every timed pass instead of priming it once, so that each pass measures cold-cache latency. The flushes are not timed.
+             * Must be called before the worker runs.
+             * @param cold_cache If true, flush before every pass.
+             */
+            void setColdCache(bool cold_cache);
+
         private:
             // ONLY ACCESS OBJECT VARIABLES UNDER THE RUNNABLE OBJECT LOCK!!!!
             RandomFunction kernel_fptr_; /**< Points to the memory test core routine to use. */
             RandomFunction kernel_dummy_fptr_; /**< Points to a dummy version of the memory test core routine to use. */
+            tick_t series_start_tick_; /**< Timer tick at which the time series starts. */
+            tick_t series_duration_ticks_; /**< Number of ticks to record the time series for. */
+            tick_t sample_ticks_; /**< Length of each sampling interval in ticks. If 0, no time series is recorded. */
+            std::vector<LatencySample> time_series_; /**< Recorded latency samples. */
+            bool cold_cache_; /**< If true, the memory region is flushed out of the caches before every timed pass. */
     };
 };
 
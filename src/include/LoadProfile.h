@@ -0,0 +1,123 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Microsoft
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Author: Mark Gottscho <mgottscho@ucla.edu>
+ */
+
+/**
+ * @file
+ * 
+ * @brief Header file for the LoadProfile class.
+ */
+
+#ifndef LOAD_PROFILE_H
+#define LOAD_PROFILE_H
+
+//Libraries
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace xmem {
+    /**
+     * @brief A time-varying target bandwidth for load traffic-generating threads. The profile is a piecewise-linear function of time given by (time, bandwidth) points.
+     * Two points with the same time form a step. The profile repeats after its last point.
+     */
+    class LoadProfile {
+    public:
+        /**
+         * @brief Constructor. The profile is empty until it is loaded from a file or set up as bursts.
+         */
+        LoadProfile();
+
+        /**
+         * @brief Loads the profile from a CSV file with one TIME_MS,MBPS point per line, in non-decreasing order of time. Empty lines, lines starting with '#', and a non-numeric header line are ignored.
+         * If the first point is not at time 0, its bandwidth is held from time 0.
+         * @param filename Name of the profile file.
+         * @returns True on success.
+         */
+        bool loadFile(const std::string& filename);
+
+        /**
+         * @brief Sets up the profile as a periodic on/off burst.
+         * @param on_ms Length of each burst in milliseconds.
+         * @param off_ms Length of the gap between bursts in milliseconds.
+         * @param peak_bandwidth Bandwidth in MB/s during each burst.
+         * @param base_bandwidth Bandwidth in MB/s between bursts.
+         * @returns True on success.
+         */
+        bool setBurst(double on_ms, double off_ms, double peak_bandwidth, double base_bandwidth);
+
+        /**
+         * @brief Indicates whether the profile has any points.
+         * @returns True if the profile is empty.
+         */
+        bool isEmpty() const { return times_ms_.empty(); }
+
+        /**
+         * @brief Gets the length of one period of the profile.
+         * @returns The duration in milliseconds.
+         */
+        double getDurationMS() const { return times_ms_.empty() ? 0 : times_ms_.back(); }
+
+        /**
+         * @brief Gets the target bandwidth at a given time.
+         * @param time_ms Time in milliseconds since the profile started. Times past the end of the profile wrap around to its beginning.
+         * @returns The target bandwidth in MB/s.
+         */
+        double getBandwidthAt(double time_ms) const;
+
+        /**
+         * @brief Gets the lowest bandwidth of the profile.
+         * @returns The bandwidth in MB/s.
+         */
+        double getMinBandwidth() const;
+
+        /**
+         * @brief Gets the highest bandwidth of the profile.
+         * @returns The bandwidth in MB/s.
+         */
+        double getMaxBandwidth() const;
+
+        /**
+         * @brief Gets a short human-readable description of the profile.
+         * @returns The description.
+         */
+        std::string getDescription() const { return description_; }
+
+    private:
+        /**
+         * @brief Checks the points and fills in the profile. On failure, the profile is left unchanged.
+         * @param times_ms Time of each point in milliseconds.
+         * @param bandwidths Bandwidth of each point in MB/s.
+         * @param description Description of the profile.
+         * @returns True on success.
+         */
+        bool setPoints(const std::vector<double>& times_ms, const std::vector<double>& bandwidths, std::string description);
+
+        std::vector<double> times_ms_; /**< Time of each point in milliseconds, in non-decreasing order. The first point is at time 0 and the last point ends the period. */
+        std::vector<double> bandwidths_; /**< Target bandwidth of each point in MB/s. */
+        std::string description_; /**< Human-readable description of the profile. */
+    };
+};
+
+#endif
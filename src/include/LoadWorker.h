@@ -35,6 +35,11 @@
 //Headers
 #include <MemoryWorker.h>
 #include <benchmark_kernels.h>
+#include <LoadProfile.h>
+#include <common.h>
+
+//Libraries
+#include <atomic>
 
 namespace xmem {
     /** 
@@ -84,6 +89,49 @@ namespace xmem {
              * @brief Thread-safe worker method.
              */
             virtual void run();
+
+            /**
+             * @brief Sets a target bandwidth for this worker. Instead of accessing memory as fast as possible, the worker then meters its kernel calls in short time slices with a proportional-integral feedback controller so that it holds the target rate.
+             * Must be called before the worker runs.
+             * @param target_bandwidth Target bandwidth in MB/s. A value of 0 disables rate control.
+             */
+            void setTargetBandwidth(double target_bandwidth);
+
+            /**
+             * @brief Gets the target bandwidth of this worker.
+             * @returns The target bandwidth in MB/s, or 0 if rate control is disabled.
+             */
+            double getTargetBandwidth();
+
+            /**
+             * @brief Gets the mean absolute error of the rate controller over all time slices, relative to the target bytes of each slice.
+             * @returns The controller error in percent, or 0 if rate control is disabled.
+             */
+            double getControllerError();
+
+            /**
+             * @brief Makes this worker follow a time-varying load profile with the rate controller instead of a constant target bandwidth.
+             * The worker waits until the start tick, then runs until the given duration has passed, so that several workers that share a start tick stay aligned in time.
+             * Must be called before the worker runs.
+             * @param load_profile The profile to follow. It must remain valid while the worker runs.
+             * @param share Fraction of the profile bandwidth that this worker generates.
+             * @param start_tick Timer tick at which the profile starts.
+             * @param duration_ticks Number of ticks to run for from the start tick. The profile repeats if it is shorter.
+             */
+            void setLoadProfile(const LoadProfile* load_profile, double share, tick_t start_tick, tick_t duration_ticks);
+
+            /**
+             * @brief Makes this worker run until a stop flag is raised instead of for a fixed duration. No dummy run is done afterwards, so the adjusted ticks include loop overhead.
+             * Must be called before the worker runs.
+             * @param stop_flag Flag that is raised by another thread to stop the worker. It must remain valid while the worker runs.
+             */
+            void setStopFlag(const std::atomic<bool>* stop_flag);
+
+            /**
+             * @brief Gets the number of bytes accessed so far. Unlike other getters, this may be called while the worker runs, and it does not take the object lock.
+             * @returns The number of bytes accessed since the worker started running.
+             */
+            uint64_t getBytesDone() const { return bytes_done_.load(std::memory_order_relaxed); }
         
         private:
             // ONLY ACCESS OBJECT VARIABLES UNDER THE RUNNABLE OBJECT LOCK!!!!
@@ -92,6 +140,14 @@ namespace xmem {
             SequentialFunction kernel_dummy_fptr_seq_; /**< Points to a dummy version of the memory test core routine to use of the "sequential" type. */
             RandomFunction kernel_fptr_ran_; /**< Points to the memory test core routine to use of the "random" type. */
             RandomFunction kernel_dummy_fptr_ran_; /**< Points to a dummy version of the memory test core routine to use of the "random" type. */
+            double target_bandwidth_; /**< Target bandwidth in MB/s. If 0, memory is accessed as fast as possible. */
+            double controller_error_; /**< Mean absolute rate controller error in percent of the per-slice target. */
+            const LoadProfile* load_profile_; /**< Time-varying target bandwidth to follow. If NULL, the constant target bandwidth is used. */
+            double load_profile_share_; /**< Fraction of the load profile bandwidth that this worker generates. */
+            tick_t profile_start_tick_; /**< Timer tick at which the load profile starts. */
+            tick_t profile_duration_ticks_; /**< Number of ticks to follow the load profile for. */
+            const std::atomic<bool>* stop_flag_; /**< If not NULL, the worker runs until this flag is raised instead of for a fixed duration. */
+            std::atomic<uint64_t> bytes_done_; /**< Number of bytes accessed so far. This is updated while the worker runs and may be read without the object lock. */
     };
 };
 
@@ -0,0 +1,90 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Microsoft
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Author: Mark Gottscho <mgottscho@ucla.edu>
+ */
+/**
+ * @file
+ * 
+ * @brief Header file for the MultiStreamWorker class.
+ */
+
+#ifndef MULTI_STREAM_WORKER_H
+#define MULTI_STREAM_WORKER_H
+
+//Headers
+#include <MemoryWorker.h>
+#include <benchmark_kernels.h>
+#include <common.h>
+
+//Libraries
+#include <cstdint>
+
+namespace xmem {
+    /** 
+     * @brief Multithreading-friendly class that times repeated passes over several sequential streams that are read at the same time.
+     */
+    class MultiStreamWorker : public MemoryWorker {
+        public:
+            
+            /** 
+             * @brief Constructor.
+             * @param mem_array Beginning of the first stream. The streams are laid out back to back.
+             * @param stream_len Length of each stream in bytes. It must be a multiple of the cache line size.
+             * @param num_streams Number of streams to read at the same time.
+             * @param reverse If true, the streams are read from their end to their beginning.
+             * @param cpu_affinity Logical CPU identifier to lock this worker's thread to.
+             */
+            MultiStreamWorker(
+                void* mem_array,
+                size_t stream_len,
+                uint32_t num_streams,
+                bool reverse,
+                int32_t cpu_affinity
+            );
+            
+            /**
+             * @brief Destructor.
+             */
+            virtual ~MultiStreamWorker();
+
+            /**
+             * @brief Thread-safe worker method.
+             */
+            virtual void run();
+
+            /**
+             * @brief Gets the rate at which this worker read all of its streams together.
+             * @returns The throughput in MB/s.
+             */
+            double getThroughput();
+
+        private:
+            // ONLY ACCESS OBJECT VARIABLES UNDER THE RUNNABLE OBJECT LOCK!!!!
+            size_t stream_len_; /**< Length of each stream in bytes. */
+            uint32_t num_streams_; /**< Number of streams read at the same time. */
+            bool reverse_; /**< If true, the streams are read from their end to their beginning. */
+            uint64_t bytes_; /**< Number of bytes read by the timed passes. */
+    };
+};
+
+#endif
@@ -0,0 +1,88 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Microsoft
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Author: Mark Gottscho <mgottscho@ucla.edu>
+ */
+
+/**
+ * @file
+ * 
+ * @brief Header file for the PingPongWorker class.
+ */
+
+#ifndef PING_PONG_WORKER_H
+#define PING_PONG_WORKER_H
+
+//Headers
+#include <MemoryWorker.h>
+#include <common.h>
+
+//Libraries
+#include <cstdint>
+
+namespace xmem {
+    /** 
+     * @brief Multithreading-friendly class that bounces ownership of a shared cache line with a partner worker on another logical CPU.
+     * The initiator writes an odd sequence number to the line and spins until the responder answers with the next even number, so every round trip moves the line twice between the two cores in the modified state.
+     */
+    class PingPongWorker : public MemoryWorker {
+        public:
+            
+            /** 
+             * @brief Constructor.
+             * @param mem_array Pointer to the shared cache line. It must hold a std::atomic<uint64_t> that is zero when both workers start.
+             * @param len Length of the shared memory region in bytes.
+             * @param initiator If true, this worker starts each round trip and times them. Otherwise it only answers its partner.
+             * @param round_trips Number of timed round trips. Both partners must use the same number.
+             * @param cpu_affinity Logical CPU identifier to lock this worker's thread to.
+             */
+            PingPongWorker(
+                void* mem_array,
+                size_t len,
+                bool initiator,
+                uint32_t round_trips,
+                int32_t cpu_affinity
+            );
+            
+            /**
+             * @brief Destructor.
+             */
+            virtual ~PingPongWorker();
+
+            /**
+             * @brief Thread-safe worker method.
+             */
+            virtual void run();
+
+            /**
+             * @brief Gets the mean latency of moving the shared cache line from one core to the other, i.e., half of a round trip.
+             * @returns The mean one-way transfer latency in ns, as measured by the initiator. Returns 0 for a responder.
+             */
+            double getMeanTransferLatency();
+
+        private:
+            // ONLY ACCESS OBJECT VARIABLES UNDER THE RUNNABLE OBJECT LOCK!!!!
+            bool initiator_; /**< If true, this worker starts and times the round trips. */
+    };
+};
+
+#endif
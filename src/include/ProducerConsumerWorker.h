@@ -0,0 +1,110 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Microsoft
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Author: Mark Gottscho <mgottscho@ucla.edu>
+ */
+
+/**
+ * @file
+ * 
+ * @brief Header file for the ProducerConsumerWorker class.
+ */
+
+#ifndef PRODUCER_CONSUMER_WORKER_H
+#define PRODUCER_CONSUMER_WORKER_H
+
+//Headers
+#include <MemoryWorker.h>
+#include <common.h>
+
+//Libraries
+#include <cstdint>
+#include <atomic>
+
+namespace xmem {
+    /**
+     * @brief Shared state of a single-producer, single-consumer ring buffer. Each counter sits on its own cache line so that only the block handoffs themselves move lines between the two cores.
+     */
+    struct RingBufferControl {
+        std::atomic<uint64_t> produced; /**< Number of blocks published by the producer. */
+        uint8_t padding0[CACHE_LINE_SIZE - sizeof(std::atomic<uint64_t>)]; /**< Keeps the next counter off this cache line. */
+        std::atomic<uint64_t> consumed; /**< Number of blocks released by the consumer. */
+        uint8_t padding1[CACHE_LINE_SIZE - sizeof(std::atomic<uint64_t>)]; /**< Keeps the next counter off this cache line. */
+        std::atomic<uint32_t> arrived; /**< Number of workers that are ready to start. */
+        uint8_t padding2[CACHE_LINE_SIZE - sizeof(std::atomic<uint32_t>)]; /**< Keeps other data off this cache line. */
+    };
+
+    /** 
+     * @brief Multithreading-friendly class that moves blocks of data to or from a partner worker on another logical CPU through a shared ring buffer, as done by pipelines that pass work between cores.
+     */
+    class ProducerConsumerWorker : public MemoryWorker {
+        public:
+            
+            /** 
+             * @brief Constructor.
+             * @param mem_array Pointer to the ring buffer data.
+             * @param len Length of the ring buffer in bytes. It holds len / block_size slots.
+             * @param control Shared ring buffer state. All counters must be zero when both workers start.
+             * @param producer If true, this worker writes blocks into the ring. Otherwise it reads them.
+             * @param block_size Size of each block in bytes. It must be a multiple of CACHE_LINE_SIZE.
+             * @param blocks Number of blocks to move. Both partners must use the same number.
+             * @param lock_step If true, only one block is in flight at a time: the producer waits for each block to be released before writing the next.
+             * @param cpu_affinity Logical CPU identifier to lock this worker's thread to.
+             */
+            ProducerConsumerWorker(
+                void* mem_array,
+                size_t len,
+                RingBufferControl* control,
+                bool producer,
+                size_t block_size,
+                uint64_t blocks,
+                bool lock_step,
+                int32_t cpu_affinity
+            );
+            
+            /**
+             * @brief Destructor.
+             */
+            virtual ~ProducerConsumerWorker();
+
+            /**
+             * @brief Thread-safe worker method.
+             */
+            virtual void run();
+
+            /**
+             * @brief Gets the number of blocks that were moved.
+             * @returns The number of blocks.
+             */
+            uint64_t getBlocks();
+
+        private:
+            // ONLY ACCESS OBJECT VARIABLES UNDER THE RUNNABLE OBJECT LOCK!!!!
+            RingBufferControl* control_; /**< Shared ring buffer state. */
+            bool producer_; /**< If true, this worker writes blocks. Otherwise it reads them. */
+            size_t block_size_; /**< Size of each block in bytes. */
+            uint64_t blocks_; /**< Number of blocks to move. */
+            bool lock_step_; /**< If true, only one block is in flight at a time. */
+    };
+};
+
+#endif
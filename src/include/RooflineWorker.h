@@ -0,0 +1,96 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Microsoft
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Author: Mark Gottscho <mgottscho@ucla.edu>
+ */
+/**
+ * @file
+ * 
+ * @brief Header file for the RooflineWorker class.
+ */
+
+#ifndef ROOFLINE_WORKER_H
+#define ROOFLINE_WORKER_H
+
+//Headers
+#include <MemoryWorker.h>
+#include <benchmark_kernels.h>
+#include <common.h>
+
+//Libraries
+#include <cstdint>
+
+namespace xmem {
+    /** 
+     * @brief Multithreading-friendly class that measures both the load throughput and the operation throughput of reading its memory sequentially while applying a fixed number of multiply-adds to every 64-bit element, i.e., one point on a roofline plot.
+     */
+    class RooflineWorker : public MemoryWorker {
+        public:
+            
+            /** 
+             * @brief Constructor.
+             * @param mem_array Pointer to the memory region to use by this worker. It must be page aligned. It is overwritten with floating-point ones before the measurement, so that no denormal or NaN data slows down the floating-point engines.
+             * @param len Length of the memory region in bytes. It must be a multiple of ROOFLINE_BYTES_PER_ITERATION.
+             * @param engine Compute engine.
+             * @param ops_per_element Number of operations per loaded 64-bit element. It must be a positive even number, as each multiply-add counts as two.
+             * @param cpu_affinity Logical CPU identifier to lock this worker's thread to.
+             */
+            RooflineWorker(
+                void* mem_array,
+                size_t len,
+                roofline_engine_t engine,
+                uint32_t ops_per_element,
+                int32_t cpu_affinity
+            );
+            
+            /**
+             * @brief Destructor.
+             */
+            virtual ~RooflineWorker();
+
+            /**
+             * @brief Thread-safe worker method.
+             */
+            virtual void run();
+
+            /**
+             * @brief Gets the load throughput of this worker.
+             * @returns The throughput in MB/s.
+             */
+            double getThroughput();
+
+            /**
+             * @brief Gets the operation throughput of this worker.
+             * @returns The throughput in billions of operations per second, i.e., GFLOP/s for the floating-point engines.
+             */
+            double getOpsPerSecond();
+
+        private:
+            // ONLY ACCESS OBJECT VARIABLES UNDER THE RUNNABLE OBJECT LOCK!!!!
+            roofline_engine_t engine_; /**< Compute engine. */
+            uint32_t ops_per_element_; /**< Number of operations per loaded 64-bit element. */
+            uint64_t bytes_; /**< Number of bytes loaded by the timed passes. */
+            uint64_t ops_; /**< Number of operations done by the timed passes. */
+    };
+};
+
+#endif
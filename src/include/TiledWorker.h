@@ -0,0 +1,92 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Microsoft
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Author: Mark Gottscho <mgottscho@ucla.edu>
+ */
+/**
+ * @file
+ * 
+ * @brief Header file for the TiledWorker class.
+ */
+
+#ifndef TILED_WORKER_H
+#define TILED_WORKER_H
+
+//Headers
+#include <MemoryWorker.h>
+#include <benchmark_kernels.h>
+#include <common.h>
+
+//Libraries
+#include <cstdint>
+
+namespace xmem {
+    /** 
+     * @brief Multithreading-friendly class that measures the throughput of traversing its memory as a 2D array of 64-bit elements with padded rows, in a given order. For the transpose, the first half of the memory holds the source array and the second half its transpose.
+     */
+    class TiledWorker : public MemoryWorker {
+        public:
+            
+            /** 
+             * @brief Constructor.
+             * @param mem_array Pointer to the memory region to use by this worker. It must be page aligned.
+             * @param len Length of the memory region in bytes. The array must fit in it, or in its first half for the transpose.
+             * @param order Traversal order.
+             * @param rw_mode Read or write. Ignored for the transpose, which does both.
+             * @param geometry Shape of the array and its tiles.
+             * @param cpu_affinity Logical CPU identifier to lock this worker's thread to.
+             */
+            TiledWorker(
+                void* mem_array,
+                size_t len,
+                tile_order_t order,
+                rw_mode_t rw_mode,
+                tile_geometry_t geometry,
+                int32_t cpu_affinity
+            );
+            
+            /**
+             * @brief Destructor.
+             */
+            virtual ~TiledWorker();
+
+            /**
+             * @brief Thread-safe worker method.
+             */
+            virtual void run();
+
+            /**
+             * @brief Gets the throughput of this worker.
+             * @returns The throughput in MB/s. For the transpose, it counts the bytes copied, like the copy/fill benchmark.
+             */
+            double getThroughput();
+
+        private:
+            // ONLY ACCESS OBJECT VARIABLES UNDER THE RUNNABLE OBJECT LOCK!!!!
+            tile_order_t order_; /**< Traversal order. */
+            rw_mode_t rw_mode_; /**< Read or write. */
+            tile_geometry_t geometry_; /**< Shape of the array and its tiles. */
+            uint64_t bytes_; /**< Number of bytes accessed by the timed passes. */
+    };
+};
+
+#endif
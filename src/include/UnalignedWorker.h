@@ -0,0 +1,102 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Microsoft
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Author: Mark Gottscho <mgottscho@ucla.edu>
+ */
+/**
+ * @file
+ * 
+ * @brief Header file for the UnalignedWorker class.
+ */
+
+#ifndef UNALIGNED_WORKER_H
+#define UNALIGNED_WORKER_H
+
+//Headers
+#include <MemoryWorker.h>
+#include <benchmark_kernels.h>
+#include <common.h>
+
+//Libraries
+#include <cstdint>
+
+namespace xmem {
+    /** 
+     * @brief Multithreading-friendly class that times accesses at a fixed byte offset from natural alignment. It either walks its memory sequentially with unaligned loads or stores to measure throughput, or chases a chain of unaligned pointers to measure latency.
+     */
+    class UnalignedWorker : public MemoryWorker {
+        public:
+            
+            /** 
+             * @brief Constructor.
+             * @param mem_array Pointer to the memory region to use by this worker. It must be page aligned.
+             * @param len Length of the memory region in bytes. It must be a multiple of 4 KB and at least 8 KB.
+             * @param rw_mode Read or write, for throughput measurements. Pointer chasing always reads.
+             * @param chunk_size Access granularity.
+             * @param offset Byte offset of the accesses from a cache line boundary, from 0 to 63.
+             * @param chase If true, measure latency by chasing pointers that are placed at the offset in random cache lines. Otherwise, measure sequential throughput starting at the offset.
+             * @param cpu_affinity Logical CPU identifier to lock this worker's thread to.
+             */
+            UnalignedWorker(
+                void* mem_array,
+                size_t len,
+                rw_mode_t rw_mode,
+                chunk_size_t chunk_size,
+                size_t offset,
+                bool chase,
+                int32_t cpu_affinity
+            );
+            
+            /**
+             * @brief Destructor.
+             */
+            virtual ~UnalignedWorker();
+
+            /**
+             * @brief Thread-safe worker method.
+             */
+            virtual void run();
+
+            /**
+             * @brief Gets the sequential throughput of this worker.
+             * @returns The throughput in MB/s, or 0 when pointer chasing.
+             */
+            double getThroughput();
+
+            /**
+             * @brief Gets the mean latency of one pointer chasing hop.
+             * @returns The latency in ns, or 0 for sequential throughput measurements.
+             */
+            double getMeanAccessLatency();
+
+        private:
+            // ONLY ACCESS OBJECT VARIABLES UNDER THE RUNNABLE OBJECT LOCK!!!!
+            rw_mode_t rw_mode_; /**< Read or write, for throughput measurements. */
+            chunk_size_t chunk_size_; /**< Access granularity. */
+            size_t offset_; /**< Byte offset of the accesses from a cache line boundary. */
+            bool chase_; /**< If true, chase pointers to measure latency. */
+            uint64_t bytes_; /**< Number of bytes accessed by the timed sequential passes. */
+            uint64_t hops_; /**< Number of timed pointer chasing hops. */
+    };
+};
+
+#endif
@@ -38,12 +38,20 @@
 //Libraries
 #include <cstdint>
 #include <cstddef>
+#include <vector>
 
 namespace xmem {
 
     
     typedef int32_t(*SequentialFunction)(void*, void*);
     typedef int32_t(*RandomFunction)(uintptr_t*, uintptr_t**, size_t); 
+    typedef int32_t(*AtomicFunction)(void*, size_t, size_t*, uint64_t*);
+    typedef int32_t(*CopyFunction)(void*, void*, size_t);
+    typedef int32_t(*GatherFunction)(void*, const uint32_t*, size_t);
+    typedef int32_t(*MultiStreamFunction)(void*, size_t, uint32_t);
+    typedef int32_t(*PatternWriteFunction)(void*, void*, void*);
+    typedef int32_t(*TiledFunction)(void*, void*, const tile_geometry_t*);
+    typedef int32_t(*RooflineFunction)(void*, void*, uint32_t);
     
     /**
      * @brief Determines which sequential memory access kernel to use based on the read/write mode, chunk size, and stride size.
@@ -66,6 +74,106 @@ namespace xmem {
      */
     bool determine_random_kernel(rw_mode_t rw_mode, chunk_size_t chunk_size, RandomFunction* kernel_function, RandomFunction* dummy_kernel_function);
 
+    /**
+     * @brief Determines which atomic read-modify-write kernel to use based on the atomic operation.
+     * @param atomic_op Atomic operation.
+     * @param kernel_function Function pointer that will be set to the matching kernel function.
+     * @param dummy_kernel_function Function pointer that will be set to the matching dummy kernel function.
+     * @returns True on success.
+     */
+    bool determine_atomic_kernel(atomic_op_t atomic_op, AtomicFunction* kernel_function, AtomicFunction* dummy_kernel_function);
+
+    /**
+     * @brief Determines which cache line flush kernel to use based on the flush instruction.
+     * @param flush_op Flush instruction.
+     * @param fenced If true, pick the kernel that fences after every line, so that each flush completes before the next one starts. Otherwise, pick the kernel that fences once after the whole region.
+     * @param kernel_function Function pointer that will be set to the matching kernel function.
+     * @param dummy_kernel_function Function pointer that will be set to the matching dummy kernel function.
+     * @returns True on success. False if the flush instruction is not available on this architecture.
+     */
+    bool determine_flush_kernel(flush_op_t flush_op, bool fenced, SequentialFunction* kernel_function, SequentialFunction* dummy_kernel_function);
+
+    /**
+     * @brief Writes back and invalidates every cache line of a memory region with clflush, and waits for the flushes to complete. This does nothing on non-Intel architectures.
+     * @param start_address Beginning of the memory region.
+     * @param end_address End of the memory region.
+     */
+    void flush_region(void* start_address, void* end_address);
+
+    /**
+     * @brief Determines which copy or fill kernel to use based on the engine.
+     * @param engine Copy or fill engine.
+     * @param kernel_function Function pointer that will be set to the matching kernel function.
+     * @param dummy_kernel_function Function pointer that will be set to the matching dummy kernel function.
+     * @returns True on success. False if the engine is not available on this architecture or build.
+     */
+    bool determine_copy_kernel(copy_engine_t engine, CopyFunction* kernel_function, CopyFunction* dummy_kernel_function);
+
+    /**
+     * @brief Determines which gather or scatter kernel to use based on the engine.
+     * @param engine Gather or scatter engine.
+     * @param kernel_function Function pointer that will be set to the matching kernel function.
+     * @param dummy_kernel_function Function pointer that will be set to the matching dummy kernel function.
+     * @returns True on success. False if the engine is not available on this architecture or build. The processor must still be checked with gather_engine_supported().
+     */
+    bool determine_gather_kernel(gather_engine_t engine, GatherFunction* kernel_function, GatherFunction* dummy_kernel_function);
+
+    /**
+     * @brief Determines which multi-stream sequential read kernel to use based on the direction. The widest available word is used, so that the kernels are limited by memory rather than by instruction throughput.
+     * @param reverse If true, pick the kernel that walks every stream from its end to its beginning.
+     * @param kernel_function Function pointer that will be set to the matching kernel function.
+     * @param dummy_kernel_function Function pointer that will be set to the matching dummy kernel function.
+     * @returns True on success.
+     */
+    bool determine_multi_stream_kernel(bool reverse, MultiStreamFunction* kernel_function, MultiStreamFunction* dummy_kernel_function);
+
+    /**
+     * @brief Determines which forward sequential kernel with unaligned accesses to use based on the read/write mode and chunk size.
+     * @param rw_mode Read/write mode. Only READ and WRITE are supported.
+     * @param chunk_size Access granularity.
+     * @param kernel_function Function pointer that will be set to the matching kernel function.
+     * @param dummy_kernel_function Function pointer that will be set to the matching dummy kernel function.
+     * @returns True on success. False if the combination is not available on this architecture or build.
+     */
+    bool determine_unaligned_kernel(rw_mode_t rw_mode, chunk_size_t chunk_size, SequentialFunction* kernel_function, SequentialFunction* dummy_kernel_function);
+
+    /**
+     * @brief Determines which pointer-chasing kernel with unaligned loads to use based on the chunk size.
+     * @param chunk_size Access granularity. It must be at least the pointer size.
+     * @param kernel_function Function pointer that will be set to the matching kernel function.
+     * @param dummy_kernel_function Function pointer that will be set to the matching dummy kernel function.
+     * @returns True on success. False if the chunk size is not available on this architecture or build.
+     */
+    bool determine_unaligned_random_kernel(chunk_size_t chunk_size, RandomFunction* kernel_function, RandomFunction* dummy_kernel_function);
+
+    /**
+     * @brief Determines which data pattern write kernel to use based on the chunk size.
+     * @param chunk_size Access granularity.
+     * @param kernel_function Function pointer that will be set to the matching kernel function.
+     * @param dummy_kernel_function Function pointer that will be set to the matching dummy kernel function.
+     * @returns True on success. False if the chunk size is not available on this architecture or build.
+     */
+    bool determine_pattern_write_kernel(chunk_size_t chunk_size, PatternWriteFunction* kernel_function, PatternWriteFunction* dummy_kernel_function);
+
+    /**
+     * @brief Determines which 2D kernel to use based on the traversal order and the read/write mode. All of them access 64-bit elements.
+     * @param order Traversal order.
+     * @param rw_mode Read/write mode. Only READ and WRITE are supported, and it is ignored for the transpose.
+     * @param kernel_function Function pointer that will be set to the matching kernel function.
+     * @param dummy_kernel_function Function pointer that will be set to the matching dummy kernel function.
+     * @returns True on success. False if the combination is not available on this architecture or build.
+     */
+    bool determine_tiled_kernel(tile_order_t order, rw_mode_t rw_mode, TiledFunction* kernel_function, TiledFunction* dummy_kernel_function);
+
+    /**
+     * @brief Determines which roofline kernel to use based on the engine.
+     * @param engine Roofline engine.
+     * @param kernel_function Function pointer that will be set to the matching kernel function.
+     * @param dummy_kernel_function Function pointer that will be set to the matching dummy kernel function.
+     * @returns True on success. False if the engine is not available on this architecture or build. The processor must still be checked with roofline_engine_supported().
+     */
+    bool determine_roofline_kernel(roofline_engine_t engine, RooflineFunction* kernel_function, RooflineFunction* dummy_kernel_function);
+
     /**
      * @brief Builds a random chain of pointers within the specified memory region.
      * @param start_address Beginning address of the memory region.
@@ -75,6 +183,37 @@ namespace xmem {
      */
     bool build_random_pointer_permutation(void* start_address, void* end_address, chunk_size_t chunk_size);
 
+    /**
+     * @brief Fills an array with the element indices visited by a gather/scatter index pattern. Every pattern is a permutation of 0 to num_indices-1, so each element is touched exactly once per pass.
+     * @param indices The array to fill.
+     * @param num_indices Number of indices, which is also the number of 64-bit elements they address. For the strided pattern, this must be a multiple of the stride.
+     * @param pattern The index pattern.
+     * @param stride Distance in elements between consecutive indices of the strided pattern.
+     * @param window_elements Number of elements in each shuffled window of the windowed pattern.
+     * @returns True on success.
+     */
+    bool build_gather_indices(uint32_t* indices, size_t num_indices, gather_index_t pattern, size_t stride, size_t window_elements);
+
+    /**
+     * @brief Builds a random chain of pointers with one node per cache line, where every node starts at the same byte offset from its line. Nodes at an offset that leaves less room than a chunk before the next line are split across two lines.
+     * @param start_address Beginning address of the memory region. It must be cache line aligned.
+     * @param end_address End address of the memory region. The last line only receives the spilled bytes of the node before it.
+     * @param offset Byte offset of every node from its cache line, from 0 to 63.
+     * @param first_node Set to the address of the node where the chain starts.
+     * @returns True on success.
+     */
+    bool build_unaligned_pointer_chain(void* start_address, void* end_address, size_t offset, uintptr_t** first_node);
+
+    /**
+     * @brief Initializes a memory region with a data pattern.
+     * @param start_address Beginning address of the memory region. It must be aligned to 8 bytes.
+     * @param end_address End address of the memory region.
+     * @param pattern The data pattern. Random data is drawn afresh for the whole region, so no two blocks of it repeat.
+     * @param file_data The bytes to repeat over the region for the file pattern. Ignored for the other patterns.
+     * @returns True on success. False for the file pattern with no data.
+     */
+    bool fill_data_pattern(void* start_address, void* end_address, data_pattern_t pattern, const std::vector<uint8_t>& file_data);
+
     /***********************************************************************
      ***********************************************************************
      ********************** LATENCY-RELATED BENCHMARK KERNELS **************
@@ -609,6 +748,122 @@ namespace xmem {
     int32_t dummy_revStride16Loop_Word512(void* start_address, void* end_address);
 #endif
 
+    /* ------------ SEQUENTIAL READ/WRITE MIX LOOP --------------*/
+
+    /**
+     * @brief Used for measuring the time spent doing everything in forward sequential 1:1 read/write mix Word 32 loops except for the memory access itself.
+     * @param start_address The beginning of the memory region of interest.
+     * @param end_address The end of the memory region of interest.
+     * @returns Undefined.
+     */
+    int32_t dummy_forwSequentialMix1to1Loop_Word32(void* start_address, void* end_address);
+
+#ifdef HAS_WORD_64
+    /**
+     * @brief Used for measuring the time spent doing everything in forward sequential 1:1 read/write mix Word 64 loops except for the memory access itself.
+     * @param start_address The beginning of the memory region of interest.
+     * @param end_address The end of the memory region of interest.
+     * @returns Undefined.
+     */
+    int32_t dummy_forwSequentialMix1to1Loop_Word64(void* start_address, void* end_address);
+#endif
+
+#ifdef HAS_WORD_128
+    /**
+     * @brief Used for measuring the time spent doing everything in forward sequential 1:1 read/write mix Word 128 loops except for the memory access itself.
+     * @param start_address The beginning of the memory region of interest.
+     * @param end_address The end of the memory region of interest.
+     * @returns Undefined.
+     */
+    int32_t dummy_forwSequentialMix1to1Loop_Word128(void* start_address, void* end_address);
+#endif
+
+#ifdef HAS_WORD_256
+    /**
+     * @brief Used for measuring the time spent doing everything in forward sequential 1:1 read/write mix Word 256 loops except for the memory access itself.
+     * @param start_address The beginning of the memory region of interest.
+     * @param end_address The end of the memory region of interest.
+     * @returns Undefined.
+     */
+    int32_t dummy_forwSequentialMix1to1Loop_Word256(void* start_address, void* end_address);
+#endif
+
+    /**
+     * @brief Used for measuring the time spent doing everything in forward sequential 2:1 read/write mix Word 32 loops except for the memory access itself.
+     * @param start_address The beginning of the memory region of interest.
+     * @param end_address The end of the memory region of interest.
+     * @returns Undefined.
+     */
+    int32_t dummy_forwSequentialMix2to1Loop_Word32(void* start_address, void* end_address);
+
+#ifdef HAS_WORD_64
+    /**
+     * @brief Used for measuring the time spent doing everything in forward sequential 2:1 read/write mix Word 64 loops except for the memory access itself.
+     * @param start_address The beginning of the memory region of interest.
+     * @param end_address The end of the memory region of interest.
+     * @returns Undefined.
+     */
+    int32_t dummy_forwSequentialMix2to1Loop_Word64(void* start_address, void* end_address);
+#endif
+
+#ifdef HAS_WORD_128
+    /**
+     * @brief Used for measuring the time spent doing everything in forward sequential 2:1 read/write mix Word 128 loops except for the memory access itself.
+     * @param start_address The beginning of the memory region of interest.
+     * @param end_address The end of the memory region of interest.
+     * @returns Undefined.
+     */
+    int32_t dummy_forwSequentialMix2to1Loop_Word128(void* start_address, void* end_address);
+#endif
+
+#ifdef HAS_WORD_256
+    /**
+     * @brief Used for measuring the time spent doing everything in forward sequential 2:1 read/write mix Word 256 loops except for the memory access itself.
+     * @param start_address The beginning of the memory region of interest.
+     * @param end_address The end of the memory region of interest.
+     * @returns Undefined.
+     */
+    int32_t dummy_forwSequentialMix2to1Loop_Word256(void* start_address, void* end_address);
+#endif
+
+    /**
+     * @brief Used for measuring the time spent doing everything in forward sequential 3:1 read/write mix Word 32 loops except for the memory access itself.
+     * @param start_address The beginning of the memory region of interest.
+     * @param end_address The end of the memory region of interest.
+     * @returns Undefined.
+     */
+    int32_t dummy_forwSequentialMix3to1Loop_Word32(void* start_address, void* end_address);
+
+#ifdef HAS_WORD_64
+    /**
+     * @brief Used for measuring the time spent doing everything in forward sequential 3:1 read/write mix Word 64 loops except for the memory access itself.
+     * @param start_address The beginning of the memory region of interest.
+     * @param end_address The end of the memory region of interest.
+     * @returns Undefined.
+     */
+    int32_t dummy_forwSequentialMix3to1Loop_Word64(void* start_address, void* end_address);
+#endif
+
+#ifdef HAS_WORD_128
+    /**
+     * @brief Used for measuring the time spent doing everything in forward sequential 3:1 read/write mix Word 128 loops except for the memory access itself.
+     * @param start_address The beginning of the memory region of interest.
+     * @param end_address The end of the memory region of interest.
+     * @returns Undefined.
+     */
+    int32_t dummy_forwSequentialMix3to1Loop_Word128(void* start_address, void* end_address);
+#endif
+
+#ifdef HAS_WORD_256
+    /**
+     * @brief Used for measuring the time spent doing everything in forward sequential 3:1 read/write mix Word 256 loops except for the memory access itself.
+     * @param start_address The beginning of the memory region of interest.
+     * @param end_address The end of the memory region of interest.
+     * @returns Undefined.
+     */
+    int32_t dummy_forwSequentialMix3to1Loop_Word256(void* start_address, void* end_address);
+#endif
+
     /* ------------ RANDOM LOOP --------------*/
 
     //SPECIAL CASE: on 32-bit architectures, 64-bit pointers cannot be used, and vice versa.
@@ -1639,120 +1894,1607 @@ namespace xmem {
     int32_t revStride16Write_Word512(void* start_address, void* end_address);
 #endif
 
-    /* ------------ RANDOM READ --------------*/
+    /* ------------ SEQUENTIAL READ/WRITE MIX --------------*/
 
-#ifndef HAS_WORD_64
     /**
-     * @brief Walks over the allocated memory in random order by chasing 64-bit pointers.
-     * @param first_address Starting address to deference.
-     * @param last_touched_address The last visited address.
-     * @param len The number of pointers to deference in a chain-like fashion.
+     * @brief Walks over the allocated memory forward sequentially in 32-bit chunks as two separate streams. The first half of the cache lines are read while the last half are written, a cache line at a time, so that there is one read for every write.
+     * @param start_address The beginning of the memory region of interest.
+     * @param end_address The end of the memory region of interest.
      * @returns Undefined.
      */
-    int32_t randomRead_Word32(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len);
-#endif
+    int32_t forwSequentialMix1to1_Word32(void* start_address, void* end_address);
 
-    //32-bit systems only.
 #ifdef HAS_WORD_64
     /**
-     * @brief Walks over the allocated memory in random order by chasing 32-bit pointers.
-     * @param first_address Starting address to deference.
-     * @param last_touched_address The last visited address.
-     * @param len The number of pointers to deference in a chain-like fashion.
+     * @brief Walks over the allocated memory forward sequentially in 64-bit chunks as two separate streams. The first half of the cache lines are read while the last half are written, a cache line at a time, so that there is one read for every write.
+     * @param start_address The beginning of the memory region of interest.
+     * @param end_address The end of the memory region of interest.
      * @returns Undefined.
      */
-    int32_t randomRead_Word64(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len);
+    int32_t forwSequentialMix1to1_Word64(void* start_address, void* end_address);
 #endif
 
 #ifdef HAS_WORD_128
     /**
-     * @brief Walks over the allocated memory in random order by chasing 64-bit pointers embedded in 128-bit memory words.
-     * @param first_address Starting address to deference.
-     * @param last_touched_address The last visited address.
-     * @param len The number of pointers to deference in a chain-like fashion.
+     * @brief Walks over the allocated memory forward sequentially in 128-bit chunks as two separate streams. The first half of the cache lines are read while the last half are written, a cache line at a time, so that there is one read for every write.
+     * @param start_address The beginning of the memory region of interest.
+     * @param end_address The end of the memory region of interest.
      * @returns Undefined.
      */
-    int32_t randomRead_Word128(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len);
+    int32_t forwSequentialMix1to1_Word128(void* start_address, void* end_address);
 #endif
 
 #ifdef HAS_WORD_256
     /**
-     * @brief Walks over the allocated memory in random order by chasing 64-bit pointers embedded in 256-bit memory words.
-     * @param first_address Starting address to deference.
-     * @param last_touched_address The last visited address.
-     * @param len The number of pointers to deference in a chain-like fashion.
+     * @brief Walks over the allocated memory forward sequentially in 256-bit chunks as two separate streams. The first half of the cache lines are read while the last half are written, a cache line at a time, so that there is one read for every write.
+     * @param start_address The beginning of the memory region of interest.
+     * @param end_address The end of the memory region of interest.
      * @returns Undefined.
      */
-    int32_t randomRead_Word256(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len);
+    int32_t forwSequentialMix1to1_Word256(void* start_address, void* end_address);
 #endif
 
-#ifdef HAS_WORD_512
     /**
-     * @brief Walks over the allocated memory in random order by chasing 64-bit pointers embedded in 512-bit memory words.
-     * @param first_address Starting address to deference.
-     * @param last_touched_address The last visited address.
-     * @param len The number of pointers to deference in a chain-like fashion.
+     * @brief Walks over the allocated memory forward sequentially in 32-bit chunks as two separate streams. The first two thirds of the cache lines are read while the last third are written, a cache line at a time, so that there are two reads for every write.
+     * @param start_address The beginning of the memory region of interest.
+     * @param end_address The end of the memory region of interest.
      * @returns Undefined.
      */
-    int32_t randomRead_Word512(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len);
+    int32_t forwSequentialMix2to1_Word32(void* start_address, void* end_address);
+
+#ifdef HAS_WORD_64
+    /**
+     * @brief Walks over the allocated memory forward sequentially in 64-bit chunks as two separate streams. The first two thirds of the cache lines are read while the last third are written, a cache line at a time, so that there are two reads for every write.
+     * @param start_address The beginning of the memory region of interest.
+     * @param end_address The end of the memory region of interest.
+     * @returns Undefined.
+     */
+    int32_t forwSequentialMix2to1_Word64(void* start_address, void* end_address);
 #endif
 
-    /* ------------ RANDOM WRITE --------------*/
+#ifdef HAS_WORD_128
+    /**
+     * @brief Walks over the allocated memory forward sequentially in 128-bit chunks as two separate streams. The first two thirds of the cache lines are read while the last third are written, a cache line at a time, so that there are two reads for every write.
+     * @param start_address The beginning of the memory region of interest.
+     * @param end_address The end of the memory region of interest.
+     * @returns Undefined.
+     */
+    int32_t forwSequentialMix2to1_Word128(void* start_address, void* end_address);
+#endif
 
-    //32-bit machines only
-#ifndef HAS_WORD_64
+#ifdef HAS_WORD_256
     /**
-     * @brief Walks over the allocated memory in random order by chasing 32-bit pointers. A pointer is read and written back with the same value before chasing to the next pointer. Thus, each memory address is a read followed by immediate write operation. 
-     * @param first_address Starting address to deference.
-     * @param last_touched_address The last visited address.
-     * @param len The number of pointers to deference in a chain-like fashion.
+     * @brief Walks over the allocated memory forward sequentially in 256-bit chunks as two separate streams. The first two thirds of the cache lines are read while the last third are written, a cache line at a time, so that there are two reads for every write.
+     * @param start_address The beginning of the memory region of interest.
+     * @param end_address The end of the memory region of interest.
      * @returns Undefined.
      */
-    int32_t randomWrite_Word32(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len);
+    int32_t forwSequentialMix2to1_Word256(void* start_address, void* end_address);
 #endif
 
+    /**
+     * @brief Walks over the allocated memory forward sequentially in 32-bit chunks as two separate streams. The first three quarters of the cache lines are read while the last quarter are written, a cache line at a time, so that there are three reads for every write.
+     * @param start_address The beginning of the memory region of interest.
+     * @param end_address The end of the memory region of interest.
+     * @returns Undefined.
+     */
+    int32_t forwSequentialMix3to1_Word32(void* start_address, void* end_address);
+
 #ifdef HAS_WORD_64
     /**
-     * @brief Walks over the allocated memory in random order by chasing 64-bit pointers. A pointer is read and written back with the same value before chasing to the next pointer. Thus, each memory address is a read followed by immediate write operation. 
-     * @param first_address Starting address to deference.
-     * @param last_touched_address The last visited address.
-     * @param len The number of pointers to deference in a chain-like fashion.
+     * @brief Walks over the allocated memory forward sequentially in 64-bit chunks as two separate streams. The first three quarters of the cache lines are read while the last quarter are written, a cache line at a time, so that there are three reads for every write.
+     * @param start_address The beginning of the memory region of interest.
+     * @param end_address The end of the memory region of interest.
      * @returns Undefined.
      */
-    int32_t randomWrite_Word64(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len);
+    int32_t forwSequentialMix3to1_Word64(void* start_address, void* end_address);
 #endif
 
 #ifdef HAS_WORD_128
     /**
-     * @brief Walks over the allocated memory in random order by chasing 64-bit pointers embedded within 128-bit words. A 128-bit word is read and written back with the same value before chasing to the next location extracted as a 64-bit address in the 128-bit word. Thus, each memory address is a read followed by immediate write operation as well as a vector word extraction. 
-     * @param first_address Starting address to deference.
-     * @param last_touched_address The last visited address.
-     * @param len The number of pointers to deference in a chain-like fashion.
+     * @brief Walks over the allocated memory forward sequentially in 128-bit chunks as two separate streams. The first three quarters of the cache lines are read while the last quarter are written, a cache line at a time, so that there are three reads for every write.
+     * @param start_address The beginning of the memory region of interest.
+     * @param end_address The end of the memory region of interest.
      * @returns Undefined.
      */
-    int32_t randomWrite_Word128(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len);
+    int32_t forwSequentialMix3to1_Word128(void* start_address, void* end_address);
 #endif
 
 #ifdef HAS_WORD_256
     /**
-     * @brief Walks over the allocated memory in random order by chasing 64-bit pointers embedded within 256-bit words. A 256-bit word is read and written back with the same value before chasing to the next location extracted as a 64-bit address in the 256-bit word. Thus, each memory address is a read followed by immediate write operation as well as a vector word extraction. 
-     * @param first_address Starting address to deference.
-     * @param last_touched_address The last visited address.
-     * @param len The number of pointers to deference in a chain-like fashion.
+     * @brief Walks over the allocated memory forward sequentially in 256-bit chunks as two separate streams. The first three quarters of the cache lines are read while the last quarter are written, a cache line at a time, so that there are three reads for every write.
+     * @param start_address The beginning of the memory region of interest.
+     * @param end_address The end of the memory region of interest.
      * @returns Undefined.
      */
-    int32_t randomWrite_Word256(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len);
+    int32_t forwSequentialMix3to1_Word256(void* start_address, void* end_address);
 #endif
 
-#ifdef HAS_WORD_512
+    /* ------------ SEQUENTIAL READ-MODIFY-WRITE --------------*/
+
     /**
-     * @brief Walks over the allocated memory in random order by chasing 64-bit pointers embedded within 512-bit words. A 512-bit word is read and written back with the same value before chasing to the next location extracted as a 64-bit address in the 512-bit word. Thus, each memory address is a read followed by immediate write operation as well as a vector word extraction. 
-     * @param first_address Starting address to deference.
+     * @brief Walks over the allocated memory forward sequentially, updating 32-bit chunks in place. Each chunk is read, has its bits flipped, and is written back, like a counter or histogram update.
+     * @param start_address The beginning of the memory region of interest.
+     * @param end_address The end of the memory region of interest.
+     * @returns Undefined.
+     */
+    int32_t forwSequentialReadModifyWrite_Word32(void* start_address, void* end_address);
+
+#ifdef HAS_WORD_64
+    /**
+     * @brief Walks over the allocated memory forward sequentially, updating 64-bit chunks in place. Each chunk is read, has its bits flipped, and is written back, like a counter or histogram update.
+     * @param start_address The beginning of the memory region of interest.
+     * @param end_address The end of the memory region of interest.
+     * @returns Undefined.
+     */
+    int32_t forwSequentialReadModifyWrite_Word64(void* start_address, void* end_address);
+#endif
+
+#ifdef HAS_WORD_128
+    /**
+     * @brief Walks over the allocated memory forward sequentially, updating 128-bit chunks in place. Each chunk is read, has its bits flipped, and is written back, like a counter or histogram update.
+     * @param start_address The beginning of the memory region of interest.
+     * @param end_address The end of the memory region of interest.
+     * @returns Undefined.
+     */
+    int32_t forwSequentialReadModifyWrite_Word128(void* start_address, void* end_address);
+#endif
+
+#ifdef HAS_WORD_256
+    /**
+     * @brief Walks over the allocated memory forward sequentially, updating 256-bit chunks in place. Each chunk is read, has its bits flipped, and is written back, like a counter or histogram update.
+     * @param start_address The beginning of the memory region of interest.
+     * @param end_address The end of the memory region of interest.
+     * @returns Undefined.
+     */
+    int32_t forwSequentialReadModifyWrite_Word256(void* start_address, void* end_address);
+#endif
+
+#ifdef HAS_WORD_512
+    /**
+     * @brief Walks over the allocated memory forward sequentially, updating 512-bit chunks in place. Each chunk is read, has its bits flipped, and is written back, like a counter or histogram update.
+     * @param start_address The beginning of the memory region of interest.
+     * @param end_address The end of the memory region of interest.
+     * @returns Undefined.
+     */
+    int32_t forwSequentialReadModifyWrite_Word512(void* start_address, void* end_address);
+#endif
+
+    /**
+     * @brief Walks over the allocated memory reverse sequentially, updating 32-bit chunks in place. Each chunk is read, has its bits flipped, and is written back, like a counter or histogram update.
+     * @param start_address The beginning of the memory region of interest.
+     * @param end_address The end of the memory region of interest.
+     * @returns Undefined.
+     */
+    int32_t revSequentialReadModifyWrite_Word32(void* start_address, void* end_address);
+
+#ifdef HAS_WORD_64
+    /**
+     * @brief Walks over the allocated memory reverse sequentially, updating 64-bit chunks in place. Each chunk is read, has its bits flipped, and is written back, like a counter or histogram update.
+     * @param start_address The beginning of the memory region of interest.
+     * @param end_address The end of the memory region of interest.
+     * @returns Undefined.
+     */
+    int32_t revSequentialReadModifyWrite_Word64(void* start_address, void* end_address);
+#endif
+
+#ifdef HAS_WORD_128
+    /**
+     * @brief Walks over the allocated memory reverse sequentially, updating 128-bit chunks in place. Each chunk is read, has its bits flipped, and is written back, like a counter or histogram update.
+     * @param start_address The beginning of the memory region of interest.
+     * @param end_address The end of the memory region of interest.
+     * @returns Undefined.
+     */
+    int32_t revSequentialReadModifyWrite_Word128(void* start_address, void* end_address);
+#endif
+
+#ifdef HAS_WORD_256
+    /**
+     * @brief Walks over the allocated memory reverse sequentially, updating 256-bit chunks in place. Each chunk is read, has its bits flipped, and is written back, like a counter or histogram update.
+     * @param start_address The beginning of the memory region of interest.
+     * @param end_address The end of the memory region of interest.
+     * @returns Undefined.
+     */
+    int32_t revSequentialReadModifyWrite_Word256(void* start_address, void* end_address);
+#endif
+
+#ifdef HAS_WORD_512
+    /**
+     * @brief Walks over the allocated memory reverse sequentially, updating 512-bit chunks in place. Each chunk is read, has its bits flipped, and is written back, like a counter or histogram update.
+     * @param start_address The beginning of the memory region of interest.
+     * @param end_address The end of the memory region of interest.
+     * @returns Undefined.
+     */
+    int32_t revSequentialReadModifyWrite_Word512(void* start_address, void* end_address);
+#endif
+    
+    /* ------------ STRIDE 2 READ-MODIFY-WRITE --------------*/
+
+    /**
+     * @brief Walks over the allocated memory in forward strides of size 2, updating 32-bit chunks in place. Each chunk is read, has its bits flipped, and is written back, like a counter or histogram update.
+     * @param start_address The beginning of the memory region of interest.
+     * @param end_address The end of the memory region of interest.
+     * @returns Undefined.
+     */
+    int32_t forwStride2ReadModifyWrite_Word32(void* start_address, void* end_address);
+
+#ifdef HAS_WORD_64
+    /**
+     * @brief Walks over the allocated memory in forward strides of size 2, updating 64-bit chunks in place. Each chunk is read, has its bits flipped, and is written back, like a counter or histogram update.
+     * @param start_address The beginning of the memory region of interest.
+     * @param end_address The end of the memory region of interest.
+     * @returns Undefined.
+     */
+    int32_t forwStride2ReadModifyWrite_Word64(void* start_address, void* end_address);
+#endif
+
+#ifdef HAS_WORD_128
+    /**
+     * @brief Walks over the allocated memory in forward strides of size 2, updating 128-bit chunks in place. Each chunk is read, has its bits flipped, and is written back, like a counter or histogram update.
+     * @param start_address The beginning of the memory region of interest.
+     * @param end_address The end of the memory region of interest.
+     * @returns Undefined.
+     */
+    int32_t forwStride2ReadModifyWrite_Word128(void* start_address, void* end_address);
+#endif
+
+#ifdef HAS_WORD_256
+    /**
+     * @brief Walks over the allocated memory in forward strides of size 2, updating 256-bit chunks in place. Each chunk is read, has its bits flipped, and is written back, like a counter or histogram update.
+     * @param start_address The beginning of the memory region of interest.
+     * @param end_address The end of the memory region of interest.
+     * @returns Undefined.
+     */
+    int32_t forwStride2ReadModifyWrite_Word256(void* start_address, void* end_address);
+#endif
+
+#ifdef HAS_WORD_512
+    /**
+     * @brief Walks over the allocated memory in forward strides of size 2, updating 512-bit chunks in place. Each chunk is read, has its bits flipped, and is written back, like a counter or histogram update.
+     * @param start_address The beginning of the memory region of interest.
+     * @param end_address The end of the memory region of interest.
+     * @returns Undefined.
+     */
+    int32_t forwStride2ReadModifyWrite_Word512(void* start_address, void* end_address);
+#endif
+
+    /**
+     * @brief Walks over the allocated memory in reverse strides of size 2, updating 32-bit chunks in place. Each chunk is read, has its bits flipped, and is written back, like a counter or histogram update.
+     * @param start_address The beginning of the memory region of interest.
+     * @param end_address The end of the memory region of interest.
+     * @returns Undefined.
+     */
+    int32_t revStride2ReadModifyWrite_Word32(void* start_address, void* end_address);
+
+#ifdef HAS_WORD_64
+    /**
+     * @brief Walks over the allocated memory in reverse strides of size 2, updating 64-bit chunks in place. Each chunk is read, has its bits flipped, and is written back, like a counter or histogram update.
+     * @param start_address The beginning of the memory region of interest.
+     * @param end_address The end of the memory region of interest.
+     * @returns Undefined.
+     */
+    int32_t revStride2ReadModifyWrite_Word64(void* start_address, void* end_address);
+#endif
+
+#ifdef HAS_WORD_128
+    /**
+     * @brief Walks over the allocated memory in reverse strides of size 2, updating 128-bit chunks in place. Each chunk is read, has its bits flipped, and is written back, like a counter or histogram update.
+     * @param start_address The beginning of the memory region of interest.
+     * @param end_address The end of the memory region of interest.
+     * @returns Undefined.
+     */
+    int32_t revStride2ReadModifyWrite_Word128(void* start_address, void* end_address);
+#endif
+
+#ifdef HAS_WORD_256
+    /**
+     * @brief Walks over the allocated memory in reverse strides of size 2, updating 256-bit chunks in place. Each chunk is read, has its bits flipped, and is written back, like a counter or histogram update.
+     * @param start_address The beginning of the memory region of interest.
+     * @param end_address The end of the memory region of interest.
+     * @returns Undefined.
+     */
+    int32_t revStride2ReadModifyWrite_Word256(void* start_address, void* end_address);
+#endif
+
+#ifdef HAS_WORD_512
+    /**
+     * @brief Walks over the allocated memory in reverse strides of size 2, updating 512-bit chunks in place. Each chunk is read, has its bits flipped, and is written back, like a counter or histogram update.
+     * @param start_address The beginning of the memory region of interest.
+     * @param end_address The end of the memory region of interest.
+     * @returns Undefined.
+     */
+    int32_t revStride2ReadModifyWrite_Word512(void* start_address, void* end_address);
+#endif
+
+    /* ------------ STRIDE 4 READ-MODIFY-WRITE --------------*/
+
+    /**
+     * @brief Walks over the allocated memory in forward strides of size 4, updating 32-bit chunks in place. Each chunk is read, has its bits flipped, and is written back, like a counter or histogram update.
+     * @param start_address The beginning of the memory region of interest.
+     * @param end_address The end of the memory region of interest.
+     * @returns Undefined.
+     */
+    int32_t forwStride4ReadModifyWrite_Word32(void* start_address, void* end_address);
+
+#ifdef HAS_WORD_64
+    /**
+     * @brief Walks over the allocated memory in forward strides of size 4, updating 64-bit chunks in place. Each chunk is read, has its bits flipped, and is written back, like a counter or histogram update.
+     * @param start_address The beginning of the memory region of interest.
+     * @param end_address The end of the memory region of interest.
+     * @returns Undefined.
+     */
+    int32_t forwStride4ReadModifyWrite_Word64(void* start_address, void* end_address);
+#endif
+
+#ifdef HAS_WORD_128
+    /**
+     * @brief Walks over the allocated memory in forward strides of size 4, updating 128-bit chunks in place. Each chunk is read, has its bits flipped, and is written back, like a counter or histogram update.
+     * @param start_address The beginning of the memory region of interest.
+     * @param end_address The end of the memory region of interest.
+     * @returns Undefined.
+     */
+    int32_t forwStride4ReadModifyWrite_Word128(void* start_address, void* end_address);
+#endif
+
+#ifdef HAS_WORD_256
+    /**
+     * @brief Walks over the allocated memory in forward strides of size 4, updating 256-bit chunks in place. Each chunk is read, has its bits flipped, and is written back, like a counter or histogram update.
+     * @param start_address The beginning of the memory region of interest.
+     * @param end_address The end of the memory region of interest.
+     * @returns Undefined.
+     */
+    int32_t forwStride4ReadModifyWrite_Word256(void* start_address, void* end_address);
+#endif
+
+#ifdef HAS_WORD_512
+    /**
+     * @brief Walks over the allocated memory in forward strides of size 4, updating 512-bit chunks in place. Each chunk is read, has its bits flipped, and is written back, like a counter or histogram update.
+     * @param start_address The beginning of the memory region of interest.
+     * @param end_address The end of the memory region of interest.
+     * @returns Undefined.
+     */
+    int32_t forwStride4ReadModifyWrite_Word512(void* start_address, void* end_address);
+#endif
+
+    /**
+     * @brief Walks over the allocated memory in reverse strides of size 4, updating 32-bit chunks in place. Each chunk is read, has its bits flipped, and is written back, like a counter or histogram update.
+     * @param start_address The beginning of the memory region of interest.
+     * @param end_address The end of the memory region of interest.
+     * @returns Undefined.
+     */
+    int32_t revStride4ReadModifyWrite_Word32(void* start_address, void* end_address);
+
+#ifdef HAS_WORD_64
+    /**
+     * @brief Walks over the allocated memory in reverse strides of size 4, updating 64-bit chunks in place. Each chunk is read, has its bits flipped, and is written back, like a counter or histogram update.
+     * @param start_address The beginning of the memory region of interest.
+     * @param end_address The end of the memory region of interest.
+     * @returns Undefined.
+     */
+    int32_t revStride4ReadModifyWrite_Word64(void* start_address, void* end_address);
+#endif
+
+#ifdef HAS_WORD_128
+    /**
+     * @brief Walks over the allocated memory in reverse strides of size 4, updating 128-bit chunks in place. Each chunk is read, has its bits flipped, and is written back, like a counter or histogram update.
+     * @param start_address The beginning of the memory region of interest.
+     * @param end_address The end of the memory region of interest.
+     * @returns Undefined.
+     */
+    int32_t revStride4ReadModifyWrite_Word128(void* start_address, void* end_address);
+#endif
+
+#ifdef HAS_WORD_256
+    /**
+     * @brief Walks over the allocated memory in reverse strides of size 4, updating 256-bit chunks in place. Each chunk is read, has its bits flipped, and is written back, like a counter or histogram update.
+     * @param start_address The beginning of the memory region of interest.
+     * @param end_address The end of the memory region of interest.
+     * @returns Undefined.
+     */
+    int32_t revStride4ReadModifyWrite_Word256(void* start_address, void* end_address);
+#endif
+
+#ifdef HAS_WORD_512
+    /**
+     * @brief Walks over the allocated memory in reverse strides of size 4, updating 512-bit chunks in place. Each chunk is read, has its bits flipped, and is written back, like a counter or histogram update.
+     * @param start_address The beginning of the memory region of interest.
+     * @param end_address The end of the memory region of interest.
+     * @returns Undefined.
+     */
+    int32_t revStride4ReadModifyWrite_Word512(void* start_address, void* end_address);
+#endif
+
+    /* ------------ STRIDE 8 READ-MODIFY-WRITE --------------*/
+
+    /**
+     * @brief Walks over the allocated memory in forward strides of size 8, updating 32-bit chunks in place. Each chunk is read, has its bits flipped, and is written back, like a counter or histogram update.
+     * @param start_address The beginning of the memory region of interest.
+     * @param end_address The end of the memory region of interest.
+     */
+    int32_t forwStride8ReadModifyWrite_Word32(void* start_address, void* end_address);
+
+#ifdef HAS_WORD_64
+    /**
+     * @brief Walks over the allocated memory in forward strides of size 8, updating 64-bit chunks in place. Each chunk is read, has its bits flipped, and is written back, like a counter or histogram update.
+     * @param start_address The beginning of the memory region of interest.
+     * @param end_address The end of the memory region of interest.
+     * @returns Undefined.
+     */
+    int32_t forwStride8ReadModifyWrite_Word64(void* start_address, void* end_address);
+#endif
+
+#ifdef HAS_WORD_128
+    /**
+     * @brief Walks over the allocated memory in forward strides of size 8, updating 128-bit chunks in place. Each chunk is read, has its bits flipped, and is written back, like a counter or histogram update.
+     * @param start_address The beginning of the memory region of interest.
+     * @param end_address The end of the memory region of interest.
+     * @returns Undefined.
+     */
+    int32_t forwStride8ReadModifyWrite_Word128(void* start_address, void* end_address);
+#endif
+
+#ifdef HAS_WORD_256
+    /**
+     * @brief Walks over the allocated memory in forward strides of size 8, updating 256-bit chunks in place. Each chunk is read, has its bits flipped, and is written back, like a counter or histogram update.
+     * @param start_address The beginning of the memory region of interest.
+     * @param end_address The end of the memory region of interest.
+     * @returns Undefined.
+     */
+    int32_t forwStride8ReadModifyWrite_Word256(void* start_address, void* end_address);
+#endif
+
+#ifdef HAS_WORD_512
+    /**
+     * @brief Walks over the allocated memory in forward strides of size 8, updating 512-bit chunks in place. Each chunk is read, has its bits flipped, and is written back, like a counter or histogram update.
+     * @param start_address The beginning of the memory region of interest.
+     * @param end_address The end of the memory region of interest.
+     * @returns Undefined.
+     */
+    int32_t forwStride8ReadModifyWrite_Word512(void* start_address, void* end_address);
+#endif
+
+    /**
+     * @brief Walks over the allocated memory in reverse strides of size 8, updating 32-bit chunks in place. Each chunk is read, has its bits flipped, and is written back, like a counter or histogram update.
+     * @param start_address The beginning of the memory region of interest.
+     * @param end_address The end of the memory region of interest.
+     * @returns Undefined.
+     */
+    int32_t revStride8ReadModifyWrite_Word32(void* start_address, void* end_address);
+
+#ifdef HAS_WORD_64
+    /**
+     * @brief Walks over the allocated memory in reverse strides of size 8, updating 64-bit chunks in place. Each chunk is read, has its bits flipped, and is written back, like a counter or histogram update.
+     * @param start_address The beginning of the memory region of interest.
+     * @param end_address The end of the memory region of interest.
+     * @returns Undefined.
+     */
+    int32_t revStride8ReadModifyWrite_Word64(void* start_address, void* end_address);
+#endif
+
+#ifdef HAS_WORD_128
+    /**
+     * @brief Walks over the allocated memory in reverse strides of size 8, updating 128-bit chunks in place. Each chunk is read, has its bits flipped, and is written back, like a counter or histogram update.
+     * @param start_address The beginning of the memory region of interest.
+     * @param end_address The end of the memory region of interest.
+     * @returns Undefined.
+     */
+    int32_t revStride8ReadModifyWrite_Word128(void* start_address, void* end_address);
+#endif
+
+#ifdef HAS_WORD_256
+    /**
+     * @brief Walks over the allocated memory in reverse strides of size 8, updating 256-bit chunks in place. Each chunk is read, has its bits flipped, and is written back, like a counter or histogram update.
+     * @param start_address The beginning of the memory region of interest.
+     * @param end_address The end of the memory region of interest.
+     * @returns Undefined.
+     */
+    int32_t revStride8ReadModifyWrite_Word256(void* start_address, void* end_address);
+#endif
+
+#ifdef HAS_WORD_512
+    /**
+     * @brief Walks over the allocated memory in reverse strides of size 8, updating 512-bit chunks in place. Each chunk is read, has its bits flipped, and is written back, like a counter or histogram update.
+     * @param start_address The beginning of the memory region of interest.
+     * @param end_address The end of the memory region of interest.
+     * @returns Undefined.
+     */
+    int32_t revStride8ReadModifyWrite_Word512(void* start_address, void* end_address);
+#endif
+
+    /* ------------ STRIDE 16 READ-MODIFY-WRITE --------------*/
+
+    /**
+     * @brief Walks over the allocated memory in forward strides of size 16, updating 32-bit chunks in place. Each chunk is read, has its bits flipped, and is written back, like a counter or histogram update.
+     * @param start_address The beginning of the memory region of interest.
+     * @param end_address The end of the memory region of interest.
+     * @returns Undefined.
+     */
+    int32_t forwStride16ReadModifyWrite_Word32(void* start_address, void* end_address);
+
+#ifdef HAS_WORD_64
+    /**
+     * @brief Walks over the allocated memory in forward strides of size 16, updating 64-bit chunks in place. Each chunk is read, has its bits flipped, and is written back, like a counter or histogram update.
+     * @param start_address The beginning of the memory region of interest.
+     * @param end_address The end of the memory region of interest.
+     * @returns Undefined.
+     */
+    int32_t forwStride16ReadModifyWrite_Word64(void* start_address, void* end_address);
+#endif
+
+#ifdef HAS_WORD_128
+    /**
+     * @brief Walks over the allocated memory in forward strides of size 16, updating 128-bit chunks in place. Each chunk is read, has its bits flipped, and is written back, like a counter or histogram update.
+     * @param start_address The beginning of the memory region of interest.
+     * @param end_address The end of the memory region of interest.
+     * @returns Undefined.
+     */
+    int32_t forwStride16ReadModifyWrite_Word128(void* start_address, void* end_address);
+#endif
+
+#ifdef HAS_WORD_256
+    /**
+     * @brief Walks over the allocated memory in forward strides of size 16, updating 256-bit chunks in place. Each chunk is read, has its bits flipped, and is written back, like a counter or histogram update.
+     * @param start_address The beginning of the memory region of interest.
+     * @param end_address The end of the memory region of interest.
+     * @returns Undefined.
+     */
+    int32_t forwStride16ReadModifyWrite_Word256(void* start_address, void* end_address);
+#endif
+
+#ifdef HAS_WORD_512
+    /**
+     * @brief Walks over the allocated memory in forward strides of size 16, updating 512-bit chunks in place. Each chunk is read, has its bits flipped, and is written back, like a counter or histogram update.
+     * @param start_address The beginning of the memory region of interest.
+     * @param end_address The end of the memory region of interest.
+     * @returns Undefined.
+     */
+    int32_t forwStride16ReadModifyWrite_Word512(void* start_address, void* end_address);
+#endif
+
+    /**
+     * @brief Walks over the allocated memory in reverse strides of size 16, updating 32-bit chunks in place. Each chunk is read, has its bits flipped, and is written back, like a counter or histogram update.
+     * @param start_address The beginning of the memory region of interest.
+     * @param end_address The end of the memory region of interest.
+     * @returns Undefined.
+     */
+    int32_t revStride16ReadModifyWrite_Word32(void* start_address, void* end_address);
+
+#ifdef HAS_WORD_64
+    /**
+     * @brief Walks over the allocated memory in reverse strides of size 16, updating 64-bit chunks in place. Each chunk is read, has its bits flipped, and is written back, like a counter or histogram update.
+     * @param start_address The beginning of the memory region of interest.
+     * @param end_address The end of the memory region of interest.
+     * @returns Undefined.
+     */
+    int32_t revStride16ReadModifyWrite_Word64(void* start_address, void* end_address);
+#endif
+
+#ifdef HAS_WORD_128
+    /**
+     * @brief Walks over the allocated memory in reverse strides of size 16, updating 128-bit chunks in place. Each chunk is read, has its bits flipped, and is written back, like a counter or histogram update.
+     * @param start_address The beginning of the memory region of interest.
+     * @param end_address The end of the memory region of interest.
+     */
+    int32_t revStride16ReadModifyWrite_Word128(void* start_address, void* end_address);
+#endif
+
+#ifdef HAS_WORD_256
+    /**
+     * @brief Walks over the allocated memory in reverse strides of size 16, updating 256-bit chunks in place. Each chunk is read, has its bits flipped, and is written back, like a counter or histogram update.
+     * @param start_address The beginning of the memory region of interest.
+     * @param end_address The end of the memory region of interest.
+     * @returns Undefined.
+     */
+    int32_t revStride16ReadModifyWrite_Word256(void* start_address, void* end_address);
+#endif
+
+#ifdef HAS_WORD_512
+    /**
+     * @brief Walks over the allocated memory in reverse strides of size 16, updating 512-bit chunks in place. Each chunk is read, has its bits flipped, and is written back, like a counter or histogram update.
+     * @param start_address The beginning of the memory region of interest.
+     * @param end_address The end of the memory region of interest.
+     * @returns Undefined.
+     */
+    int32_t revStride16ReadModifyWrite_Word512(void* start_address, void* end_address);
+#endif
+
+    /* ------------ RANDOM READ --------------*/
+
+#ifndef HAS_WORD_64
+    /**
+     * @brief Walks over the allocated memory in random order by chasing 64-bit pointers.
+     * @param first_address Starting address to deference.
+     * @param last_touched_address The last visited address.
+     * @param len The number of pointers to deference in a chain-like fashion.
+     * @returns Undefined.
+     */
+    int32_t randomRead_Word32(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len);
+#endif
+
+    //32-bit systems only.
+#ifdef HAS_WORD_64
+    /**
+     * @brief Walks over the allocated memory in random order by chasing 32-bit pointers.
+     * @param first_address Starting address to deference.
+     * @param last_touched_address The last visited address.
+     * @param len The number of pointers to deference in a chain-like fashion.
+     * @returns Undefined.
+     */
+    int32_t randomRead_Word64(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len);
+#endif
+
+#ifdef HAS_WORD_128
+    /**
+     * @brief Walks over the allocated memory in random order by chasing 64-bit pointers embedded in 128-bit memory words.
+     * @param first_address Starting address to deference.
+     * @param last_touched_address The last visited address.
+     * @param len The number of pointers to deference in a chain-like fashion.
+     * @returns Undefined.
+     */
+    int32_t randomRead_Word128(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len);
+#endif
+
+#ifdef HAS_WORD_256
+    /**
+     * @brief Walks over the allocated memory in random order by chasing 64-bit pointers embedded in 256-bit memory words.
+     * @param first_address Starting address to deference.
+     * @param last_touched_address The last visited address.
+     * @param len The number of pointers to deference in a chain-like fashion.
+     * @returns Undefined.
+     */
+    int32_t randomRead_Word256(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len);
+#endif
+
+#ifdef HAS_WORD_512
+    /**
+     * @brief Walks over the allocated memory in random order by chasing 64-bit pointers embedded in 512-bit memory words.
+     * @param first_address Starting address to deference.
+     * @param last_touched_address The last visited address.
+     * @param len The number of pointers to deference in a chain-like fashion.
+     * @returns Undefined.
+     */
+    int32_t randomRead_Word512(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len);
+#endif
+
+    /* ------------ RANDOM WRITE --------------*/
+
+    //32-bit machines only
+#ifndef HAS_WORD_64
+    /**
+     * @brief Walks over the allocated memory in random order by chasing 32-bit pointers. A pointer is read and written back with the same value before chasing to the next pointer. Thus, each memory address is a read followed by immediate write operation. 
+     * @param first_address Starting address to deference.
+     * @param last_touched_address The last visited address.
+     * @param len The number of pointers to deference in a chain-like fashion.
+     * @returns Undefined.
+     */
+    int32_t randomWrite_Word32(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len);
+#endif
+
+#ifdef HAS_WORD_64
+    /**
+     * @brief Walks over the allocated memory in random order by chasing 64-bit pointers. A pointer is read and written back with the same value before chasing to the next pointer. Thus, each memory address is a read followed by immediate write operation. 
+     * @param first_address Starting address to deference.
+     * @param last_touched_address The last visited address.
+     * @param len The number of pointers to deference in a chain-like fashion.
+     * @returns Undefined.
+     */
+    int32_t randomWrite_Word64(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len);
+#endif
+
+#ifdef HAS_WORD_128
+    /**
+     * @brief Walks over the allocated memory in random order by chasing 64-bit pointers embedded within 128-bit words. A 128-bit word is read and written back with the same value before chasing to the next location extracted as a 64-bit address in the 128-bit word. Thus, each memory address is a read followed by immediate write operation as well as a vector word extraction. 
+     * @param first_address Starting address to deference.
+     * @param last_touched_address The last visited address.
+     * @param len The number of pointers to deference in a chain-like fashion.
+     * @returns Undefined.
+     */
+    int32_t randomWrite_Word128(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len);
+#endif
+
+#ifdef HAS_WORD_256
+    /**
+     * @brief Walks over the allocated memory in random order by chasing 64-bit pointers embedded within 256-bit words. A 256-bit word is read and written back with the same value before chasing to the next location extracted as a 64-bit address in the 256-bit word. Thus, each memory address is a read followed by immediate write operation as well as a vector word extraction. 
+     * @param first_address Starting address to deference.
+     * @param last_touched_address The last visited address.
+     * @param len The number of pointers to deference in a chain-like fashion.
+     * @returns Undefined.
+     */
+    int32_t randomWrite_Word256(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len);
+#endif
+
+#ifdef HAS_WORD_512
+    /**
+     * @brief Walks over the allocated memory in random order by chasing 64-bit pointers embedded within 512-bit words. A 512-bit word is read and written back with the same value before chasing to the next location extracted as a 64-bit address in the 512-bit word. Thus, each memory address is a read followed by immediate write operation as well as a vector word extraction. 
+     * @param first_address Starting address to deference.
+     * @param last_touched_address The last visited address.
+     * @param len The number of pointers to deference in a chain-like fashion.
+     * @returns Undefined.
+     */
+    int32_t randomWrite_Word512(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len);
+#endif
+
+    /* ------------ RANDOM READ/WRITE MIX --------------*/
+
+#ifndef HAS_WORD_64 //special case: 32-bit machine
+    /**
+     * @brief Walks over the allocated memory in random order by chasing 32-bit pointers. After every two dependent reads, the first location of the group is written back with the value it was read with, so that there are two reads for every write and the pointer chain stays intact.
+     * @param first_address Starting address to deference.
+     * @param last_touched_address The last visited address.
+     * @param len The number of pointers to deference in a chain-like fashion.
+     * @returns Undefined.
+     */
+    int32_t randomMix2to1_Word32(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len);
+#endif
+
+#ifdef HAS_WORD_64
+    /**
+     * @brief Walks over the allocated memory in random order by chasing 64-bit pointers. After every two dependent reads, the first location of the group is written back with the value it was read with, so that there are two reads for every write and the pointer chain stays intact.
+     * @param first_address Starting address to deference.
+     * @param last_touched_address The last visited address.
+     * @param len The number of pointers to deference in a chain-like fashion.
+     * @returns Undefined.
+     */
+    int32_t randomMix2to1_Word64(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len);
+#endif
+
+#ifdef HAS_WORD_128
+    /**
+     * @brief Walks over the allocated memory in random order by chasing 64-bit pointers embedded within 128-bit words. After every two dependent reads, the first location of the group is written back with the value it was read with, so that there are two reads for every write and the pointer chain stays intact.
+     * @param first_address Starting address to deference.
+     * @param last_touched_address The last visited address.
+     * @param len The number of pointers to deference in a chain-like fashion.
+     * @returns Undefined.
+     */
+    int32_t randomMix2to1_Word128(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len);
+#endif
+
+#ifdef HAS_WORD_256
+    /**
+     * @brief Walks over the allocated memory in random order by chasing 64-bit pointers embedded within 256-bit words. After every two dependent reads, the first location of the group is written back with the value it was read with, so that there are two reads for every write and the pointer chain stays intact.
+     * @param first_address Starting address to deference.
+     * @param last_touched_address The last visited address.
+     * @param len The number of pointers to deference in a chain-like fashion.
+     * @returns Undefined.
+     */
+    int32_t randomMix2to1_Word256(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len);
+#endif
+
+#ifndef HAS_WORD_64 //special case: 32-bit machine
+    /**
+     * @brief Walks over the allocated memory in random order by chasing 32-bit pointers. After every three dependent reads, the first location of the group is written back with the value it was read with, so that there are three reads for every write and the pointer chain stays intact.
+     * @param first_address Starting address to deference.
+     * @param last_touched_address The last visited address.
+     * @param len The number of pointers to deference in a chain-like fashion.
+     * @returns Undefined.
+     */
+    int32_t randomMix3to1_Word32(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len);
+#endif
+
+#ifdef HAS_WORD_64
+    /**
+     * @brief Walks over the allocated memory in random order by chasing 64-bit pointers. After every three dependent reads, the first location of the group is written back with the value it was read with, so that there are three reads for every write and the pointer chain stays intact.
+     * @param first_address Starting address to deference.
+     * @param last_touched_address The last visited address.
+     * @param len The number of pointers to deference in a chain-like fashion.
+     * @returns Undefined.
+     */
+    int32_t randomMix3to1_Word64(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len);
+#endif
+
+#ifdef HAS_WORD_128
+    /**
+     * @brief Walks over the allocated memory in random order by chasing 64-bit pointers embedded within 128-bit words. After every three dependent reads, the first location of the group is written back with the value it was read with, so that there are three reads for every write and the pointer chain stays intact.
+     * @param first_address Starting address to deference.
+     * @param last_touched_address The last visited address.
+     * @param len The number of pointers to deference in a chain-like fashion.
+     * @returns Undefined.
+     */
+    int32_t randomMix3to1_Word128(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len);
+#endif
+
+#ifdef HAS_WORD_256
+    /**
+     * @brief Walks over the allocated memory in random order by chasing 64-bit pointers embedded within 256-bit words. After every three dependent reads, the first location of the group is written back with the value it was read with, so that there are three reads for every write and the pointer chain stays intact.
+     * @param first_address Starting address to deference.
      * @param last_touched_address The last visited address.
      * @param len The number of pointers to deference in a chain-like fashion.
      * @returns Undefined.
      */
-    int32_t randomWrite_Word512(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len);
+    int32_t randomMix3to1_Word256(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len);
+#endif
+
+    /***********************************************************************
+     ***********************************************************************
+     ******************* ATOMIC OPERATION BENCHMARK KERNELS ****************
+     ***********************************************************************
+     ***********************************************************************/
+
+    /* --------------------- DUMMY BENCHMARK ROUTINES --------------------------- */
+
+    /**
+     * @brief Mimics the atomic kernels by cycling over the same cache lines, but doesn't do the memory accesses.
+     * @param lines Address of the first cache line.
+     * @param num_lines Number of consecutive cache lines to cycle over.
+     * @param next_line Index of the next cache line to target. It is advanced past the last targeted line.
+     * @param result Accumulates the computed addresses.
+     * @returns Undefined.
+     */
+    int32_t dummy_atomicLoop(void* lines, size_t num_lines, size_t* next_line, uint64_t* result);
+
+    /* ------------------------------------------------------------------------- */
+    /* --------------------- CORE BENCHMARK ROUTINES --------------------------- */
+    /* ------------------------------------------------------------------------- */
+
+    /**
+     * @brief Does ATOMIC_OPS_PER_KERNEL_CALL atomic fetch-and-add operations on the first 64-bit word of consecutive cache lines, wrapping around after the last one. The returned values are used so that x86 compilers emit lock xadd rather than lock add.
+     * @param lines Address of the first cache line.
+     * @param num_lines Number of consecutive cache lines to cycle over.
+     * @param next_line Index of the next cache line to target. It is advanced past the last targeted line.
+     * @param result Accumulates the values returned by the operations.
+     * @returns Undefined.
+     */
+    int32_t atomicFetchAdd_Word64(void* lines, size_t num_lines, size_t* next_line, uint64_t* result);
+
+    /**
+     * @brief Does ATOMIC_OPS_PER_KERNEL_CALL atomic compare-and-swap operations on the first 64-bit word of consecutive cache lines, wrapping around after the last one. Each operation tries to increment the value that was last read from the line, and fails if another thread changed it in the meantime.
+     * @param lines Address of the first cache line.
+     * @param num_lines Number of consecutive cache lines to cycle over.
+     * @param next_line Index of the next cache line to target. It is advanced past the last targeted line.
+     * @param result Accumulates the number of failed operations.
+     * @returns Undefined.
+     */
+    int32_t atomicCompareExchange_Word64(void* lines, size_t num_lines, size_t* next_line, uint64_t* result);
+
+    /**
+     * @brief Does ATOMIC_OPS_PER_KERNEL_CALL atomic swap operations on the first 64-bit word of consecutive cache lines, wrapping around after the last one.
+     * @param lines Address of the first cache line.
+     * @param num_lines Number of consecutive cache lines to cycle over.
+     * @param next_line Index of the next cache line to target. It is advanced past the last targeted line.
+     * @param result Accumulates the values returned by the operations.
+     * @returns Undefined.
+     */
+    int32_t atomicExchange_Word64(void* lines, size_t num_lines, size_t* next_line, uint64_t* result);
+
+#ifdef ARCH_INTEL
+    /***********************************************************************
+     ***********************************************************************
+     ******************* CACHE FLUSH BENCHMARK KERNELS *********************
+     ***********************************************************************
+     ***********************************************************************/
+
+    /* --------------------- DUMMY BENCHMARK ROUTINES --------------------------- */
+
+    /**
+     * @brief Walks over the cache lines of a memory region like the flush kernels, but doesn't flush them.
+     * @param start_address The beginning of the memory region of interest. It must be cache line aligned.
+     * @param end_address The end of the memory region of interest. The region must be a multiple of 4 KB.
+     * @returns Undefined.
+     */
+    int32_t dummy_flushLoop(void* start_address, void* end_address);
+
+    /* ------------------------------------------------------------------------- */
+    /* --------------------- CORE BENCHMARK ROUTINES --------------------------- */
+    /* ------------------------------------------------------------------------- */
+
+    /**
+     * @brief Flushes every cache line of a memory region with clflush, then fences once so that all flushes have completed.
+     * @param start_address The beginning of the memory region of interest. It must be cache line aligned.
+     * @param end_address The end of the memory region of interest. The region must be a multiple of 4 KB.
+     * @returns Undefined.
+     */
+    int32_t flushLines_clflush(void* start_address, void* end_address);
+
+    /**
+     * @brief Flushes every cache line of a memory region with clflushopt, then fences once so that all flushes have completed.
+     * @param start_address The beginning of the memory region of interest. It must be cache line aligned.
+     * @param end_address The end of the memory region of interest. The region must be a multiple of 4 KB.
+     * @returns Undefined.
+     */
+    int32_t flushLines_clflushopt(void* start_address, void* end_address);
+
+    /**
+     * @brief Writes back every cache line of a memory region with clwb, then fences once so that all write-backs have completed.
+     * @param start_address The beginning of the memory region of interest. It must be cache line aligned.
+     * @param end_address The end of the memory region of interest. The region must be a multiple of 4 KB.
+     * @returns Undefined.
+     */
+    int32_t flushLines_clwb(void* start_address, void* end_address);
+
+    /**
+     * @brief Flushes every cache line of a memory region with clflush, fencing after each line so that every flush completes before the next one starts.
+     * @param start_address The beginning of the memory region of interest. It must be cache line aligned.
+     * @param end_address The end of the memory region of interest. The region must be a multiple of 4 KB.
+     * @returns Undefined.
+     */
+    int32_t flushLinesFenced_clflush(void* start_address, void* end_address);
+
+    /**
+     * @brief Flushes every cache line of a memory region with clflushopt, fencing after each line so that every flush completes before the next one starts.
+     * @param start_address The beginning of the memory region of interest. It must be cache line aligned.
+     * @param end_address The end of the memory region of interest. The region must be a multiple of 4 KB.
+     * @returns Undefined.
+     */
+    int32_t flushLinesFenced_clflushopt(void* start_address, void* end_address);
+
+    /**
+     * @brief Writes back every cache line of a memory region with clwb, fencing after each line so that every write-back completes before the next one starts.
+     * @param start_address The beginning of the memory region of interest. It must be cache line aligned.
+     * @param end_address The end of the memory region of interest. The region must be a multiple of 4 KB.
+     * @returns Undefined.
+     */
+    int32_t flushLinesFenced_clwb(void* start_address, void* end_address);
+#endif
+
+    /***********************************************************************
+     ***********************************************************************
+     ******************* COPY AND FILL BENCHMARK KERNELS *******************
+     ***********************************************************************
+     ***********************************************************************/
+
+    /* --------------------- DUMMY BENCHMARK ROUTINES --------------------------- */
+
+    /**
+     * @brief Does nothing. It is called through a function pointer like the copy and fill kernels, so that the call overhead can be subtracted.
+     * @param dst Destination buffer.
+     * @param src Source buffer.
+     * @param len Number of bytes.
+     * @returns Undefined.
+     */
+    int32_t dummy_copyFunction(void* dst, void* src, size_t len);
+
+    /* ------------------------------------------------------------------------- */
+    /* --------------------- CORE BENCHMARK ROUTINES --------------------------- */
+    /* ------------------------------------------------------------------------- */
+
+    /**
+     * @brief Copies a buffer with the C library memcpy().
+     * @param dst Destination buffer.
+     * @param src Source buffer. It must not overlap the destination.
+     * @param len Number of bytes to copy.
+     * @returns Undefined.
+     */
+    int32_t copy_memcpy(void* dst, void* src, size_t len);
+
+    /**
+     * @brief Copies a buffer with the C library memmove().
+     * @param dst Destination buffer.
+     * @param src Source buffer.
+     * @param len Number of bytes to copy.
+     * @returns Undefined.
+     */
+    int32_t copy_memmove(void* dst, void* src, size_t len);
+
+    /**
+     * @brief Fills a buffer with the C library memset().
+     * @param dst Destination buffer.
+     * @param src Unused.
+     * @param len Number of bytes to fill.
+     * @returns Undefined.
+     */
+    int32_t fill_memset(void* dst, void* src, size_t len);
+
+#ifdef ARCH_INTEL
+    /**
+     * @brief Copies a buffer with a single rep movsb instruction.
+     * @param dst Destination buffer.
+     * @param src Source buffer. It must not overlap the destination.
+     * @param len Number of bytes to copy.
+     * @returns Undefined.
+     */
+    int32_t copy_repMovsb(void* dst, void* src, size_t len);
+
+    /**
+     * @brief Fills a buffer with a single rep stosb instruction.
+     * @param dst Destination buffer.
+     * @param src Unused.
+     * @param len Number of bytes to fill.
+     * @returns Undefined.
+     */
+    int32_t fill_repStosb(void* dst, void* src, size_t len);
+#endif
+
+#if defined(ARCH_INTEL) && defined(HAS_WORD_256)
+    /**
+     * @brief Copies a buffer with unaligned 256-bit loads and stores. The tail that does not fill a whole word is copied byte by byte.
+     * @param dst Destination buffer.
+     * @param src Source buffer. It must not overlap the destination.
+     * @param len Number of bytes to copy.
+     * @returns Undefined.
+     */
+    int32_t copyVector_Word256(void* dst, void* src, size_t len);
+
+    /**
+     * @brief Copies a buffer with unaligned 256-bit loads and non-temporal 256-bit stores, then fences so that the stores are globally visible. Bytes before the first 32 B aligned destination address and the tail are copied byte by byte.
+     * @param dst Destination buffer.
+     * @param src Source buffer. It must not overlap the destination.
+     * @param len Number of bytes to copy.
+     * @returns Undefined.
+     */
+    int32_t copyVectorNT_Word256(void* dst, void* src, size_t len);
+
+    /**
+     * @brief Fills a buffer with unaligned 256-bit stores. The tail that does not fill a whole word is filled byte by byte.
+     * @param dst Destination buffer.
+     * @param src Unused.
+     * @param len Number of bytes to fill.
+     * @returns Undefined.
+     */
+    int32_t fillVector_Word256(void* dst, void* src, size_t len);
+
+    /**
+     * @brief Fills a buffer with non-temporal 256-bit stores, then fences so that the stores are globally visible. Bytes before the first 32 B aligned address and the tail are filled byte by byte.
+     * @param dst Destination buffer.
+     * @param src Unused.
+     * @param len Number of bytes to fill.
+     * @returns Undefined.
+     */
+    int32_t fillVectorNT_Word256(void* dst, void* src, size_t len);
+#endif
+
+    /***********************************************************************
+     ***********************************************************************
+     ***************** GATHER AND SCATTER BENCHMARK KERNELS ****************
+     ***********************************************************************
+     ***********************************************************************/
+
+    /* --------------------- DUMMY BENCHMARK ROUTINES --------------------------- */
+
+    /**
+     * @brief Walks the index array in groups of eight without touching the elements, so that the loop and call overhead of the gather and scatter kernels can be subtracted.
+     * @param base Base address of the 64-bit element array.
+     * @param indices Element indices.
+     * @param count Number of indices. It must be a multiple of 8.
+     * @returns Undefined.
+     */
+    int32_t dummy_gatherLoop_Word64(void* base, const uint32_t* indices, size_t count);
+
+    /* ------------------------------------------------------------------------- */
+    /* --------------------- CORE BENCHMARK ROUTINES --------------------------- */
+    /* ------------------------------------------------------------------------- */
+
+#ifdef HAS_WORD_64
+    /**
+     * @brief Loads the 64-bit element at each index with a scalar load.
+     * @param base Base address of the 64-bit element array.
+     * @param indices Element indices.
+     * @param count Number of indices. It must be a multiple of 8.
+     * @returns Undefined.
+     */
+    int32_t gatherScalar_Word64(void* base, const uint32_t* indices, size_t count);
+
+    /**
+     * @brief Stores a 64-bit element at each index with a scalar store.
+     * @param base Base address of the 64-bit element array.
+     * @param indices Element indices.
+     * @param count Number of indices. It must be a multiple of 8.
+     * @returns Undefined.
+     */
+    int32_t scatterScalar_Word64(void* base, const uint32_t* indices, size_t count);
+#endif
+
+#if defined(ARCH_INTEL_X86_64) && defined(HAS_WORD_256)
+    /**
+     * @brief Loads the 64-bit element at each index with AVX2 gathers of four elements.
+     * @param base Base address of the 64-bit element array.
+     * @param indices Element indices.
+     * @param count Number of indices. It must be a multiple of 8.
+     * @returns Undefined.
+     */
+    int32_t gatherAVX2_Word64(void* base, const uint32_t* indices, size_t count);
+
+    /**
+     * @brief Loads the 64-bit element at each index with AVX-512 gathers of eight elements.
+     * @param base Base address of the 64-bit element array.
+     * @param indices Element indices.
+     * @param count Number of indices. It must be a multiple of 8.
+     * @returns Undefined.
+     */
+    int32_t gatherAVX512_Word64(void* base, const uint32_t* indices, size_t count);
+
+    /**
+     * @brief Stores a 64-bit element at each index with AVX-512 scatters of eight elements.
+     * @param base Base address of the 64-bit element array.
+     * @param indices Element indices.
+     * @param count Number of indices. It must be a multiple of 8.
+     * @returns Undefined.
+     */
+    int32_t scatterAVX512_Word64(void* base, const uint32_t* indices, size_t count);
+#endif
+
+    /***********************************************************************
+     ***********************************************************************
+     ******************* MULTI-STREAM BENCHMARK KERNELS ********************
+     ***********************************************************************
+     ***********************************************************************/
+
+    /* --------------------- DUMMY BENCHMARK ROUTINES --------------------------- */
+
+    /**
+     * @brief Walks the same cache line addresses as the multi-stream kernels without touching memory, so that their loop overhead can be subtracted.
+     * @param start_address Beginning of the first stream. The streams are laid out back to back.
+     * @param stream_len Length of each stream in bytes. It must be a multiple of the cache line size.
+     * @param num_streams Number of streams.
+     * @returns Undefined.
+     */
+    int32_t dummy_multiStreamLoop(void* start_address, size_t stream_len, uint32_t num_streams);
+
+    /* ------------------------------------------------------------------------- */
+    /* --------------------- CORE BENCHMARK ROUTINES --------------------------- */
+    /* ------------------------------------------------------------------------- */
+
+#ifdef HAS_WORD_64
+    /**
+     * @brief Reads several sequential streams at once, one whole cache line of each stream in turn, from the beginning of the streams to their end.
+     * @param start_address Beginning of the first stream. The streams are laid out back to back.
+     * @param stream_len Length of each stream in bytes. It must be a multiple of the cache line size.
+     * @param num_streams Number of streams.
+     * @returns Undefined.
+     */
+    int32_t forwMultiStreamRead_Word64(void* start_address, size_t stream_len, uint32_t num_streams);
+
+    /**
+     * @brief Reads several sequential streams at once, one whole cache line of each stream in turn, from the end of the streams to their beginning.
+     * @param start_address Beginning of the first stream. The streams are laid out back to back.
+     * @param stream_len Length of each stream in bytes. It must be a multiple of the cache line size.
+     * @param num_streams Number of streams.
+     * @returns Undefined.
+     */
+    int32_t revMultiStreamRead_Word64(void* start_address, size_t stream_len, uint32_t num_streams);
+#endif
+
+#ifdef HAS_WORD_256
+    /**
+     * @brief Reads several sequential streams at once, one whole cache line of each stream in turn, from the beginning of the streams to their end.
+     * @param start_address Beginning of the first stream. The streams are laid out back to back.
+     * @param stream_len Length of each stream in bytes. It must be a multiple of the cache line size.
+     * @param num_streams Number of streams.
+     * @returns Undefined.
+     */
+    int32_t forwMultiStreamRead_Word256(void* start_address, size_t stream_len, uint32_t num_streams);
+
+    /**
+     * @brief Reads several sequential streams at once, one whole cache line of each stream in turn, from the end of the streams to their beginning.
+     * @param start_address Beginning of the first stream. The streams are laid out back to back.
+     * @param stream_len Length of each stream in bytes. It must be a multiple of the cache line size.
+     * @param num_streams Number of streams.
+     * @returns Undefined.
+     */
+    int32_t revMultiStreamRead_Word256(void* start_address, size_t stream_len, uint32_t num_streams);
+#endif
+
+    /***********************************************************************
+     ***********************************************************************
+     ****************** UNALIGNED ACCESS BENCHMARK KERNELS *****************
+     ***********************************************************************
+     ***********************************************************************/
+
+    /* ------------------------------------------------------------------------- */
+    /* --------------------- CORE BENCHMARK ROUTINES --------------------------- */
+    /* ------------------------------------------------------------------------- */
+
+    //The dummy routines of the aligned forward sequential and random kernels are reused.
+
+#ifdef ARCH_INTEL
+    /**
+     * @brief Walks the memory with 32-bit unaligned loads, from start to end. Start may be at any byte address.
+     * @param start_address The beginning of the region to read.
+     * @param end_address The end of the region to read.
+     * @returns Undefined.
+     */
+    int32_t forwSequentialReadUnaligned_Word32(void* start_address, void* end_address);
+
+    /**
+     * @brief Walks the memory with 32-bit unaligned stores, from start to end. Start may be at any byte address.
+     * @param start_address The beginning of the region to write.
+     * @param end_address The end of the region to write.
+     * @returns Undefined.
+     */
+    int32_t forwSequentialWriteUnaligned_Word32(void* start_address, void* end_address);
+
+#ifdef HAS_WORD_64
+    /**
+     * @brief Walks the memory with 64-bit unaligned loads, from start to end. Start may be at any byte address.
+     * @param start_address The beginning of the region to read.
+     * @param end_address The end of the region to read.
+     * @returns Undefined.
+     */
+    int32_t forwSequentialReadUnaligned_Word64(void* start_address, void* end_address);
+
+    /**
+     * @brief Walks the memory with 64-bit unaligned stores, from start to end. Start may be at any byte address.
+     * @param start_address The beginning of the region to write.
+     * @param end_address The end of the region to write.
+     * @returns Undefined.
+     */
+    int32_t forwSequentialWriteUnaligned_Word64(void* start_address, void* end_address);
+
+    /**
+     * @brief Chases a chain of pointers at any byte addresses with 64-bit unaligned loads.
+     * @param first_address Starting address to dereference.
+     * @param last_touched_address Pointer to write the final address that was dereferenced.
+     * @param len Unused.
+     * @returns Undefined.
+     */
+    int32_t randomReadUnaligned_Word64(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len);
+#endif
+
+#ifdef HAS_WORD_128
+    /**
+     * @brief Walks the memory with 128-bit unaligned loads, from start to end. Start may be at any byte address.
+     * @param start_address The beginning of the region to read.
+     * @param end_address The end of the region to read.
+     * @returns Undefined.
+     */
+    int32_t forwSequentialReadUnaligned_Word128(void* start_address, void* end_address);
+
+    /**
+     * @brief Walks the memory with 128-bit unaligned stores, from start to end. Start may be at any byte address.
+     * @param start_address The beginning of the region to write.
+     * @param end_address The end of the region to write.
+     * @returns Undefined.
+     */
+    int32_t forwSequentialWriteUnaligned_Word128(void* start_address, void* end_address);
+
+    /**
+     * @brief Chases a chain of pointers at any byte addresses with 128-bit unaligned loads. Only the first pointer-sized bits of each loaded word are used to make the next hop.
+     * @param first_address Starting address to dereference.
+     * @param last_touched_address Pointer to write the final address that was dereferenced.
+     * @param len Unused.
+     * @returns Undefined.
+     */
+    int32_t randomReadUnaligned_Word128(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len);
+#endif
+
+#ifdef HAS_WORD_256
+    /**
+     * @brief Walks the memory with 256-bit unaligned loads, from start to end. Start may be at any byte address.
+     * @param start_address The beginning of the region to read.
+     * @param end_address The end of the region to read.
+     * @returns Undefined.
+     */
+    int32_t forwSequentialReadUnaligned_Word256(void* start_address, void* end_address);
+
+    /**
+     * @brief Walks the memory with 256-bit unaligned stores, from start to end. Start may be at any byte address.
+     * @param start_address The beginning of the region to write.
+     * @param end_address The end of the region to write.
+     * @returns Undefined.
+     */
+    int32_t forwSequentialWriteUnaligned_Word256(void* start_address, void* end_address);
+
+    /**
+     * @brief Chases a chain of pointers at any byte addresses with 256-bit unaligned loads. Only the first pointer-sized bits of each loaded word are used to make the next hop.
+     * @param first_address Starting address to dereference.
+     * @param last_touched_address Pointer to write the final address that was dereferenced.
+     * @param len Unused.
+     * @returns Undefined.
+     */
+    int32_t randomReadUnaligned_Word256(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len);
+#endif
+#endif
+
+    /***********************************************************************
+     ***********************************************************************
+     ******************** DATA PATTERN BENCHMARK KERNELS *******************
+     ***********************************************************************
+     ***********************************************************************/
+
+    /* ------------------------------------------------------------------------- */
+    /* --------------------- DUMMY BENCHMARK ROUTINES --------------------------- */
+    /* ------------------------------------------------------------------------- */
+
+    /**
+     * @brief Runs the loop structure of the 32-bit data pattern write kernel without touching memory.
+     * @param pattern_block Unused.
+     * @param start_address The beginning of the region.
+     * @param end_address The end of the region.
+     * @returns Undefined.
+     */
+    int32_t dummy_forwSequentialPatternLoop_Word32(void* pattern_block, void* start_address, void* end_address);
+
+#ifdef HAS_WORD_64
+    /**
+     * @brief Runs the loop structure of the 64-bit data pattern write kernel without touching memory.
+     * @param pattern_block Unused.
+     * @param start_address The beginning of the region.
+     * @param end_address The end of the region.
+     * @returns Undefined.
+     */
+    int32_t dummy_forwSequentialPatternLoop_Word64(void* pattern_block, void* start_address, void* end_address);
+#endif
+
+#ifdef HAS_WORD_128
+    /**
+     * @brief Runs the loop structure of the 128-bit data pattern write kernel without touching memory.
+     * @param pattern_block Unused.
+     * @param start_address The beginning of the region.
+     * @param end_address The end of the region.
+     * @returns Undefined.
+     */
+    int32_t dummy_forwSequentialPatternLoop_Word128(void* pattern_block, void* start_address, void* end_address);
+#endif
+
+#ifdef HAS_WORD_256
+    /**
+     * @brief Runs the loop structure of the 256-bit data pattern write kernel without touching memory.
+     * @param pattern_block Unused.
+     * @param start_address The beginning of the region.
+     * @param end_address The end of the region.
+     * @returns Undefined.
+     */
+    int32_t dummy_forwSequentialPatternLoop_Word256(void* pattern_block, void* start_address, void* end_address);
+#endif
+
+#ifdef HAS_WORD_512
+    /**
+     * @brief Runs the loop structure of the 512-bit data pattern write kernel without touching memory.
+     * @param pattern_block Unused.
+     * @param start_address The beginning of the region.
+     * @param end_address The end of the region.
+     * @returns Undefined.
+     */
+    int32_t dummy_forwSequentialPatternLoop_Word512(void* pattern_block, void* start_address, void* end_address);
+#endif
+
+    /* ------------------------------------------------------------------------- */
+    /* --------------------- CORE BENCHMARK ROUTINES --------------------------- */
+    /* ------------------------------------------------------------------------- */
+
+    /**
+     * @brief Writes copies of a pattern block over memory with 32-bit stores, from start to end.
+     * @param pattern_block The pattern block of DATA_PATTERN_BLOCK_SIZE bytes, aligned to the word size.
+     * @param start_address The beginning of the region to write. The region must hold a whole number of pattern blocks.
+     * @param end_address The end of the region to write.
+     * @returns Undefined.
+     */
+    int32_t forwSequentialPatternWrite_Word32(void* pattern_block, void* start_address, void* end_address);
+
+#ifdef HAS_WORD_64
+    /**
+     * @brief Writes copies of a pattern block over memory with 64-bit stores, from start to end.
+     * @param pattern_block The pattern block of DATA_PATTERN_BLOCK_SIZE bytes, aligned to the word size.
+     * @param start_address The beginning of the region to write. The region must hold a whole number of pattern blocks.
+     * @param end_address The end of the region to write.
+     * @returns Undefined.
+     */
+    int32_t forwSequentialPatternWrite_Word64(void* pattern_block, void* start_address, void* end_address);
+#endif
+
+#ifdef HAS_WORD_128
+    /**
+     * @brief Writes copies of a pattern block over memory with 128-bit stores, from start to end.
+     * @param pattern_block The pattern block of DATA_PATTERN_BLOCK_SIZE bytes, aligned to the word size.
+     * @param start_address The beginning of the region to write. The region must hold a whole number of pattern blocks.
+     * @param end_address The end of the region to write.
+     * @returns Undefined.
+     */
+    int32_t forwSequentialPatternWrite_Word128(void* pattern_block, void* start_address, void* end_address);
+#endif
+
+#ifdef HAS_WORD_256
+    /**
+     * @brief Writes copies of a pattern block over memory with 256-bit stores, from start to end.
+     * @param pattern_block The pattern block of DATA_PATTERN_BLOCK_SIZE bytes, aligned to the word size.
+     * @param start_address The beginning of the region to write. The region must hold a whole number of pattern blocks.
+     * @param end_address The end of the region to write.
+     * @returns Undefined.
+     */
+    int32_t forwSequentialPatternWrite_Word256(void* pattern_block, void* start_address, void* end_address);
+#endif
+
+#ifdef HAS_WORD_512
+    /**
+     * @brief Writes copies of a pattern block over memory with 512-bit stores, from start to end.
+     * @param pattern_block The pattern block of DATA_PATTERN_BLOCK_SIZE bytes, aligned to the word size.
+     * @param start_address The beginning of the region to write. The region must hold a whole number of pattern blocks.
+     * @param end_address The end of the region to write.
+     * @returns Undefined.
+     */
+    int32_t forwSequentialPatternWrite_Word512(void* pattern_block, void* start_address, void* end_address);
+#endif
+
+    /***********************************************************************
+     ***********************************************************************
+     ********************* 2D TILED BENCHMARK KERNELS **********************
+     ***********************************************************************
+     ***********************************************************************/
+
+#ifdef HAS_WORD_64
+    /* ------------------------------------------------------------------------- */
+    /* --------------------- DUMMY BENCHMARK ROUTINES --------------------------- */
+    /* ------------------------------------------------------------------------- */
+
+    /**
+     * @brief Runs the loop structure of the row-major 2D kernels without touching memory.
+     * @param src The beginning of the 2D array.
+     * @param dst Unused.
+     * @param geometry Shape of the array and its tiles.
+     * @returns Undefined.
+     */
+    int32_t dummy_rowMajor2DLoop_Word64(void* src, void* dst, const tile_geometry_t* geometry);
+
+    /**
+     * @brief Runs the loop structure of the column-major 2D kernels without touching memory.
+     * @param src The beginning of the 2D array.
+     * @param dst Unused.
+     * @param geometry Shape of the array and its tiles.
+     * @returns Undefined.
+     */
+    int32_t dummy_columnMajor2DLoop_Word64(void* src, void* dst, const tile_geometry_t* geometry);
+
+    /**
+     * @brief Runs the loop structure of the blocked 2D kernels without touching memory.
+     * @param src The beginning of the 2D array.
+     * @param dst Unused.
+     * @param geometry Shape of the array and its tiles.
+     * @returns Undefined.
+     */
+    int32_t dummy_blocked2DLoop_Word64(void* src, void* dst, const tile_geometry_t* geometry);
+
+    /**
+     * @brief Runs the loop structure of the Morton-order 2D kernels without touching memory.
+     * @param src The beginning of the 2D array.
+     * @param dst Unused.
+     * @param geometry Shape of the array and its tiles.
+     * @returns Undefined.
+     */
+    int32_t dummy_morton2DLoop_Word64(void* src, void* dst, const tile_geometry_t* geometry);
+
+    /**
+     * @brief Runs the loop structure of the 2D transpose kernel without touching memory.
+     * @param src The beginning of the source array.
+     * @param dst The beginning of the destination array.
+     * @param geometry Shape of the source array and its tiles.
+     * @returns Undefined.
+     */
+    int32_t dummy_transpose2DLoop_Word64(void* src, void* dst, const tile_geometry_t* geometry);
+
+    /* ------------------------------------------------------------------------- */
+    /* --------------------- CORE BENCHMARK ROUTINES --------------------------- */
+    /* ------------------------------------------------------------------------- */
+
+    /**
+     * @brief Reads every element of a 2D array in row-major order.
+     * @param src The beginning of the 2D array.
+     * @param dst Unused.
+     * @param geometry Shape of the array and its tiles.
+     * @returns Undefined.
+     */
+    int32_t rowMajor2DRead_Word64(void* src, void* dst, const tile_geometry_t* geometry);
+
+    /**
+     * @brief Writes every element of a 2D array in row-major order.
+     * @param src The beginning of the 2D array.
+     * @param dst Unused.
+     * @param geometry Shape of the array and its tiles.
+     * @returns Undefined.
+     */
+    int32_t rowMajor2DWrite_Word64(void* src, void* dst, const tile_geometry_t* geometry);
+
+    /**
+     * @brief Reads every element of a 2D array in column-major order.
+     * @param src The beginning of the 2D array.
+     * @param dst Unused.
+     * @param geometry Shape of the array and its tiles.
+     * @returns Undefined.
+     */
+    int32_t columnMajor2DRead_Word64(void* src, void* dst, const tile_geometry_t* geometry);
+
+    /**
+     * @brief Writes every element of a 2D array in column-major order.
+     * @param src The beginning of the 2D array.
+     * @param dst Unused.
+     * @param geometry Shape of the array and its tiles.
+     * @returns Undefined.
+     */
+    int32_t columnMajor2DWrite_Word64(void* src, void* dst, const tile_geometry_t* geometry);
+
+    /**
+     * @brief Reads every element of a 2D array in blocked order.
+     * @param src The beginning of the 2D array.
+     * @param dst Unused.
+     * @param geometry Shape of the array and its tiles.
+     * @returns Undefined.
+     */
+    int32_t blocked2DRead_Word64(void* src, void* dst, const tile_geometry_t* geometry);
+
+    /**
+     * @brief Writes every element of a 2D array in blocked order.
+     * @param src The beginning of the 2D array.
+     * @param dst Unused.
+     * @param geometry Shape of the array and its tiles.
+     * @returns Undefined.
+     */
+    int32_t blocked2DWrite_Word64(void* src, void* dst, const tile_geometry_t* geometry);
+
+    /**
+     * @brief Reads every element of a 2D array in Morton-order order.
+     * @param src The beginning of the 2D array.
+     * @param dst Unused.
+     * @param geometry Shape of the array and its tiles.
+     * @returns Undefined.
+     */
+    int32_t morton2DRead_Word64(void* src, void* dst, const tile_geometry_t* geometry);
+
+    /**
+     * @brief Writes every element of a 2D array in Morton-order order.
+     * @param src The beginning of the 2D array.
+     * @param dst Unused.
+     * @param geometry Shape of the array and its tiles.
+     * @returns Undefined.
+     */
+    int32_t morton2DWrite_Word64(void* src, void* dst, const tile_geometry_t* geometry);
+
+    /**
+     * @brief Copies a 2D array into its transpose, tile by tile in row-major order. The destination rows are as long as the source columns and are not padded.
+     * @param src The beginning of the source array.
+     * @param dst The beginning of the destination array.
+     * @param geometry Shape of the source array and its tiles.
+     * @returns Undefined.
+     */
+    int32_t transpose2D_Word64(void* src, void* dst, const tile_geometry_t* geometry);
+#endif
+
+    /***********************************************************************
+     ***********************************************************************
+     ********************* ROOFLINE BENCHMARK KERNELS **********************
+     ***********************************************************************
+     ***********************************************************************/
+
+    /* --------------------- DUMMY BENCHMARK ROUTINES --------------------------- */
+
+    /**
+     * @brief Walks the memory region a page at a time without loading it, so that the call overhead of the roofline kernels can be subtracted. Their own loop overhead is hidden behind the loads and multiply-adds, and is part of what they measure.
+     * @param start_address The beginning of the memory region of interest.
+     * @param end_address The end of the memory region of interest.
+     * @param madds_per_element Unused.
+     * @returns Undefined.
+     */
+    int32_t dummy_rooflineLoop(void* start_address, void* end_address, uint32_t madds_per_element);
+
+    /* ------------------------------------------------------------------------- */
+    /* --------------------- CORE BENCHMARK ROUTINES --------------------------- */
+    /* ------------------------------------------------------------------------- */
+
+#ifdef HAS_WORD_64
+    /**
+     * @brief Loads every double-precision element of a memory region and folds it into one of eight accumulators with a chain of scalar fused multiply-adds.
+     * @param start_address The beginning of the memory region of interest. It must hold doubles that are neither denormal nor NaN.
+     * @param end_address The end of the memory region of interest. The region must be a multiple of 64 B.
+     * @param madds_per_element Number of multiply-adds applied for each element. It must be at least 1.
+     * @returns Undefined.
+     */
+    int32_t rooflineScalarFMA_Word64(void* start_address, void* end_address, uint32_t madds_per_element);
+
+    /**
+     * @brief Loads every 64-bit integer element of a memory region and folds it into one of eight accumulators with a chain of scalar multiplies and adds.
+     * @param start_address The beginning of the memory region of interest.
+     * @param end_address The end of the memory region of interest. The region must be a multiple of 64 B.
+     * @param madds_per_element Number of multiply-adds applied for each element. It must be at least 1.
+     * @returns Undefined.
+     */
+    int32_t rooflineScalarInt_Word64(void* start_address, void* end_address, uint32_t madds_per_element);
+#endif
+
+#if defined(ARCH_INTEL_X86_64) && defined(HAS_WORD_256)
+    /**
+     * @brief Loads every double-precision element of a memory region four at a time and folds them into eight vector accumulators with a chain of AVX2 fused multiply-adds.
+     * @param start_address The beginning of the memory region of interest. It must be 32 B aligned and hold doubles that are neither denormal nor NaN.
+     * @param end_address The end of the memory region of interest. The region must be a multiple of 256 B.
+     * @param madds_per_element Number of multiply-adds applied for each element. It must be at least 1.
+     * @returns Undefined.
+     */
+    int32_t rooflineAVX2FMA_Word256(void* start_address, void* end_address, uint32_t madds_per_element);
+
+    /**
+     * @brief Loads every double-precision element of a memory region eight at a time and folds them into eight vector accumulators with a chain of AVX-512 fused multiply-adds.
+     * @param start_address The beginning of the memory region of interest. It must be 64 B aligned and hold doubles that are neither denormal nor NaN.
+     * @param end_address The end of the memory region of interest. The region must be a multiple of 512 B.
+     * @param madds_per_element Number of multiply-adds applied for each element. It must be at least 1.
+     * @returns Undefined.
+     */
+    int32_t rooflineAVX512FMA_Word512(void* start_address, void* end_address, uint32_t madds_per_element);
 #endif
 };
 
@@ -35,6 +35,8 @@
 //Libraries
 #include <cstdint>
 #include <cstddef>
+#include <string>
+#include <vector>
 
 #ifdef _WIN32
 #include <windows.h>
@@ -256,6 +258,7 @@ namespace xmem {
 #define DEFAULT_NUM_L2_CACHES 0 /**< Default number of L2 caches. */
 #define DEFAULT_NUM_L3_CACHES 0 /**< Default number of L3 caches. */
 #define DEFAULT_NUM_L4_CACHES 0 /**< Default number of L4 caches. */
+#define CACHE_LINE_SIZE 64 /**< Assumed cache line size in bytes, used to keep data that is shared between cores on separate lines. */
 #define MIN_ELAPSED_TICKS 10000 /**< If any routine measured fewer than this number of ticks its results should be viewed with suspicion. This is because the latency of the timer itself will matter. */
 
 
@@ -300,9 +303,60 @@ namespace xmem {
 
 #define POWER_SAMPLING_PERIOD_MS 1000 /**< RECOMMENDED VALUE: 1000. Sampling period in milliseconds for all power measurement mechanisms. */
 
+#define LOAD_RATE_CONTROL_SLICE_US 100 /**< RECOMMENDED VALUE: 100. Length of each time slice in microseconds for rate-controlled load workers. Shorter slices spread traffic more evenly but add timer overhead. */
+#define LOAD_RATE_CONTROL_KP 0.5 /**< Proportional gain of the rate-controlled load worker feedback controller, applied to the byte error of the previous slice. */
+#define LOAD_RATE_CONTROL_KI 0.5 /**< Integral gain of the rate-controlled load worker feedback controller, applied to the accumulated byte error. */
+#define LOAD_RATE_CONTROL_SHORTFALL_THRESHOLD 0.95 /**< A rate-controlled load is flagged if the achieved bandwidth falls below this fraction of the target. */
+#define LOAD_RATE_CONTROL_WINDUP_SLICES 8 /**< The accumulated error of the rate controller is limited to this many slices worth of bytes, so that an unreachable target does not build up an unbounded backlog. */
+#define LOAD_PROFILE_START_DELAY_MS 100 /**< RECOMMENDED VALUE: 100. Time in milliseconds between starting the worker threads of a loaded latency benchmark with a load profile and the common start of the profile, so that all workers can finish priming memory first. */
+#define LOAD_PROFILE_SAMPLE_PERIOD_US 500 /**< RECOMMENDED VALUE: 500. Length in microseconds of each latency sampling interval in loaded latency benchmarks with a load profile. Each interval should hold several latency measurement passes. */
+#define INTERFERENCE_DEFAULT_REPORT_INTERVAL_MS 1000 /**< RECOMMENDED VALUE: 1000. Default period in milliseconds at which the interference generator mode reports achieved bandwidth. */
+#define INTERFERENCE_STOP_POLL_MS 10 /**< RECOMMENDED VALUE: 10. Period in milliseconds at which the interference generator mode checks for a stop signal or its deadline. */
+#define LOAD_PROFILE_RECOVERY_TOLERANCE 0.1 /**< After the load of a profile drops, latency counts as recovered once the mean latency of a sampling interval is within this fraction of the low-load latency. */
+#define C2C_LATENCY_ROUND_TRIPS 20000 /**< RECOMMENDED VALUE: At least 10000. Number of timed round trips of the shared cache line per core pair and iteration in the core-to-core latency benchmark. */
+#define C2C_LATENCY_WARMUP_ROUND_TRIPS 1000 /**< Number of untimed round trips before timing starts in the core-to-core latency benchmark, so that both threads are spinning when it does. */
+#define C2C_BANDWIDTH_BYTES_PER_ITERATION 256*MB /**< RECOMMENDED VALUE: At least 64 MB. Number of bytes moved from the producer to the consumer per core pair, block size, and iteration in the core-to-core bandwidth benchmark. */
+#define C2C_BANDWIDTH_HANDOFF_BLOCKS 10000 /**< Number of blocks moved one at a time per core pair, block size, and iteration to measure the handoff latency in the core-to-core bandwidth benchmark. */
+#define C2C_BANDWIDTH_DEFAULT_BLOCK_SIZE 4096 /**< Default block size in bytes of the core-to-core bandwidth benchmark. */
+#define ATOMIC_BENCHMARK_DURATION_MS 250 /**< RECOMMENDED VALUE: At least 100. Rough duration in milliseconds of each thread count, operation, and sharing mode setting of the atomic operation benchmark. */
+#define ATOMIC_OPS_PER_KERNEL_CALL 64 /**< Number of atomic operations done by each call of an atomic operation kernel. */
+#define FLUSH_BENCHMARK_DURATION_MS 250 /**< RECOMMENDED VALUE: At least 100. Rough time in milliseconds spent flushing for each measurement of the cache flush benchmark. Preparing the lines before each pass is not included. */
+#define COPY_BENCHMARK_DURATION_MS 250 /**< RECOMMENDED VALUE: At least 100. Rough duration in milliseconds of each engine, size setting, placement, and iteration of the copy/fill benchmark. */
+#define COPY_CALLS_PER_TIMING 64 /**< Number of copy or fill calls timed together in the copy/fill benchmark, so that timer overhead stays small for short calls. */
+#define COPY_SIZE_SEQUENCE_LENGTH 4096 /**< Number of call sizes drawn up front from a size distribution in the copy/fill benchmark. The calls cycle over them. */
+#define GATHER_BENCHMARK_DURATION_MS 250 /**< RECOMMENDED VALUE: At least 100. Rough duration in milliseconds of each engine, index pattern, placement, and iteration of the gather/scatter benchmark. */
+#define GATHER_ELEMENTS_PER_TIMING 65536 /**< Minimum number of elements gathered or scattered between timer reads in the gather/scatter benchmark, so that timer overhead stays small for short index arrays. */
+#define GATHER_DEFAULT_STRIDE 8 /**< Default distance in 64-bit elements between consecutive indices of the strided gather/scatter index pattern. */
+#define GATHER_DEFAULT_WINDOW_SIZE 4096 /**< Default window size in bytes within which the windowed gather/scatter index pattern is shuffled. */
+#define MULTI_STREAM_BENCHMARK_DURATION_MS 250 /**< RECOMMENDED VALUE: At least 100. Rough duration in milliseconds of each stream count, direction, placement, and iteration of the multi-stream benchmark. */
+#define MULTI_STREAM_BYTES_PER_TIMING 65536 /**< Minimum number of bytes read between timer reads in the multi-stream benchmark, so that timer overhead stays small for small working sets. */
+#define MULTI_STREAM_MAX_STREAMS 64 /**< Largest number of concurrent sequential streams per thread in the multi-stream benchmark. */
+#define MULTI_STREAM_CLIFF_DROP 0.15 /**< Relative bandwidth drop below the best bandwidth at fewer streams that the multi-stream benchmark reports as the stream-tracking cliff of the hardware prefetchers. */
+#define UNALIGNED_BENCHMARK_DURATION_MS 250 /**< RECOMMENDED VALUE: At least 100. Rough duration in milliseconds of each measurement, chunk size, offset, placement, and iteration of the unaligned access benchmark. */
+#define UNALIGNED_BYTES_PER_TIMING 65536 /**< Minimum number of bytes accessed between timer reads in the throughput measurements of the unaligned access benchmark, so that timer overhead stays small for small working sets. */
+#define DATA_PATTERN_BENCHMARK_DURATION_MS 250 /**< RECOMMENDED VALUE: At least 100. Rough duration in milliseconds of each measurement, data pattern, chunk size, placement, and iteration of the data pattern benchmark. */
+#define DATA_PATTERN_BYTES_PER_TIMING 65536 /**< Minimum number of bytes accessed between timer reads in the data pattern benchmark, so that timer overhead stays small for small working sets. */
+#define DATA_PATTERN_BLOCK_SIZE 8192 /**< Size in bytes of the pattern block that the data pattern write kernels repeat over memory. It is small enough to stay in the L1 cache, so that the writes are limited by memory rather than by reading the pattern. */
+#define DATA_PATTERN_FILE_MAX_SIZE 67108864 /**< Largest number of bytes read from a data pattern file. Longer files are truncated. */
+#define TILED_BENCHMARK_DURATION_MS 250 /**< RECOMMENDED VALUE: At least 100. Rough duration in milliseconds of each traversal order, read/write mode, placement, and iteration of the 2D tiled benchmark. */
+#define TILED_BYTES_PER_TIMING 65536 /**< Minimum number of bytes accessed between timer reads in the 2D tiled benchmark, so that timer overhead stays small for small working sets. */
+#define TILED_DEFAULT_ROW_PITCH 4096 /**< Default distance in bytes between the starts of consecutive rows in the 2D tiled benchmark. */
+#define TILED_DEFAULT_TILE_SIZE 8 /**< Default tile width and height in 64-bit elements in the 2D tiled benchmark. */
+#define ROOFLINE_BENCHMARK_DURATION_MS 250 /**< RECOMMENDED VALUE: At least 100. Rough duration in milliseconds of each engine, arithmetic intensity, placement, and iteration of the roofline benchmark. */
+#define ROOFLINE_BYTES_PER_TIMING 65536 /**< Minimum number of bytes loaded between timer reads in the roofline benchmark, so that timer overhead stays small for small working sets. */
+#define ROOFLINE_BYTES_PER_ITERATION 512 /**< Number of bytes loaded by each loop iteration of the widest roofline kernel. Working sets must be a multiple of it. */
+#define ROOFLINE_DEFAULT_MIN_OPS_PER_ELEMENT 2 /**< Smallest number of operations per loaded 64-bit element in the default arithmetic intensity sweep of the roofline benchmark. It is one fused multiply-add. */
+#define ROOFLINE_DEFAULT_MAX_OPS_PER_ELEMENT 256 /**< Largest number of operations per loaded 64-bit element in the default arithmetic intensity sweep of the roofline benchmark. The sweep doubles from the smallest. */
+#define FALSE_SHARING_DURATION_MS 250 /**< RECOMMENDED VALUE: At least 100. Rough duration in milliseconds of each thread group, padding, and iteration of the false sharing benchmark. */
+#define FALSE_SHARING_MAX_PADDING 128 /**< Largest padding in bytes between the words of the false sharing benchmark. */
+#define ATOMIC_DEFAULT_SPREAD_ADDRESSES 16 /**< Default number of cache lines that threads cycle over in the spread sharing mode of the atomic operation benchmark. */
+
 //++++++++++++++++++ User-implemented extensions configuration here +++++++++++++++++++++
 //Only one extension may be enabled at a time.
-#define EXT_DELAY_INJECTED_LOADED_LATENCY_BENCHMARK /**< RECOMMENDED ENABLED. This allows for a custom extension to X-Mem that performs latency benchmarking with forward sequential 64-bit and 256-bit read-based load threads with variable delays injected in between memory accesses. */
+#define EXT_DELAY_INJECTED_LOADED_LATENCY_BENCHMARK /**< RECOMMENDED ENABLED. This allows for a custom extension to X-Mem that performs latency benchmarking with load threads that have variable delays injected in between memory accesses. */
+#ifdef EXT_DELAY_INJECTED_LOADED_LATENCY_BENCHMARK
+#define EXT_DELAY_INJECTED_LOADED_LATENCY_BENCHMARK_DEFAULT_DELAY_SWEEP "0:1024:x1.25" /**< Default delays in nops for the delay-injected loaded latency benchmark extension, in the same MIN:MAX:STEP form as the delay_sweep option. */
+#endif
 //#define EXT_STREAM_BENCHMARK /**< RECOMMENDED DISABLED. This allows for a custom extension to X-Mem that performs stream copy, add, and triad kernels similar to those of the well-known STREAM throughput benchmark. */
 
 /***********************************************************************************************************/
@@ -421,14 +475,133 @@ namespace xmem {
     } pattern_mode_t;
 
     /**
-     * @brief Memory access batterns are broadly categorized by reads and writes.
+     * @brief Memory access batterns are broadly categorized by reads and writes. Read/write mixes read and write separate streams of memory in a fixed ratio, while read-modify-write updates memory in place.
      */
     typedef enum {
         READ,
         WRITE,
+        READ_WRITE_1_1, /**< One read for every write. */
+        READ_WRITE_2_1, /**< Two reads for every write. */
+        READ_WRITE_3_1, /**< Three reads for every write. */
+        READ_MODIFY_WRITE, /**< Each chunk is read, modified, and written back in place. */
         NUM_RW_MODES
     } rw_mode_t;
 
+    /**
+     * @brief Atomic read-modify-write operations, which are benchmarked beside the plain reads and writes of rw_mode_t.
+     */
+    typedef enum {
+        ATOMIC_FETCH_ADD, /**< Atomic fetch-and-add, i.e., lock xadd on x86. */
+        ATOMIC_COMPARE_EXCHANGE, /**< Atomic compare-and-swap of the last observed value, i.e., lock cmpxchg on x86. */
+        ATOMIC_EXCHANGE, /**< Atomic swap, i.e., xchg on x86. */
+        NUM_ATOMIC_OPS
+    } atomic_op_t;
+
+    /**
+     * @brief How the cache lines targeted by atomic operations are shared among threads.
+     */
+    typedef enum {
+        ATOMIC_PRIVATE, /**< Each thread has its own cache line. */
+        ATOMIC_SHARED, /**< All threads target the same cache line. */
+        ATOMIC_SPREAD, /**< All threads cycle over a fixed number of cache lines. */
+        NUM_ATOMIC_SHARING_MODES
+    } atomic_sharing_t;
+
+    /**
+     * @brief Cache line flush instructions.
+     */
+    typedef enum {
+        FLUSH_CLFLUSH, /**< clflush: writes back and invalidates a line. Flushes are ordered with each other. */
+        FLUSH_CLFLUSHOPT, /**< clflushopt: writes back and invalidates a line. Flushes of different lines may overlap until a fence. */
+        FLUSH_CLWB, /**< clwb: writes back a line, which may stay in the cache in the clean state. */
+        NUM_FLUSH_OPS
+    } flush_op_t;
+
+    /**
+     * @brief Memory copy and fill engines.
+     */
+    typedef enum {
+        COPY_MEMCPY, /**< C library memcpy(). */
+        COPY_MEMMOVE, /**< C library memmove(). */
+        COPY_REP_MOVSB, /**< rep movsb string copy. */
+        COPY_VECTOR, /**< X-Mem 256-bit vector loads and stores. */
+        COPY_VECTOR_NT, /**< X-Mem 256-bit vector loads and non-temporal stores. */
+        FILL_MEMSET, /**< C library memset(). */
+        FILL_REP_STOSB, /**< rep stosb string fill. */
+        FILL_VECTOR, /**< X-Mem 256-bit vector stores. */
+        FILL_VECTOR_NT, /**< X-Mem 256-bit vector non-temporal stores. */
+        NUM_COPY_ENGINES
+    } copy_engine_t;
+
+    /**
+     * @brief Gather and scatter engines. All of them move 64-bit elements addressed by 32-bit indices.
+     */
+    typedef enum {
+        GATHER_SCALAR, /**< One scalar load per index. */
+        GATHER_AVX2, /**< AVX2 vpgatherdq, four elements per instruction. */
+        GATHER_AVX512, /**< AVX-512 vpgatherdq, eight elements per instruction. */
+        SCATTER_SCALAR, /**< One scalar store per index. */
+        SCATTER_AVX512, /**< AVX-512 vpscatterdq, eight elements per instruction. */
+        NUM_GATHER_ENGINES
+    } gather_engine_t;
+
+    /**
+     * @brief Index stream patterns for the gather/scatter benchmark.
+     */
+    typedef enum {
+        GATHER_INDEX_SEQUENTIAL, /**< Indices 0, 1, 2, ... */
+        GATHER_INDEX_STRIDED, /**< Indices advance by a fixed element stride, wrapping around with an offset of one. */
+        GATHER_INDEX_WINDOW, /**< Sequential windows of fixed size, shuffled within each window. */
+        GATHER_INDEX_RANDOM, /**< A random permutation of the whole array. */
+        NUM_GATHER_INDEX_PATTERNS
+    } gather_index_t;
+
+    /**
+     * @brief Data patterns that memory is initialized and written with.
+     */
+    typedef enum {
+        DATA_ZEROS, /**< All bits clear. */
+        DATA_ONES, /**< All bits set. */
+        DATA_ALTERNATING, /**< Alternating bits, with 64-bit words that alternate between 0x55...55 and 0xAA...AA so that every bit toggles from one word to the next. */
+        DATA_RANDOM, /**< Pseudo-random, incompressible bits. */
+        DATA_FILE, /**< The contents of a user file, repeated. */
+        NUM_DATA_PATTERNS
+    } data_pattern_t;
+
+    /**
+     * @brief Traversal orders of a 2D array of 64-bit elements with padded rows.
+     */
+    typedef enum {
+        TILE_ORDER_ROW, /**< Row by row, each from left to right. */
+        TILE_ORDER_COLUMN, /**< Column by column, each from top to bottom. */
+        TILE_ORDER_BLOCKED, /**< Tile by tile in row-major order, row-major within each tile. */
+        TILE_ORDER_MORTON, /**< Tile by tile in Morton (Z) order, row-major within each tile. With 1x1 tiles, every element is visited in Morton order. */
+        TILE_ORDER_TRANSPOSE, /**< Copies the array into its transpose, tile by tile in row-major order. Rows of the source become columns of the destination. */
+        NUM_TILE_ORDERS
+    } tile_order_t;
+
+    /**
+     * @brief Shape of a 2D array of 64-bit elements with padded rows, and of the tiles it is traversed in.
+     */
+    typedef struct {
+        size_t width; /**< Number of elements in each row. */
+        size_t height; /**< Number of rows. */
+        size_t pitch; /**< Distance in elements between the starts of consecutive rows. It is at least the width. */
+        size_t tile_width; /**< Number of elements in each row of a tile. */
+        size_t tile_height; /**< Number of rows in a tile. */
+    } tile_geometry_t;
+
+    /**
+     * @brief Compute engines of the roofline benchmark. Each loads 64-bit elements sequentially and applies a chain of multiply-adds to every one of them, counted as two operations each.
+     */
+    typedef enum {
+        ROOFLINE_SCALAR_FMA, /**< Scalar double-precision fused multiply-adds. */
+        ROOFLINE_AVX2_FMA, /**< AVX2 double-precision fused multiply-adds, four elements per instruction. */
+        ROOFLINE_AVX512_FMA, /**< AVX-512 double-precision fused multiply-adds, eight elements per instruction. */
+        ROOFLINE_SCALAR_INT, /**< Scalar 64-bit integer multiplies and adds. */
+        NUM_ROOFLINE_ENGINES
+    } roofline_engine_t;
+
     /**
      * @brief Legal memory read/write chunk sizes in bits.
      */
@@ -449,6 +622,18 @@ namespace xmem {
         NUM_CHUNK_SIZES
     } chunk_size_t;
 
+    /**
+     * @brief How closely two logical CPUs are related in the processor topology, from closest to farthest.
+     */
+    typedef enum {
+        CPU_RELATION_SMT, /**< Hardware threads of the same physical core. */
+        CPU_RELATION_SHARED_LLC, /**< Different cores that share a last-level cache, e.g., in the same AMD CCX. */
+        CPU_RELATION_SAME_PACKAGE, /**< Different last-level caches in the same physical package, e.g., across AMD CCXs. */
+        CPU_RELATION_CROSS_PACKAGE, /**< Different physical packages (sockets). */
+        CPU_RELATION_UNKNOWN, /**< The topology could not be determined. */
+        NUM_CPU_RELATIONS
+    } cpu_relation_t;
+
     typedef enum {
 #ifdef EXT_DELAY_INJECTED_LOADED_LATENCY_BENCHMARK
         EXT_NUM_DELAY_INJECTED_LOADED_LATENCY_BENCHMARK,
@@ -524,6 +709,144 @@ namespace xmem {
      */
     int32_t cpu_id_in_numa_node(uint32_t numa_node, uint32_t cpu_in_node);
 
+    /**
+     * @brief Determines how closely two distinct logical CPUs are related in the processor topology.
+     * @param cpu_a The first logical CPU identifier.
+     * @param cpu_b The second logical CPU identifier.
+     * @returns The closest relation that holds for the two CPUs, or CPU_RELATION_UNKNOWN if the operating system does not provide the information.
+     */
+    cpu_relation_t get_cpu_relation(uint32_t cpu_a, uint32_t cpu_b);
+
+    /**
+     * @brief Gets a human-friendly name for a CPU topology relation.
+     * @param relation The relation.
+     * @returns The name.
+     */
+    std::string cpu_relation_name(cpu_relation_t relation);
+
+    /**
+     * @brief Gets the name of an atomic operation, as given on the command line.
+     * @param atomic_op The atomic operation.
+     * @returns The name.
+     */
+    std::string atomic_op_name(atomic_op_t atomic_op);
+
+    /**
+     * @brief Gets the name of an atomic operation sharing mode, as given on the command line.
+     * @param sharing The sharing mode.
+     * @returns The name.
+     */
+    std::string atomic_sharing_name(atomic_sharing_t sharing);
+
+    /**
+     * @brief Gets the instruction mnemonic of a cache line flush instruction.
+     * @param flush_op The flush instruction.
+     * @returns The name.
+     */
+    std::string flush_op_name(flush_op_t flush_op);
+
+    /**
+     * @brief Checks whether the processor supports a cache line flush instruction.
+     * @param flush_op The flush instruction.
+     * @returns True if the instruction can be used. Always false on non-Intel architectures.
+     */
+    bool flush_op_supported(flush_op_t flush_op);
+
+    /**
+     * @brief Gets a short description of a read/write mode for console reports, e.g., "read" or "2:1 read/write".
+     * @param rw_mode The read/write mode.
+     * @returns The description.
+     */
+    std::string rw_mode_name(rw_mode_t rw_mode);
+
+    /**
+     * @brief Gets the name of a copy or fill engine.
+     * @param engine The engine.
+     * @returns The name.
+     */
+    std::string copy_engine_name(copy_engine_t engine);
+
+    /**
+     * @brief Indicates whether an engine fills memory rather than copying it.
+     * @param engine The engine.
+     * @returns True for fill engines, which have no source buffer.
+     */
+    bool copy_engine_is_fill(copy_engine_t engine);
+
+    /**
+     * @brief Gets the name of a gather or scatter engine.
+     * @param engine The engine.
+     * @returns The name.
+     */
+    std::string gather_engine_name(gather_engine_t engine);
+
+    /**
+     * @brief Indicates whether an engine scatters (stores) rather than gathers (loads).
+     * @param engine The engine.
+     * @returns True for scatter engines.
+     */
+    bool gather_engine_is_scatter(gather_engine_t engine);
+
+    /**
+     * @brief Checks whether the processor and OS support a gather or scatter engine.
+     * @param engine The engine.
+     * @returns True if the engine can be used. The vector engines are always unsupported on non-x86-64 architectures.
+     */
+    bool gather_engine_supported(gather_engine_t engine);
+
+    /**
+     * @brief Gets the name of a gather/scatter index pattern.
+     * @param pattern The index pattern.
+     * @returns The name.
+     */
+    std::string gather_index_name(gather_index_t pattern);
+
+    /**
+     * @brief Gets the name of a data pattern.
+     * @param pattern The data pattern.
+     * @returns The name.
+     */
+    std::string data_pattern_name(data_pattern_t pattern);
+
+    /**
+     * @brief Gets the name of a 2D traversal order.
+     * @param order The traversal order.
+     * @returns The name.
+     */
+    std::string tile_order_name(tile_order_t order);
+
+    /**
+     * @brief Gets the name of a roofline engine.
+     * @param engine The engine.
+     * @returns The name.
+     */
+    std::string roofline_engine_name(roofline_engine_t engine);
+
+    /**
+     * @brief Indicates whether a roofline engine does integer rather than floating-point operations.
+     * @param engine The engine.
+     * @returns True for integer engines.
+     */
+    bool roofline_engine_is_integer(roofline_engine_t engine);
+
+    /**
+     * @brief Checks whether the processor and OS support a roofline engine.
+     * @param engine The engine.
+     * @returns True if the engine can be used. The vector engines are always unsupported on non-x86-64 architectures.
+     */
+    bool roofline_engine_supported(roofline_engine_t engine);
+
+    /**
+     * @brief Reads a file of two-column numeric points, one FIRST,SECOND pair per line. Blank lines and lines starting with # are skipped, as is a header on the first line. Extra columns after the second are ignored.
+     * @param filename Path to the file.
+     * @param what What the file holds, for error messages, e.g., "load profile".
+     * @param point_format The expected form of a point, for error messages, e.g., "TIME_MS,MBPS".
+     * @param first Vector that the first column is appended to.
+     * @param second Vector that the second column is appended to.
+     * @returns True on success. On failure, an error has been printed.
+     */
+    bool read_two_column_points(const std::string& filename, const std::string& what, const std::string& point_format, std::vector<double>& first, std::vector<double>& second);
+
     /**
      * @brief Computes the number of passes to use for a given working set size in KB, when size-based benchmarking mode is enabled at compile-time.
      * You may want to change this implementation to suit your needs. See the compile-time options in common.h.
@@ -0,0 +1,110 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Microsoft
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Author: Mark Gottscho <mgottscho@ucla.edu>
+ */
+
+/**
+ * @file
+ * 
+ * @brief Header file for the DelayInjectedLoadWorker class.
+ */
+
+#ifdef EXT_DELAY_INJECTED_LOADED_LATENCY_BENCHMARK
+
+#ifndef DELAY_INJECTED_LOAD_WORKER_H
+#define DELAY_INJECTED_LOAD_WORKER_H
+
+//Headers
+#include <MemoryWorker.h>
+#include <delay_injected_benchmark_kernels.h>
+
+namespace xmem {
+    /** 
+     * @brief Multithreading-friendly class to do memory loading with a runtime-configurable delay between memory accesses.
+     */
+    class DelayInjectedLoadWorker : public MemoryWorker {
+        public:
+            
+            /** 
+             * @brief Constructor for sequential and strided access patterns.
+             * @param mem_array Pointer to the memory region to use by this worker.
+             * @param len Length of the memory region to use by this worker.
+             * @param kernel_fptr Pointer to the delay-injected sequential core benchmark kernel to use.
+             * @param kernel_dummy_fptr Pointer to the delay-injected sequential dummy version of the core benchmark kernel to use.
+             * @param stride_size Stride in chunks to pass to the kernel.
+             * @param delay Number of nops to insert between memory accesses.
+             * @param cpu_affinity Logical CPU identifier to lock this worker's thread to.
+             */
+            DelayInjectedLoadWorker(
+                void* mem_array,
+                size_t len,
+                DelayInjectedSequentialFunction kernel_fptr,
+                DelayInjectedSequentialFunction kernel_dummy_fptr,
+                int32_t stride_size,
+                uint32_t delay,
+                int32_t cpu_affinity
+            );
+            
+            /** 
+             * @brief Constructor for random-access patterns.
+             * @param mem_array Pointer to the memory region to use by this worker.
+             * @param len Length of the memory region to use by this worker.
+             * @param kernel_fptr Pointer to the delay-injected random core benchmark kernel to use.
+             * @param kernel_dummy_fptr Pointer to the delay-injected random dummy version of the core benchmark kernel to use.
+             * @param delay Number of nops to insert between memory accesses.
+             * @param cpu_affinity Logical CPU identifier to lock this worker's thread to.
+             */
+            DelayInjectedLoadWorker(
+                void* mem_array,
+                size_t len,
+                DelayInjectedRandomFunction kernel_fptr,
+                DelayInjectedRandomFunction kernel_dummy_fptr,
+                uint32_t delay,
+                int32_t cpu_affinity
+            );
+            
+            /**
+             * @brief Destructor.
+             */
+            virtual ~DelayInjectedLoadWorker();
+
+            /**
+             * @brief Thread-safe worker method.
+             */
+            virtual void run();
+        
+        private:
+            // ONLY ACCESS OBJECT VARIABLES UNDER THE RUNNABLE OBJECT LOCK!!!!
+            bool use_sequential_kernel_fptr_; /**< If true, use the DelayInjectedSequentialFunction, otherwise use the DelayInjectedRandomFunction. */
+            DelayInjectedSequentialFunction kernel_fptr_seq_; /**< Points to the memory test core routine to use of the "sequential" type. */
+            DelayInjectedSequentialFunction kernel_dummy_fptr_seq_; /**< Points to a dummy version of the memory test core routine to use of the "sequential" type. */
+            DelayInjectedRandomFunction kernel_fptr_ran_; /**< Points to the memory test core routine to use of the "random" type. */
+            DelayInjectedRandomFunction kernel_dummy_fptr_ran_; /**< Points to a dummy version of the memory test core routine to use of the "random" type. */
+            int32_t stride_size_; /**< Stride in chunks for the "sequential" type of kernel. */
+            uint32_t delay_; /**< Number of nops to insert between memory accesses. */
+    };
+};
+
+#endif
+
+#endif
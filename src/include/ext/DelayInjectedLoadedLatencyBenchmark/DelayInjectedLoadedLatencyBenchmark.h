@@ -51,7 +51,8 @@ namespace xmem {
     public:
         
         /**
-         * @brief Constructor. Parameters are passed directly to the LatencyBenchmark constructor. See LatencyBenchmark class documentation for parameter semantics. The access pattern is hard-coded to SEQUENTIAL, read/write pattern to READ, and stride to 1. Chunk size may be either 64-bit or 256-bit.
+         * @brief Constructor. Parameters other than delay are passed directly to the LatencyBenchmark constructor. See LatencyBenchmark class documentation for parameter semantics. Load threads may use any pattern, read/write mode, chunk size, and stride that the delay-injected kernels support.
+         * @param delay Number of nops to insert between load thread memory accesses. A delay of 0 uses the regular load kernels.
          */
         DelayInjectedLoadedLatencyBenchmark(
             void* mem_array,
@@ -60,7 +61,10 @@ namespace xmem {
             uint32_t num_worker_threads,
             uint32_t mem_node,
             uint32_t cpu_node,
+            pattern_mode_t pattern_mode,
+            rw_mode_t rw_mode,
             chunk_size_t chunk_size,
+            int32_t stride_size,
             std::vector<PowerReader*> dram_power_readers,
             std::string name,
             uint32_t delay
@@ -26,7 +26,7 @@
 /**
  * @file
  * 
- * @brief Header file for benchmark kernel functions with integrated delays for doing the actual work we care about. :)
+ * @brief Header file for benchmark kernel functions with integrated delays for doing the actual work we care about. :) The delay is a runtime argument, so any number of nops may be injected between memory accesses without a separate compiled kernel per delay value.
  */
 
 #ifndef __DELAY_INJECTED_BENCHMARK_KERNELS_H
@@ -44,7 +44,7 @@
 #include <immintrin.h> //For Intel intrinsics
 #endif
 
-//Helper macros for inserting delays with nops.
+//Helper macro for inserting delays with nops.
 #ifdef _WIN32
 #define my_nop() __nop() //Works on both x86 family and ARM family as-is
 #endif
@@ -53,18 +53,30 @@
 #define my_nop() asm("nop") //Works on both x86 family and ARM family as-is
 #endif
 
-#define my_nop2() my_nop(); my_nop()
-#define my_nop4() my_nop2(); my_nop2()
-#define my_nop8() my_nop4(); my_nop4()
-#define my_nop16() my_nop8(); my_nop8()
-#define my_nop32() my_nop16(); my_nop16()
-#define my_nop64() my_nop32(); my_nop32()
-#define my_nop128() my_nop64(); my_nop64()
-#define my_nop256() my_nop128(); my_nop128()
-#define my_nop512() my_nop256(); my_nop256()
-#define my_nop1024() my_nop512(); my_nop512()
-
 namespace xmem {
+
+    typedef int32_t(*DelayInjectedSequentialFunction)(void*, void*, int32_t, uint32_t);
+    typedef int32_t(*DelayInjectedRandomFunction)(uintptr_t*, uintptr_t**, size_t, uint32_t);
+
+    /**
+     * @brief Determines which delay-injected sequential/strided memory access kernel to use based on the read/write mode and chunk size. The stride and delay are passed to the kernel at runtime.
+     * @param rw_mode Read/write mode.
+     * @param chunk_size Access granularity.
+     * @param kernel_function Function pointer that will be set to the matching kernel function.
+     * @param dummy_kernel_function Function pointer that will be set to the matching dummy kernel function.
+     * @returns True on success.
+     */
+    bool determine_delay_injected_sequential_kernel(rw_mode_t rw_mode, chunk_size_t chunk_size, DelayInjectedSequentialFunction* kernel_function, DelayInjectedSequentialFunction* dummy_kernel_function);
+
+    /**
+     * @brief Determines which delay-injected random memory access kernel to use based on the read/write mode and chunk size. The delay is passed to the kernel at runtime.
+     * @param rw_mode Read/write mode.
+     * @param chunk_size Access granularity.
+     * @param kernel_function Function pointer that will be set to the matching kernel function.
+     * @param dummy_kernel_function Function pointer that will be set to the matching dummy kernel function.
+     * @returns True on success.
+     */
+    bool determine_delay_injected_random_kernel(rw_mode_t rw_mode, chunk_size_t chunk_size, DelayInjectedRandomFunction* kernel_function, DelayInjectedRandomFunction* dummy_kernel_function);
     
     /***********************************************************************
      ***********************************************************************
@@ -75,641 +87,287 @@ namespace xmem {
     /* -------------------- DUMMY BENCHMARK ROUTINES -------------------------- */
     
     /**
-     * @brief Used for measuring the time spent doing everything in delay-injected forward sequential Word 32 loops except for the memory access and delays themselves.
+     * @brief Used for measuring the time spent doing everything in delay-injected strided Word 32 loops except for the memory access and delays themselves.
      * @param start_address The beginning of the memory region of interest.
      * @param end_address The end of the memory region of interest.
+     * @param stride_size Distance between successive accesses in chunks. Negative values walk in the reverse direction.
+     * @param delay Unused. The delay is not part of the loop overhead.
      * @returns Undefined.
      */
-    int32_t dummy_forwSequentialLoop_Word32_Delay1(void* start_address, void* end_address);
-    
-    /**
-     * @brief Used for measuring the time spent doing everything in delay-injected forward sequential Word 32 loops except for the memory access and delays themselves.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t dummy_forwSequentialLoop_Word32_Delay2(void* start_address, void* end_address);
+    int32_t dummy_stridedLoop_Word32_Delay(void* start_address, void* end_address, int32_t stride_size, uint32_t delay);
 
+#ifdef HAS_WORD_64
     /**
-     * @brief Used for measuring the time spent doing everything in delay-injected forward sequential Word 32 loops except for the memory access and delays themselves.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t dummy_forwSequentialLoop_Word32_Delay4(void* start_address, void* end_address);
-    
-    /**
-     * @brief Used for measuring the time spent doing everything in delay-injected forward sequential Word 32 loops except for the memory access and delays themselves.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t dummy_forwSequentialLoop_Word32_Delay8(void* start_address, void* end_address);
-    
-    /**
-     * @brief Used for measuring the time spent doing everything in delay-injected forward sequential Word 32 loops except for the memory access and delays themselves.
+     * @brief Used for measuring the time spent doing everything in delay-injected strided Word 64 loops except for the memory access and delays themselves.
      * @param start_address The beginning of the memory region of interest.
      * @param end_address The end of the memory region of interest.
+     * @param stride_size Distance between successive accesses in chunks. Negative values walk in the reverse direction.
+     * @param delay Unused. The delay is not part of the loop overhead.
      * @returns Undefined.
      */
-    int32_t dummy_forwSequentialLoop_Word32_Delay16(void* start_address, void* end_address);
+    int32_t dummy_stridedLoop_Word64_Delay(void* start_address, void* end_address, int32_t stride_size, uint32_t delay);
+#endif
 
+#ifdef HAS_WORD_128
     /**
-     * @brief Used for measuring the time spent doing everything in delay-injected forward sequential Word 32 loops except for the memory access and delays themselves.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t dummy_forwSequentialLoop_Word32_Delay32(void* start_address, void* end_address);
-    
-    /**
-     * @brief Used for measuring the time spent doing everything in delay-injected forward sequential Word 32 loops except for the memory access and delays themselves.
+     * @brief Used for measuring the time spent doing everything in delay-injected strided Word 128 loops except for the memory access and delays themselves.
      * @param start_address The beginning of the memory region of interest.
      * @param end_address The end of the memory region of interest.
+     * @param stride_size Distance between successive accesses in chunks. Negative values walk in the reverse direction.
+     * @param delay Unused. The delay is not part of the loop overhead.
      * @returns Undefined.
      */
-    int32_t dummy_forwSequentialLoop_Word32_Delay64(void* start_address, void* end_address);
+    int32_t dummy_stridedLoop_Word128_Delay(void* start_address, void* end_address, int32_t stride_size, uint32_t delay);
+#endif
 
+#ifdef HAS_WORD_256
     /**
-     * @brief Used for measuring the time spent doing everything in delay-injected forward sequential Word 32 loops except for the memory access and delays themselves.
+     * @brief Used for measuring the time spent doing everything in delay-injected strided Word 256 loops except for the memory access and delays themselves.
      * @param start_address The beginning of the memory region of interest.
      * @param end_address The end of the memory region of interest.
+     * @param stride_size Distance between successive accesses in chunks. Negative values walk in the reverse direction.
+     * @param delay Unused. The delay is not part of the loop overhead.
      * @returns Undefined.
      */
-    int32_t dummy_forwSequentialLoop_Word32_Delay128(void* start_address, void* end_address);
+    int32_t dummy_stridedLoop_Word256_Delay(void* start_address, void* end_address, int32_t stride_size, uint32_t delay);
+#endif
 
+#ifndef HAS_WORD_64 //special case: 32-bit architectures
     /**
-     * @brief Used for measuring the time spent doing everything in delay-injected forward sequential Word 32 loops except for the memory access and delays themselves.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t dummy_forwSequentialLoop_Word32_Delay256(void* start_address, void* end_address);
-    
-    /**
-     * @brief Used for measuring the time spent doing everything in delay-injected forward sequential Word 32 loops except for the memory access and delays themselves.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
+     * @brief Used for measuring the time spent doing everything in delay-injected random Word 32 loops except for the memory access and delays themselves.
+     * @param first_address Starting address to deference.
+     * @param last_touched_address Pointer to the last address that was touched.
+     * @param len Length of the memory region of interest in bytes.
+     * @param delay Unused. The delay is not part of the loop overhead.
      * @returns Undefined.
      */
-    int32_t dummy_forwSequentialLoop_Word32_Delay512plus(void* start_address, void* end_address);
-    
+    int32_t dummy_randomLoop_Word32_Delay(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len, uint32_t delay);
+#endif
+
 #ifdef HAS_WORD_64
     /**
-     * @brief Used for measuring the time spent doing everything in delay-injected forward sequential Word 64 loops except for the memory access and delays themselves.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t dummy_forwSequentialLoop_Word64_Delay1(void* start_address, void* end_address);
-    
-    /**
-     * @brief Used for measuring the time spent doing everything in delay-injected forward sequential Word 64 loops except for the memory access and delays themselves.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
+     * @brief Used for measuring the time spent doing everything in delay-injected random Word 64 loops except for the memory access and delays themselves.
+     * @param first_address Starting address to deference.
+     * @param last_touched_address Pointer to the last address that was touched.
+     * @param len Length of the memory region of interest in bytes.
+     * @param delay Unused. The delay is not part of the loop overhead.
      * @returns Undefined.
      */
-    int32_t dummy_forwSequentialLoop_Word64_Delay2(void* start_address, void* end_address);
+    int32_t dummy_randomLoop_Word64_Delay(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len, uint32_t delay);
+#endif
 
+#ifdef HAS_WORD_128
     /**
-     * @brief Used for measuring the time spent doing everything in delay-injected forward sequential Word 64 loops except for the memory access and delays themselves.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t dummy_forwSequentialLoop_Word64_Delay4(void* start_address, void* end_address);
-    
-    /**
-     * @brief Used for measuring the time spent doing everything in delay-injected forward sequential Word 64 loops except for the memory access and delays themselves.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t dummy_forwSequentialLoop_Word64_Delay8(void* start_address, void* end_address);
-    
-    /**
-     * @brief Used for measuring the time spent doing everything in delay-injected forward sequential Word 64 loops except for the memory access and delays themselves.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
+     * @brief Used for measuring the time spent doing everything in delay-injected random Word 128 loops except for the memory access and delays themselves.
+     * @param first_address Starting address to deference.
+     * @param last_touched_address Pointer to the last address that was touched.
+     * @param len Length of the memory region of interest in bytes.
+     * @param delay Unused. The delay is not part of the loop overhead.
      * @returns Undefined.
      */
-    int32_t dummy_forwSequentialLoop_Word64_Delay16(void* start_address, void* end_address);
+    int32_t dummy_randomLoop_Word128_Delay(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len, uint32_t delay);
+#endif
 
+#ifdef HAS_WORD_256
     /**
-     * @brief Used for measuring the time spent doing everything in delay-injected forward sequential Word 64 loops except for the memory access and delays themselves.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t dummy_forwSequentialLoop_Word64_Delay32(void* start_address, void* end_address);
-    
-    /**
-     * @brief Used for measuring the time spent doing everything in delay-injected forward sequential Word 64 loops except for the memory access and delays themselves.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
+     * @brief Used for measuring the time spent doing everything in delay-injected random Word 256 loops except for the memory access and delays themselves.
+     * @param first_address Starting address to deference.
+     * @param last_touched_address Pointer to the last address that was touched.
+     * @param len Length of the memory region of interest in bytes.
+     * @param delay Unused. The delay is not part of the loop overhead.
      * @returns Undefined.
      */
-    int32_t dummy_forwSequentialLoop_Word64_Delay64(void* start_address, void* end_address);
+    int32_t dummy_randomLoop_Word256_Delay(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len, uint32_t delay);
+#endif
+
+    /* -------------------- CORE BENCHMARK ROUTINES -------------------------- */
 
     /**
-     * @brief Used for measuring the time spent doing everything in delay-injected forward sequential Word 64 loops except for the memory access and delays themselves.
+     * @brief Walks over the allocated memory with the given stride, reading in 32-bit chunks. The given number of nops is inserted after each memory instruction.
      * @param start_address The beginning of the memory region of interest.
      * @param end_address The end of the memory region of interest.
+     * @param stride_size Distance between successive accesses in chunks. Negative values walk in the reverse direction. Accesses wrap around within the region.
+     * @param delay Number of nops to insert between memory instructions.
      * @returns Undefined.
      */
-    int32_t dummy_forwSequentialLoop_Word64_Delay128(void* start_address, void* end_address);
+    int32_t stridedRead_Word32_Delay(void* start_address, void* end_address, int32_t stride_size, uint32_t delay);
 
+#ifdef HAS_WORD_64
     /**
-     * @brief Used for measuring the time spent doing everything in delay-injected forward sequential Word 64 loops except for the memory access and delays themselves.
+     * @brief Walks over the allocated memory with the given stride, reading in 64-bit chunks. The given number of nops is inserted after each memory instruction.
      * @param start_address The beginning of the memory region of interest.
      * @param end_address The end of the memory region of interest.
+     * @param stride_size Distance between successive accesses in chunks. Negative values walk in the reverse direction. Accesses wrap around within the region.
+     * @param delay Number of nops to insert between memory instructions.
      * @returns Undefined.
      */
-    int32_t dummy_forwSequentialLoop_Word64_Delay256plus(void* start_address, void* end_address);
+    int32_t stridedRead_Word64_Delay(void* start_address, void* end_address, int32_t stride_size, uint32_t delay);
 #endif
 
 #ifdef HAS_WORD_128
     /**
-     * @brief Used for measuring the time spent doing everything in delay-injected forward sequential Word 128 loops except for the memory access and delays themselves.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t dummy_forwSequentialLoop_Word128_Delay1(void* start_address, void* end_address);
-    
-    /**
-     * @brief Used for measuring the time spent doing everything in delay-injected forward sequential Word 128 loops except for the memory access and delays themselves.
+     * @brief Walks over the allocated memory with the given stride, reading in 128-bit chunks. The given number of nops is inserted after each memory instruction.
      * @param start_address The beginning of the memory region of interest.
      * @param end_address The end of the memory region of interest.
+     * @param stride_size Distance between successive accesses in chunks. Negative values walk in the reverse direction. Accesses wrap around within the region.
+     * @param delay Number of nops to insert between memory instructions.
      * @returns Undefined.
      */
-    int32_t dummy_forwSequentialLoop_Word128_Delay2(void* start_address, void* end_address);
+    int32_t stridedRead_Word128_Delay(void* start_address, void* end_address, int32_t stride_size, uint32_t delay);
+#endif
 
+#ifdef HAS_WORD_256
     /**
-     * @brief Used for measuring the time spent doing everything in delay-injected forward sequential Word 128 loops except for the memory access and delays themselves.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t dummy_forwSequentialLoop_Word128_Delay4(void* start_address, void* end_address);
-    
-    /**
-     * @brief Used for measuring the time spent doing everything in delay-injected forward sequential Word 128 loops except for the memory access and delays themselves.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t dummy_forwSequentialLoop_Word128_Delay8(void* start_address, void* end_address);
-    
-    /**
-     * @brief Used for measuring the time spent doing everything in delay-injected forward sequential Word 128 loops except for the memory access and delays themselves.
+     * @brief Walks over the allocated memory with the given stride, reading in 256-bit chunks. The given number of nops is inserted after each memory instruction.
      * @param start_address The beginning of the memory region of interest.
      * @param end_address The end of the memory region of interest.
+     * @param stride_size Distance between successive accesses in chunks. Negative values walk in the reverse direction. Accesses wrap around within the region.
+     * @param delay Number of nops to insert between memory instructions.
      * @returns Undefined.
      */
-    int32_t dummy_forwSequentialLoop_Word128_Delay16(void* start_address, void* end_address);
+    int32_t stridedRead_Word256_Delay(void* start_address, void* end_address, int32_t stride_size, uint32_t delay);
+#endif
 
     /**
-     * @brief Used for measuring the time spent doing everything in delay-injected forward sequential Word 128 loops except for the memory access and delays themselves.
+     * @brief Walks over the allocated memory with the given stride, writing in 32-bit chunks. The given number of nops is inserted after each memory instruction.
      * @param start_address The beginning of the memory region of interest.
      * @param end_address The end of the memory region of interest.
+     * @param stride_size Distance between successive accesses in chunks. Negative values walk in the reverse direction. Accesses wrap around within the region.
+     * @param delay Number of nops to insert between memory instructions.
      * @returns Undefined.
      */
-    int32_t dummy_forwSequentialLoop_Word128_Delay32(void* start_address, void* end_address);
-    
-    /**
-     * @brief Used for measuring the time spent doing everything in delay-injected forward sequential Word 128 loops except for the memory access and delays themselves.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t dummy_forwSequentialLoop_Word128_Delay64(void* start_address, void* end_address);
-    
+    int32_t stridedWrite_Word32_Delay(void* start_address, void* end_address, int32_t stride_size, uint32_t delay);
+
+#ifdef HAS_WORD_64
     /**
-     * @brief Used for measuring the time spent doing everything in delay-injected forward sequential Word 128 loops except for the memory access and delays themselves.
+     * @brief Walks over the allocated memory with the given stride, writing in 64-bit chunks. The given number of nops is inserted after each memory instruction.
      * @param start_address The beginning of the memory region of interest.
      * @param end_address The end of the memory region of interest.
+     * @param stride_size Distance between successive accesses in chunks. Negative values walk in the reverse direction. Accesses wrap around within the region.
+     * @param delay Number of nops to insert between memory instructions.
      * @returns Undefined.
      */
-    int32_t dummy_forwSequentialLoop_Word128_Delay128plus(void* start_address, void* end_address);
+    int32_t stridedWrite_Word64_Delay(void* start_address, void* end_address, int32_t stride_size, uint32_t delay);
 #endif
 
-#ifdef HAS_WORD_256 
-    /**
-     * @brief Used for measuring the time spent doing everything in delay-injected forward sequential Word 256 loops except for the memory access and delays themselves.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t dummy_forwSequentialLoop_Word256_Delay1(void* start_address, void* end_address);
-    
+#ifdef HAS_WORD_128
     /**
-     * @brief Used for measuring the time spent doing everything in delay-injected forward sequential Word 256 loops except for the memory access and delays themselves.
+     * @brief Walks over the allocated memory with the given stride, writing in 128-bit chunks. The given number of nops is inserted after each memory instruction.
      * @param start_address The beginning of the memory region of interest.
      * @param end_address The end of the memory region of interest.
+     * @param stride_size Distance between successive accesses in chunks. Negative values walk in the reverse direction. Accesses wrap around within the region.
+     * @param delay Number of nops to insert between memory instructions.
      * @returns Undefined.
      */
-    int32_t dummy_forwSequentialLoop_Word256_Delay2(void* start_address, void* end_address);
+    int32_t stridedWrite_Word128_Delay(void* start_address, void* end_address, int32_t stride_size, uint32_t delay);
+#endif
 
+#ifdef HAS_WORD_256
     /**
-     * @brief Used for measuring the time spent doing everything in delay-injected forward sequential Word 256 loops except for the memory access and delays themselves.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t dummy_forwSequentialLoop_Word256_Delay4(void* start_address, void* end_address);
-    
-    /**
-     * @brief Used for measuring the time spent doing everything in delay-injected forward sequential Word 256 loops except for the memory access and delays themselves.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t dummy_forwSequentialLoop_Word256_Delay8(void* start_address, void* end_address);
-    
-    /**
-     * @brief Used for measuring the time spent doing everything in delay-injected forward sequential Word 256 loops except for the memory access and delays themselves.
+     * @brief Walks over the allocated memory with the given stride, writing in 256-bit chunks. The given number of nops is inserted after each memory instruction.
      * @param start_address The beginning of the memory region of interest.
      * @param end_address The end of the memory region of interest.
+     * @param stride_size Distance between successive accesses in chunks. Negative values walk in the reverse direction. Accesses wrap around within the region.
+     * @param delay Number of nops to insert between memory instructions.
      * @returns Undefined.
      */
-    int32_t dummy_forwSequentialLoop_Word256_Delay16(void* start_address, void* end_address);
+    int32_t stridedWrite_Word256_Delay(void* start_address, void* end_address, int32_t stride_size, uint32_t delay);
+#endif
 
+#ifndef HAS_WORD_64 //special case: 32-bit architectures
     /**
-     * @brief Used for measuring the time spent doing everything in delay-injected forward sequential Word 256 loops except for the memory access and delays themselves.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t dummy_forwSequentialLoop_Word256_Delay32(void* start_address, void* end_address);
-    
-    /**
-     * @brief Used for measuring the time spent doing everything in delay-injected forward sequential Word 256 loops except for the memory access and delays themselves.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
+     * @brief Walks over the allocated memory in random order by chasing pointers. Reads in 32-bit chunks. The given number of nops is inserted after each memory access.
+     * @param first_address Starting address to deference.
+     * @param last_touched_address Pointer to the last address that was touched.
+     * @param len Length of the memory region of interest in bytes.
+     * @param delay Number of nops to insert between memory accesses.
      * @returns Undefined.
      */
-    int32_t dummy_forwSequentialLoop_Word256_Delay64plus(void* start_address, void* end_address);
+    int32_t randomRead_Word32_Delay(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len, uint32_t delay);
 #endif
 
-    /* --------------------- CORE BENCHMARK ROUTINES --------------------------- */
-
-    /**
-     * @brief Walks over the allocated memory forward sequentially, reading in 32-bit chunks. 1 delays (nops) are inserted between memory instructions.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t forwSequentialRead_Word32_Delay1(void* start_address, void* end_address);
-    
-    /**
-     * @brief Walks over the allocated memory forward sequentially, reading in 32-bit chunks. 2 delays (nops) are inserted between memory instructions.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t forwSequentialRead_Word32_Delay2(void* start_address, void* end_address);
-    
-    /**
-     * @brief Walks over the allocated memory forward sequentially, reading in 32-bit chunks. 4 delays (nops) are inserted between memory instructions.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t forwSequentialRead_Word32_Delay4(void* start_address, void* end_address);
-    
-    /**
-     * @brief Walks over the allocated memory forward sequentially, reading in 32-bit chunks. 8 delays (nops) are inserted between memory instructions.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t forwSequentialRead_Word32_Delay8(void* start_address, void* end_address);
-    
-    /**
-     * @brief Walks over the allocated memory forward sequentially, reading in 32-bit chunks. 16 delays (nops) are inserted between memory instructions.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t forwSequentialRead_Word32_Delay16(void* start_address, void* end_address);
-    
-    /**
-     * @brief Walks over the allocated memory forward sequentially, reading in 32-bit chunks. 32 delays (nops) are inserted between memory instructions.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t forwSequentialRead_Word32_Delay32(void* start_address, void* end_address);
-    
-    /**
-     * @brief Walks over the allocated memory forward sequentially, reading in 32-bit chunks. 64 delays (nops) are inserted between memory instructions.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t forwSequentialRead_Word32_Delay64(void* start_address, void* end_address);
-    
+#ifdef HAS_WORD_64
     /**
-     * @brief Walks over the allocated memory forward sequentially, reading in 32-bit chunks. 128 delays (nops) are inserted between memory instructions.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
+     * @brief Walks over the allocated memory in random order by chasing pointers. Reads in 64-bit chunks. The given number of nops is inserted after each memory access.
+     * @param first_address Starting address to deference.
+     * @param last_touched_address Pointer to the last address that was touched.
+     * @param len Length of the memory region of interest in bytes.
+     * @param delay Number of nops to insert between memory accesses.
      * @returns Undefined.
      */
-    int32_t forwSequentialRead_Word32_Delay128(void* start_address, void* end_address);
-    
+    int32_t randomRead_Word64_Delay(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len, uint32_t delay);
+#endif
+
+#ifdef HAS_WORD_128
     /**
-     * @brief Walks over the allocated memory forward sequentially, reading in 32-bit chunks. 256 delays (nops) are inserted between memory instructions.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
+     * @brief Walks over the allocated memory in random order by chasing pointers. Reads in 128-bit chunks. The given number of nops is inserted after each memory access.
+     * @param first_address Starting address to deference.
+     * @param last_touched_address Pointer to the last address that was touched.
+     * @param len Length of the memory region of interest in bytes.
+     * @param delay Number of nops to insert between memory accesses.
      * @returns Undefined.
      */
-    int32_t forwSequentialRead_Word32_Delay256(void* start_address, void* end_address);
-    
+    int32_t randomRead_Word128_Delay(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len, uint32_t delay);
+#endif
+
+#ifdef HAS_WORD_256
     /**
-     * @brief Walks over the allocated memory forward sequentially, reading in 32-bit chunks. 512 delays (nops) are inserted between memory instructions.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
+     * @brief Walks over the allocated memory in random order by chasing pointers. Reads in 256-bit chunks. The given number of nops is inserted after each memory access.
+     * @param first_address Starting address to deference.
+     * @param last_touched_address Pointer to the last address that was touched.
+     * @param len Length of the memory region of interest in bytes.
+     * @param delay Number of nops to insert between memory accesses.
      * @returns Undefined.
      */
-    int32_t forwSequentialRead_Word32_Delay512(void* start_address, void* end_address);
-    
+    int32_t randomRead_Word256_Delay(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len, uint32_t delay);
+#endif
+
+#ifndef HAS_WORD_64 //special case: 32-bit architectures
     /**
-     * @brief Walks over the allocated memory forward sequentially, reading in 32-bit chunks. 1024 delays (nops) are inserted between memory instructions.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
+     * @brief Walks over the allocated memory in random order by chasing pointers. Reads and writes in 32-bit chunks. The given number of nops is inserted after each memory access.
+     * @param first_address Starting address to deference.
+     * @param last_touched_address Pointer to the last address that was touched.
+     * @param len Length of the memory region of interest in bytes.
+     * @param delay Number of nops to insert between memory accesses.
      * @returns Undefined.
      */
-    int32_t forwSequentialRead_Word32_Delay1024(void* start_address, void* end_address);
+    int32_t randomWrite_Word32_Delay(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len, uint32_t delay);
+#endif
 
 #ifdef HAS_WORD_64
     /**
-     * @brief Walks over the allocated memory forward sequentially, reading in 64-bit chunks. 1 delays (nops) are inserted between memory instructions.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t forwSequentialRead_Word64_Delay1(void* start_address, void* end_address);
-    
-    /**
-     * @brief Walks over the allocated memory forward sequentially, reading in 64-bit chunks. 2 delays (nops) are inserted between memory instructions.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t forwSequentialRead_Word64_Delay2(void* start_address, void* end_address);
-    
-    /**
-     * @brief Walks over the allocated memory forward sequentially, reading in 64-bit chunks. 4 delays (nops) are inserted between memory instructions.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t forwSequentialRead_Word64_Delay4(void* start_address, void* end_address);
-    
-    /**
-     * @brief Walks over the allocated memory forward sequentially, reading in 64-bit chunks. 8 delays (nops) are inserted between memory instructions.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t forwSequentialRead_Word64_Delay8(void* start_address, void* end_address);
-    
-    /**
-     * @brief Walks over the allocated memory forward sequentially, reading in 64-bit chunks. 16 delays (nops) are inserted between memory instructions.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t forwSequentialRead_Word64_Delay16(void* start_address, void* end_address);
-    
-    /**
-     * @brief Walks over the allocated memory forward sequentially, reading in 64-bit chunks. 32 delays (nops) are inserted between memory instructions.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t forwSequentialRead_Word64_Delay32(void* start_address, void* end_address);
-    
-    /**
-     * @brief Walks over the allocated memory forward sequentially, reading in 64-bit chunks. 64 delays (nops) are inserted between memory instructions.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
+     * @brief Walks over the allocated memory in random order by chasing pointers. Reads and writes in 64-bit chunks. The given number of nops is inserted after each memory access.
+     * @param first_address Starting address to deference.
+     * @param last_touched_address Pointer to the last address that was touched.
+     * @param len Length of the memory region of interest in bytes.
+     * @param delay Number of nops to insert between memory accesses.
      * @returns Undefined.
      */
-    int32_t forwSequentialRead_Word64_Delay64(void* start_address, void* end_address);
-    
-    /**
-     * @brief Walks over the allocated memory forward sequentially, reading in 64-bit chunks. 128 delays (nops) are inserted between memory instructions.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t forwSequentialRead_Word64_Delay128(void* start_address, void* end_address);
-    
-    /**
-     * @brief Walks over the allocated memory forward sequentially, reading in 64-bit chunks. 256 delays (nops) are inserted between memory instructions.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t forwSequentialRead_Word64_Delay256(void* start_address, void* end_address);
-    
-    /**
-     * @brief Walks over the allocated memory forward sequentially, reading in 64-bit chunks. 512 delays (nops) are inserted between memory instructions.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t forwSequentialRead_Word64_Delay512(void* start_address, void* end_address);
-    
-    /**
-     * @brief Walks over the allocated memory forward sequentially, reading in 64-bit chunks. 1024 delays (nops) are inserted between memory instructions.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t forwSequentialRead_Word64_Delay1024(void* start_address, void* end_address);
+    int32_t randomWrite_Word64_Delay(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len, uint32_t delay);
 #endif
 
 #ifdef HAS_WORD_128
     /**
-     * @brief Walks over the allocated memory forward sequentially, reading in 128-bit chunks. 1 delays (nops) are inserted between memory instructions.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t forwSequentialRead_Word128_Delay1(void* start_address, void* end_address);
-    
-    /**
-     * @brief Walks over the allocated memory forward sequentially, reading in 128-bit chunks. 2 delays (nops) are inserted between memory instructions.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t forwSequentialRead_Word128_Delay2(void* start_address, void* end_address);
-    
-    /**
-     * @brief Walks over the allocated memory forward sequentially, reading in 128-bit chunks. 4 delays (nops) are inserted between memory instructions.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t forwSequentialRead_Word128_Delay4(void* start_address, void* end_address);
-    
-    /**
-     * @brief Walks over the allocated memory forward sequentially, reading in 128-bit chunks. 8 delays (nops) are inserted between memory instructions.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t forwSequentialRead_Word128_Delay8(void* start_address, void* end_address);
-    
-    /**
-     * @brief Walks over the allocated memory forward sequentially, reading in 128-bit chunks. 16 delays (nops) are inserted between memory instructions.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t forwSequentialRead_Word128_Delay16(void* start_address, void* end_address);
-    
-    /**
-     * @brief Walks over the allocated memory forward sequentially, reading in 128-bit chunks. 32 delays (nops) are inserted between memory instructions.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t forwSequentialRead_Word128_Delay32(void* start_address, void* end_address);
-    
-    /**
-     * @brief Walks over the allocated memory forward sequentially, reading in 128-bit chunks. 64 delays (nops) are inserted between memory instructions.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t forwSequentialRead_Word128_Delay64(void* start_address, void* end_address);
-    
-    /**
-     * @brief Walks over the allocated memory forward sequentially, reading in 128-bit chunks. 128 delays (nops) are inserted between memory instructions.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t forwSequentialRead_Word128_Delay128(void* start_address, void* end_address);
-    
-    /**
-     * @brief Walks over the allocated memory forward sequentially, reading in 128-bit chunks. 256 delays (nops) are inserted between memory instructions.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t forwSequentialRead_Word128_Delay256(void* start_address, void* end_address);
-    
-    /**
-     * @brief Walks over the allocated memory forward sequentially, reading in 128-bit chunks. 512 delays (nops) are inserted between memory instructions.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
+     * @brief Walks over the allocated memory in random order by chasing pointers. Reads and writes in 128-bit chunks. The given number of nops is inserted after each memory access.
+     * @param first_address Starting address to deference.
+     * @param last_touched_address Pointer to the last address that was touched.
+     * @param len Length of the memory region of interest in bytes.
+     * @param delay Number of nops to insert between memory accesses.
      * @returns Undefined.
      */
-    int32_t forwSequentialRead_Word128_Delay512(void* start_address, void* end_address);
-    
-    /**
-     * @brief Walks over the allocated memory forward sequentially, reading in 128-bit chunks. 1024 delays (nops) are inserted between memory instructions.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t forwSequentialRead_Word128_Delay1024(void* start_address, void* end_address);
+    int32_t randomWrite_Word128_Delay(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len, uint32_t delay);
 #endif
 
 #ifdef HAS_WORD_256
     /**
-     * @brief Walks over the allocated memory forward sequentially, reading in 64-bit chunks. 1 delays (nops) are inserted between memory instructions.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t forwSequentialRead_Word256_Delay1(void* start_address, void* end_address);
-    
-    /**
-     * @brief Walks over the allocated memory forward sequentially, reading in 64-bit chunks. 2 delays (nops) are inserted between memory instructions.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t forwSequentialRead_Word256_Delay2(void* start_address, void* end_address);
-    
-    /**
-     * @brief Walks over the allocated memory forward sequentially, reading in 64-bit chunks. 4 delays (nops) are inserted between memory instructions.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t forwSequentialRead_Word256_Delay4(void* start_address, void* end_address);
-    
-    /**
-     * @brief Walks over the allocated memory forward sequentially, reading in 64-bit chunks. 8 delays (nops) are inserted between memory instructions.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t forwSequentialRead_Word256_Delay8(void* start_address, void* end_address);
-    
-    /**
-     * @brief Walks over the allocated memory forward sequentially, reading in 64-bit chunks. 16 delays (nops) are inserted between memory instructions.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t forwSequentialRead_Word256_Delay16(void* start_address, void* end_address);
-    
-    /**
-     * @brief Walks over the allocated memory forward sequentially, reading in 64-bit chunks. 32 delays (nops) are inserted between memory instructions.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t forwSequentialRead_Word256_Delay32(void* start_address, void* end_address);
-    
-    /**
-     * @brief Walks over the allocated memory forward sequentially, reading in 64-bit chunks. 64 delays (nops) are inserted between memory instructions.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t forwSequentialRead_Word256_Delay64(void* start_address, void* end_address);
-    
-    /**
-     * @brief Walks over the allocated memory forward sequentially, reading in 64-bit chunks. 128 delays (nops) are inserted between memory instructions.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t forwSequentialRead_Word256_Delay128(void* start_address, void* end_address);
-    
-    /**
-     * @brief Walks over the allocated memory forward sequentially, reading in 64-bit chunks. 256 delays (nops) are inserted between memory instructions.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t forwSequentialRead_Word256_Delay256(void* start_address, void* end_address);
-    
-    /**
-     * @brief Walks over the allocated memory forward sequentially, reading in 64-bit chunks. 512 delays (nops) are inserted between memory instructions.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t forwSequentialRead_Word256_Delay512(void* start_address, void* end_address);
-    
-    /**
-     * @brief Walks over the allocated memory forward sequentially, reading in 64-bit chunks. 1024 delays (nops) are inserted between memory instructions.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
+     * @brief Walks over the allocated memory in random order by chasing pointers. Reads and writes in 256-bit chunks. The given number of nops is inserted after each memory access.
+     * @param first_address Starting address to deference.
+     * @param last_touched_address Pointer to the last address that was touched.
+     * @param len Length of the memory region of interest in bytes.
+     * @param delay Number of nops to insert between memory accesses.
      * @returns Undefined.
      */
-    int32_t forwSequentialRead_Word256_Delay1024(void* start_address, void* end_address);
+    int32_t randomWrite_Word256_Delay(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len, uint32_t delay);
 #endif
 };
 
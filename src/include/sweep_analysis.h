@@ -0,0 +1,77 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Microsoft
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Author: Mark Gottscho <mgottscho@ucla.edu>
+ */
+
+/**
+ * @file
+ * 
+ * @brief Header file for analysis of working set size sweep results, e.g., to locate the capacity knees of the cache hierarchy.
+ */
+
+#ifndef SWEEP_ANALYSIS_H
+#define SWEEP_ANALYSIS_H
+
+//Headers
+#include <common.h>
+
+//Libraries
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Minimum relative change in the smoothed cost (latency or inverse throughput) between adjacent sweep points that is treated as a capacity knee rather than noise.
+ */
+#define SWEEP_KNEE_THRESHOLD 0.15
+
+/**
+ * @brief Minimum number of consecutive sweep points needed to call a segment a plateau of the memory hierarchy. Shorter segments are treated as transitions between levels.
+ */
+#define SWEEP_MIN_PLATEAU_POINTS 2
+
+namespace xmem {
+
+    /**
+     * @brief Describes one level of the memory hierarchy as observed in a working set size sweep.
+     */
+    typedef struct {
+        size_t first_working_set_size; /**< Smallest swept working set size in bytes that falls on this level's plateau. */
+        size_t last_working_set_size; /**< Largest swept working set size in bytes that falls on this level's plateau. */
+        size_t effective_capacity; /**< Estimated effective capacity of this level in bytes. This is 0 if no slower level was observed beyond it. */
+        double plateau_metric; /**< Median benchmark metric on this level's plateau, in the benchmark's own units. */
+    } memory_level_t;
+
+    /**
+     * @brief Locates the plateaus and capacity knees of the memory hierarchy in the results of a working set size sweep.
+     * The per-point results are median-filtered and segmented into plateaus wherever the smoothed cost changes by more than SWEEP_KNEE_THRESHOLD between adjacent points.
+     * The effective capacity of each level is then estimated from the points in the transition to the next level, assuming the hit rate falls off as capacity / working set size.
+     * @param working_set_sizes The working set sizes in bytes of each sweep point, in increasing order.
+     * @param metrics The benchmark metric of each sweep point.
+     * @param metric_is_rate If true, the metric is a rate where higher is better (e.g., MB/s). Otherwise, it is a cost where lower is better (e.g., ns/access).
+     * @param levels The detected levels, from fastest to slowest. This is cleared first.
+     * @returns True on success. False if the inputs are inconsistent or too short to analyze.
+     */
+    bool detect_memory_levels(const std::vector<size_t>& working_set_sizes, const std::vector<double>& metrics, bool metric_is_rate, std::vector<memory_level_t>& levels);
+};
+
+#endif
@@ -141,6 +141,66 @@ int main(int argc, char* argv[]) {
                 benchmgr.runLatencyBenchmarks();
             }
 
+            if (config.concurrentThroughputTestSelected()) {
+                benchmgr.runConcurrentThroughputBenchmarks();
+            }
+
+            if (config.interconnectTestSelected()) {
+                benchmgr.runInterconnectBenchmarks();
+            }
+
+            if (config.interferenceSelected()) {
+                benchmgr.runInterferenceGenerator();
+            }
+
+            if (config.coreToCoreLatencyTestSelected()) {
+                benchmgr.runCoreToCoreLatencyBenchmark();
+            }
+
+            if (config.coreToCoreBandwidthTestSelected()) {
+                benchmgr.runCoreToCoreBandwidthBenchmark();
+            }
+
+            if (config.atomicsTestSelected()) {
+                benchmgr.runAtomicBenchmark();
+            }
+
+            if (config.falseSharingTestSelected()) {
+                benchmgr.runFalseSharingBenchmark();
+            }
+
+            if (config.flushTestSelected()) {
+                benchmgr.runFlushBenchmark();
+            }
+
+            if (config.copyTestSelected()) {
+                benchmgr.runCopyBenchmark();
+            }
+
+            if (config.gatherTestSelected()) {
+                benchmgr.runGatherBenchmark();
+            }
+
+            if (config.multiStreamTestSelected()) {
+                benchmgr.runMultiStreamBenchmark();
+            }
+
+            if (config.unalignedTestSelected()) {
+                benchmgr.runUnalignedBenchmark();
+            }
+
+            if (config.dataPatternTestSelected()) {
+                benchmgr.runDataPatternBenchmark();
+            }
+
+            if (config.tiledTestSelected()) {
+                benchmgr.runTiledBenchmark();
+            }
+
+            if (config.rooflineTestSelected()) {
+                benchmgr.runRooflineBenchmark();
+            }
+
             if (config.extensionsEnabled()) {
                 std::cout << std::endl;
                 std::cout << "++++++++++++++++++++++++++++++++++++++++++++++++++++++++++" << std::endl;
@@ -0,0 +1,157 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Microsoft
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Author: Mark Gottscho <mgottscho@ucla.edu>
+ */
+
+/**
+ * @file
+ * 
+ * @brief Implementation file for analysis of working set size sweep results.
+ */
+
+//Headers
+#include <sweep_analysis.h>
+#include <common.h>
+
+//Libraries
+#include <cstdint>
+#include <vector>
+#include <algorithm>
+#include <cmath>
+
+using namespace xmem;
+
+/**
+ * @brief Computes the median of a contiguous range of values.
+ * @param values The values.
+ * @param first Index of the first value in the range.
+ * @param last Index of the last value in the range, inclusive.
+ * @returns The median value.
+ */
+static double median_of_range(const std::vector<double>& values, size_t first, size_t last) {
+    std::vector<double> sorted(values.begin() + first, values.begin() + last + 1);
+    std::sort(sorted.begin(), sorted.end());
+    if (sorted.size() % 2 == 0)
+        return (sorted[sorted.size()/2 - 1] + sorted[sorted.size()/2]) / 2;
+    return sorted[sorted.size()/2];
+}
+
+bool xmem::detect_memory_levels(const std::vector<size_t>& working_set_sizes, const std::vector<double>& metrics, bool metric_is_rate, std::vector<memory_level_t>& levels) {
+    size_t num_points = working_set_sizes.size();
+    levels.clear();
+
+    if (num_points != metrics.size() || num_points < SWEEP_MIN_PLATEAU_POINTS)
+        return false;
+
+    //Work in the cost domain (time per access or time per byte) so that slower levels always have higher values and hits/misses mix linearly.
+    std::vector<double> cost(num_points);
+    for (size_t i = 0; i < num_points; i++) {
+        if (metrics[i] <= 0) //Failed or missing benchmark result
+            return false;
+        cost[i] = metric_is_rate ? 1.0 / metrics[i] : metrics[i];
+    }
+
+    //Median-of-three filter. This removes isolated outliers without blurring genuine knees.
+    std::vector<double> smoothed(cost);
+    for (size_t i = 1; i+1 < num_points; i++) {
+        double window[3] = { cost[i-1], cost[i], cost[i+1] };
+        std::sort(window, window+3);
+        smoothed[i] = window[1];
+    }
+
+    //Segment the curve wherever the smoothed cost jumps by more than the knee threshold between adjacent points.
+    std::vector<size_t> segment_starts;
+    segment_starts.push_back(0);
+    for (size_t i = 1; i < num_points; i++) {
+        double smaller = std::min(smoothed[i-1], smoothed[i]);
+        if (std::fabs(smoothed[i] - smoothed[i-1]) / smaller > SWEEP_KNEE_THRESHOLD)
+            segment_starts.push_back(i);
+    }
+    segment_starts.push_back(num_points); //sentinel
+
+    //Keep only segments long enough to be plateaus. Adjacent plateaus that are not distinguishable are merged, which happens when a lone noisy point splits one level in two.
+    std::vector<size_t> plateau_first;
+    std::vector<size_t> plateau_last;
+    std::vector<double> plateau_cost;
+    for (size_t s = 0; s+1 < segment_starts.size(); s++) {
+        size_t first = segment_starts[s];
+        size_t last = segment_starts[s+1] - 1;
+        if (last - first + 1 < SWEEP_MIN_PLATEAU_POINTS)
+            continue;
+
+        double median_cost = median_of_range(cost, first, last);
+        if (!plateau_cost.empty()) {
+            double smaller = std::min(median_cost, plateau_cost.back());
+            if (std::fabs(median_cost - plateau_cost.back()) / smaller <= SWEEP_KNEE_THRESHOLD) {
+                plateau_last.back() = last;
+                plateau_cost.back() = median_of_range(cost, plateau_first.back(), last);
+                continue;
+            }
+        }
+
+        plateau_first.push_back(first);
+        plateau_last.push_back(last);
+        plateau_cost.push_back(median_cost);
+    }
+
+    //Describe each level and estimate its effective capacity from the transition points that follow it.
+    for (size_t k = 0; k < plateau_first.size(); k++) {
+        memory_level_t level;
+        level.first_working_set_size = working_set_sizes[plateau_first[k]];
+        level.last_working_set_size = working_set_sizes[plateau_last[k]];
+        level.plateau_metric = median_of_range(metrics, plateau_first[k], plateau_last[k]);
+        level.effective_capacity = 0;
+
+        if (k+1 < plateau_first.size()) {
+            size_t lower_bound = working_set_sizes[plateau_last[k]];
+            size_t upper_bound = working_set_sizes[plateau_first[k+1]];
+            double span = plateau_cost[k+1] - plateau_cost[k];
+            double capacity_sum = 0;
+            uint32_t num_estimates = 0;
+
+            //With a working set of size W larger than capacity C, roughly C/W of accesses still hit in this level, so the cost of a transition point is a linear mix of the two plateaus.
+            for (size_t j = plateau_last[k]+1; j < plateau_first[k+1] && span > 0; j++) {
+                double hit_fraction = (plateau_cost[k+1] - cost[j]) / span;
+                if (hit_fraction < 0)
+                    hit_fraction = 0;
+                if (hit_fraction > 1)
+                    hit_fraction = 1;
+                capacity_sum += hit_fraction * static_cast<double>(working_set_sizes[j]);
+                num_estimates++;
+            }
+
+            size_t capacity = lower_bound;
+            if (num_estimates > 0)
+                capacity = static_cast<size_t>(capacity_sum / num_estimates);
+            if (capacity < lower_bound)
+                capacity = lower_bound;
+            if (capacity > upper_bound)
+                capacity = upper_bound;
+            level.effective_capacity = capacity;
+        }
+
+        levels.push_back(level);
+    }
+
+    return true;
+}